@@ -2,6 +2,8 @@
 #include <algorithm>
 #include "FreeRTOS.h"
 #include "bsp/Keyboard.hpp"
+#include "bsp/PCM5102.hpp"
+#include "dsp/Synth.hpp"
 
 void CMidiManager::Init(uint32_t dataUpdateRate) {
     std::fill_n(channelTable, 128, kInvalidChannel);
@@ -9,6 +11,16 @@ void CMidiManager::Init(uint32_t dataUpdateRate) {
 
 void CMidiManager::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity)
 {
+    // NoteOn的计算在锁外完成, 锁内只占位置和复制
+    dsp::NoteEvent e;
+    e.channel = channel;
+    e.note = note;
+    e.velocity = velocity;
+    if (velocity > 0) {
+        dsp::Synth.PlanNote(e);
+    }
+
+    Lock();
     if (note < 32) {
         reg0 |= kOne << note;
     }
@@ -23,6 +35,8 @@ void CMidiManager::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity)
     }
     velocityTable[note] = velocity;
     channelTable[note] = channel;
+    PushEvent(e);
+    Unlock();
 }
 
 uint8_t CMidiManager::NoteOn(uint8_t note, uint8_t velocity) {
@@ -35,6 +49,12 @@ uint8_t CMidiManager::NoteOn(uint8_t note, uint8_t velocity) {
 }
 
 void CMidiManager::NoteOff(uint8_t channel, uint8_t note) {
+    dsp::NoteEvent e;
+    e.channel = channel;
+    e.note = note;
+    e.velocity = 0;
+
+    Lock();
     if (note < 32) {
         reg0 &= ~(kOne << note);
     }
@@ -49,6 +69,8 @@ void CMidiManager::NoteOff(uint8_t channel, uint8_t note) {
     }
     velocityTable[note] = 0;
     channelTable[note] = kInvalidChannel;
+    PushEvent(e);
+    Unlock();
 }
 
 uint8_t CMidiManager::NoteOff(uint8_t note) {
@@ -60,15 +82,29 @@ uint8_t CMidiManager::NoteOff(uint8_t note) {
     return channel;
 }
 
-void CMidiManager::BackupState() {
-    diff0 = reg0 ^ lastReg0;
-    diff1 = reg1 ^ lastReg1;
-    diff2 = reg2 ^ lastReg2;
-    diff3 = reg3 ^ lastReg3;
-    lastReg0 = reg0;
-    lastReg1 = reg1;
-    lastReg2 = reg2;
-    lastReg3 = reg3;
+uint32_t CMidiManager::PopEvents(uint32_t timeEnd, std::span<dsp::NoteEvent> out) {
+    uint32_t num = 0;
+    while (eventRead_ != eventWrite_ && num < out.size()) {
+        const auto& e = events_[eventRead_ % kEventQueueSize];
+        if (static_cast<int32_t>(e.time - timeEnd) >= 0) {
+            break;
+        }
+        out[num++] = e;
+        ++eventRead_;
+    }
+    return num;
+}
+
+void CMidiManager::PushEvent(const dsp::NoteEvent& e) {
+    if (eventWrite_ - eventRead_ >= kEventQueueSize) {
+        ++numDroppedEvents_;
+        return;
+    }
+    auto& slot = events_[eventWrite_ % kEventQueueSize];
+    slot = e;
+    // 在锁内取时间, 队列中的时间不会倒退
+    slot.time = bsp::PCM5102.GetSampleClock();
+    ++eventWrite_;
 }
 
 void CMidiManager::Lock() {
@@ -0,0 +1,70 @@
+#include "PresetBank.hpp"
+#include "stm32h7xx_hal.h"
+#include "bsp/DebugIO.hpp"
+
+static constexpr uint32_t kFlashAddress = 0x080E0000;
+
+void CPresetBank::LoadIfNeeded() {
+    if (loaded_) return;
+    loaded_ = true;
+    const uint32_t* src = reinterpret_cast<const uint32_t*>(kFlashAddress);
+    uint32_t* dst = reinterpret_cast<uint32_t*>(&presets_[0]);
+    uint32_t* dstEnd = reinterpret_cast<uint32_t*>(&presets_[kNumPresets]);
+    while (dst < dstEnd) {
+        *dst = *src;
+        ++dst;
+        ++src;
+    }
+}
+
+void CPresetBank::SaveIfRequested() {
+    // 写入时又有请求的话, 下一次再写一遍
+    if (saveRequested_.exchange(false, std::memory_order_acquire)) {
+        SaveToFlash();
+    }
+}
+
+bool CPresetBank::SaveToFlash() {
+    LoadIfNeeded();
+    auto state = HAL_FLASH_Unlock();
+    if (state != HAL_OK) {
+        bsp::Debug.XWriteLine("[error] failed to unlock flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
+        return false;
+    }
+    FLASH_EraseInitTypeDef erase;
+    erase.Banks = FLASH_BANK_1;
+    erase.NbSectors = 1;
+    erase.Sector = FLASH_SECTOR_7;
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    uint32_t tmp{};
+
+    bool ok = true;
+    state = HAL_FLASHEx_Erase(&erase, &tmp);
+    if (state == HAL_OK) {
+        uint32_t address = kFlashAddress;
+        constexpr uint32_t len = sizeof(presets_);
+        const uint32_t data = reinterpret_cast<uint32_t>(&presets_[0]);
+        for (uint32_t i = 0; i < len; i += 32) {
+            state = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address, (uint32_t)(data + i));
+            if (state == HAL_OK) {
+                address = address + 32;
+            }
+            else {
+                bsp::Debug.XWriteLine("[error] failed to program flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
+                ok = false;
+                break;
+            }
+        }
+    }
+    else {
+        bsp::Debug.XWriteLine("[error] failed to erase flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
+        ok = false;
+    }
+
+    state = HAL_FLASH_Lock();
+    if (state != HAL_OK) {
+        bsp::Debug.XWriteLine("[error] failed to lock flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
+    }
+    return ok;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <atomic>
+#include "dsp/params.hpp"
+
+/**
+ * @brief 保存在flash最后一个扇区的预设, GUI和SysEx传输共用
+ */
+class CPresetBank {
+public:
+    static constexpr uint32_t kNumPresets = 16;
+
+    // 第一次使用前从flash读出
+    void LoadIfNeeded();
+    dsp::SavedParams& GetPreset(uint32_t idx) {
+        LoadIfNeeded();
+        return presets_[idx];
+    }
+    // 整个bank的原始数据, 和flash中的格式相同
+    std::span<uint8_t> GetBytes() {
+        LoadIfNeeded();
+        return { reinterpret_cast<uint8_t*>(presets_), sizeof(presets_) };
+    }
+    // 擦除扇区需要较长时间, 只在低优先级任务中调用
+    bool SaveToFlash();
+    // 可以在其他任务中调用, 下一次 SaveIfRequested 时写入flash
+    void RequestSave() { saveRequested_.store(true, std::memory_order_release); }
+    // 在LCD任务中调用
+    void SaveIfRequested();
+private:
+    dsp::SavedParams presets_[kNumPresets]{};
+    bool loaded_{};
+    std::atomic<bool> saveRequested_{};
+};
+
+struct InternalPresetBank {
+    inline static CPresetBank instance;
+};
+
+static CPresetBank& PresetBank = InternalPresetBank::instance;
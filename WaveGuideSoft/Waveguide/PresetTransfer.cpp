@@ -0,0 +1,100 @@
+#include "PresetTransfer.hpp"
+#include <algorithm>
+#include <cstring>
+#include "MemAttributes.hpp"
+#include "PresetBank.hpp"
+#include "dsp/Synth.hpp"
+#include "dsp/Tuning.hpp"
+
+// 写入先放在这里, kCommit 时才应用
+static uint8_t bankBuffer_[sizeof(dsp::SavedParams) * CPresetBank::kNumPresets];
+static uint8_t currentBuffer_[sizeof(dsp::SavedParams)];
+MEM_BSS_SRAMD1 static uint8_t tuningBuffer_[CPresetTransfer::kTuningSize];
+// 上一次生效的音律文本, 读取时返回
+MEM_BSS_SRAMD1 static uint8_t tuningText_[CPresetTransfer::kTuningSize];
+
+static void SnapshotBank(std::span<uint8_t> buffer) {
+    auto bank = PresetBank.GetBytes();
+    std::copy(bank.begin(), bank.end(), buffer.begin());
+}
+
+static bool CommitBank(std::span<const uint8_t> buffer, uint8_t flags) {
+    auto bank = PresetBank.GetBytes();
+    std::copy(buffer.begin(), buffer.end(), bank.begin());
+    if (flags & utli::sysex::kCommitPersist) {
+        // 擦除扇区时MIDI接收会停住, 交给LCD任务
+        PresetBank.RequestSave();
+    }
+    return true;
+}
+
+static void SnapshotCurrent(std::span<uint8_t> buffer) {
+    dsp::SavedParams p{};
+    dsp::Synth.SaveParam(p);
+    std::memcpy(buffer.data(), &p, sizeof(p));
+}
+
+static bool CommitCurrent(std::span<const uint8_t> buffer, uint8_t /*flags*/) {
+    dsp::SavedParams p;
+    std::memcpy(&p, buffer.data(), sizeof(p));
+    if (static_cast<uint32_t>(p.instrument) >= static_cast<uint32_t>(dsp::Instrument::kNumInstruments)) {
+        return false;
+    }
+    dsp::Synth.LoadParam(p);
+    return true;
+}
+
+static void SnapshotTuning(std::span<uint8_t> buffer) {
+    std::copy(std::begin(tuningText_), std::end(tuningText_), buffer.begin());
+}
+
+// 取出一段以 '\0' 结束的文本, 没有 '\0' 时到buffer结尾
+static std::string_view NextText(std::span<const uint8_t>& buffer) {
+    const uint32_t len = std::find(buffer.begin(), buffer.end(), 0) - buffer.begin();
+    const std::string_view text{ reinterpret_cast<const char*>(buffer.data()), len };
+    buffer = buffer.subspan(std::min<uint32_t>(len + 1, buffer.size()));
+    return text;
+}
+
+static bool CommitTuning(std::span<const uint8_t> buffer, uint8_t flags) {
+    // 音律不保存到flash, 重启后是十二平均律
+    if (flags & utli::sysex::kCommitPersist) {
+        return false;
+    }
+    auto rest = buffer;
+    const auto scl = NextText(rest);
+    const auto kbm = NextText(rest);
+    if (!dsp::Tuning.RequestScale(scl, kbm)) {
+        return false;
+    }
+    std::copy(buffer.begin(), buffer.end(), std::begin(tuningText_));
+    return true;
+}
+
+static bool WriteSysEx(std::span<const uint8_t> msg) {
+    if (!bsp::USBMidi.WriteSysEx(msg)) return false;
+    bsp::USBMidi.NotifySend(false);
+    return true;
+}
+
+void CPresetTransfer::Init() {
+    const utli::CSysExTransfer::Region regions[] {
+        { bankBuffer_, SnapshotBank, CommitBank },
+        { currentBuffer_, SnapshotCurrent, CommitCurrent },
+        { tuningBuffer_, SnapshotTuning, CommitTuning },
+    };
+    static_assert(std::size(regions) == static_cast<uint32_t>(Region::kNumRegions));
+    transfer_.Init(regions, WriteSysEx);
+}
+
+void CPresetTransfer::Receive(const bsp::MidiEvent& e) {
+    utli::sysex::Packet p;
+    std::memcpy(p.data(), &e, sizeof(e));
+    if (assembler_.Push(p)) {
+        transfer_.OnMessage(assembler_.GetMessage());
+    }
+}
+
+void CPresetTransfer::Poll() {
+    transfer_.Poll();
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include "bsp/USBMidi.hpp"
+#include "utli/SysExTransfer.hpp"
+
+/**
+ * @brief 通过USB MIDI SysEx批量读写预设, 协议见 utli/SysEx.hpp
+ * region 0 是整个 PresetBank, region 1 是当前的音色
+ * region 2 是音律: .scl 和 .kbm 的文本, 各以 '\0' 结束, 剩下的填0
+ * .scl 为空时回到十二平均律, .kbm 为空时用默认映射, 不保存到flash
+ * 所有函数都在USB接收任务中调用, region 0 的 kCommitPersist 只请求保存, 由LCD任务写入flash
+ */
+class CPresetTransfer {
+public:
+    enum class Region : uint8_t {
+        kBank = 0,
+        kCurrent,
+        kTuning,
+        kNumRegions
+    };
+    static constexpr uint32_t kTuningSize = 2048;
+
+    void Init();
+    // 不是SysEx的包直接忽略
+    void Receive(const bsp::MidiEvent& e);
+    void Poll();
+    // 还有数据等待发送, 接收任务不能一直阻塞
+    bool IsBusy() const { return transfer_.IsBusy(); }
+    uint32_t GetNumOverflows() const { return assembler_.GetNumOverflows(); }
+private:
+    utli::sysex::Assembler assembler_;
+    utli::CSysExTransfer transfer_;
+};
+
+struct InternalPresetTransfer {
+    inline static CPresetTransfer instance;
+};
+
+static CPresetTransfer& PresetTransfer = InternalPresetTransfer::instance;
@@ -1,7 +1,23 @@
 #pragma once
 #include <cstdint>
 
+// I2S输出位数, 16/24/32
+#ifndef AUDIO_OUTPUT_BITS
+#define AUDIO_OUTPUT_BITS 16
+#endif
+static_assert(AUDIO_OUTPUT_BITS == 16 || AUDIO_OUTPUT_BITS == 24 || AUDIO_OUTPUT_BITS == 32);
+
+#if AUDIO_OUTPUT_BITS == 16
+using PcmSample = int16_t;
+#else
+// 24位左对齐放在32位里
+using PcmSample = int32_t;
+#endif
+
 struct StereoSample {
-    int16_t left;
-    int16_t right;
+    PcmSample left;
+    PcmSample right;
 };
+
+// float 1.0 对应的PCM值, 留6dB余量
+static constexpr float kPcmUnity = static_cast<float>(1u << (AUDIO_OUTPUT_BITS - 2));
@@ -0,0 +1,138 @@
+#include "KeyScanner.hpp"
+#include <iterator>
+
+namespace bsp {
+
+struct Step {
+    uint8_t address;
+    bool read;
+};
+
+// 地址线不在同一个GPIO口上, 每一步只改一位, 中间不会选中别的模块
+// 12-15没有模块, 从12开始, 最后回到12
+static constexpr Step kScanPath[] {
+    { 4, true }, { 0, true }, { 1, true }, { 3, true },
+    { 2, true }, { 6, true }, { 7, true }, { 5, true },
+    { 13, false }, { 9, true }, { 8, true }, { 10, true },
+    { 11, true }, { 15, false }, { 13, false }, { 12, false },
+};
+static constexpr uint32_t kScanPathLength = std::size(kScanPath);
+
+// 地址 -> 按键
+static constexpr uint8_t kKeyboardMap[] {
+    8, 10, 9, 11, 7, 6, 0, 2, 5, 4, 3, 1
+};
+
+// adc太小说明霍尔或者模块没有正常工作
+static constexpr uint16_t kMinValidAdc = 30 << 2;
+
+void CKeyScanner::Init(const Bus& bus, std::span<Frame, kNumKeys> frames) {
+    bus_ = bus;
+    frames_ = frames.data();
+    step_ = kIdle;
+}
+
+bool CKeyScanner::Start() {
+    if (step_ != kIdle) return false;
+    received_ = 0;
+    receiving_ = false;
+    probe_ = snapshot_.scans % kProbeInterval == 0;
+    // kIdle + 1 回绕到第0步
+    Advance();
+    return true;
+}
+
+void CKeyScanner::SkipStalled() {
+    if (step_ == kIdle) return;
+    // 只是慢, 不是没有回应
+    if (progress_ != checkedProgress_) {
+        checkedProgress_ = progress_;
+        return;
+    }
+    if (receiving_) {
+        bus_.cancel();
+        receiving_ = false;
+    }
+    const uint8_t address = kScanPath[step_].address;
+    if (missStreak_[address] < kAbsentStreak) {
+        ++missStreak_[address];
+    }
+    ++numMissed_;
+    Advance();
+}
+
+void CKeyScanner::OnReady() {
+    if (step_ == kIdle || receiving_ || !kScanPath[step_].read) return;
+    receiving_ = true;
+    bus_.receive(frames_[kScanPath[step_].address].data);
+}
+
+void CKeyScanner::OnReceived() {
+    if (!receiving_) return;
+    receiving_ = false;
+    const uint8_t address = kScanPath[step_].address;
+    received_ |= 1 << address;
+    missStreak_[address] = 0;
+    Advance();
+}
+
+// 前进到下一个需要读取的地址, 走完时发布快照
+void CKeyScanner::Advance() {
+    ++progress_;
+    for (;;) {
+        ++step_;
+        if (step_ == kScanPathLength) {
+            step_ = kIdle;
+            Publish();
+            bus_.scanDone();
+            return;
+        }
+        const auto& step = kScanPath[step_];
+        bus_.select(step.address);
+        if (step.read && (probe_ || missStreak_[step.address] < kAbsentStreak)) return;
+    }
+}
+
+void CKeyScanner::Publish() {
+    const uint32_t seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint16_t updated = 0;
+    uint16_t fresh = 0;
+    for (uint32_t address = 0; address < kNumKeys; ++address) {
+        if (!(received_ >> address & 1)) continue;
+        KeyFrame frame;
+        if (!KeyFrame_Decode(frames_[address].data, &frame) || frame.adc <= kMinValidAdc) {
+            ++numInvalid_;
+            continue;
+        }
+        const uint32_t key = kKeyboardMap[address];
+        snapshot_.adc[key] = frame.adc;
+        snapshot_.pos[key] = frame.pos;
+        snapshot_.tick[key] = frame.tick;
+        updated |= 1 << key;
+        if (frame.seq != lastSeq_[key]) {
+            fresh |= 1 << key;
+            lastSeq_[key] = frame.seq;
+        }
+    }
+    snapshot_.updated = updated;
+    snapshot_.fresh = fresh;
+    ++snapshot_.scans;
+
+    sequence_.store(seq + 2, std::memory_order_release);
+}
+
+// 写入只在中断里, 被打断时最多重试一次
+void CKeyScanner::GetSnapshot(Snapshot& out) const {
+    for (;;) {
+        const uint32_t seq = sequence_.load(std::memory_order_acquire);
+        if (seq & 1) continue;
+        out = snapshot_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == seq) return;
+    }
+}
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include <span>
+#include "KeyFrame.h"
+
+namespace bsp {
+
+/**
+ * @brief 和硬件无关的按键扫描
+ * 地址线选中一个CH552, 它准备好后拉低IRQ, 之后用DMA读一帧, 收完再选下一个
+ * 整轮扫描都在中断里推进, 结束后在中断里校验所有帧并发布快照
+ * 帧的格式见 ch552keyboard/include/KeyFrame.h
+ * 连续几轮没有回应的按键之后只偶尔尝试, 坏掉的模块不会拖慢整个扫描
+ * 固件中由 Keyboard.cpp 驱动, pctest 的 KeyScanSim 用模拟的总线驱动
+ *
+ * Start/SkipStalled 和 OnReady/OnReceived 不能同时运行, 固件中前两个在临界区里调用
+ * GetSnapshot 可以在任何地方调用, 不需要锁
+ */
+class CKeyScanner {
+public:
+    static constexpr uint32_t kNumKeys = 12;
+
+    static constexpr uint32_t kFrameSize = KEYFRAME_SIZE;
+
+    struct Frame {
+        uint8_t data[kFrameSize];
+    };
+
+    struct Snapshot {
+        // 10位
+        uint16_t adc[kNumKeys];
+        int8_t pos[kNumKeys];
+        // 模块上adc采样的时间, 单位100us
+        uint8_t tick[kNumKeys];
+        // 这一轮收到有效数据的按键, 其余的是上一轮的值
+        uint16_t updated;
+        // updated 中adc是新采样的按键, 其余是重复读到的旧数据
+        uint16_t fresh;
+        // 完成的扫描次数
+        uint32_t scans;
+    };
+
+    struct Bus {
+        // 切换地址线, 相邻两次只有一位不同
+        void (*select)(uint8_t address);
+        // 开始接收 kFrameSize 字节, 完成后调用 OnReceived
+        void (*receive)(uint8_t* buffer);
+        // 停止正在进行的接收
+        void (*cancel)();
+        // 一轮扫描结束, 在中断中调用
+        void (*scanDone)();
+    };
+
+    /**
+     * @param frames 接收缓冲, 按地址排列
+     */
+    void Init(const Bus& bus, std::span<Frame, kNumKeys> frames);
+    // 开始一轮扫描, 上一轮还没结束时返回false
+    bool Start();
+    // 上次调用之后扫描没有进展时, 放弃当前没有回应的按键, 继续扫描下一个
+    void SkipStalled();
+    bool IsBusy() const { return step_ != kIdle; }
+
+    // 选中的CH552拉低了IRQ
+    void OnReady();
+    // receive 完成
+    void OnReceived();
+
+    void GetSnapshot(Snapshot& out) const;
+    // 没有回应的次数
+    uint32_t GetNumMissed() const { return numMissed_; }
+    // 校验失败的次数
+    uint32_t GetNumInvalid() const { return numInvalid_; }
+private:
+    static constexpr uint32_t kIdle = UINT32_MAX;
+    // 连续没有回应这么多轮后认为模块不在
+    static constexpr uint8_t kAbsentStreak = 8;
+    // 不在的模块每隔这么多轮尝试一次
+    static constexpr uint32_t kProbeInterval = 256;
+
+    void Advance();
+    void Publish();
+
+    Bus bus_{};
+    Frame* frames_{};
+    uint32_t step_{ kIdle };
+    bool receiving_{};
+    uint16_t received_{};
+    bool probe_{};
+    // 每前进一步加1
+    uint32_t progress_{};
+    uint32_t checkedProgress_{};
+    uint8_t missStreak_[kNumKeys]{};
+    uint8_t lastSeq_[kNumKeys]{};
+
+    Snapshot snapshot_{};
+    // 奇数时正在写入快照
+    std::atomic<uint32_t> sequence_{};
+    uint32_t numMissed_{};
+    uint32_t numInvalid_{};
+};
+
+}
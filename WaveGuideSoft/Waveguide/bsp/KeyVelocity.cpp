@@ -0,0 +1,144 @@
+#include "KeyVelocity.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace bsp {
+
+// 找到或者重新开始跟踪时还不知道力度
+static constexpr uint8_t kUnknownVelocity = 100;
+
+// 两次采样之间线性插值越过 level 的时刻, l0 > l1
+static uint32_t CrossTime(int32_t l0, uint32_t t0, int32_t l1, uint32_t t1, int32_t level) {
+    if (l0 <= l1) return t1;
+    const auto d = std::clamp(l0 - level, int32_t{ 0 }, l0 - l1);
+    return t0 + (t1 - t0) * static_cast<uint32_t>(d) / static_cast<uint32_t>(l0 - l1);
+}
+
+void CKeyVelocity::Process(const CKeyScanner::Snapshot& snapshot) {
+    for (uint32_t i = 0; i < kNumKeys; ++i) {
+        if (!(snapshot.fresh >> i & 1)) continue;
+        auto& key = keys_[i];
+        const int32_t adc = static_cast<int32_t>(snapshot.adc[i]) << kLevelShift;
+        if (!key.valid || snapshot.scans - key.scan > kMaxScanGap) {
+            key.adc = adc;
+            key.level = adc << 1;
+            key.sampleTime = 0;
+            key.time = 0;
+            key.tick = snapshot.tick[i];
+            key.scan = snapshot.scans;
+            key.state = adc >= start_ ? State::kIdle : State::kDown;
+            key.velocity = kUnknownVelocity;
+            key.valid = true;
+            continue;
+        }
+        const int32_t lastLevel = key.level;
+        const uint32_t lastTime = key.time;
+        const uint32_t sampleTime = key.sampleTime + static_cast<uint8_t>(snapshot.tick[i] - key.tick);
+        key.tick = snapshot.tick[i];
+        key.scan = snapshot.scans;
+        // 两次采样的平均, 时间取两次采样的中点, 直线段上没有延迟
+        key.level = key.adc + adc;
+        key.time = key.sampleTime + sampleTime;
+        key.adc = adc;
+        key.sampleTime = sampleTime;
+        Track(key, lastLevel, lastTime);
+    }
+}
+
+void CKeyVelocity::Track(Key& key, int32_t lastLevel, uint32_t lastTime) {
+    if (key.state == State::kRising) {
+        if (key.level >= start_) {
+            key.state = State::kIdle;
+        }
+        else if (key.level > key.startLevel) {
+            key.startLevel = key.level;
+        }
+        else if (key.level < key.startLevel - kRestrikeDepth) {
+            // 最高点之下 kRestrikeDepth 当作这一次的起点
+            key.startLevel -= kRestrikeDepth;
+            key.startTime = CrossTime(lastLevel, lastTime, key.level, key.time, key.startLevel);
+            key.state = State::kMoving;
+        }
+        else if (key.level < end_) {
+            key.state = State::kDown;
+        }
+    }
+    else if (key.state == State::kIdle && key.level < start_) {
+        key.startLevel = start_;
+        key.startTime = CrossTime(lastLevel, lastTime, key.level, key.time, start_);
+        key.state = State::kMoving;
+    }
+    else if (key.state == State::kDown && key.level > end_) {
+        key.startLevel = key.level;
+        key.state = State::kRising;
+    }
+
+    if (key.state != State::kMoving) return;
+    if (key.level < end_) {
+        const uint32_t endTime = CrossTime(lastLevel, lastTime, key.level, key.time, end_);
+        key.travel = Normalize((endTime - key.startTime + 1) >> 1, key.startLevel - end_);
+        key.velocity = MapTime(key.travel);
+        key.state = State::kDown;
+    }
+    else if (key.level > key.startLevel) {
+        // 没按下去又抬起来了
+        key.startLevel = key.level;
+        key.state = key.level >= start_ ? State::kIdle : State::kRising;
+    }
+}
+
+// 只走了 distance 时折算成从起点到按下阈值的时间
+uint32_t CKeyVelocity::Normalize(uint32_t travel, int32_t distance) const {
+    const int32_t full = start_ - end_;
+    travel = std::min<uint32_t>(travel, slowTime_);
+    if (distance <= 0 || full <= 0) return travel;
+    return travel * static_cast<uint32_t>(full) / static_cast<uint32_t>(distance);
+}
+
+uint8_t CKeyVelocity::GetVelocity(uint32_t key) const {
+    const auto& k = keys_[key];
+    if (!k.valid) return kUnknownVelocity;
+    switch (k.state) {
+    case State::kDown:
+        return k.velocity;
+    case State::kMoving:
+        // 平均后的电平还没到, 用最新的采样估计
+        return MapTime(Normalize((k.sampleTime * 2 - k.startTime + 1) >> 1, k.startLevel - k.adc * 2));
+    default:
+        // 一次采样之内从起点之上到了按下
+        return kMaxVelocity;
+    }
+}
+
+uint8_t CKeyVelocity::MapTime(uint32_t travel) const {
+    if (travel >= slowTime_) return curve_[kCurveSize - 1];
+    // Q8 的表格下标, travel < slowTime_ <= 0xffff 不会溢出
+    const uint32_t pos = (travel << 16) / slowTime_;
+    const uint32_t idx = pos >> 8;
+    const int32_t frac = static_cast<int32_t>(pos & 0xff);
+    const int32_t a = curve_[idx];
+    const int32_t b = curve_[idx + 1];
+    return static_cast<uint8_t>(a + (((b - a) * frac) >> 8));
+}
+
+void CKeyVelocity::SetThresholds(uint16_t start, uint16_t end) {
+    start_ = static_cast<int32_t>(start) << (kLevelShift + 1);
+    end_ = static_cast<int32_t>(end) << (kLevelShift + 1);
+}
+
+void CKeyVelocity::SetCurve(uint16_t fastTime, uint16_t slowTime) {
+    slowTime_ = std::max<uint16_t>(slowTime, 2);
+    fastTime = std::clamp<uint16_t>(fastTime, 1, slowTime_ - 1);
+    const float logSlow = std::log(static_cast<float>(slowTime_));
+    const float range = logSlow - std::log(static_cast<float>(fastTime));
+    for (uint32_t i = 0; i < kCurveSize; ++i) {
+        const float t = static_cast<float>(slowTime_) * i / (kCurveSize - 1);
+        float v = kMaxVelocity;
+        if (t > fastTime) {
+            v = 1.0f + (kMaxVelocity - 1) * (logSlow - std::log(t)) / range;
+        }
+        curve_[i] = static_cast<uint8_t>(std::clamp(std::lround(v), 1l, static_cast<long>(kMaxVelocity)));
+    }
+}
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <cstdint>
+#include "KeyScanner.hpp"
+
+namespace bsp {
+
+/**
+ * @brief 和硬件无关的按键力度估计
+ * 跟踪每个按键的adc轨迹, 计时从越过起点阈值到越过按下阈值用了多久, 经过曲线换算成MIDI力度
+ * 时间用模块上的采样时间, 不受扫描抖动影响, 越过阈值的时刻在两次采样之间线性插值
+ * adc先经过两点平均的低通, 全部是整数运算, 每个按键每次采样只有几次乘除
+ * 没有回到起点就再次按下时, 从回升的最高点往下 kRestrikeDepth 开始计时, 按距离折算成完整行程的时间
+ * 固件中由 Keyboard.cpp 驱动, pctest 的 KeyVelocitySim 用模拟的按键轨迹驱动
+ */
+class CKeyVelocity {
+public:
+    static constexpr uint32_t kNumKeys = CKeyScanner::kNumKeys;
+    static constexpr uint8_t kMaxVelocity = 127;
+
+    // 每一轮扫描调用一次, 只处理新采样的按键
+    void Process(const CKeyScanner::Snapshot& snapshot);
+    /**
+     * @param start 起点阈值, 10位
+     * @param end 按下阈值, 10位, 要小于 start
+     */
+    void SetThresholds(uint16_t start, uint16_t end);
+    /**
+     * @brief 单位0.1ms, 不慢于 fast 是127, 不快于 slow 是1, 中间按时间的对数插值
+     */
+    void SetCurve(uint16_t fastTime, uint16_t slowTime);
+    // 按下时调用, 滤波后的轨迹还没越过按下阈值时按目前的速度估计
+    uint8_t GetVelocity(uint32_t key) const;
+    // 越过按下阈值时测到的行程时间, 单位0.1ms, 已经折算成完整行程
+    uint32_t GetTravelTime(uint32_t key) const { return keys_[key].travel; }
+private:
+    // 采样是 adc << kLevelShift, 电平是两次采样的和
+    static constexpr uint32_t kLevelShift = 4;
+    // 从最高点下落这么多才算再次按下, 10位
+    static constexpr int32_t kRestrikeDepth = 8 << (kLevelShift + 1);
+    // 超过这么多轮没有新采样就重新开始跟踪, 模块的时间8位回绕, 25.6ms
+    static constexpr uint32_t kMaxScanGap = 20;
+    static constexpr uint32_t kCurveSize = 257;
+
+    enum class State : uint8_t {
+        // 停在起点之上
+        kIdle,
+        // 正在下落, 等待越过按下阈值
+        kMoving,
+        // 已经越过按下阈值
+        kDown,
+        // 从按下回升, 没有回到起点
+        kRising,
+    };
+
+    struct Key {
+        int32_t adc;
+        int32_t level;
+        int32_t startLevel;
+        // 单位0.1ms, 从模块时间展开
+        uint32_t sampleTime;
+        // 电平的时间, 两次采样时间的和, 单位0.05ms
+        uint32_t time;
+        uint32_t startTime;
+        // 单位0.1ms
+        uint32_t travel;
+        uint32_t scan;
+        uint8_t tick;
+        uint8_t velocity;
+        State state;
+        bool valid;
+    };
+
+    void Track(Key& key, int32_t lastLevel, uint32_t lastTime);
+    uint32_t Normalize(uint32_t travel, int32_t distance) const;
+    uint8_t MapTime(uint32_t travel) const;
+
+    Key keys_[kNumKeys]{};
+    int32_t start_{ 128 << (2 + kLevelShift + 1) };
+    int32_t end_{ 115 << (2 + kLevelShift + 1) };
+    uint16_t slowTime_{ 1 };
+    // 0到slowTime_等分成 kCurveSize - 1 段
+    uint8_t curve_[kCurveSize]{};
+};
+
+}
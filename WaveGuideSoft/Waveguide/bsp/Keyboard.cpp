@@ -1,4 +1,6 @@
 #include "Keyboard.hpp"
+#include "KeyScanner.hpp"
+#include "KeyVelocity.hpp"
 #include "stm32h7xx_hal.h"
 #include "stm32h7xx_ll_gpio.h"
 #include "stm32h7xx_ll_exti.h"
@@ -6,11 +8,11 @@
 #include "bsp/DebugIO.hpp"
 
 #include "FreeRTOS.h"
-#include "semphr.h"
 #include "task.h"
 
 #include "utli/Clamp.hpp"
 #include "utli/Map.hpp"
+#include <cmath>
 
 #define CS_GPIO GPIOC
 #define CS_PIN GPIO_PIN_5
@@ -39,29 +41,50 @@
 
 namespace bsp {
 
-struct TransferData {
-    uint8_t checkCode;
-    uint8_t checkCode2;
-    uint8_t adc;
-    int8_t pos;
+// 每过这么久检查一次扫描有没有卡在没有回应的按键上
+static constexpr uint32_t kScanTimeoutMs = 1;
+// SetDataFilterAlphas 的 alpha 是按这个扫描率给的
+static constexpr float kFilterReferenceRate = 100.0f;
 
-    bool IsValid() const {
-        return checkCode == 0b11011000 && checkCode2 == 0b10101010 && adc > 30;
-    }
-};
-
-static constexpr uint8_t kKeyboardMap[] {
-    8, 10, 9, 11, 7, 6, 0, 2, 5, 4, 3, 1
+// 按cache line对齐, 收到数据后整块invalidate
+struct alignas(32) FrameBuffer {
+    CKeyScanner::Frame frames[CKeyScanner::kNumKeys];
 };
 
 static CKeyboard::KeyTransferData keyData_[CKeyboard::kNumKeys];
-MEM_DMA_SRAMD3 static TransferData transferBuffer_;
+MEM_DMA_SRAMD3 static FrameBuffer frameBuffer_;
+static CKeyScanner scanner_;
+static CKeyVelocity velocity_;
 static SPI_HandleTypeDef hspi_;
 static DMA_HandleTypeDef hdma_;
-static SemaphoreHandle_t spiSemHandle_ = nullptr;
-static StaticSemaphore_t spiSem_;
-static bool transferRequesing_ = false;
-static bool writeRead_ = false;
+static TaskHandle_t scanTask_ = nullptr;
+static uint8_t address_ = 12;
+
+static void WriteAddressPin(uint8_t changed, uint8_t address) {
+    const auto state = [address](uint8_t bit) { return (address & bit) ? GPIO_PIN_SET : GPIO_PIN_RESET; };
+    if (changed & 0b0001) HAL_GPIO_WritePin(A0_GPIO, A0_PIN, state(0b0001));
+    if (changed & 0b0010) HAL_GPIO_WritePin(A1_GPIO, A1_PIN, state(0b0010));
+    if (changed & 0b0100) HAL_GPIO_WritePin(A2_GPIO, A2_PIN, state(0b0100));
+    if (changed & 0b1000) HAL_GPIO_WritePin(A3_GPIO, A3_PIN, state(0b1000));
+}
+
+static const CKeyScanner::Bus kKeyBus {
+    .select = [](uint8_t address) {
+        WriteAddressPin(address ^ address_, address);
+        address_ = address;
+    },
+    .receive = [](uint8_t* buffer) {
+        HAL_SPI_Receive_DMA(&hspi_, buffer, CKeyScanner::kFrameSize);
+    },
+    .cancel = [] {
+        HAL_SPI_Abort(&hspi_);
+    },
+    .scanDone = [] {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(scanTask_, &woken);
+        portYIELD_FROM_ISR(woken);
+    },
+};
 
 void CKeyboard::Init(uint32_t dataRate) {
     dataRate_ = dataRate;
@@ -77,7 +100,7 @@ void CKeyboard::Init(uint32_t dataRate) {
     hspi_.Init.CLKPolarity = SPI_POLARITY_LOW;
     hspi_.Init.CLKPhase = SPI_PHASE_1EDGE;
     hspi_.Init.NSS = SPI_NSS_SOFT;
-    hspi_.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_128;
+    hspi_.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_64; // 1.875MHz, 5字节帧在1ms内扫完12个键
     hspi_.Init.FirstBit = SPI_FIRSTBIT_MSB;
     hspi_.Init.TIMode = SPI_TIMODE_DISABLE;
     hspi_.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
@@ -137,6 +160,7 @@ void CKeyboard::Init(uint32_t dataRate) {
     // read write pin
     gpioInit.Pin = WRITE_READ_PIN;
     HAL_GPIO_Init(WRITE_READ_GPIO, &gpioInit);
+    HAL_GPIO_WritePin(WRITE_READ_GPIO, WRITE_READ_PIN, GPIO_PIN_RESET); // 一直是读
     
     // irq
     gpioInit.Alternate = 0;
@@ -168,48 +192,46 @@ void CKeyboard::Init(uint32_t dataRate) {
     HAL_NVIC_EnableIRQ(BDMA_Channel0_IRQn);
     HAL_NVIC_SetPriority(BDMA_Channel0_IRQn, 10, 0);
     
-    // semaphore init
-    spiSemHandle_ = xSemaphoreCreateBinaryStatic(&spiSem_);
+    hspi_.RxCpltCallback = [](SPI_HandleTypeDef*) {
+        SCB_InvalidateDCache_by_Addr(&frameBuffer_, sizeof(frameBuffer_));
+        scanner_.OnReceived();
+    };
+
+    // scanner init
+    scanTask_ = xTaskGetCurrentTaskHandle();
+    scanner_.Init(kKeyBus, frameBuffer_.frames);
+    SetDataFilterAlphas(dataFilterAlphas_);
+    SetVelocityStartValue(velocityStartValue_);
+    SetVelocityCurve(velocityFastTime_, velocitySlowTime_);
     vTaskDelay(1000); // 等待CH552G开机
+    scanner_.Start();
 }
 
+// 取出上一轮的结果后马上开始下一轮, 扫描和按键处理同时进行
 void CKeyboard::UpdateData() {
-    // reciving data
-    HAL_GPIO_WritePin(WRITE_READ_GPIO, WRITE_READ_PIN, GPIO_PIN_RESET); // read
-    HAL_GPIO_WritePin(A3_GPIO, A3_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(4);
-    HAL_GPIO_WritePin(A2_GPIO, A2_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(0);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_SET);
-    Keyboard_Read(1);
-    HAL_GPIO_WritePin(A1_GPIO, A1_PIN, GPIO_PIN_SET);
-    Keyboard_Read(3);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(2);
-    HAL_GPIO_WritePin(A2_GPIO, A2_PIN, GPIO_PIN_SET);
-    Keyboard_Read(6);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_SET);
-    Keyboard_Read(7);
-    HAL_GPIO_WritePin(A1_GPIO, A1_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(5);
-    HAL_GPIO_WritePin(A3_GPIO, A3_PIN, GPIO_PIN_SET); // 13
-    HAL_GPIO_WritePin(A2_GPIO, A2_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(9);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_RESET);
-    Keyboard_Read(8);
-    HAL_GPIO_WritePin(A1_GPIO, A1_PIN, GPIO_PIN_SET);
-    Keyboard_Read(10);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_SET);
-    Keyboard_Read(11);
-    HAL_GPIO_WritePin(A2_GPIO, A2_PIN, GPIO_PIN_SET); // 15
-    HAL_GPIO_WritePin(A1_GPIO, A1_PIN, GPIO_PIN_RESET);
-    HAL_GPIO_WritePin(A0_GPIO, A0_PIN, GPIO_PIN_RESET); // 12
+    while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(kScanTimeoutMs)) == 0) {
+        taskENTER_CRITICAL();
+        scanner_.SkipStalled();
+        taskEXIT_CRITICAL();
+    }
+    CKeyScanner::Snapshot snapshot;
+    scanner_.GetSnapshot(snapshot);
+    taskENTER_CRITICAL();
+    scanner_.Start();
+    taskEXIT_CRITICAL();
+
+    velocity_.Process(snapshot);
+    for (uint32_t i = 0; i < kNumKeys; ++i) {
+        if (!(snapshot.updated & (1 << i))) continue;
+        // 阈值和界面都是按8位设置的
+        keyData_[i].adcValue = snapshot.adc[i] >> 2;
+        keyData_[i].fingerPostion = snapshot.pos[i];
+    }
 
     // filter data
     for (uint32_t i = 0; i < kNumKeys; ++i) {
-        auto f = filteredPositions_[i] * dataFilterAlphas_ + keyData_[i].fingerPostion * (1.0f - dataFilterAlphas_);
-        f = std::clamp(f, -127.0f, 127.0f);
-        filteredPositions_[i] = static_cast<int8_t>(f);
+        auto f = filteredPositions_[i] * filterCoeff_ + keyData_[i].fingerPostion * (1.0f - filterCoeff_);
+        filteredPositions_[i] = std::clamp(f, -127.0f, 127.0f);
     }
 }
 
@@ -231,7 +253,7 @@ void CKeyboard::ProcessData() {
         else if (data.adcValue < adcDownValue_ && !(mask & keyPressFlags_)) {
             // key press
             keyPressFlags_ |= mask;
-            keyDownCallback_(i);
+            keyDownCallback_(i, velocity_.GetVelocity(i));
         }
         mask <<= 1;
     }
@@ -246,7 +268,7 @@ uint8_t CKeyboard::GetPressure(uint8_t keyIndex) const {
 }
 
 int8_t CKeyboard::GetFingerPosition(uint8_t keyIndex) const {
-    return filteredPositions_[keyIndex];
+    return static_cast<int8_t>(filteredPositions_[keyIndex]);
 }
 
 uint8_t CKeyboard::GetAdcValue(uint8_t keyIndex) const {
@@ -255,49 +277,34 @@ uint8_t CKeyboard::GetAdcValue(uint8_t keyIndex) const {
 
 void CKeyboard::SetDataFilterAlphas(float alpha) {
     dataFilterAlphas_ = std::clamp(alpha, 0.0f, 1.0f);
+    // 换算到实际扫描率, 时间常数不随扫描率变化
+    filterCoeff_ = std::pow(dataFilterAlphas_, kFilterReferenceRate / static_cast<float>(dataRate_));
 }
 
-bool CKeyboard::IsKeyPressed(uint8_t idx) const {
-    // return keyPressFlags_ & (1 << kNote2KeyIdxTable[idx]);
-    return keyPressFlags_ & (1 << idx);
+void CKeyboard::SetADCDownValue(uint8_t value) {
+    adcDownValue_ = value;
+    SetVelocityStartValue(velocityStartValue_);
 }
 
-void CKeyboard::Keyboard_Read(uint8_t idx) {
-    transferRequesing_ = true;
-    writeRead_ = false;
-    if (xSemaphoreTake(spiSemHandle_, pdMS_TO_TICKS(3)) == pdTRUE) { // not timeout
-        if (transferBuffer_.IsValid()) {
-            idx = kKeyboardMap[idx];
-            keyData_[idx].adcValue = transferBuffer_.adc;
-            keyData_[idx].fingerPostion = transferBuffer_.pos;
-        }
-    }
+void CKeyboard::SetVelocityStartValue(uint8_t value) {
+    // 起点要在按下值之上
+    velocityStartValue_ = std::max<uint8_t>(value, adcDownValue_ + 1);
+    velocity_.SetThresholds(velocityStartValue_ << 2, adcDownValue_ << 2);
 }
 
-void CKeyboard::Keyboard_Write(uint8_t idx) {
-    transferRequesing_ = true;
-    writeRead_ = true;
-    if (xSemaphoreTake(spiSemHandle_, pdMS_TO_TICKS(3)) == pdTRUE) { // not timeout
-        // do nothing
-    }
+void CKeyboard::SetVelocityCurve(uint16_t fastTime, uint16_t slowTime) {
+    velocitySlowTime_ = std::clamp<uint16_t>(slowTime, 2, 2000);
+    velocityFastTime_ = std::clamp<uint16_t>(fastTime, 1, velocitySlowTime_ - 1);
+    velocity_.SetCurve(velocityFastTime_, velocitySlowTime_);
+}
+
+bool CKeyboard::IsKeyPressed(uint8_t idx) const {
+    // return keyPressFlags_ & (1 << kNote2KeyIdxTable[idx]);
+    return keyPressFlags_ & (1 << idx);
 }
 
 extern "C" void EXTI0_IRQHandler(void) {
-    if (transferRequesing_) {
-        transferRequesing_ = false;
-        if (writeRead_) { // write
-            hspi_.TxCpltCallback = [](SPI_HandleTypeDef*) {
-                xSemaphoreGiveFromISR(spiSemHandle_, nullptr);
-            };
-            HAL_SPI_Transmit_IT(&hspi_, reinterpret_cast<uint8_t *>(&transferBuffer_), sizeof(transferBuffer_));
-        }
-        else { // read
-            hspi_.RxCpltCallback = [](SPI_HandleTypeDef*) {
-                xSemaphoreGiveFromISR(spiSemHandle_, nullptr);
-            };
-            HAL_SPI_Receive_IT(&hspi_, reinterpret_cast<uint8_t *>(&transferBuffer_), sizeof(transferBuffer_));
-        }
-    }
+    scanner_.OnReady();
     LL_EXTI_ClearFlag_0_31(LL_EXTI_LINE_0);
 }
 
@@ -24,13 +24,21 @@ public:
 
     void SetADCUpValue(uint8_t value) { adcUpValue_ = value; }
     uint8_t GetADCUpValue() const { return adcUpValue_; }
-    void SetADCDownValue(uint8_t value) { adcDownValue_ = value; }
+    void SetADCDownValue(uint8_t value);
     uint8_t GetADCDownValue() const { return adcDownValue_; }
-    void SetKeyDownCallback(void(*callback)(uint8_t keyIdx)) { keyDownCallback_ = callback; }
+    void SetKeyDownCallback(void(*callback)(uint8_t keyIdx, uint8_t velocity)) { keyDownCallback_ = callback; }
     void SetKeyUpCallback(void(*callback)(uint8_t keyIdx)) { keyUpCallback_ = callback; }
     void SetMinAdcValue(uint8_t value) { adcMinValue_ = value; }
     uint8_t GetMinAdcValue() const { return adcMinValue_; }
 
+    // 从这里到按下值的时间决定力度, 8位
+    void SetVelocityStartValue(uint8_t value);
+    uint8_t GetVelocityStartValue() const { return velocityStartValue_; }
+    // 单位0.1ms, 比fast快的是127, 比slow慢的是1
+    void SetVelocityCurve(uint16_t fastTime, uint16_t slowTime);
+    uint16_t GetVelocityFastTime() const { return velocityFastTime_; }
+    uint16_t GetVelocitySlowTime() const { return velocitySlowTime_; }
+
     void SetMPEEnable(bool enable) { enableMPE_ = enable; }
     bool IsMPEEnabled() const { return enableMPE_; }
 
@@ -39,16 +47,19 @@ public:
     uint32_t GetDataRate() const { return dataRate_; }
     bool IsKeyPressed(uint8_t idx) const;
 private:
-    void Keyboard_Read(uint8_t idx);
-    void Keyboard_Write(uint8_t idx);
-
+    // 100Hz时的系数, 界面上调的是这个
     float dataFilterAlphas_{ 0.9f };
-    int8_t filteredPositions_[kNumKeys]{};
+    // 换算到 dataRate_ 的系数
+    float filterCoeff_{ 0.9f };
+    float filteredPositions_[kNumKeys]{};
     uint8_t adcUpValue_{ 120 };
     uint8_t adcDownValue_{ 115 };
+    uint8_t velocityStartValue_{ 128 };
+    uint16_t velocityFastTime_{ 15 };
+    uint16_t velocitySlowTime_{ 200 };
     uint16_t keyPressFlags_{};
     uint16_t lastKeyPressFlags_{};
-    void(*keyDownCallback_)(uint8_t keyIdx){};
+    void(*keyDownCallback_)(uint8_t keyIdx, uint8_t velocity){};
     void(*keyUpCallback_)(uint8_t keyIdx){};
     bool enableMPE_{ true };
     uint32_t dataRate_{};
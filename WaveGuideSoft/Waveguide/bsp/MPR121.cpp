@@ -1,6 +1,7 @@
 #include "MPR121.hpp"
 #include "stm32h7xx_hal.h"
 #include "SystemHook.hpp"
+#include "MemAttributes.hpp"
 #include <cstdio>
 #include <algorithm>
 
@@ -9,9 +10,25 @@
 
 namespace bsp {
 
+// 0x00-0x01 触摸状态, 0x02-0x03 超范围状态, 0x04-0x1d 12个电极的滤波数据, 读的时候地址自动递增
+static constexpr uint8_t kBurstStartReg = 0x00;
+static constexpr uint16_t kBurstSize = 0x1e;
+// 两个芯片都读完大约2.6ms, 超时说明总线卡住了
+static constexpr uint32_t kBurstTimeoutMs = 5;
+
+// 一个cache line, 收完直接invalidate整块
+struct alignas(32) BurstBuffer {
+    uint8_t data[32];
+};
+static_assert(sizeof(BurstBuffer) >= kBurstSize);
+
 static I2C_HandleTypeDef hi2c4_;
+static DMA_HandleTypeDef hdma_;
+MEM_DMA_SRAMD3 static BurstBuffer touchPadBuffer_;
+MEM_DMA_SRAMD3 static BurstBuffer modWheelBuffer_;
 static SemaphoreHandle_t i2cSemHandle_{ nullptr };
 static StaticSemaphore_t i2cSem_;
+static volatile bool burstOk_ = false;
 
 void CMPR121::Init(uint32_t dataRate) {
     dataRate_ = dataRate;
@@ -54,6 +71,26 @@ void CMPR121::Init(uint32_t dataRate) {
     HAL_NVIC_EnableIRQ(I2C4_ER_IRQn);
     HAL_NVIC_SetPriority(I2C4_ER_IRQn, 10, 0);
 
+    // i2c rx dma init, I2C4在D3域只能用BDMA
+    __HAL_RCC_BDMA_CLK_ENABLE();
+    hdma_.Instance = BDMA_Channel1;
+    hdma_.Init.Request = BDMA_REQUEST_I2C4_RX;
+    hdma_.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hdma_.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_.Init.Mode = DMA_NORMAL;
+    hdma_.Init.Priority = DMA_PRIORITY_HIGH;
+    hdma_.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&hdma_);
+
+    hi2c4_.hdmarx = &hdma_;
+    hdma_.Parent = &hi2c4_;
+
+    HAL_NVIC_EnableIRQ(BDMA_Channel1_IRQn);
+    HAL_NVIC_SetPriority(BDMA_Channel1_IRQn, 10, 0);
+
     // semaphore init
     i2cSemHandle_ = xSemaphoreCreateBinaryStatic(&i2cSem_);
 
@@ -61,30 +98,49 @@ void CMPR121::Init(uint32_t dataRate) {
     PowerUp(modWheelAdress_);
 }
 
-uint16_t CMPR121::_GetEleData(uint8_t address, int ele) {
-    uint8_t LSB = ReadByte(address, 0x04 + ele * 2);
-    uint8_t MSB = ReadByte(address, 0x04 + ele * 2 + 1);
-    return ((MSB & 0b00000011) << 8) | LSB;
+// 触摸状态只有低13位, 电极数据是10位
+static void DecodeBurst(const BurstBuffer& buffer, uint16_t& touchData, uint16_t* eleData) {
+    const uint8_t* d = buffer.data;
+    touchData = (d[1] & 0x1f) << 8 | d[0];
+    for (uint32_t i = 0; i < CMPR121::kNumEles; ++i) {
+        eleData[i] = ((d[5 + i * 2] & 0b00000011) << 8) | d[4 + i * 2];
+    }
 }
 
-uint16_t CMPR121::_GetTounchData(uint8_t address) {
-    uint8_t LSB = ReadByte(address, 0x00);
-    uint8_t MSB = ReadByte(address, 0x01);
-    return (MSB & 0x1f) << 8 | LSB;
+/**
+ * @brief 6个电极中数据最小(被触摸)的位置, 和两边的电极插值
+ * @return 0~5
+ */
+static float GetPeakPosition(const uint16_t* data) {
+    auto maxIt = std::min_element(data, data + 6);
+    auto idx = maxIt - data;
+    if (idx == 0) {
+        int32_t up = data[1];
+        int32_t down = data[0] + data[1];
+        return 1.0f - static_cast<float>(up) / static_cast<float>(down);
+    }
+    else if (idx == 5) {
+        int32_t up = data[5];
+        int32_t down = data[4] + data[5];
+        return 4.0f + static_cast<float>(up) / static_cast<float>(down);
+    }
+    else {
+        int32_t up = -data[idx - 1] + data[idx + 1];
+        int32_t down = data[idx - 1] + data[idx] + data[idx + 1];
+        return idx - static_cast<float>(up) / static_cast<float>(down);
+    }
 }
 
 static constexpr uint32_t kRemapTable[] {
     3, 4, 5, 7, 8, 10, 2, 1, 0, 11, 9, 6
 };
 void CMPR121::UpdateData() {
-    // transfer
-    touchData_ = _GetTounchData(touchPadAddress_);
-    for (uint32_t i = 0; i < kNumEles; ++i) {
-        eleData_[i] = _GetEleData(touchPadAddress_, i);
+    // transfer, 失败时保留上一次的数据
+    if (BurstRead(touchPadAddress_, touchPadBuffer_.data)) {
+        DecodeBurst(touchPadBuffer_, touchData_, eleData_);
     }
-    modWheelTouchData_ = _GetTounchData(modWheelAdress_);
-    for (uint32_t i = 0; i < kNumEles; ++i) {
-        modWheelEleData_[i] = _GetEleData(modWheelAdress_, i);
+    if (BurstRead(modWheelAdress_, modWheelBuffer_.data)) {
+        DecodeBurst(modWheelBuffer_, modWheelTouchData_, modWheelEleData_);
     }
 
     // process touchpad
@@ -94,75 +150,16 @@ void CMPR121::UpdateData() {
             remapEleData_[i] = eleData_[kRemapTable[i]];
         }
         // x: 0-5
-        {
-            auto maxIt = std::min_element(remapEleData_, remapEleData_ + 6);
-            auto idx = maxIt - remapEleData_;
-            float pos = 0;
-            if (idx == 0) {
-                int32_t up = remapEleData_[1];
-                int32_t down = remapEleData_[0] + remapEleData_[1];
-                pos = 1.0f - static_cast<float>(up) / static_cast<float>(down);
-            }
-            else if (idx == 5) {
-                int32_t up = remapEleData_[5];
-                int32_t down = remapEleData_[4] + remapEleData_[5];
-                pos = 4.0f + static_cast<float>(up) / static_cast<float>(down);
-            }
-            else {
-                int32_t up = -remapEleData_[idx - 1] + remapEleData_[idx + 1];
-                int32_t down = remapEleData_[idx - 1] + remapEleData_[idx] + remapEleData_[idx + 1];
-                pos = idx - static_cast<float>(up) / static_cast<float>(down);
-            }
-            position_.fX = pos / 5.0f;
-        }
+        position_.fX = GetPeakPosition(remapEleData_) / 5.0f;
         // y: 6-11
-        {
-            auto* yArrayBegin = remapEleData_ + 6;
-            auto maxIt = std::min_element(yArrayBegin, remapEleData_ + 12);
-            auto idx = maxIt - yArrayBegin;
-            float pos = 0;
-            if (idx == 0) {
-                int32_t up = yArrayBegin[1];
-                int32_t down = yArrayBegin[0] + yArrayBegin[1];
-                pos = 1.0f - static_cast<float>(up) / static_cast<float>(down);
-            }
-            else if (idx == 5) {
-                int32_t up = yArrayBegin[5];
-                int32_t down = yArrayBegin[4] + yArrayBegin[5];
-                pos = 4.0f + static_cast<float>(up) / static_cast<float>(down);
-            }
-            else {
-                int32_t up = -yArrayBegin[idx - 1] + yArrayBegin[idx + 1];
-                int32_t down = yArrayBegin[idx - 1] + yArrayBegin[idx] + yArrayBegin[idx + 1];
-                pos = idx - static_cast<float>(up) / static_cast<float>(down);
-            }
-            position_.fY = pos / 5.0f;
-        }
+        position_.fY = GetPeakPosition(remapEleData_ + 6) / 5.0f;
     }
     position_.fX = xFilter_.Process(position_.fX);
     position_.fY = yFilter_.Process(position_.fY);
 
     // process modwheel
     if (this->IsModWheelTouched()) {
-        auto maxIt = std::min_element(modWheelEleData_, modWheelEleData_ + 6);
-        auto idx = maxIt - modWheelEleData_;
-        float pos = 0;
-        if (idx == 0) {
-            int32_t up = modWheelEleData_[1];
-            int32_t down = modWheelEleData_[0] + modWheelEleData_[1];
-            pos = 1.0f - static_cast<float>(up) / static_cast<float>(down);
-        }
-        else if (idx == 5) {
-            int32_t up = modWheelEleData_[5];
-            int32_t down = modWheelEleData_[4] + modWheelEleData_[5];
-            pos = 4.0f + static_cast<float>(up) / static_cast<float>(down);
-        }
-        else {
-            int32_t up = -modWheelEleData_[idx - 1] + modWheelEleData_[idx + 1];
-            int32_t down = modWheelEleData_[idx - 1] + modWheelEleData_[idx] + modWheelEleData_[idx + 1];
-            pos = idx - static_cast<float>(up) / static_cast<float>(down);
-        }
-        modWheelPos_ = 1.0f - pos / 5.0f;
+        modWheelPos_ = 1.0f - GetPeakPosition(modWheelEleData_) / 5.0f;
     }
     else {
         modWheelPos_ = 0;
@@ -170,26 +167,7 @@ void CMPR121::UpdateData() {
     modWheelPos_ = modWheelFilter_.Process(modWheelPos_);
 
     if (this->IsPitchBendTouched()) {
-        auto* yArrayBegin = modWheelEleData_ + 6;
-        auto maxIt = std::min_element(yArrayBegin, modWheelEleData_ + 12);
-        auto idx = maxIt - yArrayBegin;
-        float pos = 0;
-        if (idx == 0) {
-            int32_t up = yArrayBegin[1];
-            int32_t down = yArrayBegin[0] + yArrayBegin[1];
-            pos = 1.0f - static_cast<float>(up) / static_cast<float>(down);
-        }
-        else if (idx == 5) {
-            int32_t up = yArrayBegin[5];
-            int32_t down = yArrayBegin[4] + yArrayBegin[5];
-            pos = 4.0f + static_cast<float>(up) / static_cast<float>(down);
-        }
-        else {
-            int32_t up = -yArrayBegin[idx - 1] + yArrayBegin[idx + 1];
-            int32_t down = yArrayBegin[idx - 1] + yArrayBegin[idx] + yArrayBegin[idx + 1];
-            pos = idx - static_cast<float>(up) / static_cast<float>(down);
-        }
-        pitchBendPos_ = pos / 5.0f;
+        pitchBendPos_ = GetPeakPosition(modWheelEleData_ + 6) / 5.0f;
     }
     else {
         pitchBendPos_ = 0.5f;
@@ -208,12 +186,28 @@ void CMPR121::WriteByte(uint8_t address, uint8_t reg, uint8_t data) {
     xSemaphoreTake(i2cSemHandle_, portMAX_DELAY);
 }
 
-static uint8_t data{};
-uint8_t CMPR121::ReadByte(uint8_t address, uint8_t reg) {
-    hi2c4_.MemRxCpltCallback = [](I2C_HandleTypeDef* hi2c) { xSemaphoreGiveFromISR(i2cSemHandle_, nullptr); };
-    HAL_I2C_Mem_Read_IT(&hi2c4_, address, reg, I2C_MEMADD_SIZE_8BIT, &data, 1);
-    xSemaphoreTake(i2cSemHandle_, portMAX_DELAY);
-    return data;
+bool CMPR121::BurstRead(uint8_t address, uint8_t* buffer) {
+    // 清掉上一次超时后才到的信号
+    xSemaphoreTake(i2cSemHandle_, 0);
+    burstOk_ = false;
+    hi2c4_.MemRxCpltCallback = [](I2C_HandleTypeDef* hi2c) {
+        burstOk_ = true;
+        xSemaphoreGiveFromISR(i2cSemHandle_, nullptr);
+    };
+    hi2c4_.ErrorCallback = [](I2C_HandleTypeDef* hi2c) { xSemaphoreGiveFromISR(i2cSemHandle_, nullptr); };
+    if (HAL_I2C_Mem_Read_DMA(&hi2c4_, address, kBurstStartReg, I2C_MEMADD_SIZE_8BIT, buffer, kBurstSize) != HAL_OK) {
+        return false;
+    }
+    if (xSemaphoreTake(i2cSemHandle_, pdMS_TO_TICKS(kBurstTimeoutMs)) != pdTRUE) {
+        // 总线卡住, 重新初始化I2C, gpio和时钟不受影响
+        HAL_DMA_Abort(&hdma_);
+        HAL_I2C_DeInit(&hi2c4_);
+        HAL_I2C_Init(&hi2c4_);
+        return false;
+    }
+    if (!burstOk_) return false;
+    SCB_InvalidateDCache_by_Addr(buffer, sizeof(BurstBuffer));
+    return true;
 }
 
 uint16_t CMPR121::GetEleDataByNum(int num) const {
@@ -288,4 +282,8 @@ extern "C" void I2C4_ER_IRQHandler(void) {
     HAL_I2C_ER_IRQHandler(&hi2c4_);
 }
 
+extern "C" void BDMA_Channel1_IRQHandler(void) {
+    HAL_DMA_IRQHandler(&hdma_);
+}
+
 }
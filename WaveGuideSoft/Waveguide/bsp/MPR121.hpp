@@ -40,11 +40,10 @@ public:
     float GetModWheelFilterTime() const { return modWheelFilter_.GetTime(); }
     float GetPitchBendFilterTime() const { return pitchBendFilter_.GetTime(); }
 private:
-    uint16_t _GetEleData(uint8_t address, int ele);
-    uint16_t _GetTounchData(uint8_t address);
     void PowerUp(uint8_t address);
     void WriteByte(uint8_t address, uint8_t reg, uint8_t data);
-    uint8_t ReadByte(uint8_t address, uint8_t reg);
+    // DMA读出0x00-0x1d, buffer 在 SRAMD3 且按cache line对齐
+    bool BurstRead(uint8_t address, uint8_t* buffer);
 
     uint16_t touchData_{};
     uint16_t eleData_[kNumEles]{};
@@ -1,4 +1,7 @@
 #include "PCM5102.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 
 #include "stm32h7xx_hal.h"
 
@@ -14,11 +17,21 @@ namespace bsp {
 static I2S_HandleTypeDef hi2s_;
 static DMA_HandleTypeDef hdma_;
 
-MEM_DMA_SRAMD1 static StereoSample dmaBuffer_[CPCM5102::kBufferSize];
+MEM_DMA_SRAMD1 static StereoSample dmaBuffer_[CPCM5102::kMaxBlockSize * 2];
 static volatile uint32_t offset_ = 0;
+static volatile uint32_t numHalfComplete_ = 0;
+static uint32_t blockSeq_ = 0;
+static uint32_t blockSize_ = CPCM5102::kDefaultBlockSize;
+static std::atomic<uint32_t> requestedBlockSize_{ CPCM5102::kDefaultBlockSize };
+// 修改block大小后采样时钟从这里继续
+static uint32_t clockBase_ = 0;
+// DMA停止到重新开始之间计数器无效, 采样时钟停在停止时的位置
+static volatile bool clockFrozen_ = false;
+static volatile uint32_t frozenClock_ = 0;
+static uint32_t numLateBlocks_ = 0;
+static uint32_t numSkippedBlocks_ = 0;
 static SemaphoreHandle_t dmaSemHandle_ = NULL;
 static StaticSemaphore_t dmaSem_;
-constexpr auto kGenSize = CPCM5102::kBlockSize;
 
 // --------------------------------------------------------------------------------
 // public
@@ -29,7 +42,13 @@ void CPCM5102::Init() {
     hi2s_.Instance = SPI1;
     hi2s_.Init.Mode = I2S_MODE_MASTER_TX;
     hi2s_.Init.Standard = I2S_STANDARD_PHILIPS;
+#if AUDIO_OUTPUT_BITS == 16
     hi2s_.Init.DataFormat = I2S_DATAFORMAT_16B;
+#elif AUDIO_OUTPUT_BITS == 24
+    hi2s_.Init.DataFormat = I2S_DATAFORMAT_24B;
+#else
+    hi2s_.Init.DataFormat = I2S_DATAFORMAT_32B;
+#endif
     hi2s_.Init.MCLKOutput = I2S_MCLKOUTPUT_ENABLE;
     hi2s_.Init.AudioFreq = kSampleRate;
     hi2s_.Init.CPOL = I2S_CPOL_LOW;
@@ -46,8 +65,13 @@ void CPCM5102::Init() {
     hdma_.Init.Direction = DMA_MEMORY_TO_PERIPH;
     hdma_.Init.PeriphInc = DMA_PINC_DISABLE;
     hdma_.Init.MemInc = DMA_MINC_ENABLE;
+#if AUDIO_OUTPUT_BITS == 16
     hdma_.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
     hdma_.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+#else
+    hdma_.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+    hdma_.Init.MemDataAlignment = DMA_MDATAALIGN_WORD;
+#endif
     hdma_.Init.Mode = DMA_CIRCULAR;
     hdma_.Init.Priority = DMA_PRIORITY_VERY_HIGH;
     hdma_.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
@@ -84,11 +108,13 @@ void CPCM5102::Init() {
 
     // os param init
     dmaSemHandle_ = xSemaphoreCreateBinaryStatic(&dmaSem_);
-    std::fill_n(dmaBuffer_, kBufferSize, StereoSample{});
+    std::fill_n(dmaBuffer_, std::size(dmaBuffer_), StereoSample{});
 }
 
 void CPCM5102::Start() {
-    HAL_I2S_Transmit_DMA(&hi2s_, (uint16_t*)dmaBuffer_, kBufferSize * 2);
+    offset_ = 0;
+    // 长度按每个声道的采样计, 与位数无关
+    HAL_I2S_Transmit_DMA(&hi2s_, (uint16_t*)dmaBuffer_, blockSize_ * 2 * 2);
 }
 
 void CPCM5102::Stop() {
@@ -103,7 +129,85 @@ void CPCM5102::DeInit() {
 
 std::span<StereoSample> CPCM5102::GetNextBlock() {
     xSemaphoreTake(dmaSemHandle_, portMAX_DELAY);
-    return std::span<StereoSample>(dmaBuffer_ + offset_, kGenSize);
+    uint32_t seq = numHalfComplete_;
+    if (seq - blockSeq_ > 1) {
+        numSkippedBlocks_ += seq - blockSeq_ - 1;
+    }
+    blockSeq_ = seq;
+    return std::span<StereoSample>(dmaBuffer_ + offset_, blockSize_);
+}
+
+uint32_t CPCM5102::GetBlockSize() const {
+    return blockSize_;
+}
+
+void CPCM5102::RequestBlockSize(uint32_t blockSize) {
+    requestedBlockSize_ = std::clamp(blockSize, kMinBlockSize, kMaxBlockSize);
+}
+
+bool CPCM5102::ApplyBlockSizeRequest() {
+    uint32_t blockSize = requestedBlockSize_;
+    if (blockSize == blockSize_) {
+        return false;
+    }
+
+    // 采样时钟保持连续, 包括当前这一半已经播放的部分, 队列中事件的时间戳仍然有效
+    taskENTER_CRITICAL();
+    const uint32_t now = GetSampleClock();
+    frozenClock_ = now;
+    clockFrozen_ = true;
+    taskEXIT_CRITICAL();
+
+    Stop();
+    clockBase_ = now;
+    numHalfComplete_ = 0;
+    blockSeq_ = 0;
+    blockSize_ = blockSize;
+    std::fill_n(dmaBuffer_, std::size(dmaBuffer_), StereoSample{});
+    xSemaphoreTake(dmaSemHandle_, 0);
+    Start();
+    clockFrozen_ = false;
+    return true;
+}
+
+uint32_t CPCM5102::GetSampleClock() const {
+    if (clockFrozen_) {
+        return frozenClock_;
+    }
+    uint32_t numHalf = numHalfComplete_;
+    uint32_t bufferSize = blockSize_ * 2;
+    uint32_t played = (bufferSize * 2 - __HAL_DMA_GET_COUNTER(&hdma_)) / 2 % bufferSize;
+    // 跨过半满点但中断还没执行时, numHalf 落后一个block
+    uint32_t playingHalf = played / blockSize_;
+    if (playingHalf != (numHalf & 1)) {
+        ++numHalf;
+    }
+    return clockBase_ + numHalf * blockSize_ + played % blockSize_;
+}
+
+uint32_t CPCM5102::GetBlockTime() const {
+    return clockBase_ + blockSeq_ * blockSize_;
+}
+
+bool CPCM5102::FinishBlock() {
+    // 中断序号变了说明DMA已经读到正在写的这一半
+    if (numHalfComplete_ != blockSeq_) {
+        ++numLateBlocks_;
+        return false;
+    }
+    return true;
+}
+
+uint32_t CPCM5102::GetBlockSeq() const {
+    return blockSeq_;
+}
+
+uint32_t CPCM5102::GetNumLateBlocks() const {
+    return numLateBlocks_;
+}
+
+uint32_t CPCM5102::GetNumSkippedBlocks() const {
+    return numSkippedBlocks_;
 }
 
 // --------------------------------------------------------------------------------
@@ -115,11 +219,13 @@ extern "C" void DMA1_Stream5_IRQHandler() {
 
 extern "C" void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef*) {
     offset_ = 0;
+    numHalfComplete_ = numHalfComplete_ + 1;
     xSemaphoreGiveFromISR(dmaSemHandle_, nullptr);
 }
 
 extern "C" void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef*) {
-    offset_ = kGenSize;
+    offset_ = blockSize_;
+    numHalfComplete_ = numHalfComplete_ + 1;
     xSemaphoreGiveFromISR(dmaSemHandle_, nullptr);
 }
 
@@ -3,13 +3,20 @@
 #include <cstdint>
 #include "Types.hpp"
 
+// 默认block大小, 480 = 10ms
+#ifndef AUDIO_BLOCK_SIZE
+#define AUDIO_BLOCK_SIZE 480
+#endif
+
 namespace bsp {
 
 class CPCM5102 {
 public:
     static constexpr uint32_t kSampleRate = 48000;
-    static constexpr uint32_t kBufferSize = 480 * 2;
-    static constexpr uint32_t kBlockSize = CPCM5102::kBufferSize / 2;
+    static constexpr uint32_t kMinBlockSize = 32;
+    static constexpr uint32_t kMaxBlockSize = 1024;
+    static constexpr uint32_t kDefaultBlockSize = AUDIO_BLOCK_SIZE;
+    static_assert(kDefaultBlockSize >= kMinBlockSize && kDefaultBlockSize <= kMaxBlockSize);
 
     void Init();
     void Start();
@@ -17,10 +24,38 @@ public:
     void DeInit();
 
     uint32_t GetSampleRate() const { return kSampleRate; }
-    uint32_t GetBufferSize() const { return kBufferSize; }
-    uint32_t GetBlockSize() const { return kBlockSize; }
+    uint32_t GetBufferSize() const { return GetBlockSize() * 2; }
+    uint32_t GetBlockSize() const;
+
+    /**
+     * @brief 请求修改block大小, 可以在任意任务中调用
+     * 由音频任务在两个block之间调用 ApplyBlockSizeRequest 生效
+     */
+    void RequestBlockSize(uint32_t blockSize);
+    /**
+     * @brief 有新的请求时停止DMA, 修改大小后重新开始
+     * @return 大小是否改变
+     */
+    bool ApplyBlockSizeRequest();
 
     std::span<StereoSample> GetNextBlock();
+
+    /**
+     * @brief DMA已经播放的采样数, 可以在中断中调用
+     */
+    uint32_t GetSampleClock() const;
+    /**
+     * @brief GetNextBlock返回时的采样时钟, 即上一个block周期的结束
+     */
+    uint32_t GetBlockTime() const;
+
+    /**
+     * @brief 写完block后调用, DMA已经开始播放这一半时返回false
+     */
+    bool FinishBlock();
+    uint32_t GetBlockSeq() const;
+    uint32_t GetNumLateBlocks() const;
+    uint32_t GetNumSkippedBlocks() const;
 };
 
 namespace internal {
@@ -27,6 +27,7 @@ namespace bsp {
 static SPI_HandleTypeDef hspi2_;
 static DMA_HandleTypeDef hdma_;
 MEM_DMA_SRAMD1 static OLEDRGBColor displayBuffer[OLEDDisplay::kBufferSize];
+MEM_BSS_SRAMD1 static TextCache textCache;
 static StaticSemaphore_t dmaSem_;
 static SemaphoreHandle_t dmaSemHandle_{ nullptr };
 
@@ -121,20 +122,43 @@ void CUC1638::Init() {
 
     // display init
     display.SetDisplayBuffer(displayBuffer);
+    display.SetTextCache(&textCache);
     dmaSemHandle_ = xSemaphoreCreateBinaryStatic(&dmaSem_);
 }
 
 void CUC1638::UpdateScreen() {
+    for (const auto& rect : display.GetDirtyRects()) {
+        SendWindow(rect);
+    }
+    display.ClearDirty();
+}
+
+void CUC1638::SendWindow(Rectange rect) {
+    // 超过半屏宽时按整行发, 窗口内的数据在buffer中连续, 一次DMA
+    if (rect.w * 2 > display.kWidth) {
+        rect.x = 0;
+        rect.w = display.kWidth;
+    }
     _WriteCommand(0x2A);	// set column(x) address
-	WriteAddress(0, display.kWidth);
+	WriteAddress(rect.x, rect.x + rect.w - 1);
 	_WriteCommand(0x2B);	// set Page(y) address
-	WriteAddress(0, display.kHeight);
+	WriteAddress(rect.y, rect.y + rect.h - 1);
 	_WriteCommand(0x2C);	//	Memory Write
     _DC(true);
     _CS(true);
     hspi2_.TxCpltCallback = [](SPI_HandleTypeDef* hspi) { xSemaphoreGiveFromISR(dmaSemHandle_, nullptr); };
-    HAL_SPI_Transmit_DMA(&hspi2_, reinterpret_cast<const uint8_t*>(display.getDisplayBuffer()), display.kBufferSize * sizeof(OLEDRGBColor));
-    xSemaphoreTake(dmaSemHandle_, portMAX_DELAY);
+    const auto* buffer = display.getDisplayBuffer();
+    if (rect.w == display.kWidth) {
+        HAL_SPI_Transmit_DMA(&hspi2_, reinterpret_cast<const uint8_t*>(buffer + rect.y * display.kWidth), rect.h * display.kWidth * sizeof(OLEDRGBColor));
+        xSemaphoreTake(dmaSemHandle_, portMAX_DELAY);
+    }
+    else {
+        // 屏幕在窗口内自动换行, 逐行接着发
+        for (int16_t row = 0; row < rect.h; ++row) {
+            HAL_SPI_Transmit_DMA(&hspi2_, reinterpret_cast<const uint8_t*>(buffer + rect.x + (rect.y + row) * display.kWidth), rect.w * sizeof(OLEDRGBColor));
+            xSemaphoreTake(dmaSemHandle_, portMAX_DELAY);
+        }
+    }
     _CS(false);
 }
 
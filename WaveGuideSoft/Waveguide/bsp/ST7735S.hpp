@@ -8,6 +8,7 @@ namespace bsp {
 class CUC1638 {
 public:
     void Init();
+    // 只发送 display 标记过的区域
     void UpdateScreen();
 
     void SetBKlight(bool on);
@@ -25,6 +26,7 @@ public:
     bool xMirror_{ true };
     bool yMirror_{ false };
 private:
+    void SendWindow(Rectange rect);
     void _DC(bool on);
     void _CS(bool on);
 };
@@ -10,29 +10,166 @@ extern "C" {
 #include "SystemHook.hpp"
 
 #include "FreeRTOS.h"
+#include "task.h"
 #include "semphr.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
 
 #include "bsp/DebugIO.hpp"
+#include "utli/SysEx.hpp"
 
 namespace bsp {
 
 static USBD_HandleTypeDef USBD_Device;
 
-// RX
-static constexpr uint32_t kEventBufferSize = 128;
-static MidiEvent midiRxBuffer_[kEventBufferSize];
-static uint32_t numRx_{};
+// RX, 中断只写ring, 任务中读
+static constexpr uint32_t kRxRingSize = 256;
+static_assert((kRxRingSize & (kRxRingSize - 1)) == 0);
+static MidiEvent midiRxRing_[kRxRingSize];
+static std::atomic<uint32_t> rxWrite_{};
+static std::atomic<uint32_t> rxRead_{};
+static uint32_t numRxDropped_{};
+static StaticSemaphore_t rxSem_;
+static SemaphoreHandle_t rxSemHandle_{};
 static void(*midiRxCallback_)(std::span<const MidiEvent>){};
 
 // tx
+// note on/off等必须按顺序全部送到的事件
 static constexpr uint32_t kTxBufferSize = 128;
+static MidiEvent midiTxQueue_[kTxBufferSize];
+static uint32_t txRead_{};
+static uint32_t txWrite_{};
+static uint32_t numTxDropped_{};
+// 控制器只保留最新值, 和上次发送的相同时不再发送
+// 0~15 pitchbend, 16~31 channel pressure, 之后是 poly aftertouch 和 CC, 按(状态字节, 音符/控制器号)查找
+struct ControllerSlot {
+    MidiEvent event;
+    // 上次发送的事件, 0为没有发送过
+    uint32_t sent;
+    bool pending;
+};
+static constexpr uint32_t kNumChannels = 16;
+static constexpr uint32_t kNumPolySlots = 32;
+static constexpr uint32_t kNumCCSlots = 16;
+static constexpr uint32_t kPressureSlot = kNumChannels;
+static constexpr uint32_t kPolySlot = kPressureSlot + kNumChannels;
+static constexpr uint32_t kCCSlot = kPolySlot + kNumPolySlots;
+static constexpr uint32_t kNumControllerSlots = kCCSlot + kNumCCSlots;
+static ControllerSlot controllers_[kNumControllerSlots];
+// 轮流发送, 包满时每个控制器都有机会
+static uint32_t controllerScan_{};
 static constexpr uint32_t kUsbTxSize = MIDI_EPIN_SIZE;
-static MidiEvent midiTxBuffer_[kTxBufferSize];
-static uint32_t numMidiTx_{};
+static constexpr uint32_t kEventsPerPacket = kUsbTxSize / sizeof(MidiEvent);
+static MidiEvent midiTxPacket_[kEventsPerPacket];
 static StaticSemaphore_t txCompleteSem_;
 static SemaphoreHandle_t txCompleteSemHandle_{};
+static StaticSemaphore_t txReadySem_;
+static SemaphoreHandle_t txReadySemHandle_{};
+// 主机没有取走数据时不会有完成中断
+static constexpr uint32_t kTxTimeoutMs = 10;
+
+static uint32_t ToRaw(MidiEvent e) {
+    return std::bit_cast<uint32_t>(e);
+}
+
+// [begin, end) 中 data1(状态和通道) 和 data2 相同的位置, 没有时用一个已经发出去的, 都在等待发送时返回 kNumControllerSlots
+static uint32_t FindKeyedSlot(uint32_t begin, uint32_t end, MidiEvent e) {
+    uint32_t unused = kNumControllerSlots;
+    for (uint32_t i = begin; i < end; ++i) {
+        const auto& slot = controllers_[i];
+        if (slot.event.codeIndexNumber != 0 && slot.event.data1 == e.data1 && slot.event.data2 == e.data2) {
+            return i;
+        }
+        if (unused == kNumControllerSlots && !slot.pending) {
+            unused = i;
+        }
+    }
+    return unused;
+}
+
+// 没有对应的控制器时返回 kNumControllerSlots
+static uint32_t FindControllerSlot(MidiEvent e) {
+    switch (e.GetType()) {
+    case MidiEvent::Type::kPitchBend:
+        return e.GetChannel();
+    case MidiEvent::Type::kPressure:
+        return kPressureSlot + e.GetChannel();
+    case MidiEvent::Type::kPolyPressure:
+        return FindKeyedSlot(kPolySlot, kCCSlot, e);
+    case MidiEvent::Type::kCC:
+        return FindKeyedSlot(kCCSlot, kNumControllerSlots, e);
+    default:
+        return kNumControllerSlots;
+    }
+}
+
+static void PushTxQueue(MidiEvent e) {
+    if (txWrite_ - txRead_ >= kTxBufferSize) {
+        ++numTxDropped_;
+        return;
+    }
+    midiTxQueue_[txWrite_ % kTxBufferSize] = e;
+    ++txWrite_;
+}
+
+// 音符事件之前写入的同一通道的控制器先放进队列, 接收端在音符之前收到(MPE的弯音和压力)
+// 也不会把上一个音符留下的旧值发到新音符之后
+static void FlushChannel(uint8_t channel) {
+    for (auto& slot : controllers_) {
+        if (!slot.pending || slot.event.GetChannel() != channel) continue;
+        if (txWrite_ - txRead_ >= kTxBufferSize) return;
+        slot.pending = false;
+        slot.sent = ToRaw(slot.event);
+        PushTxQueue(slot.event);
+    }
+}
+
+// 新音符开始后接收端可能重置了控制器, 下一个值总是发送
+static void ForgetSent(MidiEvent noteOn) {
+    controllers_[noteOn.GetChannel()].sent = 0;
+    controllers_[kPressureSlot + noteOn.GetChannel()].sent = 0;
+    MidiEvent poly = noteOn;
+    poly.data1 = 0xa0 | noteOn.GetChannel();
+    for (uint32_t i = kPolySlot; i < kCCSlot; ++i) {
+        auto& slot = controllers_[i];
+        if (slot.event.data1 == poly.data1 && slot.event.data2 == poly.data2) {
+            slot.sent = 0;
+        }
+    }
+}
+
+// 先放队列中的事件, 剩下的位置轮流放控制器, 音符之前的控制器已经在 Write 中放进队列
+static uint32_t FillPacket() {
+    uint32_t num = 0;
+    while (num < kEventsPerPacket && txRead_ != txWrite_) {
+        midiTxPacket_[num++] = midiTxQueue_[txRead_ % kTxBufferSize];
+        ++txRead_;
+    }
+    for (uint32_t i = 0; i < kNumControllerSlots && num < kEventsPerPacket; ++i) {
+        auto& slot = controllers_[controllerScan_];
+        if (slot.pending) {
+            slot.pending = false;
+            slot.sent = ToRaw(slot.event);
+            midiTxPacket_[num++] = slot.event;
+        }
+        controllerScan_ = (controllerScan_ + 1) % kNumControllerSlots;
+    }
+    return num;
+}
+
+// 主机没有连接时丢弃所有待发送的数据
+static void ClearTx() {
+    numTxDropped_ += txWrite_ - txRead_;
+    txRead_ = txWrite_;
+    for (auto& slot : controllers_) {
+        slot.pending = false;
+        slot.sent = 0;
+    }
+}
 
 void CUSBMidi::Init() {
+    rxSemHandle_ = xSemaphoreCreateBinaryStatic(&rxSem_);
     HAL_PWREx_EnableUSBVoltageDetector();
 
     /* Init Device Library */
@@ -54,39 +191,108 @@ void CUSBMidi::Init() {
     }
 
     txCompleteSemHandle_ = xSemaphoreCreateBinaryStatic(&txCompleteSem_);
+    txReadySemHandle_ = xSemaphoreCreateBinaryStatic(&txReadySem_);
 }
 
 void CUSBMidi::SendData() {
-    constexpr auto maxEvents = kUsbTxSize / sizeof(MidiEvent);
-    if (numMidiTx_ > maxEvents) {
-        USBD_MIDI_SendReport(&USBD_Device, reinterpret_cast<uint8_t*>(&midiTxBuffer_[0]), maxEvents * sizeof(MidiEvent));
-        numMidiTx_ -= maxEvents;
-        
+    taskENTER_CRITICAL();
+    const bool configured = USBD_Device.dev_state == USBD_STATE_CONFIGURED;
+    // 只有这里发送, 检查之后到发送之前不会变成忙
+    const bool idle = configured && USBD_MIDI_GetState(&USBD_Device) == MIDI_IDLE;
+    uint32_t num = 0;
+    if (!configured) {
+        ClearTx();
+    }
+    else if (idle) {
+        num = FillPacket();
     }
-    else if (numMidiTx_ != 0) {
-        USBD_MIDI_SendReport(&USBD_Device, reinterpret_cast<uint8_t*>(&midiTxBuffer_[0]), numMidiTx_ * sizeof(MidiEvent));
-        numMidiTx_ = 0;
+    taskEXIT_CRITICAL();
+
+    if (configured && !idle) {
+        // 上一包还没发完, 缓冲不能改写, 事件留在队列中
+        xSemaphoreTake(txCompleteSemHandle_, pdMS_TO_TICKS(kTxTimeoutMs));
+        return;
+    }
+    if (num == 0) {
+        xSemaphoreTake(txReadySemHandle_, portMAX_DELAY);
+        return;
     }
-    xSemaphoreTake(txCompleteSemHandle_, portMAX_DELAY);
+    USBD_MIDI_SendReport(&USBD_Device, reinterpret_cast<uint8_t*>(midiTxPacket_), num * sizeof(MidiEvent));
+    xSemaphoreTake(txCompleteSemHandle_, pdMS_TO_TICKS(kTxTimeoutMs));
 }
 
-void CUSBMidi::SetMidiReciveIRQ(void (*callback)(std::span<const MidiEvent>)) {
+void CUSBMidi::SetMidiReceiveCallback(void (*callback)(std::span<const MidiEvent>)) {
     midiRxCallback_ = callback;
 }
 
+void CUSBMidi::ProcessReceived(uint32_t waitMs) {
+    xSemaphoreTake(rxSemHandle_, waitMs == kWaitForever ? portMAX_DELAY : pdMS_TO_TICKS(waitMs));
+    // 一次取一批, 回调期间中断可以继续写入
+    MidiEvent batch[kRxBatchSize];
+    for (;;) {
+        uint32_t read = rxRead_.load(std::memory_order_relaxed);
+        uint32_t num = std::min(rxWrite_.load(std::memory_order_acquire) - read, kRxBatchSize);
+        if (num == 0) break;
+        for (uint32_t i = 0; i < num; ++i) {
+            batch[i] = midiRxRing_[(read + i) & (kRxRingSize - 1)];
+        }
+        rxRead_.store(read + num, std::memory_order_release);
+        if (midiRxCallback_) {
+            midiRxCallback_(std::span<const MidiEvent>{ batch, num });
+        }
+    }
+}
+
+uint32_t CUSBMidi::GetNumRxDropped() const {
+    return numRxDropped_;
+}
+
 void CUSBMidi::NotifySend(bool irq) {
     if (irq) {
-        xSemaphoreGiveFromISR(txCompleteSemHandle_, nullptr);
+        xSemaphoreGiveFromISR(txReadySemHandle_, nullptr);
     }
     else {
-        xSemaphoreGive(txCompleteSemHandle_);
+        xSemaphoreGive(txReadySemHandle_);
     }
 }
 
 void CUSBMidi::Write(MidiEvent e) {
-    if (numMidiTx_ < kTxBufferSize) {
-        midiTxBuffer_[numMidiTx_++] = e;
+    taskENTER_CRITICAL();
+    const uint32_t index = FindControllerSlot(e);
+    if (index == kNumControllerSlots) {
+        if (e.IsNoteOn() || e.IsNoteOff()) {
+            FlushChannel(e.GetChannel());
+        }
+        if (e.IsNoteOn()) {
+            ForgetSent(e);
+        }
+        PushTxQueue(e);
+    }
+    else {
+        auto& slot = controllers_[index];
+        // 还没发出去的旧值直接被替换
+        slot.event = e;
+        slot.pending = ToRaw(e) != slot.sent;
+    }
+    taskEXIT_CRITICAL();
+}
+
+bool CUSBMidi::WriteSysEx(std::span<const uint8_t> msg) {
+    taskENTER_CRITICAL();
+    const bool fit = kTxBufferSize - (txWrite_ - txRead_) >= utli::sysex::NumPackets(msg.size());
+    if (fit) {
+        utli::sysex::ToPackets(msg, [](const utli::sysex::Packet& p) {
+            MidiEvent e;
+            memcpy(&e, p.data(), sizeof(e));
+            PushTxQueue(e);
+        });
     }
+    taskEXIT_CRITICAL();
+    return fit;
+}
+
+uint32_t CUSBMidi::GetNumTxDropped() const {
+    return numTxDropped_;
 }
 
 void CUSBMidi::WriteNoteOn(uint8_t ch, uint8_t note, uint8_t vel) {
@@ -172,18 +378,27 @@ void CUSBMidi::MPEwritePitchBendScaled(uint8_t note, int8_t val) {
 // IRQ
 // --------------------------------------------------------------------------------
 extern "C" void USBD_MIDI_DataInHandler(uint8_t* usb_rx_buffer, uint8_t usb_rx_buffer_length) {
-    while (usb_rx_buffer_length && *usb_rx_buffer != 0x00) {
-        uint32_t v = (usb_rx_buffer[3] << 24) | (usb_rx_buffer[2] << 16) | (usb_rx_buffer[1] << 8) | usb_rx_buffer[0];
-        memcpy(&midiRxBuffer_[numRx_++], &v, 4);
-
-        usb_rx_buffer += 4;
-        usb_rx_buffer_length -= 4;
-        numRx_ %= kEventBufferSize;
+    // 只把原始包放进ring, 解析在 ProcessReceived 中
+    uint32_t write = rxWrite_.load(std::memory_order_relaxed);
+    const uint32_t read = rxRead_.load(std::memory_order_acquire);
+    const uint32_t begin = write;
+    while (usb_rx_buffer_length >= sizeof(MidiEvent) && *usb_rx_buffer != 0x00) {
+        if (write - read >= kRxRingSize) {
+            ++numRxDropped_;
+        }
+        else {
+            memcpy(&midiRxRing_[write & (kRxRingSize - 1)], usb_rx_buffer, sizeof(MidiEvent));
+            ++write;
+        }
+        usb_rx_buffer += sizeof(MidiEvent);
+        usb_rx_buffer_length -= sizeof(MidiEvent);
     }
-    if (midiRxCallback_) {
-        midiRxCallback_(std::span{midiRxBuffer_, numRx_});
+    if (write != begin) {
+        rxWrite_.store(write, std::memory_order_release);
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(rxSemHandle_, &woken);
+        portYIELD_FROM_ISR(woken);
     }
-    numRx_ = 0;
 }
 
 extern "C" void USBD_MIDI_DataOutHandler() {
@@ -10,6 +10,7 @@ struct MidiEvent {
         kNoteOff = 0x8,
         kPitchBend = 0xe,
         kPressure = 0xd,
+        kPolyPressure = 0xa,
         kCC = 0xb
     };
 
@@ -20,6 +21,8 @@ struct MidiEvent {
     uint8_t data3;
 
     bool IsNoteOn() const { return codeIndexNumber == 9; }
+    // SysEx开始/继续/结束
+    bool IsSysEx() const { return codeIndexNumber >= 0x4 && codeIndexNumber <= 0x7; }
     bool IsNoteOff() const { return codeIndexNumber == 8; }
     uint8_t GetNote() const { return data2; }
     uint8_t GetChannel() const { return data1 & 0xf; }
@@ -33,13 +36,34 @@ struct MidiEvent {
 
 class CUSBMidi {
 public:
+    // 每次回调最多的事件数
+    static constexpr uint32_t kRxBatchSize = 32;
+    static constexpr uint32_t kWaitForever = UINT32_MAX;
+
     void Init();
+    /**
+     * @brief 发送一包数据, 在USB任务中循环调用
+     * 音符事件优先且保持顺序, 剩下的位置填入控制器的最新值, 没有数据时等待 NotifySend
+     * 音符之前写入的同一通道的控制器在音符之前发送
+     * 上一包还没被主机取走时不取新事件, 等端点空闲后再发
+     */
     void SendData();
-    void SetMidiReciveIRQ(void(*callback)(std::span<const MidiEvent>));
+    // 回调在调用 ProcessReceived 的任务中执行
+    void SetMidiReceiveCallback(void(*callback)(std::span<const MidiEvent>));
+    // 等待USB中断收到数据, 然后分批交给回调, 直到ring为空
+    void ProcessReceived(uint32_t waitMs = kWaitForever);
+    // ring满时中断丢弃的事件数
+    uint32_t GetNumRxDropped() const;
     void NotifySend(bool irq);
 
-    // write
+    // write, 在任务中调用
+    // pitchbend/pressure/CC只保留最新值, 和上次发送的相同时不发送
+    // poly aftertouch按通道和音符, CC按通道和控制器号, 位置都在等待发送时直接放进队列
     void Write(MidiEvent e);
+    // 完整的SysEx(F0...F7)按顺序放入音符事件队列, 空间不够时返回false且什么都不写
+    bool WriteSysEx(std::span<const uint8_t> msg);
+    // 音符事件队列满或者主机断开时丢弃的事件数
+    uint32_t GetNumTxDropped() const;
     void WriteNoteOn(uint8_t ch, uint8_t note, uint8_t vel);
     void WriteNoteOff(uint8_t ch, uint8_t note, uint8_t vel);
     void WriteCC(uint8_t ch, uint8_t ccNo, uint8_t ccVal);
@@ -53,10 +53,18 @@ typedef struct _font_index
     uint32_t offset; /* the font bitmap data offset */
 } font_index_t;
 
+#ifdef FONT_RGB_EXTERN
+// 主机上的工具没有字库所在的flash, 由工具提供数据
+extern const font_header_t& font_header_rgb;
+extern const font_section_t (&font_sections_rgb)[64];
+extern const font_index_t* const font_indexs_rgb;
+extern const uint8_t* const font_data_rgb;
+#else
 static const auto& font_header_rgb = *reinterpret_cast<const font_header_t* const>(0x081e7adc);
 static const auto& font_sections_rgb = *reinterpret_cast<const font_section_t(*const)[64]>( 0x081e78dc);
 static const auto& font_indexs_rgb = *reinterpret_cast<const font_index_t(*const)[21486]>(0x081bd96c);
 static const auto& font_data_rgb = *reinterpret_cast<const uint8_t(*const)[514404]>(0x08140008);
+#endif
 
 static constexpr uint32_t kInvalidFontIndexIndex = std::numeric_limits<uint32_t>::max();
 
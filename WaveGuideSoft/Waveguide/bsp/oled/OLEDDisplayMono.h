@@ -32,6 +32,7 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include "Rectange.hpp"
 #include "usf/usf.hpp"
@@ -114,7 +115,17 @@ public:
     uint8_t* getDisplayBuffer(void) { return buffer_; }
     void SetDisplayBuffer(uint8_t* buffer) { buffer_ = buffer; }
 
+    // 和RGB的接口一样, 单色屏不裁剪, 每次都整屏重画、整屏发送
+    void SetClipRect(Rectange) {}
+    void ResetClipRect() {}
+    Rectange GetClipRect() { return GetDrawAera(); }
+    void MarkDirty(Rectange) {}
+    std::span<const Rectange> GetDirtyRects() const { return { &kFullScreen, 1 }; }
+    void ClearDirty() {}
+
 protected:
+    static constexpr Rectange kFullScreen{ 0, 0, kWidth, kHeight };
+
     void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t* data, uint16_t offset, uint16_t bytesInData);
     uint16_t drawStringInternal(int16_t xMove, int16_t yMove, std::string_view text, uint16_t textWidth, uint16_t boundWidth);
 
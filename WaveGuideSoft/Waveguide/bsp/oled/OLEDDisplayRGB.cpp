@@ -30,7 +30,9 @@
  */
 
 #include "OLEDDisplay.h"
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include "FontRGB.hpp"
 
 #if _OLED_TYPE == _OLED_RGB
@@ -52,6 +54,46 @@ static constexpr uint8_t pgm_read_byte(const T *addr)
 using enum OledColorEnum;
 using enum OledDisplayTextAlignEnum;
 
+// 按32位字写, 一次两个像素, 首尾不对齐的单独写
+static void FillSpan(OLEDRGBColor* ptr, int32_t length, OledColorEnum color)
+{
+    if (length <= 0) {
+        return;
+    }
+    // RGB565每个分量取反, 等于整个字取反
+    if (color == kOledINVERSE) {
+        if (reinterpret_cast<uintptr_t>(ptr) & 2) {
+            ptr->color ^= 0xffff;
+            ++ptr;
+            --length;
+        }
+        for (; length >= 2; length -= 2, ptr += 2) {
+            uint32_t word;
+            std::memcpy(&word, ptr, sizeof(word));
+            word = ~word;
+            std::memcpy(ptr, &word, sizeof(word));
+        }
+        if (length != 0) {
+            ptr->color ^= 0xffff;
+        }
+        return;
+    }
+
+    const uint16_t c = color == kOledWHITE ? colors::white.color : colors::black.color;
+    if (reinterpret_cast<uintptr_t>(ptr) & 2) {
+        ptr->color = c;
+        ++ptr;
+        --length;
+    }
+    const uint32_t word = c | static_cast<uint32_t>(c) << 16;
+    for (; length >= 2; length -= 2, ptr += 2) {
+        std::memcpy(ptr, &word, sizeof(word));
+    }
+    if (length != 0) {
+        ptr->color = c;
+    }
+}
+
 OLEDDisplay::OLEDDisplay()
 {
     color = kOledWHITE;
@@ -70,41 +112,62 @@ OledColorEnum OLEDDisplay::getColor()
 
 void OLEDDisplay::Fill(OledColorEnum color)
 {
-    if (color == kOledBLACK) {
-        std::fill_n(buffer_, kBufferSize, colors::black);
+    if (clip_.IsEmpty()) {
+        return;
     }
-    else if (color == kOledWHITE) {
-        std::fill_n(buffer_, kBufferSize, colors::white);
-    }
-    else {
-        for (int i = 0; i < kBufferSize; i++) {
-            buffer_[i].Inverse();
-        }
+    MarkDirty(clip_);
+    // 裁剪区域是整行时连续
+    const int32_t rows = clip_.w == kWidth ? 1 : clip_.h;
+    const int32_t length = clip_.w == kWidth ? clip_.h * kWidth : clip_.w;
+    for (int32_t row = 0; row < rows; ++row) {
+        FillSpan(GetPixelPtrUncheck(clip_.x, clip_.y + row), length, color);
     }
 }
 
-void OLEDDisplay::setPixel(int16_t x, int16_t y)
+void OLEDDisplay::MarkDirty(Rectange area)
 {
-    if (x >= 0 && x < this->getWidth() && y >= 0 && y < this->getHeight())
-    {
-        switch (color)
-        {
-        case kOledWHITE:
-            GetPixelUncheck(x, y) = colors::white;
-            break;
-        case kOledBLACK:
-            GetPixelUncheck(x, y) = colors::black;
-            break;
-        case kOledINVERSE:
-            GetPixelUncheck(x, y).Inverse();
+    area = area.Intersect(clip_);
+    if (area.IsEmpty()) {
+        return;
+    }
+    for (uint32_t i = 0; i < numDirty_; ++i) {
+        if (dirty_[i].Contains(area)) {
+            return;
+        }
+    }
+    // 和相交或者相邻的合并, 合并后可能碰到别的, 一直合并到互不相交
+    // 满了就并到面积增加最少的那个
+    for (;;) {
+        int32_t idx = -1;
+        for (uint32_t i = 0; i < numDirty_; ++i) {
+            const auto& d = dirty_[i];
+            if (Rectange(d.x - 1, d.y - 1, d.w + 2, d.h + 2).Intersects(area)) {
+                idx = static_cast<int32_t>(i);
+                break;
+            }
+        }
+        if (idx < 0 && numDirty_ < kMaxDirtyRects) {
             break;
         }
+        if (idx < 0) {
+            int32_t minGrow = INT32_MAX;
+            for (uint32_t i = 0; i < numDirty_; ++i) {
+                const auto grow = dirty_[i].Union(area).Area() - dirty_[i].Area();
+                if (grow < minGrow) {
+                    minGrow = grow;
+                    idx = static_cast<int32_t>(i);
+                }
+            }
+        }
+        area = area.Union(dirty_[idx]);
+        dirty_[idx] = dirty_[--numDirty_];
     }
+    dirty_[numDirty_++] = area;
 }
 
-void OLEDDisplay::setPixelColor(int16_t x, int16_t y, OledColorEnum color)
+void OLEDDisplay::PlotPixel(int16_t x, int16_t y, OledColorEnum color)
 {
-    if (x >= 0 && x < this->getWidth() && y >= 0 && y < this->getHeight())
+    if (x >= clip_.x && x < clip_.x + clip_.w && y >= clip_.y && y < clip_.y + clip_.h)
     {
         switch (color)
         {
@@ -121,6 +184,17 @@ void OLEDDisplay::setPixelColor(int16_t x, int16_t y, OledColorEnum color)
     }
 }
 
+void OLEDDisplay::setPixel(int16_t x, int16_t y)
+{
+    setPixelColor(x, y, color);
+}
+
+void OLEDDisplay::setPixelColor(int16_t x, int16_t y, OledColorEnum color)
+{
+    MarkDirty(Rectange(x, y, 1, 1));
+    PlotPixel(x, y, color);
+}
+
 void OLEDDisplay::clearPixel(int16_t x, int16_t y)
 {
     // if (x >= 0 && x < this->getWidth() && y >= 0 && y < this->getHeight())
@@ -143,6 +217,7 @@ void OLEDDisplay::clearPixel(int16_t x, int16_t y)
 // Bresenham's algorithm - thx wikipedia and Adafruit_GFX
 void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
 {
+    MarkDirty(Rectange(std::min(x0, x1), std::min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1));
     int16_t steep = abs(y1 - y0) > abs(x1 - x0);
     if (steep)
     {
@@ -176,11 +251,11 @@ void OLEDDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
     {
         if (steep)
         {
-            setPixel(y0, x0);
+            PlotPixel(y0, x0, color);
         }
         else
         {
-            setPixel(x0, y0);
+            PlotPixel(x0, y0, color);
         }
         err -= dy;
         if (err < 0)
@@ -201,14 +276,16 @@ void OLEDDisplay::drawRect(int16_t x, int16_t y, int16_t width, int16_t height)
 
 void OLEDDisplay::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height)
 {
-    for (int16_t x = xMove; x < xMove + width; x++)
+    MarkDirty(Rectange(xMove, yMove, width, height));
+    for (int16_t y = yMove; y < yMove + height; y++)
     {
-        drawVerticalLine(x, yMove, height);
+        drawHorizontalLine(xMove, y, width);
     }
 }
 
 void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius)
 {
+    MarkDirty(Rectange(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1));
     int16_t x = 0, y = radius;
     int16_t dp = 1 - radius;
     do
@@ -218,25 +295,26 @@ void OLEDDisplay::drawCircle(int16_t x0, int16_t y0, int16_t radius)
         else
             dp = dp + (x++) * 2 - (y--) * 2 + 5;
 
-        setPixel(x0 + x, y0 + y); // For the 8 octants
-        setPixel(x0 - x, y0 + y);
-        setPixel(x0 + x, y0 - y);
-        setPixel(x0 - x, y0 - y);
-        setPixel(x0 + y, y0 + x);
-        setPixel(x0 - y, y0 + x);
-        setPixel(x0 + y, y0 - x);
-        setPixel(x0 - y, y0 - x);
+        PlotPixel(x0 + x, y0 + y, color); // For the 8 octants
+        PlotPixel(x0 - x, y0 + y, color);
+        PlotPixel(x0 + x, y0 - y, color);
+        PlotPixel(x0 - x, y0 - y, color);
+        PlotPixel(x0 + y, y0 + x, color);
+        PlotPixel(x0 - y, y0 + x, color);
+        PlotPixel(x0 + y, y0 - x, color);
+        PlotPixel(x0 - y, y0 - x, color);
 
     } while (x < y);
 
-    setPixel(x0 + radius, y0);
-    setPixel(x0, y0 + radius);
-    setPixel(x0 - radius, y0);
-    setPixel(x0, y0 - radius);
+    PlotPixel(x0 + radius, y0, color);
+    PlotPixel(x0, y0 + radius, color);
+    PlotPixel(x0 - radius, y0, color);
+    PlotPixel(x0, y0 - radius, color);
 }
 
 void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_t quads)
 {
+    MarkDirty(Rectange(x0 - radius, y0 - radius, 2 * radius + 1, 2 * radius + 1));
     int16_t x = 0, y = radius;
     int16_t dp = 1 - radius;
     while (x < y)
@@ -247,40 +325,40 @@ void OLEDDisplay::drawCircleQuads(int16_t x0, int16_t y0, int16_t radius, uint8_
             dp = dp + (x++) * 2 - (y--) * 2 + 5;
         if (quads & 0x1)
         {
-            setPixel(x0 + x, y0 - y);
-            setPixel(x0 + y, y0 - x);
+            PlotPixel(x0 + x, y0 - y, color);
+            PlotPixel(x0 + y, y0 - x, color);
         }
         if (quads & 0x2)
         {
-            setPixel(x0 - y, y0 - x);
-            setPixel(x0 - x, y0 - y);
+            PlotPixel(x0 - y, y0 - x, color);
+            PlotPixel(x0 - x, y0 - y, color);
         }
         if (quads & 0x4)
         {
-            setPixel(x0 - y, y0 + x);
-            setPixel(x0 - x, y0 + y);
+            PlotPixel(x0 - y, y0 + x, color);
+            PlotPixel(x0 - x, y0 + y, color);
         }
         if (quads & 0x8)
         {
-            setPixel(x0 + x, y0 + y);
-            setPixel(x0 + y, y0 + x);
+            PlotPixel(x0 + x, y0 + y, color);
+            PlotPixel(x0 + y, y0 + x, color);
         }
     }
     if (quads & 0x1 && quads & 0x8)
     {
-        setPixel(x0 + radius, y0);
+        PlotPixel(x0 + radius, y0, color);
     }
     if (quads & 0x4 && quads & 0x8)
     {
-        setPixel(x0, y0 + radius);
+        PlotPixel(x0, y0 + radius, color);
     }
     if (quads & 0x2 && quads & 0x4)
     {
-        setPixel(x0 - radius, y0);
+        PlotPixel(x0 - radius, y0, color);
     }
     if (quads & 0x1 && quads & 0x2)
     {
-        setPixel(x0, y0 - radius);
+        PlotPixel(x0, y0 - radius, color);
     }
 }
 
@@ -409,20 +487,20 @@ void OLEDDisplay::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 
 void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
 {
-    if (y < 0 || y >= this->getHeight())
+    if (y < clip_.y || y >= clip_.y + clip_.h)
     {
         return;
     }
 
-    if (x < 0)
+    if (x < clip_.x)
     {
-        length += x;
-        x = 0;
+        length -= clip_.x - x;
+        x = clip_.x;
     }
 
-    if ((x + length) > this->getWidth())
+    if ((x + length) > clip_.x + clip_.w)
     {
-        length = (this->getWidth() - x);
+        length = (clip_.x + clip_.w - x);
     }
 
     if (length <= 0)
@@ -430,52 +508,31 @@ void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length)
         return;
     }
 
-    auto* ptr = GetPixelPtrUncheck(x, y);
-    switch (color)
-    {
-    case kOledWHITE:
-        while (length--)
-        {
-            *ptr = colors::white;
-            ++ptr;
-        };
-        break;
-    case kOledBLACK:
-        while (length--)
-        {
-            *ptr = colors::black;
-            ++ptr;
-        };
-        break;
-    case kOledINVERSE:
-        while (length--)
-        {
-            ptr->Inverse();
-            ++ptr;
-        };
-        break;
-    }
+    MarkDirty(Rectange(x, y, length, 1));
+    FillSpan(GetPixelPtrUncheck(x, y), length, color);
 }
 
 void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length)
 {
-    if (x < 0 || x >= this->getWidth())
+    if (x < clip_.x || x >= clip_.x + clip_.w)
         return;
 
-    if (y < 0)
+    if (y < clip_.y)
     {
-        length += y;
-        y = 0;
+        length -= clip_.y - y;
+        y = clip_.y;
     }
 
-    if ((y + length) > this->getHeight())
+    if ((y + length) > clip_.y + clip_.h)
     {
-        length = (this->getHeight() - y);
+        length = (clip_.y + clip_.h - y);
     }
 
     if (length <= 0)
         return;
 
+    MarkDirty(Rectange(x, y, 1, length));
+
     switch(color) {
     case kOledBLACK:
         for (int16_t i = 0; i < length; ++i) {
@@ -525,6 +582,7 @@ void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t h
 {
     int16_t widthInXbm = (width + 7) / 8;
     uint8_t data = 0;
+    MarkDirty(Rectange(xMove, yMove, width, height));
 
     for (int16_t y = 0; y < height; y++)
     {
@@ -541,7 +599,7 @@ void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t h
             // if there is a bit draw it
             if (data & 0x01)
             {
-                setPixel(xMove + x, yMove + y);
+                PlotPixel(xMove + x, yMove + y, color);
             }
         }
     }
@@ -550,6 +608,7 @@ void OLEDDisplay::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t h
 void OLEDDisplay::drawIco16x16(int16_t xMove, int16_t yMove, const uint8_t *ico, bool inverse)
 {
     uint16_t data;
+    MarkDirty(Rectange(xMove, yMove, 16, 16));
 
     for (int16_t y = 0; y < 16; y++)
     {
@@ -558,11 +617,11 @@ void OLEDDisplay::drawIco16x16(int16_t xMove, int16_t yMove, const uint8_t *ico,
         {
             if ((data & 0x01) ^ inverse)
             {
-                setPixelColor(xMove + x, yMove + y, kOledWHITE);
+                PlotPixel(xMove + x, yMove + y, kOledWHITE);
             }
             else
             {
-                setPixelColor(xMove + x, yMove + y, kOledBLACK);
+                PlotPixel(xMove + x, yMove + y, kOledBLACK);
             }
             data >>= 1; // Move a bit
         }
@@ -641,6 +700,14 @@ uint16_t OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, std::stri
     {
         return 0;
     }
+
+    // 和 drawInternal 一样第一行画在 yMove + 1
+    if (const auto* entry = GetCachedText(text))
+    {
+        MarkDirty(Rectange(xMove, yMove + 1, entry->width, entry->rows));
+        BlitBits(xMove, yMove + 1, entry->bits[0], TextCache::kWordsPerRow, entry->width, entry->rows);
+        return entry->numChars;
+    }
     
     UTF8ToUnicode convert{text};
     for (auto code = convert.Next(); code != UTF8ToUnicode::npos; code = convert.Next())
@@ -722,6 +789,13 @@ uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t
     uint16_t firstLineChars = 0;
     uint16_t drawStringResult = 1; // later tested for 0 == error, so initialize to 1
 
+    // 一行放得下时不用逐个字符找断点
+    if (const auto* entry = GetCachedText(strUser); entry != nullptr && entry->width < maxLineWidth)
+    {
+        drawStringInternal(xMove, yMove, strUser, entry->width, maxLineWidth);
+        return 0;
+    }
+
     UTF8ToUnicode utf8ToUnicode(strUser);
     int i = 0;
     for (auto code = utf8ToUnicode.Next(); code != utf8ToUnicode.npos; code = utf8ToUnicode.Next())
@@ -781,6 +855,14 @@ uint16_t OLEDDisplay::getStringWidth(std::string_view text)
     uint16_t stringWidth = 0;
     uint16_t maxWidth = 0;
 
+    if (text.find('\n') == std::string_view::npos)
+    {
+        if (const auto* entry = GetCachedText(text))
+        {
+            return entry->width;
+        }
+    }
+
     UTF8ToUnicode utf8ToUnicode(text);
     for (auto code = utf8ToUnicode.Next();
         code != utf8ToUnicode.npos;
@@ -821,21 +903,135 @@ void OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int1
     return;
     
     uint8_t rasterWidth = 1 + ((width - 1) >> 3); // fast ceil(height / 8.0)
-    int16_t x = xMove;
-    for (uint16_t i = 0; i < bytesInData; ++i) {
-        if (i % rasterWidth == 0) {
-            x = xMove;
-            ++yMove;
-        }
-        uint8_t byte = data[offset + i];
-        for (uint8_t j = 0; j < 8; ++j) {
-            if (byte & 0x80) {
-                setPixel(x, yMove);
+    // 第一行画在 yMove + 1, 字形宽度之外的填充位不画
+    MarkDirty(Rectange(xMove, yMove + 1, width, height));
+    const uint16_t rows = bytesInData / rasterWidth;
+    // 每行的4字节拼成一个字, 最多32行一起贴
+    uint32_t words[32];
+    for (uint16_t firstRow = 0; firstRow < rows; firstRow += 32) {
+        const uint16_t numRows = std::min<uint16_t>(32, rows - firstRow);
+        for (uint8_t b = 0; b < rasterWidth; b += 4) {
+            const uint8_t* src = data + offset + firstRow * rasterWidth + b;
+            for (uint16_t row = 0; row < numRows; ++row, src += rasterWidth) {
+                uint32_t word = 0;
+                for (uint8_t k = 0; k < 4 && b + k < rasterWidth; ++k) {
+                    word |= static_cast<uint32_t>(src[k]) << (24 - 8 * k);
+                }
+                words[row] = word;
+            }
+            BlitBits(xMove + b * 8, yMove + 1 + firstRow, words, 1, std::min<int16_t>(32, width - b * 8), numRows);
+        }
+    }
+}
+
+void OLEDDisplay::BlitBits(int16_t x, int16_t y, const uint32_t* bits, uint32_t stride, int16_t width, int16_t rows)
+{
+    const int16_t left = std::max<int16_t>(x, clip_.x);
+    const int16_t right = std::min<int16_t>(x + width, clip_.x + clip_.w);
+    const int16_t top = std::max<int16_t>(y, clip_.y);
+    const int16_t bottom = std::min<int16_t>(y + rows, clip_.y + clip_.h);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    const int16_t firstWord = (left - x) >> 5;
+    const int16_t endWord = (right - x + 31) >> 5;
+    const uint16_t c = color == kOledWHITE ? colors::white.color : colors::black.color;
+    for (int16_t py = top; py < bottom; ++py) {
+        const uint32_t* rowBits = bits + (py - y) * stride;
+        auto* line = GetPixelPtrUncheck(0, py);
+        for (int16_t w = firstWord; w < endWord; ++w) {
+            uint32_t word = rowBits[w];
+            // 去掉裁剪区域外的列
+            const int16_t wordX = x + w * 32;
+            if (wordX < left) {
+                word &= 0xffffffffu >> (left - wordX);
+            }
+            if (wordX + 32 > right) {
+                word &= ~(0xffffffffu >> (right - wordX));
+            }
+            // 按连续置位的一段一段画
+            while (word != 0) {
+                const int n = std::countl_zero(word);
+                const int run = std::countl_one(word << n);
+                word = n + run < 32 ? word & (0xffffffffu >> (n + run)) : 0;
+                auto* ptr = line + wordX + n;
+                if (color == kOledINVERSE) {
+                    for (int i = 0; i < run; ++i) {
+                        ptr[i].color ^= 0xffff;
+                    }
+                }
+                else {
+                    for (int i = 0; i < run; ++i) {
+                        ptr[i].color = c;
+                    }
+                }
+            }
+        }
+    }
+}
+
+const TextCache::Entry* OLEDDisplay::GetCachedText(std::string_view text)
+{
+    if (textCache_ == nullptr) {
+        return nullptr;
+    }
+    if (const auto* entry = textCache_->Find(text)) {
+        return entry;
+    }
+    const uint16_t height = font_header_rgb.height;
+    if (text.size() > TextCache::kMaxTextBytes || height > TextCache::kMaxRows) {
+        return nullptr;
+    }
+
+    // 先解码算出宽度, 放得下才放入缓存
+    uint32_t fontIndexs[TextCache::kMaxTextBytes];
+    uint32_t numChars = 0;
+    int32_t width = 0;
+    UTF8ToUnicode convert{text};
+    for (auto code = convert.Next(); code != UTF8ToUnicode::npos; code = convert.Next()) {
+        uint32_t fontIndex = GetFontIndexIndexSimpler(code);
+        if (fontIndex != kInvalidFontIndexIndex && font_indexs_rgb[fontIndex].width != 0) {
+            fontIndexs[numChars++] = fontIndex;
+            width += font_indexs_rgb[fontIndex].width;
+        }
+    }
+    if (width > TextCache::kMaxWidth) {
+        return nullptr;
+    }
+
+    auto* entry = textCache_->Insert(text);
+    entry->width = static_cast<uint16_t>(width);
+    entry->numChars = static_cast<uint8_t>(numChars);
+    entry->rows = static_cast<uint8_t>(height);
+    int32_t cursorX = 0;
+    for (uint32_t i = 0; i < numChars; ++i) {
+        const auto& glyph = font_indexs_rgb[fontIndexs[i]];
+        const uint32_t rasterWidth = (glyph.width + 7) >> 3;
+        const uint32_t rows = std::min<uint32_t>(glyph.size / rasterWidth, height);
+        const uint8_t* src = &font_data_rgb[glyph.offset];
+        for (uint32_t row = 0; row < rows; ++row, src += rasterWidth) {
+            auto* words = entry->bits[row];
+            for (uint32_t k = 0; k < rasterWidth; ++k) {
+                uint32_t byte = src[k];
+                const int32_t remain = glyph.width - static_cast<int32_t>(k * 8);
+                if (remain < 8) {
+                    byte &= (0xff00u >> remain) & 0xff;
+                }
+                const int32_t px = cursorX + k * 8;
+                const int32_t shift = px & 31;
+                words[px >> 5] |= byte << 24 >> shift;
+                if (shift > 24) {
+                    // 跨到下一个字的部分
+                    if (const uint32_t spill = byte << (56 - shift); spill != 0) {
+                        words[(px >> 5) + 1] |= spill;
+                    }
+                }
             }
-            byte <<= 1;
-            ++x;
         }
+        cursorX += glyph.width;
     }
+    return entry;
 }
 
 // #include "FontRGB.cpp.fnt"
@@ -32,8 +32,10 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
 #include <string_view>
 #include "Rectange.hpp"
+#include "TextCache.hpp"
 #include "usf/usf.hpp"
 
 enum class OledColorEnum
@@ -153,6 +155,19 @@ public:
     // get display buffer
     OLEDRGBColor* getDisplayBuffer(void) { return buffer_; }
     void SetDisplayBuffer(OLEDRGBColor* buffer) { buffer_ = buffer; }
+    // 没有设置时每次都逐个字形画
+    void SetTextCache(TextCache* cache) { textCache_ = cache; }
+
+    // ---------------------------------------- Clip & dirty ----------------------------------------
+    // 所有绘制只改裁剪区域里的像素, Fill 只填充裁剪区域
+    void SetClipRect(Rectange clip) { clip_ = clip.Intersect(GetDrawAera()); }
+    void ResetClipRect() { clip_ = GetDrawAera(); }
+    Rectange GetClipRect() const { return clip_; }
+    // 绘制函数会自己标记, 直接改buffer时手动标记
+    void MarkDirty(Rectange area);
+    // 上次 ClearDirty 之后改过的区域, 互不相交, 最多 kMaxDirtyRects 个
+    std::span<const Rectange> GetDirtyRects() const { return { dirty_, numDirty_ }; }
+    void ClearDirty() { numDirty_ = 0; }
 
 protected:
     OLEDRGBColor& GetPixelUncheck(int16_t x, int16_t y) {
@@ -165,6 +180,12 @@ protected:
         assert(y >= 0 && y < kHeight);
         return &buffer_[x + y * kWidth]; 
     }
+    // 只检查裁剪, 不标记, 由调用者先标记外框
+    void PlotPixel(int16_t x, int16_t y, OledColorEnum color);
+    // 1位位图, 每行 stride 个32位字, 最高位在左, 置位的像素按当前颜色画
+    void BlitBits(int16_t x, int16_t y, const uint32_t* bits, uint32_t stride, int16_t width, int16_t rows);
+    // 查缓存, 没有时解码、光栅化后放入, 放不下时返回 nullptr
+    const TextCache::Entry* GetCachedText(std::string_view text);
     void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t* data, uint32_t offset, uint16_t bytesInData);
     uint16_t drawStringInternal(int16_t xMove, int16_t yMove, std::string_view text, uint16_t textWidth, uint16_t boundWidth);
 
@@ -172,4 +193,10 @@ protected:
     OledColorEnum color;
 
     OLEDRGBColor* buffer_{};
+    TextCache* textCache_{};
+
+    static constexpr uint32_t kMaxDirtyRects = 4;
+    Rectange clip_{ 0, 0, kWidth, kHeight };
+    Rectange dirty_[kMaxDirtyRects]{};
+    uint32_t numDirty_{};
 };
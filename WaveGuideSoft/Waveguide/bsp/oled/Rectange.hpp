@@ -128,6 +128,44 @@ struct Rectange {
         return Rectange(x + dx, y + dy, w, h); 
     }
 
+    constexpr bool IsEmpty() const {
+        return w <= 0 || h <= 0;
+    }
+
+    constexpr bool Intersects(const Rectange& o) const {
+        return x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+    }
+
+    constexpr bool Contains(const Rectange& o) const {
+        return o.x >= x && o.y >= y && o.x + o.w <= x + w && o.y + o.h <= y + h;
+    }
+
+    // 相交的部分, 不相交时 IsEmpty
+    [[nodiscard]]
+    constexpr Rectange Intersect(const Rectange& o) const {
+        int16_t l = x > o.x ? x : o.x;
+        int16_t t = y > o.y ? y : o.y;
+        int16_t r = x + w < o.x + o.w ? x + w : o.x + o.w;
+        int16_t b = y + h < o.y + o.h ? y + h : o.y + o.h;
+        return Rectange(l, t, r - l, b - t);
+    }
+
+    // 包含两者的最小矩形, 空的一方不算
+    [[nodiscard]]
+    constexpr Rectange Union(const Rectange& o) const {
+        if (o.IsEmpty()) return *this;
+        if (IsEmpty()) return o;
+        int16_t l = x < o.x ? x : o.x;
+        int16_t t = y < o.y ? y : o.y;
+        int16_t r = x + w > o.x + o.w ? x + w : o.x + o.w;
+        int16_t b = y + h > o.y + o.h ? y + h : o.y + o.h;
+        return Rectange(l, t, r - l, b - t);
+    }
+
+    constexpr int32_t Area() const {
+        return static_cast<int32_t>(w) * h;
+    }
+
     constexpr I16Point GetCenter() const {
         I16Point p{};
         p.x = x + w / 2;
@@ -0,0 +1,58 @@
+#include "TextCache.hpp"
+#include <cstring>
+
+// FNV-1a
+uint32_t TextCache::Hash(std::string_view text) {
+    uint32_t hash = 2166136261u;
+    for (char c : text) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+const TextCache::Entry* TextCache::Find(std::string_view text) {
+    if (text.size() > kMaxTextBytes) {
+        return nullptr;
+    }
+    const uint32_t hash = Hash(text);
+    for (auto& e : entries_) {
+        // lastUse 为0的条目还没用过
+        if (e.hash == hash && e.lastUse != 0 && e.length == text.size()
+            && std::memcmp(e.text, text.data(), text.size()) == 0) {
+            e.lastUse = ++useCount_;
+            ++hits_;
+            return &e;
+        }
+    }
+    ++misses_;
+    return nullptr;
+}
+
+TextCache::Entry* TextCache::Insert(std::string_view text) {
+    if (text.size() > kMaxTextBytes) {
+        return nullptr;
+    }
+    Entry* oldest = &entries_[0];
+    for (auto& e : entries_) {
+        if (e.lastUse < oldest->lastUse) {
+            oldest = &e;
+        }
+    }
+    auto& e = *oldest;
+    e.hash = Hash(text);
+    e.lastUse = ++useCount_;
+    e.width = 0;
+    e.length = static_cast<uint8_t>(text.size());
+    e.numChars = 0;
+    e.rows = 0;
+    std::memcpy(e.text, text.data(), text.size());
+    std::memset(e.bits, 0, sizeof(e.bits));
+    return &e;
+}
+
+void TextCache::Clear() {
+    for (auto& e : entries_) {
+        e.lastUse = 0;
+    }
+    useCount_ = 0;
+}
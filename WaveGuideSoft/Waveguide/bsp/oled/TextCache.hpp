@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief 画过的字符串按内容缓存解码和光栅化的结果
+ * 命中时跳过UTF-8解码、字库查找和逐个字形读取, 直接按32位字贴位图
+ * 位图每行 kWordsPerRow 个32位字, 最高位是最左边的像素
+ * 满了替换最久没用的, 由 OLEDDisplay 填写位图
+ */
+class TextCache {
+public:
+    static constexpr uint32_t kNumEntries = 32;
+    static constexpr uint32_t kMaxTextBytes = 40;
+    static constexpr uint32_t kWordsPerRow = 5;
+    static constexpr int16_t kMaxWidth = kWordsPerRow * 32;
+    static constexpr int16_t kMaxRows = 16;
+
+    struct Entry {
+        uint32_t hash;
+        uint32_t lastUse;
+        uint16_t width;
+        uint8_t length;
+        uint8_t numChars;
+        uint8_t rows;
+        char text[kMaxTextBytes];
+        uint32_t bits[kMaxRows][kWordsPerRow];
+    };
+
+    // 命中时更新使用时间
+    const Entry* Find(std::string_view text);
+    // 替换最久没用的条目, 位图清零, 文本太长时返回 nullptr
+    Entry* Insert(std::string_view text);
+    void Clear();
+
+    uint32_t GetHits() const { return hits_; }
+    uint32_t GetMisses() const { return misses_; }
+private:
+    static uint32_t Hash(std::string_view text);
+
+    Entry entries_[kNumEntries]{};
+    uint32_t useCount_{};
+    uint32_t hits_{};
+    uint32_t misses_{};
+};
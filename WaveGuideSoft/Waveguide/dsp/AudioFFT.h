@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <memory>
 #include <array>
+#include "utli/ConstMath.hpp"
 
 namespace audiofft {
 
@@ -46,17 +47,68 @@ extern void fft(float* data, float* re, float* im, size_t size, int* ip, float*
 extern void ifft(float* data, const float* re, const float* im, size_t size, int* ip, float* w);
 extern void makewt(int n, int* ip, float* w);
 extern void makect(int n, int* ip, float* w);
+
+// 与 makewt + makect 结果相同, 在编译期生成
+// makewt 里的 bitrv2 是 nw/2 个复数的位反转置换, ip[2..] 只是 bitrv2 的临时空间
+static constexpr void MakeTwiddles(int nw, int nc, int* ip, float* w, float* c) {
+  ip[0] = nw;
+  ip[1] = nc;
+  if (nw > 2) {
+    const int nwh = nw >> 1;
+    const float delta = static_cast<float>(std::numbers::pi / 4.0) / nwh;
+    w[0] = 1;
+    w[1] = 0;
+    w[nwh] = static_cast<float>(utli::ConstCos(delta * nwh));
+    w[nwh + 1] = w[nwh];
+    if (nwh > 2) {
+      for (int j = 2; j < nwh; j += 2) {
+        const float x = static_cast<float>(utli::ConstCos(delta * j));
+        const float y = static_cast<float>(utli::ConstSin(delta * j));
+        w[j] = x;
+        w[j + 1] = y;
+        w[nw - j] = y;
+        w[nw - j + 1] = x;
+      }
+      int bits = 0;
+      while ((1 << bits) < nwh) ++bits;
+      for (int j = 0; j < nwh; ++j) {
+        int k = 0;
+        for (int b = 0; b < bits; ++b) {
+          k |= ((j >> b) & 1) << (bits - 1 - b);
+        }
+        if (j < k) {
+          float xr = w[2 * j];
+          float xi = w[2 * j + 1];
+          w[2 * j] = w[2 * k];
+          w[2 * j + 1] = w[2 * k + 1];
+          w[2 * k] = xr;
+          w[2 * k + 1] = xi;
+        }
+      }
+    }
+  }
+  if (nc > 1) {
+    const int nch = nc >> 1;
+    const float delta = static_cast<float>(std::numbers::pi / 4.0) / nch;
+    c[0] = static_cast<float>(utli::ConstCos(delta * nch));
+    c[nch] = 0.5f * c[0];
+    for (int j = 1; j < nch; j++) {
+      c[j] = static_cast<float>(0.5 * utli::ConstCos(delta * j));
+      c[nc - j] = static_cast<float>(0.5 * utli::ConstSin(delta * j));
+    }
+  }
+}
 }
 
+// 构造函数是constexpr的, 用constinit声明时twiddle在编译期生成
 template<size_t SIZE>
 struct AudioFFT {
-  std::array<int, 2 + detail::IntSqrt(SIZE)> _ip;
-  std::array<float, SIZE / 2> _w;
+  std::array<int, 2 + detail::IntSqrt(SIZE)> _ip{};
+  std::array<float, SIZE / 2> _w{};
 
-  AudioFFT() {
+  constexpr AudioFFT() {
     const int size4 = static_cast<int>(SIZE) / 4;
-    detail::makewt(size4, _ip.data(), _w.data());
-    detail::makect(size4, _ip.data(), _w.data() + size4);
+    detail::MakeTwiddles(size4, size4, _ip.data(), _w.data(), _w.data() + size4);
   }
 
   void fft(float* buffer, float* re, float* im) {
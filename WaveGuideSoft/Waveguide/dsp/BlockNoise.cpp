@@ -0,0 +1,92 @@
+#include "BlockNoise.hpp"
+
+namespace dsp {
+
+static constexpr uint32_t Hash(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+static constexpr uint32_t Xorshift(uint32_t x) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static_assert(Xorshift(1) != 1);
+
+void BlockNoise::SetSeed(uint32_t seed, uint32_t stream) {
+    for (uint32_t l = 0; l < kNumLanes; ++l) {
+        auto s = Hash(seed ^ Hash(stream * kNumLanes + l + 1));
+        // xorshift的状态不能为0
+        state_[l] = s != 0 ? s : 0x9e3779b9u;
+    }
+    cachePos_ = kNumLanes;
+    last01_ = 0.0f;
+}
+
+void BlockNoise::StepLanes() {
+    for (uint32_t l = 0; l < kNumLanes; ++l) {
+        state_[l] = Xorshift(state_[l]);
+    }
+}
+
+template<class Convert>
+void BlockNoise::Generate(std::span<float> out, Convert convert) {
+    const uint32_t size = out.size();
+    uint32_t i = 0;
+    for (; i < size && cachePos_ < kNumLanes; ++i) {
+        out[i] = convert(cache_[cachePos_++]);
+    }
+    for (; i + kNumLanes <= size; i += kNumLanes) {
+        for (uint32_t l = 0; l < kNumLanes; ++l) {
+            state_[l] = Xorshift(state_[l]);
+            out[i + l] = convert(state_[l]);
+        }
+    }
+    if (i < size) {
+        StepLanes();
+        for (uint32_t l = 0; l < kNumLanes; ++l) {
+            cache_[l] = state_[l];
+        }
+        cachePos_ = 0;
+        for (; i < size; ++i) {
+            out[i] = convert(cache_[cachePos_++]);
+        }
+    }
+}
+
+void BlockNoise::Fill01(std::span<float> out) {
+    Generate(out, ToFloat01);
+}
+
+void BlockNoise::Fill(std::span<float> out) {
+    Generate(out, ToFloat);
+}
+
+void BlockNoise::FillLowpassed01(std::span<float> out) {
+    Generate(out, ToFloat01);
+    for (auto& s : out) {
+        float curr = s;
+        s = (last01_ + curr) * 0.5f;
+        last01_ = curr;
+    }
+}
+
+uint32_t BlockNoise::NextUInt() {
+    if (cachePos_ == kNumLanes) {
+        StepLanes();
+        for (uint32_t l = 0; l < kNumLanes; ++l) {
+            cache_[l] = state_[l];
+        }
+        cachePos_ = 0;
+    }
+    return cache_[cachePos_++];
+}
+
+} // namespace dsp
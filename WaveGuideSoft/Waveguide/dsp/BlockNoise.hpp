@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <bit>
+
+namespace dsp {
+
+/**
+ * @brief 按块生成的噪声, 4路xorshift32交错输出
+ * 每一路互不依赖, 循环可以展开/向量化, 转float用位操作, 没有除法
+ * 输出只取决于(seed, stream)和已经取出的数量, 与每次取多少无关
+ */
+class BlockNoise {
+public:
+    static constexpr uint32_t kNumLanes = 4;
+    // voice内部按这个大小分块取噪声
+    static constexpr uint32_t kTileSize = 64;
+
+    /**
+     * @param stream 同一个seed下不同stream的序列互不相关, 每个voice用自己的stream
+     */
+    void SetSeed(uint32_t seed, uint32_t stream = 0);
+    // [0, 1)
+    void Fill01(std::span<float> out);
+    // [-1, 1)
+    void Fill(std::span<float> out);
+    // 相邻两个 [0, 1) 的平均
+    void FillLowpassed01(std::span<float> out);
+    uint32_t NextUInt();
+
+    static float ToFloat01(uint32_t x) {
+        return std::bit_cast<float>((x >> 9) | 0x3f800000u) - 1.0f;
+    }
+    static float ToFloat(uint32_t x) {
+        return std::bit_cast<float>((x >> 9) | 0x40000000u) - 3.0f;
+    }
+private:
+    template<class Convert>
+    void Generate(std::span<float> out, Convert convert);
+    void StepLanes();
+
+    uint32_t state_[kNumLanes]{ 1, 2, 3, 4 };
+    // 不足一组时剩下的输出
+    uint32_t cache_[kNumLanes]{};
+    uint32_t cachePos_{ kNumLanes };
+    float last01_{};
+};
+
+} // namespace dsp
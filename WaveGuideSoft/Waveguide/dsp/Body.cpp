@@ -2,19 +2,14 @@
 #include "AudioFFT.h"
 #include <numbers>
 #include <cmath>
+#include <algorithm>
+#include <atomic>
 #include "utli/Lerp.hpp"
 #include "MemAttributes.hpp"
-
-constexpr float kBanjo[4096] = {0.8408116, -0.2511731, -0.38303635, -0.0059898444, -0.27061847, 0.0007890034, -0.0073292973, 0.011994778, -0.012411621, 0.04655279, 0.056455344, 0.014067898, 0.07330127, -0.05343846, 0.028716885, -0.010607676, 0.0015999887, 0.043362975, -0.032687552, 0.0154145565, 0.062117293, 0.025567032, -0.08403967, 0.0062902574, 0.010043268, -0.051865425, 0.033150233, 0.020506015, -0.0044696927, 0.04990088, 0.03276305, -0.04390349, -0.02187753, -0.046611894, -0.07722027, -0.027850313, 0.01636171, 0.0030558843, -0.032876786, -0.036291096, -0.09235733, -0.087776974, -0.03540004, -0.04335503, -0.0653021, -0.044091616, -0.107368715, -0.19948685, -0.12446984, -0.12928312, -0.17091624, -0.15268704, -0.16255362, -0.12987855, -0.069635436, -0.060110703, -0.1134893, -0.11407602, -0.12384962, -0.09637414, -0.044933986, -0.07018676, -0.036956374, -0.034364752, -0.018860595, 0.025873553, 0.02347859, 0.0366431, 0.016929181, 0.038740564, 0.094063744, 0.10979407, 0.07708771, 0.040532988, 0.055806838, 0.06596992, 0.08629575, 0.13908072, 0.21054052, 0.19513358, 0.1566528, 0.15990843, 0.11960288, 0.16314034, 0.22333363, 0.2422042, 0.2616581, 0.27669352, 0.31851187, 0.29176015, 0.22406402, 0.15822846, 0.1264795, 0.12470437, 0.11616462, 0.10107283, 0.073159724, 0.1277734, 0.175093, 0.14201444, 0.07894555, 0.023511363, 0.012008642, -0.015200933, -0.030257491, -0.047351334, -0.07098553, -0.05507381, -0.0735658, -0.12708904, -0.17628899, -0.20585562, -0.21016774, -0.21126585, -0.2105742, -0.22625747, -0.18999875, -0.11830626, -0.1258676, -0.1458189, -0.17034656, -0.17611822, -0.15053962, -0.13077869, -0.13144489, -0.15930235, -0.10914857, -0.114420466, -0.12884817, -0.09926658, -0.0963957, -0.005664877, -0.008173882, 0.0019502429, 0.026768416, -0.019765371, 0.027959606, 0.007626595, 0.0060961954, 0.014337209, -0.019823775, -0.021076106, -0.03212903, 0.045061827, 0.073654935, 0.02491912, 0.00020531307, -0.002264399, 0.0168273, 0.009955969, 0.043339364, 0.04698802, 0.028462823, 0.08445949, 0.058017705, 0.002824491, 0.026970608, 0.03535494, 0.03481115, -0.001139292, -0.007883283, 0.033493076, 0.019058269, 0.037670255, 0.02008275, -0.012843606, 0.037186015, 0.036967475, 0.012894226, 0.019847536, 0.010949964, 0.0017536329, 0.030269274, 0.036742993, 0.043692853, 0.06068712, 0.033927917, 0.007635279, -0.04135286, -0.046447884, -0.035005, -0.030797957, 0.009024447, 0.002984227, 0.0133303935, 0.012689058, -3.669353e-05, 0.0068662064, -0.002004641, 0.007835028, 0.0061351047, -0.011504319, -0.02379415, 0.006058142, 0.029381787, 0.014861365, 0.004763849, 0.0061885314, 0.015784474, 0.017198369, 0.04027159, 0.02491032, -0.00069304474, 0.029298479, 0.06739109, 0.073223986, 0.030904735, 0.024282936, 0.03914292, 0.022976395, -0.00124739, 0.00275025, 0.02725986, 0.052166488, 0.061210625, 0.027757337, 0.02439245, 0.0126201715, -0.0027699138, 0.0124090025, -0.006166647, 0.0032536832, 0.027450576, 0.01556212, 0.0063826996, -0.0020264022, -0.024187975, -0.023977995, -0.034537185, -0.07724854, -0.09062561, -0.06499935, -0.033274107, -0.025078757, -0.016431214, -0.029717159, -0.05080036, -0.0443641, -0.03604591, -0.0376727, -0.04335676, -0.044718485, -0.08210476, -0.09304041, -0.079503, -0.067331485, -0.04529452, -0.03714936, -0.012721364, -0.013519959, -0.0028453688, -0.010807359, -0.022045579, -0.012958999, -0.024392167, 0.007529297, -0.008857277, -8.573515e-06, 0.0341642, 0.023067597, 0.03299037, 0.0067917197, 0.012713175, 0.019726608, -0.0042791576, 0.019575182, 0.05764471, 0.06675369, 0.05282841, 0.04709234, 0.026527906, 0.020907238, 0.035101693, 0.026199833, 0.016293297, 0.008863902, -0.0007314577, 0.0022181752, 0.0029832684, 0.0120061925, 0.02491417, -0.0041744458, -0.004942204, 0.021580262, 0.004725995, 0.00010106421, 0.03541026, 0.016730487, -0.024130747, -0.004363362, -0.023202706, -0.03193354, -0.026173448, -0.04629586, -0.030940289, -0.022949737, 0.0022954838, -0.008160524, -0.026118636, -0.0005998239, 0.014152771, 0.040404044, 0.019134378, -0.008681214, -0.018856863, -0.034185633, -0.025913462, -0.013416783, 0.014051898, 0.017973868, -0.006117934, -0.022011722, -0.011980906, 0.014899536, 0.029447718, 0.044202156, 0.045359246, 0.037823025, 0.033228636, 0.018785471, 0.021137193, 0.027984688, 0.015145102, 0.0025275822, -0.024709683, -0.0061605726, 0.03798056, 0.018207151, 0.045075085, 0.059952833, 0.003218163, 0.0024261267, 0.009654735, -0.0017121843, 0.0028117169, 0.015120053, 0.029161928, 0.019060843, 0.012779598, 0.010268114, -0.020930186, -0.019276062, -0.0040785503, -0.02627848, -0.0008064135, 0.032621246, 0.009566155, 0.004558968, 0.007919593, -0.015401645, -0.03087633, -0.048118886, -0.045883343, -0.0032655853, -0.00881084, -0.03477825, -0.037443236, -0.03955247, -0.039992034, -0.045499917, -0.015479692, -0.0061294376, -0.029553218, -0.04213723, -0.051563744, -0.045009904, -0.04492275, -0.03308532, -0.034270566, -0.016899405, 0.02006319, -0.0011738833, -0.0076323035, -0.0068600494, -0.021686489, -0.0140535245, -0.006491466, -0.020486766, -0.0307889, -0.0027730428, 0.013710495, 0.015950842, 0.025041154, -0.0005791326, -0.012676373, 0.0067041744, 0.0047259894, 0.015556725, 0.034925345, 0.030821508, 0.031041153, 0.040341046, 0.030690849, 0.021300672, 0.03077157, 0.012308772, 0.004713623, 0.016856043, 0.009600392, 0.0072373743, 0.014578795, 0.015659465, 0.0032852858, 0.026840191, 0.03352178, 0.021120375, 0.022821164, -0.01366227, -0.0062611843, 0.0014957181, -0.020170508, -0.005366869, 0.003951374, 0.005012414, 0.0025844171, -0.0037958368, -0.020761104, -0.02647698, -0.030602397, -0.03254448, -0.0007419485, 0.0041316394, -0.00027670976, -0.0065475344, -0.032490402, -0.016972711, -0.008854057, -0.040491123, -0.0358427, -0.015874716, -0.0041842465, 0.010222637, -0.007327087, 0.00036967424, 0.033394217, 0.006399125, -0.012779014, 0.00836901, 0.0077810558, 0.0025228884, -0.0018847821, 0.003117801, 0.019591432, 0.016241826, 0.01656067, 0.0052796993, 0.004185673, 0.030895552, 0.027699983, 0.022325933, 0.029995574, 0.020852085, 0.0010120705, 0.0056118974, 0.011493384, 0.0055103176, 0.017761957, 0.010082317, 0.008006054, 0.014904127, 0.0014864043, 0.0031985866, 0.010063396, 0.008140335, -0.0050022947, 0.0009289407, 0.01846854, -0.0025769903, -0.013535188, -0.008611112, -0.021723079, -0.012224715, -0.010988366, -0.023402076, -0.010834361, -0.019806324, -0.00854781, 0.0031338984, -0.02275178, -0.014552179, -0.012723554, -0.006116839, 0.003534962, -0.0079601295, -0.008328582, -0.015105904, -0.006130003, -0.014681774, -0.01909819, -0.0088456, -0.01891422, -0.0060131955, -0.007591234, 0.0009221966, 0.003650312, -0.0012399213, 0.029378558, 0.011159417, -0.007697745, -0.008314635, -0.013728785, 0.008037349, -0.0013348656, -0.017861966, -0.0036332072, -0.013404555, -0.016495336, 0.010946705, 0.0005594223, 0.0031839386, 0.03138186, 0.014335432, 0.008713539, 0.013123011, -0.0034208172, -0.0024486189, -0.003419736, -0.010813904, -0.0039991387, -0.0074443882, -0.0040662372, -0.0017247592, -0.013362273, 0.009354541, 0.024954397, 0.011759219, 0.001274669, -0.011392288, -0.01890323, -0.0029614673, 0.017207565, -0.0015582698, -0.004877246, 0.007163928, -0.010015019, -0.016423745, -0.014828689, -0.0013941177, 0.0016539287, -0.013237719, -0.012243889, -0.006865475, 0.005031456, 0.0015600043, 0.0073755556, 0.012923639, -0.009490781, 0.0043773213, 0.00938546, -0.0047769714, 0.004708571, 0.012209383, 0.008527018, -0.0051903417, -0.0065108053, -0.002486923, 0.003516706, 0.010824229, 0.022449585, 0.033960998, 0.01963168, 0.010207896, 0.011307282, 0.014170827, 0.022908311, 0.0249985, 0.002156265, -0.0023874212, 0.007873445, -0.0068229544, 0.013404318, 0.012978138, -0.0053972187, 0.016356692, 0.02074012, 0.01888419, 0.018689059, 0.017460678, 0.008583587, -0.006055857, -0.00846118, -0.014388547, -0.014488962, -0.0045290077, -0.004133491, 0.006378938, 0.012309142, -0.004449897, 0.0058395504, -0.008494322, -0.02404144, -0.002168753, -0.014365346, -0.013666649, 0.0008468334, -0.008242849, -0.014266274, -0.0015255051, -0.0060135718, -0.010327487, -0.006756779, -0.026636513, -0.011897978, -0.013011724, -0.0124531435, 0.0052022957, -0.011726678, -0.0034710309, 0.001308541, -0.0054207724, -0.00939525, -0.0060201627, -0.011524711, -0.018508423, -0.008588384, -0.023968354, -0.008723912, 0.01076781, 0.0051425816, 0.010711412, 0.0035492391, -0.012494797, -0.014523636, -0.0028480683, -0.003630285, 0.0030219292, -0.001267217, -0.011478715, 0.0014060666, 0.0031407124, 0.009632037, 0.0116099045, -0.008495393, -0.017017875, 0.0002760816, 0.0061927713, 0.0048135538, 0.010433148, 0.001914281, 0.00697614, 0.007295154, -0.011088028, -0.008252605, 0.0056176344, 0.004126837, -0.0029268193, -0.0039690826, 0.0027028553, 0.008318287, 0.0051596398, 0.013833203, 0.009296275, -0.010296511, 0.0021119178, 0.008506837, -0.012881828, -0.012143003, -0.008382659, 0.0015535773, 0.007813235, -0.018352313, 0.0062900456, 0.00903584, -0.010835211, -0.003229867, -0.026661724, 0.0027286196, 0.0004324344, -0.014755307, 0.017535616, 0.0004509675, 0.0017150607, 0.00035353733, -0.0069733774, -0.004586935, -0.0041822204, -0.0063937725, -0.013885341, 0.0011646766, -0.004793973, 0.009705849, 0.0065695285, -0.008529356, 0.0036725127, -0.008470494, 0.009607734, 0.0096757235, 0.0027119315, 0.0040181912, -0.0038103797, 0.008001388, 0.0044519105, 0.021846674, 0.017109286, 0.0034443815, 0.01320984, 0.0022709852, 0.012495739, 0.009295504, -0.0024869868, 0.014090892, 0.018845264, 0.0075134435, 0.00835438, 0.015863733, 0.010343602, 0.009167114, -0.0014585175, -0.01420379, -0.008278516, -0.0025618155, -0.00040039158, 0.0041170847, 0.017392712, 0.013377249, 0.0012706468, -0.003476708, -0.009979321, -0.0045719873, -0.0152692, -0.010208434, 0.012132729, -0.006008202, -0.017225444, -0.010816021, -0.014758923, -0.018905181, -0.010401763, -0.0041832235, -0.0059578097, -0.0040236753, -0.008990059, -0.0007741679, 0.0019583018, -0.011656165, -0.013581751, -0.0215467, -0.027600298, -0.009576746, 0.0061730873, 0.006957853, -0.0035684977, -0.02671641, -0.009258629, 0.0014004343, -0.01406603, 0.0005154355, -0.0070671476, 0.0054824334, 0.020197008, 0.0027894413, -0.00063396024, -0.0075034816, 0.0018098059, 0.0036247754, 0.00029392328, 0.0040649413, 0.007457706, 0.011176882, 0.0036843896, 0.009504053, 0.012249761, 0.0076193833, -0.0158323, -0.016517513, 0.013300689, 0.011462441, 0.023611872, 0.026321338, 0.008219241, 0.0028931485, 0.0023343996, 0.011993384, 0.0036545154, -0.010890148, -0.0066375127, 0.0072495267, 0.0053088414, -0.0042898706, 0.005845552, 0.0078001814, 0.009725592, 0.011068363, 6.577075e-05, -0.0011511073, -0.009593285, -0.009917193, -0.0003768633, -0.011953512, -0.010717563, 0.00660108, 0.009119897, 0.0007954343, -0.00574006, -0.006024322, -0.0059873424, -0.008220585, -0.01973023, -0.021947758, -0.002309178, -0.0033102648, -0.005938512, 0.011852128, 0.008959395, 0.004218179, 0.0011563133, -0.011737424, -0.009488183, -0.0060932916, 0.0010744099, 0.0042988043, -0.008345615, -0.0031828247, 0.0069985846, 0.0036741195, 0.0008968852, -0.0019205147, -0.006766098, 0.0026832812, 0.014176633, -0.0014425173, -0.005235547, 0.0044570314, 0.0025934926, 0.00359281, -0.0034157105, -0.0012816004, -0.0020442004, -0.0073821233, -0.0029733016, -0.0060699866, 0.007947801, 0.00795698, 0.005074517, 0.016002176, 0.010839379, 0.014769602, 0.009951544, 0.0031888231, -0.002947347, -0.006335933, 0.0019535657, -0.0044462252, -0.007263063, -0.00848175, -0.0053237076, 0.003905722, 0.010516074, 0.012230663, 0.012413733, 0.01414763, -0.0032241612, -0.008259404, 0.0005654598, 0.0061142677, 0.005147576, -0.01308321, -0.012895208, -0.006960031, -0.006478784, 0.0030148914, -0.0033714897, -0.004195769, 0.0032754694, -0.002049674, 0.0043888036, 0.0076630074, 0.011209122, 0.00923298, -0.00719509, -0.0012304945, -0.0057251845, -0.0114926025, -0.004040378, -0.0055039274, -0.004760543, 0.0028159497, 0.0149970595, 0.0042341743, -0.0018064434, -0.0011003007, -0.0029522404, 0.003974475, -0.008633351, -0.010837954, 0.0011073615, 0.012678461, 0.010215807, 8.607972e-05, 0.002709276, -0.002136658, -0.00017300775, 0.001578583, 0.0041031004, 0.003643739, -0.003389014, 0.0015502492, 0.00033829827, 0.004930663, 0.010010332, 0.003404654, -0.0010394582, 0.003883626, 0.006095033, -0.0031362446, 0.0045669996, 0.008935364, -0.0012116843, -0.0050006406, -0.007923245, -0.005838404, -0.0052802623, 0.0010290962, 0.009164245, 0.00627801, 0.008864863, 0.004178771, -0.000656733, 0.0027419669, -0.007851649, -0.00894164, 0.0011379289, -0.004796545, -0.0039521204, 0.0032047292, -0.0052595213, -0.0014892066, 0.008000816, 3.5773606e-05, -0.005793444, -0.0040575964, 0.0028103355, 0.0019826905, -0.006444465, -0.0083423415, -0.0009786034, 0.012003267, 0.0072281132, -0.006582963, -0.0075539364, -0.0016866502, 0.00065268273, -0.0028804701, -0.004148736, 0.0015969324, 0.0037173426, -0.00068286795, -0.00013719319, -0.0046429615, -0.0023210435, 0.004109101, 0.00278777, 0.008020656, 0.0005799469, 0.0010208745, 0.008685954, 0.0027840307, 0.0020583852, -0.0019054469, -0.001187504, 0.00033059056, -0.0020141988, 0.0006243998, 0.0020199257, 0.0017544702, 0.0045705833, 0.004534995, -0.0029329683, 0.0017279411, -0.0046657175, -0.008975532, 0.004678651, 0.0040931217, 0.0072914124, -0.0012218225, -0.0061520864, 0.0035416514, -0.0061555984, -0.0063486644, 0.0016977941, -0.003795804, -0.005458374, 0.0026533685, 0.0005507907, -0.00019495038, -0.0030109468, -0.008860761, 0.00096142193, -0.0010342057, 0.0042709974, 0.0065191714, -0.008787882, -0.007081959, -0.0065565007, -0.006691139, -0.0047551487, -0.0046504606, 0.0018157619, 0.009239861, 0.006027369, 0.000493496, -0.0018021992, -0.009160179, 0.0012526648, -0.0005868256, -0.009615517, 0.0063490467, -0.0006011565, -0.007830057, 0.0026809706, 0.0047895913, 0.0069693583, 0.003966296, -0.0021076284, -0.0011275642, 0.0073573086, 0.0060169226, -0.0019263803, 0.0011717628, 0.0046043913, 0.006459199, -0.002682696, -0.006986224, 0.004862703, 0.0041738795, 0.0045529553, 0.006839199, 0.00039860306, 0.0044178176, 0.009583439, -0.00391057, -0.009548953, 0.007245163, 0.01177578, 0.006801175, 0.0036211608, -0.00020236551, 0.008448802, 0.012170701, -0.0024598085, -0.009407437, -0.006353047, -0.006360847, -0.0035768063, -0.0034138707, -0.0013441894, -0.0010779116, 0.0007312303, 0.0060479734, -0.00017038596, 0.0040109097, 0.0019481841, -0.0043399134, -0.001821182, -0.012098534, -0.011826222, -0.0028111008, 0.0007193731, -0.004389342, -0.008429956, -0.0038367591, -0.006457003, -0.009150282, -0.010167505, -0.006078622, 0.00033801747, -0.0017075578, -0.0021290386, -0.0014312747, -0.0024570802, 0.0036026868, 0.0030202623, -0.004303012, -0.0015171728, -0.0061901677, -0.010813983, -0.000650967, 0.0049190116, -0.00020078516, -0.004797291, -0.008730177, -0.005448078, 0.006761392, 0.005533149, 0.0049853325, 0.01036552, 0.010071397, 0.0017624665, -0.006289195, 0.0001606515, -0.0018004394, -0.005484236, -0.0022209145, 0.00048253906, -0.0041413372, -0.0020058693, 0.018545134, 0.00827832, -0.0012385908, 0.0031105294, -0.008849426, 0.0013618782, 0.006487823, 0.002096994, 0.006293263, -0.0052185943, 0.0014526236, 0.007140775, -0.0019211493, 0.0053776195, -0.005205038, -0.0048842607, 0.0010194419, -0.0104093915, 0.005035192, 0.007899102, 0.00045583938, 0.0076571684, 0.004353031, -0.0026690487, -0.000990113, -0.0009250136, -0.0030896051, 0.0018209531, -0.0018222367, 0.0034463764, 0.002558578, -0.0055249464, 0.0017006096, -0.00022393999, 0.0076277987, 0.0073731756, -0.001818615, -0.0028772221, -0.00465581, 0.0031486962, 0.008536112, 0.009101948, -0.0016049459, -0.0032545335, 0.0018619265, 0.0008426591, 0.007792012, 0.008315768, 0.0006812324, -0.00749924, -0.0012278412, -0.00028536725, -0.0006987568, 0.0008382089, -0.00701076, 0.0016158437, -0.0028665676, -0.0073341234, 0.0018413772, 0.0064563914, 0.0070100506, -0.0007075364, 0.0030285139, 0.0028820054, 0.0013748057, -0.0015792744, -0.007912977, -0.002312881, -0.0041125, -0.002936073, 0.0013779325, -0.0026258093, -0.0016404289, 0.004825231, -5.509022e-06, -0.0004675222, 0.0061669974, -0.000978532, 0.00072830677, -0.0012524581, -0.005168306, -0.0019612391, -0.009052464, -0.0046220114, 0.0017685528, 0.0006014296, -0.0015690593, -0.0024104442, -1.2074476e-05, -0.004327127, -0.0017937098, 0.0017281885, 0.00028918902, 0.0011039842, -0.004108322, -0.0024621326, 0.00071909174, -0.0016746467, 0.0023421028, 0.0010032763, -0.0047879918, -0.0029620249, -0.0027276527, -0.0036021497, 0.0051099854, -0.00040024484, -0.005911767, 0.00707263, 0.0015266306, 0.0009823437, 0.0048585543, -0.00052557624, 0.0032326102, -0.00018340853, -0.0007407804, -0.0016253915, 0.0012201286, 0.0058327736, -5.0566778e-05, -0.0006957754, -0.004806084, -0.0017114555, 0.0040566362, 0.0033418676, 0.004138695, -0.0012577019, -0.0021112247, 0.0029313636, 0.0019297968, -0.0006245915, -0.0013304191, -0.006858584, -0.0048998618, -0.00045349312, -0.0025447074, 0.00051902846, 0.00093773653, 0.0020099913, 0.0020102789, -0.0024811972, -0.0028418687, -0.0030014387, -0.0028472058, 0.0019632678, 0.0041319085, 0.00077366794, -0.00012867851, -0.0037669316, -0.0032460806, -0.0022374066, -0.004450137, 0.0018705515, 0.0009212752, 0.0032428051, 0.00850186, 0.0013617717, -0.0013696017, -0.0033680093, -0.0003315448, 0.0054934477, 0.0006766231, 0.0009795084, 0.00030971176, -0.002784096, 0.0019856985, 0.0033190271, 0.0036486099, 0.0025552942, -0.0010382957, -0.0028375566, -0.003978721, -0.0005445822, 0.0041691074, 0.0063289097, 0.004632375, 0.002765558, 0.003193795, 0.005492598, 0.004162423, -0.003147651, -0.002802115, -0.0005807475, 0.0015482701, 0.0036466718, -0.0005880096, 0.00240219, 0.0036857356, -0.0033531971, -0.0031791069, -0.0014509603, -0.003115801, -0.0024802252, -0.00077974255, 0.0016891686, 0.0009746886, -0.0017273041, -0.0008674276, 0.000696974, 0.000105101855, -0.0037962347, -0.0022470776, -0.00053641136, -0.0039834096, -0.0019856335, -0.003628818, -0.0056170523, -0.0020065533, -0.0015356154, 0.0018986661, 0.0032799372, -0.0014156675, -0.00064327725, -0.001264124, -0.00056210073, 0.004917895, -0.0009956374, -0.00493796, -0.00049364526, 0.00014393745, 0.00024572038, -0.00022850702, -0.00014755226, 5.703762e-06, -0.0010912122, -0.0009919883, 0.0003083531, 0.00078302674, 0.0020268485, 0.0042820615, 0.0018858135, -0.001106667, -0.0024753087, -0.0022046648, 0.002483654, 0.00626209, 0.0043496327, 0.0019125864, 0.0038805897, 0.0045624664, 0.0016609399, -0.0008832633, 0.00072105153, 0.002955514, 0.0026798209, 0.003752844, 0.0033441018, 0.0035121427, 0.0043395036, 0.0014719452, 0.0013516011, 0.0015439475, -0.0017098172, -0.00078888395, 0.00031479704, -0.00016063251, 0.0032145784, 0.0017509039, -0.0012928412, -0.0007160428, -0.0025158545, 0.00100196, 0.0026440823, -0.0010282665, 0.0004950262, -0.002108704, -0.0010527974, 0.0022141717, -0.0037755745, -0.00409573, -0.0018065958, -0.00075177074, -0.0017248536, -0.0022914885, 0.00022070884, -0.004128383, -0.00067760074, 0.0029458809, -0.00093806244, -1.4939108e-05, -0.004916582, -0.0053826394, 0.00065606006, 0.0013504362, 0.0027901712, 0.004019916, 0.00058250956, -0.0016832155, -0.00023447172, -0.001971873, 9.738152e-05, 0.0017760078, -0.0030257395, -0.003573079, -0.0011259601, 0.0023850293, 0.0029204153, 0.00045385762, -0.002119468, -0.0015011078, 0.001584411, -0.0004916003, -0.001906041, -0.0030209357, -0.001137234, 0.0029804283, 0.0017949597, 0.00047897437, -0.0019415787, -0.0033251657, -0.0015024949, 9.05027e-05, -0.0017270067, -0.0029029588, -0.0015462245, -0.0025913834, -0.00075575593, 0.0008497946, 0.00028224717, 0.00035823256, 0.0013490987, 0.0021340805, -0.00037735127, 5.710875e-05, -5.5504173e-05, -0.0018081437, -0.0012614499, -0.0006618759, 4.620987e-05, -0.0009635249, 0.0006854695, 0.0017635319, -0.0010259831, 0.00016350055, 0.0019196754, 0.00017342338, 0.00054886064, 0.0017627962, 0.00018962989, 0.0014197438, 0.0028576474, -0.00057013065, -0.0027938846, -4.1745872e-05, 0.0026284624, 0.002066357, 0.0017343435, 0.0011647257, 0.0014889176, 0.0014552093, 0.0006571129, 0.001305783, 0.00043813555, 0.0020262774, 0.0020153674, 0.0001271259, 0.0011991033, 0.0010405624, 0.0027002678, 0.0028122624, 0.00084926916, 0.0009296288, -0.0002216832, -0.0031902955, -0.0027556168, 0.0003013148, -0.00038611452, 0.0009872548, 0.0020512175, 0.0010476182, 0.001262809, 0.00013467387, 0.0006119421, -0.0002371913, -0.0022865003, -0.00167646, 0.00017982157, -0.0015994353, -0.0017213093, -0.0010798097, -0.0036772145, -0.00055807346, 9.25437e-06, 0.0013551732, 0.0012672002, -0.002279138, 0.0005253307, -0.001248534, -0.0012680867, -0.00072813215, -0.0015996495, 0.00033464, 0.00055387337, 0.0001899435, -0.0024653564, -0.0023803436, -0.002844448, 0.001067785, 0.004343401, -3.4014713e-05, -0.0009010259, -0.003105041, -0.0006303667, 0.0021555163, 0.0009794546, 0.0017202253, -0.0007118763, -0.00093063223, 0.0010682227, 0.0020218205, -5.166419e-05, -0.0008076263, 0.00092636346, 0.0002781108, -0.00054002897, -0.001434837, 0.0014735478, 0.002357206, 0.0020026425, 0.00445952, 0.0018858485, 0.0009799596, 0.00018252572, -0.0020446698, -0.00018878018, 6.691452e-05, 0.0003102158, 0.00017950102, -0.0010675264, 0.0004875084, 0.0005559917, -0.0012149984, -0.00047391088, 0.00026736097, -0.00045233098, 0.0010616146, 0.0022717651, 0.0010260358, -0.00037463332, -0.0024967033, -0.0028801782, -0.00051293033, -0.000446426, -0.0025440857, -0.002359298, -0.0014720332, -0.0010218464, -0.00018152368, -0.0005793091, -0.00041240276, 0.0011237516, 0.00070741755, -0.00036089213, 0.00010223075, -0.0004758756, -0.0009509218, -0.00089915475, -0.00097124063, -0.001255882, -0.0019308693, -0.00059405225, -0.0001994477, 0.00033218306, -0.00022769385, -0.0014433095, 0.00090997276, 0.00025876524, 0.0006328489, 0.0022083882, 0.00021841607, 0.00016693499, 0.00030571604, -0.00017559399, 0.00026137897, -0.00069204584, -0.0012044389, -0.00032264207, -0.00059561315, 0.00061419973, 0.0012505403, 0.00079211424, 0.0021361695, 0.00045495378, -0.000114426926, 0.0016193155, 0.00073454465, -0.0001702301, 0.00045985123, 0.0023421198, 0.0017895515, -0.0014297632, -0.0005554298, 0.00029154954, -0.0006414342, 0.0029853527, 0.0020831416, -0.00050466444, 0.001132013, -0.0006134963, -0.0016765774, -0.0012681817, 0.0010339775, 0.001826502, -0.0004086965, 0.0005679183, 0.0006240759, 1.2598317e-05, 0.00011923943, -0.00020805754, -0.0014115323, -0.0024708079, -0.0033171773, -0.0031262236, 0.0001551359, 0.0009378144, -0.00023537906, -0.0010026285, -0.00034201858, -0.0006433451, -0.0017591368, 0.0010448637, 0.0018170291, 0.0002479273, -0.0014012873, -0.0018622066, -0.0012847781, -0.00037768218, 0.00029250295, -0.0016859231, -0.0003529271, 0.0002780075, -0.00072792673, 0.0003824977, 0.0004666419, 0.0004950424, -0.00082058326, -0.000665577, -8.141452e-05, 0.00042487812, 0.0013614515, 0.0008491004, 0.0010694561, -0.00035831437, -0.000551639, -0.000531815, -0.0007220214, 0.0009462025, 0.00060044817, 0.0012052585, 0.000271243, -0.0012314254, 0.00015249604, -0.00020288283, 0.00089067686, 0.0020060642, -0.00013825843, -0.00040532448, -2.9860661e-05, 0.00042860577, 0.0011421028, -4.685205e-05, -0.00012894647, -0.0004222981, -0.0011536876, -0.0004701477, 0.00025276083, 0.00065811584, 0.0011678502, 0.0019808349, 0.0011335858, 0.0004976445, -0.00019807917, -0.00054316636, -0.0007725344, -0.0023429063, -0.00024524858, 0.00067650556, -2.3878785e-05, -7.731268e-05, -0.00013332677, 0.0017578525, 0.00092236296, 0.0007746475, -0.00031239688, -0.0015962975, 0.0009715704, 0.00057244144, 0.0014451734, 0.001414872, -0.00080338225, -0.00034738993, -0.0016513907, -0.001042033, 0.0010968188, 0.0005024461, -0.0005586883, -0.00015408061, 0.00049498474, -0.0006007775, 3.0862928e-05, 4.9828635e-05, -0.0007876159, 4.2798612e-05, -0.00032802735, 0.00018997621, 0.00039048155, -0.00032951182, -0.0011903892, -0.0011857848, -2.9298446e-05, -0.0010328442, -0.0010338892, -0.00039086046, 0.00031799977, 0.00058887526, 0.0003732969, 0.0008872312, -0.00042604108, 0.00043258423, 0.0005492569, -0.0011595235, -0.001065518, -0.0006074495, 0.0001348969, -0.00041929045, 0.00039934533, 0.0007642498, 0.00028737582, 0.0002961369, -0.00031564434, 0.00012565094, -0.000756903, 0.00010158547, 0.0008944768, -0.00015537342, 0.00042986273, -0.00048666954, -0.0009124021, 0.00054163684, 0.00083373196, 0.00015053348, 0.00022884771, 0.000251737, -0.0005981777, -0.00088700507, 0.00037812177, 0.00056662405, -0.0001445953, 0.0006226844, -0.0002480707, 0.00073051965, 0.0016588849, 0.00044107912, 0.0008493921, -0.00033184455, -0.00036211102, -0.00067633856, -0.0002709173, -0.00021837665, -0.0017330999, 0.00095679605, -7.849479e-05, -0.0002714668, 0.0013183622, -0.0001402117, 0.00086627883, -0.00014484092, 9.73306e-05, 0.0010748326, -0.000104434526, 0.00030146877, 0.00034350145, 0.0002758336, -0.0006360299, -0.0012791159, -0.0009504246, -0.0006375521, -0.00011227211, 0.00060871366, 0.00045377534, -0.0005017466, 2.1493397e-05, -0.000355763, -9.499361e-05, 0.00047663788, 0.00032126895, 0.0003837848, -0.0013236044, -0.00016940666, 0.0007837529, -0.00013163505, 0.00023290148, -0.0007632312, -0.00026605584, 0.00037733375, -0.00039167583, -0.00024778186, 2.5449677e-05, -0.00044667447, -0.0008563049, 0.00019210571, 0.0006179571, 0.0001926899, -0.00041551742, -0.00049989007, 0.00048006838, 0.0007740245, 0.0007646887, 0.0005423506, 5.5433124e-05, -0.0007104602, -0.00015098826, 0.00035791905, -0.001018845, -0.00029348067, 0.00026978969, 0.0002089816, 0.00039688594, -0.00078003714, -0.0002365105, 1.880202e-05, -0.0003692603, 0.00014897446, 0.0002731957, 0.0005428483, 0.0011041366, 0.0010732148, -0.0004522384, -0.00088623125, -0.0007599165, -0.0005462693, 0.00023238696, 4.7792808e-05, 0.0005824175, 6.461241e-05, -7.4144904e-05, 0.0003650985, -0.0005936611, 8.1983584e-05, 8.59846e-05, -0.0007002322, -0.00076746265, -0.0005409043, -0.00017600344, -0.0003379254, 0.00012166556, 0.00015830135, 0.0003034586, 0.00022244862, -0.0004246015, 0.00025806532, 0.0007169907, 0.00033479978, -0.00052900764, -0.00037522713, 3.0749114e-05, -0.00036840158, -0.00013025098, -0.00066472596, -0.0007225718, -0.00034287755, -7.3625943e-06, 0.00040054906, -0.0003992961, 4.4504905e-05, 0.0004602229, 0.00028730874, 0.000107875276, -0.0009115656, -0.00074528327, 8.634529e-06, 0.00023535105, 0.00043617198, 0.00095887145, 3.4232806e-05, -0.00048933405, 0.000677705, 0.00014399392, -0.00038793558, -0.0007595378, -0.0005178652, 0.0006222694, 0.0003497918, 0.00047859762, 0.00070931687, -0.0001228736, -0.00051033654, 0.00014263683, 0.00031086282, -0.0001956486, -0.0003973099, -4.184073e-05, 0.00039854358, -0.00012955614, -0.00062969123, -0.00012222596, 0.0005344878, 2.7608088e-05, -0.00020432229, -0.00020557249, -0.0003349016, 0.00028741066, 1.06534335e-05, 0.00033502321, 0.000326013, -6.64843e-05, 0.00013787509, -0.0007923108, -0.0006312167, -0.00023724345, -0.00029807934, -8.445814e-05, 8.632035e-05, 0.0002535802, 0.000384864, 0.0007669583, 0.00021219708, 0.000104100436, 1.4152887e-05, -0.0007048169, -0.00048846105, -2.7810878e-05, 0.00010927948, -0.00014936738, -0.00015769649, -3.843798e-05, 8.086119e-05, -0.00040292236, -0.0005991416, 0.00030463163, 0.0005418837, 0.00044526323, 0.00018895407, 0.00026375597, 7.415903e-05, -0.00022098955, 0.0003234005, 0.00023302625, 4.3250813e-05, -3.674358e-05, 2.5591178e-05, 8.731082e-05, -9.983098e-05, -0.00012954943, 7.642189e-05, 0.00028262625, -7.678235e-06, 0.0005328119, 0.0006821907, 0.00013595825, 0.00038000647, 0.00044152254, 0.00035958886, 1.4396307e-05, 2.3996152e-05, 0.00014994065, -1.934775e-05, 8.2422615e-05, 9.738117e-06, 0.00011983774, -0.00031918177, -0.0005208225, 0.00013529226, 0.00019282446, 1.5438633e-05, -3.633508e-05, 0.00021806435, 0.00020695821, 0.000105929634, 5.9240243e-05, -0.00033996196, -1.40911925e-05, -8.95541e-05, -0.00047736627, -0.00051004154, -0.0006657471, -0.00038444865, -0.00041014235, -0.000105780535, 4.670509e-05, -0.00029143115, -0.0002472621, -0.0006232848, -0.0002099209, 0.00015920504, 2.7865159e-05, 0.0002082375, -0.00030600277, -0.00029674268, -1.2264045e-05, -0.00016580087, -0.00041714704, -0.00059112476, -9.553834e-05, 1.8386512e-05, -7.492877e-05, 8.4351996e-05, -3.7603022e-05, 0.00029420757, 0.00047055623, -0.00017515087, -0.00031219024, 6.636835e-05, 0.00027832077, 0.0005107252, 0.00053985085, 0.00032985173, -1.6301019e-05, -0.00033346083, -0.0003432707, -0.00019992406, -4.9544946e-05, 5.4083357e-05, 0.0003040452, 0.00054041087, 0.0002494099, 4.828367e-05, 0.00033881332, 0.00011595023, -0.00016811572, 0.00013446885, 0.0001333523, 8.721088e-05, -1.4455342e-05, -8.6246444e-05, 0.00023020041, 0.00010537187, -2.3874352e-05, -0.00022277066, -0.0003752143, 0.00023115164, 0.00024902614, 7.386817e-06, 0.00021720283, 0.00019321809, 5.3966232e-05, -0.00014141078, -9.557332e-05, -1.6353124e-05, 3.3349465e-05, 2.0966074e-05, -0.0002957648, -8.626997e-05, 0.0001680625, 0.00011104366, -1.7203898e-05, -0.0002217305, -8.134932e-05, 6.6362e-05, 0.00018636449, 0.00021889721, 0.00021476664, 0.00014767722, 1.6294043e-05, 3.0525134e-05, -0.00031013534, -0.0003355655, -9.1324466e-05, -7.582891e-05, 5.4319036e-05, 5.0508e-05, 4.3693337e-05, 0.00010377276, 6.6045584e-05, -4.8559406e-05, 4.8620863e-05, 7.668248e-06, -5.8988033e-05, 0.00019139319, -6.203305e-06, -7.173069e-05, 5.1601794e-05, -4.8950307e-05, -0.00014158055, -0.00031493892, -0.00014485259, 0.000113107286, 0.00013836182, -5.5143893e-05, -0.00013512817, 0.0001571633, 0.00015641651, 6.845861e-05, 0.00010802748, -8.8434215e-05, -7.02324e-05, 6.142535e-05, 2.2006672e-05, 0.00021492621, 0.00010541277, -0.00014022962, -0.0001272935, -0.0002842415, -0.00013521356, 5.6429246e-05, -4.945902e-05, -6.026059e-05, 0.00010436403, 0.00010083595, -7.125145e-05, 6.236725e-05, 1.7627544e-05, -6.7220484e-05, -3.490457e-05, -0.000116996445, -0.00011104973, -0.00012048226, -2.1578177e-05, -0.00011970975, -0.00015034036, 2.405291e-05, -4.4319975e-05, -5.9592123e-05, -2.235611e-05, 2.4018245e-05, 8.149845e-06, 5.353846e-05, 8.8666005e-05, 5.450514e-07, 0.00010282925, 8.9816436e-05, -4.829819e-05, -9.771e-05, -0.00015144763, -0.00016939141, 5.9652525e-06, 0.0001843799, 7.761657e-05, 1.6152128e-05, 6.580938e-05, 2.4700605e-05, -5.587679e-06, 2.976508e-05, 3.9364066e-05, 4.513357e-05, 3.9291506e-05, -2.1503101e-05, 2.8969685e-06, 3.3294895e-05, 2.8337145e-05, 4.129764e-05, 5.676437e-07, -3.26817e-05, -2.6368243e-05, -7.109804e-05, -7.299885e-05, 2.514412e-05, 3.9883e-06, -2.3435314e-05, 1.5846344e-05, 5.192531e-06, 1.36596145e-05, -1.0980353e-05, -1.6440777e-05, 3.6360666e-06, 1.2026564e-05, 1.8209757e-05, -2.9226352e-05, -1.33133935e-05, 2.3612012e-05, -1.9372076e-06, -1.7044928e-05, -1.4320372e-05, -4.5823185e-06, -1.2735326e-06, 1.5020057e-05, 4.0819664e-06, -3.5475347e-05, -3.617564e-05, -3.748023e-05, -2.4156523e-05, -5.4937e-06, -4.4435083e-06, 2.081332e-06, 8.040459e-06, 2.3721159e-05, 5.8655796e-06, 9.4732576e-07, 1.612186e-05, 6.561468e-06, -7.9550813e-07, -3.35872e-05, -3.6898662e-05, -1.9280636e-05, -1.39406675e-05, -4.855658e-06, -1.3188734e-05, -7.835287e-06, 3.599931e-07, 9.296475e-06, 1.1454354e-05, 3.657655e-06, 6.575848e-07, -4.091924e-06, 4.0731334e-06, 3.7838174e-06, -3.8154367e-06, -6.6324615e-06, -2.555799e-06, -1.3033885e-07, -6.3596394e-06, -1.2767814e-06, 6.0333264e-07, -3.83207e-06, -6.538077e-06, -6.9777943e-06, -4.1106186e-06, -2.5264058e-06, -1.8120055e-06, -2.710365e-06, -3.229433e-06, -2.5648742e-06, -2.4237553e-07, 2.7283165e-06, 5.0133503e-06, 1.5210397e-06, -2.2421007e-06, -6.8658136e-07, -6.1325755e-07, -2.8085836e-07, -4.6126934e-07, -2.5225415e-07, 5.8790323e-07, 1.2047214e-07, -3.0092502e-07, -1.4972418e-08, 4.3805917e-07, -3.6206657e-07, -4.778594e-09, 7.003579e-08, -1.7854934e-07, -5.3253014e-08, -1.9495724e-07, 7.917507e-08, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-constexpr float kCalcani[4096] = {-0.012247605, 0.004706446, 0.0053041065, 0.15622063, 0.17881426, -0.4525047, -0.098676905, 0.27480283, -0.16439803, 0.07889408, 0.00426274, -0.04911231, 0.08609663, -0.07228411, 0.042112697, -0.018520195, 0.00082270964, 0.0142650055, -0.027591119, 0.031202225, -0.029622218, 0.02000411, -0.008548443, -0.0053585577, 0.011740663, -0.017875422, 0.0153060015, -0.013300587, 0.0049597058, -0.0013783096, -0.0040921085, 0.0058149174, -0.0074841143, 0.004947162, -0.005037761, 0.001136549, -0.0009200193, -0.0020686348, 0.0011294698, -0.0024595442, 0.0009241923, -0.0016706091, -8.849205e-05, -0.0013156943, -0.00069570256, -0.001235696, -0.0010879328, -0.00063634914, -0.00072219333, -0.00067793723, -0.00094708975, -0.00014902186, -0.0013879428, 0.000289144, -0.0010468652, -0.00019014996, -0.00055202463, -0.0011608966, -1.9974034e-06, -0.0011382684, 0.0001475302, -0.0008935509, -0.0003648751, -0.00086249027, -0.00059928873, -0.00025854455, -0.0017691647, -0.0004997362, -0.0011217808, -0.0007906265, -0.0010097902, -0.0004713284, -1.1519264e-05, -0.00063117646, 0.00048171054, -0.0002289146, 0.00018873987, -0.00015377921, -0.00052910636, -0.00026499684, -0.00043424207, -0.00014952246, -0.00095536176, -3.2047254e-05, -0.00025737632, -0.0002208195, -0.00035841085, -0.00023326378, 0.00062555, -0.0005085548, 0.00035248866, -0.00049491954, 0.00020518011, 0.00011498413, -7.3575626e-05, 0.0010033197, -0.0005502494, -0.00046040543, -0.0017685621, 0.0002175007, -0.00015175228, 0.00015661329, 0.0021540562, 0.0018953576, 0.0023392003, -0.00025361343, 0.0005321254, 0.002840155, 0.010739952, 0.011877876, 0.010252579, 0.00054834207, -0.013437362, -0.014333832, -0.024167335, -0.01595536, 0.008265723, 0.024324015, 0.013747481, 0.03736206, 0.05880971, 0.05556944, 0.13500468, 0.084565245, -0.049276292, -0.20877464, -0.49648276, -0.6281213, -0.5457511, -0.2743823, 0.15037397, 0.63975155, 0.98190385, 0.8883946, 0.51772076, 0.09460509, -0.24432327, -0.472993, -0.60988575, -0.7092264, -0.6673678, -0.50788116, -0.46592537, -0.13830592, 0.24653961, 0.3806201, 0.5904437, 0.6037905, 0.48832408, 0.2937128, 0.0718685, 0.072555944, 0.04784388, 0.14278413, 0.17016572, -0.04381575, -0.13684814, -0.2372936, -0.21098343, -0.05652163, 0.09294005, 0.31077194, 0.24704894, 0.086091526, 0.037974376, -0.06594002, -0.02225137, 0.15128557, 0.2720176, 0.35883284, 0.39185557, 0.26986954, 0.13126461, 0.06352795, -0.10755949, -0.286544, -0.30157533, -0.230534, -0.09950003, 0.13178624, 0.2155861, 0.14457649, -0.0066862768, -0.30310413, -0.46128276, -0.54561645, -0.49654055, -0.22057414, -0.08614669, -0.011540093, 0.035656974, -0.033388328, -0.057579685, 0.008681299, 0.074525654, 0.10675184, 0.08468063, -0.0023615398, -0.023323337, -0.022730535, -0.00953799, 0.019211585, 0.031859472, 0.05444568, -0.12454348, -0.395221, -0.6023505, -0.72069514, -0.56653565, -0.29488906, 0.013453997, 0.2976559, 0.40001586, 0.4574707, 0.41705397, 0.32248586, 0.32518378, 0.2899274, 0.21593471, 0.041665696, -0.22493306, -0.44427308, -0.57252055, -0.5013045, -0.28006, 0.041127693, 0.34358466, 0.5146323, 0.56148225, 0.43358693, 0.30825698, 0.23855244, 0.19036403, 0.15972537, 0.075048484, 0.0020607228, -0.11621342, -0.29860538, -0.46248287, -0.528771, -0.43821925, -0.27767757, -0.119708024, 0.028524185, 0.11955297, 0.1407368, 0.1820418, 0.19511008, 0.2086693, 0.24237901, 0.19111793, 0.13814941, 0.039455697, -0.05831542, -0.09743957, -0.12335652, -0.050896753, 0.046707503, 0.16952324, 0.24408233, 0.19456805, 0.10042621, -0.08485662, -0.24914402, -0.3232012, -0.33923587, -0.27189088, -0.1604939, -0.013401528, 0.13543501, 0.2859207, 0.4108907, 0.47910604, 0.5618064, 0.55570537, 0.43989116, 0.25824502, -0.055010088, -0.34716317, -0.5278509, -0.5325799, -0.36125937, -0.12972127, 0.121883176, 0.2057385, 0.2199437, 0.17149863, 0.049955253, 0.070660554, 0.025822718, 0.04292695, 0.105179965, 0.050978273, 0.10318139, 0.05140984, -0.03158005, -0.014734502, -0.053141113, -0.051739912, -0.03913151, -0.08111417, -0.14494944, -0.17623705, -0.20231837, -0.2021776, -0.15307409, -0.08501478, 0.043400522, 0.14042398, 0.2546268, 0.35562274, 0.33773106, 0.29728568, 0.16684994, -0.027387306, -0.1891485, -0.3398789, -0.45961946, -0.4979682, -0.49395168, -0.4706998, -0.32942864, -0.18702309, -0.04851603, 0.11437758, 0.16337006, 0.22731496, 0.26427355, 0.24142314, 0.25688386, 0.2104602, 0.15793452, 0.13751897, 0.1329134, 0.1278694, 0.06985127, -0.02731878, -0.16912286, -0.2778748, -0.3361303, -0.3249853, -0.2313322, -0.1387837, -0.01544615, 0.045934726, 0.02317284, -0.00018064899, -0.06707482, -0.07791556, -0.027553208, 0.037878454, 0.147103, 0.21981083, 0.25985238, 0.24082442, 0.15025586, 0.06852405, -0.020739589, -0.089956105, -0.12856062, -0.15756145, -0.16849685, -0.16830355, -0.14925888, -0.13315205, -0.07834917, -0.0105243595, 0.026941923, 0.08452397, 0.10020391, 0.08991713, 0.098761916, 0.10212224, 0.12646641, 0.15939856, 0.16071735, 0.10051411, 0.0017958557, -0.109517686, -0.17480615, -0.14115953, -0.055602673, 0.053043183, 0.10579572, 0.069307506, -0.015860697, -0.14295006, -0.22393975, -0.21479711, -0.14992358, -0.044349525, 0.049055543, 0.091528974, 0.094613805, 0.07652316, 0.058175374, 0.04755344, 0.044974472, 0.032276545, -0.0019360299, -0.032691326, -0.060812794, -0.060083404, -0.020103782, 0.04470192, 0.14674838, 0.21872684, 0.25875488, 0.28392306, 0.24704239, 0.180833, 0.077521086, -0.062015045, -0.20437144, -0.33489448, -0.40165815, -0.3937928, -0.3011563, -0.14524485, 0.018698512, 0.1588018, 0.2330045, 0.26147854, 0.25537267, 0.22434169, 0.215641, 0.20539376, 0.17845984, 0.14079383, 0.07747667, -0.011528839, -0.10339022, -0.16198087, -0.18835966, -0.1809455, -0.14232004, -0.09829717, -0.047982253, 0.0014768429, 0.047127597, 0.08662788, 0.10949919, 0.11789484, 0.09825447, 0.055169825, 0.023216885, 0.01584264, 0.02599404, 0.051148776, 0.060581386, 0.029350786, -0.024761226, -0.09340639, -0.15117973, -0.18034261, -0.18578725, -0.1711982, -0.1536642, -0.13407972, -0.11321008, -0.06801929, 0.0034117345, 0.06595674, 0.13219784, 0.18108495, 0.19382939, 0.19372924, 0.17151403, 0.13612029, 0.08921585, 0.016264888, -0.063022524, -0.12551473, -0.13824718, -0.08726064, -9.6726115e-05, 0.08986306, 0.13869697, 0.117009744, 0.029751582, -0.07696968, -0.13948973, -0.13697472, -0.074373506, 0.01668451, 0.08265508, 0.11201368, 0.1100295, 0.077530056, 0.050633717, 0.033707876, -0.003320689, -0.052946236, -0.121180214, -0.20006706, -0.24796309, -0.25229606, -0.21420427, -0.14371543, -0.0672677, -0.0030956897, 0.04447258, 0.07213836, 0.095606536, 0.11048349, 0.102294266, 0.08011848, 0.032409586, -0.0089181755, -0.014625814, 0.0063157254, 0.058263592, 0.11525678, 0.15127897, 0.14752406, 0.11781551, 0.07343824, 0.01019566, -0.035325743, -0.07874007, -0.12285446, -0.1389522, -0.13430852, -0.09206289, -0.021062259, 0.04923192, 0.10437314, 0.12529038, 0.11396599, 0.07736282, 0.031080164, -0.0039753662, -0.037977092, -0.07432471, -0.11362015, -0.16364783, -0.19919299, -0.21069363, -0.19071078, -0.12477683, -0.04110601, 0.04436445, 0.11407017, 0.14757708, 0.15591927, 0.14029235, 0.10666273, 0.06582925, 0.012497283, -0.04542489, -0.087955564, -0.12140827, -0.14226891, -0.13634272, -0.114266835, -0.06684541, -0.008154188, 0.044383135, 0.09502201, 0.11596303, 0.11030205, 0.08162187, 0.030148854, -0.022357399, -0.079455405, -0.12903443, -0.16270992, -0.1760417, -0.15600996, -0.11260383, -0.051245827, 0.0139101995, 0.058983274, 0.08182433, 0.088729106, 0.08342693, 0.075942226, 0.067461774, 0.048094448, 0.017199457, -0.021653594, -0.05595258, -0.07012918, -0.05585692, -0.015249163, 0.038974658, 0.08757992, 0.10540609, 0.08940922, 0.04523181, -0.011428927, -0.04872006, -0.062665045, -0.047947317, -0.007659184, 0.03815808, 0.08655297, 0.11430888, 0.114183694, 0.09509922, 0.051818773, 0.009333508, -0.023501094, -0.047302864, -0.049689557, -0.043245234, -0.031476162, -0.01896514, -0.011817781, -0.0033445244, 0.007585414, 0.031500187, 0.066057436, 0.10045341, 0.13022205, 0.14292908, 0.1385777, 0.12154975, 0.09574268, 0.072072, 0.051259402, 0.028462067, -0.002565104, -0.041400142, -0.07706267, -0.101478845, -0.09690362, -0.062440522, -0.016981166, 0.033225514, 0.06154875, 0.06255407, 0.06020897, 0.054226015, 0.055609524, 0.06291876, 0.06276134, 0.054775894, 0.027589228, -0.009570074, -0.04314944, -0.0688872, -0.075376354, -0.07165927, -0.071549006, -0.07922763, -0.102135986, -0.13326864, -0.15834117, -0.1740063, -0.16890234, -0.1391122, -0.08979968, -0.01873913, 0.056980304, 0.12150162, 0.1648268, 0.16764192, 0.12872693, 0.062061496, -0.011851715, -0.073016055, -0.10971205, -0.12645271, -0.13470021, -0.1344252, -0.12831342, -0.110377654, -0.07651252, -0.03527586, 0.00915357, 0.042307995, 0.057567716, 0.06013633, 0.055391423, 0.052926134, 0.054541904, 0.059694994, 0.062254574, 0.054104466, 0.03316653, 0.00012176552, -0.038759973, -0.07414459, -0.09926919, -0.11463533, -0.113635615, -0.09794429, -0.078654155, -0.05164952, -0.019785184, 0.017150579, 0.06058017, 0.09789651, 0.12205331, 0.12361418, 0.09910636, 0.061941557, 0.023286365, -0.012542695, -0.036099702, -0.0446462, -0.049207196, -0.050683353, -0.050679427, -0.05585818, -0.06228456, -0.06631564, -0.06760448, -0.06536264, -0.06025634, -0.05462764, -0.04852195, -0.03927058, -0.025813377, -0.011006349, 0.0034653842, 0.01720708, 0.026891876, 0.03659106, 0.048096456, 0.05847312, 0.06911994, 0.07439206, 0.07057381, 0.060056884, 0.048851363, 0.04575897, 0.05252312, 0.06475426, 0.07192428, 0.06893855, 0.06065729, 0.051330812, 0.048941113, 0.06063932, 0.07943797, 0.09220213, 0.09001129, 0.064936996, 0.021519031, -0.025178816, -0.06798585, -0.09978539, -0.116001904, -0.119597845, -0.10963061, -0.08741469, -0.058175296, -0.024612606, 0.0082875, 0.032160483, 0.041169506, 0.039293647, 0.03033618, 0.01594057, 0.004173126, -0.0064098397, -0.015962206, -0.01922938, -0.019669887, -0.014258536, -0.00459716, 0.0018650042, 0.0013597715, -0.0113063315, -0.031412054, -0.054099537, -0.07332085, -0.08072825, -0.07981543, -0.07161572, -0.05799919, -0.044201743, -0.031825505, -0.022434648, -0.010318637, 0.0048084343, 0.019663248, 0.032613304, 0.03232382, 0.01889232, -0.0043924106, -0.036355365, -0.062137317, -0.07305324, -0.06626565, -0.043729894, -0.0149556175, 0.01273078, 0.034210544, 0.05052838, 0.062427983, 0.070442766, 0.07645549, 0.07643662, 0.06689275, 0.04850145, 0.02630364, 0.007918827, -0.000659115, 0.0018590506, 0.011554396, 0.023677668, 0.029793153, 0.025305327, 0.01530808, 0.0040490744, 0.0006140843, 0.008267371, 0.019985758, 0.037339922, 0.05510001, 0.06444371, 0.06445088, 0.054603357, 0.038052138, 0.018867914, 0.0046247155, -0.0017502416, 0.00013404402, 0.01272876, 0.02782919, 0.03943844, 0.043383714, 0.037503093, 0.02835222, 0.016873565, 0.0040722, -0.0040547317, -0.008184196, -0.0098247165, -0.0058183917, 0.0018069906, 0.010779065, 0.019237312, 0.022238558, 0.019498736, 0.011957325, 0.0007840386, -0.0126330685, -0.02485609, -0.033296674, -0.0376646, -0.035747968, -0.030692225, -0.021721711, -0.008412632, 0.0045866044, 0.017177178, 0.02303733, 0.018309675, 0.0054692025, -0.016384333, -0.04584153, -0.07685131, -0.10272591, -0.11809923, -0.1182499, -0.1061649, -0.08630057, -0.062526606, -0.043261133, -0.029217526, -0.019089408, -0.01325938, -0.009450149, -0.0083285635, -0.013099413, -0.024454953, -0.03763408, -0.04847464, -0.053323384, -0.05017221, -0.041713458, -0.030734297, -0.02246002, -0.020761307, -0.020937884, -0.016096188, -0.005751469, 0.008859485, 0.024532344, 0.036747165, 0.04611301, 0.050321884, 0.04980558, 0.047869034, 0.041531175, 0.031058442, 0.018168954, 0.0034404604, -0.008966023, -0.018656028, -0.028692413, -0.03912754, -0.053792514, -0.069771476, -0.077126056, -0.07558675, -0.062313937, -0.03921527, -0.013808599, 0.011733523, 0.033452686, 0.055162616, 0.07711052, 0.09129292, 0.09414094, 0.08148665, 0.05243321, 0.013629721, -0.021690093, -0.042864114, -0.04503181, -0.02582124, 0.0066589573, 0.04042495, 0.067824855, 0.08213179, 0.08163796, 0.06974469, 0.051287185, 0.031116877, 0.012000291, -0.0013407819, -0.006652337, -0.0058035795, 0.0020176119, 0.015072335, 0.029267132, 0.041865926, 0.05101447, 0.05515963, 0.05358088, 0.046932768, 0.0351598, 0.02018685, 0.004544914, -0.010074329, -0.021445598, -0.028005917, -0.02878485, -0.022802653, -0.01075562, 0.005929406, 0.028226474, 0.04935235, 0.05894697, 0.053403575, 0.030399607, -0.0055433162, -0.044899028, -0.07825568, -0.097855546, -0.10330635, -0.09682926, -0.081571065, -0.060001936, -0.03288932, -0.002953821, 0.026636677, 0.050865136, 0.06665415, 0.073659286, 0.069201134, 0.053722188, 0.029092846, -0.0019349289, -0.035548415, -0.06783268, -0.08926667, -0.09548343, -0.08785136, -0.0702, -0.052305862, -0.039329525, -0.031171298, -0.027730975, -0.0282571, -0.027607594, -0.023749663, -0.019313818, -0.014539828, -0.011625187, -0.007137499, 0.003502531, 0.020958358, 0.04423873, 0.06632802, 0.08127809, 0.083369106, 0.071687035, 0.050967194, 0.027724054, 0.007875187, -0.010494666, -0.027901834, -0.046232697, -0.06483601, -0.07519836, -0.07347381, -0.05823702, -0.03396764, -0.0092242025, 0.009609525, 0.018439258, 0.019276181, 0.01629321, 0.013290775, 0.009768112, 0.0044395914, -0.0011756903, -0.00847602, -0.016618494, -0.021453004, -0.021480171, -0.016904695, -0.006547781, 0.007407009, 0.020171592, 0.029730074, 0.03353739, 0.032734662, 0.030261517, 0.025955645, 0.022341132, 0.020472452, 0.017009243, 0.012058823, 0.0067601646, -0.00058446475, -0.008392596, -0.015911348, -0.021901328, -0.022378849, -0.018894767, -0.013801385, -0.008481166, -0.003754106, -0.00087694754, -0.0003820668, 0.0017970608, 0.0069354954, 0.014084404, 0.020997943, 0.024117328, 0.01969597, 0.006699466, -0.010982996, -0.030797102, -0.04846018, -0.059953183, -0.062074363, -0.055962533, -0.047706403, -0.036911797, -0.024696914, -0.010482072, 0.0071540256, 0.025452256, 0.042589847, 0.05160057, 0.05065176, 0.040809795, 0.023970217, 0.0074219136, -0.008123687, -0.022614043, -0.03683058, -0.052882474, -0.06947937, -0.08397488, -0.09171313, -0.09101323, -0.081268266, -0.06596013, -0.050544508, -0.03703317, -0.027857037, -0.021426031, -0.017196001, -0.014236719, -0.009040521, -0.0028189153, 0.004379899, 0.0119889835, 0.017426824, 0.020425187, 0.021250354, 0.020599628, 0.019809945, 0.020043973, 0.019176265, 0.0151257375, 0.00884038, -0.00039993954, -0.010060255, -0.01497335, -0.01400374, -0.006184268, 0.006984517, 0.0222975, 0.037264884, 0.04674679, 0.0487647, 0.043034982, 0.030248772, 0.014360212, -0.0027976257, -0.017587446, -0.025924342, -0.02856765, -0.026971845, -0.021076879, -0.012211387, -0.0017630368, 0.0117901545, 0.02584398, 0.036973093, 0.045448843, 0.048670977, 0.045589853, 0.038176723, 0.028698128, 0.0206522, 0.01602757, 0.014039977, 0.013388578, 0.013995738, 0.015995938, 0.020052744, 0.026251998, 0.031485107, 0.029667346, 0.016769024, -0.006159334, -0.034360096, -0.05648201, -0.06303044, -0.052610677, -0.027314732, 0.0044970275, 0.034310695, 0.057007324, 0.069773555, 0.074348405, 0.07162923, 0.061558034, 0.044058226, 0.021911493, 0.0013526296, -0.013810192, -0.020780275, -0.020286007, -0.017120028, -0.016149335, -0.020251403, -0.028761225, -0.039589465, -0.048338424, -0.053400606, -0.056516644, -0.05601073, -0.05368133, -0.052668884, -0.050770998, -0.0479329, -0.043675426, -0.034507602, -0.020460576, -0.0024780182, 0.016601615, 0.032015834, 0.0399195, 0.03697734, 0.024757743, 0.00668824, -0.010446484, -0.020077402, -0.022162855, -0.015974194, -0.005212896, 0.0049305046, 0.01175419, 0.014472441, 0.01672281, 0.018070934, 0.018967, 0.018543446, 0.012383491, 0.0021435323, -0.009602701, -0.020115968, -0.026844984, -0.029185727, -0.026689151, -0.019449173, -0.008543995, 0.0035455413, 0.015266217, 0.024534866, 0.02919501, 0.02860064, 0.023683159, 0.017398866, 0.010168815, 0.00071157754, -0.010239377, -0.020811947, -0.02812008, -0.029557873, -0.023852529, -0.012537664, -0.0018052144, 0.0029665928, -0.0010481187, -0.01269841, -0.024475338, -0.030990232, -0.029088905, -0.0192909, -0.00627177, 0.008398055, 0.021212168, 0.03080835, 0.039103266, 0.0445066, 0.04476635, 0.03688273, 0.021571038, 0.002716376, -0.015499009, -0.026776275, -0.027786704, -0.020064354, -0.008321429, 0.001948015, 0.0042793946, -0.0041232244, -0.020116676, -0.041304022, -0.06264372, -0.079094626, -0.08814639, -0.08739316, -0.07654473, -0.056260005, -0.031754382, -0.0070352484, 0.016594889, 0.03534085, 0.04856251, 0.057492312, 0.062054634, 0.058789488, 0.04665201, 0.02875718, 0.006692787, -0.013417932, -0.024777671, -0.026280705, -0.02035844, -0.010348804, 0.00080738054, 0.0097720595, 0.015325715, 0.018022923, 0.018332649, 0.016066207, 0.011642056, 0.005853337, -0.0009785088, -0.008909793, -0.01722218, -0.022947771, -0.025291666, -0.0221442, -0.013232715, -0.0030308361, 0.007220206, 0.015348188, 0.020920446, 0.025307572, 0.029341912, 0.03446363, 0.037742663, 0.036256224, 0.028094402, 0.01457846, 0.00085341866, -0.008320343, -0.009413973, -0.0043822764, 0.0028998752, 0.008168899, 0.0074526384, 0.001145444, -0.0076958477, -0.01608751, -0.022138115, -0.025291817, -0.026509978, -0.024817942, -0.02041314, -0.012624365, 0.00062611984, 0.015835926, 0.03125676, 0.0431379, 0.04661299, 0.042097658, 0.03033797, 0.01541972, -0.00013150512, -0.013650838, -0.022298736, -0.027431525, -0.027430365, -0.023589471, -0.018377481, -0.01253109, -0.0091573065, -0.00812106, -0.0073903706, -0.0041537513, 0.0036527354, 0.014608456, 0.027353683, 0.03952456, 0.04804021, 0.05281634, 0.054859295, 0.0544707, 0.050050907, 0.03884111, 0.022038685, 0.0017423909, -0.019976255, -0.03890283, -0.052103568, -0.05809114, -0.057765983, -0.051913053, -0.04178653, -0.029455932, -0.01477694, 0.00029016743, 0.015386851, 0.030685702, 0.042750876, 0.04973037, 0.050318338, 0.042640716, 0.027537627, 0.009657994, -0.006002009, -0.01604171, -0.020857746, -0.023081569, -0.025011772, -0.029886106, -0.03526756, -0.037331987, -0.03470092, -0.0253571, -0.011805595, 0.0016145601, 0.011139972, 0.0148588475, 0.012766646, 0.0068389936, -0.0012344848, -0.013154084, -0.02606371, -0.039569106, -0.053535346, -0.061224785, -0.060962774, -0.051070582, -0.032303564, -0.011776228, 0.0051863943, 0.015659386, 0.019970283, 0.018030988, 0.012891475, 0.008156831, 0.0029229354, 0.0006841348, 0.0036539752, 0.011575, 0.024430359, 0.038184993, 0.048970938, 0.052075174, 0.045949664, 0.035294347, 0.022998426, 0.011246585, 0.0020517858, -0.0054327752, -0.012310983, -0.018362742, -0.021620007, -0.019346133, -0.011859091, -0.0034143361, 0.0036298533, 0.008752224, 0.010167753, 0.009743931, 0.009852982, 0.009652005, 0.008418131, 0.004551803, -0.0033478704, -0.014991264, -0.027241472, -0.036388136, -0.039657556, -0.034951016, -0.024266334, -0.009616908, 0.005230899, 0.01570106, 0.021774128, 0.023578407, 0.022646902, 0.019944951, 0.015692497, 0.010234282, 0.0016183206, -0.0098283095, -0.022817755, -0.035455182, -0.0430694, -0.0435164, -0.03802887, -0.026400963, -0.011959307, 0.00027455855, 0.010889652, 0.018308567, 0.020831436, 0.02025907, 0.017360661, 0.011752668, 0.0029820255, -0.0061494703, -0.011070857, -0.00792595, 0.0033831252, 0.017855117, 0.029034922, 0.03160288, 0.022909522, 0.0052261413, -0.01408547, -0.029971847, -0.03881832, -0.039038073, -0.034305345, -0.02599001, -0.015751727, -0.006241688, 0.0017585647, 0.0067252293, 0.008603293, 0.008951965, 0.010702904, 0.0163966, 0.025817199, 0.037781015, 0.04929143, 0.055829935, 0.055983845, 0.051258188, 0.041330438, 0.026710393, 0.009408449, -0.010733217, -0.030414173, -0.045799237, -0.054608777, -0.05230435, -0.03951601, -0.018967114, 0.0045527476, 0.023908775, 0.036785554, 0.042057183, 0.042108677, 0.039233245, 0.034050215, 0.028639665, 0.02241326, 0.015676988, 0.010190608, 0.008631956, 0.011470255, 0.01720455, 0.024661882, 0.029806677, 0.029568946, 0.023531472, 0.014999181, 0.007891493, 0.0047188397, 0.007129171, 0.013533442, 0.022087652, 0.029650189, 0.034237552, 0.03488399, 0.031229634, 0.025246514, 0.016744003, 0.00771598, -0.0014742614, -0.0121466005, -0.021789381, -0.029877469, -0.033158638, -0.029651687, -0.022024363, -0.0109755825, -0.0015685784, 0.0017662774, 0.00044626603, -0.0041114497, -0.008672371, -0.0104059875, -0.009569133, -0.007019453, -0.0043502627, -0.003466387, -0.00503948, -0.0076022344, -0.009642029, -0.011117457, -0.010272647, -0.0066237818, -0.00090347364, 0.00805526, 0.017389653, 0.024014987, 0.026681509, 0.02494026, 0.020814968, 0.014839244, 0.008598231, 0.0026505808, -0.0022316142, -0.0056806505, -0.009234948, -0.010777487, -0.0097652795, -0.0056967726, -0.00015731201, 0.004513134, 0.00657132, 0.0011253628, -0.009907397, -0.023047505, -0.035212547, -0.041960683, -0.04171174, -0.036082547, -0.028678115, -0.018724922, -0.0071418188, 0.0053383918, 0.01947435, 0.032076836, 0.04028115, 0.04095664, 0.032595523, 0.017254144, 0.0011117677, -0.011666669, -0.01853526, -0.016105559, -0.008173239, 0.001768357, 0.011965849, 0.02000646, 0.024886644, 0.02613548, 0.02562976, 0.0219871, 0.015040084, 0.0073221168, -0.0020834815, -0.0109233195, -0.015546122, -0.015555295, -0.009969946, 0.00018490556, 0.008399461, 0.010443797, 0.0066221124, -0.0024838804, -0.012686214, -0.019977102, -0.022816945, -0.020067655, -0.013967059, -0.0064922245, 0.000614235, 0.0064339787, 0.011357949, 0.014211395, 0.016092509, 0.017035715, 0.017129274, 0.018802473, 0.021618871, 0.023919052, 0.024790058, 0.024189886, 0.020952176, 0.015978178, 0.0114082545, 0.006220143, 0.0016952914, -0.0018155451, -0.0053239902, -0.007890586, -0.009508739, -0.008578529, -0.0049947975, -0.0011921336, 0.0020396821, 0.0014425725, -0.0044370065, -0.011406729, -0.016680505, -0.017170569, -0.0118468935, -0.0046980865, 0.00037259326, 0.00052872626, -0.003506761, -0.008723975, -0.011673549, -0.010163385, -0.004783715, 0.001300204, 0.0038007519, 0.0042646015, 0.004188185, 0.0050581805, 0.011162574, 0.021432918, 0.034652054, 0.048191164, 0.058346022, 0.06427382, 0.06298639, 0.054879002, 0.041158494, 0.021122063, -0.00078770367, -0.020403046, -0.035125457, -0.041020025, -0.037594512, -0.026272424, -0.009075591, 0.010033187, 0.02569772, 0.03214763, 0.028588811, 0.016199216, -0.0024415408, -0.019671699, -0.030430654, -0.032586653, -0.026373258, -0.014747074, 2.3394097e-05, 0.014335788, 0.024930244, 0.030913312, 0.033521492, 0.0327668, 0.02921138, 0.025540601, 0.021080572, 0.016639194, 0.012976277, 0.009640556, 0.007529064, 0.0062829433, 0.007007231, 0.008320785, 0.010020041, 0.01344357, 0.016052088, 0.01728797, 0.017384002, 0.017283, 0.01645572, 0.014530771, 0.01188061, 0.0045091943, -0.007197249, -0.021404045, -0.035598993, -0.042164754, -0.039446913, -0.02903777, -0.012527434, 0.002968448, 0.013538266, 0.019606307, 0.020760225, 0.021096757, 0.022159198, 0.020549841, 0.015818253, 0.007867502, -0.0017021709, -0.00898657, -0.010683149, -0.0059954943, 0.0026093584, 0.010784605, 0.015544947, 0.016852213, 0.014409364, 0.01067822, 0.006927991, 0.0023425876, -0.0018732321, -0.007484202, -0.013626799, -0.018334022, -0.021645837, -0.021746803, -0.019220294, -0.015776876, -0.0131256515, -0.013220243, -0.015946679, -0.019552564, -0.022878954, -0.024883099, -0.02310149, -0.016787989, -0.0075439187, 0.0025596644, 0.011505477, 0.016555442, 0.015443537, 0.008802061, -0.001113158, -0.011621697, -0.019489847, -0.022214714, -0.020214954, -0.014359425, -0.0054327045, 0.005115011, 0.017051512, 0.027900042, 0.035583634, 0.039858818, 0.038605463, 0.032454845, 0.023500558, 0.013364493, 0.0047069006, -0.0012724961, -0.0030827392, -0.00090144825, 0.0025693101, 0.0058082044, 0.0062829857, 0.0023414907, -0.0045833546, -0.012357165, -0.017467825, -0.017383035, -0.014109878, -0.010310338, -0.006642487, -0.004256332, -0.00270637, 0.0017996994, 0.010541189, 0.020740766, 0.030029587, 0.035678282, 0.035974078, 0.032302335, 0.02775725, 0.02515451, 0.023068301, 0.020915417, 0.017103596, 0.009047536, 0.0008282844, -0.006843027, -0.01279769, -0.013515529, -0.011834019, -0.009051013, -0.0056752176, -0.002397166, 0.0012277967, 0.0058947275, 0.01316252, 0.02113652, 0.026941536, 0.02860116, 0.025397649, 0.017896919, 0.0072744307, -0.0035359967, -0.013555627, -0.022011153, -0.027632307, -0.03048908, -0.030039242, -0.027699184, -0.024918858, -0.02137358, -0.01689371, -0.0107697565, -0.0027250312, 0.007977099, 0.02031682, 0.031006925, 0.03908535, 0.04339976, 0.0434286, 0.041428626, 0.038084466, 0.03351452, 0.028196258, 0.021431394, 0.01439099, 0.008916081, 0.004619523, 0.0019782854, 0.002140282, 0.0038471287, 0.0061911196, 0.008667701, 0.008501299, 0.0061889705, 0.003933397, 0.0023406304, 0.004625656, 0.0122157205, 0.023070093, 0.03352693, 0.040741492, 0.043576505, 0.041577496, 0.0388313, 0.03674703, 0.033867184, 0.030193942, 0.022894235, 0.011019587, -0.0028383036, -0.01402425, -0.018643461, -0.015275927, -0.005358641, 0.00651176, 0.018226601, 0.027062494, 0.030375227, 0.030269269, 0.028656807, 0.025170468, 0.019383268, 0.012502029, 0.0047345003, -0.0029461873, -0.0069891233, -0.0070493305, -0.004586437, -0.001297841, -0.0010690197, -0.0058018053, -0.014263224, -0.024382735, -0.033219136, -0.037930038, -0.037430026, -0.03275027, -0.024641152, -0.014329904, -0.005180589, 0.0013802148, 0.0047597457, 0.003594724, 9.189727e-05, -0.0026970096, -0.0031051638, 0.0011600871, 0.009264272, 0.018454034, 0.02718903, 0.034822766, 0.04104381, 0.043876085, 0.043283354, 0.038782474, 0.028892662, 0.016792838, 0.004459538, -0.006777702, -0.013519755, -0.015600301, -0.014555157, -0.011573382, -0.009672867, -0.0107048405, -0.0135642225, -0.017853111, -0.022087267, -0.023127476, -0.019865137, -0.014161404, -0.00803848, -0.0031014655, -0.002664537, -0.006008536, -0.009087293, -0.010597602, -0.008592215, -0.001907637, 0.0055528833, 0.010025616, 0.011508683, 0.010745991, 0.009655727, 0.011001641, 0.014465016, 0.017977582, 0.021145554, 0.022394162, 0.020286331, 0.017539483, 0.015405935, 0.014469781, 0.015208117, 0.014133643, 0.010128329, 0.005106795, 0.00016503288, -0.0024535994, -0.00037053853, 0.004596733, 0.008823498, 0.0104745105, 0.007773422, 0.0018230798, -0.0029595585, -0.004717139, -0.0037510279, 0.00045887276, 0.0064182784, 0.011827658, 0.016405718, 0.019142494, 0.019578211, 0.017293736, 0.012365088, 0.007974937, 0.0067327367, 0.010037235, 0.017592037, 0.026608659, 0.033441316, 0.0352861, 0.03270482, 0.027261056, 0.019500943, 0.010429971, 0.002334743, -0.003581556, -0.008327034, -0.01024071, -0.007987383, -0.0020412887, 0.007612992, 0.016883943, 0.022062844, 0.021381292, 0.013752311, 0.0014520808, -0.012349494, -0.022815548, -0.027068753, -0.025715647, -0.020442413, -0.013649055, -0.0068481863, -0.0015120815, 0.0025894605, 0.0061724484, 0.010595093, 0.014972407, 0.015733002, 0.013542721, 0.007861209, -0.0007315486, -0.0073670074, -0.010429128, -0.009181011, -0.0028279189, 0.0055710124, 0.012607921, 0.017769003, 0.020734316, 0.02141102, 0.021114344, 0.020833524, 0.019491455, 0.016338361, 0.010764851, 0.0030605185, -0.0032398994, -0.0069648894, -0.006820398, -0.003996884, -0.0024438612, -0.0017328989, -0.0029556495, -0.0053000627, -0.0070229964, -0.008232405, -0.008028155, -0.007190013, -0.0061122947, -0.00528838, -0.0037898698, -0.0018206111, -0.00021746401, 0.0016544677, 0.0024879, 0.0035225006, 0.006015641, 0.010555247, 0.017024707, 0.0236447, 0.029613255, 0.03411034, 0.038478337, 0.04162806, 0.04277808, 0.042975955, 0.03890582, 0.030459736, 0.019149635, 0.004953101, -0.0083069885, -0.016996767, -0.021513889, -0.022040404, -0.01895821, -0.01557786, -0.012960853, -0.009468514, -0.003648935, 0.0043848436, 0.014008086, 0.024636518, 0.03228385, 0.034884937, 0.03270076, 0.02632528, 0.01876648, 0.012091585, 0.006778805, 0.001298239, -0.0042949147, -0.0098445825, -0.015223952, -0.016569292, -0.014350659, -0.0091953175, -0.0011548623, 0.0057439283, 0.009829933, 0.009901517, 0.0061267694, 0.00030177968, -0.0060605113, -0.010153211, -0.012049086, -0.01332209, -0.0138672935, -0.015644507, -0.019022824, -0.020985195, -0.022148743, -0.022725139, -0.02321046, -0.026699629, -0.032336164, -0.038488608, -0.0430941, -0.044186037, -0.040992655, -0.03322132, -0.023282224, -0.012103761, -0.00067695003, 0.008436827, 0.013809278, 0.014486254, 0.010384906, 0.0034513017, -0.0038477995, -0.010744322, -0.0152079, -0.01709801, -0.018301232, -0.018573737, -0.01931941, -0.020339742, -0.020097885, -0.01981745, -0.018927224, -0.016645148, -0.014652468, -0.011631842, -0.005830247, 0.00112371, 0.009329496, 0.01791678, 0.023006823, 0.021955624, 0.014984959, 0.0044963877, -0.007021916, -0.015592623, -0.018333096, -0.01620352, -0.01177642, -0.0073984405, -0.0041684415, -0.0022498735, 0.0012104657, 0.0073850593, 0.014699069, 0.022989128, 0.028768273, 0.02982816, 0.02777882, 0.023680521, 0.01982263, 0.01831487, 0.01967524, 0.023103029, 0.028045265, 0.033014193, 0.036557276, 0.039195642, 0.039613713, 0.037537344, 0.03333502, 0.026777644, 0.017175194, 0.004454749, -0.007093994, -0.0155027965, -0.018539473, -0.014376784, -0.0066704503, 0.0023329437, 0.010312974, 0.01580036, 0.0187867, 0.020385388, 0.023032125, 0.025480656, 0.026346346, 0.02496336, 0.019892473, 0.011495615, 0.0010287621, -0.011256027, -0.022594525, -0.029339802, -0.031974472, -0.029289916, -0.021215161, -0.010610011, 0.0010124457, 0.010299917, 0.015599126, 0.017191134, 0.015258449, 0.011058829, 0.006499428, 0.002913297, -0.0013573898, -0.0050327796, -0.00692072, -0.008853435, -0.008889137, -0.007698042, -0.0069916407, -0.007720073, -0.012337252, -0.019450562, -0.02730237, -0.03201802, -0.030931724, -0.026645543, -0.020527234, -0.015186149, -0.013794581, -0.016114026, -0.01877892, -0.020297648, -0.01971019, -0.016389733, -0.014523066, -0.014479365, -0.015783036, -0.018743569, -0.01957239, -0.017104074, -0.012592439, -0.0066937716, -0.00027056044, 0.004695937, 0.008650846, 0.011831039, 0.012888181, 0.013216544, 0.012275621, 0.00938701, 0.004085416, -0.003463074, -0.01100489, -0.017294168, -0.019460289, -0.016949622, -0.011336848, -0.004203041, 0.0012542884, 0.003953109, 0.0035598471, 0.0005206909, -0.002986272, -0.005650654, -0.0068743723, -0.0062386817, -0.0043335315, -0.0016111874, 0.0012004585, 0.0021482077, 0.0025453563, 0.0036051504, 0.0043897466, 0.0060963086, 0.00785067, 0.009116881, 0.01044706, 0.0106810015, 0.011988765, 0.014993262, 0.0181402, 0.022041038, 0.026032448, 0.029077109, 0.02988596, 0.028771183, 0.026048958, 0.020494716, 0.014658961, 0.009860627, 0.005787481, 0.001724424, -0.004655967, -0.012797667, -0.02216576, -0.030025613, -0.03251986, -0.028839096, -0.01890786, -0.0075571327, 0.0013571616, 0.008480298, 0.012827364, 0.01561377, 0.018860955, 0.020721871, 0.020496571, 0.017222742, 0.007648545, -0.0044964375, -0.014454771, -0.02206302, -0.02514324, -0.024637032, -0.022512324, -0.019442445, -0.017245963, -0.015276536, -0.012703447, -0.009065814, -0.0048549213, -0.0017357736, -0.0012752754, -0.003940475, -0.007848413, -0.011930331, -0.014788993, -0.015425541, -0.014788509, -0.013854477, -0.01405945, -0.016159786, -0.019963318, -0.023861812, -0.026900351, -0.029005378, -0.028764082, -0.027168063, -0.024999825, -0.02194635, -0.020058505, -0.019516084, -0.019882994, -0.020137036, -0.018087642, -0.015130313, -0.011377163, -0.0064706155, -0.0025135062, 0.0005831282, 0.0034189348, 0.0059635444, 0.0075746994, 0.00889374, 0.010609838, 0.010632555, 0.009120448, 0.006919282, 0.003646871, 6.202753e-05, -0.0019902957, -0.00093403197, 0.0018815413, 0.006019249, 0.011144639, 0.012993339, 0.011886987, 0.0110174315, 0.00999973, 0.011277381, 0.015426179, 0.018627508, 0.019794218, 0.018060364, 0.013074783, 0.0077320505, 0.005155244, 0.0055727097, 0.00867615, 0.01297961, 0.014836186, 0.014592222, 0.014958343, 0.017463913, 0.022136023, 0.028487125, 0.035153925, 0.039346453, 0.04035758, 0.03758704, 0.03198476, 0.025674773, 0.01915869, 0.012653454, 0.004987139, -0.0031115937, -0.010369493, -0.015992822, -0.01781749, -0.015791127, -0.010425329, -0.0031998851, 0.0021815049, 0.005409064, 0.007673982, 0.007494786, 0.0060220766, 0.005328969, 0.0042822785, 0.0024854315, 0.00087077206, -0.0011083833, -0.0044880076, -0.008959057, -0.015070778, -0.020447377, -0.022495314, -0.022991605, -0.020729844, -0.0167948, -0.013840414, -0.011315323, -0.010360867, -0.009951331, -0.008684863, -0.0063525396, -0.0032804827, -0.00059146277, 0.0018693022, 0.002336752, 0.00097647123, -0.0010417032, -0.0046690386, -0.008951813, -0.0129890675, -0.017296791, -0.023615317, -0.03135946, -0.03942152, -0.047283657, -0.050933782, -0.048464384, -0.039576225, -0.02662673, -0.014130016, -0.0039725793, 0.0014530754, 0.0030389768, 0.003569744, 0.004559123, 0.0066333013, 0.00721522, 0.0042110044, -0.0015817632, -0.009556683, -0.019012416, -0.025637789, -0.028529357, -0.029168898, -0.0266516, -0.022286931, -0.016329922, -0.009666886, -0.0018495918, 0.008070109, 0.01620137, 0.020636134, 0.020860206, 0.016262457, 0.008565287, 0.0016580056, -0.0025649243, -0.0038365778, -0.0024446251, -0.00212693, -0.0033830104, -0.0059356987, -0.010382345, -0.014807877, -0.017972123, -0.018642386, -0.017057452, -0.013157718, -0.006797629, 0.00060288305, 0.0071624075, 0.011303675, 0.012881262, 0.012131646, 0.011543401, 0.011682045, 0.012471856, 0.014610668, 0.016646639, 0.019107074, 0.020622607, 0.021988673, 0.024382101, 0.024618465, 0.02315643, 0.019217309, 0.012213575, 0.0040906523, -0.003940862, -0.010355131, -0.01416205, -0.0135501465, -0.009796276, -0.0053051114, -0.000591399, 0.0029156606, 0.004969986, 0.0070170327, 0.010486997, 0.014534767, 0.018219855, 0.019590264, 0.016528083, 0.010124982, -0.000116052346, -0.011256446, -0.017493436, -0.018639028, -0.016180117, -0.011820435, -0.0077013113, -0.004950929, -0.0034578757, -0.0015697597, 0.0008870227, 0.0032767174, 0.0053423, 0.0055924254, 0.0037320524, 0.00033767283, -0.0032200324, -0.0050064945, -0.0052058445, -0.00406228, -0.003674929, -0.0053864676, -0.00766353, -0.010150727, -0.010530792, -0.008615584, -0.006704214, -0.0051162853, -0.005880008, -0.009587053, -0.014059262, -0.018295338, -0.021580976, -0.022785822, -0.022834811, -0.021421503, -0.018048465, -0.015477929, -0.013040026, -0.01127632, -0.011464798, -0.011574249, -0.012196501, -0.011372151, -0.008455681, -0.005667111, -0.0021590348, 0.0007921397, 0.0024685618, 0.0045936895, 0.00772493, 0.010745019, 0.012550903, 0.012796611, 0.0101176575, 0.005104187, -0.00054737926, -0.005967365, -0.008511816, -0.0066570323, -0.002008284, 0.0036182755, 0.008117838, 0.008944872, 0.006381847, 0.0027164845, -0.0006313682, -0.002375839, -0.0009941511, 0.0020235046, 0.0036708007, 0.004579532, 0.004160149, 0.0016757724, 0.00035836652, 0.000481676, -2.9460066e-06, -0.0019083247, -0.005656534, -0.011417373, -0.017659971, -0.021597793, -0.021375697, -0.016433977, -0.00837605, 0.0019290928, 0.011607341, 0.018305793, 0.023393547, 0.025885195, 0.027524954, 0.027861085, 0.024460353, 0.017868768, 0.0066134646, -0.0061891023, -0.017389406, -0.025491206, -0.02867929, -0.029104989, -0.027746528, -0.024529051, -0.019858034, -0.014639469, -0.008179773, -0.0010624724, 0.0043016714, 0.008211396, 0.009402567, 0.008177236, 0.0056769946, 0.0021880805, -0.0020482633, -0.007495477, -0.011026003, -0.013050094, -0.015206724, -0.015623524, -0.015785646, -0.017140293, -0.018906038, -0.020109463, -0.020285415, -0.018829083, -0.015737956, -0.012673159, -0.010237586, -0.008668082, -0.008348211, -0.0090657715, -0.009515219, -0.008127475, -0.005084482, -0.0024602537, -0.002552111, -0.0057037915, -0.011404987, -0.017707469, -0.022694208, -0.02486492, -0.023624646, -0.021823382, -0.020228364, -0.020595668, -0.02404236, -0.026798211, -0.028211566, -0.027300213, -0.022566631, -0.016529463, -0.011959974, -0.009009834, -0.0075401985, -0.0074508996, -0.0069949897, -0.006076649, -0.0035693937, -0.00021382108, 0.0016923817, 0.0025495642, 0.0010058107, -0.0010380717, -0.002146613, -0.003300024, -0.0033917737, -0.0035401154, -0.0046903896, -0.0054779644, -0.00374812, 0.000666913, 0.007276137, 0.014609616, 0.019596258, 0.020407924, 0.016061522, 0.0091611175, 0.0012076617, -0.006497339, -0.011403477, -0.013633202, -0.012739, -0.010838968, -0.008186091, -0.0043164445, -0.0015495532, 0.00073463237, 0.0017885835, 0.0020497288, 0.0032905599, 0.0048518847, 0.0068451855, 0.009431601, 0.011742574, 0.01290533, 0.013691034, 0.014404553, 0.014533096, 0.013867339, 0.011515678, 0.007337161, 0.0014543312, -0.0055718175, -0.01132199, -0.0141989235, -0.014140742, -0.010921695, -0.0068070944, -0.003913611, -0.002087874, -0.0017007161, -0.0008348148, 0.0022350424, 0.0066976766, 0.010929687, 0.013074576, 0.011283376, 0.0053380597, -0.0010505494, -0.006512949, -0.009162247, -0.006918967, -0.0038948895, -0.0018219673, -0.0015903669, -0.003981217, -0.007291022, -0.010617032, -0.012737744, -0.013142005, -0.0108196335, -0.0075421995, -0.0051977513, -0.0029254453, -0.0014051053, -1.6297956e-05, 0.00070148206, 0.0005249034, -0.0014441542, -0.007028443, -0.014280017, -0.021885041, -0.027712323, -0.031059187, -0.031213934, -0.027611323, -0.024256112, -0.021113882, -0.01787739, -0.015304039, -0.011972356, -0.008136718, -0.003994667, -0.00065683573, 0.0011274115, 0.0006279204, -0.003189537, -0.009533464, -0.017587721, -0.026334785, -0.03459891, -0.040280826, -0.043045748, -0.04300352, -0.038980834, -0.03327235, -0.026168432, -0.017614726, -0.009861016, -0.00276785, 0.0022816139, 0.0048712413, 0.0053464575, 0.0031162554, -0.0007919531, -0.0052171834, -0.0074808653, -0.006827808, -0.0034089924, 0.0013362273, 0.0030749443, 0.001491379, -0.0031755564, -0.009850507, -0.01538747, -0.018044846, -0.017217297, -0.014628527, -0.012148252, -0.012051887, -0.013838817, -0.014490717, -0.013546201, -0.010100363, -0.005101624, -0.0011699384, 0.0008516657, 0.000752951, 6.3872016e-05, 0.0005439212, 0.0019120462, 0.0040454627, 0.006968343, 0.008826939, 0.008608091, 0.0072440854, 0.0051266714, 0.0028160266, 0.0012727006, 0.0002492171, -0.0005402807, -0.0023692453, -0.006491846, -0.010020086, -0.0116977375, -0.012315522, -0.010102852, -0.0059262374, -0.002325202, 0.00019622558, 0.001131325, -2.8922766e-05, -0.0029389581, -0.0066933455, -0.01036737, -0.013117325, -0.014372129, -0.0141592305, -0.012992738, -0.0118059255, -0.010181676, -0.0077253547, -0.005773481, -0.0039936234, -0.0029008384, -0.0037647064, -0.005775601, -0.008853746, -0.012928173, -0.017097056, -0.019538574, -0.0208064, -0.021334875, -0.019487811, -0.017405553, -0.015927002, -0.015669499, -0.016675774, -0.016508656, -0.016072353, -0.01453068, -0.01167074, -0.010069319, -0.010900043, -0.013988827, -0.018105133, -0.022749536, -0.024737136, -0.022818323, -0.019298358, -0.015234211, -0.013973763, -0.015129277, -0.016213052, -0.017068533, -0.015183991, -0.01159228, -0.008431928, -0.0068656364, -0.008879105, -0.011711298, -0.014099544, -0.015897611, -0.015224066, -0.013196149, -0.009969035, -0.00674447, -0.0053779725, -0.0043964405, -0.0033696427, -0.0020548052, 3.2967273e-05, 0.0012802125, 0.00052820134, -0.0011732328, -0.0031965652, -0.0052957344, -0.0056813373, -0.0045210146, -0.0024284457, 0.00079143647, 0.003167247, 0.0045937747, 0.0046531064, 0.0029673919, 0.0017418303, 6.803889e-05, -0.0010719135, -0.0013848653, -0.0032613557, -0.0050436934, -0.00800786, -0.012276114, -0.015236412, -0.01734902, -0.016863698, -0.012896199, -0.007145657, -0.0007921987, 0.005580368, 0.011293483, 0.016744774, 0.022378914, 0.025770305, 0.027618214, 0.028088197, 0.025218941, 0.020227136, 0.012224399, 0.001984587, -0.0074357716, -0.014939741, -0.019030044, -0.019538144, -0.017077662, -0.0129103735, -0.009431216, -0.006814173, -0.0041816193, -0.0017508591, 0.0020451068, 0.0072725965, 0.010805372, 0.01148726, 0.008508205, 0.0033539555, -0.0012541291, -0.0044732047, -0.0046643903, -0.003462207, -0.0038672932, -0.007017313, -0.012260124, -0.017497785, -0.022539522, -0.026036562, -0.027145224, -0.026846679, -0.025495742, -0.0244693, -0.02378582, -0.02249436, -0.019943, -0.016206736, -0.013317097, -0.012595897, -0.014067694, -0.017010938, -0.019936968, -0.021358574, -0.021054689, -0.019915972, -0.018502202, -0.017892577, -0.01934044, -0.022381661, -0.02583267, -0.02938659, -0.03233534, -0.033886567, -0.03361904, -0.031109184, -0.027469244, -0.024638245, -0.023432909, -0.022546839, -0.021460379, -0.020472832, -0.018888237, -0.016585514, -0.014012891, -0.013365867, -0.013725037, -0.013589366, -0.014190138, -0.0134959705, -0.011994435, -0.010645773, -0.008215309, -0.0052140285, -0.0026320426, -0.0005741675, 0.0027374108, 0.0058265, 0.008796683, 0.012310525, 0.013571747, 0.012623375, 0.0078055845, 0.00021446813, -0.0070218807, -0.0128190005, -0.0138142295, -0.010635378, -0.005087853, 0.0010687354, 0.004647865, 0.0056172204, 0.00478362, 0.00417979, 0.005345887, 0.00770179, 0.010293412, 0.010963516, 0.0091778, 0.0062585725, 0.003931037, 0.0034225776, 0.004327004, 0.0068250676, 0.009908664, 0.012158958, 0.013151817, 0.012569591, 0.012824061, 0.014053662, 0.014538494, 0.013827016, 0.01022182, 0.0050429865, 0.00010954234, -0.0034833895, -0.0036313036, -0.001429253, 0.0014261323, 0.0043277973, 0.0061602276, 0.0058797915, 0.004224796, 0.002179658, -0.00037689545, -0.0025361045, -0.0041461173, -0.005027557, -0.005322777, -0.0052204165, -0.0045749564, -0.00532467, -0.0062641404, -0.0058939913, -0.004359755, -0.0019369259, -0.0009781203, -0.0010000442, -0.002485334, -0.0058199465, -0.008921135, -0.011476422, -0.012730736, -0.01288698, -0.011537549, -0.01085748, -0.013014652, -0.015191472, -0.01823335, -0.021163607, -0.021872912, -0.021512967, -0.018735101, -0.015007504, -0.012151337, -0.009664371, -0.008993346, -0.008399789, -0.0060989433, -0.0033076387, 0.00026505135, 0.0017921822, -0.00085848337, -0.006394802, -0.014910121, -0.022964409, -0.028053973, -0.030721681, -0.031205358, -0.031022597, -0.030078398, -0.028596284, -0.02632375, -0.022479817, -0.016812101, -0.009538806, -0.003650267, 4.967921e-05, 0.0015523593, 0.0012420543, 0.0009121016, 0.0013076944, 0.0030257103, 0.0047826967, 0.006068293, 0.005533264, 0.0030429554, 0.001364566, 0.00033161542, 0.000393511, 0.0008244296, 0.0006013323, -0.00010102949, -0.0021821333, -0.0045540254, -0.00651574, -0.007489381, -0.0069635264, -0.0053447178, -0.0032458203, -0.0004738064, 0.0037152837, 0.0072931154, 0.009088242, 0.010037026, 0.0109228, 0.011973071, 0.013176528, 0.0139561845, 0.013407132, 0.011552504, 0.008585478, 0.0062350053, 0.004965098, 0.0054414356, 0.007998724, 0.01046141, 0.013219336, 0.014220129, 0.011824964, 0.00753598, 0.0021564218, -0.0015042841, -0.0024288325, -0.0017919979, -0.000102532584, 0.0014910949, 0.00089122937, -0.0016907168, -0.004693712, -0.006812885, -0.0065627415, -0.0051012835, -0.0024544776, -0.0005635717, -0.001918504, -0.0037656901, -0.0055843424, -0.006646915, -0.005851699, -0.0047671422, -0.0044324375, -0.0063960515, -0.0108893, -0.016731115, -0.022359945, -0.026274098, -0.027887188, -0.027428525, -0.026016489, -0.023732975, -0.021231359, -0.018105337, -0.0128856795, -0.0076376577, -0.0033858828, -0.0005600883, -0.0011369644, -0.004854706, -0.010037676, -0.014448369, -0.01696212, -0.018499272, -0.019622277, -0.02006361, -0.02087269, -0.022710012, -0.023970846, -0.023737393, -0.02197214, -0.01977887, -0.017003912, -0.0130252475, -0.010297056, -0.009450761, -0.009592546, -0.010742163, -0.01262209, -0.01407569, -0.013947424, -0.01245179, -0.010531397, -0.009110563, -0.007903181, -0.00736771, -0.007996697, -0.008355954, -0.007293322, -0.0050662905, -0.0024358574, 0.00045289018, 0.0028409588, 0.0043583973, 0.0051340843, 0.006385254, 0.0095877815, 0.013840299, 0.017601416, 0.018955376, 0.018309357, 0.016013818, 0.011843376, 0.008429951, 0.007214913, 0.0084103085, 0.0102752205, 0.01003087, 0.0070951837, 0.0030176796, -0.0008886276, -0.0035319813, -0.0025959406, 0.0012582439, 0.0067193857, 0.012011952, 0.015777402, 0.018930418, 0.020679045, 0.022056753, 0.023506807, 0.024722384, 0.025539402, 0.024040285, 0.021035021, 0.016826339, 0.011986792, 0.008288341, 0.0052130735, 0.001769832, -0.0019977798, -0.0051402603, -0.00753183, -0.0077599413, -0.004897539, -0.00036177188, 0.0051002, 0.009926244, 0.012835833, 0.013319628, 0.011567932, 0.008941207, 0.006017611, 0.003245565, 0.001053997, -0.0003002538, -0.0011665453, -0.0021337813, -0.0031109836, -0.0042941077, -0.0052117845, -0.005627655, -0.0064997943, -0.007564812, -0.009135967, -0.012326916, -0.015883125, -0.01942543, -0.022450898, -0.02340458, -0.022568198, -0.019109242, -0.014000352, -0.0086254105, -0.004386787, -0.003922785, -0.00485075, -0.006687814, -0.008322617, -0.007817035, -0.007709977, -0.0067589567, -0.007083312, -0.010321146, -0.013234452, -0.015436547, -0.014905895, -0.011663826, -0.0069118575, -0.002333284, -0.0011976814, -0.0027023086, -0.0056478186, -0.008486713, -0.010013028, -0.01035429, -0.009588931, -0.009219544, -0.009720958, -0.011173403, -0.012962693, -0.014211398, -0.014739416, -0.013346019, -0.01070271, -0.008288889, -0.0058106324, -0.0024229377, 0.0017997391, 0.006824957, 0.012594752, 0.016843928, 0.018774811, 0.017740134, 0.0131078055, 0.008154644, 0.0039621233, -0.0004491275, -0.0031726877, -0.003268715, -0.0030865741, -0.0029276477, -0.0017158487, -0.00047267668, 0.0011905167, 0.0040349676, 0.0074710953, 0.010374425, 0.012484122, 0.013728384, 0.0136705395, 0.012649792, 0.010283503, 0.00820355, 0.007032982, 0.005919269, 0.004925004, 0.003311828, 0.002337475, 0.0018859498, 0.002165529, 0.0038997342, 0.006393604, 0.010156377, 0.013892754, 0.01697751, 0.018502949, 0.01673581, 0.012631025, 0.008638781, 0.0058817137, 0.0045388285, 0.006322922, 0.009513555, 0.011525351, 0.011697313, 0.009192709, 0.005765251, 0.0028798403, 0.0016631897, 0.002489783, 0.0033776106, 0.0032914684, 0.002069722, 0.0004914592, 0.00011585045, 0.0018325166, 0.005694505, 0.010670507, 0.014686786, 0.0155353295, 0.013735887, 0.010459267, 0.005097448, -0.00034236375, -0.0043718703, -0.0076040663, -0.0102801295, -0.013197108, -0.015246754, -0.016242072, -0.015641192, -0.012552243, -0.009270043, -0.006235526, -0.00410643, -0.0028911075, -0.0008820755, 0.0010731319, 0.0033567892, 0.0072519816, 0.01148669, 0.0138501115, 0.013617493, 0.011369427, 0.0077263894, 0.0031467024, -0.001701948, -0.0053919563, -0.007844748, -0.0100484295, -0.011631516, -0.012903045, -0.013801558, -0.01355264, -0.0120575335, -0.008074695, -0.0031062094, 0.0012923871, 0.0050392663, 0.0060326154, 0.005451867, 0.003863553, 0.0014482517, 0.00048005013, 0.0010607196, 0.0036180585, 0.007847599, 0.012711581, 0.015859244, 0.016698131, 0.016882788, 0.015239533, 0.014004307, 0.014818756, 0.015249637, 0.014475116, 0.01255179, 0.009837048, 0.006215988, 0.003552025, 0.004023311, 0.0070134276, 0.01061438, 0.012496044, 0.012240606, 0.009584838, 0.00625526, 0.005079794, 0.0050219977, 0.0059532123, 0.007309316, 0.007339758, 0.006251979, 0.003952924, 0.0016295686, 0.0007042652, 0.001708715, 0.0044166427, 0.0073769377, 0.009642199, 0.010982205, 0.012599284, 0.013796043, 0.014336281, 0.015265992, 0.014183785, 0.011146127, 0.0069288784, 0.0020088106, -0.0013283311, -0.0034499774, -0.0041242675, -0.0026719666, -0.00043098032, 0.0012243503, 0.002706658, 0.0037082664, 0.003110379, 0.0029588947, 0.0032047678, 0.0037461824, 0.005332432, 0.0057558436, 0.005013279, 0.0030569886, 0.00044285558, -0.0022697467, -0.0055944347, -0.0072864396, -0.0083058365, -0.00947187, -0.010438883, -0.012181522, -0.012626618, -0.012282701, -0.010677364, -0.0066767116, -0.002776121, 0.0023149967, 0.006761533, 0.0076884376, 0.0069344626, 0.003659678, -0.00093303755, -0.0046714237, -0.0072284923, -0.007579197, -0.006996424, -0.006526364, -0.006814612, -0.007758947, -0.0073221005, -0.0049458668, -0.00062313466, 0.0043017217, 0.007541909, 0.008388194, 0.0061769905, 0.0020744004, -0.0013141384, -0.0024878469, -0.0007189624, 0.0022838619, 0.004428656, 0.004195575, 0.001500421, -0.0018246555, -0.006665594, -0.011071939, -0.012765594, -0.014289852, -0.014886775, -0.0134644415, -0.010417366, -0.0052023274, 0.0021462922, 0.010430769, 0.018034909, 0.023563491, 0.025288047, 0.025104716, 0.023865072, 0.021674627, 0.020705363, 0.019351544, 0.017266054, 0.014553685, 0.01174928, 0.0086952895, 0.003488015, -0.0011325276, -0.0047627552, -0.0065117595, -0.005262532, -0.0032175765, 0.0002760093, 0.0038744796, 0.006927813, 0.009921699, 0.012829001, 0.016981473, 0.020571636, 0.022236269, 0.022504782, 0.02145097, 0.018279774, 0.013672243, 0.009741836, 0.0061806627, 0.0039125383, 0.0035072688, 0.0033771312, 0.0029851922, 0.0020327729, 0.0009265762, 0.00042240383, 0.0011520211, 0.0035211327, 0.007765681, 0.013067691, 0.016772164, 0.018051127, 0.016995702, 0.013803687, 0.010878359, 0.009388061, 0.009395174, 0.010591653, 0.010845378, 0.009653506, 0.007979359, 0.0066378554, 0.0066293017, 0.0077993083, 0.009580403, 0.010745251, 0.009285796, 0.0054319957, 0.00059106684, -0.004797289, -0.008749794, -0.009223622, -0.007617329, -0.0059190914, -0.003908495, -0.0016357442, 0.0003292079, 0.0032596826, 0.006194076, 0.0074960943, 0.0076768943, 0.00489244, 0.00036955826, -0.002776753, -0.005783394, -0.007264796, -0.0055616125, -0.0031653938, -9.5182724e-05, 0.003649356, 0.0057272892, 0.006630247, 0.006892241, 0.0059782434, 0.004533734, 0.0030680038, 0.0012519341, -0.0015498502, -0.004674065, -0.007762226, -0.010229823, -0.011480411, -0.011791116, -0.010228283, -0.007938789, -0.006250617, -0.0052981586, -0.0053791273, -0.005164411, -0.004794256, -0.0036317357, -7.97593e-05, 0.004885811, 0.009730293, 0.013016452, 0.0143651785, 0.013228978, 0.009710557, 0.0058605117, 0.0032570555, 0.0025408426, 0.0028403257, 0.0037869858, 0.0044556847, 0.004003829, 0.0036530418, 0.003494257, 0.00505902, 0.00864435, 0.012424994, 0.015663195, 0.016482733, 0.01496395, 0.011943265, 0.008756914, 0.0069963634, 0.0061133406, 0.006117034, 0.0051692068, 0.0030355144, 0.0011283678, -0.001031807, -0.0013765307, 0.0004961083, 0.0033602477, 0.006729443, 0.0087094465, 0.009660268, 0.0106797675, 0.011932498, 0.01321823, 0.014091997, 0.014781275, 0.013734654, 0.010570903, 0.006955636, 0.0036011038, 0.0016139017, 0.0013054475, 0.0015300205, 0.0011801561, 0.00026208005, -0.0010656784, -0.0030572251, -0.0054159113, -0.0071487525, -0.0066525172, -0.0038398616, 0.0003771484, 0.005026206, 0.0094953375, 0.012918436, 0.01412622, 0.014373719, 0.0136977825, 0.011783683, 0.009801575, 0.006843641, 0.001809049, -0.0048139915, -0.011367122, -0.01644361, -0.01975378, -0.02087251, -0.01825694, -0.0130923875, -0.00778878, -0.0020460393, 0.002495323, 0.0054775155, 0.007429824, 0.008398642, 0.010680436, 0.013284508, 0.015078563, 0.015403097, 0.013097585, 0.009579696, 0.005546431, 0.002626346, 0.0015456864, 0.00087202375, 0.00022312756, -0.0017429995, -0.0047580036, -0.007421057, -0.009342946, -0.008449792, -0.0048316037, -0.00082673295, 0.0026456912, 0.0044049197, 0.0033757163, 3.615072e-05, -0.0031367193, -0.0045741173, -0.0046858145, -0.0030508235, -0.0006189891, 0.0015047556, 0.004553974, 0.008102551, 0.011288282, 0.014432308, 0.01642185, 0.01640661, 0.013790665, 0.009557095, 0.0062326593, 0.003979993, 0.00333791, 0.0041825036, 0.005580939, 0.006987574, 0.007064295, 0.00608821, 0.0041846847, 0.0025253347, 0.001446279, 0.00070391066, 0.0016668431, 0.0020778365, 0.0018888242, 0.0015744345, -0.00015566735, -0.0013194287, -0.0019996534, -0.0020430386, -5.8592937e-05, 0.0031971356, 0.0059713167, 0.007852128, 0.009816187, 0.01017563, 0.009508796, 0.010115186, 0.010608439, 0.011018196, 0.011771376, 0.01074958, 0.007656965, 0.0038248464, -0.00025268714, -0.0029943725, -0.0032635906, -0.0015128338, 0.0018438827, 0.0054238522, 0.007598341, 0.008229452, 0.0081272265, 0.007580739, 0.0076435856, 0.009141695, 0.010751894, 0.010672798, 0.008460693, 0.005375919, 0.0016783191, -0.0008852319, -0.0014521886, -0.0022486404, -0.0024777814, -0.0034938687, -0.007199641, -0.0110468, -0.0140291, -0.015632443, -0.014574255, -0.012108067, -0.009268487, -0.0062350933, -0.005110996, -0.004748612, -0.0036217764, -0.003145193, -0.0030261998, -0.004366544, -0.007364292, -0.010587079, -0.013674731, -0.015283678, -0.014687212, -0.012457795, -0.009185348, -0.0060821925, -0.0047307424, -0.00442017, -0.0052602994, -0.0071870456, -0.008616143, -0.00938963, -0.008713195, -0.0074097025, -0.005927713, -0.005431461, -0.0063279574, -0.0066663832, -0.008110494, -0.009695294, -0.01097701, -0.012873249, -0.014652187, -0.016766809, -0.018370178, -0.019717563, -0.01933175, -0.016647005, -0.011753246, -0.0036720077, 0.0041551213, 0.01073265, 0.01614942, 0.018476412, 0.017813135, 0.015844569, 0.013888749, 0.012171465, 0.010878827, 0.009445647, 0.0064874394, 0.0009076972, -0.004995188, -0.009260007, -0.011645619, -0.01021846, -0.006644999, -0.003207702, 0.0003800997, 0.0030359274, 0.004296317, 0.0064088274, 0.009707574, 0.01264581, 0.015872145, 0.01721589, 0.015647968, 0.01328997, 0.009806099, 0.0069112275, 0.004630434, 0.0028172317, 0.003201706, 0.0023449224, 0.00042980193, -5.047437e-05, -0.00021767059, 0.0006385064, 0.0023146523, 0.003796992, 0.0040939506, 0.0033733514, 0.0030941197, 0.0028311764, 0.003182909, 0.0044610985, 0.0063751205, 0.008024164, 0.00841578, 0.008061375, 0.0063162125, 0.004168091, 0.002476854, 0.0014005343, 0.0024179579, 0.00454707, 0.0059711155, 0.0059148665, 0.004548756, 0.00244286, -0.00045721704, -0.0033443703, -0.0048919027, -0.005958582, -0.0072480184, -0.007921904, -0.0085153, -0.009620496, -0.011016751, -0.0112560075, -0.010241736, -0.008812065, -0.006594908, -0.004994183, -0.0043972195, -0.0059154998, -0.009620881, -0.012918568, -0.015067021, -0.014216316, -0.010671095, -0.00618068, -0.0017837601, 0.0008489732, 0.0015495614, 0.00070198695, 2.114256e-05, -0.00021144573, -0.00053213077, -0.001448209, -0.0041155745, -0.007868646, -0.0118802525, -0.014158517, -0.014644644, -0.01356174, -0.010409449, -0.008533822, -0.007863414, -0.007731706, -0.009540917, -0.01088662, -0.010729834, -0.009659245, -0.0073857615, -0.005001785, -0.0032527398, -0.0019979847, -0.0007418095, 0.00089002645, 0.0021982351, 0.0025993912, 0.0015147394, -0.00020290182, -0.0016960194, -0.0035496885, -0.0040713702, -0.002725999, -0.0006464902, 0.0018059693, 0.0038928473, 0.005216152, 0.0048893853, 0.003741355, 0.0025175242, 0.0009407556, 0.0006286197, 0.0012763083, 0.0018372338, 0.0017584608, 0.0002253826, -0.0021446133, -0.004257311, -0.0052652135, -0.0054684957, -0.004520716, -0.0022858712, -0.00020477148, 0.0017342898, 0.003076275, 0.0028847929, 0.0024135627, 0.0030186563, 0.0042405934, 0.00580122, 0.0074186497, 0.007877735, 0.0072478796, 0.005074284, 0.0017238385, -0.00091738836, -0.0025931888, -0.0026472195, -0.0016860829, -0.0014285352, -0.002403272, -0.0046820035, -0.007194276, -0.008567985, -0.0076503544, -0.004528202, -2.4049084e-06, 0.004573868, 0.00733552, 0.008505445, 0.008860736, 0.009176118, 0.009775195, 0.00935054, 0.007115603, 0.0028037536, -0.0033997842, -0.010370412, -0.01732517, -0.022574322, -0.024565158, -0.02447212, -0.022882767, -0.01993033, -0.016308526, -0.01252356, -0.009073306, -0.0048830197, -0.0010564659, 0.00035221377, 9.234047e-05, -0.000763779, -0.0018055274, -0.002909053, -0.002976158, -0.002468243, -0.002041814, -0.0016129903, -0.0024684407, -0.0048896405, -0.009109725, -0.012808646, -0.014863448, -0.016240243, -0.014445476, -0.011494778, -0.0097177075, -0.008079495, -0.008240211, -0.009641354, -0.010786266, -0.011628085, -0.011585061, -0.010853814, -0.009705996, -0.008464373, -0.0079105245, -0.007913422, -0.007779605, -0.007256268, -0.0056313644, -0.0027171148, 0.00018437047, 0.002239977, 0.003239269, 0.0024752275, 0.0005433392, -0.0008999249, -0.002097984, -0.0017734152, 0.0009959425, 0.0033316799, 0.004563084, 0.004454702};
-constexpr float kGuitar[4096] = {-0.3777877, 0.80586386, -0.6648116, 0.23154914, -0.33925247, -0.34952533, 0.5764742, -0.5951787, -0.3199016, -0.30678797, -0.61396384, -0.043084025, -0.3170675, -0.32634032, 0.53427124, 0.076425314, 0.18677723, 0.24268949, -0.17272806, 0.17188501, -0.18865478, 0.11568248, 0.36400104, -0.26010978, 0.29798067, 0.28404772, 0.36339402, 0.033635378, -0.42089295, 0.45321512, 0.11321783, -0.20707941, -0.07389307, 0.30525827, -0.11417508, 0.111411214, 0.36602676, -0.10403311, 0.19034612, 0.41881716, 0.14700735, -0.5046314, -0.066771865, 0.0022422075, 0.03308344, -0.3918718, -0.43739283, 0.33636522, 0.42031205, 0.23932278, 0.20878029, 0.6933459, -0.014806151, -0.68992686, -0.32776833, 0.5275283, -0.07735407, -0.36389792, 0.85288656, 0.17416, -0.023061752, -0.04178238, 0.014559984, 0.3269025, -0.38375068, -0.2325902, 0.25803292, -0.2779075, -0.3259729, -0.080426455, -0.44725585, -0.1642996, -0.31733167, 0.53894496, -0.13067758, -0.7758163, 0.49419284, -0.16247475, -0.513816, -0.38937318, 0.095523834, -0.057217002, -0.061012268, 0.17440009, -0.3209268, -0.4764619, 0.16356301, -0.19738019, -0.6227367, -0.31184626, -0.38666368, 0.006427169, -0.94218266, -0.3034097, 0.14292634, -0.093461156, 0.562727, 0.34974396, 0.21262181, -0.23175311, -0.19736421, -0.14356267, -0.09837842, -0.56063116, -0.6273072, 0.124385476, -0.09810758, -0.25252688, 0.012909055, -0.17409074, -0.72205174, -0.2231375, 0.3408438, -0.09120309, 0.4963591, -0.21054971, -0.42111313, 0.2739669, -0.56380844, -0.042323947, 0.0713135, 0.17507207, 0.044925928, -0.06179273, 0.08692372, 0.051585555, 0.29174995, 0.21514368, 0.31271362, 0.13291228, 0.44952583, -0.18515885, 0.013649464, 0.07622862, -0.1598531, 0.36783648, -0.0100233555, 0.100364685, 0.2315855, 0.4115262, 0.22833145, 0.2804457, 0.19196212, 0.020940065, 0.16817105, 0.1684432, 0.24247289, 0.17945743, 0.018715978, 0.07936227, 0.22717464, 0.089179635, 0.42803836, 0.27365005, 0.12605536, 0.20102906, -0.11227286, 0.22772753, 0.40176153, -0.13921082, 0.23781765, 0.7470292, 0.11243069, 0.39684904, 0.5722374, -0.16094589, 0.1694758, 0.0484941, 0.13024974, 0.4544828, 0.22703242, 0.12349081, 0.19747138, 0.31468284, -0.40612602, 0.36350834, 0.36872196, 0.02262783, 0.39817452, 0.32370102, 0.49345338, 0.16797662, 0.29409754, 0.1139338, 0.10654855, -0.015446901, 0.35114193, 0.37294626, 0.1132952, 0.26789904, 0.29175448, 0.1420399, -0.053011775, 0.43243206, 0.19508147, 0.47338796, 0.46651888, 0.3037665, 0.48119998, 0.30663514, 0.19621766, 0.29774916, 0.22309566, 0.18734479, 0.5727844, 0.009667873, 0.021899581, 0.27733493, -0.027151108, 0.0049854517, 0.303689, 0.328529, -0.019690037, 0.11826849, -0.072019815, -0.018778205, 0.22973895, -0.13214493, -0.0048240423, 0.10651255, -0.049327493, -0.06565821, 0.22354245, -0.03541231, -0.25123286, 0.022792816, -0.1759702, -0.10724485, -0.1866641, 0.011082649, 0.22294033, -0.078932524, 0.1266483, -0.06776333, -0.13323724, 0.18902159, 0.067923784, 0.18825316, -0.18758106, 0.03167343, 0.375453, 0.076910615, 0.10222268, -0.12855804, 0.16900492, 0.21234834, -0.08867109, -0.20927608, -0.22950757, -0.11264694, -0.25471008, -0.15233827, 0.035361648, 0.0671972, -0.14731884, -0.35820794, -0.072955966, -0.18132901, -0.027532458, -0.0601449, -0.212232, -0.003810525, -0.3686813, -0.11053538, -0.052247882, -0.1683141, -0.16903174, -0.23713803, -0.22817945, -0.20394266, -0.304281, -0.08573949, 0.07263851, -0.33395433, -0.19230461, -0.16049707, -0.12691689, -0.1666187, -0.092772126, -0.19725978, -0.2793014, 0.065407395, -0.09772849, -0.43587756, -0.24983335, -0.090444684, -0.093476176, 0.040236354, -0.17492366, -0.2639513, -0.059062123, -0.23046768, -0.3895079, -0.072689295, -0.16002703, -0.09240377, -0.085404634, -0.3392203, -0.3686092, -0.14148057, -0.045384645, -0.25461376, -0.16739845, -0.18617094, -0.11401355, -0.21835756, -0.21323586, 0.06299591, -0.24723387, -0.2995397, 0.0017940998, -0.1404767, -0.036534548, 0.043139577, -0.10294795, -0.20676947, -0.15651667, -0.2081182, -0.16700244, -0.2833699, -0.3860253, -0.0012179613, 0.023179173, 0.027882934, -0.06956935, 0.09647906, -0.024964094, 0.16823447, -0.032092094, -0.28559244, 0.053403378, -0.12784088, 0.22277081, -0.15661752, -0.010038853, 0.16321158, 0.042900085, 0.2440387, -0.32325578, -0.025951385, 0.23210418, 0.0152128935, 0.043629646, -0.061005235, -0.061591625, -0.07356048, 0.044784546, 0.015371561, -0.140216, 0.041186094, 0.012912154, 0.15291011, -0.013518691, -0.17276716, 0.038028836, -0.050920725, 0.020813704, -0.24578464, 0.018395305, 0.10910237, 0.0054980516, 0.22490191, -0.031616926, 0.109066844, 0.03349793, 0.19475865, 0.14213419, -0.04940164, 0.12011814, 0.051491022, 0.040399194, -0.008471131, 0.11242032, 0.13782263, 0.12329304, 0.06491709, 0.062213898, 0.07945514, 0.109651685, -0.039411902, 0.14061785, 0.14904487, -0.12728417, 0.1704216, 0.02805829, 0.029235482, 0.1088202, 0.13722634, 0.13361287, -0.15125275, -0.070961714, 0.12848115, 0.13394904, -0.052749157, -0.12665153, 0.15576756, 0.23053169, 0.041198015, 0.028848648, 0.05440879, -0.009484887, 0.14436746, 0.28937876, -0.09485364, 0.05206573, 0.17106998, -0.07625651, 0.14350307, 0.030394316, 0.03196454, 0.14118874, 0.032996178, 0.0767014, -0.0044623613, -0.037143707, -0.01802802, 0.01044035, 0.07690787, 0.071921825, 0.14001274, 0.12362301, 0.04253459, 0.12846887, 0.21300769, 0.13922262, 0.035418272, 0.052071214, -0.033020973, -0.08334744, 0.11938095, 0.017690659, 0.08965576, 0.11101198, -0.14570594, 0.112831116, 0.064501405, 0.06873095, 0.2938807, 0.080946684, 0.04461646, 0.10482037, 0.018198729, -0.017392516, -0.05006945, -0.052604675, 0.034427166, 0.06875312, -0.009869814, -0.07327199, 0.05474603, -0.03274119, 0.03326869, 0.15932035, -0.15121508, 0.08905959, 0.20660901, -0.08359468, -0.020235538, 0.0031819344, 0.003628254, 0.08636844, -0.054471254, 0.031399727, -0.002108574, -0.21183884, 0.032788873, 0.06787634, 0.04168594, 0.0037546158, 0.19917095, 0.19377947, 0.024330974, 0.08694947, -0.10009611, -0.13103306, -0.007123828, 0.009631872, -0.25185955, -0.097129226, -0.040571094, -0.16673732, -0.03554952, -0.049755216, 0.029108644, -0.08879888, -0.06652498, -0.0077884197, -0.17091131, -0.114323854, -0.09016538, 0.119309545, 0.012176394, -0.12138331, 0.13463295, -0.0018469095, 0.11039591, 0.07277858, 0.051378965, 0.015570402, -0.18667829, 0.026065946, 0.06292772, -0.060917974, -0.1713705, -0.04584658, 0.05100429, -0.07907522, 0.025936961, 0.043119907, -0.15339732, 0.08637273, 0.26746714, -0.03166449, -0.15027666, -0.10028553, -0.03333795, 0.068045855, -0.14712727, -0.10720837, -0.05266738, -0.16272235, -0.008576989, 0.0782944, 0.025319934, -0.107895374, -0.16713464, -0.051038146, 0.023315072, -0.22767961, -0.082010746, -0.09917283, -0.041755557, -0.065247536, -0.12145734, 0.05491054, -0.027088642, 0.056698203, -0.1303494, 0.05345738, -0.007687092, -0.04702747, -0.033373356, 0.026792884, 0.09473193, -0.08023214, -0.05164361, -0.07812083, 0.07259047, -0.014250517, -0.08757079, -0.15803075, 0.1426655, 0.033088446, -0.08810198, -0.014973044, 0.05136633, 0.040035367, -0.2482953, 0.16679299, -0.063893914, 0.027863026, -0.033011556, -0.075110555, 0.19677734, -0.10152888, 0.07722533, -0.05052674, 0.031162739, -0.0017360449, 0.1171819, 0.114175916, -0.15771031, 0.06981325, -0.07816899, -0.025133729, 0.10354376, -0.087893486, -0.023976207, 0.14222586, -0.13531792, -0.06542754, 0.09580135, 0.035600424, 0.06790948, 0.025063276, -0.012616634, -0.09447956, 0.045766473, 0.107803345, -0.021033645, 0.13588238, 0.04605937, -0.07693541, 0.16997552, -0.03094685, 0.04627967, -0.025357485, 0.019183874, 0.07052946, -0.025266647, 0.15011907, 0.0138299465, 0.14547527, 0.026444912, 0.077475905, 0.06929016, 0.0097824335, 0.058536887, 0.017158985, -0.01570201, 0.06454587, -0.0023497343, -0.07274413, 0.27538288, 0.10889053, -0.005338192, 0.025383592, 0.036337137, 0.025636315, 0.05920899, -0.044777393, 0.025241733, 0.010136843, -0.038829684, 0.116253614, 0.025096059, 0.14714837, -0.06783557, 0.14789593, -0.0281322, -0.07140374, 0.25976515, -0.12633252, 0.22694087, -0.04342115, -0.103273034, 0.3587935, -0.032942414, -0.035407066, 0.12338233, -0.03164375, -0.025052547, 0.07663214, 0.012027264, 0.012335539, -0.066851735, 0.100036025, -0.10987759, 0.009221196, 0.10984099, -0.092586994, 0.2564335, -0.23503053, -0.10888183, 0.03322327, -0.026174784, -0.021880984, -0.06333494, 0.02489531, -0.0980469, 0.023210287, -0.06902027, 0.0984422, -0.15318501, -0.046905637, 0.00016760826, -0.10879886, 0.10749173, 0.052961588, -0.0020557642, -0.078786135, 0.12103093, -0.01354146, -0.02598679, 0.03187847, -0.014423966, -0.049934506, -0.05243635, -0.032992244, -0.054710507, -0.09147656, -0.15243292, -0.0012738705, -0.084056616, -0.18628705, 0.0063991547, 0.04236579, -0.074897885, -0.12304616, -0.068424344, 0.13705611, -0.069667816, -0.17896926, -0.1829189, -0.12504995, 0.079782605, -0.05465448, -0.086651325, 0.03846252, -0.062028646, -0.19483387, -0.00023043156, -0.13843858, -0.021629214, 0.01816237, -0.039215207, -0.10006416, -0.058134794, 0.18439555, -0.16344416, 0.038035512, 0.014924049, -0.099433064, 0.000308156, -0.0059337616, -0.14718556, -0.105283976, 0.046099544, -0.097596884, 0.06492257, -0.04737854, 0.067659974, -0.052497864, -0.13735509, -0.037318468, -0.009558797, -0.014753222, -0.15103531, 0.14541888, -0.030458927, -0.15209293, -0.029207706, -0.045089364, -0.0418576, -0.015238166, -0.00833261, -0.038374424, -0.048366427, -0.0742532, -0.03879261, -0.044630766, -0.003935218, -0.08339822, 0.010786891, 0.038238406, 0.042390347, 0.05335927, -0.16898048, -0.024926186, -0.05325997, -0.103912115, -0.029159307, -0.02175808, 0.0062049627, -0.004544258, 0.012909174, -0.1766125, -0.01833272, 0.093713045, -0.12649143, 0.05778718, 0.07005155, -0.093137264, 0.07002807, -0.02510035, -0.04608357, 0.14537871, -0.032256722, -0.067012906, 0.12589395, -0.039702296, -0.061181545, 0.107908964, 0.01609528, -0.018404245, 0.022790909, 0.03800261, -0.03062141, 0.08049202, -0.034063816, -0.0668385, 0.06785226, -0.02018392, -0.0019010305, -0.06835234, -0.051134348, -0.03044653, 0.018564224, 0.0032348633, 0.021591306, 0.09567356, 0.0074647665, -0.0057555437, 0.07929921, -0.04717636, 0.070654035, 0.13754177, -0.10540366, -0.0033944845, 0.04399717, 0.06753576, 0.08077073, 0.05448997, 0.028201103, 0.025254607, 0.023189187, -0.01930821, -0.099460006, 0.021864176, 0.012447119, -0.04480195, 0.049462557, -0.029863715, 0.11638236, 0.034885526, 0.045735, 0.07713163, -0.0631578, 0.020808697, 0.10152674, -0.039255857, -0.02951622, 0.21567583, -0.08273959, -0.091611624, 0.11757839, 0.013947129, 0.1593839, 0.051085353, -0.13760698, 0.045549154, 0.06382251, -0.08133316, 0.103283405, 0.09594965, 0.025093317, 0.10194504, 0.029630661, -0.010529041, -0.10132253, 0.110360265, -0.015084982, -0.036628246, 0.039588094, -0.11223221, 0.097510934, -0.001372695, -0.105822206, 0.06351864, 0.109320045, -0.06777775, 0.092708826, 0.054543138, -0.091419935, 0.034114122, 0.04944074, 0.02214706, -0.062360883, -0.056874514, 0.06271076, 0.0766685, -0.13511825, 0.033058524, 0.10642922, -0.064335585, -0.01367414, 0.06064439, -0.0022103786, 0.0148139, 0.03317976, -0.1094203, -0.0018475056, 0.09579134, -0.03054738, -0.020619392, 0.009606123, -0.024820685, 0.03547108, -0.104546785, -0.07569051, 0.15746605, -0.014842749, -0.09410584, 0.08218527, -0.058595657, -0.060141325, 0.054381013, -0.009902716, -0.018258214, 0.04409671, -0.11862755, -0.05345857, 0.16213787, -0.13153565, -0.029459, 0.066940546, -0.016588211, -0.05017841, -0.007976651, 0.038771033, -0.00457716, 0.05495298, -0.08133018, -0.029677033, 0.017915249, 0.016372323, -0.014329314, -0.0187006, -0.03159058, -0.04122007, 0.028874636, -0.09029162, -0.084017396, -0.041771173, -0.008202791, 0.008852243, -0.014238, -0.006429553, -0.016291142, -0.045849085, -0.04095161, 0.04195988, -0.05440569, -0.029069543, 0.08915126, 0.01340723, 0.022398353, 0.009432673, -0.05379963, -0.03354323, 0.013259888, 0.018150568, 0.0048145056, -0.06052184, 0.017848492, 0.028969765, 0.010692954, 0.022562027, -0.07875943, 0.024184585, -0.03522837, 0.008229971, -0.016201258, -0.038241982, 0.045295596, -0.053901315, -0.034879804, -0.057795167, 0.011336565, -0.07593441, 0.04177618, 0.01344192, -0.07166386, 0.032356977, -0.084742546, 0.010953188, 0.022065163, 0.025737882, -0.04986012, 0.020159721, 0.027163386, 0.02971363, 0.004692912, -0.051165223, 0.040733576, 0.00464797, 0.010126352, -0.081540704, 0.063759565, -0.095386386, -0.008966923, 0.09501362, -0.0013532639, 0.076909065, -0.0694319, 0.05653608, -0.009120345, 0.0051721334, 0.045049787, -0.05673349, 0.016192198, -0.015914798, -0.069382906, -0.022114396, -0.019794464, 0.03642261, 0.004482746, 0.020649195, 0.020279527, -0.036195636, 0.056262016, -0.018042564, 0.02145958, 0.018840194, 0.032994986, 0.07267821, 0.0025593042, -0.0031514168, 0.039708376, 0.014538646, 0.017154574, 0.020676732, 0.021748781, 0.039848447, 0.0031394958, 0.018011332, -0.033800483, 0.04328227, 0.025233865, 0.0051039457, -0.0093592405, 0.01309514, 0.02483797, -0.015674233, -0.0031369925, -0.0100739, 0.06845951, -0.021937728, 0.08492899, 0.06477487, -0.007068634, 0.027903914, -0.060937405, 0.04428065, 0.10011327, -0.00016355515, -0.04778278, 0.062086463, -0.016793728, 0.01757443, 0.01384294, -0.029711127, 0.082232356, 0.030911326, 0.007373929, -0.027859688, 0.069569945, -0.09104824, 0.021891117, 0.052698135, -0.09372258, 0.105724335, -0.049615383, 0.017736197, 0.0050121546, 0.014067054, 0.0015645027, -0.046253324, 0.06282997, -0.0049487352, -0.04382813, -0.06152296, 0.0015312433, -0.00023698807, -0.010694623, -0.015587807, 0.06361365, 0.002972722, -0.0004169941, -0.022909045, -0.022576332, 0.025568485, -0.0795027, 0.031949162, 0.05277121, 0.041481853, -0.0573982, 0.009886026, 0.011642218, -0.06508827, 0.007558942, -0.036700845, 0.021752119, -0.04587698, -0.02710414, -0.022962213, -0.011950612, 0.02318573, 0.013785601, 0.029113054, -0.039178133, 0.020642757, -0.03469169, -0.06160724, -0.04228735, -0.023145318, 0.023991466, 0.052297473, 0.03569734, -0.040593624, -0.003148675, -0.008548737, -0.011392832, 0.0052056313, -0.010347366, -0.05022967, 0.019849181, 0.026987076, -0.016573787, 0.010984421, -0.038018465, 0.024083376, 0.0189718, -0.01936531, -0.0001552105, 0.0034610033, 0.023970008, -0.002791524, -0.011054158, -0.004692316, -0.0038120747, -0.058189034, -0.050699353, -0.004501343, -0.022081971, 0.01862204, 0.023299932, -0.0291183, -0.05337441, 0.037917495, 0.006854892, -0.054713488, 0.042876363, -0.02384007, -0.03200555, 0.019692898, -0.037416935, 0.0017762184, 0.015199304, -0.05021596, 0.017510653, 0.04612553, -0.046517134, 0.0070575476, 0.031596422, -0.011082411, 0.009518743, -0.011818171, -0.018138528, -0.039964557, -0.009097338, -0.05245924, -0.035196066, 0.02985859, -0.044012904, 0.028847575, 0.01997149, -0.0133628845, 0.015503645, -0.032032132, -0.058403254, 0.04208243, -0.034469724, -0.07245898, 0.036178112, -0.07939923, -0.018149853, 0.037286878, -0.010035992, -0.012763262, -0.024914622, 0.01617682, -0.0038756132, 0.00680995, 0.017207623, -0.028144956, -0.004814863, -0.042399287, -0.00021505356, 0.02894628, -0.008761048, 0.015336633, -0.027325034, -0.007873535, 0.008052111, 0.017557979, -0.022913456, -0.00312984, 0.009813309, -0.047844768, 0.03427553, 0.032221913, -0.012280464, 0.031345963, 0.024476886, -0.02976799, -0.031163454, 0.023363352, -0.00012528896, -0.0011885166, 0.019459844, -0.006352186, 0.014880419, 0.004336357, 0.003136754, 0.009416819, -0.002267599, -0.027641058, 0.03178656, 0.031325936, -0.013688326, 0.026880026, 0.010209441, -0.039764166, 0.024508476, 0.01129663, 0.0006117821, 0.046654224, -0.061988473, 0.0134141445, 0.016330957, 0.014403224, -0.027793288, -0.041009784, 0.036702156, 0.016803145, -0.002091527, -0.03381288, 0.056580305, 0.0006649494, 0.0042123795, 0.02007854, 0.00026142597, 0.00041258335, 0.014848113, 0.040922046, 0.00072169304, 0.0013691187, 0.0010029078, 0.017920732, 0.026265025, -0.010168076, -0.042383075, 0.021631837, 0.011739373, 0.0038081408, 0.015007973, 0.02006793, -0.009266138, -0.03760004, 0.022829294, 0.052194238, 0.007973552, -0.019782543, 0.03671539, 0.037474632, -0.00808835, -0.0025479794, 0.048270106, -0.0319705, -0.0021041632, 0.036169767, -0.040787578, 0.013649464, 0.002425909, 0.0060203075, 0.011672854, -0.02529931, -0.02505505, 0.00079739094, 0.02490437, 0.018874884, 0.00806272, 0.001283884, 0.04123807, 0.009883285, -0.0061217546, 0.024887085, 0.025106907, 0.008117318, 0.004222274, 0.0068136454, -0.030860186, 0.020745158, 0.005470395, -0.00095927715, 0.027369142, -0.0013757944, -0.025063396, 6.4492226e-05, 0.033180118, -0.016343117, 0.009802222, -0.0054228306, -0.0010541677, 0.003247738, 0.001609683, 0.03817606, 0.0009058714, -0.013456225, -0.03174436, 0.021845102, 0.011726618, -0.03930247, 0.016280413, -0.01950121, -0.020089269, 0.0040404797, 0.007406354, 0.020602822, -0.035029054, -0.020408392, -0.006183505, 0.00095653534, -0.017902136, -0.013654828, 0.027887225, -0.01688528, -0.0034080744, 0.005864978, -0.0038187504, -0.0031784773, -0.020944595, 0.008272171, 0.0025322437, -0.014289141, 0.007922292, -0.0064257383, -0.016208768, -0.027421236, -0.009592533, 0.012798786, 0.016962528, 0.014138818, -0.026827693, 0.0036256313, 0.0065796375, -0.016294837, 0.0074999332, 0.0032246113, 0.0020917654, -0.012868047, -0.03433168, 0.01142168, 0.019158483, -0.042269826, -0.032120705, 0.0025402308, -0.006324172, -0.032933474, 0.010722637, 0.02553749, -0.023448944, 0.016774654, -0.0051873922, -0.005536318, 0.033872485, -0.011963129, 0.005162239, -0.0032055378, -0.011859894, -0.011511326, -0.011836886, 0.024677873, 0.0017403364, -0.020324111, -0.0041953325, -0.0018405914, -0.022764802, 0.0036371946, 0.0003041029, -0.00010931492, -0.006416321, -0.00078999996, 0.014243007, -0.011913538, 0.016449213, 0.011243224, 0.009619355, 0.00060737133, 0.0071177483, -0.0068963766, -0.0014439821, 0.012155652, 0.0043754578, 0.0018706322, -0.012772322, 0.00970459, -0.036994815, -0.01282084, 0.028894663, 0.0073599815, -0.012760878, 0.0093256235, -0.0056169033, -0.0024424791, 0.029092073, 0.008217573, -0.00344944, -8.6426735e-05, 0.026999474, -0.0017352104, 0.018231153, 0.0038362741, 0.011102915, 0.017240524, -0.012685776, -0.017083406, 0.029105544, 0.033585787, -0.029869795, 0.015625, -0.0120232105, -0.0102261305, -0.0008035898, 0.013614297, 0.020929098, 0.020061255, 0.023605585, -0.019747496, 0.018067122, 0.008572459, 0.010025024, 0.018489957, -0.004617572, 0.015681267, 0.008814931, -0.008147359, -9.6321106e-05, -0.007883191, 0.003597498, 0.0045278072, -0.009291887, 0.0020480156, -0.0057058334, 0.0061124563, -0.0018923283, 0.0028207302, 0.023488283, -0.01505053, 0.0063802004, 0.011482596, 0.0043195486, 0.0045702457, -0.013797283, 0.0130370855, 0.010924578, -0.0013055801, -0.021677256, -0.0046077967, 0.025476813, -0.012210131, -0.027030945, 0.030130863, 0.0019030571, 0.00975883, 0.008371353, -0.021692753, 0.025350094, -0.0008774996, 0.02151382, 0.003738761, 0.0037677288, -0.0031347275, 0.0017459393, 0.011915326, -0.028132081, 0.023431778, 0.0017787218, -0.0073719025, 0.018130302, 0.001115799, -0.022738218, -0.0107162, 0.015505314, 0.0077604055, 0.012761474, 0.008347869, 0.0069442987, 0.01018846, -0.011772752, 0.0010066032, -0.008852959, -0.012594342, 0.010142565, 0.011308908, -0.0028158426, -0.025864244, 0.0118454695, -0.007971287, -0.023182273, 0.0056847334, -0.004689336, -0.0029182434, 0.0076247454, -0.003450513, -4.720688e-05, -0.0005207062, 0.00022852421, 0.0072621107, -0.018290639, 0.009389639, -0.0014730692, -0.020318389, 0.008848786, 0.0064810514, -0.018874764, -0.010735154, 0.011230469, -0.0034589767, -0.003994584, -0.0026444197, -0.00262177, -0.007652521, 0.0033180714, -0.0048549175, -0.0034331083, 0.016046524, -0.025395632, -0.017782092, 0.013309002, -0.0029206276, -0.004684329, 0.0031939745, 0.001093626, -0.00396049, -0.0055270195, -0.0068809986, 0.0032951832, 0.007095933, -0.0037146807, -0.009865284, -0.022203684, -0.0058971643, 0.0118306875, -0.0029189587, 0.005651951, 0.014275432, 0.0030686855, -0.003190875, -0.0046588182, 0.0018011332, 0.0028151274, -0.008927822, -0.0054502487, 0.004672408, -0.0012989044, -0.027349114, 0.0003732443, 0.0125705, -0.026174068, 0.017640233, 0.008585215, -0.0023708344, -0.00075781345, -0.0063591003, 0.003908515, -0.010308981, 0.011416197, -0.014445782, 0.017540336, 0.015693665, -0.014629126, 0.006905675, -0.0065612793, -0.020163298, -0.00196743, 0.015180588, -0.008658171, 0.008959651, -0.010870576, -0.013630867, 0.0027329922, 0.004355669, -0.008633018, 0.008589864, 0.023588896, -0.026974559, -0.00044047832, -0.0096075535, -0.006164074, 0.012761712, -0.016308188, -0.011444688, 0.00662148, -0.0022153854, -0.008825779, 0.011811852, -0.0050525665, -0.014693618, -0.0010566711, -0.0021321774, -0.010466456, 0.005317688, 0.0051238537, -0.0076715946, 0.002972126, 0.0024671555, 0.0053673983, -0.00079762936, 0.0026183128, 0.006855011, -0.005102396, -0.010408044, 0.0041644573, 0.0076237917, -0.002064705, 0.020982146, -4.8279762e-05, -0.0071816444, 0.004989624, -0.0073730946, 0.004848242, 0.0026198626, 0.0031079054, 0.00031471252, -0.0024415255, -0.00037813187, -0.00010514259, 0.0011497736, -0.004061699, -0.006989002, 0.006329417, -0.0012911558, -0.012530565, -0.00028967857, 0.007569194, 0.0020813942, -0.015428901, 0.0067619085, 0.00925982, 0.004511595, -0.003553152, -0.0040977, 0.012349725, 0.0028651953, 0.0034761429, 0.0035350323, 0.007011652, 0.0027576685, 0.0028312206, -0.0032987595, 0.0057810545, 0.010160804, -0.0023041964, 0.0014805794, 0.004460335, -0.0031603575, -0.00055360794, 0.0052318573, -0.0015568733, 0.0045033693, 0.0004658699, -0.0004323721, -0.002780199, 0.0090065, -0.0004143715, -0.0028957129, 0.007787943, -0.0054479837, -0.00086939335, 0.006712079, 0.001375556, -0.007773161, 0.0050411224, -0.0043531656, 0.0015236139, 0.0048270226, -0.00044870377, 5.3048134e-05, -0.00010204315, 0.0033919811, 0.0011960268, 0.012325883, -0.0012350082, 0.0059330463, 0.0012358427, -0.0034059286, 0.0021400452, -0.0025992393, 0.005782485, 0.0016460419, 0.0020815134, -0.006431699, 0.0022951365, 0.004625559, -0.00432539, 0.0037323236, -0.0058699846, 0.0019026995, 0.0028284788, -0.0061825514, 0.008087516, 0.00028562546, -0.0046691895, 0.0001436472, -0.005462408, -0.000315547, 0.0013006926, -0.0022902489, 0.0013384819, -0.005760908, -0.006281376, 0.006943941, -0.001587987, -0.0044037104, 0.0066492558, 0.004556179, 0.0034025908, -0.0045990944, -0.0037394762, 0.0030276775, 0.0009595156, -0.0037288666, -0.0092692375, 0.0015716553, -0.0039082766, -0.0037070513, 0.0049329996, -0.0005745888, -0.0052728653, 0.0015757084, 0.0025395155, -0.0022794008, -0.0007003546, -0.007795453, 0.0043617487, -0.00068318844, -0.0061831474, 0.0010097027, -0.0018298626, -0.0012938976, 0.0019545555, -0.0015847683, 0.00024020672, 0.0061147213, -0.0047883987, -0.0028420687, -0.002467513, -0.00224185, -0.00033032894, 0.0010573864, 0.00084733963, 0.0060447454, 0.00026929379, -0.009308934, 0.004135728, 0.0020723343, -0.0057576895, -0.003943205, -0.0012478828, -0.0017483234, 0.00078725815, -0.00034832954, -0.0049893856, -0.006446004, -0.004408002, -0.0011857748, 0.001873374, -0.0020420551, -0.0017752647, 0.0019435883, -0.004896164, -0.0025577545, 0.0026171207, 0.0015189648, 0.0029139519, 0.0043969154, -0.0021039248, -0.0026296377, 0.001567483, 0.00092577934, -0.00568223, -0.0034559965, 0.003353119, -0.0031936169, 0.001642108, 0.0005391836, -0.008297205, -0.00014710426, -0.0005272627, -0.0020138025, -8.058548e-05, -0.0024069548, 0.0036014318, 0.0040023327, -0.0021959543, 0.0029063225, -0.0031276941, -0.00289011, 0.006013155, -0.005525112, 0.0013090372, 0.00064241886, 0.00025236607, 0.0016903877, -0.0030298233, -0.0038899183, -0.002347827, 0.004901886, -0.0052667856, 0.0024739504, 0.0020353794, -0.0016691685, 0.002421856, 0.0028024912, -0.0006740093, -0.003535986, 0.002644658, -0.0015758276, 0.0032793283, 0.0025564432, -0.0031032562, 0.00086581707, 0.0005456209, -0.0013939142, 0.0023730993, -0.0009934902, -0.001639843, 0.0015981197, -0.0035840273, -0.003744483, 0.0012114048, -0.0016443729, -0.0021384954, 0.00025045872, -0.00220263, -0.0012065172, -0.00039589405, -0.0008084774, -0.00425601, 0.0017575026, 0.0025185347, -0.0009217262, 0.00121212, -0.0014779568, -0.000106334686, -0.0015149117, -0.0010921955, 0.0011590719, -0.0022767782, -0.00084638596, 0.0012761354, 0.00021648407, -0.0017424822, -0.0013687611, 0.0014891624, -0.0018188953, -0.0018355846, -0.0012853146, 0.0013238192, 0.0010076761, -0.0015182495, -9.8347664e-05, -0.001095891, -0.00069344044, -0.002874136, 0.00090265274, 0.0005866289, -0.0011103153, 0.001247406, -0.0007661581, -0.00084483624, 0.0006740093, 0.0031591654, 0.0016261339, 0.0009829998, 0.0007044077, 0.00037014484, 0.0003106594, -0.0013188124, -0.0004593134, -0.0003709793, -0.0008382797, 0.0006850958, 0.0011178255, -0.0028665066, 0.0006529093, 0.0024834871, -0.0027587414, 0.00018572807, 0.0019251108, -0.0013883114, -0.00047004223, -0.0011349916, -0.0019840002, 0.00067460537, -0.0011702776, 0.00019443035, 0.0006518364, -1.2874603e-05, 0.00047171116, 0.0008716583, -0.00035607815, -0.00041115284, 0.0021787882, -0.0014992952, 0.0003876686, 0.0008196831, -0.0008095503, -5.209446e-05, 0.0014400482, 0.0014828444, -0.0009967089, 4.684925e-05, 0.00036406517, 0.0013267994, -0.00029063225, -0.000603199, 0.00075984, 0.0008984804, 0.00019669533, -0.001376152, 0.0016442537, 0.00021183491, -0.00043284893, 0.0014760494, -0.00090157986, 0.00146842, -0.0001707077, -0.0010653734, -0.00024092197, -0.00031995773, 0.0016614199, -6.568432e-05, 0.00037634373, -0.00080025196, 0.00030326843, 5.9604645e-07, -0.00035464764, 0.00095140934, -0.00064468384, 0.0007698536, 0.00044095516, -0.00030577183, 0.00036478043, 0.0010887384, -1.0728836e-06, 0.00048029423, 0.00023138523, 4.36306e-05, 0.0008251667, -0.0005824566, -0.00023162365, 0.00019061565, 0.00048661232, -0.0005340576, -1.859665e-05, 0.00019061565, -0.00015807152, -2.1457672e-06, -0.0007606745, -0.00015079975, 0.00015485287, 0.00023925304, 0.0007585287, 0.0009711981, 0.00014328957, 0.000441432, -0.0001308918, -0.00013017654, 0.00016212463, -0.0002964735, 0.00043427944, -0.00020194054, 0.00033807755, 7.2836876e-05, -0.00064349174, 0.00040066242, 2.193451e-05, -0.00019848347, -0.00015997887, 0.00028002262, 0.000118136406, -0.00037634373, 0.000264287, -0.0005391836, -1.5377998e-05, 0.0003875494, -0.00012874603, 5.6385994e-05, 0.00021100044, 0.00014054775, -0.00047647953, -0.00042247772, -0.00029420853, 0.00014340878, -2.4318695e-05, -6.0081482e-05, -2.1338463e-05, 9.9897385e-05, 0.00025594234, 0.00015723705, 0.00021803379, 5.710125e-05, 8.9883804e-05, -0.00012362003, 5.9843063e-05, -0.00010919571, -0.00010371208, -8.34465e-06, -8.332729e-05, 0.00015282631, -0.00012683868, -0.0001565218, 0.00014936924, -3.2186508e-05, -9.202957e-05, 0.00016736984, -2.9087067e-05, 5.3286552e-05, 0.00020492077, -8.904934e-05, -7.2717667e-06, -8.940697e-06, -0.00016212463, -4.6372414e-05, -4.0888786e-05, -9.5009804e-05, -5.7697296e-05, -6.651878e-05, -0.00010967255, 2.5629997e-05, 1.66893e-05, 1.0848045e-05, 2.3961067e-05, -6.0915947e-05, -2.8848648e-05, 1.0728836e-06, 1.1205673e-05, 3.3140182e-05, -4.4107437e-06, -4.1604042e-05, 7.2717667e-06, -1.3589859e-05, 4.0769577e-05, 5.9604645e-06, -2.515316e-05, 2.3245811e-05, 5.4836273e-06, 1.2397766e-05, -5.364418e-06, -7.390976e-06, -7.033348e-06, 9.536743e-06, 2.026558e-06, -4.053116e-06, 8.821487e-06, 8.34465e-07, 9.536743e-07, 1.7881393e-06, 1.1920929e-07, 1.66893e-06, 9.536743e-07, 3.5762787e-07, 5.9604645e-07, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-constexpr float kKlotz[4096] = {-0.006026296, 0.0049391454, 0.009308956, 0.15395862, 0.26455078, -0.30155355, -0.16379379, 0.22677736, -0.10849435, 0.042338647, 0.023612378, -0.04950545, 0.07579945, -0.048128743, 0.029254299, -0.0051115444, -0.00200678, 0.019204969, -0.020692501, 0.028213032, -0.018523872, 0.015374626, -0.0004651907, -0.0040486185, 0.0145518035, -0.011612783, 0.014643042, -0.005798506, 0.0056399247, 0.0032604616, -0.0014944819, 0.008156425, -0.0027930338, 0.0071447357, -0.00025364044, 0.0033689602, 0.0027768959, 0.0010737923, 0.004119499, 0.00074784673, 0.0033841615, 0.001346755, 0.0024306288, 0.0019624738, 0.002352873, 0.0021992463, 0.002263025, 0.0022692524, 0.00238725, 0.0029988291, 0.0024077517, 0.0033188623, 0.002248308, 0.0030668152, 0.0020377696, 0.0023939966, 0.0021722177, 0.0017859056, 0.002751131, 0.0019297644, 0.0032828227, 0.0022626645, 0.002734882, 0.002507685, 0.0022000747, 0.0025621725, 0.0017868764, 0.0026965349, 0.0019167273, 0.0026886077, 0.0026845213, 0.0028948907, 0.0032918348, 0.0025697171, 0.0028590478, 0.0023576578, 0.0026951935, 0.0021269592, 0.0022101495, 0.002282126, 0.0024711823, 0.0029188897, 0.0024643694, 0.002823999, 0.0022654724, 0.0024673885, 0.002120265, 0.002375528, 0.0026593832, 0.002731211, 0.0032051865, 0.002541388, 0.0029909417, 0.0022070312, 0.0025953786, 0.0021273813, 0.0015533513, 0.0018812787, 0.0011939593, 0.0021879033, 0.0024087625, 0.0028195092, 0.0034556212, 0.0060382173, 0.004816821, 0.0030420765, 0.003782236, 0.0076857856, 0.016350199, 0.011498961, -0.000889923, -0.0059350654, 0.0061161066, 0.017823685, 0.006887278, -0.020645363, -0.033930905, -0.017552128, 0.0018598523, 0.033849295, 0.05894087, 0.083569795, 0.08747469, 0.024163691, -0.09215382, -0.23379093, -0.2833619, -0.2334711, -0.08654663, 0.05267972, 0.15099484, 0.3294916, 0.35442096, 0.20465794, -0.03301433, -0.14625168, -0.118657656, -0.30394852, -0.39170766, -0.44414487, -0.45902073, -0.240887, -0.123372175, 0.16611566, 0.43681982, 0.44861132, 0.48330843, 0.3451753, 0.1813249, 0.100821204, 0.05118761, 0.16112626, 0.31921226, 0.4157099, 0.3739791, 0.15342017, -0.18199001, -0.41580516, -0.47969976, -0.46086887, -0.27678677, -0.09197766, 0.0023838645, 0.08248151, 0.040833272, 0.099623166, 0.28618452, 0.35526142, 0.4973815, 0.649654, 0.6802591, 0.63112324, 0.37490913, 0.13612494, -0.11637852, -0.48938885, -0.6739182, -0.8555996, -0.9998777, -0.8668707, -0.7029484, -0.46728498, -0.05943385, 0.32671562, 0.58920914, 0.7004021, 0.5773855, 0.32636088, 0.093142085, -0.11660645, -0.10994721, 0.02420353, 0.053848565, 0.06363946, -0.00097481464, -0.14606224, -0.3148952, -0.49546897, -0.5672303, -0.54645646, -0.46202856, -0.31014732, -0.18817961, -0.06598481, 0.08841953, 0.19140418, 0.35098454, 0.5444689, 0.5771244, 0.5634058, 0.49109226, 0.27984068, 0.04622206, -0.24346584, -0.47355798, -0.5359547, -0.51606524, -0.3735445, -0.21381311, -0.10899466, -0.001791287, 0.07095836, 0.15395744, 0.23911406, 0.3416225, 0.4498709, 0.40901247, 0.23665424, -0.014069667, -0.2467246, -0.32924062, -0.31310794, -0.21047454, -0.051071662, 0.030955212, 0.037274938, 0.014792289, -0.030180268, -0.029180882, 0.02390468, 0.090444215, 0.18125089, 0.28283837, 0.3500774, 0.3319757, 0.2742908, 0.20966333, 0.10716174, 0.00085564615, -0.12368327, -0.2614972, -0.36260298, -0.42328408, -0.41062483, -0.31888622, -0.20394427, -0.09514298, 0.036349937, 0.17472166, 0.25900215, 0.3114577, 0.3399739, 0.3619917, 0.404711, 0.38986352, 0.34212574, 0.2672237, 0.15511216, 0.06839678, -0.054873735, -0.12338519, -0.14075312, -0.19312371, -0.17294611, -0.17901988, -0.18421039, -0.13093142, -0.12691791, -0.10065007, -0.08441283, -0.12662873, -0.15397194, -0.14408019, -0.09716784, -0.025285143, 0.06608918, 0.1892647, 0.3104969, 0.36011666, 0.35706148, 0.28890246, 0.17076863, 0.08495537, 0.0029873797, -0.049303096, -0.0794675, -0.13178489, -0.16382025, -0.20345017, -0.23948494, -0.24168865, -0.21638657, -0.15358405, -0.100144744, -0.052853484, -0.0017610197, 0.0055466187, -0.00555585, 0.0043763495, 0.0520065, 0.14347209, 0.21649589, 0.2229421, 0.1965633, 0.13223498, 0.025605872, -0.05082865, -0.091626875, -0.0963627, -0.0608813, -0.05950156, -0.1032365, -0.15876469, -0.20175706, -0.20233056, -0.15221268, -0.065083236, 0.038469687, 0.12515081, 0.13769689, 0.082478076, 0.0006693131, -0.08048076, -0.12159555, -0.11638973, -0.078901395, -0.026615921, 0.031651013, 0.08479133, 0.119367324, 0.1463624, 0.16202526, 0.156868, 0.14061806, 0.11536707, 0.084660985, 0.059754357, 0.013979294, -0.042422537, -0.07481534, -0.0945529, -0.06244875, -0.00078443397, 0.028164104, 0.032909192, -0.027457524, -0.13401115, -0.24543755, -0.3605198, -0.40070164, -0.3776252, -0.3255035, -0.21947442, -0.12494416, -0.030581739, 0.0959682, 0.19493027, 0.27664626, 0.32386348, 0.30926383, 0.26561493, 0.18404232, 0.097875424, 0.051261798, 0.03204575, 0.042160187, 0.0587533, 0.056396913, 0.03873344, -0.0043349466, -0.058043644, -0.1074129, -0.1548788, -0.17251322, -0.16043308, -0.13579254, -0.10281583, -0.08175519, -0.061387554, -0.0420179, -0.038688887, -0.023482768, 0.0041308296, 0.040118184, 0.08945697, 0.12541103, 0.14667365, 0.16498609, 0.17655477, 0.18553142, 0.20452827, 0.22429784, 0.22912475, 0.22187833, 0.18091148, 0.1172852, 0.054781552, -0.020296233, -0.08825532, -0.15128466, -0.21096164, -0.24297446, -0.24613196, -0.21287464, -0.1490129, -0.06120207, 0.03151229, 0.10171386, 0.13765424, 0.13543014, 0.114035845, 0.081442446, 0.05972491, 0.05468607, 0.058172815, 0.08165371, 0.09574076, 0.10006389, 0.09560135, 0.064249896, 0.02028392, -0.040688872, -0.113697894, -0.18942025, -0.25004008, -0.27244443, -0.25023675, -0.18802215, -0.12166485, -0.05089284, 0.010560836, 0.03708617, 0.05668505, 0.06430426, 0.07788571, 0.11754529, 0.15492095, 0.18412486, 0.19240038, 0.17413208, 0.1364034, 0.08774212, 0.0431986, 0.010533074, -0.008870826, -0.036460947, -0.0744769, -0.12169317, -0.18132809, -0.22731447, -0.25371653, -0.24998078, -0.20247434, -0.12167901, -0.018955931, 0.08836746, 0.1903725, 0.27505237, 0.3264105, 0.3349134, 0.3030516, 0.23899572, 0.1388605, 0.015069142, -0.11893041, -0.24243972, -0.32145533, -0.35518962, -0.33696702, -0.26817727, -0.18006477, -0.08293362, 0.0033061388, 0.062489577, 0.10616466, 0.13511205, 0.15939613, 0.1866, 0.20848711, 0.21711242, 0.1991729, 0.15497674, 0.085862696, 0.004963245, -0.06169538, -0.112634405, -0.13987769, -0.14046802, -0.13037017, -0.11081806, -0.0811267, -0.04480195, 0.0031551493, 0.06344261, 0.120520964, 0.16344026, 0.18207182, 0.164114, 0.11626278, 0.047136106, -0.029068595, -0.09286714, -0.13910848, -0.16334538, -0.1696339, -0.16664524, -0.15292703, -0.12755647, -0.08274668, -0.020759638, 0.043041456, 0.101030245, 0.1318636, 0.12165506, 0.07969539, 0.019203668, -0.036108635, -0.072137505, -0.08174945, -0.06854845, -0.056883, -0.05325021, -0.06046336, -0.07742177, -0.087539725, -0.084252216, -0.06266762, -0.032205977, -0.006864762, 0.003410692, -0.010014305, -0.030739978, -0.0487858, -0.05095025, -0.029074075, 0.0035203625, 0.044323076, 0.07465651, 0.08663865, 0.08232534, 0.061962873, 0.03944184, 0.011643744, -0.012102482, -0.033373613, -0.05468877, -0.06554297, -0.07920854, -0.0798576, -0.06493613, -0.04721721, -0.017087817, 0.012666984, 0.038434748, 0.06004406, 0.06999042, 0.071876675, 0.06683875, 0.056530397, 0.042993046, 0.033218674, 0.028634511, 0.031523794, 0.046067446, 0.060779873, 0.072865225, 0.081114665, 0.08100524, 0.0761215, 0.066301696, 0.057256117, 0.05047847, 0.040659536, 0.033598248, 0.026368694, 0.012211307, -0.003004629, -0.023023264, -0.049536217, -0.0712381, -0.090475164, -0.101845026, -0.09388627, -0.07613317, -0.047528602, -0.00837141, 0.032847557, 0.07981443, 0.12279389, 0.15666337, 0.18372755, 0.19826859, 0.19949184, 0.18165345, 0.15035178, 0.109370455, 0.0587285, 0.0114223175, -0.03488829, -0.07244277, -0.100181594, -0.13031086, -0.15470108, -0.17874049, -0.19593929, -0.19374178, -0.17703572, -0.13983181, -0.089239925, -0.034332, 0.0227126, 0.07118234, 0.106588334, 0.12781322, 0.13526765, 0.12961783, 0.11071867, 0.0811483, 0.045085557, 0.008245835, -0.02458109, -0.05106807, -0.06887812, -0.07554594, -0.0730802, -0.06289776, -0.045965914, -0.022540156, 0.008099532, 0.03890496, 0.065526314, 0.08423852, 0.08954549, 0.08215035, 0.059931453, 0.026287736, -0.009698235, -0.044242274, -0.07382309, -0.095199116, -0.107964076, -0.11316875, -0.113274604, -0.11403983, -0.11078917, -0.093882754, -0.0623664, -0.01429738, 0.042843852, 0.09864152, 0.1419263, 0.16015126, 0.15741384, 0.13545772, 0.101199515, 0.06526764, 0.026177675, -0.009089662, -0.040448476, -0.06892138, -0.08335269, -0.08530543, -0.07833157, -0.061688576, -0.042693246, -0.026023483, -0.012052412, -0.0010523403, 0.01299247, 0.03432329, 0.058944114, 0.08096826, 0.09207158, 0.08520255, 0.06246959, 0.030393174, -0.005330213, -0.038707975, -0.06632661, -0.08865669, -0.106222406, -0.117591135, -0.121352576, -0.11531861, -0.096229985, -0.0634845, -0.01783622, 0.036635347, 0.09325835, 0.14776129, 0.19210754, 0.21478526, 0.21101646, 0.17944503, 0.12185966, 0.050537452, -0.024537638, -0.09419283, -0.1449149, -0.17438209, -0.18208854, -0.16919863, -0.14626056, -0.11849606, -0.089045346, -0.06188665, -0.036352776, -0.012201841, 0.010195614, 0.029567704, 0.041194513, 0.04227294, 0.033513974, 0.016960068, -0.0023265113, -0.020602763, -0.034496028, -0.04020999, -0.041411184, -0.039653618, -0.03294531, -0.025403842, -0.014670845, 0.0030337041, 0.01979874, 0.03268978, 0.040980622, 0.037621003, 0.02573355, 0.01013804, -0.007421314, -0.02036204, -0.030672807, -0.04136944, -0.05194453, -0.061632097, -0.06532891, -0.06219784, -0.047793012, -0.0206251, 0.014280791, 0.0573282, 0.10074607, 0.13640381, 0.16175123, 0.17173018, 0.16778244, 0.15433659, 0.13418302, 0.11196575, 0.08939007, 0.06521012, 0.03962897, 0.011635527, -0.016168868, -0.039173212, -0.05711888, -0.06747044, -0.069776885, -0.06719202, -0.060464118, -0.050242726, -0.037535317, -0.020922013, 0.0009795577, 0.026300779, 0.054502785, 0.08172644, 0.10291664, 0.1179644, 0.12514745, 0.1263434, 0.12224418, 0.10977289, 0.0899334, 0.061499584, 0.02620979, -0.011161385, -0.04868449, -0.083863504, -0.11518155, -0.14017786, -0.1570776, -0.16434477, -0.16006136, -0.14541362, -0.1201092, -0.083978385, -0.039315876, 0.010819655, 0.06107564, 0.10419012, 0.13428785, 0.14678131, 0.14008372, 0.11957941, 0.09083186, 0.058632623, 0.026341666, -0.008017844, -0.04463889, -0.081148155, -0.11430203, -0.1397307, -0.1545996, -0.1577297, -0.14695206, -0.12310901, -0.09090299, -0.05152286, -0.007757712, 0.038053226, 0.08387074, 0.12039771, 0.14036277, 0.13797207, 0.11044132, 0.06329273, 0.004540701, -0.05283838, -0.09788895, -0.12750065, -0.13964142, -0.137035, -0.12353811, -0.098866194, -0.06452101, -0.022202326, 0.025628392, 0.07367324, 0.11638404, 0.14727426, 0.16084754, 0.15461868, 0.12961765, 0.089607045, 0.039314196, -0.01629835, -0.072733186, -0.12439171, -0.16726507, -0.19642773, -0.20427094, -0.18937, -0.15292427, -0.09970685, -0.040116772, 0.018549558, 0.06998946, 0.11156478, 0.14365683, 0.1649355, 0.17427827, 0.16886777, 0.14726767, 0.111842155, 0.06775699, 0.017215949, -0.034501795, -0.07439975, -0.098559216, -0.10818046, -0.104852475, -0.09106689, -0.068226166, -0.044892713, -0.022782227, 0.0020337724, 0.023285266, 0.037387554, 0.043626174, 0.040317986, 0.02983935, 0.012320067, -0.0069805533, -0.02054974, -0.031551946, -0.039349657, -0.041353412, -0.040428817, -0.035377, -0.025282996, -0.009189885, 0.015106564, 0.04473664, 0.07527057, 0.10048323, 0.11146307, 0.10549883, 0.087064214, 0.06000676, 0.026158174, -0.010233314, -0.044582635, -0.07740803, -0.110275105, -0.14066724, -0.1617118, -0.16882052, -0.16175222, -0.13907634, -0.104297385, -0.06295222, -0.017085243, 0.028881991, 0.070223235, 0.10328373, 0.1273201, 0.14186022, 0.14240706, 0.12790482, 0.1016922, 0.0683046, 0.03262823, -0.0009814077, -0.028330993, -0.048744615, -0.06516391, -0.07866317, -0.086557716, -0.086459056, -0.07699358, -0.056384314, -0.025751418, 0.010860586, 0.04802697, 0.08015172, 0.10296648, 0.11344336, 0.11121459, 0.09948309, 0.08207536, 0.060043123, 0.03521544, 0.010497372, -0.012615015, -0.033236768, -0.050000433, -0.05916202, -0.059543956, -0.05165704, -0.03805061, -0.02400014, -0.010624312, 0.0013771001, 0.013975594, 0.028526355, 0.04298117, 0.05945058, 0.07540692, 0.0858581, 0.08958563, 0.08509089, 0.07410048, 0.05906008, 0.040317528, 0.019152908, -0.005186423, -0.034821182, -0.06850317, -0.10206687, -0.12901251, -0.14304554, -0.14068699, -0.1217568, -0.08912483, -0.047115143, -0.0013065926, 0.04368011, 0.08415534, 0.11653661, 0.13794571, 0.14562206, 0.13806844, 0.11512581, 0.078756265, 0.033453003, -0.014072455, -0.058102768, -0.097070195, -0.12872441, -0.15021308, -0.16135061, -0.1619853, -0.15081936, -0.1259647, -0.08653707, -0.03571836, 0.019544037, 0.07114872, 0.11091728, 0.13346271, 0.1377393, 0.1265921, 0.10607649, 0.079924986, 0.050744686, 0.020947205, -0.010513281, -0.042713385, -0.074581265, -0.10416928, -0.12613408, -0.13817233, -0.13905995, -0.12794624, -0.10512564, -0.0724741, -0.03330915, 0.008892997, 0.04972967, 0.0856692, 0.10989886, 0.11647565, 0.1036622, 0.072286576, 0.030765947, -0.012528987, -0.05057391, -0.076850034, -0.09112525, -0.09383236, -0.08633816, -0.0721254, -0.05101066, -0.022126336, 0.012621684, 0.050631255, 0.08640615, 0.11225526, 0.12228039, 0.1137231, 0.089021064, 0.055253137, 0.020616375, -0.009721082, -0.033503637, -0.051208917, -0.06513289, -0.076396935, -0.086218685, -0.09285595, -0.09327579, -0.08651635, -0.072102085, -0.052257843, -0.028525785, -0.0025249661, 0.022636466, 0.04451144, 0.058664188, 0.06333855, 0.058942538, 0.04578927, 0.027056534, 0.0065311543, -0.010970132, -0.021484556, -0.023576992, -0.019048203, -0.012696081, -0.00855092, -0.009549763, -0.015093442, -0.022197686, -0.02679889, -0.025100593, -0.016948462, -0.003474468, 0.012090502, 0.025805153, 0.03514283, 0.03792011, 0.034550864, 0.028236803, 0.020961443, 0.013761151, 0.0074254777, 0.00045731888, -0.0064904094, -0.01278156, -0.017886, -0.019124927, -0.01652631, -0.009197776, 0.0008541794, 0.008928533, 0.014706254, 0.017577372, 0.017871846, 0.017312892, 0.015456622, 0.012992633, 0.011675289, 0.011871179, 0.014635368, 0.01979863, 0.026339293, 0.03421447, 0.041149255, 0.044163033, 0.040159415, 0.028035408, 0.010356174, -0.008106108, -0.020838302, -0.023156773, -0.013416274, 0.005380225, 0.028124496, 0.04928338, 0.06237346, 0.06574796, 0.05986279, 0.046635874, 0.030489424, 0.013584177, -0.0019708353, -0.015118878, -0.026053233, -0.03388947, -0.03892213, -0.04136013, -0.04102624, -0.037715778, -0.03166976, -0.023672566, -0.01356538, -0.0014137591, 0.013402551, 0.03022969, 0.045884196, 0.057583462, 0.062443733, 0.058695916, 0.04689946, 0.02872845, 0.0063638566, -0.017961692, -0.041833904, -0.06285013, -0.07954427, -0.09001837, -0.09303424, -0.08812184, -0.07333235, -0.049727555, -0.019143846, 0.014752126, 0.044570476, 0.066332296, 0.0755103, 0.07098627, 0.056585398, 0.03512887, 0.012239117, -0.009558299, -0.030435514, -0.047960125, -0.06126313, -0.06881313, -0.0683487, -0.061385248, -0.049888976, -0.035870202, -0.023313913, -0.013850733, -0.007944882, -0.004461372, -2.9318408e-05, 0.006771457, 0.016468225, 0.027485143, 0.03629908, 0.040114406, 0.03768572, 0.029950427, 0.019726869, 0.009969551, 0.0011128142, -0.006279962, -0.011766602, -0.015658947, -0.017491288, -0.017924996, -0.016259074, -0.012184249, -0.0071321107, -0.001945102, 0.0019205434, 0.0039902846, 0.0038753205, 0.0011843418, -0.003932468, -0.0112914825, -0.019291082, -0.026563244, -0.031757697, -0.033085555, -0.028364368, -0.01584127, 0.0041021807, 0.028384287, 0.051549036, 0.06861841, 0.07541984, 0.07091946, 0.0572048, 0.037010975, 0.014223118, -0.008069797, -0.028032148, -0.04521205, -0.058864158, -0.068836555, -0.074780464, -0.07563061, -0.07227345, -0.06358446, -0.051108662, -0.037453167, -0.02300987, -0.010474105, 0.00025467423, 0.009154435, 0.016117118, 0.022653542, 0.027341232, 0.028970731, 0.027172955, 0.0222056, 0.015641008, 0.009203783, 0.0030929544, -0.0031975054, -0.009353824, -0.015421326, -0.020168928, -0.021602876, -0.018063998, -0.007789054, 0.008864662, 0.029047793, 0.048407298, 0.06080039, 0.061585482, 0.050484683, 0.029236695, 0.0031497236, -0.021106558, -0.039830327, -0.049991686, -0.05152011, -0.045970764, -0.03486838, -0.021299724, -0.0067697717, 0.0072472095, 0.018990373, 0.02725113, 0.031244691, 0.031257737, 0.028061029, 0.02369435, 0.019341446, 0.016172888, 0.015200198, 0.016427414, 0.019926595, 0.023989322, 0.0274377, 0.030281136, 0.03272544, 0.03352365, 0.030590625, 0.022857066, 0.009455903, -0.0074923574, -0.023811743, -0.03507348, -0.038207203, -0.032119624, -0.01852121, -0.0009053464, 0.018149199, 0.034168497, 0.045880478, 0.052939765, 0.05556013, 0.057814576, 0.059202675, 0.059857793, 0.059114635, 0.053751413, 0.043905105, 0.028245587, 0.007987355, -0.013024705, -0.033711575, -0.05243719, -0.06760425, -0.079032816, -0.08434045, -0.0813598, -0.070164025, -0.050838664, -0.026227852, -0.000120151526, 0.023938032, 0.04237925, 0.053418208, 0.056781724, 0.054577712, 0.048401207, 0.04009516, 0.030119937, 0.016628949, 0.0008278131, -0.01601819, -0.030847045, -0.03978815, -0.042249557, -0.03852407, -0.031954594, -0.026057797, -0.023153128, -0.025056705, -0.03053186, -0.037325136, -0.04290099, -0.045188107, -0.04367394, -0.039542917, -0.034270283, -0.02942258, -0.026845131, -0.026899101, -0.029312158, -0.03272658, -0.036046896, -0.037818108, -0.03655761, -0.031482626, -0.019945879, -0.002306711, 0.019099768, 0.040601417, 0.05588486, 0.06104931, 0.05466783, 0.037749782, 0.013724357, -0.012486246, -0.03713394, -0.056789313, -0.06891355, -0.07399294, -0.071290195, -0.06208642, -0.047366712, -0.027091375, -0.004233841, 0.020061582, 0.042608973, 0.059123397, 0.068508685, 0.06918476, 0.06204928, 0.050652936, 0.036832493, 0.02238839, 0.008334176, -0.006310324, -0.02042304, -0.032256432, -0.040509365, -0.043285318, -0.040617894, -0.033524986, -0.023709927, -0.013430901, -0.0038644592, 0.0047280346, 0.013092049, 0.022771351, 0.034643274, 0.04700501, 0.056630664, 0.059736896, 0.05330657, 0.038129587, 0.017415669, -0.0040975, -0.021884006, -0.033496387, -0.037289422, -0.03411034, -0.025965419, -0.0147226835, -0.0026172786, 0.009094314, 0.018850448, 0.025169581, 0.027448708, 0.025213972, 0.018617027, 0.008945901, -0.0027597337, -0.01542247, -0.026616795, -0.03451345, -0.038390793, -0.03852954, -0.035187643, -0.027979169, -0.01744551, -0.005540178, 0.005393705, 0.013038154, 0.014918985, 0.011002704, 0.0026271807, -0.0067306156, -0.012833325, -0.014491015, -0.009710728, 0.0002442515, 0.012144067, 0.023915425, 0.03087324, 0.03142605, 0.026050927, 0.015520685, 0.0035560948, -0.0073910537, -0.015922397, -0.019994993, -0.020251455, -0.017902682, -0.012362195, -0.004803948, 0.003477828, 0.010913493, 0.014741311, 0.014025414, 0.008601704, 0.00010101006, -0.008642863, -0.015942493, -0.020074323, -0.019956322, -0.015934534, -0.008890893, -7.587575e-05, 0.009210031, 0.018930597, 0.02863539, 0.036931172, 0.042640623, 0.043455716, 0.037860777, 0.02677083, 0.013300169, 0.0017985058, -0.0043780548, -0.0035269333, 0.0033941783, 0.013672737, 0.022915155, 0.026693722, 0.023489136, 0.0135628795, -0.00027649672, -0.014777532, -0.026982917, -0.03354782, -0.03336549, -0.026701005, -0.015071153, -0.0009572825, 0.012893425, 0.0246355, 0.032622263, 0.03490908, 0.031441033, 0.023489438, 0.013976148, 0.004877696, -0.0019151433, -0.005659553, -0.008424066, -0.010556838, -0.013578536, -0.016825609, -0.01838412, -0.018464424, -0.015934385, -0.01208006, -0.0074486244, -0.0025572404, 0.0004945706, 0.0024450347, 0.0034847276, 0.0037910303, 0.0049476824, 0.0065772515, 0.007343808, 0.0068000886, 0.0031484386, -0.0044383183, -0.014853113, -0.026607163, -0.03645412, -0.042948194, -0.046331022, -0.047283392, -0.046921745, -0.044837654, -0.040500708, -0.03388806, -0.025578104, -0.015795713, -0.0060382206, 0.0016319705, 0.0067700637, 0.008096372, 0.006831041, 0.005435302, 0.00489029, 0.006228683, 0.007837975, 0.007728562, 0.0046897326, -0.0018313965, -0.010045399, -0.017822254, -0.023264715, -0.025650516, -0.025496721, -0.024054429, -0.022100354, -0.019356783, -0.015917087, -0.010864541, -0.0038908322, 0.004072851, 0.011710837, 0.01719329, 0.019463612, 0.01729262, 0.010410115, -9.892963e-05, -0.013063582, -0.02670101, -0.03914325, -0.04893141, -0.053926528, -0.05217249, -0.0424269, -0.024091754, -0.0006016099, 0.023956202, 0.045505323, 0.05884516, 0.06346285, 0.06048403, 0.052037098, 0.041339993, 0.030256156, 0.022306455, 0.018588262, 0.017254468, 0.017419124, 0.016992893, 0.015146184, 0.0126471305, 0.008217581, 0.0024312718, -0.0034494852, -0.009865394, -0.016192446, -0.021725781, -0.024566049, -0.023118526, -0.016327202, -0.004291376, 0.008523766, 0.017916322, 0.02378732, 0.028154572, 0.02772318, 0.020758122, 0.0121140415, 0.0021830604, -0.009152775, -0.02148827, -0.033265572, -0.04211964, -0.048663706, -0.048263703, -0.038508892, -0.021879688, -0.0025555277, 0.013507032, 0.026217366, 0.033934645, 0.03560598, 0.03543638, 0.034611415, 0.033455785, 0.032985937, 0.03159189, 0.026560623, 0.01871268, 0.008248812, -0.004700599, -0.017850723, -0.029046493, -0.033240598, -0.031367287, -0.0269813, -0.01849538, -0.0071388525, 0.004712924, 0.014408615, 0.020172715, 0.022521418, 0.020364935, 0.013654247, 0.006844462, 0.0026227848, 0.0005947707, 0.0028079217, 0.00713532, 0.009788913, 0.010550406, 0.009711003, 0.0100067, 0.011171666, 0.012443731, 0.016254582, 0.021054456, 0.024397897, 0.025387049, 0.021803297, 0.013316869, 0.002180051, -0.009612969, -0.018561056, -0.023101702, -0.024961652, -0.023572521, -0.020144567, -0.016719002, -0.012114523, -0.0065199584, 0.00023561505, 0.008220011, 0.014933467, 0.019751154, 0.02233976, 0.021140622, 0.017484514, 0.013165801, 0.008077935, 0.0032249577, -0.0014068818, -0.006837824, -0.012094791, -0.016522935, -0.018793872, -0.017725825, -0.013803432, -0.0069799665, -0.00019358458, 0.00236183, 0.0007332883, -0.0031193057, -0.006163105, -0.005961807, -0.0032468438, 0.0016635396, 0.00785372, 0.0123655675, 0.012900447, 0.008389103, 8.702727e-05, -0.010233368, -0.020639788, -0.028445005, -0.032021597, -0.031895738, -0.029208768, -0.02451316, -0.019842211, -0.0145265525, -0.0088305, -0.00533545, -0.0026723885, -0.0013962117, -0.0011098435, -0.0005282977, -0.00040666334, 0.00052463904, 0.0006959088, -0.0016705943, -0.0058454787, -0.01190253, -0.018735299, -0.024895048, -0.029077487, -0.028547073, -0.023575392, -0.016481038, -0.0071394574, 0.0027857358, 0.011385726, 0.017843787, 0.020967215, 0.021224013, 0.019012442, 0.014720589, 0.00852114, 0.00096088945, -0.0071378932, -0.014700206, -0.019416431, -0.020306388, -0.016378222, -0.008783922, 0.00021394769, 0.010350707, 0.019541854, 0.026443, 0.030436749, 0.031238168, 0.029665703, 0.024840584, 0.016503382, 0.005906449, -0.0049094316, -0.014471356, -0.020595351, -0.020525027, -0.014544879, -0.0038856033, 0.008296061, 0.018680794, 0.025969392, 0.029305108, 0.029909179, 0.02916758, 0.027673287, 0.025309024, 0.02190847, 0.016859358, 0.0092925485, 0.00030950297, -0.009153151, -0.017737346, -0.023892974, -0.026956988, -0.02648089, -0.022258135, -0.015784102, -0.009785077, -0.0041901655, 0.00040374103, 0.0029319567, 0.0033903534, 0.0013594397, -0.0011432373, -0.0024664574, -0.0013386223, 0.0034736604, 0.010883918, 0.01953181, 0.02725503, 0.031701114, 0.03252909, 0.029676404, 0.024070699, 0.018614322, 0.013969397, 0.010861841, 0.01024952, 0.010102916, 0.009703831, 0.008181423, 0.0044271844, -0.0005847166, -0.005307204, -0.008191564, -0.008779435, -0.0070615145, -0.0045141424, -0.0016451429, 0.0020263197, 0.005758865, 0.0109466445, 0.016575426, 0.020872645, 0.024291962, 0.025403718, 0.02483724, 0.022977915, 0.019130941, 0.01436822, 0.007873179, -0.0012182053, -0.012873391, -0.02653395, -0.039612874, -0.048636414, -0.050508216, -0.04379897, -0.029911885, -0.012419538, 0.00504197, 0.01979696, 0.030057356, 0.035552844, 0.038752206, 0.040930927, 0.041141443, 0.040058594, 0.037596464, 0.03172552, 0.020767108, 0.0073654964, -0.0051226243, -0.017216008, -0.028495213, -0.037078843, -0.040933758, -0.041848127, -0.04151031, -0.0375006, -0.030582134, -0.022400612, -0.014245193, -0.0068431287, -0.0005694194, 0.0028255887, 0.004779582, 0.0064971363, 0.006949048, 0.006341616, 0.00370624, -0.0028841703, -0.0130146975, -0.025334613, -0.03668803, -0.0432951, -0.04419772, -0.03772137, -0.02451081, -0.009156078, 0.004925163, 0.016316395, 0.024116289, 0.026437877, 0.023621755, 0.018389883, 0.012843131, 0.0070328517, 0.0007594147, -0.00465961, -0.009759305, -0.013521684, -0.014433786, -0.014190374, -0.013730276, -0.013985016, -0.015374252, -0.017971287, -0.021849087, -0.025170574, -0.026266921, -0.024870433, -0.022043018, -0.018572534, -0.01523173, -0.012935812, -0.0111115, -0.008019159, -0.0018007095, 0.0067483303, 0.015720751, 0.023510613, 0.02813732, 0.02879182, 0.026026208, 0.02211668, 0.019350315, 0.018673612, 0.019517168, 0.02047469, 0.01942948, 0.01458949, 0.0070134196, -0.002050817, -0.010406439, -0.016862247, -0.020904738, -0.019786201, -0.015041927, -0.008005291, 0.0013369673, 0.010753122, 0.020486463, 0.029753946, 0.036521424, 0.039809868, 0.03860142, 0.034118235, 0.02792656, 0.020266041, 0.012764806, 0.006250721, -0.00014676282, -0.0063783056, -0.013122147, -0.019007431, -0.021743195, -0.021994945, -0.018523853, -0.010916052, -0.0014384015, 0.00838854, 0.016233634, 0.020566858, 0.021478437, 0.01921876, 0.014792201, 0.010038486, 0.0059076813, 0.0020495045, -0.001862543, -0.006791496, -0.012348139, -0.016494429, -0.018432127, -0.017942004, -0.015968373, -0.014200314, -0.01289988, -0.012056781, -0.0114448685, -0.009979758, -0.007762605, -0.0044439724, 0.00013889212, 0.0034200384, 0.004336749, 0.002542813, -0.0009804157, -0.003472664, -0.0039255093, -0.001040998, 0.004410181, 0.009855303, 0.012912237, 0.012485598, 0.009860496, 0.0057808086, 0.0017722283, -0.0010959897, -0.0024025517, -0.0028889927, -0.004328552, -0.0062988373, -0.008141722, -0.008474797, -0.007157484, -0.003983544, 0.002195201, 0.009554159, 0.016609563, 0.021583773, 0.022562949, 0.02022596, 0.015035994, 0.0072272974, -0.0018068528, -0.011231598, -0.018986685, -0.022273313, -0.020290712, -0.011771901, 0.0012195803, 0.014567902, 0.02612755, 0.032667078, 0.03344951, 0.02966283, 0.0230027, 0.016597446, 0.012552052, 0.012397977, 0.016073078, 0.021706162, 0.026615733, 0.029057633, 0.028394563, 0.023629852, 0.01590982, 0.006831606, -0.0028488752, -0.012344587, -0.021988906, -0.030704694, -0.036480244, -0.038159303, -0.03523961, -0.028466647, -0.019082917, -0.008649432, 0.0017175782, 0.0107956035, 0.016905194, 0.019799039, 0.01967275, 0.015978064, 0.008634335, -0.0017659311, -0.014212063, -0.026385847, -0.035473865, -0.03895615, -0.03612186, -0.028609496, -0.01888996, -0.010146295, -0.004179037, -0.0014766391, -0.0010924622, -0.0010888884, -0.0006509785, 0.00075958046, 0.0023939547, 0.0032790483, 0.0019220338, -0.0026264272, -0.009042363, -0.016751677, -0.024138963, -0.02937521, -0.03187406, -0.030753182, -0.026508462, -0.020410005, -0.0133279795, -0.0064246426, -0.00042611358, 0.003833227, 0.0050753085, 0.0039906423, 0.00129657, -0.0018007006, -0.0028178473, -0.0022315078, -0.0008324166, 0.0007806983, 0.0010144755, -5.6332938e-05, -0.0018760387, -0.0039546965, -0.0050723827, -0.0039036172, -0.00073412346, 0.0035820636, 0.008218737, 0.011147301, 0.011848506, 0.009913848, 0.0052635386, 0.000497623, -0.0031368574, -0.004524526, -0.0028890132, 0.00024965173, 0.0039855046, 0.007351846, 0.010170651, 0.012642429, 0.013635415, 0.012462588, 0.009002238, 0.0035856564, -0.0028922635, -0.009459684, -0.0149050085, -0.017363552, -0.0164582, -0.012766546, -0.006583006, 6.7013198e-06, 0.005693131, 0.010678371, 0.01535742, 0.020817636, 0.026946148, 0.03209784, 0.03471618, 0.033596043, 0.028331386, 0.020251017, 0.011303162, 0.0038191138, -0.00037488155, -0.0011564273, 0.0007934154, 0.0036385525, 0.0060199816, 0.007877537, 0.008762794, 0.008875273, 0.0091114715, 0.0098762, 0.012009805, 0.014848681, 0.017337821, 0.019834917, 0.021058585, 0.021457558, 0.020619405, 0.016397385, 0.009763004, 0.0002943442, -0.010295607, -0.01871705, -0.024093894, -0.02481085, -0.021631144, -0.016376236, -0.010729665, -0.0062712464, -0.0031722202, -0.0016902275, -0.00047882236, 0.0015201531, 0.0047618225, 0.00927072, 0.013396073, 0.016653134, 0.01752722, 0.015211597, 0.010926654, 0.004954871, -0.0010030707, -0.006378211, -0.011273966, -0.015151489, -0.018746916, -0.020930912, -0.020330127, -0.016619144, -0.010211726, -0.0025617874, 0.005370261, 0.012095959, 0.016601596, 0.018948924, 0.019165084, 0.017681675, 0.0148271965, 0.010320176, 0.003574862, -0.0055393255, -0.015633404, -0.02426832, -0.0286291, -0.026864441, -0.019690137, -0.009099038, 0.0014781042, 0.008947451, 0.012132808, 0.010563759, 0.006049613, 0.00040776504, -0.004785763, -0.008077702, -0.01068791, -0.012643025, -0.013301604, -0.013225827, -0.011827081, -0.009303384, -0.005936694, -0.0011904981, 0.0032133153, 0.006389537, 0.007988078, 0.0064207707, 0.0029065912, -0.0024190703, -0.009979777, -0.018066132, -0.026543243, -0.03394845, -0.03801919, -0.037523966, -0.031535905, -0.021085173, -0.0085310675, 0.0035711727, 0.013638604, 0.020321695, 0.023623874, 0.024741286, 0.024680799, 0.025436915, 0.02626769, 0.026161749, 0.025062146, 0.02094018, 0.013734242, 0.003957646, -0.0072502284, -0.01754747, -0.025194043, -0.028859865, -0.02937529, -0.027731624, -0.024347508, -0.019309735, -0.012667442, -0.004829554, 0.0037349516, 0.011543639, 0.018115332, 0.022580048, 0.02404387, 0.023032606, 0.01986723, 0.015192505, 0.009526629, 0.0030796842, -0.0045796866, -0.012834475, -0.020387728, -0.025571343, -0.026226992, -0.02214108, -0.013909946, -0.0046559777, 0.0031888497, 0.008667376, 0.010079035, 0.009344266, 0.0075643305, 0.0061252867, 0.007330965, 0.0094547765, 0.01170674, 0.013363716, 0.013470138, 0.012658511, 0.010588066, 0.008447786, 0.0073780133, 0.007065313, 0.008018598, 0.00918661, 0.009578063, 0.009613077, 0.008718288, 0.006825663, 0.0045963437, 0.0017579318, -0.0018550801, -0.0049229492, -0.006320574, -0.0055147293, -0.0020217064, 0.0029974906, 0.008302858, 0.0128449295, 0.015370597, 0.016027983, 0.014990094, 0.0133393565, 0.0123789, 0.01159228, 0.011119364, 0.010554638, 0.008416083, 0.0044755004, -0.0011466243, -0.007853816, -0.013710475, -0.016848944, -0.016217997, -0.011761447, -0.005423693, 0.0014364902, 0.008528615, 0.014761097, 0.019925348, 0.023467349, 0.024431895, 0.022384802, 0.017104976, 0.00910383, -0.0005554608, -0.010186926, -0.018702012, -0.024936197, -0.028450327, -0.029736476, -0.029441949, -0.02857145, -0.026043136, -0.02098706, -0.012496746, -0.00013817697, 0.013383222, 0.025689196, 0.03430984, 0.03792384, 0.036971908, 0.0312353, 0.0228221, 0.014443741, 0.0063364725, -0.0008709413, -0.00688496, -0.011928249, -0.015453088, -0.017805556, -0.0183095, -0.016581282, -0.0136279175, -0.008920346, -0.0027976835, 0.0034132865, 0.009654486, 0.015644075, 0.020365126, 0.02340722, 0.023330398, 0.018983673, 0.011915159, 0.003569457, -0.0033121456, -0.007079672, -0.009192513, -0.009121189, -0.0068319137, -0.0045389254, -0.004065081, -0.005064041, -0.0055573564, -0.005047051, -0.0035392682, -0.00034464776, 0.0044486164, 0.00857606, 0.010233444, 0.009370317, 0.0053819763, -0.0011583839, -0.008941775, -0.01553382, -0.019175429, -0.020783234, -0.019587845, -0.016355915, -0.0120652495, -0.0059681726, 0.00057046046, 0.0070033534, 0.012514289, 0.015799308, 0.016734652, 0.015661629, 0.012984015, 0.009118584, 0.0053854166, 0.0012640784, -0.00414993, -0.010797161, -0.01833939, -0.02538492, -0.031178182, -0.03304377, -0.028894978, -0.020621343, -0.0098514445, 0.0006029627, 0.00774626, 0.011342435, 0.010922337, 0.0076287906, 0.003424795, -0.0007973683, -0.0033386203, -0.004880833, -0.0060272194, -0.0060283598, -0.00538242, -0.0037093686, -0.0013917132, 0.0014641995, 0.0056661656, 0.009789234, 0.012097111, 0.012401237, 0.0105752535, 0.006338444, -1.0204861e-05, -0.008221686, -0.017241687, -0.025495464, -0.031760365, -0.034378666, -0.03199529, -0.024557218, -0.013652786, -0.0016979766, 0.00874847, 0.015549571, 0.018192671, 0.01757251, 0.015038457, 0.012115268, 0.010162687, 0.009949699, 0.011166087, 0.012810006, 0.013937189, 0.01322633, 0.010888588, 0.008229656, 0.005741782, 0.0041581606, 0.003370426, 0.0028773716, 0.0024250667, 0.0016532753, 0.0009685119, 0.0013120484, 0.003236172, 0.0064086607, 0.010131596, 0.013660061, 0.016625002, 0.018218298, 0.018049102, 0.016938629, 0.015426373, 0.01346665, 0.009859541, 0.004480903, -0.0018231894, -0.0081232535, -0.012068748, -0.012095459, -0.0074486854, 0.0013350212, 0.011616444, 0.020839758, 0.026778731, 0.028007606, 0.02508695, 0.01990616, 0.014286605, 0.008701945, 0.0030819247, -0.0018832614, -0.006108391, -0.009664635, -0.011985064, -0.012880415, -0.012226836, -0.009353313, -0.004148824, 0.0016600604, 0.0066621215, 0.010415345, 0.012745499, 0.013708307, 0.013033513, 0.010982056, 0.007248805, 0.001821226, -0.0037198167, -0.008131662, -0.010538813, -0.010489634, -0.008628445, -0.006157203, -0.004237812, -0.0038410933, -0.0044083106, -0.0052152826, -0.006311799, -0.0062006265, -0.0045414763, -0.0020254971, 0.0010653938, 0.0029743752, 0.0027394702, 0.00023213735, -0.004126459, -0.0084753735, -0.011263497, -0.011749573, -0.0100410655, -0.006673275, -0.0023786786, 0.002222744, 0.0067763575, 0.010760315, 0.01346842, 0.013638934, 0.01087865, 0.005566028, -0.0019638154, -0.010648455, -0.019175915, -0.025516475, -0.028199758, -0.027890297, -0.025684977, -0.022852696, -0.020231757, -0.016939074, -0.012347996, -0.0059613334, 0.0026580424, 0.011838477, 0.020128092, 0.025992295, 0.027700067, 0.0257715, 0.021296917, 0.016257908, 0.012246815, 0.009059576, 0.0069492105, 0.00556189, 0.0039194333, 0.0017479364, -0.0012582896, -0.004802024, -0.0077050943, -0.009224492, -0.009127477, -0.0073290514, -0.0041086855, 0.00019060302, 0.0054002916, 0.010360593, 0.013842379, 0.015058646, 0.012805537, 0.007992577, 0.0020639799, -0.0037262226, -0.007332221, -0.0089001525, -0.009171223, -0.008575913, -0.008222967, -0.008895601, -0.010402779, -0.012313645, -0.013826592, -0.013542625, -0.011553824, -0.008174494, -0.003846876, 0.00038870604, 0.0032367285, 0.0036803137, 0.002731415, 0.0012505326, 2.2887518e-05, -0.00034618127, -0.00038898722, -0.00070934964, -0.0015097052, -0.002559404, -0.0038116914, -0.0047805975, -0.0054894406, -0.0056542177, -0.0052274405, -0.0045780498, -0.0030020939, -0.0011039666, 0.0015880015, 0.0054004467, 0.008951089, 0.012048489, 0.013123906, 0.011015627, 0.00712003, 0.0027709429, -0.00015781951, -5.5483164e-05, 0.0025446033, 0.0066462164, 0.010502682, 0.011934406, 0.010186831, 0.0054243687, -0.0007573885, -0.006483136, -0.010754787, -0.012998927, -0.012964562, -0.010837225, -0.0074493634, -0.0030968206, 0.0016088682, 0.0064802617, 0.012100184, 0.017583756, 0.022152806, 0.024933605, 0.024917856, 0.022386067, 0.017393146, 0.010393679, 0.0024110647, -0.0063763177, -0.014952571, -0.021442754, -0.024645144, -0.023346098, -0.01760661, -0.008928462, 0.0010002173, 0.00981746, 0.016139653, 0.019214505, 0.018975038, 0.016909711, 0.013965776, 0.011393387, 0.009917725, 0.009325506, 0.009677476, 0.009992851, 0.009329182, 0.0074525215, 0.005064568, 0.003101979, 0.001959232, 0.0012160842, -0.00024117813, -0.0022074715, -0.0048067025, -0.0071830694, -0.008112799, -0.008189714, -0.0066229524, -0.0040987083, -0.0016101878, 0.0010828486, 0.002819533, 0.003972866, 0.0046210354, 0.0047313883, 0.00502477, 0.0037779806, 0.00047166907, -0.004096558, -0.0094728535, -0.013409668, -0.01448248, -0.012554314, -0.0081276605, -0.0033928286, 7.267735e-05, 0.0008517346, -0.0020153667, -0.006776072, -0.011555081, -0.01536331, -0.017113741, -0.016680568, -0.014421535, -0.010429907, -0.005815496, -0.0016540714, 0.0022553722, 0.005764736, 0.008875385, 0.011337396, 0.012485564, 0.012806932, 0.01219493, 0.010824784, 0.009539329, 0.008004942, 0.00582153, 0.0025703383, -0.0018578123, -0.00663385, -0.010341224, -0.012244827, -0.012440594, -0.011116347, -0.009068921, -0.0068231584, -0.0054323557, -0.005173482, -0.0049417494, -0.0046694903, -0.0039040516, -0.002449583, -0.00058694166, 0.0014398496, 0.0026852698, 0.0022988946, 3.170619e-06, -0.00317803, -0.0059159505, -0.0071791373, -0.0064064357, -0.0041128797, -0.0012546614, 0.0012030223, 0.00284304, 0.003419923, 0.0024055555, -0.00031304942, -0.0043960703, -0.009461613, -0.01484151, -0.020056034, -0.024037452, -0.025437372, -0.023944948, -0.019325878, -0.013115203, -0.0072726854, -0.0031415103, -0.001909584, -0.0021850066, -0.0028091406, -0.0025936367, -0.0005459155, 0.0021402927, 0.0049457215, 0.0064699776, 0.005437027, 0.0023064394, -0.00208906, -0.005519286, -0.006654715, -0.005614052, -0.002358891, 0.0024061531, 0.007234133, 0.010734292, 0.01247198, 0.012528774, 0.011177282, 0.0090494035, 0.0066061486, 0.00434155, 0.0023810926, 0.0009215233, 0.0003905483, 0.0005135073, 0.000925244, 0.0009088545, -0.00021628871, -0.0019445413, -0.0031567682, -0.0027291153, -0.0003602479, 0.0037725102, 0.009153901, 0.01414591, 0.017584357, 0.018690698, 0.016880456, 0.0129931, 0.008046746, 0.0032081606, -0.00053845387, -0.002666027, -0.0031522422, -0.003234041, -0.0034712143, -0.004151721, -0.0050258064, -0.0046594418, -0.0026525466, 0.0007265361, 0.004729964, 0.008418306, 0.010907893, 0.011795507, 0.011575173, 0.010181103, 0.008023799, 0.005906902, 0.0038730125, 0.0020040206, 0.0007229028, 0.00024734793, 0.00055056065, 0.0019748462, 0.0038311, 0.0050071296, 0.0045023346, 0.0011845259, -0.0037861026, -0.008514847, -0.011192054, -0.010600644, -0.0072373524, -0.0015719784, 0.0038703445, 0.0063514807, 0.005445808, 0.00095727586, -0.005430186, -0.011640908, -0.016938165, -0.019972544, -0.01993807, -0.017208673, -0.012361699, -0.0062543564, 0.00026355364, 0.006785118, 0.0127978735, 0.017200546, 0.018992811, 0.017511653, 0.012552057, 0.0052035307, -0.003746758, -0.013504411, -0.022514068, -0.030586278, -0.036736976, -0.039762974, -0.03937213, -0.03457241, -0.026438149, -0.016540209, -0.005842468, 0.003261037, 0.009565968, 0.013053041, 0.013377687, 0.011549861, 0.008907131, 0.0062403865, 0.004929123, 0.004812398, 0.005250487, 0.0059648505, 0.005528319, 0.0039616115, 0.0020503832, 0.00026823176, -0.0009200263, -0.0020813732, -0.0032981234, -0.004166331, -0.005076489, -0.00575532, -0.0055092773, -0.0046805376, -0.0030359013, -0.00066470285, 0.001682571, 0.0039412673, 0.005620552, 0.0071519953, 0.009139544, 0.01113943, 0.013056277, 0.014080019, 0.01305017, 0.009841623, 0.0053260745, 0.0013319494, -0.0011453052, -0.0018252656, -0.00023700618, 0.0021054412, 0.0035781923, 0.0032392575, 0.00026521648, -0.004103992, -0.008656235, -0.01244722, -0.014613376, -0.014710956, -0.012395195, -0.00865914, -0.0044070217, -0.00043350307, 0.0025198322, 0.0044699553, 0.0051977783, 0.004630002, 0.0029461454, 0.00029645392, -0.0025082289, -0.004691344, -0.0058192913, -0.0056910105, -0.005349836, -0.005218523, -0.0053976653, -0.0057023577, -0.0048555885, -0.003223825, -0.00093199697, 0.0020893032, 0.004740377, 0.006257827, 0.006024136, 0.0040477864, 0.0007234827, -0.0033763873, -0.0074424655, -0.010424787, -0.012167982, -0.012923356, -0.01269919, -0.012691681, -0.013026166, -0.013048399, -0.011842754, -0.008222591, -0.002821421, 0.0038074176, 0.011046352, 0.017438298, 0.022161111, 0.024395816, 0.023505243, 0.019813184, 0.013450056, 0.0051996903, -0.003369941, -0.0118746525, -0.018673668, -0.022015039, -0.022057531, -0.018768072, -0.013374078, -0.0076028863, -0.0030979763, -0.00095564686, 2.9592175e-07, 0.00088446407, 0.0026522963, 0.005785881, 0.009602628, 0.012969559, 0.014380341, 0.013335615, 0.010213042, 0.006099022, 0.0024340467, 0.00021005176, -4.9369573e-05, 0.0014669108, 0.0042034606, 0.0072075655, 0.009350139, 0.010291922, 0.010300069, 0.009490207, 0.008698983, 0.008072826, 0.007157584, 0.006704547, 0.0066522425, 0.006994433, 0.0075071463, 0.0075701093, 0.0068565537, 0.0046957172, 0.0019693424, -0.0003085465, -0.0011739766, 6.2312247e-06, 0.0028768126, 0.006968171, 0.010718372, 0.013094004, 0.013538493, 0.011842167, 0.008320225, 0.0037569609, -0.00050697563, -0.0041531785, -0.0066554626, -0.008076452, -0.009333633, -0.010707544, -0.012587536, -0.014136255, -0.013883904, -0.011958021, -0.008521642, -0.0041502127, -0.00021178974, 0.0033427982, 0.005959753, 0.0072926013, 0.007790357, 0.006998312, 0.0060866894, 0.005294515, 0.0038931288, 0.002660089, 0.0016063341, 0.0011095874, 0.0015542124, 0.0023203208, 0.002649554, 0.0012175199, -0.0020564785, -0.006020096, -0.009857143, -0.011851936, -0.010717862, -0.0070634545, -0.0021098577, 0.002253175, 0.0039926684, 0.002565349, -0.0013249841, -0.007045519, -0.01298719, -0.01759557, -0.020678448, -0.020864634, -0.018301796, -0.014790953, -0.010180068, -0.004827898, 0.0003980075, 0.004663245, 0.0072758133, 0.008542423, 0.007474617, 0.003847256, -0.0007979917, -0.005315011, -0.008898071, -0.011894602, -0.014110272, -0.015338763, -0.015902499, -0.014794285, -0.011979417, -0.007863749, -0.003087569, 0.0012754869, 0.0048757363, 0.0066463607, 0.005944007, 0.0030309297, -0.0010006106, -0.0049135736, -0.007812213, -0.00790938, -0.005249228, -0.00082369416, 0.0047177337, 0.009302731, 0.012574323, 0.014898421, 0.015771477, 0.016114675, 0.015500592, 0.01325604, 0.010492664, 0.0070833284, 0.0034860447, 0.0004951905, -0.0022262195, -0.003968887, -0.0047591883, -0.004956454, -0.0042832415, -0.0035685422, -0.0024973555, -0.00022443906, 0.0029369656, 0.006502159, 0.00893347, 0.009041832, 0.0070978403, 0.0038818843, 0.00045501956, -0.0016688022, -0.0013868684, 0.00074470777, 0.0037175107, 0.0057336977, 0.0053443075, 0.0027560845, -0.0015937309, -0.006285463, -0.010008311, -0.0119551355, -0.011197983, -0.008245225, -0.00431547, -8.229855e-05, 0.0033871175, 0.0057076053, 0.0071908752, 0.007307663, 0.006837239, 0.0057574324, 0.0035154603, 0.0014932806, 0.00018597631, -0.00012072384, 0.0002684241, 0.0008613365, 0.0012022797, 0.0006268428, -0.00030247797, -0.001312594, -0.0016304732, -0.0010638312, 2.2821416e-05, 0.0013760217, 0.002235258, 0.0026280722, 0.0019852293, 0.00041247802, -0.0016759341, -0.0040340577, -0.005610544, -0.0062973336, -0.006052318, -0.005814833, -0.006524944, -0.007449116, -0.008201121, -0.007934518, -0.005691461, -0.0017258329, 0.0033425647, 0.008329021, 0.011825812, 0.013492889, 0.0131253395, 0.010359354, 0.005709976, -7.577597e-05, -0.0063017993, -0.012528951, -0.01811046, -0.021777146, -0.023334969, -0.022365442, -0.01804984, -0.01202847, -0.006384092, -0.0022435046, -0.00023387551, 0.00054270285, 0.0010238946, 0.0022657416, 0.005310998, 0.00925347, 0.0126866875, 0.014332713, 0.013690405, 0.010993398, 0.006496462, 0.0017340154, -0.0022246162, -0.004428833, -0.004450005, -0.0035775027, -0.002156086, -0.0009367389, -0.000418246, -0.00023813687, -0.0005238677, -0.00076439924, -0.00086247525, -0.000687814, 9.887724e-05, 0.0017447165, 0.004435139, 0.007614321, 0.010386778, 0.011649919, 0.01127125, 0.009560997, 0.0070141084, 0.004585165, 0.002839353, 0.002229323, 0.0019023749, 0.0007833818, -0.0011184614, -0.004249384, -0.008524362, -0.013070319, -0.017093232, -0.019610278, -0.020008452, -0.017737301, -0.013703928, -0.009782265, -0.00613216, -0.0034763615, -0.0016759943, 0.00035144863, 0.0018380107, 0.0028710964, 0.0030220489, 0.0015627315, -0.000714284, -0.0040085823, -0.00789917, -0.010875625, -0.012416112, -0.012164012, -0.010029996, -0.006726192, -0.002587103, 0.0018483851, 0.006045648, 0.010545299, 0.014289752, 0.015402376, 0.0134735415, 0.00849035, 0.0015658578, -0.0056093093, -0.011234888, -0.013750483, -0.0130915465, -0.01015334, -0.00695802, -0.0049610073, -0.004884778, -0.0069264653, -0.01024229, -0.013841273, -0.015833395, -0.015901977, -0.013692827, -0.008807153, -0.003272769, 0.002667488, 0.008388847, 0.01284498, 0.015776422, 0.016038656, 0.013779052, 0.00921443, 0.0030545623, -0.002944096, -0.007817077, -0.0114376675, -0.013526236, -0.014365799, -0.014543897, -0.0132341385, -0.010899809, -0.0077610756, -0.0034851937, 0.00082934415, 0.004890768, 0.0076312297, 0.008125632, 0.0065551633, 0.0030313013, -0.0013876408, -0.0054359, -0.007874422, -0.0077695916, -0.0053561265, -0.0016300575, 0.0024845514, 0.0059872447, 0.008373674, 0.009734842, 0.009862465, 0.009530218, 0.008920555, 0.0070254407, 0.0043843533, 0.0017787906, -0.0007749728, -0.0034898275, -0.005867012, -0.0065372624, -0.005902724, -0.004646285, -0.0023785068, 0.00045532023, 0.0036419914, 0.007783602, 0.012899845, 0.017553834, 0.020225147, 0.020129688, 0.017266484, 0.012865407, 0.0077573005, 0.0035176345, 0.001668046, 0.0013664797, 0.0018292309, 0.0018162034, 0.00019615896, -0.0027055955, -0.00697527, -0.011780584, -0.015594069, -0.017490273, -0.016492696, -0.012897817, -0.008204529, -0.0035172943, 0.00083412783, 0.004393752, 0.006575589, 0.0071013486, 0.0060882256, 0.004681377, 0.0027696225, 0.00043851405, -0.0006073577, -0.00032879764, 0.0009388573, 0.0023144295, 0.002754153, 0.002394597, 0.001136392, -0.00025096996, -0.0011558923, -0.001719142, -0.0018348595, -0.0018809553, -0.0021565082, -0.0029559084, -0.004792284, -0.007076531, -0.009354033, -0.01161372, -0.012500225, -0.011587774, -0.009516028, -0.0069974586, -0.005146638, -0.003803206, -0.0024459437, -0.00063904, 0.0019358173, 0.005128512, 0.008476636, 0.010717393, 0.011568624, 0.010889084, 0.0076196208, 0.0021204755, -0.003998972, -0.009598416, -0.014633951, -0.018684832, -0.020834472, -0.021162746, -0.019260809, -0.014974979, -0.009809362, -0.0051698573, -0.0023794414, -0.0022390543, -0.0045964066, -0.009036359, -0.013535308, -0.015791655, -0.015548174, -0.013014394, -0.009048509, -0.0050409962, -0.0015637889, 0.00060719077, 0.0017804282, 0.0027951782, 0.0035691182, 0.0047085653, 0.0066288686, 0.008545853, 0.009610524, 0.009543427, 0.008033832, 0.0057090633, 0.0031925088, 0.00028380976, -0.0023389026, -0.0045455545, -0.00578755, -0.0055655553, -0.0038628166, -0.00049670745, 0.002897679, 0.0059052953, 0.008519837, 0.010295438, 0.011902412, 0.012876764, 0.013384538, 0.014036318, 0.014318046, 0.013781442, 0.011872206, 0.008278548, 0.0038378986, -0.000906045, -0.0059182607, -0.009737694, -0.011446951, -0.010892989, -0.0083157625, -0.0050604697, -0.0015554323, 0.0014942905, 0.0037636166, 0.0057446803, 0.0071174414, 0.008000601, 0.007948127, 0.0067513543, 0.0047323545, 0.0015289873, -0.00238641, -0.0060804584, -0.008671111, -0.009898676, -0.009728975, -0.008089309, -0.0057367273, -0.002576097, 0.0016931106, 0.0063321553, 0.0106869135, 0.013546398, 0.013379411, 0.010440531, 0.0054026875, -0.0007808123, -0.0058429805, -0.008894937, -0.0095257275, -0.008265656, -0.0069965366, -0.006486715, -0.0078409305, -0.010922656, -0.014550274, -0.017944613, -0.01954262, -0.018374491, -0.014243734, -0.008037938, -0.0008776891, 0.0063799224, 0.012543139, 0.017039074, 0.01917849, 0.018451694, 0.014868347, 0.009037815, 0.0021172697, -0.004653872, -0.009928407, -0.01374047, -0.015986253, -0.016422676, -0.01570531, -0.013468373, -0.010106833, -0.005795054, -0.00042747223, 0.004718639, 0.009432225, 0.012699643, 0.013665845, 0.012809262, 0.0098516485, 0.0057788957, 0.0017986735, -0.0010719983, -0.0017317948, -0.0005318391, 0.0021286274, 0.005481712, 0.008553638, 0.011118759, 0.012597632, 0.013047369, 0.013073818, 0.012210297, 0.010506185, 0.00846321, 0.005717339, 0.0026790814, 0.0001893844, -0.0015432732, -0.002303951, -0.0020626616, -0.0009483234, 0.00052724004, 0.002120865, 0.004597865, 0.008025874, 0.011625462, 0.014215001, 0.014667948, 0.0125746755, 0.0077613485, 0.00141309, -0.004711021, -0.0091937445, -0.010840695, -0.009881305, -0.0072159874, -0.004046316, -0.0017376706, -0.0010344812, -0.00163137, -0.0032027783, -0.005041863, -0.005726733, -0.0055770567, -0.0048053334, -0.0037946166, -0.0033116424, -0.003099598, -0.003875302, -0.005412706, -0.0074530453, -0.009851923, -0.011597584, -0.012856871, -0.012623892, -0.0103086, -0.0069943652, -0.002886509, 0.0013018227, 0.004349071, 0.00598801, 0.006702218, 0.0071324054, 0.007223031, 0.0069259685, 0.006796386, 0.006183443, 0.0043788357, 0.0018852516, -0.0011730606, -0.0049512293, -0.009096501, -0.012505206, -0.014654877, -0.015250217, -0.014365048, -0.013157972, -0.011369633, -0.00908205, -0.006617981, -0.0031834415, 0.0008631861, 0.005228134, 0.009230518, 0.011945174, 0.013017928, 0.011548779, 0.007880678, 0.0029812732, -0.0024435977, -0.0073043155, -0.011281467, -0.014166737, -0.015352513, -0.0147912195, -0.012221505, -0.0076808906, -0.0026483461, 0.0019909234, 0.0054240767, 0.006298339, 0.0049009556, 0.0018777273, -0.0014454438, -0.0032117986, -0.0036061662, -0.0025825985, -0.00037170108, 0.0014953433, 0.002629484, 0.0027671172, 0.002125588, 0.0012576735, 0.0006400839, 0.0012834725, 0.002716319, 0.004276017, 0.0057610376, 0.0067449077, 0.006834154, 0.005872605, 0.004411888, 0.0021983436, -0.00043000572, -0.0029499533, -0.005209843, -0.0059561855, -0.0052325972, -0.0033972075, -0.00075410015, 0.0018801312, 0.0043145907, 0.0060546896, 0.0072025973, 0.008005872, 0.008525346, 0.009171669, 0.0091243265, 0.007793601, 0.0053691496, 0.0016609196, -0.0030253509, -0.00854551, -0.014178048, -0.01853868, -0.021075884, -0.021216726, -0.019275947, -0.016075999, -0.012038557, -0.007739704, -0.0032620833, 0.0012896404, 0.005497812, 0.008803879, 0.0108413445, 0.011406814, 0.010306636, 0.0076451614, 0.004039478, 0.0005514052, -0.0023529513, -0.0044099814, -0.0053840387, -0.0052682287, -0.004362369, -0.0026627085, 0.00019954781, 0.0033911734, 0.0062526474, 0.007834353, 0.0072715054, 0.004847102, 0.0006015277, -0.00390502, -0.006848128, -0.0073304167, -0.005176908, -0.0017803472, 0.0017821644, 0.0044707498, 0.005071001, 0.0033444855, -7.3431984e-05, -0.0042638965, -0.00795291, -0.009653732, -0.009357369, -0.0071313763, -0.003463908, 7.727332e-05, 0.0037423864, 0.0066937422, 0.0074742236, 0.006558759, 0.0036948202, 0.0001143317, -0.0031315698, -0.0061155176, -0.0074174087, -0.0079349335, -0.00848641, -0.00874688, -0.0093673505, -0.009629699, -0.00946144, -0.008935309, -0.0072810217, -0.0050370796, -0.0030697885, -0.0016365426, -0.0010604693, -0.0017266865, -0.0033040773, -0.0053429124, -0.0070564295, -0.007428604, -0.006121434, -0.0034893532, -0.00033768234, 0.0029341856, 0.0054397155, 0.0066644214, 0.006819174, 0.0057478, 0.004067121, 0.0021429313, -0.00032893821, -0.003192018, -0.0058282083, -0.008340863, -0.010611697, -0.011645537, -0.011635977, -0.010344732, -0.007897446, -0.0050937757, -0.0014687297, 0.0028471234, 0.0076311384, 0.012163835, 0.0152072925, 0.016050827, 0.01400291, 0.009351228, 0.003009324, -0.0032055154, -0.0074013714, -0.009096663, -0.008523901, -0.006488148, -0.0039297296, -0.0019618254, -0.001399966, -0.0024462799, -0.0045805923, -0.006463105, -0.0075844023, -0.00768938, -0.006519645, -0.005019841, -0.0038194887, -0.0028630642, -0.002589056, -0.003152339, -0.004546825, -0.0067758164, -0.00896792, -0.010661099, -0.011197747, -0.009738482, -0.007042633, -0.0035672204, -2.4232937e-05, 0.0025642004, 0.004466363, 0.0054338565, 0.005519854, 0.0054271603, 0.0051594866, 0.0048400294, 0.004401671, 0.003450056, 0.0019653935, -8.949731e-05, -0.0026734977, -0.005633343, -0.008536971, -0.010254681, -0.010633988, -0.009991878, -0.008345435, -0.0062076813, -0.0032808357, 0.00035725653, 0.0043948963, 0.008871747, 0.013039715, 0.01648813, 0.018333659, 0.017966764, 0.015462755, 0.010930675, 0.005326974, -0.0006478509, -0.0062838504, -0.011232209, -0.015259577, -0.017719153, -0.018028317, -0.015625775, -0.011474995, -0.0064997477, -0.0014388983, 0.0022006314, 0.0035537155, 0.0023703636, -0.00015829792, -0.00260496, -0.003895475, -0.0031391825, -0.00091689895, 0.0022271262, 0.0055756816, 0.008076002, 0.009438033, 0.009265643, 0.00801319, 0.0065165986, 0.0048154034, 0.003434902, 0.002309726, 0.0012606495, 0.0003972981, -0.0006758745, -0.0013992871, -0.002071434, -0.0028872667, -0.003360184, -0.003837735, -0.003207745, -0.0010843389, 0.0021463071, 0.0062504155, 0.00991156, 0.012856569, 0.014705739, 0.0148774665, 0.013858961, 0.012174595, 0.010381686, 0.008758499, 0.007047838, 0.0052225925, 0.003709857, 0.002223521, 0.00022737327, -0.0022123666, -0.0047863703, -0.006736492, -0.0076501905, -0.007512182, -0.0064541027, -0.0051972507, -0.003988192, -0.002830159, -0.002105482, -0.0019059355, -0.001890525, -0.0017939714, -0.0021861068, -0.003097209, -0.0043328837, -0.0061046067, -0.0077476455, -0.008934445, -0.008864955, -0.0074481075, -0.005750518, -0.0034162053, -0.0007107108, 0.0022162895, 0.0054705935, 0.008314015, 0.010373275, 0.010763528, 0.008822062, 0.0048084185, -0.00053437887, -0.0060174926, -0.009936119, -0.011173542, -0.01002075, -0.0070679123, -0.0034750586, -0.00038162625, 0.0013162028, 0.00087583205, -0.000943533, -0.003252475, -0.0055226814, -0.006406565, -0.005462432, -0.0032564106, -0.00010990302, 0.003265613, 0.006488386, 0.008754495, 0.009465013, 0.009006392, 0.006768698, 0.0037431351, 0.0012021781, -0.00095038355, -0.0018511317, -0.0019000313, -0.0015175374, -0.0007052555, -0.0001759996, 0.00013278902, 0.00020033946, 0.0004701187, 0.0008454773, 0.0008542219, 0.0007721268, 0.00017242861, -0.00089030893, -0.002503573, -0.0046687163, -0.006782785, -0.008326657, -0.008080457, -0.0059809457, -0.002340613, 0.0022595846, 0.0064358464, 0.009992613, 0.012304714, 0.012825662, 0.011995607, 0.010109388, 0.0075168237, 0.004343035, 0.00073716894, -0.0030600957, -0.0067624617, -0.009842931, -0.011581249, -0.011646097, -0.010247262, -0.007511826, -0.0039787386, 0.00013416923, 0.005217424, 0.010671447, 0.015517249, 0.018966379, 0.020056099, 0.018486088, 0.014159648, 0.0077318, 0.0012786643, -0.0038469487, -0.0068442714, -0.007596023, -0.0068412353, -0.0051074126, -0.0037244412, -0.0035570685, -0.00422997, -0.005160896, -0.0058820173, -0.006004033, -0.004945275, -0.0030932599, -0.0010703822, 0.0007823435, 0.0019260823, 0.002280146, 0.0017969673, 0.00045698017, -0.0015899997, -0.003634884, -0.0049473876, -0.0051660757, -0.003801724, -0.0013421346, 0.0015304906, 0.0043892325, 0.006406668, 0.007367478, 0.007393496, 0.006874997, 0.006480899, 0.0059952796, 0.0054757344, 0.005308989, 0.0051211934, 0.0049082544, 0.004272985, 0.0028352966, 0.0010219342, -0.0010141421, -0.0027186293, -0.0038431843, -0.004595344, -0.004899906, -0.0047796885, -0.004414186, -0.0038264045, -0.0024689976, -0.00032503202, 0.002073003, 0.0045416416, 0.006814, 0.008198712, 0.008273587, 0.0068352236, 0.0042658425, 0.0018052924, -0.00060439686, -0.0029312463, -0.0048777396, -0.0062368447, -0.0060109147, -0.004811884, -0.0027730889, -0.0001390583, 0.0018629199, 0.0027504698, 0.0013541582, -0.0017921973, -0.005492433, -0.008841654, -0.0102540925, -0.009400048, -0.0063645532, -0.0018165286, 0.003179675, 0.007622466, 0.010951365, 0.012850915, 0.013101368, 0.012690606, 0.011606058, 0.010077686, 0.008476817, 0.006362942, 0.004396679, 0.0022408972, 1.5784908e-05, -0.0021081606, -0.004429605, -0.0061352802, -0.00744955, -0.0074725873, -0.0056656585, -0.0028835677, 0.00090545305, 0.004743491, 0.007948035, 0.009969966, 0.010357395, 0.009835955, 0.008785616, 0.007397832, 0.0056955, 0.0038757178, 0.002181663, 0.00054354675, -0.0012018067, -0.0034978513, -0.0061609196, -0.008534865, -0.010019779, -0.010158624, -0.009030128, -0.006797124, -0.003806558, -0.0008112833, 0.0017339692, 0.003605878, 0.004702761, 0.004914691};
-constexpr float kLanghof[4096] = {-0.0041887416, 0.005263367, 0.0071935947, 0.1097786, 0.15218052, -0.29072213, -0.11621247, 0.18615744, -0.09056391, 0.04236087, 0.016419971, -0.034519777, 0.061197333, -0.039819077, 0.025990551, -0.0053477483, 0.0005089118, 0.014646799, -0.015527073, 0.023107821, -0.0148482565, 0.013688471, -0.00080360676, -0.0016167589, 0.011612271, -0.008669897, 0.012221071, -0.0047104447, 0.0054574735, 0.0023853653, -0.00066834805, 0.006352773, -0.002285493, 0.005820076, -0.0001128612, 0.0032989902, 0.0023806065, 0.0015001497, 0.0036226541, 0.00093352876, 0.0032751416, 0.0015479068, 0.0025059024, 0.0020172729, 0.002315298, 0.0021767216, 0.002232621, 0.0020615282, 0.0020798713, 0.002347541, 0.0017414629, 0.0024867987, 0.0016466915, 0.0025198024, 0.0018412523, 0.0022612128, 0.0020910583, 0.0017153663, 0.0024398654, 0.0015408692, 0.0023972287, 0.0016860962, 0.002172808, 0.002085127, 0.001931409, 0.002418655, 0.0018403815, 0.0022787845, 0.001772002, 0.0022386527, 0.0019739894, 0.0020847644, 0.0020484563, 0.0015692173, 0.0020671103, 0.0016640131, 0.0021143048, 0.0018228412, 0.0019686325, 0.002014786, 0.001956066, 0.00219487, 0.0018193888, 0.0022835976, 0.0019216217, 0.002056262, 0.0016551599, 0.0018248288, 0.0020872124, 0.0017766112, 0.0020614015, 0.0015210602, 0.0022935423, 0.0018199172, 0.0022199124, 0.0018038907, 0.0013750546, 0.0027616562, 0.001449231, 0.0017020669, 0.0011141947, 0.0019710541, 0.0025028228, 0.0021544134, 0.0031951682, 0.0008180508, 0.003423288, 0.00603402, 0.0046925563, 0.0076135895, 0.008637423, 0.00718539, 0.005789581, 0.00037248826, -0.001808408, -0.006780499, -0.0044640386, 0.007757707, 0.012756373, 0.030274665, 0.041490927, 0.057037167, 0.066998966, 0.040428836, -0.0072207656, -0.116611816, -0.24939112, -0.36466718, -0.40831926, -0.3357242, -0.19101126, 0.08222004, 0.45641997, 0.6968944, 0.7166374, 0.6689995, 0.4091793, -0.025423896, -0.43564656, -0.8889004, -0.971412, -0.78414935, -0.5571274, -0.075545736, 0.23060404, 0.40557414, 0.5440149, 0.4680179, 0.38852537, 0.2249458, 0.13448448, 0.12700291, 0.025190314, 0.08116202, 0.09569081, 0.006652532, 0.066297404, 0.04411638, -0.03151456, -0.075460926, -0.21102668, -0.22080581, -0.14529327, -0.036066283, 0.1623481, 0.18289715, 0.1670127, 0.21070348, 0.1440257, 0.13359742, 0.16811636, 0.17873237, 0.23802182, 0.30743635, 0.32115966, 0.19365282, -0.005601923, -0.20217076, -0.38056788, -0.41522837, -0.32789856, -0.22774473, -0.10597112, 0.026141604, 0.04368345, -0.050038114, -0.13622098, -0.18980388, -0.2170637, -0.23202074, -0.19385481, -0.12643053, -0.048243035, 0.097049445, 0.23103163, 0.26579309, 0.17534336, 0.02412127, -0.12582578, -0.20549631, -0.15735522, -0.08959379, -0.04711611, -0.04988794, -0.11174975, -0.21686733, -0.32223633, -0.34725294, -0.33212313, -0.22668324, -0.048583336, 0.083110385, 0.22512217, 0.34365448, 0.37954533, 0.37096182, 0.31734267, 0.21545821, 0.1095691, 0.026735112, -0.06302759, -0.13972911, -0.20395148, -0.24567157, -0.20607734, -0.11766361, -0.03462048, 0.016065842, 0.044241797, 0.052519668, 0.089436166, 0.17559978, 0.22476745, 0.27289316, 0.30141503, 0.2596208, 0.1737243, 0.057989243, -0.02463684, -0.0635104, -0.02322507, 0.052240998, 0.08198582, 0.067290425, -0.030929944, -0.14192452, -0.22029799, -0.28444913, -0.31467795, -0.28898576, -0.20759211, -0.09390795, 0.033786755, 0.09362863, 0.12400543, 0.16295996, 0.16202828, 0.17473465, 0.19124025, 0.17407015, 0.1403379, 0.092245474, -0.006975752, -0.13609199, -0.24097437, -0.3244161, -0.34318796, -0.286681, -0.20011535, -0.12482027, -0.05006413, 0.044223547, 0.1282745, 0.22168165, 0.30973762, 0.35818553, 0.35741794, 0.29973343, 0.22100322, 0.15465252, 0.120194815, 0.10396165, 0.08710153, 0.0372472, -0.055427674, -0.13301398, -0.17651159, -0.16839702, -0.12287986, -0.07073709, -0.021525465, -0.016297782, 0.013675384, 0.083411224, 0.13294305, 0.18863921, 0.18746015, 0.12568134, 0.05062291, -0.036546197, -0.06674805, -0.032470502, 0.046277888, 0.11552096, 0.119956516, 0.07468403, -0.026589215, -0.14614321, -0.24700862, -0.32006338, -0.3537932, -0.34063247, -0.27770314, -0.17930853, -0.055123504, 0.060356814, 0.15996052, 0.22028926, 0.2280206, 0.21982613, 0.18558523, 0.15544327, 0.13036613, 0.08459261, 0.04041726, -0.01868904, -0.080599345, -0.12551953, -0.16011906, -0.17041837, -0.15288408, -0.111873545, -0.037779413, 0.052405816, 0.12028143, 0.15934658, 0.15183027, 0.10466511, 0.061878398, 0.029253926, 0.022581432, 0.056787744, 0.11367278, 0.17184368, 0.20238073, 0.18365212, 0.10957543, -0.010037647, -0.1465195, -0.26644927, -0.33762315, -0.3542619, -0.32614812, -0.25938725, -0.1851009, -0.11826353, -0.054800242, -0.012627782, 0.005544784, 0.013710264, 0.022227198, 0.037129484, 0.06271213, 0.096083164, 0.10860917, 0.08666157, 0.045366384, -0.022304654, -0.105172634, -0.17209242, -0.2226034, -0.24518411, -0.23417276, -0.18667744, -0.10189819, -0.018797135, 0.036185443, 0.052791484, 0.038028773, 0.015777608, 0.0048646983, 0.01262527, 0.035362735, 0.064168505, 0.06747477, 0.03986931, -0.0053773876, -0.054106954, -0.079780534, -0.073476166, -0.039771434, -0.0027415652, 0.030420097, 0.053778104, 0.063893, 0.08855359, 0.1364854, 0.20361112, 0.2628581, 0.28784108, 0.27664584, 0.24104844, 0.20693843, 0.1869432, 0.18199286, 0.16213267, 0.10476171, 0.026069975, -0.056296345, -0.11706366, -0.13625604, -0.11919335, -0.08383706, -0.04812875, -0.03130751, -0.031024376, -0.03355775, -0.033184707, -0.0037275515, 0.05434671, 0.10651544, 0.14294721, 0.14838491, 0.1138619, 0.06391442, 0.007799574, -0.0366768, -0.05466449, -0.06709711, -0.07323892, -0.07144962, -0.063408144, -0.048562773, -0.047742203, -0.056784183, -0.0690637, -0.086153366, -0.09094449, -0.079932265, -0.05507615, -0.018087715, 0.018632855, 0.048470292, 0.06792869, 0.075807, 0.078042895, 0.07522908, 0.06427069, 0.049191207, 0.035441857, 0.027051551, 0.016887551, -0.0075680185, -0.04036789, -0.08180054, -0.121763095, -0.13142549, -0.113620624, -0.07132963, -0.009532097, 0.05016114, 0.09518148, 0.11550791, 0.11680136, 0.10200431, 0.07317171, 0.03891251, -0.0034285448, -0.047395248, -0.085641384, -0.11166992, -0.11587226, -0.104760505, -0.09563517, -0.0884717, -0.07339353, -0.048227914, -0.013280146, 0.017497834, 0.034872383, 0.03384619, 0.015127641, -0.009521872, -0.038701758, -0.06316962, -0.08101938, -0.08677568, -0.07214778, -0.043189727, 0.004420904, 0.05546979, 0.09340362, 0.11135145, 0.10462043, 0.081969455, 0.049697947, 0.025183775, 0.010141585, 0.0019546386, 0.0038302273, -0.0014774598, -0.009770704, -0.012751627, -0.013918507, -0.009281411, -0.0010471279, 0.012369474, 0.028562842, 0.038186245, 0.047703885, 0.056876745, 0.058285408, 0.060376916, 0.06193589, 0.056736447, 0.050381258, 0.045735374, 0.036338955, 0.01892047, -3.241185e-05, -0.023312412, -0.044746432, -0.051973585, -0.046910513, -0.025809802, 0.007738836, 0.04137254, 0.07039261, 0.09045322, 0.09439447, 0.084014125, 0.062445797, 0.029010812, -0.00586898, -0.04332488, -0.08591118, -0.122351654, -0.14879246, -0.16013879, -0.15407212, -0.14030719, -0.12869526, -0.11895079, -0.109751344, -0.095272936, -0.067624465, -0.031116055, 0.014877179, 0.05717563, 0.08108598, 0.0936225, 0.08945265, 0.07544468, 0.0674358, 0.058029708, 0.04528862, 0.027835887, -0.00010359239, -0.030757178, -0.05930379, -0.07928402, -0.084368736, -0.08375852, -0.07348762, -0.047986288, -0.01748904, 0.011826174, 0.029125893, 0.0271321, 0.009766242, -0.015097857, -0.033024568, -0.03905878, -0.035087794, -0.020868974, -0.011094218, -0.014121653, -0.017958323, -0.02200364, -0.023856468, -0.02234083, -0.026835524, -0.0320645, -0.036105037, -0.030847708, -0.0065152943, 0.031036515, 0.081290506, 0.13097925, 0.16609554, 0.18285759, 0.17962965, 0.16122715, 0.12610047, 0.08181001, 0.03585699, -0.012438565, -0.05484283, -0.08646752, -0.104811, -0.10744434, -0.094267994, -0.06777666, -0.035246454, 4.789317e-05, 0.033567086, 0.054336593, 0.057613824, 0.046366457, 0.0258608, 0.004486205, -0.00950653, -0.009974186, 0.0019051577, 0.018338008, 0.03422238, 0.045256965, 0.05111232, 0.055177562, 0.055839036, 0.049467467, 0.036693465, 0.020164719, -0.0012325253, -0.02492736, -0.04198546, -0.048868205, -0.04546088, -0.03093969, -0.011305749, 0.0055648712, 0.018114556, 0.021411657, 0.009891795, -0.011231709, -0.034056395, -0.053503875, -0.06705405, -0.07486382, -0.075001694, -0.06510358, -0.04516634, -0.014777839, 0.02213218, 0.05359372, 0.07200427, 0.075646676, 0.064631455, 0.049096487, 0.038980816, 0.036392353, 0.040009376, 0.043868005, 0.04461586, 0.039082214, 0.02505544, 0.0064711007, -0.015689798, -0.037255045, -0.04926519, -0.04820585, -0.035411432, -0.016370868, 0.0027133347, 0.01468232, 0.014489115, 0.007303088, -0.0014925865, -0.009695188, -0.01220937, -0.007342971, 0.0013200952, 0.008639355, 0.0094660595, 0.0015123041, -0.012337788, -0.026597297, -0.03698478, -0.039988052, -0.03367133, -0.019604832, -0.003070781, 0.010627342, 0.018368037, 0.018101165, 0.010881448, -0.00011971915, -0.010032817, -0.01735627, -0.025063891, -0.03200627, -0.038420722, -0.043985542, -0.045363784, -0.043260008, -0.037151814, -0.025434738, -0.0077430285, 0.011306717, 0.027265921, 0.04093859, 0.046562787, 0.041627474, 0.029729718, 0.012641313, -0.00464796, -0.017337661, -0.02153461, -0.01719847, -0.010093808, -0.006364857, -0.009481074, -0.019119278, -0.030435951, -0.037859768, -0.04220701, -0.04380661, -0.043037347, -0.043033864, -0.04282936, -0.04202723, -0.040678635, -0.037846208, -0.032830086, -0.023948329, -0.011814288, 0.0021673057, 0.018983668, 0.036257878, 0.046425972, 0.045236327, 0.03336883, 0.012607637, -0.013271773, -0.03614927, -0.050293904, -0.05421068, -0.045935117, -0.029912673, -0.013187443, 0.00106403, 0.009141144, 0.006742743, -0.005193078, -0.019786054, -0.03233012, -0.038264897, -0.033566225, -0.018240385, 0.0040777484, 0.023509393, 0.0328192, 0.03215799, 0.024872757, 0.017436024, 0.016851362, 0.024767183, 0.036836453, 0.047965012, 0.052783266, 0.0484899, 0.038405444, 0.026335042, 0.016143931, 0.01300817, 0.018586002, 0.030559735, 0.044223864, 0.056110986, 0.06356744, 0.06280455, 0.055762704, 0.046312813, 0.03654129, 0.032184187, 0.03634157, 0.044314403, 0.051393848, 0.05623613, 0.055988833, 0.049116943, 0.036739044, 0.019059395, -0.0026273965, -0.022809405, -0.031751174, -0.02483989, -0.0045327777, 0.02281057, 0.044789795, 0.05086168, 0.036393967, 0.0051933806, -0.031782996, -0.06499747, -0.084989436, -0.0888689, -0.080613144, -0.06399361, -0.04456066, -0.027530618, -0.017869309, -0.0133019695, -0.008836526, -0.0038037146, 0.0060229027, 0.019454544, 0.030846886, 0.035411987, 0.0303495, 0.017736578, 0.000505744, -0.014516951, -0.024972895, -0.031150352, -0.03170403, -0.030204674, -0.029132191, -0.031812347, -0.038893405, -0.049281, -0.0629742, -0.07474391, -0.0802293, -0.07652945, -0.06302999, -0.041235626, -0.015348719, 0.0063188937, 0.019992113, 0.024024907, 0.01881319, 0.008041239, -0.0036702778, -0.010606794, -0.011097299, -0.0029340356, 0.013727458, 0.031357627, 0.0464138, 0.057295956, 0.060781885, 0.059884507, 0.060081664, 0.061478313, 0.06321274, 0.064383015, 0.059756342, 0.04531548, 0.02256874, -0.0030582882, -0.026330117, -0.04422808, -0.055273995, -0.06297765, -0.071128234, -0.077822454, -0.080119826, -0.07471452, -0.06014659, -0.040106773, -0.019021232, -0.0022143926, 0.010445003, 0.02347009, 0.034915127, 0.046104714, 0.057300128, 0.06338652, 0.062294763, 0.05231316, 0.037661187, 0.021157365, 0.00339343, -0.010026736, -0.018888645, -0.023044668, -0.02234535, -0.021169933, -0.02154692, -0.02394019, -0.027134087, -0.027886083, -0.022492314, -0.00846319, 0.011687923, 0.032388, 0.04922704, 0.058133163, 0.05759809, 0.05021468, 0.039803695, 0.030550424, 0.022891056, 0.014269918, 0.0035895747, -0.0112165, -0.029953962, -0.047822613, -0.062054634, -0.07089983, -0.073140875, -0.07239348, -0.073108345, -0.07598931, -0.07810053, -0.07675133, -0.06769252, -0.046576913, -0.018161703, 0.010122743, 0.033055514, 0.04496276, 0.043261364, 0.03069136, 0.011622892, -0.01130468, -0.033265527, -0.049557496, -0.059217587, -0.062422074, -0.059826296, -0.053004216, -0.044516917, -0.034873445, -0.025118014, -0.017739158, -0.012718323, -0.008498494, -5.309122e-05, 0.016294917, 0.039805003, 0.06897776, 0.09530679, 0.109709896, 0.10984762, 0.09377672, 0.065053694, 0.03155276, -0.0007879936, -0.02794677, -0.048437063, -0.059370823, -0.06112557, -0.0573502, -0.048034295, -0.03349887, -0.014156055, 0.011230314, 0.042254403, 0.07443328, 0.10163409, 0.11915772, 0.12279938, 0.111950204, 0.090693824, 0.06465374, 0.03880873, 0.017200237, 0.003780058, -0.0019205962, -0.0038597542, -0.005217358, -0.009067708, -0.01645966, -0.026893161, -0.037941866, -0.04637187, -0.050138034, -0.045532715, -0.030945415, -0.008380498, 0.018462656, 0.044292483, 0.062060535, 0.065374546, 0.05475851, 0.0328511, 0.0035091683, -0.02359394, -0.041821726, -0.05155506, -0.05384911, -0.05083376, -0.04679299, -0.042464998, -0.036316093, -0.02722659, -0.014515844, 0.0018307249, 0.021143341, 0.038002912, 0.04746165, 0.04747705, 0.036652166, 0.019575227, 0.001832022, -0.013572501, -0.024750512, -0.033526637, -0.03968694, -0.041378677, -0.038753882, -0.029782897, -0.016099289, -0.002803882, 0.007316488, 0.011984242, 0.011500138, 0.0071384995, 0.0022721349, -0.0005102804, -0.003724755, -0.0068052113, -0.008987917, -0.01192503, -0.015159304, -0.018093819, -0.020490333, -0.021328915, -0.018336961, -0.010952167, -0.002064247, 0.0055550765, 0.009847889, 0.00962059, 0.007286742, 0.006573182, 0.009043924, 0.0148929525, 0.022196162, 0.027033063, 0.026571965, 0.019264253, 0.006465784, -0.007471243, -0.02056351, -0.030636411, -0.035874233, -0.03870303, -0.040435538, -0.04113469, -0.040430218, -0.037570827, -0.03129632, -0.020237071, -0.007185902, 0.0052126553, 0.014762473, 0.016862156, 0.010887889, 0.0016139338, -0.007113345, -0.012820724, -0.012511707, -0.008067868, -0.003391378, -0.0002934168, -0.0010762867, -0.006176887, -0.014254612, -0.021591019, -0.024946619, -0.023737023, -0.01683476, -0.0065480024, 0.0052868137, 0.01763597, 0.027232911, 0.032598183, 0.028784651, 0.013939333, -0.0084414175, -0.035207383, -0.057465367, -0.06807703, -0.065698355, -0.05243721, -0.033521567, -0.013849115, 0.00045728346, 0.0074468646, 0.0095240725, 0.007139265, 0.0017312736, -0.0028319072, -0.0043843105, -0.0033213415, -0.00036150552, 0.0023741473, 0.0023570205, -0.00034083525, -0.0031529465, -0.0044379756, -0.0039648185, -0.0015660952, 0.00046940165, -0.00029677345, -0.0033461011, -0.0071732355, -0.010636207, -0.011806789, -0.009013143, -0.0020642132, 0.008071033, 0.019262588, 0.030141907, 0.03892834, 0.044246294, 0.04613925, 0.04403465, 0.037966713, 0.029779177, 0.02295112, 0.018996459, 0.018923683, 0.024446944, 0.032332934, 0.038054425, 0.040516358, 0.037545267, 0.027378887, 0.014764085, 0.004878952, -0.00037680642, 0.0007785745, 0.0066774306, 0.012803942, 0.0152455475, 0.012430629, 0.0049861036, -0.006040457, -0.016711822, -0.023283303, -0.025031338, -0.02178847, -0.016826214, -0.01332143, -0.012531924, -0.014383519, -0.014559842, -0.013002496, -0.011181619, -0.008547023, -0.006841167, -0.0039152103, 0.0030155377, 0.015117632, 0.031073125, 0.045748636, 0.05584939, 0.05720148, 0.04844656, 0.034519337, 0.018982729, 0.0031305784, -0.011044153, -0.02227478, -0.031154048, -0.03779911, -0.042063378, -0.044722956, -0.04609265, -0.045235913, -0.041169576, -0.034372393, -0.026101738, -0.018609274, -0.014790061, -0.014874401, -0.016422085, -0.015977824, -0.011102306, -0.0021286039, 0.009968676, 0.021699486, 0.027891485, 0.026665391, 0.018039115, 0.0038429878, -0.011823462, -0.024406364, -0.03194237, -0.03449591, -0.031213725, -0.023667792, -0.014916559, -0.0055942712, 0.0033474283, 0.008911474, 0.010539016, 0.009048919, 0.002249719, -0.009482149, -0.022413345, -0.033546455, -0.03963521, -0.03822193, -0.029547945, -0.01693558, -0.0032112813, 0.010038479, 0.01999442, 0.026399506, 0.030067533, 0.03151996, 0.032704253, 0.03297696, 0.032754812, 0.032615412, 0.03179154, 0.033808645, 0.039170384, 0.044781912, 0.047297377, 0.04175432, 0.026834194, 0.0051848446, -0.016642392, -0.031719815, -0.037753653, -0.034199145, -0.023577796, -0.012084642, -0.0035106074, 0.0024407262, 0.005647166, 0.0059430175, 0.0052325604, 0.0044508763, 0.003813788, 0.004142257, 0.0043983967, 0.0020908504, -0.00366434, -0.0116889775, -0.020149332, -0.026441917, -0.028746778, -0.028365249, -0.027462656, -0.028065031, -0.030440263, -0.033261206, -0.036368333, -0.03791629, -0.036502432, -0.032929994, -0.028078455, -0.022727443, -0.017073596, -0.01210723, -0.00729444, -0.0026942228, -0.001003958, -0.0024836473, -0.006085442, -0.011414815, -0.015965933, -0.015582138, -0.010625287, -0.003581932, 0.0042866874, 0.008639861, 0.006116368, -0.0028587948, -0.015269424, -0.026090132, -0.030640459, -0.025411053, -0.012454429, 0.0029713705, 0.016968885, 0.024455432, 0.023933817, 0.017025746, 0.0066340356, -0.00096048194, -0.0033107095, 0.00020476081, 0.008304014, 0.015344208, 0.01942992, 0.020490907, 0.019013604, 0.015747935, 0.009870752, 0.0011407931, -0.011124208, -0.024096375, -0.03206902, -0.032227986, -0.02372953, -0.007852364, 0.009933767, 0.023245638, 0.029737879, 0.02969028, 0.024738569, 0.017924769, 0.011567448, 0.0066985167, 0.0038530456, 0.0037487403, 0.0054018926, 0.0067672776, 0.008050185, 0.009841323, 0.012781767, 0.018055098, 0.02490165, 0.030796837, 0.032195035, 0.027557198, 0.01885427, 0.009291405, 0.0030007127, 0.0035819437, 0.012250156, 0.02616339, 0.040713504, 0.052056853, 0.056403343, 0.053443924, 0.045966372, 0.036001127, 0.025015729, 0.015484409, 0.008029938, 0.0010661471, -0.0034953835, -0.0045138025, -0.003583264, -0.0001502449, 0.0053020325, 0.010310795, 0.012564226, 0.0113312565, 0.007052122, 0.00034404336, -0.0052228807, -0.008022502, -0.009600299, -0.010277231, -0.012333223, -0.016480874, -0.022348898, -0.030029802, -0.036395982, -0.040234145, -0.040302344, -0.035931878, -0.030442998, -0.026022987, -0.023335597, -0.020898895, -0.01672787, -0.010718625, -0.0042221346, -0.0014301575, -0.005756414, -0.015355244, -0.026442738, -0.035504818, -0.03761112, -0.031435788, -0.020969382, -0.010453325, -0.0027908483, 0.00047760407, -0.0009799867, -0.0058240574, -0.012026301, -0.017960778, -0.021269351, -0.020521998, -0.01723038, -0.013788847, -0.012994693, -0.01637777, -0.022226095, -0.02788491, -0.029852206, -0.027429685, -0.0221726, -0.014172852, -0.004889291, 0.004738128, 0.014451112, 0.024418948, 0.034166306, 0.04112472, 0.04453986, 0.043207012, 0.035843503, 0.024774075, 0.012823576, 0.00074511673, -0.010028289, -0.018294703, -0.026075272, -0.03307347, -0.03689697, -0.036981225, -0.032893155, -0.024265863, -0.011884112, 0.0003963625, 0.009532072, 0.014170503, 0.0124031035, 0.0072329217, 0.0027419056, 0.0010969993, 0.0037298687, 0.0076317634, 0.010097794, 0.008003185, -0.0020736721, -0.01830142, -0.03793561, -0.056066353, -0.065968126, -0.06429536, -0.051321138, -0.03082719, -0.0064329794, 0.01911869, 0.042687222, 0.062794484, 0.07767822, 0.08337082, 0.07873158, 0.06626974, 0.048436064, 0.029702509, 0.0146241635, 0.0042679575, -0.0028580476, -0.009182948, -0.015678737, -0.02250138, -0.028164912, -0.030194873, -0.028232045, -0.021623444, -0.010195311, 0.0039096354, 0.01847133, 0.030497767, 0.037263427, 0.038196202, 0.033953246, 0.026861466, 0.019002477, 0.009797443, -0.0021560204, -0.016817803, -0.033443656, -0.05042529, -0.06336603, -0.0683516, -0.06424924, -0.050791677, -0.030131143, -0.007961497, 0.011181006, 0.0262666, 0.035876922, 0.039968707, 0.041130506, 0.03939419, 0.03410411, 0.026492419, 0.01798365, 0.009023624, -5.185785e-05, -0.00726241, -0.013036747, -0.01838635, -0.022553477, -0.027236942, -0.03195766, -0.034642886, -0.03373626, -0.027034543, -0.016326642, -0.0032542439, 0.010519497, 0.021233298, 0.028129695, 0.03037722, 0.02818688, 0.024400538, 0.020993546, 0.019850044, 0.019788787, 0.018244417, 0.015337443, 0.0110830255, 0.0074209324, 0.0068104966, 0.007917877, 0.007991521, 0.005451066, 0.0006851179, -0.004949406, -0.0075848857, -0.00321368, 0.0075892494, 0.021548182, 0.034140952, 0.041193753, 0.040790312, 0.03386054, 0.021959811, 0.007120904, -0.0073290416, -0.018948812, -0.025612827, -0.027554613, -0.02668671, -0.02527704, -0.026155487, -0.029492144, -0.033559028, -0.036487352, -0.03819144, -0.038645025, -0.0370756, -0.034281716, -0.02999065, -0.022779046, -0.012699537, -0.0010328976, 0.012101077, 0.024466522, 0.03244899, 0.036914416, 0.03814473, 0.035944846, 0.03267937, 0.02910465, 0.024060767, 0.016437452, 0.007675988, -0.00076702255, -0.008746783, -0.013066321, -0.012722277, -0.009151174, -0.0025755921, 0.0032830983, 0.00555551, 0.0033707386, -0.002793436, -0.008432011, -0.011440487, -0.010559512, -0.0051635318, 0.0014904821, 0.006741064, 0.008051549, 0.003996982, -0.004571865, -0.015492624, -0.024157003, -0.027542496, -0.026000654, -0.020268738, -0.012152056, -0.003739645, 0.005253158, 0.014721091, 0.021879744, 0.024031648, 0.020553295, 0.01209965, 0.0010953088, -0.0072842487, -0.009048122, -0.0042626895, 0.004698478, 0.013534651, 0.018525416, 0.018894464, 0.015107477, 0.008932806, 0.0025968568, -0.002254507, -0.004654379, -0.005093745, -0.004494035, -0.004500569, -0.006998452, -0.012473524, -0.018930601, -0.022511726, -0.02197441, -0.018827487, -0.014239629, -0.009716726, -0.007403226, -0.0072571705, -0.0074535976, -0.00736714, -0.005546301, -0.00086559367, 0.0038895786, 0.0062232274, 0.0055086548, 0.0006643655, -0.0078314375, -0.017264698, -0.025573025, -0.03293447, -0.038572766, -0.041273616, -0.042193703, -0.040444262, -0.035365585, -0.028290603, -0.018783843, -0.007973916, 0.0019724544, 0.008841732, 0.011472215, 0.012443051, 0.013722574, 0.016068364, 0.019997125, 0.023864117, 0.024872186, 0.02116968, 0.012815438, 0.00037138333, -0.015066825, -0.029664565, -0.038763423, -0.04094875, -0.0366838, -0.027118998, -0.015566792, -0.0030419566, 0.012280988, 0.02979359, 0.04740634, 0.06217256, 0.0702698, 0.06909497, 0.059178848, 0.04491841, 0.03075056, 0.020135658, 0.014669609, 0.01267239, 0.012140116, 0.011293711, 0.009254547, 0.006163481, 0.003034663, 0.0013413149, 0.0022301385, 0.0071142865, 0.015584781, 0.026121104, 0.035986323, 0.042001467, 0.04415092, 0.043305926, 0.039744586, 0.0340523, 0.026893625, 0.017442124, 0.005534026, -0.0064271586, -0.017321404, -0.025273303, -0.02740105, -0.024244513, -0.017917044, -0.0103408955, -0.0033751184, 0.0011590353, 0.003293048, 0.005952225, 0.009332394, 0.011910102, 0.014108805, 0.014282313, 0.0115592275, 0.007098263, 0.0017007518, -0.0023448637, -0.004190683, -0.0038238794, -0.002404492, -0.0036662146, -0.008514534, -0.016151696, -0.024542365, -0.030092157, -0.030584468, -0.025095208, -0.01589243, -0.0057533737, 0.0031739927, 0.0071428376, 0.0054209568, 0.00064661057, -0.0046339924, -0.008368487, -0.009273396, -0.008895831, -0.010043568, -0.012676441, -0.015301081, -0.017133296, -0.018129375, -0.018499047, -0.02044853, -0.025681267, -0.03211155, -0.03754349, -0.038847916, -0.034190252, -0.025512833, -0.01557606, -0.007857702, -0.004171548, -0.0046714954, -0.008688636, -0.0140453875, -0.018403813, -0.019767778, -0.017300049, -0.011757504, -0.005240556, -0.0010059918, -0.0018030572, -0.0065626088, -0.012705301, -0.018781148, -0.022167094, -0.022882795, -0.023521438, -0.023910325, -0.024180481, -0.024411123, -0.021537505, -0.013226191, 0.0002542731, 0.016755698, 0.03446169, 0.050405644, 0.060063932, 0.064096875, 0.06327908, 0.05706253, 0.048016243, 0.036699902, 0.0243819, 0.012876788, 0.0025843421, -0.004543569, -0.0083671175, -0.008694839, -0.005102224, -0.00035988813, 0.0032781516, 0.0045874403, 0.003520489, 0.0022775584, 0.002790191, 0.006578402, 0.013053812, 0.019821396, 0.025358161, 0.026909428, 0.021992622, 0.011569651, -0.0014089557, -0.013613374, -0.021980144, -0.025494508, -0.0257497, -0.025217265, -0.024291353, -0.02135758, -0.01614157, -0.008056224, 0.001875917, 0.00986397, 0.013860418, 0.012832533, 0.008315562, 0.0036260819, 0.0009763098, 0.0012037549, 0.00272787, 0.0040397504, 0.004283774, 0.0025722855, -0.0015786741, -0.0077374624, -0.014521456, -0.02039175, -0.023426311, -0.022190213, -0.016535394, -0.008570768, -0.00049674476, 0.0076615037, 0.015253061, 0.02248823, 0.030092025, 0.035844643, 0.038817216, 0.038850065, 0.034502022, 0.026675679, 0.017725283, 0.010308164, 0.0051218425, 0.0025010416, 0.0029889797, 0.0036215065, 0.00398652, 0.0049745804, 0.006211882, 0.008697243, 0.011726146, 0.014524309, 0.01594484, 0.0150626, 0.012436572, 0.007509305, 0.0018509749, -0.0020032283, -0.00367738, -0.0037889036, -0.00468468, -0.008061999, -0.013949763, -0.021549184, -0.027799617, -0.030550681, -0.029323107, -0.023720447, -0.014835165, -0.0055698133, 0.00018136388, 0.0010982717, -0.002058963, -0.007914178, -0.012766918, -0.014407284, -0.014018203, -0.012055598, -0.00804623, -0.0024847873, 0.005089176, 0.014410694, 0.023073662, 0.028395224, 0.028074674, 0.02255452, 0.014403793, 0.007661915, 0.005538575, 0.007806809, 0.013054686, 0.018553155, 0.02169824, 0.021211572, 0.01694526, 0.010011529, 0.0019940091, -0.005312976, -0.010527846, -0.0117780045, -0.009963878, -0.008132518, -0.006793063, -0.006745796, -0.007169545, -0.005281485, -0.000797091, 0.0054298523, 0.011779866, 0.016440686, 0.017348202, 0.013512417, 0.0074900365, 0.000563895, -0.0059922775, -0.0093538035, -0.010590352, -0.011159626, -0.011108517, -0.011165093, -0.010954227, -0.010346828, -0.0092389155, -0.0074561494, -0.0056469725, -0.003202411, 0.00019204778, 0.00419067, 0.009218811, 0.015284674, 0.022186756, 0.028046504, 0.030079603, 0.027472816, 0.019863166, 0.008850359, -0.0015864496, -0.009439917, -0.01373065, -0.0133619625, -0.009293427, -0.0037568884, 0.0012021108, 0.004626638, 0.0068565393, 0.009572968, 0.015006072, 0.02231912, 0.028579146, 0.031767584, 0.030704811, 0.026387155, 0.021352595, 0.017203094, 0.0141894, 0.010947941, 0.0055518993, -0.0023481697, -0.01133942, -0.01869416, -0.022047961, -0.02104563, -0.016735272, -0.010910807, -0.0050628223, -0.00028761625, 0.002653823, 0.00389727, 0.0037575096, 0.0025183347, 0.001564383, 0.0019233791, 0.0020349852, 0.0007468718, -0.0030397796, -0.010357339, -0.018961234, -0.02685192, -0.033217296, -0.0375001, -0.039590992, -0.04055791, -0.042084113, -0.042090844, -0.039230656, -0.03370059, -0.023593418, -0.010178392, 0.0035039776, 0.015125304, 0.022540137, 0.025842406, 0.025191447, 0.021763166, 0.017424172, 0.01186472, 0.0055923457, -0.00077086134, -0.0071909693, -0.012703063, -0.016208993, -0.016060181, -0.011507427, -0.0040845447, 0.0039996067, 0.010560888, 0.013630536, 0.01391678, 0.013345341, 0.012813586, 0.013981311, 0.017798504, 0.023455907, 0.028409151, 0.030572996, 0.02891025, 0.022347173, 0.013839842, 0.0063617583, 0.0001671743, -0.004242476, -0.007780645, -0.0105780605, -0.011223624, -0.008296452, -0.0010384956, 0.008990115, 0.018870017, 0.025047919, 0.025435884, 0.021657206, 0.017009418, 0.014724197, 0.016428176, 0.021160949, 0.026882004, 0.03134791, 0.032566257, 0.029918201, 0.024369936, 0.016697628, 0.008709639, 0.0035709497, 0.0020116712, 0.0034031905, 0.006324293, 0.008480705, 0.0088028805, 0.008383569, 0.009241061, 0.0111024305, 0.014608563, 0.019601157, 0.022042163, 0.020697042, 0.015382186, 0.0061021554, -0.0040698736, -0.012735369, -0.01790055, -0.018944139, -0.017317694, -0.013512408, -0.008761006, -0.003771964, 0.0018264882, 0.006736191, 0.010087789, 0.0114434855, 0.010486114, 0.007643067, 0.0031346558, -0.0012501329, -0.0034064534, -0.0036439155, -0.0025253359, -0.0014109116, -0.003313482, -0.0084946435, -0.015473108, -0.022905424, -0.028616443, -0.031022847, -0.028982408, -0.02404459, -0.018702632, -0.014285238, -0.013645486, -0.016658723, -0.020113995, -0.02178666, -0.020275934, -0.016358051, -0.012303473, -0.00969573, -0.008944516, -0.009178968, -0.008870844, -0.0075098276, -0.0060259313, -0.0062686703, -0.009636102, -0.0148866, -0.019242197, -0.020254722, -0.016752413, -0.009706534, -0.0009233169, 0.0073674154, 0.012957485, 0.015422428, 0.014043829, 0.008305006, 0.0006160447, -0.006719195, -0.012289087, -0.014969631, -0.015479507, -0.015928011, -0.017194275, -0.017908916, -0.01789459, -0.016578224, -0.012409133, -0.0072249626, -0.0028864427, -0.0002899487, -0.0005854316, -0.0028046095, -0.0051606176, -0.0055851107, -0.0031993778, 0.0008040753, 0.0050600534, 0.00769638, 0.0078104883, 0.006012474, 0.00340233, 0.0011177396, -0.00021810914, -5.6376826e-05, 0.0013786445, 0.0032968386, 0.0050185444, 0.007100952, 0.010478274, 0.015230195, 0.021619659, 0.027656157, 0.03055683, 0.029256944, 0.023915466, 0.015767267, 0.0064592194, -0.00047682342, -0.0031270415, -0.0017185448, 0.0038000757, 0.010426965, 0.014861091, 0.016488047, 0.016106075, 0.015260216, 0.015022062, 0.015109971, 0.014260949, 0.012034466, 0.009004371, 0.006791216, 0.0072408523, 0.010625241, 0.015205573, 0.01771732, 0.01591054, 0.009435738, 0.0005594523, -0.007189208, -0.012334943, -0.013542958, -0.011010035, -0.0071998406, -0.0032206697, -0.00040511024, -0.00021242103, -0.0026968399, -0.0065797376, -0.009804341, -0.01124307, -0.00983647, -0.0069544576, -0.005969461, -0.0069365543, -0.009636798, -0.013996435, -0.017379098, -0.018507542, -0.017474394, -0.014615553, -0.011418685, -0.008849134, -0.007271613, -0.005843611, -0.0030232435, 0.0012570422, 0.006570232, 0.011767514, 0.014989146, 0.015705738, 0.014206838, 0.011074274, 0.007249365, 0.0029684352, -0.00077653344, -0.0034350092, -0.00614679, -0.008020747, -0.008264094, -0.006626505, -0.0020675275, 0.004416967, 0.010687424, 0.013985127, 0.013293571, 0.009226931, 0.002341096, -0.004599777, -0.0092555685, -0.0103930645, -0.007441624, -0.0019294646, 0.0033407165, 0.005270025, 0.0029174339, -0.00224019, -0.007862343, -0.011673856, -0.013244394, -0.013679686, -0.013584964, -0.013558239, -0.013448018, -0.011354522, -0.007432699, -0.0033954163, -0.00079708616, -0.001994956, -0.006469447, -0.011285895, -0.014648816, -0.014454458, -0.0096892025, -0.0020318422, 0.0068213395, 0.015616914, 0.022991281, 0.027218299, 0.02752484, 0.02480361, 0.019540947, 0.014066764, 0.010323513, 0.0066002854, 0.0033198849, 0.0014883851, 0.00034500228, 0.0009066232, 0.003940947, 0.009201653, 0.015270131, 0.019928139, 0.022271192, 0.020636776, 0.0151420515, 0.008833753, 0.0036126296, 0.0011978509, 0.0021936307, 0.0050365007, 0.008049094, 0.009530467, 0.008964842, 0.0067050294, 0.002437999, -0.0028184846, -0.0076435, -0.012042509, -0.015694726, -0.01836293, -0.019366452, -0.017678676, -0.012796057, -0.0046862722, 0.0040540067, 0.010967571, 0.014710047, 0.013747466, 0.008783831, 0.0014188889, -0.0070952615, -0.0150943445, -0.020504685, -0.022900274, -0.023865636, -0.024740614, -0.026132368, -0.026723625, -0.024529839, -0.018810716, -0.010439769, -0.0013628553, 0.0068647387, 0.012667764, 0.016386839, 0.019767081, 0.022941092, 0.025384171, 0.025064582, 0.019620297, 0.010186975, -0.0009943552, -0.011466019, -0.017730743, -0.018735906, -0.015372852, -0.009049743, -0.0012071913, 0.00680348, 0.012750051, 0.016228177, 0.017174516, 0.01620288, 0.016346632, 0.01734352, 0.017679837, 0.017321566, 0.014595691, 0.008923868, 0.0017467076, -0.0058111385, -0.012481101, -0.017472189, -0.020991156, -0.02360631, -0.026138397, -0.028294628, -0.0290121, -0.027231103, -0.022023171, -0.014069031, -0.004958935, 0.0030247124, 0.008438786, 0.011447766, 0.011331266, 0.008453716, 0.0040332233, -0.0015132115, -0.0073455297, -0.013117223, -0.018475432, -0.02237654, -0.02355032, -0.020513086, -0.013623148, -0.005342853, 0.0025689106, 0.008240581, 0.010037975, 0.009127434, 0.007252, 0.005824378, 0.006624534, 0.010857199, 0.017402465, 0.023038572, 0.025080608, 0.021891078, 0.014589171, 0.0062429425, -0.001109953, -0.00598353, -0.007612394, -0.006683838, -0.004113389, 0.00072497135, 0.008383038, 0.01876726, 0.03039115, 0.03932228, 0.042984664, 0.04059558, 0.03303387, 0.023360759, 0.014714969, 0.008901016, 0.0056529786, 0.004947025, 0.0061650253, 0.0072326437, 0.007832748, 0.006956307, 0.0038406623, 0.0010757501, 2.819602e-05, 0.00039967144, 0.0018625421, 0.003126219, 0.0029677143, 0.0009619426, -0.0017351364, -0.0036180734, -0.0039344816, -0.0023434071, 0.00019857998, 0.0020026874, 0.0017050857, -0.0010241532, -0.005234936, -0.008938539, -0.010232098, -0.00826167, -0.0039325305, 0.00055369176, 0.004411922, 0.007039058, 0.007690997, 0.0069736647, 0.005655677, 0.004384936, 0.0031555323, 0.0019769226, 0.0005539319, -0.0015346935, -0.0027391678, -0.0017917225, 0.0010139168, 0.004772309, 0.007572051, 0.007530156, 0.004234283, -0.001651206, -0.009081366, -0.016473083, -0.021581808, -0.022875207, -0.020964762, -0.017807147, -0.015868474, -0.016710343, -0.01930864, -0.021634646, -0.022351833, -0.020417396, -0.016563673, -0.013081609, -0.010619719, -0.009394296, -0.008242886, -0.0050931945, -0.0013496035, 0.0012151758, 0.000755995, -0.004001421, -0.011716133, -0.020169625, -0.025527935, -0.026780834, -0.023974096, -0.016690586, -0.00804464, 0.0004541527, 0.0069177775, 0.008863592, 0.006822698, 0.002435784, -0.0015267108, -0.0039826417, -0.0041934545, -0.0022255557, -0.00039798825, 0.00064636505, 0.0010421403, 0.0011516891, 0.0015040917, 0.0025022111, 0.0037814993, 0.0043109525, 0.0036591259, 0.0016120436, -0.00048274474, -0.0008983529, 0.0018822444, 0.0082709985, 0.01622092, 0.023950078, 0.029864041, 0.03251194, 0.031366426, 0.027003856, 0.02081477, 0.013577373, 0.006358116, 0.0002989292, -0.004857211, -0.008672735, -0.009246861, -0.006208174, 0.0003598877, 0.009749328, 0.018718416, 0.024692234, 0.026276553, 0.023028007, 0.015729928, 0.005848716, -0.0035883025, -0.010041852, -0.012815197, -0.012823721, -0.012729609, -0.014044764, -0.015843298, -0.01719633, -0.01657997, -0.01267805, -0.0067618005, -0.0001243176, 0.00559849, 0.0094873635, 0.013239269, 0.01720053, 0.020771688, 0.022399476, 0.020004075, 0.013124692, 0.002128513, -0.009458049, -0.01883839, -0.025124114, -0.026100973, -0.02286251, -0.016644273, -0.007787941, 0.0008073118, 0.007316529, 0.011220776, 0.013338058, 0.014959062, 0.016547872, 0.018571768, 0.01990332, 0.018794414, 0.0149398, 0.008686781, 0.0009398585, -0.006363232, -0.012104602, -0.015701186, -0.017476665, -0.019212695, -0.020866882, -0.022127748, -0.022112103, -0.018659588, -0.011719127, -0.0025883336, 0.0070232134, 0.01570779, 0.021635445, 0.023288598, 0.021232285, 0.016073767, 0.00904057, 0.0019322819, -0.0044994336, -0.010340602, -0.015095141, -0.017594025, -0.01738803, -0.013903193, -0.0076065753, -0.0005021624, 0.0059338487, 0.010809775, 0.013680486, 0.0145434905, 0.014438892, 0.014988718, 0.01708471, 0.021027993, 0.024895387, 0.025311802, 0.021160252, 0.012617266, 0.0015260424, -0.008794292, -0.016759446, -0.02099066, -0.022160858, -0.0222664, -0.02070438, -0.017024014, -0.01063902, -0.0024492862, 0.00523251, 0.010488178, 0.010348403, 0.005697304, -0.0013526333, -0.009475499, -0.015068973, -0.01728716, -0.016439617, -0.012092928, -0.0053697187, 0.001498922, 0.0060294885, 0.0076857693, 0.006702715, 0.003966539, 0.0013810255, -0.00035920224, -0.0016010806, -0.0029286079, -0.00468914, -0.00687746, -0.008781183, -0.009609236, -0.008574401, -0.0056452155, -0.002532135, -8.2100225e-05, 0.0007508404, -0.00047654132, -0.0017386678, -0.0017286034, 0.00012525907, 0.0036592907, 0.007825137, 0.011690322, 0.013628316, 0.013482502, 0.011821373, 0.008301107, 0.004493155, 0.0017046042, -0.00076328334, -0.0029563294, -0.0043709287, -0.004524087, -0.002501411, 0.0027938287, 0.01052505, 0.01852782, 0.02535107, 0.02924352, 0.02920289, 0.025155459, 0.017821142, 0.009583739, 0.0029907161, -0.0009317712, -0.0031978206, -0.0051755486, -0.008587198, -0.013862996, -0.019071927, -0.022943974, -0.02386115, -0.021470338, -0.017515263, -0.0132882865, -0.009302426, -0.004517458, 0.0012104467, 0.0076273046, 0.013841444, 0.016478904, 0.014312604, 0.008005538, -0.001081172, -0.009915606, -0.016389314, -0.019917782, -0.020181067, -0.017261978, -0.012457604, -0.007637491, -0.00435551, -0.002720579, -0.002082053, -0.0013701551, 0.0012514075, 0.0054164864, 0.010255331, 0.014637665, 0.016504725, 0.015669664, 0.012213278, 0.0074074883, 0.0027193688, -0.0016764546, -0.005390285, -0.00919293, -0.0134155275, -0.017617973, -0.020441119, -0.019860635, -0.015875943, -0.009091039, -0.0005726229, 0.007463067, 0.01346824, 0.016846966, 0.016835252, 0.013674053, 0.009035836, 0.0038143469, -0.0017056812, -0.0072935713, -0.012611622, -0.016730346, -0.018251356, -0.016165644, -0.011259815, -0.0052416762, 0.00044362634, 0.0042764144, 0.005285393, 0.0035533041, -0.0005316429, -0.0048405537, -0.0066944775, -0.005803814, -0.0025571003, 0.0011671132, 0.0031660993, 0.003158809, 0.0017189963, 0.0007678093, 0.0013849048, 0.003985361, 0.007536689, 0.009809523, 0.011422181, 0.012786432, 0.014960419, 0.01939125, 0.024163175, 0.027205182, 0.027053144, 0.023148984, 0.016704272, 0.009755527, 0.0043567675, 0.0012436123, 0.0005908025, 0.0028179337, 0.0069607403, 0.01078881, 0.013212808, 0.01347529, 0.01150469, 0.008965635, 0.007060433, 0.0063044834, 0.006389716, 0.00646441, 0.005782703, 0.0037258582, 0.00081335905, -0.0019090426, -0.0036751903, -0.004301492, -0.00437979, -0.0047697164, -0.006764736, -0.010653174, -0.014417961, -0.016711788, -0.016918695, -0.0143603105, -0.010395493, -0.006375893, -0.002947382, -0.0011678629, -0.001615396, -0.0035622825, -0.005628582, -0.007542526, -0.009194687, -0.011074424, -0.013876359, -0.016846228, -0.018926822, -0.019075664, -0.017068945, -0.0132507, -0.00868179, -0.0047173826, -0.0016497208, -0.00056162814, -0.001394139, -0.0023062062, -0.0021737367, 0.00022568915, 0.0042289393, 0.007492408, 0.008478866, 0.0063177873, 0.002104396, -0.002458304, -0.0053688106, -0.0053070104, -0.004078025, -0.0026897634, -0.0015819124, -0.0011068556, 0.00049070345, 0.0035097408, 0.0066305185, 0.008541415, 0.0074434346, 0.0027285004, -0.0041168774, -0.01096027, -0.015705599, -0.017332701, -0.015392536, -0.009502192, -0.0015993996, 0.00630095, 0.0121432375, 0.0137757845, 0.0116524175, 0.0065832925, 0.00062402664, -0.0045613497, -0.009296511, -0.013183524, -0.016850578, -0.020723457, -0.024016589, -0.025767216, -0.024627874, -0.02036276, -0.013682372, -0.006302176, -0.0005685879, 0.0028647769, 0.0045276475, 0.0051515647, 0.005981928, 0.007706942, 0.009841489, 0.011349708, 0.011650218, 0.010157177, 0.0063500428, 0.0014349433, -0.0033096394, -0.007040337, -0.009076374, -0.009768986, -0.009555206, -0.008288032, -0.0050003747, 0.00049750705, 0.008173646, 0.01723767, 0.025362564, 0.03184582, 0.035023473, 0.03333004, 0.0276683, 0.019477174, 0.011603341, 0.005520958, 0.0014338533, -0.0015995757, -0.005544518, -0.010372531, -0.016349388, -0.021403188, -0.02255641, -0.020361243, -0.015469671, -0.009555245, -0.0046417965, -0.0006873516, 0.003293278, 0.0077663395, 0.0120287975, 0.0149818, 0.014839949, 0.010897758, 0.0041660247, -0.0037559937, -0.011288744, -0.01725953, -0.02020489, -0.019895395, -0.016782554, -0.011993491, -0.007528171, -0.0040630004, -0.0019258818, -0.00011857275, 0.002899196, 0.0070650196, 0.012364649, 0.017701017, 0.020980624, 0.02126305, 0.018541325, 0.013693302, 0.007989889, 0.0025998633, -0.0014447994, -0.004786363, -0.008733286, -0.012867518, -0.016354341, -0.018447448, -0.017899843, -0.01430981, -0.008706656, -0.0023759827, 0.003667579, 0.007912927, 0.0094043985, 0.008802747, 0.006969556, 0.004835915, 0.0031591377, 0.0013328649, -0.0008526257, -0.002721794, -0.0039411285, -0.0036359285, -0.0016208234, 0.0012573834, 0.0043291044, 0.0062157647, 0.0060945777, 0.0032945215, -0.0022786024, -0.008398267, -0.013116393, -0.014443154, -0.012209781, -0.008449088, -0.004307497, -0.002273778, -0.002911324, -0.00429535, -0.005529662, -0.0057121064, -0.005119503, -0.0048339204, -0.005769489, -0.0073146657, -0.007960016, -0.0070619765, -0.0042543546, -0.0008176327, 0.001216806, 0.0005866474, -0.001965318, -0.005086501, -0.008036599, -0.009262606, -0.008275856, -0.004543024, 0.0016301315, 0.008429946, 0.0145097505, 0.017894184, 0.018242493, 0.01642953, 0.0135033885, 0.01094956, 0.008972681, 0.007651123, 0.0062226937, 0.0037390785, 0.0006491325, -0.0028694419, -0.005890271, -0.0070319097, -0.0064654117, -0.0052873176, -0.004721851, -0.005522596, -0.0077344137, -0.0103861345, -0.012173279, -0.012954279, -0.012575305, -0.010622392, -0.008059431, -0.0061001265, -0.0047834516, -0.00421079, -0.0042565, -0.0037871138, -0.0029818455, -0.0028393343, -0.0034587597, -0.0049257544, -0.006364598, -0.0065664947, -0.0054381797, -0.0030327835, 0.00023844409, 0.0037703104, 0.0062467847, 0.0061950656, 0.0037620019, -0.00036221606, -0.004039181, -0.005419373, -0.0049385107, -0.002739381, -0.0005370917, -0.0006001195, -0.0023683943, -0.0045844275, -0.005914864, -0.005144546, -0.0027843048, -0.0004422478, 0.0006913908, 0.0006223714, 0.00035899383, 0.0007055364, 0.0020953547, 0.0037024398, 0.0034397056, 0.0009828565, -0.0027984206, -0.006957613, -0.010213804, -0.011534029, -0.0097720185, -0.0048975497, 0.0020888702, 0.010055562, 0.016842255, 0.020277184, 0.019827943, 0.016327122, 0.010886672, 0.00494093, -9.030902e-05, -0.003966044, -0.0069952393, -0.009347345, -0.011210643, -0.01232676, -0.011857626, -0.008865123, -0.0039335196, 0.0013082706, 0.00601351, 0.008663629, 0.008889345, 0.008231212, 0.0072218054, 0.006411084, 0.0063653775, 0.007094723, 0.007744697, 0.0074043027, 0.005923749, 0.0027890578, -0.00082353427, -0.0037958508, -0.0060826624, -0.0073745316, -0.00877546, -0.010220371, -0.010697846, -0.0096029565, -0.006509954, -0.0021243403, 0.0034290545, 0.00891513, 0.012339257, 0.0129772965, 0.009902526, 0.003909307, -0.002254019, -0.00667951, -0.008706284, -0.008467286, -0.007603772, -0.007857027, -0.009271264, -0.011306468, -0.012354355, -0.011196872, -0.008496933, -0.005667771, -0.0040488183, -0.0032589599, -0.0027702705, -0.0014672269, 0.0018721943, 0.0055127176, 0.008089549, 0.008693349, 0.006728035, 0.0031691415, -0.0015345616, -0.0060145906, -0.009036972, -0.010110218, -0.008509581, -0.0052635525, -0.0017990003, 0.0007367144, 0.0018959055, 0.0022714848, 0.0023107599, 0.0030720676, 0.0049310545, 0.0071854456, 0.009137287, 0.009866926, 0.008897346, 0.0065943957, 0.0043931147, 0.0035978658, 0.0042782654, 0.006132601, 0.007934919, 0.007989539, 0.006382956, 0.0040336438, 0.0014723778, -0.00062464195, -0.001737098, -0.0018635361, -0.0018212781, -0.0022487373, -0.0037034163, -0.006401818, -0.0088754045, -0.010155428, -0.00998912, -0.008582228, -0.0070168357, -0.005780037, -0.0045400243, -0.0029243813, -0.0014192299, 0.0002031703, 0.001966812, 0.0025806099, 0.001721223, -0.0015216067, -0.007684145, -0.014744802, -0.020642513, -0.023653373, -0.022196632, -0.01715653, -0.010981272, -0.005522777, -0.0020094058, -0.0002803511, 0.00083495287, 0.0026048117, 0.004730563, 0.0056622145, 0.005041803, 0.002506163, -0.0009515534, -0.0031750791, -0.0037032445, -0.0028959727, -0.0023821814, -0.003277468, -0.0052004466, -0.008149765, -0.011302704, -0.013548725, -0.01388984, -0.01111793, -0.005147253, 0.002967888, 0.011096071, 0.017183162, 0.020293774, 0.020158289, 0.017474234, 0.013814947, 0.010182863, 0.006394359, 0.002676077, -0.0012353509, -0.0060994104, -0.0108427545, -0.014318187, -0.015458449, -0.013666921, -0.010208203, -0.006357447, -0.003825021, -0.0032461947, -0.0036085227, -0.0048600817, -0.0058170096, -0.0055082203, -0.0044587003, -0.0022288202, 5.250753e-05, 0.0009218815, 0.00073252793, -0.00027295126, -0.0016160535, -0.0028805204, -0.0039452827, -0.0055144522, -0.0076001347, -0.008915607, -0.009239964, -0.007628554, -0.0035989208, 0.0021320202, 0.009244482, 0.0158872, 0.019875342, 0.020352498, 0.017355746, 0.012161085, 0.0071218875, 0.0037169086, 0.0020216468, 0.0013381017, 8.103229e-05, -0.0024900858, -0.0057743667, -0.0079682125, -0.0078031686, -0.005963765, -0.0031655484, -0.0009489028, -0.00040755578, -0.00068155455, -0.0005826393, 0.0006607254, 0.0023016043, 0.0033232032, 0.0031024676, 0.0012663406, -0.0017815724, -0.005414778, -0.008381846, -0.009852808, -0.009104019, -0.00551761, -0.00025467837, 0.005118427, 0.008872942, 0.009709748, 0.0076111923, 0.003642405, -0.0004447778, -0.0037388394, -0.0055649714, -0.0059332987, -0.005824384, -0.006038887, -0.006822778, -0.0072574285, -0.006587289, -0.004396504, -0.0009535823, 0.0019206394, 0.003162844, 0.0029000414, 0.0010393987, -0.0015697072, -0.0033399977, -0.003695797, -0.0020500154, 0.0012289246, 0.004744531, 0.0076808515, 0.009326899, 0.009908944, 0.009901532, 0.010041742, 0.01031666, 0.009780642, 0.008979439, 0.008003707, 0.007282802, 0.007603787, 0.0085131135, 0.01025483, 0.012912577, 0.015093753, 0.015142716, 0.012521087, 0.007356593, 0.0010654571, -0.0040100007, -0.006381889, -0.0057378765, -0.0035453646, -0.0015587852, -0.0015407064, -0.0035755595, -0.0059222844, -0.008291514, -0.010067946, -0.011368289, -0.013425922, -0.016365409, -0.019433461, -0.020620449, -0.019020814, -0.015423715, -0.010864815, -0.00681982, -0.0045281043, -0.0043859705, -0.0061709937, -0.009327005, -0.012919384, -0.015620058, -0.01600936, -0.0141618, -0.011052864, -0.0075664953, -0.0053027053, -0.0049854186, -0.005868976, -0.0069257193, -0.007824832, -0.008234808, -0.0077147447, -0.0072226757, -0.0074828076, -0.008101587, -0.008550947, -0.0077716406, -0.004628444, -4.7798752e-05, 0.0043810084, 0.0076918383, 0.008546004, 0.007373648, 0.0046917936, 0.00080643507, -0.0026115638, -0.0049165725, -0.005792091, -0.0058813915, -0.005991207, -0.0060331672, -0.006264195, -0.0056042755, -0.0034134556, -0.0005506933, 0.0023744456, 0.0047719255, 0.0064116106, 0.0076899254, 0.008448697, 0.008569715, 0.009066257, 0.009847777, 0.009912311, 0.008453606, 0.0047166646, -0.0008992932, -0.0070986855, -0.01168268, -0.013096345, -0.011156027, -0.006496438, -0.0016382094, 0.0016167148, 0.003483773, 0.0045132996, 0.0056192433, 0.0073629767, 0.009152338, 0.009759708, 0.008579624, 0.006398046, 0.004583606, 0.004079558, 0.0048864717, 0.005988986, 0.0062003764, 0.004862723, 0.0020736975, -0.0015353621, -0.0053716977, -0.008400924, -0.009156129, -0.0068571037, -0.0019608324, 0.0043424335, 0.0105022965, 0.014675408, 0.01621653, 0.015490447, 0.012946336, 0.0097331265, 0.0067248107, 0.004274706, 0.0019991263, -0.00073812454, -0.0035592143, -0.006247042, -0.0074799326, -0.0061846026, -0.0035421776, -0.00041128282, 0.001924353, 0.0025239002, 0.001544914, -0.0005933259, -0.0027741003, -0.0042770375, -0.004072106, -0.0023591027, -0.00021104958, 0.0018965324, 0.0023231169, 0.0011480206, -0.00065526314, -0.0033192167, -0.0063424814, -0.009675592, -0.01347071, -0.016712897, -0.01827404, -0.017958106, -0.01553403, -0.01050338, -0.0037479054, 0.003183047, 0.00880646, 0.011350814, 0.010141946, 0.0065597882, 0.0024785, -0.0005902801, -0.0010562172, 0.00058158475, 0.002070096, 0.002455094, 0.0015724711, 0.00018058677, -0.00042672048, -1.1057959e-05, 0.0010512812, 0.001594792, 0.0006349065, -0.0012502847, -0.0027933468, -0.0030609465, -0.0016573913, 0.0007514416, 0.0028095592, 0.003984999, 0.0040780883, 0.0027945414, 0.0001880371, -0.0027942467, -0.004728185, -0.005400252, -0.0046406095, -0.0024343065, -0.0003903333, 0.00035748907, -0.00015588601, -0.0016525105, -0.0033852153, -0.0044109863, -0.003963978, -0.002369194, -0.0005157465, 0.0012136564, 0.0017097354, 0.0010206504, 0.0007650651, 0.0013104099, 0.0024112654, 0.003341453, 0.0031557563, 0.0014406898, -0.0017747425, -0.0058027385, -0.00973575, -0.012258879, -0.012705652, -0.011298968, -0.008271813, -0.005146887, -0.0031806456, -0.0018634085, -0.001112236, -0.0006566753, -9.000929e-05, -0.00017503451, -0.0009304171, -0.0019245506, -0.0029117267, -0.0035154684, -0.0034289428, -0.002016719, 0.0006590502, 0.0038972104, 0.006482452, 0.006897822, 0.004810477, 0.0012199448, -0.0022683237, -0.003995135, -0.0026780693, 0.0009597786, 0.004826947, 0.007180977, 0.0072195358, 0.005639058, 0.0033688222, 0.0015355744, 0.0004192732, -0.0011145434, -0.0035028367, -0.006126064, -0.007586154, -0.007047608, -0.004427677, -0.00062845583, 0.0025187458, 0.0044212015, 0.004563694, 0.0023608643, -0.0016401153, -0.006142345, -0.009478993, -0.010572255, -0.008546276, -0.00383167, 0.0017511465, 0.006860219, 0.010337173, 0.011741332, 0.011143691, 0.009659743, 0.008306392, 0.0068612876, 0.0057115313, 0.0037259085, 0.000506458, -0.002588263, -0.004999302, -0.0055673444, -0.004238171, -0.0017601316, 0.0003234631, 0.0008538159, -1.7556718e-05, -0.002948329, -0.0067705913, -0.0101192, -0.0122201685, -0.012414279, -0.01137098, -0.009582929, -0.007899826, -0.0065640626, -0.005241157, -0.003561194, -0.0018412821, -0.00091909594, -0.0006455934, -0.0011592564, -0.0022945646, -0.0039062193, -0.0051781638, -0.005044622, -0.0035865358, -0.0006688594, 0.0022509634, 0.0034940138, 0.002779398, 0.00025595972, -0.0025826313, -0.003948314, -0.0029187622, 0.00016883972, 0.0034652913, 0.005262093, 0.00500283, 0.0029348312, 0.00065504905, -0.0005228704, -0.00078901474, -0.0006894327, -0.0011478519, -0.002120678, -0.0023418202, -0.0009446379, 0.0021075401, 0.0061058914, 0.009926633, 0.012746477, 0.013996889, 0.01301998, 0.010238939, 0.0064972914, 0.0028531707, 0.0008028152, 0.0008909316, 0.0030952494, 0.0060273795, 0.008395572, 0.009881414, 0.009449904, 0.007943977, 0.0066584344, 0.005749438, 0.0059860414, 0.0070271664, 0.0077465936, 0.007213191, 0.00558702, 0.0038847462, 0.0025908821, 0.0023836042, 0.0024628632, 0.0019072365, 0.00074982893, -0.0017692231, -0.0051149176, -0.007998023, -0.009674305, -0.009298495, -0.006297596, -0.0015662408, 0.0030934666, 0.006545843, 0.008040894, 0.007907862, 0.00656819, 0.004216898, 0.0012677447, -0.0020762633, -0.0049533783, -0.0072564976, -0.008740979, -0.008849074, -0.007557072, -0.004073445, 0.00078465807, 0.0051474855, 0.008076041, 0.008543925, 0.006480541, 0.0031878746, 0.00068703224, 0.0006635246, 0.002547053, 0.00495303, 0.0068865805, 0.006869333, 0.004849392, 0.002424216, 0.00054712594, -0.0009635866, -0.0025788106, -0.0049502435, -0.00818522, -0.010788744, -0.011743578, -0.010569325, -0.0075418707, -0.0039371587, -5.034867e-06, 0.0030277183, 0.0040580304, 0.003163486, 0.00035633135, -0.0031799118, -0.006401792, -0.008220005, -0.0084091285, -0.007894198, -0.0071472013, -0.0074335365, -0.008789525, -0.0104586175, -0.012053106, -0.012273592, -0.010653421, -0.0076953727, -0.0044942014, -0.0019463898, -0.0003031959, 0.00063978235, 0.0020184177, 0.0039214934, 0.005707411, 0.007161456, 0.0075013363, 0.0061422894, 0.003426915, -6.284425e-05, -0.0034104935, -0.005292031, -0.0051143914, -0.0031851225, -0.00052360364, 0.0017711121, 0.0032749518, 0.0041244426, 0.0048517887, 0.0050674025, 0.004580431, 0.004091397, 0.0031860343, 0.0019948883, 0.0010815623, 7.746211e-05, -0.0001347281, 0.0012870848, 0.0037218914, 0.0064221495, 0.008235373, 0.008209096, 0.006071938, 0.0029133817, 0.0009842002, 0.0012040127, 0.0035047536, 0.0068379855, 0.009298714, 0.009652101, 0.007810346, 0.0053323302, 0.003451701, 0.0023397638, 0.0017725156, 0.0010621671, 6.90938e-05, -0.0006022034, 0.0002572842, 0.0024762994, 0.00495093, 0.0075092837, 0.009093528, 0.008856149, 0.0067078606, 0.0026124937, -0.0023333277, -0.006901607, -0.009627984, -0.009241932, -0.0059213405, -0.00043688304, 0.005629459, 0.010807088, 0.014556219, 0.01643125, 0.016851557, 0.016831003, 0.017108466, 0.017540323, 0.017302712, 0.016038394, 0.013628493, 0.010977316, 0.009057275, 0.007866731, 0.007663904, 0.0079059005, 0.0076567503, 0.0065211663, 0.0043335725, 0.001531024, -0.0010927662, -0.002426505, -0.0017796912, 0.00072426803, 0.0042558694, 0.0072278283, 0.008994356, 0.009853193, 0.009480953, 0.007763264, 0.0050547016, 0.0013608291, -0.003027696, -0.007487283, -0.011690006, -0.015109014, -0.01672833, -0.015787162, -0.012486552, -0.007872351, -0.0031641442, 1.6289821e-05, 0.00083824433, 0.00035081067, -0.00035490788, -4.254666e-05, 0.0015733171, 0.0031406803, 0.0035291621, 0.0014774889, -0.002794417, -0.007568602, -0.011546304, -0.014117093, -0.0155309, -0.01631994, -0.01697391, -0.016816339, -0.014926472, -0.011285219, -0.0063393833, -0.00086503616, 0.004185107, 0.00753776, 0.009152313, 0.008590156, 0.0054562404, 0.0015423757, -0.0020652208, -0.0041680583, -0.004007765, -0.00241606, 3.5251549e-06, 0.002142473, 0.0034494144, 0.004011404, 0.0040392387, 0.0047218413, 0.0066487403, 0.009482502, 0.012428735, 0.014124542, 0.014162703, 0.013252149, 0.011712632, 0.00988629, 0.008189945, 0.006259806, 0.0038412788, 0.00090924604, -0.0025023909, -0.005947832, -0.008734706, -0.009713987, -0.008277493, -0.0047413562, -0.00042426714, 0.002864969, 0.0051228385, 0.0064628087, 0.006485056, 0.005806995, 0.0045894156, 0.0030615022, 0.001685669, 0.0004233771, -0.0006819139, -0.0015776916, -0.0014442127, 0.0003460425, 0.0033925283, 0.0072537614, 0.01069916, 0.012208755, 0.011178037, 0.008451692, 0.0059756907, 0.004915471, 0.005870366, 0.008355393, 0.01037116, 0.01051408, 0.008578253, 0.0054524625, 0.0020967452, -0.0007016336, -0.0028741152, -0.0055038366, -0.008263077, -0.010244595, -0.010666272, -0.008931886, -0.005290679, 4.413078e-05, 0.0055687022, 0.010257511, 0.013524032, 0.013930014, 0.011739557, 0.007809175, 0.0033297036, -0.00023131685, -0.0022079356, -0.002641733, -0.002239378, -0.001582198, -0.0014686978, -0.0019707223, -0.0023883765, -0.0020314888, -0.00036667575, 0.002323838, 0.005215389, 0.0067853997, 0.0067396644, 0.005721918, 0.003944959, 0.0025232753, 0.0015976133, 0.0006740135, -0.00018704067, -0.0017635913, -0.004274697, -0.007218076, -0.0101098055, -0.011849633, -0.011552899, -0.009112921, -0.005629526, -0.0025098016, 2.2277494e-05, 0.0017471886, 0.0026173966, 0.0029238684, 0.0026151345, 0.0019380554, 0.0011188901, 0.00026568765, -0.0007639497, -0.0018927648, -0.0023063812, -0.0015533303, 0.0005976353, 0.003950324, 0.007247889, 0.008941564, 0.008413345, 0.006232973, 0.0035262462, 0.0019410368, 0.0021385627, 0.003443198, 0.004589324, 0.0040231026, 0.0018028615, -0.0013512168, -0.0041706306, -0.0053014196, -0.0052374075, -0.004534652, -0.0038235825, -0.002992211, -0.001542204, 0.00036037934, 0.0029526304, 0.005393788, 0.0071105463, 0.007921838, 0.007126524, 0.004320059, -8.153487e-05, -0.00473289, -0.00895669, -0.011132023, -0.0103065055, -0.007477015, -0.003330968, 0.0010424062, 0.0047057886, 0.0067395354, 0.0074974513, 0.007917793, 0.008508274, 0.0100276945, 0.011334621, 0.011648515, 0.01079301, 0.008959679, 0.007200773, 0.005652749, 0.004849135, 0.0044121356, 0.0038537527, 0.003063839, 0.0012187039, -0.0012102188, -0.0036279815, -0.004999499, -0.0039290525, -0.0005487547, 0.0040943916, 0.0089543965, 0.013116611, 0.015811553, 0.017081108, 0.016599597, 0.014284755, 0.01093827, 0.0067702653, 0.0020649657, -0.0030511618, -0.007916808, -0.011351431, -0.012855595, -0.011642181, -0.0076710666, -0.0023835783, 0.0024688027, 0.005544294, 0.006824606, 0.0072462726, 0.0076889386, 0.00916451, 0.011517812, 0.01312136, 0.012840459, 0.010118346, 0.0058375215, 0.0017031821, -0.0016178816, -0.004016349, -0.0061084544, -0.008010315, -0.009319399, -0.009895297, -0.009067008, -0.006901647, -0.004055936, -0.0009466293, 0.0018457051, 0.003384251, 0.0028608001, 0.00041439474, -0.0035533458, -0.00808798, -0.011647, -0.013571551, -0.013990853, -0.012939057, -0.011197067, -0.010098524, -0.009576724, -0.009383622, -0.008984372, -0.007205515, -0.0041904077, -0.0008334483, 0.001736674, 0.0029666298, 0.002705436, 0.0012913669, -0.00013200848, -0.0012682953, -0.001821322, -0.0018645742, -0.0019065383, -0.0020397329, -0.0026773552, -0.003756262, -0.0043676756, -0.00359615, -0.0016086103, 0.0010131114, 0.0035142298, 0.0048861844, 0.0050730817, 0.0045522004, 0.0033845275, 0.0014785226, -9.220995e-05, -0.0009358645, -0.001663936, -0.0019330236, -0.0017750523, -0.0010876448, 0.0006734957, 0.0037734406, 0.0080587845, 0.0126169305, 0.015907826, 0.016852485, 0.015737277, 0.013225396, 0.011217526, 0.011165454, 0.012517081, 0.014443569, 0.015249119, 0.014130721, 0.011639936, 0.008651123, 0.006355729, 0.0045694024, 0.0028785078, 0.0014126498};
-constexpr float kBanjo2[4096] = {5.2574214e-05, -0.0032321957, -0.008102807, -0.01345847, -0.018947423, -0.026241299, -0.036971457, -0.04941914, -0.06687746, -0.09174828, -0.12425982, -0.16721734, -0.22009647, -0.27296403, -0.31770176, -0.3581521, -0.3926757, -0.41513658, -0.42881373, -0.44378382, -0.46123117, -0.46791646, -0.4638492, -0.45355812, -0.42495808, -0.37696236, -0.32329956, -0.26845053, -0.2107077, -0.15552478, -0.10380282, -0.04598896, 0.0171603, 0.07658929, 0.13089395, 0.17862092, 0.21019691, 0.22187127, 0.22395363, 0.223582, 0.21952574, 0.2154323, 0.21632202, 0.21815574, 0.21599706, 0.21233349, 0.20800045, 0.20119528, 0.19554538, 0.19340855, 0.19064258, 0.18572332, 0.18165736, 0.17596427, 0.16443844, 0.15336034, 0.1481999, 0.14442036, 0.14154254, 0.14432518, 0.15148886, 0.15817209, 0.16427478, 0.17013551, 0.1735409, 0.17580397, 0.17983428, 0.18875173, 0.2023957, 0.21824919, 0.23955566, 0.26495975, 0.28705537, 0.30610853, 0.32425264, 0.338714, 0.35106814, 0.36595222, 0.38530472, 0.40918756, 0.43237153, 0.45202267, 0.4704781, 0.48452875, 0.48818687, 0.4829764, 0.47155607, 0.4486349, 0.41332343, 0.36752883, 0.31042615, 0.24373102, 0.16879341, 0.094439775, 0.02861672, -0.031170089, -0.08260644, -0.123045914, -0.15824816, -0.19093983, -0.21989089, -0.24923994, -0.27829593, -0.2981475, -0.30913362, -0.31726047, -0.31876475, -0.3119263, -0.30647987, -0.30329728, -0.2945441, -0.28173232, -0.26938397, -0.25567222, -0.23964186, -0.22839059, -0.22512588, -0.22321482, -0.22077414, -0.21878862, -0.21102521, -0.19394706, -0.17230676, -0.14963561, -0.12656716, -0.10625606, -0.091876574, -0.08161801, -0.07345891, -0.06738644, -0.06186293, -0.058076117, -0.05887638, -0.063255705, -0.07093977, -0.08278115, -0.0952799, -0.10474781, -0.11146181, -0.11770623, -0.12433065, -0.12902792, -0.13304266, -0.13925652, -0.143267, -0.13880593, -0.1275374, -0.11429362, -0.09872937, -0.0840238, -0.07833198, -0.08432038, -0.09839994, -0.1155151, -0.13154033, -0.14045417, -0.13906266, -0.13042034, -0.11775477, -0.102107674, -0.084790275, -0.06698959, -0.043851875, -0.011383313, 0.027598407, 0.07002517, 0.111703195, 0.14593586, 0.16957219, 0.18528003, 0.19626191, 0.20766594, 0.22367601, 0.24122551, 0.25675038, 0.26666287, 0.2661899, 0.254232, 0.23523223, 0.21671087, 0.20399545, 0.19790748, 0.19700211, 0.19965579, 0.20034908, 0.19542032, 0.18930341, 0.18697488, 0.19070986, 0.20039357, 0.21587421, 0.23532788, 0.25128117, 0.258247, 0.2594989, 0.2594452, 0.25814655, 0.2589706, 0.26437676, 0.2710323, 0.2747079, 0.2735854, 0.27014247, 0.2603618, 0.24300492, 0.22881967, 0.21651174, 0.19816263, 0.17833968, 0.16018878, 0.13673162, 0.10638568, 0.076353505, 0.047332212, 0.014770067, -0.019301403, -0.052426763, -0.087443925, -0.12421907, -0.16048631, -0.19366094, -0.22121622, -0.24327563, -0.2570169, -0.26292098, -0.26513156, -0.26331133, -0.2595898, -0.25611073, -0.25200075, -0.24781007, -0.24533366, -0.24361527, -0.23836374, -0.23408188, -0.23310466, -0.22672008, -0.2189675, -0.21670242, -0.21332555, -0.20636302, -0.20000418, -0.1938225, -0.18350056, -0.16977365, -0.15691662, -0.14554022, -0.13703667, -0.13356249, -0.13284305, -0.13276553, -0.13408186, -0.13629247, -0.13717335, -0.13668159, -0.13854265, -0.14425334, -0.15055975, -0.15612252, -0.16246502, -0.16772485, -0.16832136, -0.16805962, -0.17234655, -0.17855501, -0.18367365, -0.1877367, -0.18775658, -0.17947951, -0.16264293, -0.13968016, -0.11391043, -0.08959032, -0.06924904, -0.051176235, -0.031955283, -0.011214058, 0.012131979, 0.040916324, 0.0723227, 0.10058597, 0.12484817, 0.1464588, 0.16462618, 0.18226078, 0.20360968, 0.22749376, 0.25100392, 0.2702233, 0.28309545, 0.28983197, 0.29062018, 0.28685534, 0.27938, 0.27082932, 0.26256278, 0.25290114, 0.2401531, 0.22241686, 0.20260094, 0.18393901, 0.16586198, 0.15058039, 0.14039299, 0.13118088, 0.11780466, 0.10173112, 0.084937036, 0.06646574, 0.047285747, 0.029937336, 0.015704399, 0.0028217554, -0.011232554, -0.027079474, -0.04401042, -0.05954093, -0.06990497, -0.07262983, -0.06659748, -0.052162793, -0.033509213, -0.015689848, 0.000177856, 0.014586439, 0.026874658, 0.03841534, 0.05204108, 0.06774951, 0.08373683, 0.09777698, 0.10741967, 0.1115365, 0.11104001, 0.106978044, 0.10006219, 0.09204358, 0.0831822, 0.072209574, 0.058454044, 0.042071417, 0.024528151, 0.0072157863, -0.009507039, -0.026400238, -0.044679213, -0.066263326, -0.092965096, -0.123992346, -0.1574632, -0.19051498, -0.21991487, -0.2438695, -0.26106328, -0.2703369, -0.27280244, -0.2715477, -0.26496163, -0.251053, -0.23282942, -0.21144557, -0.18736926, -0.1629533, -0.14071858, -0.12100413, -0.10186274, -0.08315876, -0.064591035, -0.04566733, -0.02843269, -0.01481127, -0.00555893, -0.0018970466, -0.0041414155, -0.010119294, -0.017412003, -0.025376985, -0.034015145, -0.04172653, -0.048597015, -0.056677014, -0.064658456, -0.06960166, -0.06961665, -0.06485429, -0.056637798, -0.04587309, -0.03438388, -0.024400068, -0.016843831, -0.010005822, -0.0017266788, 0.00875175, 0.021922411, 0.03725985, 0.05223203, 0.06329839, 0.068967536, 0.070400916, 0.069910616, 0.0697811, 0.07127382, 0.07524663, 0.08152824, 0.08803263, 0.09267352, 0.09569798, 0.09950911, 0.10635246, 0.11715519, 0.13156965, 0.14765473, 0.16244537, 0.17217474, 0.17611594, 0.17701292, 0.17452367, 0.17080155, 0.17039065, 0.1710753, 0.17067657, 0.16991156, 0.16695295, 0.15987928, 0.15068164, 0.14164694, 0.13177043, 0.12034346, 0.10739605, 0.09230324, 0.07474627, 0.055990446, 0.03923102, 0.026545873, 0.017858185, 0.013712478, 0.014036967, 0.015066079, 0.01436091, 0.012445194, 0.008274093, 0.0027931032, -0.0008648605, -0.0029701334, -0.00493823, -0.007167997, -0.011598516, -0.020175748, -0.0323915, -0.046667624, -0.061245162, -0.0744723, -0.085451275, -0.09372418, -0.09916594, -0.10243779, -0.10418234, -0.10339376, -0.098411046, -0.08917064, -0.07643615, -0.061472327, -0.046869565, -0.034559004, -0.024871126, -0.017243985, -0.010665465, -0.0042107617, 0.0021675806, 0.0064323843, 0.0065660942, 0.0017743637, -0.008890149, -0.025189007, -0.044861306, -0.06527711, -0.08541186, -0.10561079, -0.1263015, -0.14793368, -0.17111167, -0.19545098, -0.21908942, -0.23954876, -0.25425807, -0.26275095, -0.26555642, -0.26353195, -0.25842765, -0.24980058, -0.23745677, -0.22178741, -0.20285714, -0.18181494, -0.15957652, -0.13795072, -0.117269844, -0.0968003, -0.07705177, -0.057153113, -0.036229413, -0.014742649, 0.006280029, 0.026322689, 0.045005314, 0.06119781, 0.07507252, 0.08830515, 0.10123289, 0.113049835, 0.12389791, 0.13337933, 0.14100437, 0.14691965, 0.15143374, 0.15522957, 0.1579407, 0.15966684, 0.16086629, 0.16117993, 0.16016063, 0.15732332, 0.1533372, 0.1491433, 0.14526065, 0.14203712, 0.13885555, 0.13420121, 0.12716293, 0.11832566, 0.10767413, 0.095739245, 0.08506624, 0.07642463, 0.068639114, 0.060890675, 0.05245393, 0.042225014, 0.029347228, 0.014995965, 0.00083531666, -0.010694859, -0.017622286, -0.023463016, -0.028786007, -0.030790636, -0.033579364, -0.038999535, -0.041916337, -0.040626995, -0.037148032, -0.031671803, -0.024967998, -0.020524831, -0.020251004, -0.023053864, -0.027671292, -0.032224696, -0.033992168, -0.032630943, -0.02950902, -0.026570138, -0.026453296, -0.030943537, -0.040212937, -0.052598394, -0.066726185, -0.0813222, -0.09424069, -0.10513586, -0.11495219, -0.12313686, -0.12936729, -0.13481222, -0.13887319, -0.14152782, -0.1443417, -0.14714505, -0.15019608, -0.1542139, -0.15823723, -0.15991744, -0.15752572, -0.15042543, -0.13754158, -0.119116664, -0.097519964, -0.07524238, -0.05433847, -0.03626315, -0.021284726, -0.0085822055, 0.004072608, 0.018790701, 0.035673223, 0.054082856, 0.07318558, 0.091256805, 0.10593328, 0.11617346, 0.12216958, 0.12360962, 0.12106683, 0.11629455, 0.10977647, 0.101843245, 0.09435471, 0.087749586, 0.08173859, 0.077075526, 0.07387729, 0.07027696, 0.06431807, 0.055966616, 0.042295203, 0.022380125, 0.001067326, -0.021104882, -0.044483207, -0.063955076, -0.07552783, -0.080245465, -0.079017945, -0.071243905, -0.059225537, -0.04613454, -0.033359095, -0.021696914, -0.01155039, -0.0027118756, 0.0049700686, 0.012144288, 0.019850068, 0.028410923, 0.03773412, 0.04737759, 0.05734097, 0.067313954, 0.07616938, 0.08278326, 0.08676172, 0.087293245, 0.08243719, 0.072891206, 0.06072422, 0.047372207, 0.034505792, 0.024483368, 0.019452583, 0.018920796, 0.021518704, 0.026055707, 0.030981325, 0.03397228, 0.035203416, 0.03484414, 0.030203719, 0.024490729, 0.019792868, 0.013347113, 0.007377396, 0.004756041, 0.004872997, 0.00740117, 0.013115596, 0.019515892, 0.023248779, 0.02447765, 0.022349905, 0.015090365, 0.0049771774, -0.0035801472, -0.009114895, -0.010063061, -0.0033509182, 0.010601568, 0.027980164, 0.045773756, 0.06317811, 0.07813425, 0.087841205, 0.09287991, 0.09521717, 0.09485312, 0.09160009, 0.086512305, 0.08009079, 0.07188271, 0.0625598, 0.054205723, 0.0475178, 0.04201171, 0.036652382, 0.029552639, 0.01914117, 0.0052982946, -0.0112236105, -0.029853517, -0.04699018, -0.06139695, -0.07496268, -0.0843154, -0.09045042, -0.098028466, -0.10467793, -0.10849954, -0.11123906, -0.113637805, -0.11575691, -0.119918235, -0.12878095, -0.14110799, -0.15488797, -0.16852033, -0.17854396, -0.1828682, -0.18171622, -0.17599197, -0.16795737, -0.15969032, -0.15263058, -0.14757448, -0.14321259, -0.13814731, -0.13171257, -0.122270904, -0.108730435, -0.09184725, -0.0716912, -0.047993585, -0.021984113, 0.0048898836, 0.031211775, 0.05547968, 0.075421005, 0.08929387, 0.09724649, 0.09963303, 0.097191386, 0.090970725, 0.08314646, 0.07476885, 0.06592733, 0.058304682, 0.049879692, 0.03977766, 0.030727334, 0.021318529, 0.011173319, 0.0039023585, 0.0009719533, 0.0009899128, 0.003547996, 0.009393256, 0.017315274, 0.025464833, 0.034006637, 0.04340614, 0.053180225, 0.06339386, 0.073993415, 0.08367794, 0.09121742, 0.09672294, 0.10009508, 0.10011532, 0.09661106, 0.09066186, 0.08286189, 0.072771735, 0.061765496, 0.052644704, 0.045251176, 0.038644068, 0.034109324, 0.032228094, 0.030683573, 0.02817612, 0.025884954, 0.023201328, 0.018373473, 0.011690033, 0.0039832136, -0.005498761, -0.016563158, -0.027443824, -0.03771281, -0.04729348, -0.05538729, -0.061981205, -0.06841509, -0.0752947, -0.08175804, -0.08747328, -0.09208174, -0.094389714, -0.093925245, -0.0917661, -0.088546425, -0.08444384, -0.080811135, -0.07769415, -0.07367079, -0.06838339, -0.062345713, -0.055994194, -0.049721222, -0.044964664, -0.043095917, -0.042999204, -0.043090668, -0.04372476, -0.04439715, -0.04348284, -0.041452695, -0.039819676, -0.038629442, -0.03726227, -0.03620079, -0.035101306, -0.03256721, -0.029201666, -0.02632172, -0.024052033, -0.022437328, -0.021937652, -0.021537278, -0.018790446, -0.01280942, -0.004142691, 0.006789095, 0.019042924, 0.030490745, 0.039156497, 0.044558436, 0.04690227, 0.046191838, 0.04293332, 0.038299013, 0.032775674, 0.026177425, 0.018959025, 0.012221903, 0.0069021652, 0.0037133463, 0.0030687787, 0.004433583, 0.006710308, 0.009323257, 0.011695785, 0.0129063185, 0.013024979, 0.012903367, 0.013450269, 0.01535639, 0.019010367, 0.024327375, 0.030184235, 0.035984766, 0.041550394, 0.04640892, 0.0501009, 0.05199128, 0.05177005, 0.048865344, 0.044223417, 0.038472105, 0.03099538, 0.025087152, 0.022483565, 0.021191878, 0.022331093, 0.02681328, 0.031919472, 0.035731144, 0.038433265, 0.039101776, 0.036524307, 0.03196333, 0.026592258, 0.019990154, 0.013143836, 0.007937718, 0.004667895, 0.0031543395, 0.0038910431, 0.006974608, 0.011034779, 0.014567705, 0.017427465, 0.019701112, 0.02075623, 0.020652993, 0.0207239, 0.021466108, 0.022577679, 0.024621278, 0.028132983, 0.032275148, 0.03655159, 0.041561656, 0.046308782, 0.04921746, 0.04991296, 0.047859985, 0.042448066, 0.034579076, 0.026429394, 0.018862003, 0.01231211, 0.008029881, 0.0059508244, 0.0044678235, 0.0022804295, -0.00041785394, -0.0035945044, -0.0072969645, -0.009899572, -0.010122696, -0.008451373, -0.0053282827, -0.0004193253, 0.0052518733, 0.010284857, 0.015161212, 0.019833794, 0.022933904, 0.02382629, 0.022173556, 0.016764883, 0.006980299, -0.0059012435, -0.020111412, -0.034852136, -0.048919234, -0.060496144, -0.069919676, -0.07889394, -0.0881419, -0.09749144, -0.106911615, -0.11568706, -0.12139922, -0.12275764, -0.11999222, -0.11344173, -0.104397886, -0.09465324, -0.08541556, -0.07715319, -0.06973025, -0.06261502, -0.05526127, -0.047391176, -0.03959104, -0.03244648, -0.025703514, -0.018995808, -0.011937363, -0.0038346888, 0.0059916605, 0.016792618, 0.027486717, 0.037699446, 0.046931077, 0.054441623, 0.060546022, 0.066966556, 0.07395808, 0.08151246, 0.08932684, 0.0967606, 0.10280071, 0.10430769, 0.102575816, 0.09928019, 0.09175582, 0.08108816, 0.06990738, 0.057865966, 0.044364545, 0.030207727, 0.015477607, -3.4912944e-05, -0.014427038, -0.026101245, -0.03516195, -0.04101216, -0.042716, -0.04160544, -0.03895595, -0.034561437, -0.028667675, -0.02243395, -0.016661737, -0.010472937, -0.0041495427, 0.000814642, 0.0046414416, 0.008171019, 0.011143611, 0.013672325, 0.017295346, 0.021934519, 0.025780875, 0.02798271, 0.028384827, 0.02599354, 0.020262787, 0.012376589, 0.0034306298, -0.00598118, -0.015327495, -0.023297569, -0.02982743, -0.036923867, -0.044350293, -0.051590793, -0.060155027, -0.069848455, -0.07835408, -0.08466871, -0.0885353, -0.08840343, -0.08392717, -0.07654743, -0.06725261, -0.05671864, -0.04686242, -0.039145157, -0.03297746, -0.028134808, -0.024853578, -0.022434771, -0.019844709, -0.017035997, -0.014164364, -0.010512696, -0.0059277588, -0.0009447112, 0.0043400424, 0.010100182, 0.015354465, 0.019019978, 0.021358658, 0.022477306, 0.022336151, 0.021935403, 0.022555925, 0.024163553, 0.025908303, 0.027104022, 0.027125137, 0.024958, 0.020203244, 0.014110345, 0.007826561, 0.002116728, -0.001962778, -0.0037125475, -0.0037437482, -0.002912697, -0.0015849189, 0.0004162437, 0.0035443523, 0.006031379, 0.008496987, 0.012783755, 0.015837295, 0.016768975, 0.017786104, 0.018722214, 0.019129237, 0.020526258, 0.023474175, 0.02623165, 0.02803256, 0.028655935, 0.026693083, 0.021656476, 0.015312461, 0.008943887, 0.0032999045, 0.00023217747, 0.0006538188, 0.0036783174, 0.0072238706, 0.010326049, 0.012837536, 0.0132908, 0.011438049, 0.009079053, 0.006904909, 0.0038908438, 0.0005867728, -0.0017475041, -0.00379009, -0.0055680005, -0.005575429, -0.0034969966, -0.00062321406, 0.0020605854, 0.0038496056, 0.0032141502, -0.00093725935, -0.007689244, -0.015358899, -0.022925735, -0.029082162, -0.032126646, -0.032027047, -0.030473739, -0.028280951, -0.025681013, -0.023807753, -0.022759713, -0.02144984, -0.020002076, -0.018692898, -0.016690787, -0.013914074, -0.0110696005, -0.0073819254, -0.00126961, 0.007003411, 0.016833592, 0.028685767, 0.04167985, 0.05348527, 0.06273318, 0.06941947, 0.07304312, 0.073085606, 0.07089567, 0.06820814, 0.065112546, 0.061785117, 0.059525218, 0.058310013, 0.0572282, 0.05622884, 0.055286657, 0.053092297, 0.04858192, 0.042412423, 0.034544006, 0.024872445, 0.014702036, 0.0053958166, -0.0023439077, -0.008104854, -0.011010751, -0.011174174, -0.010046103, -0.008800886, -0.007959639, -0.0083201565, -0.01086296, -0.015246285, -0.020572733, -0.026057577, -0.03034683, -0.032069437, -0.031090407, -0.027863542, -0.022734052, -0.016886568, -0.01154658, -0.007509656, -0.0052917874, -0.0050077434, -0.0064968374, -0.008942828, -0.011436515, -0.013515137, -0.015055781, -0.015519359, -0.014427719, -0.012105371, -0.008849567, -0.005261382, -0.0020290718, -0.00040457697, -0.0019807634, -0.00607092, -0.011533913, -0.018468093, -0.025449412, -0.030240484, -0.032572262, -0.032847706, -0.03123107, -0.028808236, -0.026577383, -0.024412336, -0.021988485, -0.019410841, -0.016308058, -0.01201662, -0.0072693997, -0.0029513335, 0.0012787044, 0.0056133545, 0.009774154, 0.013852396, 0.018218933, 0.022482203, 0.025458274, 0.02648075, 0.025474511, 0.022213276, 0.01717297, 0.01194293, 0.0076591102, 0.0045820307, 0.002866768, 0.002509454, 0.0026219413, 0.0023334734, 0.0021647145, 0.0021755898, 0.0014988, 0.00037465655, -0.0005842123, -0.0020190326, -0.00467199, -0.008075133, -0.011877867, -0.015980836, -0.01955936, -0.021799708, -0.022403656, -0.021527734, -0.019717328, -0.017743649, -0.016199367, -0.015239115, -0.01472891, -0.014606514, -0.014554141, -0.013684564, -0.011816671, -0.009464452, -0.0067578545, -0.0036196269, -0.00050911674, 0.0020699035, 0.0044764713, 0.006737498, 0.008216157, 0.008577515, 0.00805862, 0.0070324037, 0.0057481974, 0.0048041954, 0.0047495556, 0.005826787, 0.007892874, 0.010442927, 0.012557039, 0.01337528, 0.01268287, 0.009718045, 0.0047034007, -0.0008631927, -0.006905147, -0.013242262, -0.018597199, -0.022431703, -0.02516229, -0.027060108, -0.028163243, -0.029086582, -0.030226361, -0.031390082, -0.03279149, -0.03420096, -0.03488957, -0.035010926, -0.03484413, -0.03415559, -0.032843314, -0.031343408, -0.030084731, -0.028626304, -0.02658015, -0.024241354, -0.021575613, -0.018217236, -0.014240253, -0.0098706195, -0.0049553765, 0.00062077376, 0.0062576234, 0.011239683, 0.01514711, 0.017234258, 0.01758486, 0.017035529, 0.015474558, 0.01325326, 0.011537152, 0.010459513, 0.009585995, 0.008739963, 0.007731607, 0.0062871687, 0.0043683564, 0.0023454633, 0.0005415842, -0.0007199543, -0.0013044345, -0.0015532154, -0.0016079325, -0.0014308924, -0.0010527236, -0.00068460486, -0.00063610624, -0.0009840502, -0.0019189783, -0.003942765, -0.0073341927, -0.011828532, -0.017169869, -0.022890104, -0.027842043, -0.031032555, -0.03207393, -0.030897671, -0.027944556, -0.023789492, -0.01855692, -0.012856781, -0.0071919817, -0.0012315734, 0.0049653095, 0.011103076, 0.01692079, 0.021971589, 0.025689445, 0.027867274, 0.028898455, 0.029200375, 0.029465577, 0.030379064, 0.031890895, 0.03359259, 0.035140928, 0.03606862, 0.035862572, 0.03453797, 0.032383695, 0.029739037, 0.027126156, 0.024720827, 0.02243806, 0.020386117, 0.018506067, 0.01684776, 0.015878724, 0.015846925, 0.01678977, 0.018664302, 0.021137731, 0.023644183, 0.025696933, 0.02714337, 0.02808238, 0.028809309, 0.029588146, 0.030667638, 0.032275878, 0.034168698, 0.03573486, 0.036370125, 0.03578696, 0.03389726, 0.030633003, 0.026333643, 0.021338232, 0.015705114, 0.009557119, 0.0029887413, -0.00369402, -0.010128409, -0.015931346, -0.020461602, -0.02328318, -0.024249654, -0.023790644, -0.022759356, -0.021946877, -0.021977786, -0.022872884, -0.024346454, -0.025918027, -0.026941061, -0.026997369, -0.025942123, -0.0240091, -0.021535506, -0.018911354, -0.016580628, -0.014857163, -0.013842742, -0.013544792, -0.014248549, -0.015983019, -0.018165935, -0.020069504, -0.021003846, -0.020231573, -0.017249554, -0.01226822, -0.005963854, 0.00071208616, 0.0066409204, 0.011034066, 0.013448699, 0.013737237, 0.0122923115, 0.009889805, 0.0072548417, 0.0047535053, 0.0025918633, 0.00118059, 0.0005914207, 0.00045801868, 0.0007205574, 0.0013306671, 0.0017755706, 0.0016927221, 0.0012249777, 0.00049960386, -0.0003742361, -0.0010216449, -0.0010579788, -0.00028892577, 0.0014061419, 0.003938172, 0.006651257, 0.008845386, 0.010274389, 0.01074693, 0.010120642, 0.008870754, 0.007900527, 0.0077061895, 0.008480955, 0.010370414, 0.0132543575, 0.016502637, 0.019166557, 0.020887647, 0.021625951, 0.02125292, 0.020054065, 0.018491432, 0.016884215, 0.0152822975, 0.013552224, 0.0116349375, 0.009492555, 0.0072141914, 0.0049390346, 0.0026438662, 0.00048082042, -0.001270166, -0.002622274, -0.0036481007, -0.004382976, -0.0048697335, -0.005281753, -0.005744058, -0.006204383, -0.007017655, -0.008475902, -0.010632639, -0.013418645, -0.016467193, -0.01939693, -0.021778924, -0.023394411, -0.023996957, -0.023538934, -0.022434479, -0.02121697, -0.020390084, -0.020107351, -0.020592872, -0.021698598, -0.022969702, -0.024195893, -0.025236884, -0.02612758, -0.026855621, -0.027524015, -0.028195135, -0.02911271, -0.030176934, -0.030834133, -0.031263877, -0.03161055, -0.03180785, -0.031925373, -0.032131203, -0.03241206, -0.032481104, -0.032227047, -0.03145895, -0.030134981, -0.028404398, -0.02638228, -0.023972996, -0.021219317, -0.018317023, -0.014986759, -0.011088111, -0.0067431736, -0.0021285007, 0.0026754169, 0.007623066, 0.012402885, 0.016810656, 0.020864874, 0.024584189, 0.027690334, 0.029977467, 0.031439077, 0.031930633, 0.031353597, 0.029767057, 0.027411766, 0.02452905, 0.021410694, 0.018512193, 0.016180333, 0.014580391, 0.013807482, 0.013754199, 0.014099672, 0.01451881, 0.014658123, 0.014160853, 0.012688437, 0.010147168, 0.006737638, 0.0026111682, -0.002126697, -0.0072918874, -0.01256475, -0.017628986, -0.022145571, -0.025707029, -0.028082473, -0.029259216, -0.029362775, -0.028539062, -0.027015928, -0.025024762, -0.022615965, -0.019816153, -0.016607843, -0.012916237, -0.008952236, -0.005267251, -0.0022769524, -0.00021461211, 0.0007231958, 0.00065682357, 2.5526067e-05, -0.00068660994, -0.0011877198, -0.0012888062, -0.0008704704, 8.243683e-06, 0.001236227, 0.0026578195, 0.004201844, 0.005845481, 0.007513739, 0.009082861, 0.010374316, 0.011274411, 0.011733379, 0.011837914, 0.01168494, 0.011392074, 0.011001473, 0.010329688, 0.0090833185, 0.007037382, 0.004411901, 0.001359964, -0.0017799974, -0.004115909, -0.0050096656, -0.0041371365, -0.0015300487, 0.0025072629, 0.00729289, 0.012045706, 0.016451253, 0.020354178, 0.023749664, 0.026704757, 0.029283036, 0.031349145, 0.03280016, 0.03353895, 0.033341244, 0.032583263, 0.03152029, 0.030175379, 0.02889211, 0.027712286, 0.026243504, 0.02413277, 0.021282576, 0.017703343, 0.013785621, 0.010164245, 0.007242285, 0.0051970426, 0.004151534, 0.003991236, 0.004307538, 0.004865619, 0.0055801654, 0.0064819623, 0.0074702185, 0.008441666, 0.009238719, 0.0094554825, 0.008887724, 0.007284735, 0.004921514, 0.0023059119, -0.00021469161, -0.0020479423, -0.0030096353, -0.0030463627, -0.0024323096, -0.0016026824, -0.0008646695, -0.0006719535, -0.0010465216, -0.0019586324, -0.0032237861, -0.004350352, -0.0049588666, -0.0049343803, -0.004342258, -0.003025384, -0.0011544814, 0.0008550808, 0.0026686133, 0.0038574997, 0.004119337, 0.0032918835, 0.0015124559, -0.00095168856, -0.0036494012, -0.0058784266, -0.0071248, -0.0071167205, -0.0059311567, -0.003984828, -0.0020456146, -0.0009706358, -0.0012894109, -0.0031864766, -0.0064739636, -0.010712302, -0.015049169, -0.018470466, -0.020353334, -0.020335639, -0.018249437, -0.014345923, -0.009317332, -0.003804471, 0.001647604, 0.006429622, 0.010173221, 0.012677911, 0.013861223, 0.01391762, 0.013221546, 0.012099629, 0.010809632, 0.009567048, 0.00840777, 0.0072307712, 0.0057803886, 0.0037864675, 0.001326065, -0.0014368634, -0.0042946693, -0.006625513, -0.007817797, -0.0076608625, -0.006226673, -0.003826684, -0.0010300988, 0.001481519, 0.0032934295, 0.004159557, 0.0039018758, 0.0027248596, 0.00093502447, -0.001417521, -0.0042692963, -0.0074384287, -0.010870063, -0.014483408, -0.017931944, -0.020887552, -0.02321586, -0.024777783, -0.025418147, -0.025196342, -0.024311367, -0.02283861, -0.020874215, -0.018592943, -0.016107405, -0.013562018, -0.011069395, -0.008709388, -0.0066795587, -0.0050805085, -0.0038964439, -0.00309101, -0.0024141618, -0.0017195392, -0.0009318544, 0.00013337996, 0.0013483264, 0.0028142252, 0.0047128354, 0.006674028, 0.00862355, 0.010688071, 0.01262393, 0.014239125, 0.015474969, 0.016131025, 0.015976844, 0.015091891, 0.013660606, 0.011771087, 0.0096962685, 0.0076557603, 0.0056538, 0.0036791055, 0.0017965928, 0.00018103799, -0.001213214, -0.0023748628, -0.0031450312, -0.003550445, -0.0036152746, -0.0035116125, -0.0033956363, -0.0035101217, -0.0041247155, -0.005104349, -0.0063750646, -0.0078063747, -0.009229924, -0.010542727, -0.01146356, -0.0120000895, -0.012210511, -0.012058379, -0.011762895, -0.0114399195, -0.011207713, -0.011185339, -0.0114512555, -0.012247451, -0.013454179, -0.014943782, -0.01669765, -0.01838015, -0.019805353, -0.020880885, -0.021581834, -0.021953022, -0.02198737, -0.021768037, -0.021225637, -0.020245124, -0.018907052, -0.017152201, -0.0148721915, -0.012379604, -0.010033502, -0.00797073, -0.0063185073, -0.005094507, -0.0041531203, -0.0032125171, -0.0020904737, -0.0008838122, 0.00035439702, 0.0016255972, 0.002762037, 0.0036850816, 0.0043791845, 0.0049448386, 0.0056654303, 0.0066978475, 0.00825156, 0.01037889, 0.012928429, 0.015779553, 0.01871578, 0.02164599, 0.024447035, 0.02689721, 0.028838543, 0.030027825, 0.030366942, 0.029913956, 0.028547203, 0.026258072, 0.023314163, 0.019929923, 0.016302124, 0.012682893, 0.0092978375, 0.0062515475, 0.0035458088, 0.0012937711, -0.00038120596, -0.0015340509, -0.002240294, -0.002617123, -0.0027841665, -0.0027094036, -0.0024700132, -0.0021591722, -0.0017471781, -0.0011785575, -0.00032549107, 0.00087649765, 0.0024057492, 0.0041781086, 0.005990428, 0.007511567, 0.008470233, 0.008818515, 0.008551973, 0.007788585, 0.0068955244, 0.006264405, 0.0063054017, 0.0072302404, 0.008907422, 0.01112947, 0.013420417, 0.015297255, 0.01648567, 0.016804397, 0.016288644, 0.014982802, 0.013082706, 0.01095604, 0.00897286, 0.007319862, 0.006110228, 0.005533626, 0.0054931412, 0.0058324123, 0.0062615895, 0.0062912903, 0.005598722, 0.004105002, 0.0019034675, -0.0006907077, -0.0030349623, -0.004646548, -0.005380141, -0.0052577145, -0.004411865, -0.0032496934, -0.0022517543, -0.0016053953, -0.0013641359, -0.0012636278, -0.0010498398, -0.0005048861, 0.00070118177, 0.0026474956, 0.005295804, 0.008439719, 0.011913546, 0.015511553, 0.018725974, 0.021006253, 0.021903768, 0.021195333, 0.018837146, 0.015027416, 0.010241442, 0.005217596, 0.00069847226, -0.002923775, -0.005384211, -0.0066187023, -0.0068833395, -0.006504195, -0.005687147, -0.0044813943, -0.0029292284, -0.0011195714, 0.0006568053, 0.0020984348, 0.003047959, 0.003208166, 0.0024664265, 0.0010371256, -0.0007629371, -0.0026783054, -0.004483331, -0.0059674093, -0.007172755, -0.008138058, -0.00903784, -0.009917232, -0.010444134, -0.010538934, -0.010141564, -0.0093072755, -0.008177975, -0.006843137, -0.0056680874, -0.004765818, -0.004091876, -0.003666133, -0.0033539077, -0.0031513965, -0.0030142323, -0.002899127, -0.0030396054, -0.0035644819, -0.004430072, -0.0054556155, -0.006499206, -0.007474704, -0.008071789, -0.008213712, -0.007946866, -0.0073245107, -0.0065211393, -0.00565177, -0.004937629, -0.004477096, -0.0043435474, -0.004486718, -0.004817749, -0.0054471144, -0.006222751, -0.0069952, -0.007580107, -0.007841279, -0.0077861547, -0.0072467923, -0.006191647, -0.0047168043, -0.0029403847, -0.00097455346, 0.0009971532, 0.0027361286, 0.0040855766, 0.005056844, 0.0058511, 0.0064583085, 0.0067282384, 0.0066075022, 0.006131642, 0.005222327, 0.003803593, 0.0021197507, 0.0003709684, -0.0012791642, -0.0026635502, -0.003764679, -0.0046546794, -0.005549165, -0.006676035, -0.008110786, -0.009684193, -0.011101074, -0.012237711, -0.013055033, -0.013503547, -0.013792235, -0.014174293, -0.01477043, -0.015629008, -0.016597217, -0.017537588, -0.018314594, -0.018741855, -0.018695887, -0.018322969, -0.017828358, -0.017060872, -0.015987942, -0.01459509, -0.012774615, -0.010619745, -0.00822111, -0.0057549123, -0.003438106, -0.001351808, 0.0005238471, 0.0022239506, 0.0037818751, 0.00525725, 0.006671893, 0.007899613, 0.008739195, 0.009250932, 0.009596337, 0.009967557, 0.010666739, 0.011775049, 0.01324264, 0.014899083, 0.016367739, 0.017276999, 0.01739776, 0.016754692, 0.015362399, 0.013378746, 0.0112709645, 0.009269891, 0.00755918, 0.0061970116, 0.005059402, 0.0042358865, 0.003608879, 0.0030621681, 0.0025033832, 0.0017080068, 0.0006448896, -0.00081065507, -0.002611607, -0.0044379514, -0.005999338, -0.007015182, -0.007289253, -0.0067078113, -0.005410307, -0.0037900226, -0.0023021589, -0.0013498631, -0.0012343295, -0.0020487197, -0.0037183878, -0.0060042962, -0.008453918, -0.010805808, -0.012836257, -0.014311041, -0.015144468, -0.015381946, -0.015257953, -0.014857095, -0.01426674, -0.013554876, -0.012777648, -0.011972858, -0.011023794, -0.009923787, -0.008564261, -0.0069593075, -0.005093745, -0.002930872, -0.00066834816, 0.0016212264, 0.0037926894, 0.0058019925, 0.007539431, 0.008836677, 0.009758148, 0.010448159, 0.011088963, 0.01167295, 0.012370474, 0.013284189, 0.014218991, 0.015122158, 0.015985953, 0.016788349, 0.017465482, 0.017988851, 0.018341566, 0.01857228, 0.018634014, 0.01841936, 0.017988494, 0.017383551, 0.016859276, 0.01656291, 0.016515285, 0.01682041, 0.017266538, 0.017598396, 0.017588055, 0.017096473, 0.016178949, 0.014893745, 0.013443142, 0.0121279685, 0.011136757, 0.010470763, 0.010092063, 0.0099161845, 0.009766542, 0.009601858, 0.009407699, 0.009193842, 0.009029913, 0.008864523, 0.008658619, 0.008441835, 0.008191628, 0.007849073, 0.0074694944, 0.007128013, 0.0068096365, 0.0064827045, 0.006010326, 0.0052389437, 0.004014267, 0.002265203, 0.000105903484, -0.0022842754, -0.004578818, -0.0064832484, -0.007953199, -0.00907218, -0.009917343, -0.010694004, -0.011624704, -0.012780446, -0.014146457, -0.015459048, -0.016589217, -0.017476836, -0.01794827, -0.01807697, -0.017878434, -0.017342096, -0.016437568, -0.015053984, -0.013203035, -0.011006755, -0.008696628, -0.006497991, -0.0046952055, -0.0034644804, -0.002806949, -0.0026015749, -0.0025880125, -0.0026221676, -0.0025825044, -0.0024729155, -0.002439119, -0.0026063342, -0.003121512, -0.003862307, -0.0046474016, -0.0053666905, -0.0057587954, -0.0056962324, -0.005054029, -0.0038106283, -0.002116764, 5.400268e-06, 0.002417357, 0.0050219395, 0.007619456, 0.00992876, 0.0117428275, 0.012695207, 0.012619084, 0.011496067, 0.009611161, 0.007374364, 0.0051146797, 0.0033168206, 0.0022054266, 0.0018844957, 0.0022746122, 0.0030983137, 0.004169598, 0.0052973228, 0.0063191033, 0.0071991663, 0.008012974, 0.008727293, 0.009248046, 0.0094934, 0.0095173335, 0.00934721, 0.00895221, 0.008380001, 0.0075572953, 0.006471655, 0.0049758004, 0.002934058, 0.00037356606, -0.0025871668, -0.005637319, -0.008521873, -0.010785815, -0.012134289, -0.012589405, -0.012243965, -0.0114866635, -0.010617281, -0.009877359, -0.009500116, -0.009569153, -0.010083887, -0.010884454, -0.011925952, -0.013060195, -0.014042484, -0.014790424, -0.015082593, -0.014899949, -0.0142417345, -0.013071455, -0.011714749, -0.010421185, -0.009477348, -0.00906017, -0.009170825, -0.00975013, -0.010486693, -0.011147093, -0.011429364, -0.01121666, -0.010618654, -0.009638876, -0.008580058, -0.0077341753, -0.007121796, -0.006709149, -0.0063050976, -0.0056885877, -0.0047278926, -0.0032571158, -0.0012820808, 0.0009937991, 0.0033931707, 0.0056792987, 0.0075301784, 0.008672645, 0.0090184845, 0.008476157, 0.0070066876, 0.0047542257, 0.0018404153, -0.0014111676, -0.004589859, -0.0073648454, -0.009487407, -0.010940085, -0.01173349, -0.012080876, -0.012260205, -0.01232375, -0.012285974, -0.011998124, -0.011350682, -0.010267748, -0.008646204, -0.006711584, -0.0047627357, -0.0031037726, -0.001972999, -0.0013718155, -0.0013231413, -0.0016502257, -0.0020821656, -0.0024980754, -0.002718235, -0.0027158293, -0.0024762477, -0.0019527647, -0.0012169837, -0.0002428332, 0.0009676689, 0.0024636344, 0.004223975, 0.00605579, 0.007834261, 0.009492556, 0.011076477, 0.01259589, 0.014070064, 0.015563377, 0.017031476, 0.018340273, 0.019329553, 0.019857483, 0.019839345, 0.019310433, 0.018276969, 0.016930167, 0.015558802, 0.014274064, 0.013134399, 0.012122727, 0.011214832, 0.010342733, 0.009485441, 0.008599632, 0.007714836, 0.006919817, 0.0061184797, 0.0053373547, 0.004626494, 0.0039800373, 0.0033846546, 0.002917927, 0.0026654224, 0.0025996575, 0.0027144796, 0.0028173204, 0.0028017024, 0.0026123973, 0.002151053, 0.0015468539, 0.00091769407, 0.0003766278, 3.4642446e-05, -0.00011506532, -9.730788e-05, 2.89356e-06, 1.5356078e-05, -0.00020545335, -0.0007516673, -0.0015953939, -0.0026533236, -0.0038876077, -0.0052321753, -0.0065518785, -0.007748026, -0.008743936, -0.009399822, -0.009658896, -0.009443804, -0.008844959, -0.007993402, -0.0069835773, -0.0061044022, -0.0054261014, -0.00512947, -0.005199863, -0.0053473543, -0.005404233, -0.0050366013, -0.0041313204, -0.0026313565, -0.0007124843, 0.0012836766, 0.0032021855, 0.0047809547, 0.0059608147, 0.006805036, 0.0074178153, 0.007987167, 0.008644915, 0.009364859, 0.010115569, 0.010839046, 0.011427808, 0.011976794, 0.012381411, 0.012655164, 0.012820852, 0.012645497, 0.012183414, 0.011418294, 0.010392961, 0.009332296, 0.008416458, 0.007906984, 0.007929366, 0.00846135, 0.009399546, 0.010437687, 0.011290032, 0.011822521, 0.01189866, 0.011536838, 0.010821631, 0.00981355, 0.008579627, 0.0071759415, 0.0057479665, 0.0043167826, 0.0029664447, 0.0018341762, 0.000958573, 0.00039717712, 6.073305e-05, -0.00018350518, -0.00052646804, -0.0010827109, -0.001827161, -0.0027304338, -0.0036351087, -0.004406197, -0.005023776, -0.0055168644, -0.005879253, -0.006185986, -0.006520669, -0.0068572923, -0.0071738884, -0.007334392, -0.007245805, -0.0068940837, -0.0063070646, -0.0056214565, -0.0050016437, -0.004584791, -0.0044542085, -0.004639628, -0.0050546275, -0.0057389056, -0.006731112, -0.007918658, -0.009315176, -0.01092804, -0.012633166, -0.014283331, -0.015779467, -0.016912783, -0.017558075, -0.017708005, -0.017317275, -0.016494341, -0.015270818, -0.013657098, -0.01171799, -0.009522951, -0.0072204173, -0.0050146915, -0.0031609538, -0.0017633941, -0.0009529992, -0.00078891526, -0.0010957515, -0.0016670884, -0.002237565, -0.002630239, -0.0027484095, -0.002543868, -0.0021176992, -0.0015728226, -0.00087213, -4.127809e-06, 0.0009985935, 0.0021774864, 0.0035191707, 0.005012057, 0.0065341224, 0.007858428, 0.008840391, 0.009316363, 0.009223981, 0.008594474, 0.0075476756, 0.006234098, 0.00468265, 0.0030328804, 0.0013719334, -0.00023876724, -0.00165786, -0.002897819, -0.003849426, -0.004489182, -0.004884277, -0.0050705667, -0.005234608, -0.005374429, -0.005585005, -0.0058409404, -0.0059451363, -0.0058913217, -0.005543633, -0.0049836137, -0.0043786718, -0.0038478018, -0.00354591, -0.003550725, -0.003917084, -0.0045739594, -0.0054208683, -0.006279494, -0.0071571707, -0.0079995, -0.008779076, -0.0096448995, -0.010448415, -0.011268812, -0.012061192, -0.012699083, -0.013302252, -0.0137889, -0.014113913, -0.014181101, -0.013852226, -0.013004, -0.011518365, -0.009418167, -0.0067900657, -0.0037506898, -0.0006314606, 0.0022390913, 0.0047170264, 0.006535363, 0.0077203778, 0.008373991, 0.008487396, 0.008225635, 0.0076708966, 0.006968855, 0.00620948, 0.005428475, 0.0046867244, 0.0040112333, 0.0034165718, 0.002905, 0.0025497968, 0.0023711147, 0.0023811716, 0.002619452, 0.0031504957, 0.0039358395, 0.0049762814, 0.0062693693, 0.007584785, 0.00881063, 0.00978602, 0.010330402, 0.010356206, 0.009771496, 0.008638278, 0.0070506516, 0.005124167, 0.0030065347, 0.00089911575, -0.0010690581, -0.0029028056, -0.004447779, -0.0055629984, -0.0062615043, -0.0064700707, -0.0061598714, -0.005410303, -0.0042406903, -0.0027485816, -0.0010410968, 0.00085062, 0.0028248085, 0.0048187054, 0.0068198335, 0.008748122, 0.010468598, 0.011819618, 0.012610733, 0.012727748, 0.012196832, 0.011060211, 0.0095155435, 0.0077906093, 0.006003664, 0.0044127563, 0.0030945211, 0.0020910474, 0.0014791434, 0.0011350496, 0.0011313481, 0.0014481859, 0.0020776335, 0.0030161298, 0.0040475326, 0.0051215137, 0.006067175, 0.0067918496, 0.007219405, 0.007324949, 0.007291669, 0.007063939, 0.0067410595, 0.006303816, 0.005661607, 0.0048959013, 0.0038914592, 0.002697474, 0.0014529681, 0.000327894, -0.00058929354, -0.0012924745, -0.0017656386, -0.0021017278, -0.002258344, -0.0023364522, -0.0022957604, -0.001963769, -0.0014007908, -0.00053080474, 0.0005318764, 0.0015830231, 0.0025200984, 0.003118106, 0.0032273883, 0.0028988952, 0.0022398885, 0.001250678, 3.2883607e-05, -0.0013608234, -0.0029096631, -0.0045028017, -0.0061149388, -0.0075545185, -0.008696328, -0.009478179, -0.009771173, -0.009606859, -0.009013271, -0.0081282575, -0.007081329, -0.005884656, -0.004558096, -0.0030768993, -0.0014659856, 0.00028105656, 0.0020362318, 0.003605539, 0.004932936, 0.0058310367, 0.00625292, 0.006278588, 0.0058530057, 0.0050719893, 0.0040775407, 0.002980779, 0.001888302, 0.00083048764, -7.235243e-05, -0.000714539, -0.0010315104, -0.0009270725, -0.0004064086, 0.0004975216, 0.0017234962, 0.0031298138, 0.0046509267, 0.0062272926, 0.0077173486, 0.009044274, 0.010122893, 0.010882509, 0.011286943, 0.011216103, 0.010642992, 0.009620172, 0.008234412, 0.006613679, 0.004871979, 0.003190642, 0.0016754741, 0.00032944104, -0.0008109249, -0.0016908612, -0.0022597043, -0.002518812, -0.0024688207, -0.0020459127, -0.0012575977, -0.0001781879, 0.0010685162, 0.0022671893, 0.0033339274, 0.0041566384, 0.0045866887, 0.00471363, 0.0045781718, 0.0042322977, 0.0036919354, 0.0028547256, 0.0018024887, 0.00052681315, -0.0010067796, -0.0026982026, -0.0044129817, -0.0059402524, -0.007239952, -0.008310331, -0.009131482, -0.009812594, -0.010389468, -0.010828099, -0.011072831, -0.011043577, -0.010726295, -0.010204255, -0.009518242, -0.008788041, -0.008289488, -0.008132583, -0.008346201, -0.0089041935, -0.009653024, -0.010514927, -0.011430075, -0.012359007, -0.013372068, -0.014509407, -0.015752997, -0.01701484, -0.01810917, -0.01892849, -0.019342262, -0.019134803, -0.018310478, -0.01697575, -0.015182163, -0.013114674, -0.010881292, -0.008508485, -0.0061615757, -0.0038894296, -0.0017916152, -4.4706998e-05, 0.0013192795, 0.0022681036, 0.0028623457, 0.003197762, 0.0033426762, 0.0034090728, 0.0035131215, 0.003653681, 0.0037609357, 0.003784347, 0.0036246604, 0.003350812, 0.0030269914, 0.0026855103, 0.0025066559, 0.002552854, 0.0027797827, 0.0031383727, 0.003638099, 0.0042395894, 0.004861818, 0.005504171, 0.006180962, 0.006858426, 0.007388278, 0.0076344027, 0.0074404683, 0.0067483927, 0.005608869, 0.0040977234, 0.0024874413, 0.0009520441, -0.00038155718, -0.0014462625, -0.0022938112, -0.0028679818, -0.0032806168, -0.0035943417, -0.0037474798, -0.0036929988, -0.0033693216, -0.0028258916, -0.0020690276, -0.0011694371, -0.00016430438, 0.0008679014, 0.0018781272, 0.002970101, 0.0040419768, 0.0050748195, 0.005915249, 0.00639905, 0.006493753, 0.006043411, 0.0051636295, 0.003975903, 0.0026970832, 0.0015697484, 0.00072749873, 0.00031725797, 0.00023356483, 0.00045307633, 0.0008288449, 0.001191562, 0.0016288891, 0.0020741764, 0.002463978, 0.0028325662, 0.0031792866, 0.0034530142, 0.0036661653, 0.0038981882, 0.004214174, 0.004675778, 0.005223242, 0.0057859533, 0.00634102, 0.006702427, 0.0067013917, 0.006337321, 0.0056868633, 0.0049476624, 0.0042283074, 0.0036387534, 0.0032447253, 0.0028997667, 0.002595922, 0.0021987562, 0.0015480205, 0.00075217616, -0.0001320814, -0.0009969983, -0.0016409183, -0.0019535443, -0.0019395693, -0.0016444942, -0.0011468781, -0.00049097015, 0.0002643195, 0.0009858424, 0.0016401057, 0.0021653872, 0.0024503085, 0.0024159644, 0.0020012038, 0.0012075567, 9.231448e-05, -0.0012693456, -0.0027315605, -0.004019914, -0.005008316, -0.005628891, -0.005837823, -0.005729455, -0.005286404, -0.004551486, -0.0036003417, -0.00241089, -0.0009538761, 0.00071401056, 0.0024559174, 0.004223728, 0.005842904, 0.00713634, 0.00804143, 0.00852485, 0.008688139, 0.008604818, 0.00833986, 0.007886557, 0.0072682914, 0.006554156, 0.005675289, 0.004748439, 0.003914736, 0.0032867142, 0.002975561, 0.0029338317, 0.0032347755, 0.0037725205, 0.0043310416, 0.004833111, 0.005190315, 0.0054582222, 0.0055858633, 0.0055861273, 0.0055169025, 0.00528943, 0.004958667, 0.004477741, 0.003918934, 0.0034197734, 0.0029723577, 0.0026667288, 0.0025068286, 0.0024307966, 0.002310072, 0.0019975845, 0.0014049652, 0.00058451324, -0.00034941675, -0.0012813411, -0.0019862154, -0.0024196117, -0.0025560171, -0.002440972, -0.002181093, -0.0018289147, -0.0015033599, -0.0011579281, -0.00082855456, -0.00044911294, 6.514253e-05, 0.000583586, 0.0010838163, 0.0014615748, 0.0016743256, 0.0017302921, 0.0015433729, 0.0011112961, 0.00043826635, -0.00054899266, -0.0019025009, -0.003594529, -0.00547752, -0.0073778, -0.009187447, -0.010604548, -0.0114721535, -0.011732927, -0.01132717, -0.010533847, -0.009415017, -0.008046045, -0.0066247378, -0.0051590814, -0.0037263173, -0.002349663, -0.0011198327, -0.00015820879, 0.0004473055, 0.00064917863, 0.00047887999, -8.15488e-05, -0.00086524076, -0.0016767762, -0.0024326262, -0.0030827937, -0.0035875677, -0.0039403257, -0.004227183, -0.004381618, -0.0043609655, -0.0041474616, -0.0036650791, -0.0029644084, -0.002115237, -0.001189317, -0.0002584309, 0.0004984181, 0.0010321495, 0.0013782675, 0.0015278227, 0.0016090886, 0.0015714378, 0.0014156185, 0.0011541506, 0.00069791434, 5.502439e-05, -0.0007039778, -0.0013699968, -0.0018977785, -0.0022611073, -0.0023632147, -0.0021966468, -0.0019167798, -0.0017275675, -0.0015675329, -0.0014631752, -0.0014170912, -0.0013080327, -0.0011267848, -0.00086498895, -0.00061487715, -0.0005164292, -0.00064447575, -0.0010550023, -0.0016994295, -0.0025185694, -0.0035014236, -0.0045040026, -0.0054771327, -0.0064705946, -0.0075202007, -0.008583702, -0.009556155, -0.0104106115, -0.010980183, -0.011245081, -0.011176915, -0.010841417, -0.010473094, -0.010034006, -0.00961108, -0.009156068, -0.008611565, -0.007922179, -0.0069233296, -0.0056846035, -0.0042918925, -0.0029649758, -0.0018138051, -0.00096114655, -0.0004920196, -0.00031532603, -0.00037642437, -0.0005049884, -0.0006864653, -0.0008418003, -0.0009183301, -0.0009182971, -0.00073383824, -0.0003955801, 0.00015237562, 0.00098275, 0.0020903514, 0.0033939113, 0.0048390836, 0.006365267, 0.007827445, 0.009208811, 0.010523347, 0.011776569, 0.012886988, 0.013732596, 0.014253974, 0.014268391, 0.013690388, 0.012629555, 0.011085072, 0.009233055, 0.007355924, 0.0055786157, 0.0040813554, 0.0028405495, 0.0018762436, 0.0012150207, 0.0007404109, 0.00058669987, 0.0007581707, 0.0012315551, 0.001989591, 0.0028667455, 0.003756164, 0.004472785, 0.004852316, 0.004842825, 0.0045597875, 0.0041212686, 0.003590689, 0.0030761184, 0.0026069926, 0.0021806643, 0.0016566104, 0.00096366415, 0.00017949729, -0.000639329, -0.0014488072, -0.002226644, -0.0028336628, -0.0033134772, -0.0037469482, -0.004070391, -0.004365266, -0.0045463745, -0.004478907, -0.0041351244, -0.003469935, -0.0025600665, -0.0015366753, -0.0005745942, 0.00019651679, 0.00076298305, 0.0011187763, 0.0013511243, 0.0015697918, 0.00182503, 0.0021361834, 0.0024212885, 0.002638022, 0.002662671, 0.0024382304, 0.0020773022, 0.0015270212, 0.00096662564, 0.00048960815, 2.4702238e-05, -0.00031311414, -0.0005463876, -0.0005246274, -0.00019461651, 0.00045059586, 0.0015472521, 0.0029235147, 0.004388961, 0.0057365214, 0.0067646056, 0.007352303, 0.0074491575, 0.0071309707, 0.0065545617, 0.005908202, 0.0052649267, 0.0046097254, 0.00386061, 0.003027091, 0.002053501, 0.00088595826, -0.0002920122, -0.0013597081, -0.0022100525, -0.002754486, -0.0029311082, -0.0027322979, -0.0022738196, -0.001608938, -0.0007961752, 9.9270765e-05, 0.0010687334, 0.0020056893, 0.0027733103, 0.0033093374, 0.0035100721, 0.00334786, 0.0028788564, 0.002212007, 0.00149677, 0.0008264376, 0.0002726185, -0.00016805771, -0.000495765, -0.00078195764, -0.0010853887, -0.0014007846, -0.0016848467, -0.0017567906, -0.0016217168, -0.001305156, -0.00080230285, -0.00025304552, 0.00022888687, 0.00056394876, 0.0007818063, 0.0009453061, 0.0010777712, 0.0012242423, 0.0014418543, 0.0017005984, 0.0019101873, 0.0020324946, 0.0020241288, 0.001917344, 0.0018203541, 0.0017387675, 0.0017150178, 0.0017848907, 0.0017967746, 0.0017364796, 0.0015707285, 0.0012430978, 0.00085883564, 0.00043346154, 7.780281e-05, -0.00016104447, -0.0002982206, -0.0003630314, -0.00046408977, -0.0005758948, -0.00068548747, -0.0006971959, -0.0005264176, -0.0001735243, 0.00033775697, 0.00095076795, 0.0015002495, 0.0018145412, 0.0019159958, 0.0016787268, 0.0011854622, 0.00053872, -0.0002633587, -0.0010495019, -0.0019515706, -0.0029096531, -0.0038753652, -0.004903571, -0.005797905, -0.0064990413, -0.0068856166, -0.0069627916, -0.006819605, -0.006531064, -0.0062262043, -0.0059542977, -0.005828759, -0.0057708747, -0.005689965, -0.0055889618, -0.005407001, -0.005231837, -0.005153663, -0.0052067786, -0.005483035, -0.0059694718, -0.006547865, -0.007210509, -0.007875539, -0.00843673, -0.008919329, -0.009280074, -0.009524748, -0.009679234, -0.009689491, -0.0094491765, -0.008934116, -0.008203718, -0.007242174, -0.006204102, -0.0051981057, -0.004247716, -0.0034828975, -0.0028284588, -0.0022833208, -0.001896369, -0.001549531, -0.0012408168, -0.0009923775, -0.0008461541, -0.00083098037, -0.00090432755, -0.001019756, -0.0010988165, -0.0011034984, -0.00097635505, -0.00074342435, -0.0003944624, 8.659951e-05, 0.0006321002, 0.0013600476, 0.0022046329, 0.0031606467, 0.004285039, 0.0054402784, 0.0066134175, 0.0075971773, 0.00831539, 0.00874593, 0.008851873, 0.008781923, 0.008529059, 0.008253473, 0.0079407785, 0.007560093, 0.0071472186, 0.006540162, 0.0058377413, 0.0049843723, 0.0039304243, 0.0028285293, 0.0017591922, 0.0007160192, -0.0003061047, -0.0011905059, -0.0019607751, -0.0025761644, -0.0029543224, -0.0030808407, -0.0029395537, -0.0026154546, -0.002201766, -0.0018186317, -0.0015648578, -0.0014992764, -0.0016311058, -0.0019259162, -0.0022608764, -0.0025570048, -0.0028219884, -0.003084595, -0.00339687, -0.003740442, -0.004215805, -0.0047044395, -0.005101355, -0.005435921, -0.0055214195, -0.005405913, -0.0050808224, -0.004557281, -0.0039196564, -0.003120478, -0.0022355623, -0.0012420615, -0.00017290823, 0.00086579274, 0.0018174103, 0.0025597503, 0.0029787384, 0.003099641, 0.0030101421, 0.0028044668, 0.0026275115, 0.0025100904, 0.0025137642, 0.0026401205, 0.0028077932, 0.0029794343, 0.0031178384, 0.0032805093, 0.0034660613, 0.0037081912, 0.004052022, 0.0044940207, 0.004973743, 0.00540303, 0.005778038, 0.0060389186, 0.006264177, 0.0064897067, 0.0066616368, 0.0067880456, 0.006821984, 0.0066938903, 0.0062805563, 0.005630454, 0.004778864, 0.0037991016, 0.002868645, 0.002059376, 0.0015337383, 0.0012560416, 0.0011328994, 0.0011689821, 0.0012956974, 0.001474824, 0.0017062942, 0.0019702706, 0.0022161624, 0.0025303867, 0.0028024556, 0.0029559499, 0.0030903057, 0.003112967, 0.003137567, 0.0031964774, 0.0032632628, 0.0033925264, 0.00339501, 0.0031787842, 0.0026900594, 0.00189391, 0.00086981064, -0.0003055211, -0.0014726638, -0.0024634423, -0.0031457655, -0.0034589276, -0.003461028, -0.003174599, -0.0026271758, -0.0019284938, -0.0010789556, -5.519474e-05, 0.0010695161, 0.0022125894, 0.0032931438, 0.004223481, 0.0048979577, 0.005279972, 0.0053863428, 0.005220885, 0.004834207, 0.004295674, 0.0036343993, 0.0028463404, 0.0019232117, 0.0009365631, -4.5548877e-05, -0.00094870885, -0.0015554941, -0.0017684386, -0.0015770961, -0.0010005751, -0.00014538976, 0.0008664678, 0.0018346126, 0.0027109128, 0.003399549, 0.0038218894, 0.004059423, 0.0040429756, 0.0038097217, 0.0033651586, 0.00264136, 0.0016680743, 0.0005585877, -0.0005641309, -0.0016743591, -0.0026546242, -0.0035061245, -0.004241187, -0.004868871, -0.0054407977, -0.005878614, -0.0061565815, -0.0061575617, -0.005887708, -0.0053371554, -0.0044712094, -0.0034827662, -0.0024779267, -0.0015939325, -0.0008757211, -0.00039126258, -0.00011472222, 7.065405e-05, 6.0455146e-05, -4.5134195e-05, -0.0002689207, -0.00070483837, -0.0012814979, -0.0019903777, -0.002798434, -0.0036596707, -0.0044620717, -0.00515748, -0.005706749, -0.0061467527, -0.00647126, -0.0066174855, -0.006637972, -0.0064130207, -0.005982315, -0.005351357, -0.004520378, -0.0036888586, -0.0028376472, -0.0020731261, -0.0014646568, -0.0009845033, -0.0006606176, -0.0004352782, -0.00031477664, -0.0002884915, -0.00046932296, -0.0008743593, -0.0013968115, -0.002058552, -0.0026903036, -0.0031587468, -0.0034291851, -0.0033901706, -0.0030872307, -0.0026045707, -0.001967666, -0.0012881417, -0.00064252375, 4.06169e-06, 0.00064494624, 0.0013057953, 0.0019707007, 0.0025439851, 0.0030167864, 0.0033417384, 0.0034847392, 0.0034480449, 0.0032818555, 0.0030202984, 0.002603315, 0.0020360493, 0.0013083174, 0.00042535824, -0.0006741191, -0.0019224394, -0.0031293929, -0.004254613, -0.00511918, -0.005663343, -0.005911971, -0.0058820844, -0.0057008876, -0.005399999, -0.0050080586, -0.0045034275, -0.003911338, -0.0032483125, -0.0025028505, -0.0017362025, -0.0010421615, -0.00058519054, -0.0003737591, -0.00040170405, -0.0006854002, -0.0011471218, -0.0017364402, -0.0024240084, -0.0031773124, -0.003946137, -0.0047267657, -0.005416948, -0.0058933897, -0.0061125746, -0.0059791957, -0.0054664826, -0.004604812, -0.0035138035, -0.0023254158, -0.0011012652, 4.3790107e-05, 0.0010965137, 0.0020643838, 0.0029318703, 0.003723, 0.004368894, 0.004864328, 0.0051757228, 0.00527808, 0.005226155, 0.005004332, 0.0047380663, 0.004501546, 0.004312283, 0.0042017573, 0.0041397815, 0.0041574137, 0.0041875658, 0.004313584, 0.0045693386, 0.0048664105, 0.005324076, 0.0058012605, 0.0061778114, 0.006515342, 0.0066731256, 0.0065922723, 0.006332709, 0.0059806644, 0.0056550163, 0.005344316, 0.005038151, 0.004784612, 0.0044681295, 0.004036938, 0.0035010653, 0.0028080035, 0.0020478654, 0.0012330482, 0.0003848939, -0.00045485064, -0.0013370552, -0.0021943029, -0.0030417, -0.0038796575, -0.004605474, -0.00512692, -0.005395449, -0.0054438706, -0.005284545, -0.005038069, -0.004765168, -0.0045145736, -0.0043561324, -0.0041532284, -0.0039218767, -0.0036780306, -0.0033652722, -0.0030152893, -0.0026522381, -0.002397049, -0.0022149652, -0.0020569374, -0.0019326007, -0.0017655742, -0.0015663356, -0.0012884196, -0.000989897, -0.0007027013, -0.0003726835, -1.9168516e-05, 0.00051482697, 0.0012009729, 0.0019695957, 0.002900052, 0.0038323207, 0.004645801, 0.005280997, 0.005673508, 0.005908739, 0.0059802993, 0.0059515233, 0.0059991013, 0.0060612024, 0.0061162086, 0.0061343885, 0.0060407897, 0.0059232623, 0.0057523604, 0.005563538, 0.00544036, 0.0053640646, 0.00534059, 0.005340409, 0.005318007, 0.005239849, 0.0051364074, 0.0049877465, 0.00480319, 0.0046784417, 0.0046094833, 0.0045065535, 0.004355862, 0.004224307, 0.0040754275, 0.003912427, 0.0037647379, 0.0036711951, 0.0036783973, 0.0037040168, 0.0036440939, 0.0034374981, 0.0031037678, 0.0025952489, 0.0019171943, 0.0012110199, 0.0005555336, -3.903392e-05, -0.00059396384, -0.0010638565, -0.0014533363, -0.0018466484, -0.002237241, -0.0025193812, -0.0027176454, -0.002824555, -0.0027397438, -0.0025901408, -0.0024219572, -0.0022840472, -0.0022589276, -0.0023272152, -0.002535671, -0.0027870804, -0.003066674, -0.0034094653, -0.0037251986, -0.004036491, -0.004336907, -0.004609982, -0.00485476, -0.0049749855, -0.0049484405, -0.004812136, -0.004554882, -0.0042008855, -0.0038066912, -0.0034620676, -0.003160039, -0.002791349, -0.002382376, -0.0019135305, -0.0013617908, -0.000810174, -0.00030167546, 6.438567e-05, 0.00026108156, 0.00025612113, 6.1236983e-06, -0.00037891328, -0.00086889946, -0.0014116744, -0.0019441384, -0.002468268, -0.0029735244, -0.0034711226, -0.0038542892, -0.0040786946, -0.004180219, -0.0041037737, -0.0038608306, -0.0034971167, -0.0030913937, -0.0027090153, -0.002303013, -0.0018740845, -0.0014172686, -0.0008960172, -0.0003388752, 0.00020016803, 0.00062722224, 0.00086651393, 0.0008853767, 0.0007035617, 0.0003418116, -0.000143996, -0.0006328831, -0.0011203525, -0.0015656946, -0.0019240255, -0.0022477705, -0.0025061206, -0.0026430937, -0.0026687146, -0.0025405725, -0.0022024298, -0.001763246, -0.0012793561, -0.00079600554, -0.00041832053, -0.0001526984, -8.799292e-06, 2.79291e-05, 1.4760299e-06, -8.461502e-05, -0.00024671026, -0.0003937178, -0.0005803435, -0.0008524113, -0.0010561026, -0.0012670289, -0.001411714, -0.0014420799, -0.0014658673, -0.0014278366, -0.0014030718, -0.0014332187, -0.0015127765, -0.001581539, -0.0015949191, -0.0015023426, -0.0011995204, -0.00077024323, -0.00019029649, 0.000463154, 0.0010611216, 0.0016090887, 0.0020064618, 0.0022868526, 0.0024866622, 0.0025862202, 0.0026004694, 0.0025610684, 0.0024484366, 0.0021960603, 0.0018394183, 0.0013751247, 0.00086273777, 0.0003207962, -0.00023907502, -0.000737378, -0.0011639277, -0.0015025707, -0.0018045382, -0.0019539925, -0.0018751851, -0.0015541802, -0.0009756221, -0.0002481452, 0.000605546, 0.0014115319, 0.002057378, 0.0023821292, 0.002330907, 0.0020191486, 0.0013701279, 0.00054775516, -0.00037169008, -0.0013343666, -0.0023070946, -0.003322624, -0.0042867567, -0.0052258316, -0.0059964564, -0.0065982, -0.0070134318, -0.007140972, -0.0070608715, -0.0067484407, -0.0062627355, -0.0056094085, -0.004809326, -0.0039178953, -0.0029424396, -0.001959095, -0.0010329924, -0.00026751592, 0.00027287382, 0.00054312736, 0.00060639466, 0.0005551746, 0.00041162307, 0.00029527876, 0.00029275, 0.00038009475, 0.0005275118, 0.00073209184, 0.00097492774, 0.0012502935, 0.0015414028, 0.0018950833, 0.0023474216, 0.0028363862, 0.0033700867, 0.0039047573, 0.004421216, 0.0049158735, 0.0053734933, 0.005821742, 0.006225327, 0.0066202553, 0.0069073467, 0.007048118, 0.0070883073, 0.006897613, 0.0065750917, 0.006179984, 0.005754734, 0.005407174, 0.0050700735, 0.0047998247, 0.0045747585, 0.0043200576, 0.0040648016, 0.0038169844, 0.0036132901, 0.0034911705, 0.0034891425, 0.0035828496, 0.0037618421, 0.0040236027, 0.0042433003, 0.00437644, 0.004486738, 0.0045064786, 0.0044135475, 0.004232233, 0.0039312555, 0.0035194408, 0.002960588, 0.002304688, 0.0015641208, 0.00086375244, 0.00031852085, -0.00013400223, -0.00040967966, -0.0005777352, -0.00064916135, -0.0006680816, -0.0007361311, -0.0008084397, -0.00086057524, -0.0008355219, -0.0007432677, -0.00055340515, -0.0003319165, -7.778815e-05, 0.00012632842, 0.00022416166, 0.0002472224, 9.446312e-05, -7.8127465e-05, -0.00029290022, -0.0005514666, -0.0008187024, -0.0011051418, -0.0014036756, -0.001674228, -0.0019003889, -0.00211801, -0.0021643725, -0.0022105167, -0.002151036, -0.0020743578, -0.002053237, -0.0020026823, -0.002036644, -0.0019396127, -0.0018484594, -0.0015398504, -0.0011251139, -0.0006165376, -6.651446e-05, 0.00038834324, 0.0008766581, 0.001035259, 0.0012277545, 0.0011169695, 0.0009566424, 0.00066717336, 0.00019626536, -0.00021118169, -0.0009717454, -0.0012591656, -0.0023070564, -0.0019029664, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-constexpr float kDobro[4096] = {-0.00981219, -0.0038185236, 0.0049527963, 0.011819143, 0.022361495, 0.03303949, 0.044529364, 0.05211804, 0.06008378, 0.061616965, 0.055319108, 0.0598853, 0.052209474, 0.023656646, 0.02777445, 0.03576277, -0.003424054, -0.03506387, -0.028059365, -0.027775705, -0.06536293, -0.10535985, -0.15043615, -0.2300084, -0.29038602, -0.35889912, -0.48240513, -0.5441027, -0.5657949, -0.6568828, -0.67779726, -0.6558045, -0.71217734, -0.6499925, -0.5414187, -0.5440887, -0.43604162, -0.29180464, -0.28229728, -0.20426404, -0.060218524, -0.01782882, 0.009940873, 0.076813094, 0.07183518, 0.018461155, 0.008422728, -0.027855186, -0.09876429, -0.11515488, -0.1416902, -0.2188386, -0.23366286, -0.20600465, -0.23885962, -0.21751086, -0.104042165, -0.052090682, 0.015671741, 0.14524132, 0.19918995, 0.29091918, 0.4505941, 0.48255673, 0.49084938, 0.5790829, 0.58607304, 0.5200038, 0.5010549, 0.47431922, 0.38566223, 0.3263152, 0.28254405, 0.1802378, 0.13792217, 0.14839365, 0.08868332, 0.06775946, 0.12515739, 0.1534563, 0.17898735, 0.2370659, 0.28747374, 0.3488874, 0.4335599, 0.4866802, 0.5327456, 0.5967736, 0.6320238, 0.66102475, 0.6968258, 0.7167608, 0.7144163, 0.6890568, 0.6874071, 0.6852686, 0.6356874, 0.60787356, 0.591531, 0.5350674, 0.50101334, 0.48480487, 0.4403627, 0.41934577, 0.4487439, 0.46379682, 0.44933978, 0.478549, 0.5212238, 0.5284233, 0.55510247, 0.59063804, 0.61213785, 0.6347509, 0.6399842, 0.62610936, 0.61709625, 0.61331433, 0.5821937, 0.53872925, 0.5047626, 0.45653123, 0.4244711, 0.40887558, 0.3536561, 0.3010975, 0.28174636, 0.24360067, 0.19792584, 0.174883, 0.15805846, 0.12463064, 0.08349764, 0.061844993, 0.03176441, -0.010140188, -0.040052775, -0.0850565, -0.13417545, -0.16005039, -0.18013048, -0.20822553, -0.23367041, -0.24556223, -0.26149744, -0.2824717, -0.28616774, -0.28752613, -0.28586605, -0.26956332, -0.25278044, -0.22120577, -0.19749513, -0.20133904, -0.18273912, -0.15156615, -0.14406525, -0.14586453, -0.14847893, -0.16063938, -0.18080208, -0.19359657, -0.20601182, -0.2459572, -0.2838097, -0.28828543, -0.30241236, -0.31398302, -0.29602787, -0.2868357, -0.28034067, -0.26177645, -0.24496782, -0.22714181, -0.20278183, -0.1876856, -0.18508224, -0.18149813, -0.19999401, -0.23047037, -0.25464675, -0.31231025, -0.37997153, -0.41060916, -0.44572318, -0.50745654, -0.5562112, -0.58796734, -0.6073571, -0.5971482, -0.567686, -0.53608865, -0.49681085, -0.43405834, -0.3549618, -0.27482954, -0.1947065, -0.1265838, -0.07246899, -0.032054707, -0.0066252747, 0.013690835, 0.012535111, -0.011899153, -0.034274936, -0.06700093, -0.120177954, -0.16903286, -0.21384282, -0.253241, -0.26609775, -0.26663405, -0.254358, -0.2185114, -0.18128447, -0.12790781, -0.03983729, 0.04460392, 0.115038365, 0.19207145, 0.2467987, 0.2783046, 0.3209724, 0.33365318, 0.29340178, 0.2503454, 0.2025159, 0.12001256, 0.035213504, -0.03408682, -0.10957105, -0.17850739, -0.22193702, -0.24305807, -0.249225, -0.24330887, -0.22583939, -0.18934254, -0.12545983, -0.055932987, 0.008129821, 0.0696698, 0.11300612, 0.14525914, 0.18488659, 0.20871532, 0.19865173, 0.18343148, 0.15933877, 0.10726664, 0.0578094, 0.019283744, -0.029753108, -0.07358031, -0.09204731, -0.10024431, -0.10047908, -0.089859635, -0.07490847, -0.045004144, -0.00735948, 0.034532845, 0.08322234, 0.115871355, 0.13774796, 0.16861251, 0.19396423, 0.19667178, 0.18936779, 0.17519625, 0.14178924, 0.105878666, 0.07613028, 0.043368075, 0.017008342, 0.00093526475, -0.005597204, 0.0069255517, 0.031637203, 0.05789256, 0.09455796, 0.13621144, 0.1767767, 0.22835116, 0.2723411, 0.28602195, 0.28870854, 0.28803676, 0.26317272, 0.22503857, 0.1827328, 0.11735384, 0.04957431, -0.0019942238, -0.044564184, -0.07613939, -0.10487796, -0.120225385, -0.10869356, -0.08626956, -0.053427543, 0.0010511249, 0.05929725, 0.109997764, 0.17365402, 0.23629521, 0.27370197, 0.30651063, 0.33926785, 0.35124832, 0.34884378, 0.33821988, 0.30560923, 0.25794327, 0.20637208, 0.16182838, 0.13522695, 0.11203244, 0.0901175, 0.07838176, 0.07324452, 0.070547566, 0.08305807, 0.11325929, 0.13010393, 0.14457406, 0.17879413, 0.20600225, 0.21801014, 0.2339123, 0.25090888, 0.25282037, 0.2511851, 0.24983619, 0.23064548, 0.20577039, 0.19242159, 0.180304, 0.16452056, 0.15687779, 0.15198645, 0.14948969, 0.15900181, 0.17113969, 0.18659069, 0.20017852, 0.20437874, 0.20690675, 0.20776086, 0.20487995, 0.19087762, 0.16332746, 0.12390447, 0.07849236, 0.04126562, 0.01238626, -0.013005575, -0.034452364, -0.044251956, -0.04276195, -0.036460854, -0.018664846, 0.011628225, 0.047240864, 0.085398644, 0.127654, 0.16096562, 0.17539325, 0.18598895, 0.19004738, 0.1785085, 0.16313548, 0.14173512, 0.09979265, 0.04770848, -0.0058195977, -0.0716955, -0.13424186, -0.18253586, -0.23132586, -0.2717033, -0.29478508, -0.3106161, -0.31382486, -0.30178818, -0.2924465, -0.27608252, -0.23612276, -0.1917627, -0.15437348, -0.11801274, -0.083048396, -0.058771886, -0.04689355, -0.045155495, -0.058020104, -0.07778489, -0.10393077, -0.1417645, -0.18702637, -0.23668818, -0.28329334, -0.32342625, -0.35369086, -0.37052256, -0.38020688, -0.38333383, -0.3751976, -0.36102435, -0.34291536, -0.3142969, -0.2828541, -0.257152, -0.23725241, -0.22547476, -0.21786086, -0.20966463, -0.20600836, -0.21141554, -0.21325676, -0.210925, -0.22026974, -0.23068316, -0.23273663, -0.23738614, -0.24352345, -0.24371776, -0.24442725, -0.2498969, -0.25152856, -0.25496438, -0.26616567, -0.27188388, -0.27568024, -0.28809252, -0.2971224, -0.29780442, -0.30145878, -0.30672428, -0.3076327, -0.30629668, -0.29737025, -0.27917737, -0.25785178, -0.22896914, -0.19682145, -0.17660888, -0.15974502, -0.13453867, -0.11306274, -0.09736334, -0.07915297, -0.0642009, -0.060193334, -0.066065624, -0.0772749, -0.09417732, -0.1104305, -0.119773105, -0.13234222, -0.15051073, -0.16800842, -0.18381801, -0.1955635, -0.1979701, -0.1879683, -0.16835235, -0.1440314, -0.11685127, -0.085922, -0.051546033, -0.012959851, 0.0275099, 0.063703924, 0.092347026, 0.11221637, 0.12576197, 0.1341674, 0.13733155, 0.13501143, 0.1312529, 0.1262437, 0.1112754, 0.098838806, 0.09588494, 0.09064067, 0.090010755, 0.09578175, 0.09620758, 0.09623782, 0.103283405, 0.106773056, 0.10471637, 0.104192406, 0.10088799, 0.09292121, 0.08358721, 0.07755639, 0.07204531, 0.062118147, 0.051227618, 0.0421214, 0.03785179, 0.038826358, 0.04980873, 0.07155643, 0.093987346, 0.11402856, 0.13240795, 0.1518345, 0.17064895, 0.18841957, 0.20926641, 0.22574237, 0.23175733, 0.22909537, 0.2168191, 0.1959968, 0.17400458, 0.15244158, 0.12834941, 0.10260474, 0.07770054, 0.05660077, 0.03559484, 0.01737406, 0.011641897, 0.016138133, 0.028901223, 0.052305806, 0.083830565, 0.11763955, 0.15265714, 0.18964474, 0.22374709, 0.2543054, 0.28065044, 0.2986773, 0.30705142, 0.30363223, 0.29072195, 0.27163628, 0.2456363, 0.2152497, 0.18358839, 0.15078607, 0.117914565, 0.086709775, 0.05775178, 0.034181986, 0.018566024, 0.010402671, 0.0061271857, 0.0018003815, 0.0008997893, 0.003429151, 0.0057596937, 0.0098401075, 0.018350301, 0.029503211, 0.036298174, 0.03992045, 0.04441107, 0.04795325, 0.052619267, 0.062080625, 0.07500961, 0.08463989, 0.090988815, 0.09561346, 0.09161071, 0.08063629, 0.07042792, 0.058977257, 0.043336082, 0.026210878, 0.0056250803, -0.017784635, -0.04056278, -0.06403827, -0.083877236, -0.09774411, -0.10677164, -0.108711414, -0.1040411, -0.09670799, -0.08809035, -0.07407888, -0.05621519, -0.03593355, -0.010130324, 0.016709452, 0.04052761, 0.063298985, 0.08376395, 0.095516436, 0.098822616, 0.09611198, 0.08409484, 0.06263373, 0.03264237, -0.0034225562, -0.04351152, -0.086794816, -0.12816557, -0.1630671, -0.18976742, -0.21015695, -0.22312838, -0.22604053, -0.21936129, -0.20085144, -0.1730637, -0.14126635, -0.107367724, -0.074894585, -0.046238456, -0.02374215, -0.010706272, -0.004724405, -0.0044884607, -0.014896081, -0.034653507, -0.0605824, -0.09464281, -0.13274251, -0.16648166, -0.19458507, -0.21849546, -0.23382403, -0.24246565, -0.25119543, -0.2545588, -0.24897411, -0.24000248, -0.22889844, -0.21500836, -0.20057936, -0.18656388, -0.17274468, -0.162535, -0.15738809, -0.15481822, -0.15481704, -0.15494779, -0.15337949, -0.15473431, -0.15761508, -0.15733996, -0.15836547, -0.1607155, -0.15807115, -0.15213075, -0.14431581, -0.13270673, -0.120769605, -0.11242271, -0.10568648, -0.09917609, -0.09599755, -0.09639757, -0.09930958, -0.10753834, -0.122746386, -0.14032352, -0.15620254, -0.16991004, -0.18028207, -0.18985689, -0.19788513, -0.19974981, -0.19596183, -0.18669249, -0.17228137, -0.15441556, -0.13546047, -0.11517771, -0.09358549, -0.0778885, -0.0690656, -0.06291011, -0.061644454, -0.066864945, -0.07647366, -0.091361575, -0.11230471, -0.13403384, -0.1542144, -0.17380087, -0.1881109, -0.19294333, -0.19100991, -0.18345168, -0.16889954, -0.15114965, -0.13138612, -0.10980675, -0.08968085, -0.06830133, -0.044400156, -0.024542285, -0.012043518, -0.0032358896, 0.00072547834, -0.00069200055, -0.0004427641, -0.0005183949, -0.0039525363, -0.0039229356, -0.00037027945, 8.252523e-05, 0.0002864631, 0.005957376, 0.014765072, 0.028267357, 0.047918063, 0.067382544, 0.08457161, 0.1010245, 0.11540511, 0.12572931, 0.13215351, 0.13263161, 0.12535053, 0.11259175, 0.094607554, 0.0734877, 0.05321283, 0.03359039, 0.013980991, -0.0014570457, -0.008942676, -0.011522343, -0.009431767, 0.00019016572, 0.015217805, 0.034230825, 0.058831256, 0.086020336, 0.1092372, 0.12940902, 0.14724141, 0.15683855, 0.15831609, 0.15435436, 0.14278857, 0.1251716, 0.107409075, 0.08764645, 0.06345427, 0.04138616, 0.023884999, 0.010548855, 0.0053924774, 0.009243737, 0.019059328, 0.034455325, 0.0542861, 0.074671865, 0.09807852, 0.124891914, 0.14800723, 0.16687982, 0.1832897, 0.19266252, 0.1943799, 0.1924975, 0.18281506, 0.1658573, 0.15135069, 0.13682687, 0.11888021, 0.10323317, 0.09117141, 0.082568586, 0.08057375, 0.084436186, 0.090878926, 0.10145923, 0.117465094, 0.13493988, 0.14986618, 0.16112493, 0.16663337, 0.16477564, 0.15785158, 0.14593588, 0.1286937, 0.10785109, 0.08240843, 0.05317521, 0.025099399, 0.00083725236, -0.019141283, -0.034143295, -0.046038717, -0.054919906, -0.059144042, -0.059713844, -0.05712683, -0.052369133, -0.045340296, -0.0364289, -0.029270293, -0.025410227, -0.02513127, -0.02840681, -0.033321206, -0.037893392, -0.042397365, -0.047396705, -0.051666357, -0.05482462, -0.056380425, -0.05496648, -0.050030712, -0.04232904, -0.032583322, -0.019901872, -0.0067872005, 0.0027607812, 0.009808102, 0.0138861695, 0.0131659815, 0.010505733, 0.006416335, -0.0018946049, -0.014439402, -0.03163358, -0.053177368, -0.07389467, -0.09160823, -0.10825724, -0.12201446, -0.13081363, -0.13520467, -0.1343551, -0.1271553, -0.115085885, -0.09946062, -0.07931589, -0.057037015, -0.037500504, -0.021423977, -0.00990142, -0.006363322, -0.010455274, -0.02081725, -0.03944262, -0.065875836, -0.097000666, -0.13197505, -0.1669455, -0.19803184, -0.22530937, -0.24608752, -0.25910798, -0.26486844, -0.26215976, -0.25085413, -0.23325177, -0.21315342, -0.18896799, -0.16107821, -0.13573374, -0.1134771, -0.09501812, -0.08408103, -0.07941878, -0.07846389, -0.0831401, -0.09285463, -0.102138795, -0.11194564, -0.123729765, -0.13278444, -0.13933514, -0.14494443, -0.14548004, -0.13949691, -0.12952939, -0.116441004, -0.102629796, -0.09071522, -0.078440316, -0.06539579, -0.054064643, -0.04461006, -0.038617942, -0.038400106, -0.041995496, -0.04748145, -0.05571043, -0.06477863, -0.07274409, -0.08143514, -0.08862777, -0.09041968, -0.08939769, -0.086399324, -0.078319095, -0.066373594, -0.052484844, -0.03749317, -0.023449484, -0.011689321, -0.0034978362, 0.00028241062, -0.0011168339, -0.008000788, -0.020295423, -0.03833089, -0.058981292, -0.0789432, -0.098386556, -0.116397426, -0.13094118, -0.14032796, -0.14218976, -0.1370441, -0.12773322, -0.11364875, -0.09449191, -0.07231649, -0.046977807, -0.019635709, 0.0054620765, 0.026687244, 0.044589177, 0.057866268, 0.06538172, 0.06756934, 0.06415316, 0.056318104, 0.047123656, 0.037219293, 0.026923187, 0.018276377, 0.012060256, 0.00798111, 0.0072374344, 0.011603226, 0.01973582, 0.028497888, 0.037725475, 0.04929733, 0.0623491, 0.07460273, 0.0843991, 0.08971573, 0.09220085, 0.09372584, 0.09170585, 0.086015016, 0.078656994, 0.06931435, 0.058897696, 0.050145227, 0.043485645, 0.038918905, 0.037766144, 0.039852086, 0.04512462, 0.054052647, 0.06386674, 0.07226573, 0.08135729, 0.09033298, 0.09559782, 0.09712544, 0.094130754, 0.084344074, 0.06971521, 0.0541518, 0.037669767, 0.020270392, 0.004527078, -0.00807571, -0.015422307, -0.0150066, -0.006818508, 0.0064118337, 0.023405747, 0.04622929, 0.074356586, 0.104365595, 0.1336449, 0.159826, 0.17989445, 0.19306958, 0.2002163, 0.19902335, 0.18837501, 0.17105228, 0.14819118, 0.120971985, 0.092186205, 0.06271103, 0.034021962, 0.009239405, -0.0106457425, -0.024842488, -0.030983848, -0.030398654, -0.025418142, -0.014025456, 0.0035355883, 0.025148027, 0.049696263, 0.07379229, 0.0951396, 0.11451469, 0.13198902, 0.14424738, 0.14938743, 0.1493861, 0.1444927, 0.13364355, 0.11817588, 0.09973449, 0.07827667, 0.056946386, 0.03937974, 0.024544198, 0.012264137, 0.0021829295, -0.006882023, -0.013015075, -0.015045787, -0.015023178, -0.014794047, -0.014387091, -0.0150458105, -0.017334923, -0.018864183, -0.020296767, -0.023583349, -0.026713233, -0.028565424, -0.028879223, -0.02520003, -0.018273786, -0.011219003, -0.003204583, 0.0072599635, 0.018366557, 0.028771391, 0.038274255, 0.04497972, 0.047671545, 0.04616125, 0.039244343, 0.026553994, 0.0089322, -0.012082304, -0.034489073, -0.05720258, -0.080605015, -0.10377986, -0.1233081, -0.13745323, -0.1451841, -0.14538679, -0.13974372, -0.12934048, -0.11415074, -0.09519053, -0.07287222, -0.0483011, -0.024641985, -0.004768289, 0.010644429, 0.022217084, 0.029153572, 0.029792117, 0.023852035, 0.011588449, -0.0059799133, -0.027132906, -0.05148498, -0.07761706, -0.10235837, -0.12487924, -0.1441882, -0.1582167, -0.16800657, -0.17348029, -0.17198892, -0.16417694, -0.15296067, -0.13941853, -0.124913864, -0.11131851, -0.0978573, -0.084573776, -0.07313061, -0.064619854, -0.060956378, -0.06272977, -0.06760546, -0.07315952, -0.07923301, -0.08579615, -0.09146691, -0.09634834, -0.10037758, -0.1015787, -0.10076968, -0.09963639, -0.096267365, -0.091042, -0.08690262, -0.08319892, -0.07971186, -0.078926265, -0.0803648, -0.082613386, -0.08689243, -0.09320021, -0.099835984, -0.10534359, -0.1081485, -0.10745473, -0.10505418, -0.101774484, -0.09515617, -0.08559189, -0.074218504, -0.059601117, -0.04376763, -0.030335141, -0.019514665, -0.01058155, -0.004320649, -0.0009394466, -0.00070361426, -0.005561968, -0.014793803, -0.026531879, -0.04137426, -0.05840166, -0.07476904, -0.088719316, -0.0997716, -0.10642882, -0.1075726, -0.10448672, -0.09615203, -0.08129901, -0.062220056, -0.04035782, -0.016695838, 0.005860141, 0.025782252, 0.044040434, 0.05921854, 0.068496056, 0.07271426, 0.07209522, 0.06543203, 0.05543141, 0.04408792, 0.030045647, 0.014419009, -0.00022171752, -0.013073953, -0.02293199, -0.028459748, -0.031010417, -0.03124868, -0.02771294, -0.021370629, -0.01329756, -0.0030586375, 0.008572226, 0.02041606, 0.032159597, 0.042893257, 0.050880436, 0.05697384, 0.061712112, 0.064672746, 0.068240836, 0.07304657, 0.07672555, 0.078761235, 0.08173961, 0.08572398, 0.08891951, 0.09328368, 0.09817823, 0.10061026, 0.10165123, 0.102275714, 0.1011279, 0.09797281, 0.093290664, 0.08576074, 0.075484626, 0.06438603, 0.052207924, 0.03889636, 0.026250271, 0.01555002, 0.007568076, 0.0033186255, 0.0033367584, 0.007766464, 0.017074097, 0.03079891, 0.0469717, 0.06443834, 0.08253816, 0.099107675, 0.11370352, 0.12699693, 0.13606353, 0.13877745, 0.13632752, 0.12846187, 0.11536201, 0.09981243, 0.08272893, 0.06372995, 0.04423224, 0.025939172, 0.0106997555, 0.00047085507, -0.004419834, -0.005249217, -0.0022699828, 0.005233454, 0.015583389, 0.027231788, 0.04004205, 0.052933436, 0.065172404, 0.075878814, 0.08356565, 0.08753021, 0.08815926, 0.08579398, 0.08050613, 0.07331474, 0.06501301, 0.05599224, 0.046656147, 0.037955098, 0.031132396, 0.025291055, 0.01976968, 0.015132071, 0.010790709, 0.007067784, 0.005205257, 0.004363612, 0.0031925729, 0.0013338777, -0.0017039323, -0.005292115, -0.008912028, -0.013582537, -0.019244825, -0.025269266, -0.031397056, -0.036963787, -0.040995363, -0.042943787, -0.04276099, -0.039564602, -0.033409722, -0.025906067, -0.017580003, -0.008369739, 0.0007513813, 0.008370241, 0.014270291, 0.017660696, 0.01665218, 0.011625826, 0.0039556776, -0.0063575213, -0.019203903, -0.033328637, -0.04788031, -0.062223606, -0.074570514, -0.08352247, -0.08864316, -0.09012323, -0.088253446, -0.08273128, -0.07342192, -0.061422303, -0.048871957, -0.03718658, -0.027099123, -0.018903103, -0.012581204, -0.008816651, -0.008360623, -0.011271717, -0.0170528, -0.025543887, -0.036435965, -0.048275173, -0.059326686, -0.06891786, -0.0766246, -0.08130537, -0.08336288, -0.08366112, -0.08169367, -0.07748467, -0.07151499, -0.06408266, -0.055880003, -0.04805432, -0.04083457, -0.03403488, -0.028502483, -0.024628833, -0.023000821, -0.024531148, -0.028102126, -0.032897104, -0.03942954, -0.046610575, -0.053133056, -0.05898158, -0.06357337, -0.06594984, -0.06662008, -0.066335894, -0.06448953, -0.061393462, -0.05801733, -0.054450516, -0.05167643, -0.05049998, -0.050190877, -0.050336245, -0.051107198, -0.052765794, -0.05546559, -0.058447216, -0.06074861, -0.06166745, -0.060478386, -0.056723118, -0.050359182, -0.041987643, -0.031610258, -0.019037796, -0.005630712, 0.0070906673, 0.01840284, 0.027433231, 0.03308891, 0.035298992, 0.033795655, 0.027865704, 0.018802503, 0.0074398946, -0.0065333163, -0.022126343, -0.03812613, -0.053075712, -0.06523121, -0.07362073, -0.0778945, -0.07744517, -0.07199976, -0.062596746, -0.04975506, -0.033778545, -0.015828958, 0.0028116335, 0.021446802, 0.039468404, 0.055465557, 0.0692232, 0.07984591, 0.08555703, 0.0866554, 0.083148144, 0.07524525, 0.06397029, 0.050372105, 0.03585401, 0.021412758, 0.007915716, -0.0039387965, -0.013166571, -0.018974207, -0.021233631, -0.019909687, -0.015348463, -0.008721779, -0.0013765327, 0.006829776, 0.015767885, 0.024237541, 0.031878017, 0.038504623, 0.04315135, 0.045617636, 0.04707606, 0.04781616, 0.048424087, 0.049888905, 0.05176267, 0.05436295, 0.058038976, 0.062463723, 0.067403845, 0.0719197, 0.07524, 0.076498024, 0.0754999, 0.072886184, 0.068510115, 0.06280979, 0.05577263, 0.046735052, 0.03677429, 0.027020415, 0.01821739, 0.011702803, 0.008377653, 0.008290001, 0.011152335, 0.017216668, 0.026534187, 0.038426325, 0.05235887, 0.067414284, 0.08223798, 0.095771365, 0.10700418, 0.11506105, 0.12002065, 0.12192716, 0.120260045, 0.11503371, 0.105974115, 0.09334058, 0.0784513, 0.062338363, 0.046112724, 0.031024752, 0.018198054, 0.00798076, 0.0009892187, -0.0019849571, -0.0011423083, 0.0031358695, 0.009844804, 0.018508937, 0.028676063, 0.039418586, 0.050155234, 0.05958517, 0.06705243, 0.07211726, 0.074213676, 0.07328706, 0.06916104, 0.06236109, 0.053840324, 0.04437187, 0.03449613, 0.024856964, 0.016086265, 0.008945787, 0.004241967, 0.0019653267, 0.0019266639, 0.0035098898, 0.005962382, 0.008960524, 0.01238173, 0.016075747, 0.019309152, 0.0214848, 0.022119239, 0.021202827, 0.019330978, 0.016451051, 0.012510165, 0.008221056, 0.004425157, 0.0014220078, -0.00052305456, -0.0010573823, -0.0004895365, 0.00052101514, 0.0019204504, 0.0038641728, 0.005573496, 0.0065567777, 0.0065271663, 0.004944117, 0.002096663, -0.0026676387, -0.009940013, -0.01871818, -0.028485714, -0.03890763, -0.04929859, -0.059160464, -0.06826387, -0.07584808, -0.08061936, -0.08186351, -0.0791136, -0.072585955, -0.06323324, -0.052127033, -0.04013657, -0.027786786, -0.016052961, -0.006024762, 0.0014454117, 0.0058912723, 0.006940442, 0.0039055701, -0.0033339947, -0.014468465, -0.028847942, -0.04498672, -0.06143604, -0.07762336, -0.09282077, -0.105665326, -0.11513684, -0.120668, -0.12208706, -0.119676925, -0.113706894, -0.10461557, -0.09320471, -0.0801449, -0.06648111, -0.05345794, -0.041790813, -0.031675067, -0.022957943, -0.016057048, -0.011340038, -0.008988061, -0.0092176255, -0.011376921, -0.014627228, -0.018479666, -0.022640692, -0.026573671, -0.03006732, -0.03321182, -0.03586219, -0.038542632, -0.04130763, -0.04333176, -0.044531517, -0.04559183, -0.046896923, -0.04907798, -0.052426167, -0.05563788, -0.0583985, -0.06087709, -0.062298227, -0.06272356, -0.062082984, -0.05948716, -0.054448478, -0.0470897, -0.03773093, -0.02685142, -0.014880303, -0.0024030295, 0.009415455, 0.019638533, 0.027386645, 0.03189985, 0.03320065, 0.031397786, 0.026776023, 0.019667938, 0.010067701, -0.0012782961, -0.01322644, -0.025231972, -0.03639587, -0.04528885, -0.051038854, -0.05293635, -0.050344534, -0.04401096, -0.034689825, -0.022034613, -0.0065778387, 0.0102041, 0.027113495, 0.043073762, 0.05665364, 0.06720393, 0.074874595, 0.07913128, 0.07984297, 0.07703234, 0.07051664, 0.061118636, 0.049862634, 0.03756357, 0.024916422, 0.012778752, 0.0021143728, -0.0061760223, -0.011064635, -0.012694978, -0.011816077, -0.0085231345, -0.0031167583, 0.0038245132, 0.011803306, 0.020357247, 0.028936356, 0.03674501, 0.043294966, 0.048281375, 0.051248834, 0.052322384, 0.051660143, 0.04948967, 0.04680793, 0.043942273, 0.040700205, 0.037590716, 0.035165817, 0.033740975, 0.033568393, 0.034195792, 0.034897868, 0.035589185, 0.03586385, 0.035225544, 0.033945665, 0.031925805, 0.028956162, 0.025481224, 0.021820337, 0.01818551, 0.014795673, 0.0115715945, 0.008853332, 0.007575393, 0.008345057, 0.011158982, 0.015753124, 0.021676295, 0.028340327, 0.035214894, 0.041777972, 0.04734648, 0.051071543, 0.052504037, 0.051601984, 0.04837181, 0.04303601, 0.035837203, 0.026997339, 0.017097833, 0.007356153, -0.0014415325, -0.009178769, -0.015319779, -0.019389786, -0.02105145, -0.019798374, -0.015132474, -0.0075571965, 0.0018976966, 0.013006013, 0.024962189, 0.036955025, 0.048326693, 0.05775081, 0.06463644, 0.06888003, 0.070142895, 0.068307176, 0.06378455, 0.05628329, 0.045654453, 0.033390384, 0.020672366, 0.008389242, -0.0025466217, -0.011676552, -0.01853977, -0.022880817, -0.024334956, -0.023139704, -0.020278016, -0.015902083, -0.010183507, -0.0041908347, 0.0014497432, 0.00612417, 0.009341502, 0.011762723, 0.01363844, 0.014774497, 0.015222464, 0.014807049, 0.013468944, 0.011926757, 0.011287783, 0.011431253, 0.012148809, 0.013887836, 0.016361997, 0.019410653, 0.023063522, 0.026419133, 0.028361976, 0.028889336, 0.028122807, 0.025830671, 0.022280913, 0.01728306, 0.010501621, 0.0023950695, -0.006124684, -0.01444822, -0.022400366, -0.02970629, -0.03600752, -0.040596314, -0.04275743, -0.042271238, -0.039466515, -0.034391243, -0.026960256, -0.017832205, -0.007388548, 0.0032166308, 0.012345692, 0.019686203, 0.02515003, 0.028287558, 0.028646978, 0.026207808, 0.020870142, 0.012642487, 0.0022942536, -0.009162926, -0.020819759, -0.03212314, -0.042083494, -0.04976831, -0.054693352, -0.05650633, -0.05566074, -0.052368846, -0.046867687, -0.039671488, -0.031281475, -0.023056332, -0.01615237, -0.010957811, -0.0073065055, -0.00530193, -0.0054685757, -0.007683978, -0.011650089, -0.016847746, -0.022528041, -0.02787639, -0.032680508, -0.03711061, -0.04030082, -0.0414482, -0.04055129, -0.0381044, -0.03455142, -0.031048814, -0.02867434, -0.026696105, -0.025334544, -0.025135644, -0.025951587, -0.02791515, -0.0305386, -0.033587538, -0.03668221, -0.039529003, -0.04214902, -0.043791473, -0.04405783, -0.042849995, -0.04012003, -0.036407925, -0.031711653, -0.025332054, -0.01775041, -0.010154377, -0.0029761915, 0.0030970157, 0.0072585335, 0.009824601, 0.01074742, 0.008969569, 0.0045801247, -0.0017351446, -0.009660019, -0.018424552, -0.027290475, -0.035793725, -0.043525226, -0.049678948, -0.053261425, -0.05381338, -0.051116, -0.04542585, -0.03730292, -0.026980415, -0.015108796, -0.0030081733, 0.008474485, 0.018579453, 0.026256295, 0.03168227, 0.03494865, 0.035006054, 0.031970374, 0.026795084, 0.020095741, 0.012442511, 0.004518576, -0.0032597245, -0.010739167, -0.016621493, -0.019841513, -0.020419534, -0.018286899, -0.013657527, -0.006998642, 0.0012011966, 0.010812054, 0.020878486, 0.030464545, 0.03943436, 0.046950247, 0.05330688, 0.058707204, 0.062115643, 0.06319307, 0.062347244, 0.05987611, 0.055778045, 0.050723664, 0.045153234, 0.039397914, 0.034175355, 0.0300336, 0.027045876, 0.02468131, 0.022976317, 0.022059394, 0.021936042, 0.022344984, 0.022894617, 0.023384865, 0.023366595, 0.02322325, 0.023340436, 0.023714934, 0.024396257, 0.025105538, 0.026152994, 0.028056242, 0.03071376, 0.03427411, 0.038835328, 0.043820575, 0.049363494, 0.05578584, 0.06248441, 0.06853511, 0.073235795, 0.076142386, 0.076689176, 0.07477452, 0.07069236, 0.064566776, 0.056520715, 0.047057696, 0.036732323, 0.025641954, 0.014187585, 0.0032761248, -0.0060756044, -0.013114532, -0.017181203, -0.018163582, -0.016443029, -0.011972744, -0.005203253, 0.0034673, 0.013654136, 0.024002554, 0.0334261, 0.041468333, 0.047838647, 0.05214873, 0.054283123, 0.05427212, 0.051656306, 0.046729237, 0.04033293, 0.032351505, 0.022928514, 0.01279874, 0.0024403357, -0.0073537477, -0.015640572, -0.021886757, -0.026232576, -0.028780472, -0.02943244, -0.028592724, -0.026659537, -0.023985956, -0.02074796, -0.017307617, -0.014164753, -0.011410361, -0.009325405, -0.008071734, -0.0077653406, -0.008225211, -0.008930855, -0.009713611, -0.010593101, -0.01145288, -0.011827643, -0.011815952, -0.011282962, -0.009839581, -0.008291901, -0.0070617134, -0.006083733, -0.005791659, -0.0066384175, -0.008697328, -0.011933766, -0.016454354, -0.021767002, -0.027140094, -0.032288443, -0.03721815, -0.041903015, -0.045829955, -0.048307344, -0.04902924, -0.04781417, -0.044530466, -0.03946331, -0.03295647, -0.025429675, -0.017503358, -0.0097126905, -0.0025569196, 0.003475979, 0.007987533, 0.010794057, 0.011562467, 0.0100077875, 0.0061887633, 0.00032227134, -0.0068598487, -0.014786115, -0.023587003, -0.0328845, -0.0417462, -0.049506586, -0.055352837, -0.058865916, -0.0599582, -0.058428176, -0.05458933, -0.048651442, -0.041277803, -0.033379234, -0.025320275, -0.017599333, -0.010572711, -0.0044679847, 0.00048964197, 0.0037080275, 0.004885135, 0.004248109, 0.0019743668, -0.0012841664, -0.0054016947, -0.010280449, -0.01506796, -0.01945299, -0.023451535, -0.026482057, -0.028267583, -0.02925025, -0.029153507, -0.027813287, -0.025798678, -0.023423826, -0.02089083, -0.018539088, -0.016432336, -0.014223604, -0.012249181, -0.010768054, -0.009626288, -0.009043115, -0.008727716, -0.0086059235, -0.008831093, -0.009055423, -0.009052733, -0.008530707, -0.007433579, -0.006115694, -0.0049557686, -0.0044663493, -0.0046823984, -0.005272999, -0.0063871145, -0.008288207, -0.011008891, -0.014347986, -0.018103158, -0.021838704, -0.025006697, -0.027767237, -0.029852636, -0.030628955, -0.029974021, -0.027668415, -0.023792531, -0.01865646, -0.012236328, -0.004470149, 0.004175676, 0.013110198, 0.021672057, 0.028855368, 0.034360107, 0.03796519, 0.03939512, 0.038709886, 0.03576365, 0.030833013, 0.024180207, 0.015978213, 0.006742879, -0.0029329124, -0.012424015, -0.021132682, -0.028301321, -0.033443812, -0.036610086, -0.037748817, -0.036612377, -0.033357162, -0.028141888, -0.021246506, -0.013444074, -0.005399394, 0.0024737797, 0.010224833, 0.017332515, 0.02325708, 0.028142244, 0.031745724, 0.034226306, 0.035615936, 0.035653494, 0.03430374, 0.03157902, 0.027927024, 0.023944052, 0.019983584, 0.015976297, 0.012259473, 0.009154233, 0.0065537025, 0.0046661277, 0.0036298665, 0.0034902191, 0.004141461, 0.0056463834, 0.00800985, 0.010801753, 0.0137302745, 0.016621325, 0.01924575, 0.021557577, 0.023880247, 0.02615564, 0.02818956, 0.029915594, 0.03139386, 0.033104435, 0.035018176, 0.036861606, 0.03840707, 0.0394557, 0.039843965, 0.03934805, 0.037995618, 0.03557507, 0.03223433, 0.028439315, 0.024376977, 0.020225318, 0.0160267, 0.012030439, 0.008450784, 0.00544605, 0.0035337976, 0.0029969844, 0.0035786047, 0.0052658855, 0.008239191, 0.012123586, 0.016674906, 0.02177171, 0.02692102, 0.03176487, 0.036074232, 0.039555635, 0.041907437, 0.0428195, 0.04231364, 0.04069458, 0.03804062, 0.034517538, 0.030152733, 0.02495397, 0.019302405, 0.013454973, 0.008051405, 0.0035320325, -3.8056853e-05, -0.0022947853, -0.0031441501, -0.0024377494, -0.00036561745, 0.0026184097, 0.006417652, 0.01048971, 0.014488598, 0.018658133, 0.022654006, 0.025888652, 0.028324107, 0.029740699, 0.029868815, 0.028913436, 0.026909646, 0.024031002, 0.02066097, 0.01692999, 0.013133501, 0.009462318, 0.005896187, 0.0025556097, -0.0003617815, -0.0028478391, -0.0052622417, -0.0075330306, -0.009570075, -0.011673083, -0.013601667, -0.015115133, -0.016306177, -0.017427359, -0.018448846, -0.019110434, -0.019762667, -0.020448985, -0.020766374, -0.020795386, -0.020643596, -0.020033695, -0.019002078, -0.017751975, -0.016265798, -0.015004767, -0.01426261, -0.013908068, -0.014159242, -0.01507783, -0.016391395, -0.018239891, -0.020705076, -0.023245614, -0.025768453, -0.028417725, -0.03081035, -0.03265844, -0.033994004, -0.034710724, -0.034590755, -0.03364339, -0.03183046, -0.02906742, -0.025336565, -0.020794595, -0.015841216, -0.01080163, -0.005904106, -0.0013210257, 0.0027775457, 0.00611716, 0.008334044, 0.009305577, 0.008921878, 0.0071011134, 0.003960808, -0.00065993157, -0.0066129747, -0.013381226, -0.020635622, -0.02794536, -0.034527015, -0.040042374, -0.044671062, -0.048166648, -0.050341554, -0.0510216, -0.050173722, -0.048072536, -0.04477708, -0.040490456, -0.035411373, -0.029779568, -0.023808615, -0.017653652, -0.011627942, -0.00594287, -0.0008207085, 0.0035025573, 0.0068783658, 0.009166727, 0.010488692, 0.011044084, 0.010677112, 0.009701454, 0.008092077, 0.0056353286, 0.0030284382, 0.00021993105, -0.0027847209, -0.005630996, -0.008181676, -0.010211175, -0.011698841, -0.012275325, -0.012222567, -0.012027753, -0.011560927, -0.010773433, -0.009693896, -0.008282424, -0.0063992064, -0.0041607195, -0.001584595, 0.001353764, 0.0047924086, 0.00866059, 0.012520111, 0.016282935, 0.019779764, 0.022702238, 0.024728358, 0.025729198, 0.025645597, 0.024477424, 0.022316532, 0.01945741, 0.016012976, 0.011560868, 0.0066943127, 0.0019320163, -0.0027475993, -0.0068497364, -0.010059035, -0.012354456, -0.013631954, -0.0133879725, -0.011750951, -0.009186343, -0.005878476, -0.0020311172, 0.0023056737, 0.0069524082, 0.01177242, 0.016372705, 0.02038365, 0.023588518, 0.025798162, 0.027026542, 0.027183387, 0.026125275, 0.023954121, 0.021194281, 0.017839478, 0.014040223, 0.010367936, 0.0068666865, 0.0038199583, 0.0015299226, 0.00017261007, -0.00036199173, -0.00031506002, 0.00054436154, 0.0022696066, 0.0048361025, 0.00834238, 0.01244445, 0.016677946, 0.020969724, 0.024975928, 0.028349072, 0.030874854, 0.03209239, 0.0322705, 0.03179878, 0.030436639, 0.0282675, 0.025655484, 0.022553189, 0.0189929, 0.015518869, 0.012372964, 0.009487256, 0.0069074817, 0.0047612023, 0.0031928853, 0.0021878814, 0.0017384888, 0.001645495, 0.001761196, 0.0020119604, 0.0022573282, 0.0027430954, 0.0031750388, 0.0033794795, 0.0037535252, 0.004335748, 0.0054502035, 0.0071319453, 0.009159277, 0.011342742, 0.013457758, 0.015605329, 0.017712306, 0.019685706, 0.021275152, 0.022505075, 0.023386903, 0.023619363, 0.02325908, 0.022122227, 0.020191295, 0.017732594, 0.015041607, 0.012242233, 0.009440369, 0.0070379353, 0.005202008, 0.0040923776, 0.0037895974, 0.0045643426, 0.006414835, 0.008961973, 0.012208682, 0.016045205, 0.020275615, 0.02453256, 0.028575739, 0.032210868, 0.035153855, 0.037211113, 0.0379095, 0.036870893, 0.03398821, 0.029530272, 0.023843303, 0.017424738, 0.0107108755, 0.003855041, -0.0026863604, -0.008722634, -0.013961369, -0.01804963, -0.02114231, -0.023201779, -0.023989007, -0.023523109, -0.021876384, -0.019099575, -0.015536161, -0.011355384, -0.0067345314, -0.0018453579, 0.0031269628, 0.0077363527, 0.011777386, 0.014968767, 0.01748623, 0.019358872, 0.020224407, 0.020249069, 0.019486498, 0.017974446, 0.015635014, 0.012791874, 0.009617329, 0.0058444208, 0.001967319, -0.0017226626, -0.00509821, -0.00824951, -0.011303639, -0.014161663, -0.017051803, -0.01981263, -0.022231719, -0.024274783, -0.025984785, -0.027142828, -0.02753502, -0.02729327, -0.026251476, -0.024534164, -0.022129042, -0.019134918, -0.015867775, -0.012174387, -0.008389091, -0.0049929316, -0.002144267, 0.00020686918, 0.0018533579, 0.0023999987, 0.0018031262, -9.202688e-05, -0.003329362, -0.007818271, -0.013160345, -0.019010501, -0.025279261, -0.031365566, -0.036784407, -0.041330244, -0.044946134, -0.047412988, -0.04858723, -0.048623458, -0.04709223, -0.043880057, -0.03931104, -0.033888467, -0.028065708, -0.021903243, -0.016089771, -0.01092355, -0.0064544226, -0.0033408129, -0.0017443538, -0.0015190288, -0.002504869, -0.004706678, -0.008051705, -0.011947449, -0.016020164, -0.020115085, -0.023898955, -0.027137067, -0.029732425, -0.031555627, -0.03227917, -0.031741824, -0.030245163, -0.027837638, -0.024640175, -0.020977624, -0.01694579, -0.0128837265, -0.009077232, -0.0056934822, -0.002769945, -0.00022539473, 0.0019301238, 0.0037229783, 0.0048928414, 0.005463413, 0.0057907803, 0.005893574, 0.0059015946, 0.0060035507, 0.005920791, 0.0055117984, 0.005004411, 0.0043219524, 0.0033447798, 0.002099832, 0.0005487148, -0.0013999457, -0.0036707118, -0.006119118, -0.0086189015, -0.010868036, -0.012682411, -0.013505527, -0.013140122, -0.0118670445, -0.009557606, -0.0064084227, -0.002288311, 0.0026139265, 0.007932551, 0.013786297, 0.019530065, 0.024898117, 0.029963264, 0.03447021, 0.037828296, 0.0397214, 0.040356286, 0.039443612, 0.037384503, 0.034543455, 0.030860063, 0.026488798, 0.02154486, 0.016859543, 0.012812069, 0.009549169, 0.007425106, 0.0065231603, 0.006907435, 0.008489949, 0.01138559, 0.015355342, 0.020168921, 0.025607247, 0.03120895, 0.036691513, 0.041377436, 0.04483344, 0.046976436, 0.047739133, 0.047111697, 0.045240384, 0.042302184, 0.038388666, 0.033917222, 0.02923545, 0.024845975, 0.0208458, 0.017207028, 0.01430368, 0.012239794, 0.011329764, 0.011508114, 0.012671339, 0.01465107, 0.017159373, 0.0201801, 0.0235236, 0.027025979, 0.030204965, 0.0330546, 0.03542675, 0.037169233, 0.038446832, 0.039129335, 0.039258145, 0.03872956, 0.037971035, 0.0368465, 0.03529327, 0.033437528, 0.03125752, 0.02926781, 0.027355472, 0.0256792, 0.02402252, 0.022113381, 0.019814193, 0.017322553, 0.0146627985, 0.011590108, 0.008475035, 0.005113863, 0.002057588, -0.00058617454, -0.0024522173, -0.0033840693, -0.0034704944, -0.002469281, -0.00060796726, 0.0024886064, 0.006025065, 0.010257589, 0.014782301, 0.01929046, 0.023773955, 0.027763477, 0.031056724, 0.032721017, 0.033396784, 0.032195598, 0.02994838, 0.026082598, 0.020945964, 0.015558915, 0.009103873, 0.0035172421, -0.0024733758, -0.0070073213, -0.011639788, -0.015070683, -0.016850077, -0.018366978, -0.016509973, -0.017497404, -0.00952846, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-constexpr float kViola[4096] = {0.0021130347, 0.0012261387, 0.0017903863, 0.0050567663, -0.003821712, -0.003920855, 0.011890453, 0.004984666, 0.0022802867, 0.0072134896, 0.00057868485, 0.0029446753, 0.0006210742, -0.0001102625, 0.0022933064, -0.00036474082, 0.00070442323, -0.0010766105, -0.00043850287, -0.0011867598, -0.0022085153, -0.00013217692, 0.0005332035, 0.003682469, 0.0050269202, 0.0058530555, 0.005664045, 0.004895864, 0.0051043765, 0.0037057595, 0.0030958448, 0.0027310175, 0.003301727, 0.004012418, 0.0041364646, 0.0039045212, 0.0028872676, 0.0021003534, 0.00064176816, -0.00070649956, -0.00043240841, 0.0007636085, 0.0013224775, 0.0018202886, 0.0023316538, 0.0018395319, 0.001149745, 0.0011238063, 0.0012356604, 0.0010760112, 0.0009399091, 0.0005540593, 0.0008755631, 0.0008792427, -0.00015632261, 0.0007363555, 0.0024834264, 0.0016677922, 0.0011057372, 0.002792926, 0.00269277, 0.0021000006, 0.0037537988, 0.0045677577, 0.003622135, 0.0034907628, 0.0033377155, 0.0020162014, 0.001407163, 0.0010532541, 0.00013618308, -0.0010104135, -0.0016814051, -0.002776125, -0.0033905476, -0.0025372165, -0.0027111082, -0.0028326053, -0.002593825, -0.001958989, -0.0011098594, -0.0006341022, 0.0001958919, 0.001932468, 0.0028431355, 0.0014360328, 0.0026459456, 0.0040081246, 0.003005834, 0.003128179, 0.0038269476, 0.002327715, 0.0009749411, 0.0028661469, 0.0024619205, 0.0018953288, 0.0027220885, 0.003893911, 0.0050975536, 0.0061149006, 0.0051431535, 0.0009500778, 0.0024475646, 0.0030545006, 0.0024916986, 0.0025533463, 0.0009564066, -0.0026113857, -0.008557941, -0.008423379, -0.011662702, -0.038325056, -0.08310039, 0.0014628539, 0.18470329, 0.18633331, 0.14175017, 0.1654524, 0.040498707, -0.047467425, -0.02292302, -0.13065045, -0.14453965, 0.04910554, 0.20234305, 0.2390594, 0.23102869, 0.31870294, 0.34532335, 0.279465, 0.19943304, 0.0052092974, -0.0518705, -0.09056621, -0.18231328, -0.18843037, -0.33914658, -0.39338112, -0.33355463, -0.30904362, -0.22774573, -0.25922963, -0.3216148, -0.35049403, -0.35729256, -0.3093995, -0.24028085, -0.11093681, 0.018238882, 0.12902077, 0.19109721, 0.22060789, 0.21971433, 0.15372263, 0.13589656, 0.14267765, 0.14590096, 0.10880644, 0.019832479, -0.088555865, -0.2681503, -0.37106398, -0.35227063, -0.27483976, -0.14545517, -0.045927513, 0.020186631, 0.01954302, -0.022107534, -0.051844526, -0.07260103, -0.030004216, 0.07465997, 0.2202971, 0.2943651, 0.21464863, 0.012545811, -0.26863962, -0.49840456, -0.63866943, -0.69485235, -0.6539083, -0.514368, -0.23923302, 0.07173057, 0.32875195, 0.52764356, 0.65608984, 0.7792177, 0.9075858, 0.98443675, 1.0021272, 0.9434955, 0.8299775, 0.6915533, 0.5205734, 0.3633557, 0.21431503, 0.065896705, -0.04107842, -0.13937008, -0.24967888, -0.3636309, -0.4409574, -0.47088856, -0.43747607, -0.29698756, -0.15799314, -0.06987047, -0.018060973, -0.022490865, -0.046023007, -0.065267645, -0.029375473, 0.021130018, 0.06653129, 0.1854936, 0.3202694, 0.4288358, 0.5004296, 0.4998899, 0.43072024, 0.32523775, 0.21129414, 0.075168885, -0.057130065, -0.17730327, -0.26211444, -0.29706085, -0.33976743, -0.36974028, -0.39024124, -0.387573, -0.31752208, -0.22783257, -0.13533513, -0.06779567, -0.03722952, 0.012437786, 0.09367724, 0.16225109, 0.17266111, 0.14516278, 0.11494345, 0.09742887, 0.08755809, 0.061618324, 0.034080602, 0.024418939, 0.04143062, 0.053221855, 0.022393763, -0.012622582, -0.05758422, -0.13508178, -0.19388579, -0.21743634, -0.21999659, -0.20271236, -0.16166243, -0.09740154, -0.032095756, 0.03609611, 0.092438504, 0.10099889, 0.07883817, 0.05279478, 0.03826996, 0.030097034, 0.010542203, -0.032453522, -0.10564246, -0.17304583, -0.22394398, -0.28896257, -0.36537588, -0.43387416, -0.47734484, -0.48147056, -0.4363808, -0.3480557, -0.24217232, -0.13678344, -0.031184524, 0.061906748, 0.10979179, 0.103012264, 0.05591676, 0.0027915565, -0.011280865, 0.018146968, 0.06482198, 0.122792915, 0.17569044, 0.20115086, 0.19992001, 0.14502592, 0.039761726, -0.08069009, -0.19672635, -0.26713908, -0.30423895, -0.3341508, -0.3461303, -0.3533545, -0.35489166, -0.33843824, -0.30177242, -0.25391892, -0.19199859, -0.105569355, -0.018072704, 0.07066551, 0.16859652, 0.25653774, 0.32866973, 0.37431154, 0.38176283, 0.35744932, 0.31660601, 0.27624565, 0.24480204, 0.22889577, 0.24029152, 0.27703092, 0.31651154, 0.35273534, 0.3928222, 0.41848063, 0.40657243, 0.3627016, 0.30641675, 0.24440153, 0.17593817, 0.086375915, -0.02730008, -0.1389975, -0.23968963, -0.32253888, -0.38773167, -0.43195808, -0.4265887, -0.36908433, -0.26350027, -0.12210182, 0.020624338, 0.14777526, 0.26273504, 0.36235368, 0.43231192, 0.47469622, 0.4861681, 0.46633533, 0.42356625, 0.35006443, 0.2512176, 0.1397404, 0.037388574, -0.032037362, -0.06083683, -0.0558665, -0.03124579, 5.027372e-05, 0.0125814965, 0.013793581, 0.010903355, -0.011670255, -0.041553207, -0.0803989, -0.121665075, -0.15593384, -0.18484065, -0.19473124, -0.18943577, -0.16276865, -0.108979404, -0.03656445, 0.049200192, 0.13305268, 0.20200321, 0.2521654, 0.29184297, 0.31081188, 0.29613894, 0.255839, 0.19115584, 0.11162283, 0.017056488, -0.091312766, -0.18995166, -0.27517352, -0.3462664, -0.38151002, -0.36918473, -0.31402442, -0.2213003, -0.10661702, 0.007209474, 0.09978476, 0.15476258, 0.1683065, 0.14832106, 0.10468723, 0.04315108, -0.02364305, -0.08754356, -0.14599895, -0.1953459, -0.23580103, -0.25649774, -0.25519344, -0.2336332, -0.18670756, -0.121018775, -0.046156127, 0.028066238, 0.09588068, 0.14679793, 0.16927503, 0.16397516, 0.13734303, 0.10015347, 0.05910653, 0.017367557, -0.022963734, -0.051098835, -0.06804167, -0.08694639, -0.103550464, -0.12215627, -0.13473922, -0.13015911, -0.114265084, -0.08367974, -0.053212754, -0.032256547, -0.025244698, -0.04175103, -0.07290456, -0.116730146, -0.16468747, -0.20630273, -0.22837436, -0.2219045, -0.20180246, -0.16845779, -0.12657966, -0.07684225, -0.014029755, 0.041982856, 0.08669326, 0.12443317, 0.15876737, 0.19301012, 0.21831629, 0.23309104, 0.2305353, 0.20473152, 0.16416179, 0.112353735, 0.05860654, 0.015313239, -0.018921103, -0.04086968, -0.04789872, -0.045366384, -0.032744497, -0.0145582585, 0.006545643, 0.027996013, 0.03872179, 0.040704135, 0.03565797, 0.015594504, -0.019258419, -0.060525045, -0.10049056, -0.13083303, -0.14532058, -0.14897065, -0.1425792, -0.12509538, -0.09367066, -0.04137862, 0.016018655, 0.06955264, 0.123844005, 0.16864525, 0.20131727, 0.22714879, 0.24394251, 0.2445223, 0.2267306, 0.18937708, 0.1262291, 0.04330526, -0.043710336, -0.122718714, -0.18837722, -0.23722701, -0.2664235, -0.27332923, -0.25305712, -0.20950319, -0.14943527, -0.07867125, -0.005730449, 0.06436405, 0.12723616, 0.17967527, 0.22121325, 0.25102183, 0.26833272, 0.27424723, 0.2672088, 0.24802689, 0.22256288, 0.1962407, 0.17631736, 0.1627794, 0.1530899, 0.14188081, 0.12344648, 0.09956922, 0.06219358, 0.008972333, -0.05593171, -0.12278748, -0.17286487, -0.2017576, -0.20441552, -0.18307766, -0.14601845, -0.09692299, -0.047902428, -0.003908916, 0.029716825, 0.052982472, 0.06432516, 0.05392807, 0.031494576, 0.0031576145, -0.027337156, -0.05181736, -0.074225254, -0.09535008, -0.110332675, -0.11730335, -0.11502458, -0.100177236, -0.077906206, -0.051787257, -0.022171233, -0.00086884055, 0.010241296, 0.013457712, 0.010831751, 0.010721161, 0.008574771, -0.00010462435, -0.009966027, -0.01854409, -0.026515976, -0.031779923, -0.033092894, -0.03459499, -0.040366627, -0.055961467, -0.08066598, -0.106289335, -0.131412, -0.15617737, -0.17773108, -0.1907708, -0.18815507, -0.1680345, -0.13243555, -0.086206645, -0.03448663, 0.022479488, 0.08198631, 0.14007498, 0.19371791, 0.2360828, 0.26636177, 0.2870697, 0.29546094, 0.29179844, 0.2776037, 0.25249714, 0.22000872, 0.18263024, 0.14066929, 0.09650516, 0.048023026, -0.0060997345, -0.062909685, -0.118800625, -0.16627263, -0.2025003, -0.22554235, -0.23110445, -0.21945277, -0.18900259, -0.13974993, -0.077934735, -0.01269398, 0.0491058, 0.10158738, 0.13774405, 0.1540742, 0.15045035, 0.13318393, 0.10801912, 0.07846918, 0.048873458, 0.020468323, -3.7532387e-05, -0.0079081, -0.004023608, 0.011125857, 0.0320491, 0.05345618, 0.07416224, 0.09342172, 0.105072476, 0.104562454, 0.09522527, 0.07882537, 0.059010863, 0.038905285, 0.019693213, 0.0058629247, -0.00511437, -0.015422472, -0.022680877, -0.028479347, -0.029427173, -0.023187222, -0.014020947, -0.0042434814, 0.0032894672, 0.00862142, 0.016338537, 0.028814252, 0.047814406, 0.074215926, 0.10127224, 0.12093674, 0.12954448, 0.124194026, 0.10946968, 0.08917526, 0.06244988, 0.033466544, 0.0019081929, -0.031123266, -0.061040144, -0.08708237, -0.105268195, -0.11495076, -0.11778111, -0.114064485, -0.10575384, -0.09444572, -0.083707705, -0.075793624, -0.07430137, -0.081646316, -0.09427948, -0.108256824, -0.1188756, -0.12777688, -0.1378094, -0.14618744, -0.15082467, -0.14649631, -0.1294024, -0.10212372, -0.071379736, -0.04262644, -0.016313793, 0.007439499, 0.027488893, 0.040808737, 0.04722713, 0.04866286, 0.045993436, 0.04140115, 0.034443777, 0.025713723, 0.016623069, 0.005841251, -0.0053390544, -0.01207252, -0.011663667, -0.0072798408, -0.0039763018, -0.006537897, -0.01912921, -0.044351052, -0.08130252, -0.12253272, -0.15801044, -0.1814184, -0.19018726, -0.18382484, -0.16416559, -0.13214855, -0.09295181, -0.05468808, -0.019706396, 0.007833809, 0.027331006, 0.043385662, 0.057806063, 0.07345096, 0.09087682, 0.10987696, 0.12921004, 0.14647198, 0.16112837, 0.16999823, 0.17105272, 0.16171546, 0.13907607, 0.10437282, 0.060495492, 0.011442562, -0.04025282, -0.090377055, -0.13345845, -0.16529381, -0.18187244, -0.18282634, -0.16895185, -0.14107741, -0.10000061, -0.04802354, 0.0104309, 0.07003993, 0.12114684, 0.15836318, 0.18064408, 0.1870472, 0.18136327, 0.16483817, 0.1396229, 0.11146109, 0.08395518, 0.06201125, 0.046990827, 0.037502315, 0.03445298, 0.037266843, 0.043809142, 0.05103785, 0.056873266, 0.059198685, 0.05720422, 0.054653242, 0.053216092, 0.05390315, 0.05675275, 0.05700876, 0.053834837, 0.04809999, 0.038295012, 0.025636533, 0.013011475, 0.0026866551, -0.003443322, -0.0038222212, 0.0003987275, 0.006725186, 0.014164792, 0.022508813, 0.031312067, 0.039237395, 0.04702152, 0.055570796, 0.06341976, 0.07016122, 0.07546901, 0.07773013, 0.07683698, 0.07370879, 0.06801242, 0.061434325, 0.055958893, 0.05250013, 0.05436101, 0.062476188, 0.07441604, 0.085543625, 0.090678684, 0.08837664, 0.07864944, 0.062034328, 0.038326807, 0.00761853, -0.027380392, -0.064093746, -0.09855809, -0.12664999, -0.14600348, -0.15380228, -0.14947172, -0.13535097, -0.11418517, -0.08858476, -0.062411558, -0.040474035, -0.025190141, -0.017335888, -0.016521538, -0.020861045, -0.02752444, -0.03460572, -0.043531924, -0.054580305, -0.06670317, -0.07811686, -0.08564905, -0.08687776, -0.07912286, -0.06492668, -0.04872437, -0.030733911, -0.012398447, 0.003663372, 0.014876801, 0.019814925, 0.01865539, 0.013904493, 0.008620093, 0.00472697, 0.005021094, 0.007729243, 0.009970153, 0.011205199, 0.011207164, 0.0121995555, 0.014022951, 0.016173443, 0.019685999, 0.023771588, 0.027338656, 0.030197129, 0.03321169, 0.03623281, 0.039482977, 0.0418511, 0.04006823, 0.032922793, 0.01956519, 0.001295076, -0.018577961, -0.03836226, -0.056229714, -0.070634596, -0.080630705, -0.08492131, -0.08357445, -0.07686781, -0.06517434, -0.050682817, -0.033933125, -0.016096603, -0.00012686766, 0.0125523135, 0.018765086, 0.017316543, 0.0104154125, -0.000115954565, -0.010364635, -0.017726544, -0.022470769, -0.023372456, -0.01935464, -0.011487481, -0.0017360705, 0.0063778344, 0.009990803, 0.0091457395, 0.004170165, -0.0035615466, -0.011387922, -0.017587397, -0.021532614, -0.02262412, -0.020927079, -0.01751364, -0.011590821, -0.0038871134, 0.002578524, 0.0066570817, 0.007254821, 0.004960906, 0.0016192992, -0.002797431, -0.0067056743, -0.00728769, -0.0035546718, 0.0051645353, 0.01843753, 0.034659177, 0.052582797, 0.06902402, 0.080547966, 0.08423849, 0.077761844, 0.062323805, 0.040243283, 0.01477387, -0.010679151, -0.033499166, -0.05004911, -0.058833137, -0.060971156, -0.058593158, -0.053196866, -0.045914426, -0.0375908, -0.02661987, -0.012693913, 0.004082565, 0.024039565, 0.045564648, 0.0682422, 0.09113595, 0.11142798, 0.12734237, 0.13875431, 0.14567585, 0.14769992, 0.14407314, 0.13301338, 0.11512773, 0.09295608, 0.06891463, 0.046627775, 0.028135272, 0.014356469, 0.005564999, 4.0065544e-05, -0.0040522497, -0.008639973, -0.014666169, -0.022584202, -0.033154383, -0.045989428, -0.061504886, -0.08003236, -0.10040943, -0.12094817, -0.13877487, -0.1507447, -0.15411033, -0.14753233, -0.13164763, -0.108137034, -0.07970712, -0.04926986, -0.019762337, 0.006131931, 0.026067017, 0.03866226, 0.044640817, 0.04489155, 0.040382616, 0.032869615, 0.023600958, 0.014325141, 0.007195213, 0.0036356188, 0.0058237687, 0.014681015, 0.028396094, 0.04512333, 0.06269603, 0.0785745, 0.0902558, 0.09600202, 0.09603401, 0.091145396, 0.08278271, 0.07318404, 0.06368267, 0.05391395, 0.04385896, 0.034133054, 0.02460209, 0.0153789045, 0.0060357074, -0.0036731435, -0.013189871, -0.022084512, -0.029293535, -0.03420723, -0.03780614, -0.041259103, -0.04355498, -0.04406469, -0.043554574, -0.04225022, -0.04183737, -0.042817686, -0.0437351, -0.043149, -0.039407697, -0.03231973, -0.021664534, -0.007690684, 0.008521468, 0.026042866, 0.041897286, 0.05264568, 0.05582717, 0.050294463, 0.037038665, 0.017626187, -0.0067050424, -0.033696443, -0.059846852, -0.08202219, -0.09632126, -0.099241465, -0.08968005, -0.067136765, -0.03287051, 0.009789042, 0.057221945, 0.105781265, 0.1509799, 0.18786867, 0.21349624, 0.22575913, 0.22342594, 0.20739956, 0.17997952, 0.14526094, 0.10708902, 0.069344245, 0.035848938, 0.0086169625, -0.010730393, -0.021607393, -0.02401672, -0.019853856, -0.012526926, -0.004659992, 0.0004770915, 0.0012054652, -0.0036761463, -0.014875266, -0.030832887, -0.049570035, -0.06789344, -0.08383153, -0.09663455, -0.10497772, -0.10755339, -0.10395133, -0.094748996, -0.079571925, -0.05948896, -0.03533182, -0.0076208278, 0.02083498, 0.047780707, 0.06936928, 0.081854105, 0.08387023, 0.07456646, 0.054955248, 0.02679747, -0.0068860534, -0.04155183, -0.07363256, -0.10040745, -0.119808, -0.13023962, -0.13071615, -0.1220999, -0.10588493, -0.08370461, -0.058976874, -0.03589123, -0.018169984, -0.008268363, -0.0072272336, -0.014335054, -0.02674995, -0.04149335, -0.05425797, -0.060987778, -0.059820216, -0.048916623, -0.029764896, -0.0057249856, 0.020783398, 0.046252254, 0.06758887, 0.081306346, 0.08507464, 0.079034165, 0.06305366, 0.039280068, 0.012217185, -0.0139739085, -0.035625055, -0.04985313, -0.055749968, -0.054742005, -0.048325785, -0.03859154, -0.027964553, -0.01707965, -0.0059782593, 0.0046984833, 0.013391327, 0.019762672, 0.024033032, 0.02480012, 0.020923447, 0.011816413, -0.0025754895, -0.022301877, -0.0462526, -0.07162661, -0.096551545, -0.1183424, -0.13395125, -0.14192112, -0.14072457, -0.12969857, -0.11014601, -0.082971856, -0.048897743, -0.010669584, 0.028956128, 0.067216486, 0.09984351, 0.12298383, 0.13372949, 0.13089216, 0.11647844, 0.093834326, 0.06686629, 0.04056626, 0.018368486, 0.003165962, -0.0016849566, 0.0048013288, 0.021559255, 0.045604743, 0.07354647, 0.10146107, 0.12354779, 0.13624051, 0.13792278, 0.12735571, 0.105872355, 0.07603272, 0.041159775, 0.005591814, -0.026944546, -0.05275811, -0.06976858, -0.07739595, -0.074896775, -0.063119225, -0.043126706, -0.01687141, 0.012563798, 0.043060478, 0.07183795, 0.095710196, 0.112552196, 0.1217573, 0.123553276, 0.119074225, 0.109339155, 0.094908796, 0.07787794, 0.059551623, 0.04090429, 0.023782572, 0.008891642, -0.0043472894, -0.01702535, -0.02880522, -0.03876687, -0.047142427, -0.054239336, -0.060171906, -0.0651846, -0.069471136, -0.07307923, -0.07534514, -0.07609532, -0.07567397, -0.072687835, -0.065437004, -0.052703753, -0.035111383, -0.014937654, 0.0064259954, 0.027594892, 0.048203308, 0.067388274, 0.08314665, 0.093709506, 0.09728434, 0.09339413, 0.0820877, 0.06496063, 0.043964665, 0.020378182, -0.00430168, -0.02914, -0.051823437, -0.070947945, -0.085335374, -0.09312034, -0.09466125, -0.089782275, -0.07849911, -0.062051184, -0.04136228, -0.017723292, 0.0066445293, 0.029449463, 0.049383085, 0.06497879, 0.07557667, 0.08079996, 0.07962062, 0.07287884, 0.06263673, 0.050861884, 0.03880433, 0.026588827, 0.014410843, 0.003255058, -0.0059575057, -0.012800689, -0.016783394, -0.018118175, -0.017176226, -0.014296332, -0.011048911, -0.009102723, -0.0093093915, -0.012033044, -0.016840413, -0.022244794, -0.026350012, -0.0273926, -0.024587387, -0.018719448, -0.01064556, -0.0003226009, 0.012013827, 0.025143266, 0.037240047, 0.04585543, 0.0490818, 0.046501685, 0.037962858, 0.02353402, 0.0048875385, -0.015662104, -0.036372095, -0.054656863, -0.068251185, -0.07640273, -0.07900903, -0.07697702, -0.07106085, -0.06211694, -0.051521722, -0.039162233, -0.024845341, -0.009955609, 0.0046565738, 0.018101258, 0.029060652, 0.037151743, 0.041376412, 0.041638162, 0.038082343, 0.02995888, 0.017724514, 0.001510601, -0.017529262, -0.037667364, -0.0572151, -0.07315971, -0.083303876, -0.08550192, -0.078699574, -0.06384366, -0.042503122, -0.016882172, 0.010676804, 0.037346434, 0.05992888, 0.07563032, 0.08345677, 0.08352911, 0.07632494, 0.0632337, 0.04626261, 0.029003909, 0.014710394, 0.004868069, -0.0002900664, -0.0017446257, -0.00053742167, 0.0015209973, 0.0029286633, 0.002523267, -0.0022489405, -0.012434426, -0.02734589, -0.046092488, -0.06686067, -0.08823455, -0.10859277, -0.12563851, -0.13792121, -0.14329879, -0.14041825, -0.1306888, -0.11504939, -0.094255306, -0.07027815, -0.04466304, -0.019232862, 0.0038413059, 0.022669468, 0.035887603, 0.043845482, 0.046801187, 0.04548854, 0.0420729, 0.037774537, 0.034572773, 0.034010865, 0.03536919, 0.038440134, 0.042589612, 0.04696081, 0.051658392, 0.056494266, 0.061446566, 0.065995015, 0.06948635, 0.07205195, 0.072803386, 0.071108334, 0.066792026, 0.059670597, 0.051064596, 0.040964037, 0.029317642, 0.017697675, 0.006983927, -0.0014351672, -0.006868692, -0.00816889, -0.004143017, 0.0034137624, 0.013249842, 0.023985434, 0.033784002, 0.0419938, 0.047542356, 0.049729016, 0.04856782, 0.045224003, 0.040799703, 0.034798313, 0.027474731, 0.019604856, 0.011069911, 0.0026045723, -0.0046489337, -0.010411745, -0.014073916, -0.015580438, -0.015457493, -0.014429776, -0.013470798, -0.013053481, -0.014124512, -0.016880551, -0.020820852, -0.025312455, -0.02920769, -0.032379366, -0.034502704, -0.034361694, -0.03134224, -0.026253687, -0.019726386, -0.011229702, -0.0014653828, 0.007936567, 0.01635453, 0.022986261, 0.026246723, 0.025649427, 0.02076919, 0.011816488, 0.0006606213, -0.01213412, -0.025620198, -0.038316526, -0.049295876, -0.056284275, -0.057195686, -0.05095016, -0.037913546, -0.019017577, 0.0047920197, 0.030818012, 0.05703805, 0.082094334, 0.103642955, 0.119279124, 0.12720975, 0.12778576, 0.12154814, 0.10873005, 0.0910011, 0.07045259, 0.049688615, 0.030402182, 0.013793519, 0.0010607208, -0.007723328, -0.011792569, -0.01095059, -0.005559679, 0.0036362715, 0.014134095, 0.024044268, 0.031552088, 0.034864094, 0.033911414, 0.029245622, 0.021411832, 0.01080971, -0.0014225903, -0.013624799, -0.025392998, -0.036604356, -0.046826452, -0.05643692, -0.06599062, -0.07519485, -0.083195366, -0.08975047, -0.09525482, -0.09967231, -0.102338225, -0.10211565, -0.098937795, -0.09359524, -0.08616611, -0.07679446, -0.064811476, -0.049813922, -0.03326396, -0.01567157, 0.0031569987, 0.022855647, 0.042696416, 0.06094747, 0.0764713, 0.08848599, 0.09507807, 0.09487622, 0.0877542, 0.074609086, 0.056636475, 0.03469716, 0.010253426, -0.014834052, -0.038756113, -0.05979422, -0.07608727, -0.086448826, -0.090969615, -0.08928076, -0.08133795, -0.06788768, -0.049935512, -0.029735634, -0.010003033, 0.007072974, 0.020116482, 0.027240334, 0.027436418, 0.022828048, 0.015189183, 0.0057696053, -0.0037534323, -0.011900798, -0.016911013, -0.018280385, -0.015526982, -0.008496472, 0.0015927696, 0.013708303, 0.026161263, 0.03681195, 0.043245893, 0.043853875, 0.03730892, 0.022355366, 0.00058482296, -0.026884364, -0.05845855, -0.08960644, -0.11666014, -0.13684846, -0.14840345, -0.15108438, -0.14501853, -0.13014573, -0.107377775, -0.07913419, -0.047825128, -0.016391115, 0.012430782, 0.03667425, 0.05511941, 0.067380525, 0.072925344, 0.07245211, 0.06733117, 0.05960912, 0.052235678, 0.046573184, 0.043084253, 0.041968845, 0.04306611, 0.0460514, 0.049626566, 0.052442912, 0.054216325, 0.054659795, 0.052860416, 0.048154943, 0.040144876, 0.028497579, 0.013280114, -0.004117225, -0.021718742, -0.03802245, -0.050336074, -0.056222115, -0.055568483, -0.049153227, -0.037554476, -0.021839043, -0.004050573, 0.014416363, 0.03261882, 0.049738638, 0.06500814, 0.07667563, 0.08422389, 0.08740547, 0.085415006, 0.079769515, 0.0716768, 0.06138572, 0.049996708, 0.038095947, 0.026257234, 0.014758525, 0.0042416467, -0.004687619, -0.012917249, -0.020233331, -0.02665311, -0.033094127, -0.03990584, -0.04707993, -0.053829905, -0.060364623, -0.065997474, -0.06872378, -0.06791367, -0.062619776, -0.05233987, -0.037991878, -0.020285403, -0.0003945213, 0.019474018, 0.038328946, 0.055156954, 0.06757025, 0.075046435, 0.077706106, 0.075326554, 0.067629166, 0.053654376, 0.034483362, 0.0123019265, -0.0109020285, -0.03222177, -0.049233474, -0.060415443, -0.06469836, -0.061321203, -0.050057933, -0.032657396, -0.01145214, 0.012097531, 0.035912, 0.05771206, 0.07543883, 0.08752223, 0.092836685, 0.09035204, 0.08075607, 0.065301664, 0.045026295, 0.021629464, -0.0029373732, -0.026457692, -0.04659071, -0.061394926, -0.07024845, -0.072538786, -0.06806729, -0.05847258, -0.044867303, -0.028508112, -0.011709946, 0.0034393405, 0.015744053, 0.025014129, 0.03090297, 0.03335455, 0.03221496, 0.026862925, 0.017975397, 0.0071652876, -0.004513118, -0.016631048, -0.028504124, -0.039267287, -0.0476575, -0.05254366, -0.054151848, -0.05293055, -0.048516802, -0.040563233, -0.030358825, -0.01920589, -0.008150197, 0.0014691869, 0.009924531, 0.016277898, 0.019448267, 0.020147268, 0.019148124, 0.017897727, 0.017133456, 0.017971218, 0.02118494, 0.025983341, 0.03197873, 0.038862444, 0.047390547, 0.05712347, 0.065791346, 0.07219522, 0.07551607, 0.075351775, 0.07148617, 0.06389967, 0.053799395, 0.042664945, 0.031236049, 0.020132884, 0.010158873, 0.0021866728, -0.0034292724, -0.007844395, -0.01192601, -0.015290602, -0.018193977, -0.021822175, -0.026755359, -0.032327745, -0.037496414, -0.041904714, -0.045532804, -0.04772183, -0.04803447, -0.046101794, -0.04181453, -0.03591548, -0.028493904, -0.020164913, -0.011996525, -0.004253063, 0.0027455504, 0.0087780785, 0.01275869, 0.013828924, 0.012965662, 0.010971326, 0.007426659, 0.0015082136, -0.005816476, -0.013352646, -0.022038234, -0.031801213, -0.041962184, -0.052702527, -0.06386724, -0.074980564, -0.08465142, -0.091480054, -0.09448125, -0.09370251, -0.09012168, -0.08301559, -0.07219238, -0.05899309, -0.04457045, -0.030714348, -0.018857624, -0.009772624, -0.0039944802, -0.0012257466, -0.00069943035, -0.0011779293, -0.0019219961, -0.0023310827, -0.00074091676, 0.0031993175, 0.008936822, 0.016501846, 0.024852592, 0.032616403, 0.03855294, 0.0414274, 0.040934216, 0.036930356, 0.02926875, 0.018433867, 0.005067445, -0.009382268, -0.02219103, -0.032208268, -0.03928629, -0.042538647, -0.041752152, -0.036656875, -0.02792524, -0.016594008, -0.0029693688, 0.011683863, 0.026137536, 0.038463533, 0.04712977, 0.052074954, 0.053068448, 0.05077782, 0.046341483, 0.04092096, 0.035282455, 0.02977882, 0.025540844, 0.02346368, 0.023252675, 0.02465707, 0.027861973, 0.03186887, 0.036686614, 0.042179096, 0.046493605, 0.049882673, 0.051571608, 0.05013982, 0.045852758, 0.038680464, 0.029809548, 0.020059137, 0.010667922, 0.0035284534, -0.0009300522, -0.0023892364, -0.0013600744, 0.0026127896, 0.009612744, 0.017780123, 0.026336597, 0.033771828, 0.03920351, 0.042983957, 0.043981094, 0.042708866, 0.04073069, 0.03800911, 0.035666693, 0.034762304, 0.03467036, 0.035231583, 0.035983384, 0.036900144, 0.038145278, 0.038838807, 0.038677398, 0.03781161, 0.03671926, 0.03528318, 0.033115886, 0.029854521, 0.025288995, 0.019960627, 0.013354319, 0.0056841727, -0.0026786332, -0.011791418, -0.021468384, -0.031985514, -0.04153181, -0.04921657, -0.055099294, -0.058053512, -0.057685737, -0.053078137, -0.044038378, -0.03170867, -0.018012851, -0.0047066817, 0.007125793, 0.015763715, 0.02019902, 0.019504499, 0.013457075, 0.0029718343, -0.011521823, -0.028169148, -0.04413334, -0.057254445, -0.06570951, -0.06829792, -0.06485331, -0.05615161, -0.043633163, -0.029558918, -0.016372882, -0.0061967922, -0.0007622199, -0.00037618415, -0.0041953907, -0.011011142, -0.01943238, -0.028006967, -0.0349149, -0.03892324, -0.039509866, -0.03607824, -0.028785529, -0.01881943, -0.0071470025, 0.005494818, 0.017598044, 0.029042616, 0.039318256, 0.045815006, 0.049304668, 0.050365746, 0.047229964, 0.04150685, 0.035393417, 0.029935246, 0.025581526, 0.021625048, 0.017403731, 0.013205903, 0.010453688, 0.007774018, 0.0035413792, -0.00082282367, -0.005296088, -0.0098035475, -0.01389823, -0.018049512, -0.022581123, -0.027645646, -0.032344904, -0.036855288, -0.041092098, -0.04416867, -0.046655938, -0.04814725, -0.04831416, -0.04700118, -0.04306984, -0.036140043, -0.026392242, -0.014017853, 0.00089369784, 0.016918117, 0.032644864, 0.047775775, 0.060749274, 0.07008631, 0.07431308, 0.07222601, 0.064680845, 0.052606683, 0.03671903, 0.018021567, -0.001402416, -0.019059138, -0.034171805, -0.045524787, -0.051875416, -0.05273357, -0.047937103, -0.039474003, -0.028942905, -0.017830903, -0.00832158, -0.00013419645, 0.006442154, 0.010339765, 0.012442694, 0.013107634, 0.012789251, 0.012052121, 0.010268436, 0.008101275, 0.0058032046, 0.0030592356, 0.0015149345, 0.002177363, 0.0057403217, 0.012425141, 0.020899776, 0.030438224, 0.039496195, 0.046396807, 0.050837986, 0.05153511, 0.047431555, 0.03998077, 0.030512229, 0.018943064, 0.0063877115, -0.0052515287, -0.014324559, -0.020131426, -0.022831796, -0.021797037, -0.017512018, -0.01149936, -0.005528728, -0.0018447526, -0.001467535, -0.005015784, -0.0127236955, -0.02394137, -0.037185233, -0.05056715, -0.06279152, -0.07173947, -0.07563816, -0.07401342, -0.06690611, -0.055671725, -0.041294422, -0.02462572, -0.0074965903, 0.009282137, 0.024129929, 0.03458988, 0.040471274, 0.042065173, 0.039944995, 0.03505921, 0.027921658, 0.020064417, 0.01244452, 0.0060312054, 0.0019210468, -0.00023809276, -0.000850514, -0.00072293653, -0.00027342004, 0.0009996453, 0.0031693154, 0.0052950284, 0.006468603, 0.0068020085, 0.0063401638, 0.005681955, 0.0049385685, 0.0036012724, 0.0023082208, 0.0013701572, 0.0011174955, 0.0013201318, 0.0009345633, 0.0007532621, 0.0020438754, 0.0050483667, 0.009667758, 0.015912946, 0.02359676, 0.03132969, 0.03823002, 0.044152003, 0.04810148, 0.048770342, 0.045204736, 0.0373859, 0.025784174, 0.011619373, -0.0036698866, -0.018576054, -0.031088006, -0.040536646, -0.046460345, -0.048644636, -0.047225915, -0.04199681, -0.033939585, -0.024599122, -0.015849536, -0.008679314, -0.003046879, 0.0008571009, 0.0031744197, 0.004127251, 0.0039363187, 0.003435663, 0.003983655, 0.0063155508, 0.011160589, 0.017789789, 0.024197899, 0.030131858, 0.0349694, 0.03821675, 0.039847434, 0.03904815, 0.03565301, 0.030053511, 0.023181697, 0.015864419, 0.008758585, 0.0024394095, -0.0030377358, -0.0074996017, -0.010243372, -0.010535803, -0.008568987, -0.0041710297, 0.0025925231, 0.010022046, 0.016797435, 0.022447057, 0.026689857, 0.029132117, 0.029652582, 0.028991792, 0.027485948, 0.024935683, 0.021709574, 0.018761177, 0.01719266, 0.017733151, 0.020232748, 0.023827596, 0.027905766, 0.031847652, 0.03466804, 0.035805225, 0.035059366, 0.032391, 0.02776982, 0.021477519, 0.013981307, 0.0058804904, -0.0019199519, -0.00993496, -0.018834228, -0.027452286, -0.03452502, -0.040115897, -0.044113286, -0.045418985, -0.044010438, -0.039921787, -0.033619888, -0.02641745, -0.01828913, -0.010217304, -0.0033675747, 0.001908265, 0.005079193, 0.006356789, 0.0053208936, 0.0023030164, -0.0018337225, -0.007176187, -0.0125570595, -0.016730247, -0.019768614, -0.021647232, -0.022221198, -0.0213834, -0.018563986, -0.013815011, -0.0078031, -0.0014355428, 0.0045326287, 0.010242768, 0.014740311, 0.016965913, 0.016700862, 0.01342422, 0.007416774, -0.0008724847, -0.010750495, -0.02108198, -0.031132508, -0.03999061, -0.047062334, -0.05223064, -0.05484711, -0.05443134, -0.051133707, -0.045299463, -0.038316768, -0.0314717, -0.025181584, -0.02008439, -0.016815575, -0.015732666, -0.016581664, -0.019130278, -0.022668019, -0.025822723, -0.028106721, -0.029664932, -0.030285826, -0.029101329, -0.026748313, -0.024390738, -0.021676749, -0.018962134, -0.016477164, -0.014179558, -0.01263683, -0.011544741, -0.010434958, -0.00892534, -0.006994392, -0.0050312523, -0.0029122713, -0.0011489069, 3.9293038e-05, 0.0005325722, -0.0002659309, -0.0018405267, -0.004501996, -0.0078612715, -0.010189713, -0.010585279, -0.008370786, -0.004811231, -0.00026530444, 0.0063277143, 0.014291805, 0.023044948, 0.031734478, 0.03976074, 0.046639208, 0.052120134, 0.056239624, 0.05725819, 0.05486011, 0.049891375, 0.043160837, 0.036927562, 0.032451373, 0.030054078, 0.03065037, 0.03461503, 0.04066858, 0.047326915, 0.053840313, 0.05923821, 0.06276561, 0.06341593, 0.060379673, 0.054526106, 0.047248565, 0.03996983, 0.033873837, 0.028890828, 0.025208868, 0.023956018, 0.025400233, 0.029061152, 0.034741577, 0.0417386, 0.048394293, 0.052970923, 0.05417079, 0.05182033, 0.04589684, 0.036689863, 0.025704961, 0.013383385, 0.00058706925, -0.011070723, -0.02027326, -0.025891462, -0.0283581, -0.02708081, -0.022284836, -0.015124012, -0.005515263, 0.0048740413, 0.01509437, 0.024240557, 0.03046895, 0.033568528, 0.033838306, 0.031706978, 0.027267693, 0.021187501, 0.014578332, 0.007911611, 0.0016884967, -0.0034870994, -0.007322492, -0.009645816, -0.009847118, -0.008894002, -0.007683533, -0.0059329714, -0.0047954745, -0.0051052882, -0.006965353, -0.01019599, -0.014642254, -0.020663606, -0.028147234, -0.03635083, -0.043795083, -0.049686488, -0.053820036, -0.056495152, -0.05817033, -0.057517745, -0.0541022, -0.048690755, -0.041320715, -0.032527685, -0.02281752, -0.012581262, -0.0030227404, 0.005020394, 0.010969633, 0.013819302, 0.013328974, 0.009294914, 0.0018836817, -0.0071221367, -0.016556695, -0.025718797, -0.03366961, -0.039442327, -0.04152874, -0.0400038, -0.03520484, -0.026859714, -0.01642495, -0.004918428, 0.006385687, 0.015224449, 0.020749666, 0.02233999, 0.019985195, 0.014615083, 0.0072609186, -0.0011072126, -0.00967274, -0.017281279, -0.023560531, -0.027984612, -0.029918851, -0.02937447, -0.025756972, -0.019410895, -0.011075723, -0.001605405, 0.0072248853, 0.014495047, 0.019565988, 0.022076814, 0.02186692, 0.018341612, 0.012718976, 0.007023678, 0.0020231719, -0.0015403036, -0.0030749093, -0.0028028297, -0.000804557, 0.0033467722, 0.008920183, 0.014261618, 0.0186617, 0.021936154, 0.024271542, 0.025322065, 0.024506517, 0.022520432, 0.020166988, 0.018382238, 0.017840851, 0.018137379, 0.018990863, 0.020811703, 0.023766914, 0.027516643, 0.03161108, 0.03544354, 0.039226945, 0.042380437, 0.043674115, 0.04327399, 0.04087165, 0.037020613, 0.032997698, 0.028984336, 0.025553182, 0.022987839, 0.021645447, 0.022167385, 0.023965454, 0.02624043, 0.028645955, 0.03018906, 0.029914616, 0.028315227, 0.025677439, 0.021522665, 0.016636668, 0.01151893, 0.005292431, -0.0013159103, -0.0070714494, -0.012429487, -0.01762376, -0.022323137, -0.026118146, -0.029513653, -0.03347342, -0.037141785, -0.039943974, -0.041447647, -0.040581655, -0.037765015, -0.033352338, -0.027114717, -0.018616872, -0.008326565, 0.0021482066, 0.012130869, 0.02012659, 0.025592314, 0.02872058, 0.027273852, 0.021669, 0.013643065, 0.0024862867, -0.009786941, -0.020685488, -0.031257477, -0.040690064, -0.04656498, -0.04881389, -0.04837144, -0.04624907, -0.042957485, -0.038467947, -0.033163548, -0.02873018, -0.026048291, -0.023733238, -0.021993794, -0.021043526, -0.019976364, -0.018969601, -0.017056117, -0.013606459, -0.009331561, -0.0049196193, -0.00092466676, 0.003245247, 0.007934562, 0.012957704, 0.01803071, 0.022498138, 0.026019625, 0.027703423, 0.026729908, 0.02349404, 0.018832155, 0.013457378, 0.007902456, 0.002573195, -0.002303432, -0.0067401514, -0.01095737, -0.014352965, -0.01632864, -0.017375484, -0.017333977, -0.016304394, -0.015216142, -0.013972376, -0.012071524, -0.009566718, -0.0070539652, -0.0050545144, -0.0030790975, -0.00053711, 0.0025416347, 0.0061926893, 0.010498402, 0.015613951, 0.02122897, 0.027188823, 0.034630917, 0.04353763, 0.05261393, 0.061264817, 0.06860588, 0.0733093, 0.07518027, 0.07446995, 0.07093536, 0.06475373, 0.05658031, 0.04851236, 0.04176243, 0.035293426, 0.029614974, 0.025313156, 0.022834208, 0.022503614, 0.023053426, 0.024310049, 0.026262403, 0.027977057, 0.028615355, 0.028088078, 0.026149891, 0.022284513, 0.017556397, 0.012299104, 0.0068001207, 0.0020156244, -0.001867126, -0.0035765246, -0.002106216, 0.002438316, 0.009115586, 0.01675108, 0.024828797, 0.032342296, 0.038933832, 0.04423188, 0.04803547, 0.05077328, 0.051126227, 0.048535015, 0.043374926, 0.035973057, 0.027582347, 0.018290035, 0.00802803, -0.0028826802, -0.0136381, -0.023114761, -0.031146921, -0.036449436, -0.03892441, -0.03926375, -0.036531832, -0.031308927, -0.024689453, -0.017767187, -0.011328202, -0.0057271053, -0.0020867377, -0.00067724957, -0.0021013017, -0.005403934, -0.008434679, -0.011399505, -0.013959227, -0.015573572, -0.016107172, -0.015334552, -0.0134962, -0.010714706, -0.008024405, -0.006091943, -0.0047161677, -0.0037116369, -0.0033304503, -0.003666228, -0.0044776443, -0.0065476717, -0.00942487, -0.012747995, -0.016692549, -0.020117767, -0.023359941, -0.026968986, -0.030665211, -0.034553662, -0.038949143, -0.043942966, -0.04911936, -0.054022584, -0.057867244, -0.060165066, -0.060283862, -0.057873677, -0.05316809, -0.045937907, -0.03688366, -0.02689891, -0.01718189, -0.008671456, -0.00056821154, 0.0061672768, 0.009970861, 0.011131998, 0.0095654875, 0.005920118, 0.0011376004, -0.0050742594, -0.011885424, -0.018253708, -0.024465559, -0.030522516, -0.035922688, -0.040666148, -0.044702146, -0.047251888, -0.047552746, -0.04532296, -0.040822428, -0.034330904, -0.0262781, -0.017366668, -0.008200578, 0.0006751679, 0.00902256, 0.016455196, 0.022773813, 0.027759973, 0.031259418, 0.033060167, 0.033070717, 0.03255274, 0.03174575, 0.030969094, 0.030918924, 0.03165039, 0.034409873, 0.038546618, 0.042793892, 0.04703515, 0.050472584, 0.052988883, 0.054387197, 0.054243237, 0.05280511, 0.050797846, 0.048819013, 0.04699163, 0.04578706, 0.045577608, 0.04634018, 0.047824606, 0.048944935, 0.048498094, 0.04647419, 0.042881362, 0.03773826, 0.0318384, 0.025230674, 0.01815351, 0.011863122, 0.0077140536, 0.0066018323, 0.0086961705, 0.014043513, 0.021998124, 0.03205153, 0.04391472, 0.056086954, 0.067127354, 0.0757383, 0.081129156, 0.082983136, 0.08087468, 0.07544593, 0.06732479, 0.057594467, 0.04698057, 0.03456157, 0.021221276, 0.008943349, -0.0015123085, -0.010719367, -0.019065874, -0.025515184, -0.030260593, -0.03422555, -0.037500184, -0.040075064, -0.04203087, -0.04337114, -0.043817043, -0.04316741, -0.040847126, -0.036798228, -0.03155961, -0.025638469, -0.019883282, -0.014458473, -0.009550363, -0.0053690993, -0.0017593609, 0.0012991299, 0.004026593, 0.0066037243, 0.00851037, 0.008507763, 0.0062655583, 0.0017644569, -0.0046721054, -0.012241718, -0.020685324, -0.028930241, -0.036662396, -0.043643527, -0.048735972, -0.05192496, -0.05279766, -0.050692707, -0.046162207, -0.040617708, -0.0351825, -0.02979688, -0.023839721, -0.017947707, -0.013750816, -0.01198985, -0.012979335, -0.016037622, -0.02017723, -0.025128819, -0.030154739, -0.033797607, -0.034549512, -0.03303898, -0.03027557, -0.026156133, -0.021420356, -0.016914742, -0.012656819, -0.00822346, -0.0046519362, -0.0029192697, -0.0022536754, -0.0025036233, -0.0037435861, -0.006149273, -0.00952529, -0.012783667, -0.015390397, -0.017014174, -0.01822367, -0.019736525, -0.020721959, -0.020372914, -0.018108914, -0.013333749, -0.0068574124, 8.610302e-05, 0.007680194, 0.01581707, 0.023379065, 0.029957348, 0.03545642, 0.039663404, 0.042043176, 0.042373434, 0.042068377, 0.0424847, 0.04420886, 0.047607746, 0.052148826, 0.05684506, 0.0610201, 0.06404472, 0.06538297, 0.065364555, 0.06400362, 0.060323276, 0.054695126, 0.04828975, 0.04105195, 0.033264816, 0.025920311, 0.019312419, 0.014025152, 0.010974811, 0.010150828, 0.011374782, 0.014672395, 0.018961016, 0.022730537, 0.02566299, 0.027697025, 0.028938247, 0.029444259, 0.028725885, 0.027012158, 0.024609279, 0.022065496, 0.019947743, 0.017923754, 0.01658886, 0.016497308, 0.016815556, 0.017011413, 0.017163584, 0.017076135, 0.016341008, 0.014455648, 0.011205798, 0.0070454865, 0.002192361, -0.0029869766, -0.008149655, -0.01351698, -0.01895462, -0.024060315, -0.027866356, -0.03013926, -0.0318113, -0.033139292, -0.034051407, -0.034256212, -0.033830535, -0.033554766, -0.033865694, -0.034692906, -0.035557043, -0.036453135, -0.03812947, -0.040306296, -0.041695315, -0.042382076, -0.042276323, -0.040603682, -0.038609024, -0.036473297, -0.032494392, -0.027009243, -0.020875147, -0.013718008, -0.00613735, 0.0013482877, 0.009163501, 0.016174654, 0.020826794, 0.021807713, 0.018598022, 0.012340982, 0.0035293833, -0.0072449073, -0.019633003, -0.03347299, -0.04689574, -0.05861533, -0.06807366, -0.074486405, -0.0775701, -0.07723094, -0.073318385, -0.065836444, -0.055207565, -0.042502776, -0.028911814, -0.014901031, -0.0010818711, 0.011606837, 0.02237841, 0.030743882, 0.03622301, 0.037686143, 0.035246357, 0.029657628, 0.021340469, 0.011689472, 0.0014435508, -0.008723938, -0.017517036, -0.024249634, -0.028506773, -0.030715983, -0.030907357, -0.028429369, -0.023692016, -0.017169809, -0.008986867, 0.00068959495, 0.011256347, 0.021783484, 0.031604853, 0.039958797, 0.046515033, 0.050864656, 0.052621823, 0.05277827, 0.052556843, 0.052143645, 0.051214825, 0.05010854, 0.04921992, 0.048885267, 0.049877632, 0.05168555, 0.053481657, 0.055466946, 0.05721545, 0.058469873, 0.0598052, 0.06109369, 0.06230572, 0.06345564, 0.06415685, 0.06465103, 0.06455602, 0.06320681, 0.061232027, 0.059306677, 0.056493595, 0.05231092, 0.047716003, 0.042091288, 0.03508879, 0.027186222, 0.018412089, 0.009334529, -0.00012422298, -0.00914678, -0.016470278, -0.021311935, -0.023016768, -0.02221186, -0.019384082, -0.015171274, -0.009330915, -0.0020258147, 0.004591495, 0.010083302, 0.014678607, 0.018072749, 0.019504227, 0.018229194, 0.01448729, 0.008236678, 0.00019577127, -0.008587947, -0.017507764, -0.02553932, -0.031734053, -0.035230555, -0.036263168, -0.03586796, -0.033785228, -0.030317359, -0.026709817, -0.023083743, -0.020309074, -0.018725028, -0.017613944, -0.01746964, -0.018120194, -0.019576104, -0.021788083, -0.023533706, -0.024294296, -0.023941994, -0.02275275, -0.021289801, -0.019709134, -0.017583856, -0.014908226, -0.012383213, -0.010042454, -0.007914896, -0.0059392042, -0.0040492667, -0.00303315, -0.002951873, -0.0033618233, -0.004365739, -0.005579884, -0.007284862, -0.009986031, -0.013195719, -0.016598871, -0.019118886, -0.020932432, -0.022913732, -0.02410083, -0.024595674, -0.0248997, -0.024841215, -0.023951802, -0.022463191, -0.021000834, -0.018877031, -0.016820095, -0.015387591, -0.014327108, -0.014685573, -0.01579497, -0.01637213, -0.016490862, -0.016015284, -0.014875169, -0.013108161, -0.010336828, -0.00615231, -0.0004056845, 0.006273679, 0.01328374, 0.019993568, 0.025552137, 0.030551922, 0.03444124, 0.03576717, 0.034594502, 0.030987965, 0.025883686, 0.02052482, 0.015708236, 0.0117640365, 0.008873747, 0.007639187, 0.0075580976, 0.0085409535, 0.010316071, 0.012131936, 0.013961026, 0.015495945, 0.016725658, 0.017427793, 0.01763575, 0.017460953, 0.017685568, 0.018649321, 0.019130955, 0.020167673, 0.022556681, 0.026514268, 0.03194755, 0.03699954, 0.041219503, 0.04450238, 0.046554346, 0.047017004, 0.04580663, 0.04269451, 0.037575856, 0.031444382, 0.02371775, 0.015030977, 0.0066357097, -0.001167721, -0.007224473, -0.01150138, -0.0142332995, -0.015578846, -0.01538784, -0.013624016, -0.010958981, -0.007848907, -0.004919299, -0.0024045948, -0.0006213143, 0.00032723238, 0.0001849574, -0.0014622883, -0.0039289505, -0.006600961, -0.009505742, -0.012387977, -0.014337039, -0.015440039, -0.016435422, -0.017183663, -0.01655285, -0.014648401, -0.01274277, -0.009600273, -0.005076102, 3.6509107e-05, 0.006413555, 0.0131543055, 0.019445406, 0.024975512, 0.029694736, 0.032659788, 0.032074004, 0.028176704, 0.021243656, 0.0118014915, 0.00073551195, -0.010783507, -0.020825796, -0.028959421, -0.03478897, -0.037841663, -0.03860861, -0.03704707, -0.03231387, -0.024761422, -0.016077263, -0.0069481153, 0.0018599331, 0.009777966, 0.016855814, 0.02213876, 0.024965815, 0.02510479, 0.022664303, 0.018517654, 0.013244593, 0.0074082245, 0.0019263597, -0.0026525564, -0.0063713095, -0.009658564, -0.01249273, -0.01482731, -0.017023485, -0.018569171, -0.0198061, -0.021536496, -0.023450525, -0.025824932, -0.028070437, -0.029498428, -0.030028105, -0.028262146, -0.024315976, -0.018848276, -0.011004347, -0.0017125978, 0.0075271227, 0.016211262, 0.023690563, 0.029814761, 0.033831164, 0.03518843, 0.034524135, 0.03179054, 0.027167406, 0.0211536, 0.014130234, 0.0072400183, 0.00097416324, -0.0042178775, -0.006537447, -0.0057384917, -0.0029063358, 0.0020498678, 0.0086526815, 0.015878972, 0.02312565, 0.029718045, 0.035379726, 0.03940544, 0.04098425, 0.040325094, 0.03762365, 0.033025976, 0.027346646, 0.021765435, 0.016813776, 0.012720258, 0.0103494, 0.009632442, 0.010505097, 0.01325999, 0.016879378, 0.021203473, 0.025938293, 0.029868256, 0.032541573, 0.03365006, 0.03328087, 0.031366777, 0.027766917, 0.022627408, 0.015992813, 0.00860405, 0.001649882, -0.004521606, -0.009954048, -0.013983757, -0.016584057, -0.018286187, -0.01874254, -0.017390369, -0.014510985, -0.010118781, -0.004109796, 0.0019446504, 0.0066390806, 0.009118343, 0.009477399, 0.008222921, 0.0047226036, 0.0002182746, -0.004235732, -0.008476811, -0.010684968, -0.0105303265, -0.00858105, -0.004703111, 0.0004374532, 0.0065020896, 0.012843577, 0.018057942, 0.021680318, 0.022755442, 0.020623542, 0.015547595, 0.007410927, -0.0030659959, -0.014400139, -0.024801264, -0.033593785, -0.040448256, -0.04407561, -0.04413982, -0.040611845, -0.034136377, -0.025880115, -0.01659813, -0.007593795, 0.00013463205, 0.0059954836, 0.009452348, 0.010335466, 0.008662144, 0.004632046, -0.0007382235, -0.0059536817, -0.010781737, -0.015111203, -0.017460562, -0.017378598, -0.015881266, -0.013165743, -0.009190794, -0.0048548477, -0.0011917058, 0.0016658687, 0.0036537873, 0.0043792347, 0.00401832, 0.002169052, -0.0014948166, -0.006652188, -0.013156507, -0.020011066, -0.026116386, -0.03095698, -0.03493232, -0.038140796, -0.039384183, -0.03884509, -0.036818326, -0.03292069, -0.027796406, -0.022151146, -0.016811546, -0.012110346, -0.007700495, -0.003936571, -0.0012360215, 0.00035464522, 0.00091930974, 0.0010087058, 0.0012574757, 0.0023817706, 0.0048568635, 0.0076483805, 0.010319169, 0.013724683, 0.017515521, 0.021256475, 0.025105141, 0.028360032, 0.02986179, 0.029671267, 0.028537244, 0.026474223, 0.02377811, 0.020723639, 0.017451659, 0.014537762, 0.01213256, 0.010731946, 0.010632839, 0.011456603, 0.013501565, 0.016296698, 0.019237408, 0.022751205, 0.02620124, 0.029003, 0.031295136, 0.033498794, 0.03621416, 0.039022695, 0.041467614, 0.04287126, 0.04270555, 0.04114677, 0.038410768, 0.035129394, 0.03191309, 0.029081486, 0.026053285, 0.023021478, 0.020248834, 0.01698821, 0.013830106, 0.010873085, 0.007882431, 0.004677891, 0.0016086571, -0.00024412172, -0.0014238022, -0.0020357661, -0.001826398, -0.0008271774, 0.0006035668, 0.0021023417, 0.004132139, 0.006149107, 0.007978113, 0.009533787, 0.010804038, 0.012276518, 0.013297362, 0.013414674, 0.012653793, 0.011329682, 0.009180006, 0.006018568, 0.0022167005, -0.002228007, -0.006278819, -0.009470476, -0.011806027, -0.012748844, -0.012089087, -0.009792792, -0.006784162, -0.003411733, 0.00082173775, 0.0053914697, 0.009093152, 0.01150106, 0.012769805, 0.012828738, 0.011725399, 0.008578947, 0.0035485844, -0.0019969714, -0.00839021, -0.015536825, -0.022681525, -0.029489126, -0.03545303, -0.039942805, -0.04262418, -0.04338295, -0.041605152, -0.037608802, -0.031969536, -0.0247751, -0.01662374, -0.007830882, 0.0007620517, 0.007759588, 0.012680303, 0.016002815, 0.017600557, 0.017107258, 0.015116829, 0.011118157, 0.0050946735, -0.0012829454, -0.00730858, -0.0123554235, -0.01619496, -0.019539714, -0.022095537, -0.023623524, -0.024650212, -0.025320768, -0.025518397, -0.025604436, -0.026016379, -0.026108628, -0.025449151, -0.023982814, -0.021645697, -0.01905804, -0.015667548, -0.011178093, -0.0062241578, -0.0003542833, 0.0062382487, 0.012676996, 0.018567055, 0.02375312, 0.027825354, 0.030586362, 0.03316912, 0.036620237, 0.0401628, 0.042290658, 0.042905126, 0.042507537, 0.04135534, 0.03966303, 0.037332956, 0.034565788, 0.030770626, 0.025530249, 0.020008158, 0.014482956, 0.0086913295, 0.003303793, -0.0011159298, -0.004825298, -0.008088094, -0.010156977, -0.010558152, -0.009831455, -0.008393616, -0.0064796116, -0.003953698, -0.0010906823, 0.0014827915, 0.0039916313, 0.006281637, 0.008625429, 0.011026816, 0.012694679, 0.014225935, 0.015485773, 0.016381526, 0.016881855, 0.015680688, 0.013370335, 0.010324438, 0.0059276395, 0.0008632004, -0.004147545, -0.008601436, -0.012418608, -0.015387074, -0.017080951, -0.017689317, -0.017087653, -0.015643401, -0.0143187465, -0.013200419, -0.012098627, -0.010708843, -0.009400465, -0.0087310625, -0.007651536, -0.006351172, -0.0060044276, -0.006343066, -0.0069151614, -0.0074012135, -0.008127247, -0.008899488, -0.008779412, -0.007623371, -0.005195326, -0.0019538477, 0.0013219565, 0.004504294, 0.0072341547, 0.009065318, 0.009186778, 0.007972862, 0.0066948975, 0.0047831116, 0.0019755543, -0.0010217146, -0.0034800575, -0.0048920983, -0.005975706, -0.0066127134, -0.0065290877, -0.005669018, -0.00373305, -0.0012076898, 0.001830487, 0.0045057656, 0.0064497436, 0.0070689274, 0.005624669, 0.0034356767, -7.7512195e-05, -0.004280484, -0.007965831, -0.011496619, -0.013751509, -0.015295696, -0.01601343, -0.015538911, -0.0152405435, -0.015182711, -0.015206848, -0.014324607, -0.012360059, -0.010466808, -0.008705951, -0.006979103, -0.00517527, -0.0029320742, 0.00040956633, 0.004406851, 0.007781176, 0.010358666, 0.012303241, 0.013740043, 0.014554166, 0.014557763, 0.013652138, 0.011761251, 0.0090915235, 0.0056703542, 0.0024651056, 0.00067481305, 0.0004322173, 0.0019762898, 0.0048926077, 0.00862827, 0.013015895, 0.01751426, 0.02224527, 0.027230028, 0.031850945, 0.03533405, 0.037454758, 0.0384385, 0.038289692, 0.03790001, 0.03709829, 0.035211273, 0.032860015, 0.029975636, 0.02677805, 0.023786575, 0.021536412, 0.019786824, 0.017159948, 0.013672247, 0.009535626, 0.0054211607, 0.002250729, -0.00095589616, -0.0045726122, -0.0077118003, -0.009851103, -0.010815773, -0.011145505, -0.010946328, -0.009329683, -0.006912536, -0.0044821473, -0.0018538941, 0.00049168995, 0.0027558063, 0.0057388633, 0.0093304515, 0.012438209, 0.014624718, 0.01599332, 0.016196048, 0.015595869, 0.014299744, 0.012725473, 0.011208176, 0.009210219, 0.0070756814, 0.004577535, 0.0016986874, -0.000742008, -0.0028779574, -0.005058414, -0.007157934, -0.008946478, -0.010884503, -0.013043407, -0.015294747, -0.018021416, -0.020393156, -0.022036929, -0.023389233, -0.024214514, -0.024394372, -0.023790289, -0.022580983, -0.020523889, -0.017386295, -0.013520527, -0.009244403, -0.0056688176, -0.0026078802, 2.7341068e-05, 0.001706583, 0.0028085369, 0.0021817286, -6.204968e-05, -0.0027411974, -0.0057396786, -0.008569142, -0.011228855, -0.013313949, -0.013986817, -0.013446524, -0.012699993, -0.0119755985, -0.0106345825, -0.008633727, -0.0065567736, -0.0047055734, -0.0029078245, -0.0016782555, -0.0009972476, -0.00050428906, -0.0005435442, -0.0013542877, -0.003012584, -0.0049543385, -0.007257038, -0.009487543, -0.010598029, -0.010885778, -0.010140526, -0.008509937, -0.006820491, -0.0047087744, -0.001863585, 0.0010581851, 0.0040058396, 0.0071926354, 0.00958004, 0.010200897, 0.009697406, 0.009146051, 0.008302032, 0.0075792475, 0.008015538, 0.0093442025, 0.011232877, 0.013488104, 0.016143924, 0.01864251, 0.020242762, 0.021535322, 0.022816844, 0.02352746, 0.023083225, 0.02138661, 0.018477801, 0.014010127, 0.00773892, 0.00068122736, -0.0053765886, -0.01005779, -0.013400154, -0.014767208, -0.014369927, -0.012471011, -0.008887572, -0.004543055, -3.306479e-05, 0.004535069, 0.008566619, 0.011681628, 0.013498975, 0.014681405, 0.015465084, 0.015171835, 0.013923883, 0.011463163, 0.008082934, 0.0047615855, 0.0019222386, -0.00043219514, -0.002233176, -0.0034799087, -0.004528581, -0.0048497403, -0.004364458, -0.004194001, -0.004489009, -0.004806387, -0.0052776653, -0.0060240417, -0.007001983, -0.008001915, -0.009104429, -0.010715304, -0.0119579295, -0.012232978, -0.01138693, -0.008513196, -0.003958028, 0.0014295281, 0.0073563927, 0.01337608, 0.018760927, 0.023422498, 0.027051138, 0.028445927, 0.027765444, 0.024813708, 0.019481706, 0.013055178, 0.005553695, -0.0027127285, -0.010549526, -0.017055938, -0.021489404, -0.02377226, -0.024317915, -0.023637706, -0.021941189, -0.019841168, -0.01757753, -0.014722933, -0.012023234, -0.009939056, -0.008289581, -0.0070613814, -0.0059351367, -0.0049222833, -0.0037025027, -0.0020739064, -0.0007889637, 0.00034566148, 0.0024809318, 0.0062206867, 0.0113512045, 0.016591184, 0.020786632, 0.0239665, 0.026018979, 0.026921548, 0.026747124, 0.025126204, 0.022473648, 0.019563315, 0.016779551, 0.0137652885, 0.010128323, 0.0063361647, 0.0026535667, -0.0004386057, -0.002833427, -0.0052961353, -0.008098445, -0.011380757, -0.015187644, -0.018829904, -0.021349413, -0.02287522, -0.023497634, -0.022768542, -0.020872924, -0.017292922, -0.011978209, -0.0059598763, -0.00028221018, 0.0049150027, 0.010352731, 0.015381029, 0.019948173, 0.023731355, 0.025956009, 0.027305866, 0.02732905, 0.02618217, 0.02387659, 0.02021236, 0.016218977, 0.012164271, 0.008826342, 0.0059742117, 0.0033195496, 0.0009818276, -0.0016057198, -0.0038288601, -0.0057796114, -0.0070246807, -0.007404898, -0.0074389265, -0.006616922, -0.005780759, -0.004823254, -0.0034812514, -0.002378808, -0.0007476372, 0.0013394214, 0.0035996812, 0.006566277, 0.009874976, 0.012708979, 0.014688573, 0.015640449, 0.01575176, 0.015153189, 0.013727443, 0.012059659, 0.010691956, 0.009332029, 0.007846634, 0.006907363, 0.0064929873, 0.0062506106, 0.006558606, 0.007203793, 0.00800306, 0.008607226, 0.008778035, 0.008393382, 0.0065261964, 0.0039528576, 0.0012789564, -0.002378559, -0.0067197387, -0.010885488, -0.013813289, -0.015680384, -0.017529665, -0.018713497, -0.019178757, -0.019386914, -0.018916974, -0.017930288, -0.01652493, -0.014866659, -0.013171186, -0.011053282, -0.00834055, -0.005261465, -0.0020839437, 0.0009924454, 0.0032940456, 0.0048865634, 0.005642862, 0.0048177857, 0.0032576262, 0.0009591125, -0.0022982778, -0.0056654764, -0.008944617, -0.011821806, -0.014052646, -0.015601215, -0.016662508, -0.016950436, -0.01569797, -0.013347633, -0.010620631, -0.007640464, -0.004908088, -0.0031073971, -0.0020857092, -0.0017396123, -0.0020834, -0.0028910066, -0.0038629137, -0.0043238373, -0.003858842, -0.002021197, 0.0005370776, 0.002728431, 0.005216832, 0.0076970407, 0.009111977, 0.009962357, 0.010175487, 0.008970089, 0.0063189184, 0.0022037076, -0.002587042, -0.0070571266, -0.011021719, -0.014025136, -0.016075008, -0.017004807, -0.01635843, -0.014130849, -0.010579501, -0.0065695187, -0.0023293772, 0.0020052507, 0.005517337, 0.0076672994, 0.008565198, 0.008373659, 0.0071239057, 0.0049413242, 0.0021758701, -0.0006373686, -0.0033085498, -0.005397062, -0.006798521, -0.007597027, -0.0075165015, -0.006615624, -0.004265233, -0.00084371096, 0.0030550475, 0.0071315723, 0.010549518, 0.013976494, 0.017046837, 0.018894462, 0.019441957, 0.018968718, 0.018352289, 0.017357666, 0.015704196, 0.013410612, 0.0111854235, 0.009266191, 0.007389769, 0.005937264, 0.0044468814, 0.0032005333, 0.0021564811, 0.0012503884, 0.0008728054, 0.00035905227, -0.00014619916, -0.00012882565, 0.00067155063, 0.0017830787, 0.0031987817, 0.0052710115, 0.00735074, 0.009110793, 0.0096622165, 0.009044501, 0.008334258, 0.0077291573, 0.007367084, 0.007211275, 0.007316355, 0.008133803, 0.009726597, 0.011932699, 0.014969198, 0.01742535, 0.018417642, 0.01940733, 0.02011048, 0.01987831, 0.018587263, 0.016108919, 0.012801238, 0.008475487, 0.0035232434, -0.001322157, -0.0049311374, -0.006919033, -0.0077431253, -0.007353574, -0.0062319404, -0.004048817, -0.0015764853, 4.675551e-05, 0.0021054798, 0.004686444, 0.006802264, 0.007783953, 0.007614037, 0.0067677377, 0.005112547, 0.0030384562, 0.0006353631, -0.001638021, -0.0025465598, -0.0026215408, -0.0023357081, -0.0014005079, -0.0007506089, -0.0006740836, -0.0001335111, 0.00091091084, 0.0016624127, 0.0019566366, 0.0018539976, 0.0009771743, -0.0005989944, -0.0021367185, -0.0036564844, -0.0053765303, -0.007113086, -0.009337976, -0.011860062, -0.013357305, -0.01315563, -0.012361638, -0.012156964, -0.012165373, -0.012744951, -0.013640334, -0.014239282, -0.01486731, -0.014740528, -0.014277063, -0.013594983, -0.012240243, -0.010573616, -0.008113802, -0.0050742384, -0.0014766107, 0.002384576, 0.006018299, 0.008820687, 0.01006308, 0.010621397, 0.010423498, 0.00954278, 0.008028279, 0.005368179, 0.0020862955, -0.0015603235, -0.005093593, -0.008572932, -0.011751136, -0.013918447, -0.015130063, -0.015290213, -0.014114197, -0.0114069525, -0.007784216, -0.0031992504, 0.0022366475, 0.0075191963, 0.012306463, 0.015806902, 0.018250467, 0.020293085, 0.02086512, 0.019629238, 0.017114364, 0.013456327, 0.009297031, 0.004455584, -0.0013402698, -0.006540484, -0.010776703, -0.014309939, -0.016528523, -0.017112503, -0.015305206, -0.011158347, -0.0056821886, -6.212896e-05, 0.0046448633, 0.008948004, 0.0126066385, 0.014222198, 0.014014329, 0.012444805, 0.009674931, 0.0064364173, 0.002970168, -0.00026804674, -0.0027938806, -0.005450037, -0.007635552, -0.007937697, -0.0074148, -0.0064385007, -0.0047596027, -0.0028980228, -0.00028947755, 0.0030323213, 0.0066144965, 0.00988446, 0.012362339, 0.014436307, 0.015698606, 0.015924523, 0.01544838, 0.014340761, 0.012553192, 0.010238108, 0.0074481564, 0.0039555146, 0.00020559708, -0.0035882003, -0.0077512395, -0.0125494925, -0.017134544, -0.020546164, -0.023208814, -0.0247253, -0.024766564, -0.023881424, -0.021990903, -0.018751428, -0.01416481, -0.008817838, -0.003544702, 0.0014371189, 0.0064094816, 0.010814494, 0.013849889, 0.015536456, 0.016147323, 0.015247836, 0.012760769, 0.009446064, 0.005207073, 0.00030299855, -0.0046099895, -0.0089164395, -0.012198539, -0.014563244, -0.01578131, -0.016351078, -0.01590689, -0.014000478, -0.011313176, -0.007765295, -0.004290178, -0.001918969, -0.00028507644, 0.0013077214, 0.002974601, 0.0042359503};
-// constexpr float kGuzheng[4096] = {0.38742065, 0.80111694, 0.9298096, 0.9999695, 0.91937256, 0.805603, 0.6951599, 0.58792114, 0.45150757, 0.2987671, 0.14041138, -0.007537842, -0.13897705, -0.29733276, -0.44787598, -0.5921936, -0.72250366, -0.8033142, -0.8328247, -0.8098755, -0.7561035, -0.68844604, -0.6086731, -0.4986267, -0.41363525, -0.32781982, -0.24301147, -0.13549805, 0.016052246, 0.083862305, 0.14276123, 0.18157959, 0.162323, 0.15548706, 0.15307617, 0.11767578, 0.14572144, 0.20373535, 0.23031616, 0.25558472, 0.28961182, 0.3163452, 0.31713867, 0.3078003, 0.26672363, 0.2303772, 0.1949768, 0.16879272, 0.14953613, 0.11300659, 0.078704834, 0.036224365, -0.016204834, -0.055511475, -0.08929443, -0.09976196, -0.101379395, -0.10018921, -0.079833984, -0.05126953, -0.028381348, 0.00491333, 0.022460938, 0.043518066, 0.0826416, 0.09075928, 0.09295654, 0.08984375, 0.07229614, 0.033996582, -0.0038146973, -0.062316895, -0.12243652, -0.16452026, -0.20553589, -0.23672485, -0.25180054, -0.25561523, -0.25146484, -0.24285889, -0.22991943, -0.20532227, -0.17739868, -0.13861084, -0.09765625, -0.05670166, -0.011169434, 0.029205322, 0.063812256, 0.09408569, 0.11303711, 0.13400269, 0.14614868, 0.15206909, 0.15933228, 0.16647339, 0.16705322, 0.16921997, 0.16726685, 0.15939331, 0.158844, 0.15344238, 0.14309692, 0.13439941, 0.12582397, 0.10736084, 0.09030151, 0.06454468, 0.035827637, 0.0069885254, -0.022369385, -0.05026245, -0.076416016, -0.09613037, -0.1109314, -0.12283325, -0.12927246, -0.13076782, -0.12863159, -0.12084961, -0.11105347, -0.0975647, -0.080566406, -0.06271362, -0.046051025, -0.029541016, -0.01852417, -0.008361816, -0.0019836426, -0.00048828125, -0.001953125, -0.0024414062, -0.007873535, -0.012634277, -0.016723633, -0.023071289, -0.025299072, -0.026153564, -0.025665283, -0.022735596, -0.015319824, -0.0073547363, 0.0031738281, 0.013519287, 0.024932861, 0.034729004, 0.044403076, 0.05218506, 0.057922363, 0.062805176, 0.0664978, 0.0680542, 0.06826782, 0.06716919, 0.06454468, 0.06124878, 0.056671143, 0.05126953, 0.046295166, 0.0413208, 0.035125732, 0.030334473, 0.023651123, 0.017211914, 0.010375977, 0.0023498535, -0.0071105957, -0.0154418945, -0.025390625, -0.03503418, -0.044128418, -0.05303955, -0.06072998, -0.06707764, -0.07156372, -0.07489014, -0.075042725, -0.07330322, -0.06903076, -0.06314087, -0.054870605, -0.045837402, -0.03555298, -0.025115967, -0.014709473, -0.005004883, 0.004486084, 0.012390137, 0.019226074, 0.024780273, 0.028656006, 0.03137207, 0.03277588, 0.032714844, 0.03213501, 0.031188965, 0.029266357, 0.028076172, 0.026397705, 0.025238037, 0.024169922, 0.02368164, 0.022644043, 0.022369385, 0.021759033, 0.021087646, 0.020141602, 0.019042969, 0.017486572, 0.015563965, 0.013427734, 0.010681152, 0.007904053, 0.0048828125, 0.0020446777, -0.0010681152, -0.0035705566, -0.0061035156, -0.0082092285, -0.010131836, -0.011688232, -0.0132751465, -0.014282227, -0.015533447, -0.01651001, -0.017456055, -0.018463135, -0.019439697, -0.02029419, -0.021331787, -0.022216797, -0.022766113, -0.02331543, -0.023284912, -0.022888184, -0.021820068, -0.020355225, -0.017913818, -0.015289307, -0.011810303, -0.008056641, -0.0038146973, 0.00039672852, 0.0048217773, 0.009063721, 0.013031006, 0.01663208, 0.01965332, 0.022003174, 0.023712158, 0.024780273, 0.024993896, 0.024780273, 0.023834229, 0.022521973, 0.020751953, 0.018798828, 0.016479492, 0.014251709, 0.011810303, 0.009490967, 0.0072021484, 0.005065918, 0.0029296875, 0.0010375977, -0.00079345703, -0.0025634766, -0.004180908, -0.0057678223, -0.007232666, -0.008636475, -0.00982666, -0.010986328, -0.011810303, -0.012573242, -0.013000488, -0.013305664, -0.013214111, -0.013000488, -0.012481689, -0.011779785, -0.010864258, -0.009857178, -0.008728027, -0.0075683594, -0.0064086914, -0.005218506, -0.004180908, -0.0031738281, -0.0022888184, -0.0014648438, -0.00076293945, -3.0517578e-05, 0.0005187988, 0.0012207031, 0.0018310547, 0.002532959, 0.0032348633, 0.004058838, 0.004852295, 0.0057373047, 0.0066223145, 0.0074768066, 0.008300781, 0.009002686, 0.0095825195, 0.0099487305, 0.010192871, 0.0101623535, 0.0099487305, 0.009429932, 0.0087890625, 0.007843018, 0.0068359375, 0.0056152344, 0.004333496, 0.002960205, 0.0016174316, 0.00024414062, -0.0010070801, -0.0022583008, -0.0033569336, -0.0043640137, -0.0052490234, -0.006011963, -0.006652832, -0.0071411133, -0.007537842, -0.007751465, -0.00793457, -0.00793457, -0.007843018, -0.0076293945, -0.0073547363, -0.0068969727, -0.0064086914, -0.0057678223, -0.005065918, -0.004272461, -0.0034179688, -0.0025024414, -0.0015563965, -0.00064086914, 0.0002746582, 0.001159668, 0.0019836426, 0.0027160645, 0.0033874512, 0.00390625, 0.004333496, 0.004638672, 0.004852295, 0.0049438477, 0.0049743652, 0.0048828125, 0.004760742, 0.004547119, 0.004333496, 0.0040893555, 0.0038146973, 0.003540039, 0.0032653809, 0.0029907227, 0.0026855469, 0.0024108887, 0.0020751953, 0.0017700195, 0.0014038086, 0.0010375977, 0.00061035156, 0.00021362305, -0.00021362305, -0.0006713867, -0.0011291504, -0.0015869141, -0.0020141602, -0.0024414062, -0.0028076172, -0.003112793, -0.0033874512, -0.0036010742, -0.0037231445, -0.0037841797, -0.0037841797, -0.003753662, -0.0036315918, -0.0034484863, -0.0032348633, -0.002960205, -0.0026550293, -0.0023498535, -0.0019836426, -0.0016174316, -0.0012207031, -0.0008239746, -0.00039672852, 0.0, 0.00039672852, 0.0008239746, 0.0012207031, 0.0015869141, 0.0019226074, 0.0022583008, 0.002532959, 0.0027770996, 0.0029296875, 0.0030822754, 0.003112793, 0.0031433105, 0.0030822754, 0.002960205, 0.0027770996, 0.0025634766, 0.0022888184, 0.0020141602, 0.0016784668, 0.0013427734, 0.0010070801, 0.0006713867, 0.00033569336, 3.0517578e-05, -0.00024414062, -0.0005187988, -0.00076293945, -0.0009765625, -0.001159668, -0.0013427734, -0.0014648438, -0.0015869141, -0.0016784668, -0.0017700195, -0.0018005371, -0.0018310547, -0.0018310547, -0.0018310547, -0.0018005371, -0.001739502, -0.0016479492, -0.0015563965, -0.0014343262, -0.0013122559, -0.001159668, -0.0009765625, -0.00079345703, -0.00061035156, -0.0004272461, -0.00021362305, -3.0517578e-05, 0.00015258789, 0.00030517578, 0.00048828125, 0.00064086914, 0.00079345703, 0.0009460449, 0.0010681152, 0.001159668, 0.0012512207, 0.0013122559, 0.0013427734, 0.001373291, 0.0014038086, 0.0014038086, 0.001373291, 0.0013427734, 0.0012817383, 0.0011901855, 0.0010986328, 0.0009765625, 0.0008544922, 0.0007019043, 0.0005493164, 0.00039672852, 0.00021362305, 3.0517578e-05, -9.1552734e-05, -0.0002746582, -0.0004272461, -0.000579834, -0.0007324219, -0.0008544922, -0.0009460449, -0.0010375977, -0.0010681152, -0.0011291504, -0.0011291504, -0.0011291504, -0.0010986328, -0.0010681152, -0.0010070801, -0.0009460449, -0.0008544922, -0.00079345703, -0.0006713867, -0.000579834, -0.00045776367, -0.00036621094, -0.00024414062, -0.00012207031, -3.0517578e-05, 6.1035156e-05, 0.00015258789, 0.0002746582, 0.00036621094, 0.0004272461, 0.0005187988, 0.000579834, 0.00064086914, 0.0006713867, 0.0007324219, 0.0007324219, 0.00076293945, 0.0007324219, 0.0007324219, 0.0007019043, 0.0006713867, 0.00064086914, 0.000579834, 0.0005187988, 0.00045776367, 0.00039672852, 0.00033569336, 0.00024414062, 0.00018310547, 0.00012207031, 3.0517578e-05, 0.0, -6.1035156e-05, -0.00015258789, -0.00021362305, -0.0002746582, -0.00033569336, -0.00036621094, -0.0004272461, -0.00045776367, -0.00048828125, -0.0005187988, -0.0005493164, -0.0005493164, -0.0005493164, -0.0005493164, -0.0005187988, -0.0005187988, -0.00045776367, -0.0004272461, -0.00039672852, -0.00033569336, -0.0002746582, -0.00021362305, -0.00015258789, -9.1552734e-05, -3.0517578e-05, 0.0, 6.1035156e-05, 0.00012207031, 0.00018310547, 0.00024414062, 0.0002746582, 0.00030517578, 0.00033569336, 0.00036621094, 0.00039672852, 0.00039672852, 0.0004272461, 0.00039672852, 0.00039672852, 0.00039672852, 0.00036621094, 0.00033569336, 0.00030517578, 0.0002746582, 0.00024414062, 0.00021362305, 0.00015258789, 0.00012207031, 6.1035156e-05, 3.0517578e-05, 0.0, -3.0517578e-05, -6.1035156e-05, -0.00012207031, -0.00015258789, -0.00018310547, -0.00021362305, -0.00021362305, -0.00024414062, -0.0002746582, -0.0002746582, -0.0002746582, -0.0002746582, -0.0002746582, -0.0002746582, -0.00024414062, -0.00024414062, -0.00024414062, -0.00021362305, -0.00018310547, -0.00015258789, -0.00015258789, -0.00012207031, -9.1552734e-05, -6.1035156e-05, -3.0517578e-05, 0.0, 0.0, 3.0517578e-05, 6.1035156e-05, 9.1552734e-05, 0.00012207031, 0.00012207031, 0.00015258789, 0.00018310547, 0.00018310547, 0.00018310547, 0.00021362305, 0.00021362305, 0.00021362305, 0.00021362305, 0.00018310547, 0.00018310547, 0.00018310547, 0.00015258789, 0.00015258789, 0.00012207031, 9.1552734e-05, 9.1552734e-05, 6.1035156e-05, 3.0517578e-05, 0.0, 0.0, 0.0, -3.0517578e-05, -6.1035156e-05, -6.1035156e-05, -9.1552734e-05, -9.1552734e-05, -0.00012207031, -0.00012207031, -0.00015258789, -0.00015258789, -0.00015258789, -0.00015258789, -0.00015258789, -0.00015258789, -0.00015258789, -0.00012207031, -0.00012207031, -0.00012207031, -9.1552734e-05, -9.1552734e-05, -6.1035156e-05, -3.0517578e-05, -3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 3.0517578e-05, 3.0517578e-05, 6.1035156e-05, 6.1035156e-05, 6.1035156e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 9.1552734e-05, 6.1035156e-05, 6.1035156e-05, 6.1035156e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 0.0, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -6.1035156e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 6.1035156e-05, 6.1035156e-05, 6.1035156e-05, 6.1035156e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, -3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 3.0517578e-05, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-constexpr float kGuzheng[4096] = {0.40744328, 0.57097495, 0.6936067, 0.7668781, 0.8055983, 0.83518, 0.8744383, 0.92499304, 0.97292525, 0.9996026, 0.9930517, 0.9524789, 0.88477075, 0.7977585, 0.69626355, 0.58322155, 0.4632271, 0.3439645, 0.23347378, 0.1354962, 0.047274683, -0.037736762, -0.124052525, -0.20985168, -0.28774273, -0.35005075, -0.3944097, -0.42524785, -0.45013413, -0.47405273, -0.4961431, -0.5112236, -0.51451117, -0.50561035, -0.48883784, -0.47016594, -0.45367712, -0.44032106, -0.42934468, -0.42036787, -0.4138542, -0.40971738, -0.40600613, -0.39982003, -0.39048368, -0.38241822, -0.38458216, -0.4056648, -0.44775617, -0.50307935, -0.5567787, -0.59462225, -0.61080796, -0.61066556, -0.6063506, -0.6083266, -0.6182205, -0.62761074, -0.62331885, -0.59563214, -0.54431224, -0.479003, -0.4142647, -0.36247084, -0.32851073, -0.30866098, -0.29348728, -0.2727784, -0.24006173, -0.19496839, -0.14288007, -0.092305034, -0.051097456, -0.022966241, -0.0056777466, 0.00818494, 0.02807054, 0.061230645, 0.109382115, 0.16790396, 0.22796088, 0.28042662, 0.31957704, 0.34477434, 0.3595904, 0.36923793, 0.37792706, 0.38746697, 0.39741474, 0.40611058, 0.41165942, 0.41238475, 0.40697226, 0.39479437, 0.3765294, 0.35455206, 0.3323619, 0.3129002, 0.2966427, 0.28095677, 0.26167879, 0.23633549, 0.20696022, 0.18027568, 0.1645513, 0.16479509, 0.179407, 0.2007526, 0.21955983, 0.23032975, 0.23409827, 0.23665598, 0.24355474, 0.25557068, 0.2679782, 0.27418384, 0.27101582, 0.26168683, 0.2541158, 0.25567976, 0.268067, 0.28582254, 0.29953396, 0.30139217, 0.28939074, 0.2676272, 0.24297746, 0.2207179, 0.20194, 0.183939, 0.16263743, 0.1350771, 0.10056601, 0.060416304, 0.017140832, -0.026117835, -0.06588644, -0.09885382, -0.122799575, -0.13753767, -0.14508972, -0.14868607, -0.15105452, -0.15305366, -0.15350538, -0.15023123, -0.14149627, -0.12693676, -0.10761253, -0.0855259, -0.063179776, -0.043393508, -0.029100154, -0.02275758, -0.025438497, -0.036192536, -0.052323665, -0.07063765, -0.08892962, -0.106688, -0.1245117, -0.14271678, -0.16027153, -0.17498486, -0.18491074, -0.18995036, -0.19239917, -0.19589172, -0.2033327, -0.2151437, -0.22898304, -0.24114852, -0.24879871, -0.25162008, -0.25190395, -0.2529383, -0.25660524, -0.2615722, -0.26322234, -0.25559458, -0.23450461, -0.20024328, -0.15826431, -0.11719699, -0.08497185, -0.065041676, -0.054842908, -0.047521956, -0.036095146, -0.017717758, 0.004420795, 0.02270903, 0.029307395, 0.020508189, -0.0011665551, -0.028144596, -0.05138689, -0.06430501, -0.06505461, -0.056401014, -0.04370145, -0.03230311, -0.025567943, -0.02411429, -0.026217368, -0.028947262, -0.02954268, -0.026565623, -0.020468596, -0.0133690825, -0.008108787, -0.0069943466, -0.010782125, -0.018349461, -0.02714814, -0.034182865, -0.037095692, -0.034989543, -0.02875972, -0.020806907, -0.0141079435, -0.010837453, -0.011068173, -0.012305079, -0.0104081975, -0.0017389775, 0.014522096, 0.03534425, 0.055016298, 0.068111576, 0.07256306, 0.07087193, 0.06852103, 0.0704596, 0.077869914, 0.08734723, 0.093099944, 0.09079997, 0.08061215, 0.06744957, 0.058279946, 0.058158126, 0.06739131, 0.08145852, 0.09359457, 0.09843, 0.09462863, 0.08521869, 0.07568276, 0.071021594, 0.07336737, 0.081249416, 0.09068802, 0.09741814, 0.099100016, 0.09648213, 0.09303091, 0.09326631, 0.10062174, 0.11582968, 0.1365441, 0.15830232, 0.17631611, 0.18726596, 0.19037455, 0.18743612, 0.18192877, 0.17762765, 0.17721324, 0.18130118, 0.18819146, 0.19445534, 0.19622457, 0.19074476, 0.17754929, 0.15867545, 0.13774279, 0.118283786, 0.1021428, 0.08876636, 0.07575937, 0.060418352, 0.041440766, 0.019924399, -0.00086398533, -0.016859418, -0.025063623, -0.02501126, -0.019107843, -0.0116217425, -0.0067670117, -0.0068122004, -0.01121101, -0.017265182, -0.021987563, -0.024091091, -0.024875075, -0.027397502, -0.034397475, -0.04628876, -0.060577672, -0.073175564, -0.08082418, -0.083075546, -0.082522936, -0.08312104, -0.0876933, -0.096244834, -0.10613765, -0.113944955, -0.117737144, -0.11835092, -0.11892448, -0.12309155, -0.13297752, -0.14811654, -0.16574533, -0.18213278, -0.19415396, -0.20037074, -0.20126781, -0.19871618, -0.19500214, -0.19183843, -0.18972175, -0.18785995, -0.18467551, -0.17864886, -0.16910346, -0.15656775, -0.14258304, -0.12912129, -0.11793921, -0.11013234, -0.10595277, -0.1048083, -0.10538037, -0.10591517, -0.104767986, -0.10110696, -0.09542139, -0.08939797, -0.08501162, -0.08321694, -0.083039574, -0.08177755, -0.07638359, -0.06529251, -0.049557373, -0.032503143, -0.018023178, -0.008532074, -0.0038351621, -0.0015953005, 0.0009490505, 0.005150564, 0.010180086, 0.013774152, 0.013980606, 0.010763825, 0.0064457743, 0.0046930155, 0.008635866, 0.01920215, 0.03460433, 0.051254794, 0.06559269, 0.07582012, 0.08261306, 0.088443786, 0.095916875, 0.10606731, 0.11759552, 0.12749307, 0.13272496, 0.13202457, 0.12678139, 0.120511055, 0.11719392, 0.11938365, 0.12707199, 0.1378315, 0.14805318, 0.15457043, 0.15587752, 0.15247847, 0.14638153, 0.1401069, 0.13566959, 0.13388816, 0.13418832, 0.13491194, 0.13401702, 0.12994042, 0.12230869, 0.112187974, 0.10171712, 0.09323339, 0.08825634, 0.086793534, 0.08730751, 0.08738916, 0.08486224, 0.07884023, 0.070254184, 0.061568536, 0.055738106, 0.054815415, 0.058844805, 0.0656357, 0.07164227, 0.07361183, 0.07018595, 0.06256005, 0.05375716, 0.046853635, 0.04315394, 0.04140875, 0.038586166, 0.031765204, 0.020010622, 0.005076643, -0.009499689, -0.020364227, -0.026180292, -0.028250122, -0.02960544, -0.033169255, -0.040098753, -0.049240097, -0.057923686, -0.06355848, -0.06508985, -0.06354105, -0.061413407, -0.06133439, -0.064695805, -0.070975155, -0.07804824, -0.083294496, -0.08491522, -0.08280248, -0.07854422, -0.074598506, -0.07308719, -0.07482687, -0.079051405, -0.083890975, -0.0872891, -0.087875046, -0.085423104, -0.08080456, -0.07557719, -0.07143638, -0.06969207, -0.07085847, -0.074436836, -0.079009935, -0.0827371, -0.084165424, -0.08302584, -0.080551736, -0.079008184, -0.08053684, -0.08587259, -0.09366551, -0.10088031, -0.1041583, -0.10145748, -0.09308847, -0.081572905, -0.07039439, -0.06231604, -0.0581604, -0.05667264, -0.055484854, -0.052607946, -0.047614638, -0.04187072, -0.037706055, -0.037001573, -0.039990485, -0.044955358, -0.049006086, -0.049515672, -0.045414638, -0.037624322, -0.028408982, -0.020057127, -0.013684372, -0.008849217, -0.0041537723, 0.0016075132, 0.008503814, 0.015315245, 0.020235697, 0.02196333, 0.020502068, 0.017215868, 0.014150091, 0.013048053, 0.014608482, 0.018327132, 0.02291314, 0.026991349, 0.029726434, 0.031117612, 0.03190439, 0.0331843, 0.035923474, 0.04054631, 0.046746492, 0.05358301, 0.059825275, 0.064416416, 0.06687318, 0.06746306, 0.067088075, 0.0669188, 0.06791455, 0.070407115, 0.07391387, 0.07728536, 0.07918284, 0.078736156, 0.0760997, 0.07259206, 0.07024355, 0.07086839, 0.07508526, 0.0818305, 0.08871333, 0.09311436, 0.09347408, 0.09005277, 0.08470644, 0.079786144, 0.07679311, 0.0755772, 0.0745439, 0.071729414, 0.06608763, 0.058220882, 0.050133888, 0.04417442, 0.04178689, 0.04278561, 0.045528002, 0.047847316, 0.048193574, 0.0463497, 0.043359794, 0.04075927, 0.03957729, 0.03968828, 0.039873555, 0.038543303, 0.03469351, 0.028542105, 0.021476317, 0.015340567, 0.011470459, 0.010014283, 0.009904397, 0.009461383, 0.0072659655, 0.0028189614, -0.0033249923, -0.009944964, -0.015789313, -0.020113977, -0.022903372, -0.02475784, -0.026577344, -0.029198825, -0.033093646, -0.038180646, -0.04379991, -0.04889374, -0.052396685, -0.053729627, -0.053181212, -0.05194096, -0.05167773, -0.053792756, -0.058687937, -0.06543935, -0.07209856, -0.07653214, -0.0774157, -0.0748869, -0.070505396, -0.06650589, -0.06469774, -0.065568216, -0.06806809, -0.070218384, -0.07023958, -0.06760156, -0.06340522, -0.05985209, -0.0590629, -0.061888177, -0.067380525, -0.07323768, -0.076975845, -0.077176474, -0.0741161, -0.06945715, -0.06522315, -0.06267589, -0.061728362, -0.06117634, -0.059544377, -0.05601175, -0.050888155, -0.04541133, -0.041036382, -0.038646936, -0.038116656, -0.038421586, -0.03819928, -0.03643581, -0.032930005, -0.02832668, -0.023737153, -0.020161096, -0.018000733, -0.016891757, -0.015907455, -0.014011132, -0.010526375, -0.0054106354, 0.00076609163, 0.0070904214, 0.012678401, 0.016994894, 0.020015122, 0.02219442, 0.024265748, 0.02692077, 0.030467989, 0.034601193, 0.038418368, 0.04075972, 0.040779237, 0.038496874, 0.035013046, 0.0321858, 0.031845942, 0.03491145, 0.04087618, 0.047990344, 0.054085825, 0.05763134, 0.05845316, 0.05772618, 0.05724029, 0.058349736, 0.061188303, 0.064582266, 0.06670439, 0.06610541, 0.06255764, 0.057253864, 0.05225714, 0.04949926, 0.049860608, 0.052809216, 0.056766488, 0.059973683, 0.06137257, 0.061028015, 0.05989619, 0.059117988, 0.05927536, 0.06004292, 0.060411174, 0.0593132, 0.056262244, 0.051629927, 0.046432577, 0.04178768, 0.038372558, 0.03617657, 0.03463668, 0.03302437, 0.03084151, 0.028025746, 0.02490582, 0.021983419, 0.01967796, 0.018147113, 0.017232176, 0.016522001, 0.0155018475, 0.013743143, 0.011079807, 0.00770627, 0.0041397116, 0.0010306982, -0.0011238846, -0.0022467307, -0.0027872825, -0.0035841353, -0.0055060335, -0.009014635, -0.013860091, -0.019089472, -0.023414902, -0.025804596, -0.026017483, -0.024789432, -0.023528684, -0.023632387, -0.025762705, -0.029480549, -0.03346842, -0.036253933, -0.037049275, -0.036231175, -0.035170708, -0.03548814, -0.038142774, -0.04287007, -0.04828385, -0.052583378, -0.05446749, -0.05375489, -0.051392555, -0.048884712, -0.04748605, -0.04760405, -0.04870734, -0.049741007, -0.04977978, -0.04854701, -0.046531405, -0.044670112, -0.043800894, -0.044195097, -0.045419518, -0.046584047, -0.046822086, -0.045735046, -0.04356765, -0.04104019, -0.038952343, -0.03778495, -0.037504688, -0.03764601, -0.037589837, -0.036869653, -0.03535245, -0.033235785, -0.030903561, -0.028734399, -0.026945507, -0.025513727, -0.024182804, -0.022554837, -0.020255947, -0.0171386, -0.013439898, -0.009793238, -0.0070304186, -0.005815764, -0.0062712776, -0.0078022964, -0.009263212, -0.009431615, -0.0075771585, -0.0038297712, 0.0008676725, 0.0052257087, 0.008266818, 0.009830454, 0.010645175, 0.01191236, 0.014610877, 0.018893994, 0.02391552, 0.028201956, 0.030393792, 0.02996997, 0.027563864, 0.024688529, 0.02300509, 0.023518283, 0.026125105, 0.029748863, 0.032968655, 0.034786195, 0.0351097, 0.03470937, 0.034703992, 0.035893455, 0.03831556, 0.041252755, 0.043648865, 0.04467602, 0.044136744, 0.04250778, 0.04064312, 0.03932773, 0.03892344, 0.039267484, 0.039835736, 0.040053274, 0.039584458, 0.038471747, 0.037082165, 0.03591164, 0.035350647, 0.035515413, 0.036207568, 0.037006415, 0.037446618, 0.03720679, 0.036235638, 0.034766827, 0.033212766, 0.031971518, 0.031219548, 0.030782573, 0.030161684, 0.028735178, 0.026070837, 0.022207266, 0.017744822, 0.013657004, 0.010872831, 0.009821281, 0.010182685, 0.011009376, 0.011186665, 0.010006921, 0.007544097, 0.004606974, 0.0022772239, 0.0012767775, 0.0015173873, 0.0020943808, 0.0017431226, -0.00048228938, -0.004675641, -0.009981517, -0.014989391, -0.018410519, -0.0196829, -0.019195892, -0.018034229, -0.017394679, -0.017991573, -0.019757409, -0.021974193, -0.02373712, -0.024481969, -0.024289366, -0.023815751, -0.02391127, -0.02515007, -0.027530892, -0.030495338, -0.033229247, -0.035065215, -0.035770264, -0.03558854, -0.03505314, -0.034696285, -0.034815036, -0.03539108, -0.036167245, -0.036810014, -0.037068184, -0.036865648, -0.036309984, -0.03563071, -0.03507523, -0.034795914, -0.03476705, -0.03477128, -0.034479216, -0.0336066, -0.03208528, -0.030156635, -0.028316282, -0.027107937, -0.026850723, -0.02743855, -0.028333109, -0.028782176, -0.028173778, -0.026350312, -0.023708805, -0.02101373, -0.019001251, -0.017977381, -0.017633539, -0.017198926, -0.015867496, -0.01327613, -0.009764962, -0.006256833, -0.0037997835, -0.0030104378, -0.0037233362, -0.005046814, -0.0058042966, -0.005125857, -0.0028716307, 0.00033605966, 0.003477042, 0.005684173, 0.0066791605, 0.006869222, 0.007075443, 0.00806193, 0.0101283435, 0.012974829, 0.015888812, 0.018131563, 0.019309966, 0.019545665, 0.019374019, 0.01944771, 0.020210296, 0.021703042, 0.023585394, 0.025335643, 0.026514456, 0.026958138, 0.02682026, 0.026464203, 0.02627861, 0.026510594, 0.027185688, 0.028132103, 0.029080782, 0.029790513, 0.030149497, 0.03021956, 0.030207286, 0.030366603, 0.030862542, 0.03165149, 0.032443646, 0.03279063, 0.032283295, 0.030776206, 0.028518131, 0.026096283, 0.024193397, 0.02326586, 0.0233123, 0.023870146, 0.024260234, 0.023958744, 0.022893697, 0.021493258, 0.020445054, 0.02028846, 0.021063274, 0.022217773, 0.022843508, 0.022125771, 0.019775167, 0.016207257, 0.012366197, 0.009276828, 0.0075561483, 0.0071386155, 0.007355963, 0.007322201, 0.00641208, 0.004575745, 0.0023277262, 0.00042989885, -0.000546819, -0.0005395402, -2.4267352e-05, 0.000241109, -0.00039072812, -0.0021417823, -0.0047267405, -0.0075241416, -0.00989037, -0.011447938, -0.012214395, -0.012534186, -0.012874305, -0.013596854, -0.014812042, -0.016361702, -0.017919874, -0.019152222, -0.019862594, -0.02006973, -0.019989159, -0.019932298, -0.020165844, -0.020790674, -0.021693803, -0.022599075, -0.023200156, -0.023319412, -0.023017406, -0.022592545, -0.02245725, -0.022937879, -0.024091627, -0.02563809, -0.027056517, -0.027818173, -0.027646026, -0.02666536, -0.025352899, -0.02429442, -0.023869948, -0.024038333, -0.024351109, -0.024203772, -0.023195254, -0.021394208, -0.01935148, -0.017835401, -0.017424691, -0.018180933, -0.01958549, -0.02078278, -0.021003159, -0.019940196, -0.017883513, -0.015543189, -0.01366783, -0.012664089, -0.012415725, -0.012385891, -0.011933535, -0.010666803, -0.008647123, -0.0063460865, -0.0043908763, -0.0032405858, -0.0029621278, -0.0032126151, -0.0034233525, -0.0030800619, -0.0019551553, -0.00018495739, 0.0018286164, 0.0036255813, 0.004894929, 0.0055873105, 0.0058974084, 0.006144597, 0.0066196355, 0.0074665137, 0.008641105, 0.009951425, 0.0111545585, 0.012069476, 0.012662154, 0.013068037, 0.013536907, 0.014315269, 0.015513211, 0.017020144, 0.01852182, 0.019626832, 0.020052325, 0.019777512, 0.019077977, 0.018408967, 0.018186629, 0.018578209, 0.019416884, 0.020295728, 0.020797988, 0.020740636, 0.02029299, 0.019895053, 0.020010272, 0.020844348, 0.022189153, 0.023489302, 0.024108414, 0.023658637, 0.022215197, 0.020294294, 0.018599393, 0.017668216, 0.017608901, 0.018066214, 0.01843292, 0.018187873, 0.017175715, 0.015679281, 0.014252635, 0.013413131, 0.013362589, 0.013884282, 0.014461677, 0.014545837, 0.013825934, 0.012366141, 0.010550585, 0.0088789305, 0.007724738, 0.007175446, 0.0070208968, 0.0068796193, 0.006389468, 0.005369118, 0.0038821932, 0.0021877915, 0.0006124011, -0.00059329654, -0.0013513458, -0.0017720946, -0.002089532, -0.0025486941, -0.0032938449, -0.0043041, -0.005404372, -0.0063496437, -0.0069490084, -0.0071745412, -0.007200268, -0.007342886, -0.007921232, -0.009095974, -0.010770265, -0.012610519, -0.014189114, -0.015184669, -0.015537536, -0.015473769, -0.01537725, -0.0155735, -0.016142664, -0.016869532, -0.017366009, -0.017304365, -0.01663238, -0.015644887, -0.014861408, -0.014766984, -0.015552764, -0.016998699, -0.0185673, -0.019663919, -0.019927809, -0.019400116, -0.018480781, -0.017700138, -0.017430313, -0.017692074, -0.018158227, -0.018346412, -0.017892243, -0.016753696, -0.015239443, -0.01385157, -0.01303162, -0.012945016, -0.013411406, -0.014006825, -0.014275173, -0.013937749, -0.013001327, -0.011724656, -0.010474716, -0.009551102, -0.009060946, -0.008893022, -0.008789986, -0.008476363, -0.007782441, -0.0067129554, -0.0054364456, -0.0042042965, -0.003235728, -0.0026178993, -0.0022644186, -0.0019523411, -0.001424659, -0.00051503634, 0.00076226715, 0.0022030764, 0.0034959898, 0.004364547, 0.0047035282, 0.004640559, 0.004485714, 0.0045863762, 0.0051559317, 0.0061647394, 0.0073555377, 0.008382258, 0.009002693, 0.009220118, 0.009290401, 0.009582308, 0.010362379, 0.011623973, 0.013061942, 0.014216229, 0.014711874, 0.01446471, 0.013736837, 0.013007381, 0.012726648, 0.01308687, 0.0139332935, 0.014861061, 0.0154412985, 0.015451263, 0.014985291, 0.014391756, 0.014076324, 0.014280928, 0.01495563, 0.015786497, 0.016358828, 0.016366797, 0.015761858, 0.014769025, 0.013769899, 0.013116797, 0.012971493, 0.013243389, 0.013648723, 0.013853456, 0.013626722, 0.0129339835, 0.011933859, 0.010889971, 0.01004566, 0.009520078, 0.009268295, 0.009116497, 0.008851383, 0.008322745, 0.0075154076, 0.006560157, 0.0056777466, 0.005077519, 0.004853215, 0.00492396, 0.0050529563, 0.004943168, 0.0043712733, 0.0032972624, 0.0018924943, 0.00046558297, -0.0006826815, -0.0014039057, -0.001769921, -0.002024569, -0.002441645, -0.0031643868, -0.0041159648, -0.005034802, -0.005620519, -0.0057127597, -0.0054025888, -0.0050093955, -0.004928945, -0.005430758, -0.006514209, -0.007903585, -0.009187564, -0.010029251, -0.010333586, -0.010282244, -0.010219205, -0.010452232, -0.011080467, -0.01194181, -0.012705915, -0.013058538, -0.012875055, -0.012290271, -0.011630571, -0.0112486305, -0.011349723, -0.011898109, -0.012645801, -0.013261917, -0.013492868, -0.013274377, -0.012746363, -0.012172088, -0.011807387, -0.01178413, -0.012059168, -0.012445678, -0.012705924, -0.012659803, -0.0122608915, -0.011609374, -0.010899999, -0.01033039, -0.01001054, -0.0099127935, -0.009884393, -0.0097182775, -0.009252403, -0.008453541, -0.0074454835, -0.0064640325, -0.0057543707, -0.005455798, -0.0055294526, -0.0057682535, -0.005889855, -0.0056704627, -0.0050527155, -0.004170028, -0.0032711832, -0.0025823943, -0.0021803717, -0.0019473671, -0.0016364794, -0.0010146754, -5.6747776e-06, 0.0012483372, 0.0024447176, 0.0032709353, 0.0035680772, 0.0034183336, 0.0031073943, 0.0029802923, 0.0032672612, 0.0039724945, 0.0048842905, 0.0056990236, 0.006190079, 0.006329735, 0.006299095, 0.0063829157, 0.0068084183, 0.0076161707, 0.008632006, 0.009553423, 0.010102863, 0.010166527, 0.009847823, 0.009411495, 0.009151415, 0.009251591, 0.009708713, 0.010348987, 0.010923333, 0.011228774, 0.011196767, 0.010911128, 0.010554923, 0.010317773, 0.01030871, 0.010511948, 0.010800751, 0.010999363, 0.010964621, 0.010652743, 0.01014342, 0.00960988, 0.009245081, 0.009173437, 0.009386762, 0.009736491, 0.009991502, 0.009940061, 0.009489938, 0.008716651, 0.007831535, 0.00708076, 0.006623846, 0.0064545944, 0.0064083464, 0.006254817, 0.005828678, 0.0051269745, 0.004317914, 0.0036527996, 0.0033267029, 0.0033637374, 0.0035916136, 0.0037225666, 0.0034994716, 0.0028293135, 0.0018319048, 0.0007771571, -5.549357e-05, -0.0005199005, -0.0006720067, -0.00072923605, -0.0009447136, -0.0014661282, -0.0022558896, -0.0031143308, -0.0037909828, -0.004121823, -0.0041181524, -0.003960882, -0.0039058202, -0.004152269, -0.004744155, -0.005552747, -0.006345644, -0.006902901, -0.007120428, -0.0070516807, -0.006872544, -0.006792206, -0.0069558043, -0.007383828, -0.00797212, -0.008547184, -0.008948056, -0.009097271, -0.009030906, -0.008876629, -0.008790831, -0.008882925, -0.009160486, -0.009520663, -0.009793841, -0.009822126, -0.009537886, -0.009004957, -0.008400024, -0.00793891, -0.007779759, -0.00794873, -0.008325697, -0.008699669, -0.008869104, -0.008738146, -0.008359736, -0.007902002, -0.007553729, -0.00741776, -0.007449682, -0.0074770395, -0.0072918143, -0.006768305, -0.005942388, -0.0050066602, -0.0042204754, -0.003780644, -0.0037214817, -0.0038984157, -0.0040645907, -0.003999348, -0.0036192432, -0.0030123072, -0.002378944, -0.0019141842, -0.0016973214, -0.0016492599, -0.0015791696, -0.0012926165, -0.00070070574, 0.00012883266, 0.0010044718, 0.0017078919, 0.0021025308, 0.0021975813, 0.0021372247, 0.0021245664, 0.0023217227, 0.002776194, 0.003406845, 0.004051377, 0.004547947, 0.0048102783, 0.004862463, 0.004821015, 0.004836211, 0.005021451, 0.005402321, 0.005906724, 0.0063991807, 0.006743715, 0.0068677096, 0.0067982418, 0.006653475, 0.0065908725, 0.006733835, 0.007109966, 0.0076311217, 0.008127618, 0.00842348, 0.008418532, 0.008137485, 0.007720309, 0.0073562856, 0.0071927584, 0.0072638425, 0.0074759815, 0.0076592304, 0.007659224, 0.007422425, 0.0070289704, 0.006653556, 0.0064726262, 0.0065659364, 0.00686569, 0.0071828994, 0.0072998097, 0.007080887, 0.0065432903, 0.005848314, 0.0052176523, 0.0048193075, 0.0046846275, 0.0047006034, 0.0046798033, 0.004467671, 0.0040273843, 0.0034565157, 0.0029287157, 0.0025949632, 0.002499606, 0.0025560632, 0.0025929997, 0.0024438777, 0.0020315365, 0.0014048184, 0.00071128295, 0.00012307028, -0.00024515428, -0.0003862446, -0.00039698672, -0.00042624146, -0.00060233404, -0.0009747826, -0.0014963431, -0.0020511213, -0.0025131234, -0.002806673, -0.0029407637, -0.0030024862, -0.0031136845, -0.0033713805, -0.0037993088, -0.004332672, -0.004843547, -0.0051965537, -0.0053108004, -0.0052003884, -0.0049738954, -0.0047906134, -0.004791087, -0.0050329673, -0.0054631843, -0.0059421402, -0.006310843, -0.006469308, -0.0064264447, -0.0062940735, -0.0062258765, -0.006331863, -0.0066138143, -0.0069578527, -0.0071905456, -0.0071704173, -0.0068664704, -0.0063809776, -0.005902916, -0.0056153606, -0.005604946, -0.005820665, -0.006103248, -0.006269163, -0.0062046996, -0.0059208153, -0.005540719, -0.0052281683, -0.0050958986, -0.005143711, -0.0052592433, -0.005280201, -0.0050835563, -0.0046530156, -0.0040885843, -0.0035540953, -0.0031921717, -0.003052627, -0.0030713324, -0.0031080428, -0.0030202891, -0.0027333936, -0.0022719204, -0.0017405171, -0.0012683228, -0.0009470883, -0.0007923969, -0.00074303756, -0.0006947543, -0.0005504011, -0.00026380437, 0.0001407695, 0.00058092206, 0.0009548093, 0.0011899471, 0.0012806684, 0.0012960264, 0.0013518684, 0.0015574265, 0.0019605148, 0.00251854, 0.003111824, 0.0035953629, 0.0038652257, 0.0039071376, 0.0038026199, 0.0036888747, 0.00369184, 0.0038655635, 0.0041681854, 0.0044867527, 0.004698667, 0.004738869, 0.0046381378, 0.00451156, 0.0045010694, 0.004700092, 0.0050992128, 0.005582822, 0.0059812204, 0.006153167, 0.006056322, 0.005767877, 0.0054435343, 0.005236283, 0.005218628, 0.0053500813, 0.005506549, 0.0055538956, 0.0054240217, 0.0051516127, 0.0048527825, 0.004659376, 0.004646214, 0.004790589, 0.0049841683, 0.0050888294, 0.005005734, 0.004722142, 0.0043139365, 0.0039052228, 0.003607183, 0.003466855, 0.0034496826, 0.0034620387, 0.0034005381, 0.003202989, 0.002876434, 0.0024899927, 0.0021377376, 0.0018910236, 0.0017638382, 0.0017073385, 0.0016350067, 0.0014653289, 0.0011614402, 0.0007496392, 0.0003089849, -6.292017e-05, -0.00029294833, -0.00036587619, -0.0003337095, -0.00029590537, -0.00035744556, -0.0005819024, -0.0009606693, -0.0014143985, -0.0018289163, -0.002110702, -0.0022350042, -0.0022604947, -0.0022998017, -0.0024586222, -0.0027748644, -0.0031918674, -0.0035829959, -0.0038169597, -0.0038295856, -0.003662503, -0.0034462104, -0.003335255, -0.0034297812, -0.003725421, -0.004118021, -0.0044598486, -0.0046364074, -0.0046228496, -0.0044911434, -0.0043662535, -0.004356525, -0.0044959304, -0.0047280206, -0.004938358, -0.005016697, -0.004915487, -0.0046744705, -0.004399731, -0.004209327, -0.0041742465, -0.0042846804, -0.0044575967, -0.0045800894, -0.004565293, -0.0043925797, -0.004113177, -0.003820634, -0.0036029369, -0.0035008523, -0.0034922133, -0.0035077578, -0.0034685868, -0.0033258752, -0.0030839304, -0.002796784, -0.0025411323, -0.0023788346, -0.0023261716, -0.0023436612, -0.0023512614, -0.0022629066, -0.0020257486, -0.0016466796, -0.0011932637, -0.0007669085, -0.00045888498, -0.00030887514, -0.00028618608, -0.00030421256, -0.00026281973, -9.8630626e-05, 0.00018230996, 0.0005074478, 0.00077636633, 0.00091614574, 0.0009242759, 0.0008751246, 0.00088457746, 0.0010500224, 0.0013970489, 0.00186181, 0.0023196377, 0.0026458364, 0.0027770642, 0.0027411045, 0.0026396536, 0.0025938204, 0.0026816747, 0.0029007378, 0.0031742165, 0.0033960403, 0.0034894699, 0.0034478786, 0.0033369495, 0.0032585852, 0.0032967282, 0.0034737482, 0.003739394, 0.00399675, 0.0041507874, 0.0041544503, 0.0040295958, 0.0038535811, 0.003719578, 0.0036911317, 0.0037732853, 0.0039134375, 0.00403003, 0.0040537766, 0.003960837, 0.003782262, 0.0035862408, 0.0034429312, 0.0033895667, 0.003412661, 0.0034554, 0.0034461848, 0.003334458, 0.0031167655, 0.002840608, 0.002583869, 0.0024189013, 0.002377743, 0.0024349948, 0.0025172532, 0.0025357234, 0.0024272806, 0.0021843708, 0.0018586925, 0.0015359918, 0.00129374, 0.0011626404, 0.0011117018, 0.0010651235, 0.00094300415, 0.0007052517, 0.00037577155, 3.360112e-05, -0.00022553669, -0.00033829204, -0.00030827557, -0.00020778635, -0.00014470762, -0.00021053423, -0.000435691, -0.0007751661, -0.0011322008, -0.0014080108, -0.0015516628, -0.0015839294, -0.001582732, -0.0016384242, -0.0018034293, -0.0020635817, -0.0023463417, -0.0025607026, -0.0026465314, -0.0026066368, -0.0025050724, -0.0024337887, -0.0024662185, -0.0026220465, -0.0028601338, -0.003101273, -0.0032676596, -0.0033189773, -0.003268286, -0.0031717543, -0.003098873, -0.0030983116, -0.0031756815, -0.0032931746, -0.0033904843, -0.003416349, -0.0033550796, -0.0032349378, -0.0031141697, -0.0030516111, -0.0030765254, -0.003172701, -0.003284691, -0.0033431102, -0.003296773, -0.0031365103, -0.0028998086, -0.0026544074, -0.0024683771, -0.0023799846, -0.002380744, -0.002419604, -0.0024271798, -0.0023497224, -0.002176971, -0.0019494175, -0.0017394008, -0.0016136037, -0.0015954849, -0.0016482697, -0.0016897509, -0.0016332489, -0.0014338016, -0.0011142732, -0.0007560676, -0.00045847442, -0.00028832722, -0.0002472336, -0.00027378096, -0.0002786146, -0.00019246283, -1.0224537e-06, 0.0002510348, 0.00048729288, 0.00064201426, 0.00069488725, 0.0006806734, 0.0006701422, 0.00073321623, 0.00090339885, 0.0011609882, 0.0014427651, 0.0016728246, 0.0017991646, 0.0018181421, 0.0017750501, 0.0017409037, 0.0017772844, 0.001906894, 0.002104304, 0.002310863, 0.0024653613, 0.0025343543, 0.0025269308, 0.0024873596, 0.002470561, 0.0025136133, 0.002617573, 0.002747895, 0.0028522734, 0.002886639, 0.002836886, 0.0027264731, 0.0026067034, 0.0025341313, 0.0025450918, 0.002638672, 0.0027760132, 0.002896844, 0.0029463363, 0.002900164, 0.0027757331, 0.00262347, 0.0025015431, 0.002445987, 0.002451373, 0.002472726, 0.0024489209, 0.0023363763, 0.0021355224, 0.001895191, 0.0016909824, 0.0015875336, 0.0016040007, 0.0017014552, 0.001799998, 0.0018176347, 0.00171091, 0.0014958306, 0.0012379122, 0.0010167963, 0.0008845973, 0.00084029476, 0.0008333805, 0.0007938277, 0.00067138363, 0.00046284232, 0.00021327741, -8.359357e-06, -0.00014547887, -0.00018276667, -0.000153418, -0.00012206682, -0.0001529391, -0.00027936415, -0.0004891583, -0.0007320383, -0.0009445518, -0.0010800689, -0.0011295866, -0.001123951, -0.0011171348, -0.001159159, -0.0012719515, -0.001439705, -0.001618033, -0.0017569797, -0.0018262721, -0.001830342, -0.0018059063, -0.0018035402, -0.0018624141, -0.0019904932, -0.0021597014, -0.002318349, -0.0024149786, -0.0024224597, -0.0023510002, -0.0022438283, -0.0021573415, -0.0021349117, -0.00218678, -0.0022858754, -0.002381872, -0.0024268362, -0.0023997875, -0.0023176454, -0.0022265837, -0.0021776978, -0.0021991509, -0.002279247, -0.002369773, -0.0024088065, -0.002352045, -0.0021968065, -0.0019859213, -0.0017885708, -0.0016669591, -0.0016454771, -0.0016984176, -0.0017631829, -0.001772679, -0.0016901492, -0.0015279349, -0.0013399349, -0.0011916942, -0.0011243538, -0.0011321569, -0.0011657203, -0.001159005, -0.0010649539, -0.0008803984, -0.00064728974, -0.00043054702, -0.0002851579, -0.00022994993, -0.00024071724, -0.00026457163, -0.00024676244, -0.00015611513, 2.6059336e-06, 0.00019381732, 0.00036982217, 0.00049363845, 0.00055552233, 0.00057615945, 0.00059554545, 0.00065285346, 0.00076665595, 0.000924941, 0.0010900935, 0.0012169662, 0.0012755478, 0.0012669669, 0.0012244391, 0.0011981489, 0.0012312748, 0.0013390593, 0.0015014245, 0.0016728054, 0.0018042091, 0.0018664601, 0.0018631961, 0.0018274437, 0.0018037767, 0.0018250972, 0.0018956221, 0.0019885888, 0.0020599954, 0.0020717578, 0.0020127743, 0.0019070193, 0.001803866, 0.0017546668, 0.0017868747, 0.0018888817, 0.00201392, 0.0021019164, 0.0021087907, 0.0020283565, 0.0018952735, 0.0017670795, 0.0016943133, 0.0016942687, 0.0017422994, 0.0017854314, 0.001771126, 0.0016758144, 0.001517878, 0.0013481532, 0.0012232106, 0.0011758878, 0.0011987549, 0.0012488558, 0.0012704558, 0.0012231829, 0.0011008598, 0.0009321569, 0.0007642043, 0.000638773, 0.00057330675, 0.00055532093, 0.0005512904, 0.00052430044, 0.00045153237, 0.00033383083, 0.00019382061, 6.412353e-05, -2.8754446e-05, -7.7588185e-05, -9.8521414e-05, -0.00012374739, -0.0001856844, -0.00030000703, -0.0004561584, -0.00062081334, -0.00075330207, -0.000825523, -0.000836093, -0.00081124797, -0.0007919504, -0.0008139109, -0.000890752, -0.0010085602, -0.0011339895, -0.0012313658, -0.0012802697, -0.0012853579, -0.0012740567, -0.0012832094, -0.0013405924, -0.0014497103, -0.001585427, -0.0017036663, -0.0017618884, -0.0017410171, -0.0016573691, -0.0015570093, -0.0014938074, -0.0015018706, -0.0015773027, -0.0016800687, -0.0017557712, -0.001765565, -0.0017073273, -0.001616016, -0.0015431785, -0.0015275964, -0.0015738301, -0.001650324, -0.0017072031, -0.0017030246, -0.0016257024, -0.0014972076, -0.0013610837, -0.0012605729, -0.0012187929, -0.0012299573, -0.0012643985, -0.0012837095, -0.0012584607, -0.0011806794, -0.0010660881, -0.0009455953, -0.0008500906, -0.00079553307, -0.0007753616, -0.00076404697, -0.0007303057, -0.0006535492, -0.00053520134, -0.00039887452, -0.0002790477, -0.00020388603, -0.00018094141, -0.00019298587, -0.00020600746, -0.00018527466, -0.00011152128, 1.0477613e-05, 0.00015474841, 0.00028668935, 0.00037924462, 0.0004251087, 0.0004393807, 0.00045152003, 0.0004903806, 0.00056939735, 0.00067916355, 0.00079141057, 0.0008730084, 0.00090345246, 0.0008869886, 0.00085257343, 0.0008407077, 0.00088311284, 0.0009855878, 0.0011234812, 0.0012530221, 0.0013332592, 0.0013471929, 0.0013105625, 0.001263131, 0.001246927, 0.0012833122, 0.0013616002, 0.0014455399, 0.0014939168, 0.001483618, 0.0014223203, 0.0013440801, 0.0012907938, 0.0012900982, 0.0013416115, 0.0014181815, 0.0014804472, 0.0014963738, 0.0014557953, 0.001373544, 0.0012808783, 0.0012102681, 0.0011808716, 0.001190892, 0.0012195605, 0.0012374034, 0.0012201493, 0.0011601503, 0.0010700902, 0.0009769665, 0.00090879924, 0.0008803023, 0.00088475086, 0.00089656503, 0.00088375306, 0.00082409504, 0.00071676745, 0.0005833632, 0.00045777348, 0.0003701289, 0.00033285917, 0.00033556318, 0.0003507769, 0.0003474338, 0.00030541504, 0.00022443185, 0.00012331444, 3.0181733e-05, -3.1919986e-05, -5.7133188e-05, -6.0616334e-05, -7.165023e-05, -0.00011877492, -0.00021411038, -0.00034517885, -0.0004793142, -0.0005792933, -0.0006224525, -0.0006130025, -0.00058041245, -0.00056421786, -0.00059327023, -0.0006707863, -0.0007734441, -0.0008649135, -0.0009161338, -0.00092102983, -0.0008991811, -0.000884413, -0.0009059945, -0.00097280135, -0.0010686868, -0.0011609563, -0.001216976, -0.0012201715, -0.0011776021, -0.0011159619, -0.0010685928, -0.0010600674, -0.0010955192, -0.0011592578, -0.0012228135, -0.0012583968, -0.0012515511, -0.0012073119, -0.0011471788, -0.0010983932, -0.0010805856, -0.001096183, -0.0011292892, -0.0011537076, -0.0011462354, -0.0010986035, -0.0010219904, -0.0009417422, -0.00088492257, -0.00086698605, -0.000884243, -0.00091573683, -0.00093334634, -0.00091493345, -0.00085415615, -0.00076254096, -0.0006633159, -0.00058029924, -0.00052712543, -0.00050162064, -0.0004876856, -0.00046373127, -0.0004138338, -0.00033641903, -0.00024609186, -0.00016713401, -0.00012121649, -0.00011520011, -0.00013561115, -0.00015356649, -0.00013856286, -7.43697e-05, 3.161615e-05, 0.00015123065, 0.00024973892, 0.00030396343, 0.0003143675, 0.00030426035, 0.00030649442, 0.00034511933, 0.000422259, 0.0005173827, 0.0005990544, 0.00064235675, 0.0006423729, 0.0006166939, 0.0005961047, 0.0006087713, 0.0006661978, 0.00075777754, 0.000856137, 0.0009302346, 0.0009597883, 0.0009443485, 0.0009030182, 0.000865123, 0.0008562265, 0.00088605355, 0.0009441194, 0.0010053223, 0.0010429021, 0.0010423174, 0.0010088463, 0.0009647603, 0.0009373778, 0.0009442857, 0.0009836825, 0.0010350685, 0.0010698516, 0.0010660538, 0.0010192671, 0.00094434747, 0.0008675342, 0.0008136544, 0.0007950993, 0.0008076125, 0.000833984, 0.00085292134, 0.0008485371, 0.0008164358, 0.00076442276, 0.00070812734, 0.0006635504, 0.0006394893, 0.00063295837, 0.0006299115, 0.00061161234, 0.00056427385, 0.00048733925, 0.00039560188, 0.0003130286, 0.00026069517, 0.00024511854, 0.0002538332, 0.00026143773, 0.00024332525, 0.00018949994, 0.00011041089, 3.115735e-05, -2.2803164e-05, -4.0285067e-05, -3.0969615e-05, -2.0278869e-05, -3.5551646e-05, -9.129955e-05, -0.00018151152, -0.00028279785, -0.00036625526, -0.00041160843, -0.00041652273, -0.0003969018, -0.00037862392, -0.0003851314, -0.00042684775, -0.0004971454, -0.00057634147, -0.0006414986, -0.00067725894, -0.00068261113, -0.0006705215, -0.0006608202, -0.0006699956, -0.0007030082, -0.00075113797, -0.00079678226, -0.0008226306, -0.0008205418, -0.00079575845, -0.00076452334, -0.00074640044, -0.000755031, -0.0007916352, -0.0008441855, -0.0008925915, -0.00091758335, -0.00090934656, -0.0008719924, -0.00082168984, -0.00077910523, -0.00075953326, -0.0007654458, -0.0007852979, -0.0007994924, -0.0007907381, -0.0007535412, -0.00069772184, -0.00064379, -0.0006123117, -0.0006127487, -0.0006377587, -0.00066620135, -0.00067351444, -0.00064415525, -0.0005796126, -0.00049775443, -0.0004237998, -0.00037758864, -0.00036374648, -0.00036980052, -0.0003731261, -0.00035300423, -0.00030146117, -0.0002272903, -0.00015129286, -9.537297e-05, -7.1253104e-05, -7.4633375e-05, -8.7647335e-05, -8.811174e-05, -6.0643888e-05, -3.9692154e-06, 6.907282e-05, 0.00013846916, 0.00018711646, 0.00020891264, 0.00021102489, 0.00020959285, 0.00022134697, 0.0002554122, 0.0003092023, 0.00037014866, 0.00042218732, 0.0004537638, 0.00046351578, 0.00046094204, 0.00046171402, 0.00047980994, 0.0005202334, 0.00057595567, 0.0006308241, 0.0006672776, 0.00067517103, 0.00065719744, 0.0006279209, 0.0006066825, 0.00060794764, 0.0006341633, 0.0006749204, 0.0007127973, 0.0007326118, 0.0007290426, 0.0007086836, 0.0006858202, 0.000674594, 0.00068183936, 0.0007040406, 0.0007294026, 0.00074353267, 0.00073594245, 0.0007047213, 0.00065773237, 0.0006098868, 0.0005772316, 0.00056979514, 0.0005861495, 0.000612729, 0.000629323, 0.0006190116, 0.0005776898, 0.0005174825, 0.00046106352, 0.00042915103, 0.00042811473, 0.00044538194, 0.00045610187, 0.000437631, 0.00038324142, 0.00030659288, 0.00023409659, 0.00018979628, 0.00018193247, 0.00019905073, 0.00021739882, 0.00021455473, 0.00018104287, 0.00012374617, 6.03399e-05, 9.0211415e-06, -2.0423498e-05, -3.0051893e-05, -3.1161762e-05, -3.8025853e-05, -6.1279985e-05, -0.00010354065, -0.0001585016, -0.00021358866, -0.00025527607, -0.00027520032, -0.0002744941, -0.0002640017, -0.00025967948, -0.00027500757, -0.00031418915, -0.00036986108, -0.0004267259, -0.00046922298, -0.00048910466, -0.00048895704, -0.000480108, -0.00047642915, -0.0004874658, -0.00051423325, -0.00054931623, -0.00058077276, -0.00059782946, -0.00059588614, -0.00057878846, -0.0005573903, -0.0005448387, -0.00055045215, -0.00057495176, -0.00060953776, -0.0006396594, -0.00065194006, -0.0006408545, -0.0006116195, -0.0005776168, -0.00055357005, -0.0005480054, -0.00055892585, -0.0005749294, -0.00058117387, -0.00056715007, -0.00053234707, -0.00048692568, -0.0004469107, -0.00042609414, -0.00042860527, -0.0004460625, -0.0004611784, -0.00045641162, -0.0004233443, -0.000367639, -0.00030651133, -0.00025976368, -0.00023925971, -0.0002428295, -0.00025608556, -0.00026091037, -0.00024542093, -0.00020956981, -0.00016356054, -0.00012082569, -9.0362315e-05, -7.289353e-05, -6.224076e-05, -4.990362e-05, -2.9491079e-05, 1.1647583e-06, 4.0135583e-05, 8.2410894e-05, 0.00012094676, 0.00014819024, 0.00015888434, 0.00015367127, 0.00014117635, 0.00013591061, 0.00015154232, 0.00019268328, 0.00025052318, 0.0003061871, 0.00034094564, 0.0003474508, 0.0003347116, 0.00032305662, 0.00033178143, 0.0003671688, 0.00041854047, 0.00046482836, 0.00048734082, 0.00048057773, 0.00045459668, 0.0004281763, 0.0004177802, 0.0004292953, 0.00045683596, 0.0004879459, 0.00051090936, 0.0005197322, 0.00051501463, 0.00050189666, 0.00048733392, 0.0004779712, 0.00047839436, 0.000489251, 0.00050582644, 0.0005187312, 0.0005177983, 0.0004979842, 0.00046374768, 0.00042828554, 0.0004068746, 0.00040772837, 0.00042615994, 0.0004463478, 0.00045025325, 0.0004283862, 0.00038560433, 0.00033817865, 0.00030397504, 0.00029198124, 0.00029763154, 0.00030644305, 0.00030317638, 0.0002806032, 0.00024280176, 0.0002017422, 0.00016997707, 0.00015400251, 0.00015167109, 0.00015422607, 0.00015109437, 0.00013475378, 0.000103676044, 6.260968e-05, 2.048723e-05, -1.31764455e-05, -3.2174103e-05, -3.634371e-05, -3.187926e-05, -2.8779168e-05, -3.634945e-05, -5.8831876e-05, -9.33718e-05, -0.00013142789, -0.00016294522, -0.0001812081, -0.0001860376, -0.00018391554, -0.00018507773, -0.00019887046, -0.0002292938, -0.00027261546, -0.0003183029, -0.00035332635, -0.00036831875, -0.0003627445, -0.00034606672, -0.00033352672, -0.00033811518, -0.00036298015, -0.00039894698, -0.00042924, -0.00043914586, -0.00042498347, -0.0003967697, -0.000372678, -0.00036850956, -0.00038856466, -0.0004233817, -0.0004554376, -0.00046903334, -0.00045838417, -0.00042959081, -0.00039622348, -0.00037185068, -0.00036385638, -0.00037123103, -0.00038636598, -0.00039908415, -0.00040090852, -0.0003882577, -0.00036386272, -0.00033589825, -0.00031464515, -0.00030750845, -0.00031459035, -0.00032757342, -0.00033338377, -0.0003212716, -0.00028935962, -0.00024642024, -0.00020729864, -0.0001844644, -0.00018086184, -0.00018853431, -0.00019377006, -0.00018530797, -0.00016036065, -0.00012500188, -8.939543e-05, -6.155178e-05, -4.3657747e-05, -3.2626693e-05, -2.3432378e-05, -1.2322217e-05, 2.059083e-06, 1.9434565e-05, 3.8914495e-05, 5.902677e-05, 7.710444e-05, 8.949427e-05, 9.351093e-05, 9.0244255e-05, 8.5881846e-05, 8.9643065e-05, 0.00010873651, 0.00014329891, 0.00018496937, 0.0002207553, 0.00024033093, 0.00024231873, 0.00023538919, 0.00023316749, 0.00024592524, 0.0002741901, 0.00030826335, 0.00033394058, 0.00034090062, 0.00032869517, 0.0003069029, 0.00028962333, 0.00028775132, 0.00030346776, 0.00032975242, 0.00035470136, 0.00036790676, 0.00036543625, 0.00035112424, 0.0003340027, 0.00032352988, 0.00032503347, 0.00033738578, 0.00035378092, 0.00036513113, 0.0003645101, 0.00035059243, 0.00032840448, 0.0003068912, 0.00029439307, 0.00029433038, 0.0003034403, 0.00031360245, 0.00031626312, 0.000306936, 0.00028722573, 0.0002633602, 0.000242352, 0.00022823681, 0.00022053345, 0.00021544257, 0.00020856257, 0.0001972262, 0.00018125378, 0.00016224958, 0.00014244509, 0.00012395409, 0.00010850722, 9.7155964e-05, 8.963836e-05, 8.382505e-05, 7.608944e-05, 6.297725e-05, 4.343433e-05, 2.0040063e-05, -1.9655026e-06, -1.7628145e-05, -2.5437013e-05, -2.8534323e-05, -3.298497e-05, -4.408198e-05, -6.302923e-05, -8.6124186e-05, -0.0001069334, -0.00012007353, -0.00012432884, -0.00012340267, -0.0001240607, -0.00013277466, -0.00015252369, -0.00018113144, -0.00021180707, -0.00023577045, -0.0002460877, -0.00024119206, -0.00022632285, -0.00021171395, -0.00020789467, -0.00022026793, -0.00024600056, -0.00027530926, -0.00029672484, -0.00030337612, -0.00029653162, -0.00028428945, -0.00027638683, -0.00027851868, -0.00028964094, -0.0003035284, -0.00031302616, -0.00031399578, -0.00030673263, -0.0002947353, -0.00028238478, -0.0002732002, -0.00026918505, -0.00027066784, -0.00027601048, -0.0002814388, -0.0002819086, -0.0002734171, -0.00025574878, -0.00023361846, -0.00021474925, -0.00020549538, -0.0002066802, -0.00021261365, -0.00021429532, -0.00020490513, -0.0001839981, -0.00015766121, -0.00013466438, -0.00012129241, -0.00011818326, -0.00012081807, -0.00012273756, -0.00011902786, -0.000108038956, -9.099003e-05, -7.05536e-05, -4.967227e-05, -3.098379e-05, -1.6399592e-05, -6.43279e-06, 3.796283e-07, 7.115145e-06, 1.6794182e-05, 3.02129e-05, 4.4907683e-05, 5.640289e-05, 6.127806e-05, 6.0042716e-05, 5.7632406e-05, 6.0839535e-05, 7.414713e-05, 9.66632e-05, 0.00012223424, 0.00014277297, 0.00015279191, 0.00015243927, 0.00014733605, 0.00014543551, 0.00015273811, 0.0001701478, 0.0001930068, 0.00021345408, 0.00022442681, 0.00022337369, 0.00021382778, 0.00020390036, 0.00020223386, 0.0002133659, 0.0002350058, 0.00025889577, 0.00027498367, 0.00027665764, 0.00026407436, 0.00024373193, 0.00022473333, 0.00021414095, 0.00021412855, 0.00022217479, 0.00023346802, 0.00024352624, 0.000249492, 0.0002500291, 0.00024487413, 0.00023495944, 0.00022290365, 0.00021276211, 0.00020825649, 0.0002101363, 0.00021461755, 0.00021467055, 0.00020408507, 0.00018197352, 0.00015450029, 0.0001320863, 0.00012334125, 0.0001294496, 0.00014281264, 0.0001511788, 0.00014491004, 0.00012285952, 9.309676e-05, 6.7964094e-05, 5.656054e-05, 5.9361733e-05, 6.827337e-05, 7.1936964e-05, 6.283021e-05, 4.1703464e-05, 1.6723165e-05, -1.9068119e-06, -8.308726e-06, -4.317341e-06, 2.006758e-06, 1.5100295e-06, -1.0652387e-05, -3.2610726e-05, -5.749922e-05, -7.779692e-05, -8.938827e-05, -9.303746e-05, -9.2929e-05, -9.377216e-05, -9.848706e-05, -0.00010757033, -0.00011981327, -0.00013327328, -0.00014574091, -0.00015486447, -0.00015862241, -0.00015643901, -0.0001503103, -0.00014478837, -0.00014520813, -0.0001548478, -0.00017275912, -0.00019384774, -0.00021139937, -0.00022059794, -0.00022088594, -0.00021579233, -0.00021051407, -0.00020888569, -0.00021152564, -0.00021597558, -0.00021838727, -0.000215632, -0.00020684548, -0.00019396264, -0.00018120042, -0.00017358371, -0.0001747729, -0.0001848925, -0.0001995388, -0.00021103852, -0.00021196662, -0.00019934613, -0.0001769909, -0.0001541028, -0.00014041924, -0.0001405802, -0.00015122363, -0.00016281843, -0.000165261, -0.00015379422, -0.00013158213, -0.000107465035, -9.0509646e-05, -8.485856e-05, -8.7898385e-05, -9.242924e-05, -9.10495e-05, -7.9969235e-05, -6.0326605e-05, -3.6894595e-05, -1.5477419e-05, -5.4120017e-07, 6.0707257e-06, 5.3178287e-06, 3.763668e-07, -4.4690037e-06, -5.319817e-06, -2.159043e-07, 9.917573e-06, 2.1608363e-05, 3.057916e-05, 3.413331e-05, 3.286249e-05, 3.0602525e-05, 3.254437e-05, 4.2499487e-05, 6.0813025e-05, 8.4023755e-05, 0.00010638595, 0.00012241887, 0.00012923704, 0.00012764453, 0.00012160732, 0.00011640815, 0.00011629436, 0.0001226346, 0.00013343687, 0.00014453335, 0.00015193634, 0.00015416546, 0.00015319434, 0.00015331185, 0.00015839959, 0.00016919804, 0.00018232453, 0.00019185909, 0.00019273242, 0.00018392755, 0.00016948786, 0.0001565918, 0.00015174077, 0.00015726997, 0.00017019226, 0.00018396149, 0.00019202202, 0.00019106461, 0.00018225658, 0.00017002922, 0.00015939584, 0.00015341392, 0.0001520426, 0.00015268331, 0.00015179995, 0.00014667008, 0.000136528, 0.00012280558, 0.00010852907, 9.710943e-05, 9.088388e-05, 8.992574e-05, 9.172681e-05, 9.2142436e-05, 8.738665e-05, 7.614274e-05, 6.0536197e-05, 4.5187564e-05, 3.468611e-05, 3.091553e-05, 3.192146e-05, 3.3132e-05, 3.0229454e-05, 2.1845688e-05, 1.0336541e-05, 1.7105958e-07, -4.932848e-06, -4.2113297e-06, -4.8448776e-08, 3.725017e-06, 4.0591794e-06, -7.791896e-08, -7.998521e-06, -1.8432553e-05, -3.03114e-05, -4.260083e-05, -5.3683652e-05, -6.1369574e-05, -6.408691e-05, -6.257944e-05, -6.057447e-05, -6.3290296e-05, -7.420921e-05, -9.2135764e-05, -0.00011085927, -0.00012226752, -0.000121370766, -0.000110062225, -9.686896e-05, -9.236109e-05, -0.00010278223, -0.00012586935, -0.0001516802, -0.00016816484, -0.00016817222, -0.0001535838, -0.00013401988, -0.000120964156, -0.00012099883, -0.00013230393, -0.00014639381, -0.00015372099, -0.00014946879, -0.0001360118, -0.000120890654, -0.00011202122, -0.00011333106, -0.0001232806, -0.00013655183, -0.0001472323, -0.00015136352, -0.00014777269, -0.0001375633, -0.00012329189, -0.00010838699, -9.651057e-05, -9.035086e-05, -9.0070695e-05, -9.25686e-05, -9.271828e-05, -8.6456515e-05, -7.3880175e-05, -5.992199e-05, -5.1542596e-05, -5.2939366e-05, -6.2080784e-05, -7.1311246e-05, -7.198483e-05, -6.007103e-05, -3.8791703e-05, -1.6416465e-05, -8.7013024e-07, 4.915397e-06, 3.7170548e-06, 7.653738e-07, -5.1038916e-07, -2.932291e-07, -6.518253e-07, -2.2939996e-06, -3.0281942e-06, 5.3165104e-07, 9.558514e-06, 2.11599e-05, 3.0110403e-05, 3.3016393e-05, 3.139699e-05, 3.0798416e-05, 3.6322614e-05, 4.814082e-05, 6.0880015e-05, 6.7749475e-05, 6.6296314e-05, 6.106777e-05, 6.0700164e-05, 7.1375136e-05, 9.163701e-05, 0.00011271889, 0.00012436009, 0.00012187719, 0.00010929448, 9.635967e-05, 9.184443e-05, 9.80948e-05, 0.000110506495, 0.0001216924, 0.000126762, 0.00012583092, 0.00012252029, 0.00012039758, 0.00012049542, 0.000121563964, 0.00012214351, 0.00012216595, 0.00012261611, 0.0001238283, 0.00012431687, 0.00012150284, 0.000113884686, 0.000102795064, 9.2123584e-05, 8.6025626e-05, 8.6250795e-05, 9.0996924e-05, 9.600769e-05, 9.704098e-05, 9.207536e-05, 8.208485e-05, 7.028867e-05, 6.056322e-05, 5.5801305e-05, 5.672122e-05, 6.1439925e-05, 6.609392e-05, 6.6563596e-05, 6.0712664e-05, 4.9870745e-05, 3.8328308e-05, 3.074437e-05, 2.8970193e-05, 3.0571664e-05, 3.0397934e-05, 2.434343e-05, 1.2624015e-05, 3.2660483e-09, -7.4197737e-06, -6.6048533e-06, 1.1993268e-07, 6.58774e-06, 7.013452e-06, -2.4740248e-07, -1.2077257e-05, -2.3265917e-05, -3.0141071e-05, -3.237511e-05, -3.19935e-05, -3.1022162e-05, -3.013383e-05, -2.9380079e-05, -2.9888579e-05, -3.4344066e-05, -4.5186356e-05, -6.178235e-05, -7.922325e-05, -9.0445996e-05, -9.069596e-05, -8.114802e-05, -6.874446e-05, -6.199065e-05, -6.552988e-05, -7.734158e-05, -9.051138e-05, -9.815994e-05, -9.788808e-05, -9.266538e-05, -8.7904635e-05, -8.7264074e-05, -9.038482e-05, -9.396588e-05, -9.489785e-05, -9.275881e-05, -8.979622e-05, -8.871709e-05, -9.032639e-05, -9.297938e-05, -9.416738e-05, -9.2781025e-05, -9.0112895e-05, -8.876415e-05, -9.034089e-05, -9.379139e-05, -9.574776e-05, -9.273e-05, -8.36949e-05, -7.113686e-05, -5.9910035e-05, -5.4442353e-05, -5.6059594e-05, -6.209145e-05, -6.735451e-05, -6.7162604e-05, -6.0063237e-05, -4.861852e-05, -3.7709884e-05, -3.139097e-05, -3.0290226e-05, -3.1289772e-05, -2.975528e-05, -2.285558e-05, -1.16838155e-05, -6.4038863e-07, 5.5598766e-06, 5.1554625e-06, 5.095392e-07, -3.6996337e-06, -3.9450765e-06, -3.7171017e-07, 3.5573887e-06, 4.0380346e-06, 2.2890646e-07, -4.726293e-06, -5.849822e-06, -8.3140286e-08, 1.1230969e-05, 2.3109427e-05, 3.0453975e-05, 3.173147e-05, 3.0038378e-05, 3.0726973e-05, 3.7352464e-05, 4.8955528e-05, 6.068276e-05, 6.7251756e-05, 6.667601e-05, 6.152602e-05, 5.687656e-05, 5.654163e-05, 6.0411956e-05, 6.483042e-05, 6.566836e-05, 6.1783074e-05, 5.6264216e-05, 5.447211e-05, 6.017146e-05, 7.2451316e-05, 8.565102e-05, 9.252208e-05, 8.869354e-05, 7.560159e-05, 5.997131e-05, 5.0089428e-05, 5.1104656e-05, 6.218146e-05, 7.716506e-05, 8.8248256e-05, 9.033677e-05, 8.350254e-05, 7.224127e-05, 6.2307365e-05, 5.7331185e-05, 5.7326513e-05, 5.9720624e-05, 6.1772575e-05, 6.243471e-05, 6.23777e-05, 6.246618e-05, 6.221054e-05, 5.96792e-05, 5.3084466e-05, 4.27744e-05, 3.187213e-05, 2.4744138e-05, 2.4165338e-05, 2.917936e-05, 3.5312707e-05, 3.718334e-05, 3.1824486e-05, 2.0496998e-05, 7.79887e-06, -1.2606566e-06, -4.216357e-06, -2.2309525e-06, 1.1995689e-06, 2.8067416e-06, 1.5564052e-06, -1.1238284e-06, -2.787253e-06, -1.9019437e-06, 1.0337006e-06, 3.7752598e-06, 3.6556262e-06, -9.2953974e-07, -9.650174e-06, -2.0304948e-05, -2.9705781e-05, -3.502249e-05, -3.5101184e-05, -3.119861e-05, -2.6653935e-05, -2.5412872e-05, -2.9979654e-05, -3.9909304e-05, -5.1866486e-05, -6.141843e-05, -6.556833e-05, -6.441537e-05, -6.081713e-05, -5.8290712e-05, -5.8652346e-05, -6.107843e-05, -6.31807e-05, -6.3142026e-05, -6.117492e-05, -5.9177495e-05, -5.897564e-05, -6.0705468e-05, -6.273306e-05, -6.3158455e-05, -6.1560124e-05, -5.94108e-05, -5.8756737e-05, -6.0311224e-05, -6.269585e-05, -6.360617e-05, -6.195993e-05, -5.910426e-05, -5.7843277e-05, -5.9909584e-05, -6.39775e-05, -6.6073815e-05, -6.235949e-05, -5.223359e-05, -3.9258448e-05, -2.89986e-05, -2.5284975e-05, -2.7707612e-05, -3.2224983e-05, -3.4361103e-05, -3.2476994e-05, -2.8630062e-05, -2.651045e-05, -2.8237206e-05, -3.2574822e-05, -3.5854126e-05, -3.4691457e-05, -2.830297e-05, -1.8761502e-05, -9.3194585e-06, -2.3577443e-06, 1.5040737e-06, 2.8590775e-06, 2.4849503e-06, 9.27222e-07, -1.1445138e-06, -2.5947243e-06, -2.2649078e-06, -1.776663e-08, 2.6858015e-06, 3.5692278e-06, 1.3676311e-06, -2.7571884e-06, -5.5884025e-06, -3.985556e-06, 2.8081904e-06, 1.255831e-05, 2.1664258e-05, 2.7679143e-05, 3.0632913e-05, 3.2152162e-05, 3.3365464e-05, 3.369193e-05, 3.1769338e-05, 2.7680722e-05, 2.4195157e-05, 2.5385858e-05, 3.332358e-05, 4.5555204e-05, 5.586113e-05, 5.8278834e-05, 5.156594e-05, 4.0576146e-05, 3.3206707e-05, 3.5003424e-05, 4.5410146e-05, 5.842912e-05, 6.70632e-05, 6.8071895e-05, 6.354409e-05, 5.8487174e-05, 5.6754267e-05, 5.863525e-05, 6.166988e-05, 6.3396e-05, 6.331641e-05, 6.246271e-05, 6.1384286e-05, 5.8879777e-05, 5.296901e-05, 4.3293636e-05, 3.2542346e-05, 2.5183226e-05, 2.4214556e-05, 2.8625649e-05, 3.3913377e-05, 3.549014e-05, 3.2276894e-05, 2.745904e-05, 2.567216e-05, 2.8888284e-05, 3.4429006e-05, 3.681819e-05, 3.202165e-05, 2.0659032e-05, 7.641139e-06, -1.3856517e-06, -3.8914454e-06, -1.6625702e-06, 1.2757864e-06, 1.9976017e-06, 4.9911824e-07, -1.1759357e-06, -1.3005508e-06, -2.9821837e-08, 1.0872353e-06, 8.7681605e-07, -2.8545068e-07, -1.0104719e-06, -4.7624306e-07, 6.4971334e-07, 9.460684e-07, -1.0446482e-07, -1.3149858e-06, -8.940773e-07, 1.408201e-06, 3.2094333e-06, 8.541846e-07, -7.5628022e-06, -2.0019836e-05, -3.13433e-05, -3.6669127e-05, -3.496164e-05, -2.9709885e-05, -2.6138254e-05, -2.7150854e-05, -3.1316373e-05, -3.450508e-05, -3.3707525e-05, -2.972011e-05, -2.6377702e-05, -2.7020216e-05, -3.131951e-05, -3.5341553e-05, -3.4948796e-05, -2.9707344e-05, -2.3884391e-05, -2.3452154e-05, -3.1337895e-05, -4.4703032e-05, -5.650087e-05, -6.02051e-05, -5.4153392e-05, -4.2345815e-05, -3.1354917e-05, -2.5902364e-05, -2.6370133e-05, -2.9677478e-05, -3.2262706e-05, -3.257206e-05, -3.135397e-05, -3.014151e-05, -2.9682633e-05, -2.969314e-05, -2.9765959e-05, -3.013752e-05, -3.1320247e-05, -3.29533e-05, -3.3214183e-05, -2.9747811e-05, -2.1619164e-05, -1.0641802e-05, -7.2472034e-07, 4.5322827e-06, 4.2297875e-06, 6.668248e-07, -2.4656952e-06, -2.7678218e-06, -5.957221e-07, 1.7280424e-06, 2.1312749e-06, 5.114058e-07, -1.4114032e-06, -1.8090145e-06, -4.1422624e-07, 1.3283043e-06, 1.6885182e-06, 3.0488607e-07, -1.4583302e-06, -1.7878702e-06, -1.8442779e-07, 1.9109184e-06, 2.2917063e-06, 5.4214055e-08, -3.191957e-06, -4.1030194e-06, 8.4099526e-08, 9.416545e-06, 2.0903544e-05, 3.028898e-05, 3.465119e-05, 3.4005872e-05, 3.089472e-05, 2.8429391e-05, 2.8284318e-05, 2.9990164e-05, 3.1796902e-05, 3.2241624e-05, 3.1194544e-05, 2.9724279e-05, 2.9080997e-05, 2.9694314e-05, 3.0938736e-05, 3.174343e-05, 3.148131e-05, 3.042878e-05, 2.9484532e-05, 2.9421763e-05, 3.0277726e-05, 3.1342493e-05, 3.1734595e-05, 3.1108288e-05, 2.994445e-05, 2.9192634e-05, 2.9523162e-05, 3.075702e-05, 3.1934946e-05, 3.2024633e-05, 3.0769777e-05, 2.9025341e-05, 2.8246619e-05, 2.9405004e-05, 3.206532e-05, 3.4325345e-05, 3.3774835e-05, 2.893525e-05, 2.0277033e-05, 1.0143685e-05, 1.5947281e-06, -3.1448963e-06, -3.7167915e-06, -1.5839868e-06, 9.760532e-07, 2.1752946e-06, 1.549471e-06, -8.378289e-08, -1.3951513e-06, -1.4908838e-06, -4.4673575e-07, 8.5356345e-07, 1.4082673e-06, 8.259794e-07, -4.0654538e-07, -1.3020021e-06, -1.1307545e-06, -4.92679e-09, 1.1728006e-06, 1.4025304e-06, 4.1755783e-07, -1.0216955e-06, -1.6789376e-06, -8.7157315e-07, 8.500235e-07, 2.0195703e-06, 1.442193e-06, -6.5940384e-07, -2.5685304e-06, -2.3378743e-06, 4.5171384e-07, 3.8481e-06, 4.470804e-06, -2.2906013e-07, -9.980881e-06, -2.152414e-05, -3.052383e-05, -3.4266774e-05, -3.320495e-05, -3.0265819e-05, -2.8543895e-05, -2.9185005e-05, -3.102244e-05, -3.2048636e-05, -3.1334937e-05, -2.97547e-05, -2.8997298e-05, -2.987905e-05, -3.1540658e-05, -3.227362e-05, -3.120315e-05, -2.9234863e-05, -2.8308055e-05, -2.9555496e-05, -3.205665e-05, -3.345647e-05, -3.2081512e-05, -2.8728073e-05, -2.6370835e-05, -2.7725993e-05, -3.2549044e-05, -3.7057758e-05, -3.635172e-05, -2.8255025e-05, -1.5617212e-05, -5.018885e-06, -2.480533e-06, -9.155858e-06, -2.0206113e-05, -2.7834203e-05, -2.6429414e-05, -1.6214048e-05, -2.8692814e-06, 6.4742253e-06, 7.941836e-06, 3.0367023e-06, -3.0739209e-06, -5.560423e-06, -3.1843624e-06, 1.4168064e-06, 4.279188e-06, 3.311271e-06, -3.041177e-07, -3.3757035e-06, -3.4167335e-06, -5.831075e-07, 2.6212856e-06, 3.500355e-06, 1.3766196e-06, -1.9095244e-06, -3.5620408e-06, -2.1550889e-06, 1.1676925e-06, 3.6019915e-06, 2.9917003e-06, -3.1679838e-07, -3.6206923e-06, -3.9941256e-06, -7.760908e-07, 3.6188985e-06, 5.393262e-06, 2.4322003e-06, -3.597616e-06, -7.915031e-06, -5.8540686e-06, 3.5580772e-06, 1.6355474e-05, 2.5859505e-05, 2.7015863e-05, 1.985994e-05, 9.636717e-06, 3.4301324e-06, 5.6209155e-06, 1.5281934e-05, 2.717251e-05, 3.541572e-05, 3.715674e-05, 3.376594e-05, 2.9131043e-05, 2.6675169e-05, 2.7375652e-05, 2.9925619e-05, 3.2366923e-05, 3.354527e-05, 3.3273947e-05, 3.148913e-05, 2.7609984e-05, 2.0973064e-05, 1.1990388e-05, 2.7835233e-06, -3.6356832e-06, -5.2707555e-06, -2.657295e-06, 1.3530075e-06, 3.537733e-06, 2.5306213e-06, -4.059828e-07, -2.6422724e-06, -2.4050826e-06, -1.3942106e-07, 2.0469156e-06, 2.2821027e-06, 5.0494356e-07, -1.5996286e-06, -2.1629307e-06, -7.7225684e-07, 1.2392827e-06, 2.0486252e-06, 9.801435e-07, -9.352497e-07, -1.9400434e-06, -1.1506239e-06, 6.6939987e-07, 1.8378364e-06, 1.2981567e-06, -4.292978e-07, -1.7424483e-06, -1.433598e-06, 2.0508413e-07, 1.6541198e-06, 1.566291e-06, 1.2305522e-08, -1.5728979e-06, -1.7055306e-06, -2.3254012e-07, 1.4986473e-06, 1.8620601e-06, 4.6751958e-07, -1.4310684e-06, -2.05026e-06, -7.3399224e-07, 1.3697163e-06, 2.292232e-06, 1.0587622e-06, -1.3140229e-06, -2.6268347e-06, -1.4908644e-06, 1.2633224e-06, 3.1332715e-06, 2.135473e-06, -1.2168757e-06, -4.0075424e-06, -3.274855e-06, 1.1738973e-06, 5.9138756e-06, 6.0334564e-06, -1.1335811e-06, -1.3498594e-05, -2.501417e-05, -2.9422452e-05, -2.434485e-05, -1.2791665e-05, -1.0577589e-06, 5.403329e-06, 5.17022e-06, 1.0207573e-06, -2.6865212e-06, -3.2277032e-06, -9.83468e-07, 1.5928707e-06, 2.3178202e-06, 9.4532345e-07, -9.995598e-07, -1.7767676e-06, -9.058548e-07, 6.262302e-07, 1.4093912e-06, 8.647014e-07, -3.6989144e-07, -1.1377855e-06, -8.216167e-07, 1.8397554e-07, 9.248859e-07, 7.7647053e-07, -4.445745e-08, -7.5094437e-07, -7.292479e-07, -6.225587e-08, 6.0459297e-07, 6.8004454e-07, 1.4441203e-07, -4.7892206e-07, -6.290591e-07, -2.0731204e-07, 3.6956507e-07, 5.7658326e-07, 2.5454494e-07, -2.736815e-07, -5.2298907e-07, -2.8866748e-07, 1.8937924e-07, 4.687146e-07, 3.1159857e-07, -1.1536722e-07, -4.1424835e-07, -3.248569e-07, 5.073726e-08, 3.60113e-07, 3.297084e-07, 5.1787237e-09, -3.068486e-07, -3.272584e-07, -5.290414e-08, 2.5499622e-07, 3.1850942e-07, 9.2882985e-08, -2.0508216e-07, -3.0439617e-07, -1.2552422e-07, 1.5760334e-07, 2.858059e-07, 1.5123187e-07, -1.1301414e-07, -2.635881e-07, -1.7042429e-07, 7.1715064e-08, 2.3855782e-07, 1.8354557e-07, -3.40434e-08, -2.114941e-07, -1.9107087e-07, 2.6611746e-10, 1.831358e-07, 1.9350715e-07, 2.9424978e-08, -1.5417562e-07, -1.913901e-07, -5.4915713e-08, 1.2525369e-07, 1.8527874e-07, 7.616985e-08, -9.6951034e-08, -1.757478e-07, -9.3227115e-08, 6.978374e-08, 1.6337899e-07, 1.0619938e-07, -4.4198256e-08, -1.487516e-07, -1.1526498e-07, 2.0567878e-08, 1.324328e-07, 1.2066161e-07, 8.091896e-10, -1.1496831e-07, -1.2267797e-07, -1.97102e-08, 9.687355e-08, 1.2164459e-07, 3.598662e-08, -7.862581e-08, -1.1792393e-07, -4.9561347e-08, 6.065748e-08, 1.1190043e-07, 6.042448e-08, -4.3350656e-08, -1.039704e-07, -6.8627905e-08, 2.7033147e-08, 9.4532375e-08, 7.427865e-08, -1.1975996e-08, -8.397799e-08, -7.753165e-08, -1.6075651e-09, 7.268361e-08, 7.858162e-08, 1.356164e-08, -6.100307e-08, -7.765487e-08, -2.3785947e-08, 4.9261327e-08, 7.500076e-08, 3.2232794e-08, -3.7749572e-08, -7.088354e-08, -3.8903096e-08, 2.6721352e-08, 6.557418e-08, 4.3841407e-08, -1.6390185e-08, -5.934316e-08, -4.7130413e-08, 6.928247e-09, 5.245355e-08, 4.8884846e-08, 1.533625e-09, -4.5155193e-08, -4.9245195e-08, -8.904966e-09, 3.7679595e-08, 4.8371305e-08, 1.5133633e-08, -3.0235977e-08, -4.643613e-08, -2.020304e-08, 2.3008154e-08, 4.3619718e-08, 2.412863e-08, -1.6152528e-08, -4.0103654e-08, -2.6953893e-08, 9.796986e-09, 3.606601e-08, 2.8746005e-08, -4.040709e-09, -3.1676944e-08, -2.9591275e-08, -1.0451976e-09, 2.7094995e-08, 2.9590577e-08, 5.4163616e-09, -2.2464095e-08, -2.8854835e-08, -9.053191e-09, 1.7911333e-08, 2.7500757e-08, 1.19584405e-08, -1.354546e-08, -2.5646878e-08, -1.4154405e-08, 9.456077e-09, 2.3410013e-08, 1.5679902e-08, -5.713482e-09, -2.0902137e-08, -1.6587054e-08, 2.3691151e-09, 1.8227855e-08, 1.6938193e-08, 5.4355315e-10, -1.5482296e-08, -1.6802677e-08, -3.0076241e-09, 1.2749643e-08, 1.6254056e-08, 5.0211435e-09, -1.0102068e-08, -1.5367286e-08, -6.595139e-09, 7.599274e-09, 1.4216447e-08, 7.751601e-09, -5.2883604e-09, -1.2872575e-08, -8.521303e-09, 3.2041987e-09, 1.14020695e-08, 8.941723e-09, -1.3700253e-09, -9.865255e-09, -9.054944e-09, -2.015732e-10, 8.315516e-09, 8.905781e-09, 1.5075875e-09, -6.7985715e-09, -8.5399865e-09, -2.55325e-09, 5.352282e-09, 8.002761e-09, 3.3507197e-09, -4.0065564e-09, -7.337408e-09, -3.917663e-09, 2.783647e-09, 6.5842953e-09, 4.2758908e-09, -1.6985963e-09, -5.7800333e-09, -4.4500506e-09, 7.5985734e-10, 4.9569002e-09, 4.4664143e-09, 2.9956385e-11, -4.1424886e-09, -4.3517976e-09, -6.7324435e-10, 3.3595633e-09, 4.1326134e-09, 1.1765497e-09, -2.6260956e-09, -3.83409e-09, -1.5496849e-09, 1.9554534e-09, 3.4796432e-09, 1.8048819e-09, -1.3567178e-09, -3.0904095e-09, -1.9559938e-09, 8.3509216e-10, 2.6849276e-09, 2.017767e-09, -3.9237977e-10, -2.2789637e-09, -2.0052038e-09, 2.7500344e-11, 1.8854445e-09, 1.9329929e-09, 2.6296984e-10, -1.5145419e-09, -1.8151243e-09, -4.842957e-10, 1.1737644e-09, 1.6644462e-09, 6.4303973e-10, -8.682242e-10, -1.4925261e-09, -7.466452e-10, 6.008401e-10, 1.3093815e-09, 8.029741e-10, -3.7268857e-10, -1.1235118e-09, -8.199957e-10, 1.8325474e-10, 9.417822e-10, 8.054411e-10, -3.080222e-11, -7.6958384e-10, -7.666132e-10, -8.7384024e-11, 6.1082467e-10, 7.1016254e-10, 1.7465916e-10, -4.681683e-10, -6.4201156e-10, -2.348126e-10, 3.4310169e-10, 5.6724475e-10, 2.7180838e-10, -2.3617405e-10, -4.9011234e-10, -2.896252e-10, 1.4712145e-10, 4.1401965e-10, 2.920859e-10, -7.5074856e-11, -3.415858e-10, -2.8274913e-10, 1.8709518e-11, 2.7470234e-10, 2.648263e-10, 2.3606563e-11, -2.1461409e-10, -2.4112934e-10, -5.368183e-11, 1.620094e-10, 2.1404517e-10, 7.338997e-11, -1.1711472e-10, -1.8553274e-10, -8.457919e-11, 7.978837e-11, 1.571387e-10, 8.900171e-11, -4.9609896e-11, -1.3002682e-10};
+#include "BlockNoise.hpp"
+#include "ModalBodyData.hpp"
+#include "BodyIR.hpp"
+#include "FastMath.hpp"
 
 namespace dsp {
 
@@ -26,18 +21,26 @@ MEM_BSS_ITCM static Body::Frame framez1_{};
 MEM_BSS_SRAMD1 static Body::Frame framez2_{};
 static Body::Frame framez3_{};
 
-static audiofft::AudioFFT<Body::kFFTSize> fft;
+// twiddle在编译期生成
+constinit static audiofft::AudioFFT<Body::kFFTSize> fft;
 MEM_BSS_SRAMD1 static Body::GainFrame bodyFrame0;
 MEM_BSS_SRAMD1 static Body::GainFrame bodyFrame1;
 MEM_BSS_SRAMD1 static Body::GainFrame bodyFrame2;
 MEM_BSS_SRAMD1 static Body::GainFrame bodyFrame3;
+// commuted激励在LCD任务中重建, 双缓冲, 写完后再切换
+MEM_BSS_SRAMD1 static CommutedExciter commuted[2];
+static std::atomic<uint32_t> commutedFront;
+static std::atomic<bool> commutedDirty;
+static std::atomic<uint32_t> commutedBody;
+static std::atomic<float> commutedStretch;
+static float commutedGain;
 static Body::GainFrame* bodyFrameArray[] {
     &bodyFrame0,
     &bodyFrame1,
     &bodyFrame2,
     &bodyFrame3,
 };
-void Body::DoBodyFFT(const float* irPtr) {
+void Body::DoBodyFFT(const BodyIR& ir) {
     // float real[Body::kNumBins];
     // float imag[Body::kNumBins];
     float tempBuffer[Body::kFFTSize];
@@ -48,8 +51,9 @@ void Body::DoBodyFFT(const float* irPtr) {
     uint32_t bodyWrite = 0;
     float energy = 0.0f;
 
-    for (;phase < 4096.0f && bodyWrite < 4;) {
-        auto s = irPtr[static_cast<int32_t>(phase)];
+    // 拉伸时直接从int16解码, 不需要单独的float缓冲
+    for (;phase < static_cast<float>(BodyIR::kSize) && bodyWrite < 4;) {
+        auto s = ir[static_cast<uint32_t>(phase)];
         tempBuffer[writePos++] = s;
         energy += s * s;
         phase += phaseInc;
@@ -63,13 +67,13 @@ void Body::DoBodyFFT(const float* irPtr) {
     
     if (bodyWrite < 4) {
         std::fill(tempBuffer + writePos, tempBuffer + Body::kFFTSize, 0.0f);
-        auto bodyFrame = *bodyFrameArray[bodyWrite];
+        auto& bodyFrame = *bodyFrameArray[bodyWrite];
         fft.fft(tempBuffer, bodyFrame.real_.data(), bodyFrame.imag_.data());
         ++bodyWrite;
     }
     
-    for (int32_t i = bodyWrite; i < 4; ++i) {
-        auto bodyFrame = *bodyFrameArray[bodyWrite];
+    for (uint32_t i = bodyWrite; i < 4; ++i) {
+        auto& bodyFrame = *bodyFrameArray[i];
         std::fill(bodyFrame.real_.begin(), bodyFrame.real_.end(), 0.0f);
         std::fill(bodyFrame.imag_.begin(), bodyFrame.imag_.end(), 0.0f);
     }
@@ -84,11 +88,76 @@ void Body::DoBodyFFT(const float* irPtr) {
     }
 }
 
+void Body::BuildCommutedExciter(CommutedExciter& e, const BodyIR& ir, float stretch) {
+    // 和 DoBodyFFT 相同的拉伸和能量归一化
+    float phase = 0.0f;
+    const float phaseInc = 1.0f / stretch;
+    uint32_t len = 0;
+    float energy = 0.0f;
+    for (; phase < static_cast<float>(BodyIR::kSize) && len < CommutedExciter::kMaxLen; phase += phaseInc) {
+        auto s = ir[static_cast<uint32_t>(phase)];
+        e.step[len++] = s;
+        energy += s * s;
+    }
+    const float gain = 1.0f / std::sqrt(energy);
+    for (uint32_t i = 0; i < len; ++i) {
+        e.step[i] *= gain;
+    }
+
+    // 噪声burst固定长度, 不随音高变化, PluckString 按周期长度补偿能量
+    float burst[CommutedExciter::kBurstLen];
+    BlockNoise noise;
+    noise.SetSeed(0);
+    noise.Fill(burst);
+    std::fill_n(e.noise, len + CommutedExciter::kBurstLen, 0.0f);
+    for (uint32_t i = 0; i < len; ++i) {
+        float s = e.step[i];
+        for (uint32_t j = 0; j < CommutedExciter::kBurstLen; ++j) {
+            e.noise[i + j] += s * burst[j];
+        }
+    }
+
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < len; ++i) {
+        sum += e.step[i];
+        e.step[i] = sum;
+    }
+    e.len = len;
+}
+
+void Body::RebuildCommutedIfDirty() {
+    if (!commutedDirty.exchange(false, std::memory_order_acquire)) return;
+    const uint32_t back = 1 - commutedFront.load(std::memory_order_relaxed);
+    BuildCommutedExciter(commuted[back], kBodyIRs[commutedBody.load(std::memory_order_relaxed)],
+                         commutedStretch.load(std::memory_order_relaxed));
+    // DAC任务只在NoteOn时取front, 之前开始的音符还在读另一个缓冲
+    commutedFront.store(back, std::memory_order_release);
+}
+
+const CommutedExciter& Body::GetCommutedExciter() {
+    return commuted[commutedFront.load(std::memory_order_acquire)];
+}
+
+float Body::GetCommutedGain() {
+    return commutedGain;
+}
+
+void Body::SetWetGain(float wet) {
+    WetGain_ = fastmath::Pow10(wet / 20.0f);
+    // 和卷积输出相同的 1 / (kFFTSize / kBlockSize)
+    commutedGain = WetGain_ / (kFFTSize / kBlockSize);
+}
+
 void Body::Init(float sampleRate) {
 }
 
 void Body::Process(std::span<float> buffer, std::span<float> auxBuffer) {
     if (!processing_) return;
+    if (modal_) {
+        // 和卷积输出相同的 1 / (kFFTSize / kBlockSize)
+        modalBody_.Process(buffer, WetGain_ / (kFFTSize / kBlockSize));
+        return;
+    }
 
     std::copy(buffer.begin(), buffer.end(), inputBuffer_.begin() + numInput_);
     numInput_ += buffer.size();
@@ -122,13 +191,18 @@ void Body::Process(std::span<float> buffer, std::span<float> auxBuffer) {
             output.real_[i] += framez1_.real_[i] * bodyFrame1.real_[i] - framez1_.imag_[i] * bodyFrame1.imag_[i];
             output.imag_[i] += framez1_.real_[i] * bodyFrame1.imag_[i] + framez1_.imag_[i] * bodyFrame1.real_[i];
         }
-        for (uint32_t i = 0; i < kNumBins; i++) {
-            output.real_[i] += framez2_.real_[i] * bodyFrame2.real_[i] - framez2_.imag_[i] * bodyFrame2.imag_[i];
-            output.imag_[i] += framez2_.real_[i] * bodyFrame2.imag_[i] + framez2_.imag_[i] * bodyFrame2.real_[i];
+        // 降级时丢掉IR尾部的分段
+        if (numPartitions_ > 2) {
+            for (uint32_t i = 0; i < kNumBins; i++) {
+                output.real_[i] += framez2_.real_[i] * bodyFrame2.real_[i] - framez2_.imag_[i] * bodyFrame2.imag_[i];
+                output.imag_[i] += framez2_.real_[i] * bodyFrame2.imag_[i] + framez2_.imag_[i] * bodyFrame2.real_[i];
+            }
         }
-        for (uint32_t i = 0; i < kNumBins; i++) {
-            output.real_[i] += framez3_.real_[i] * bodyFrame3.real_[i] - framez3_.imag_[i] * bodyFrame3.imag_[i];
-            output.imag_[i] += framez3_.real_[i] * bodyFrame3.imag_[i] + framez3_.imag_[i] * bodyFrame3.real_[i];
+        if (numPartitions_ > 3) {
+            for (uint32_t i = 0; i < kNumBins; i++) {
+                output.real_[i] += framez3_.real_[i] * bodyFrame3.real_[i] - framez3_.imag_[i] * bodyFrame3.imag_[i];
+                output.imag_[i] += framez3_.real_[i] * bodyFrame3.imag_[i] + framez3_.imag_[i] * bodyFrame3.real_[i];
+            }
         }
 
         // get ifft output, 2048 samlpes
@@ -168,38 +242,30 @@ void Body::Process(std::span<float> buffer, std::span<float> auxBuffer) {
     }
 }
 
+void Body::SetNumPartitions(uint32_t num) {
+    numPartitions_ = std::clamp(num, 2u, kNumPartitions);
+    modalBody_.SetMaxModes(ModalBody::kMaxModes * numPartitions_ / kNumPartitions);
+}
+
+void Body::SetModal(bool modal) {
+    if (modal && !modal_) {
+        modalBody_.Reset();
+    }
+    modal_ = modal;
+}
+
+void Body::SetEnabled(bool enabled) {
+    processing_ = enabled;
+    UpdateSpectrum();
+}
+
 void Body::SetBodyType(BodyEnum type) {
     body_ = type;
-    switch (type) {
-    case BodyEnum::Banjo:
-        DoBodyFFT(kBanjo);
-        break;
-    case BodyEnum::Calcani:
-        DoBodyFFT(kCalcani);
-        break;
-    case BodyEnum::Guitar:
-        DoBodyFFT(kGuitar);
-        break;
-    case BodyEnum::Klotz:
-        DoBodyFFT(kKlotz);
-        break;
-    case BodyEnum::Langhof:
-        DoBodyFFT(kLanghof);
-        break;
-    case BodyEnum::Banjo2:
-        DoBodyFFT(kBanjo2);
-        break;
-    case BodyEnum::Dobro:
-        DoBodyFFT(kDobro);
-        break;
-    case BodyEnum::Volin:
-        DoBodyFFT(kViola);
-        break;
-    case BodyEnum::Guzheng:
-        DoBodyFFT(kGuzheng);
-        break;
-    default:
-        break;
+    if (type < BodyEnum::kCount) {
+        static_assert(std::size(kModalBodies) == kNumBodys);
+        modalBody_.SetModes(kModalBodies[static_cast<uint32_t>(type)], stretch_);
+        spectrumDirty_ = true;
+        UpdateSpectrum();
     }
 }
 
@@ -207,4 +273,15 @@ void Body::SetStretch(float stretch) {
     stretch_ = stretch;
     SetBodyType(body_);
 }
+
+void Body::UpdateSpectrum() {
+    // 琴体关闭时不做FFT, 开机默认关闭, 启动时不需要计算
+    if (!processing_ || !spectrumDirty_) return;
+    spectrumDirty_ = false;
+    DoBodyFFT(kBodyIRs[static_cast<uint32_t>(body_)]);
+    // commuted激励要对IR做卷积, 放到LCD任务中
+    commutedBody.store(static_cast<uint32_t>(body_), std::memory_order_relaxed);
+    commutedStretch.store(stretch_, std::memory_order_relaxed);
+    commutedDirty.store(true, std::memory_order_release);
+}
 }
\ No newline at end of file
@@ -4,14 +4,19 @@
 #include <cstdint>
 #include <cmath>
 #include "params.hpp"
+#include "ExciterBank.hpp"
+#include "ModalBody.hpp"
 
 namespace dsp {
 
+struct BodyIR;
+
 class Body {
 public:
     static constexpr uint32_t kFFTSize = 2048;
     static constexpr uint32_t kBlockSize = 1024;
     static constexpr uint32_t kNumBins = kFFTSize / 2 + 1;
+    static constexpr uint32_t kNumPartitions = 4;
 
     static constexpr uint32_t kNumBodys = 9;
 
@@ -34,20 +39,38 @@ public:
     void Init(float sampleRate);
     void Process(std::span<float> buffer, std::span<float> auxBuffer);
 
-    void SetEnabled(bool enabled) { processing_ = enabled; }
+    // 开启时才计算琴体的频谱和commuted激励
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return processing_; }
+    // 用拟合的模态代替卷积, 没有延迟
+    void SetModal(bool modal);
     void SetBodyType(BodyEnum type);
-    void SetWetGain(float wet) { WetGain_ = std::pow(10.0f, wet / 20.0f); }
+    void SetWetGain(float wet);
     void SetStretch(float stretch);
+    // 只用前num段IR, governor降级用
+    void SetNumPartitions(uint32_t num);
+    // 当前琴体和拉伸下的commuted激励, 在DAC任务的NoteOn中取
+    static const CommutedExciter& GetCommutedExciter();
+    // commuted激励的输出增益, 包含wet gain
+    static float GetCommutedGain();
+    // 在LCD任务中调用, 琴体或者拉伸改变后重建commuted激励
+    static void RebuildCommutedIfDirty();
 private:
-    void DoBodyFFT(const float* irPtr);
+    static void BuildCommutedExciter(CommutedExciter& e, const BodyIR& ir, float stretch);
+    void DoBodyFFT(const BodyIR& ir);
+    void UpdateSpectrum();
 
     uint32_t numInput_{};
     uint32_t writeEnd_{};
     uint32_t writeAddBegin_{};
     bool processing_{};
+    bool spectrumDirty_{};
+    bool modal_{};
+    ModalBody modalBody_;
     float WetGain_{};
     float stretch_{ 1.0f };
-    BodyEnum body_;
+    uint32_t numPartitions_{ kNumPartitions };
+    BodyEnum body_{};
 };
 
 }
\ No newline at end of file
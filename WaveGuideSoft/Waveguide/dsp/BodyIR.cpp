@@ -0,0 +1,1208 @@
+// 由 pctest/src/tools/BodyPack 生成, 不要手动修改
+#include "BodyIR.hpp"
+#include <iterator>
+
+namespace dsp {
+
+static constexpr float kBanjoScale = 2.56603162e-05f;
+static constexpr int16_t kBanjo[BodyIR::kSize] = {
+    32767,-9788,-14927,-233,-10546,31,-286,467,-484,1814,2200,548,2857,-2083,1119,-413,62,1690,-1274,601,2421,996,-3275,245,391,-2021,1292,799,-174,1945,1277,-1711,
+    -853,-1816,-3009,-1085,638,119,-1281,-1414,-3599,-3421,-1380,-1690,-2545,-1718,-4184,-7774,-4851,-5038,-6661,-5950,-6335,-5061,-2714,-2343,-4423,-4446,-4827,-3756,-1751,-2735,-1440,-1339,
+    -735,1008,915,1428,660,1510,3666,4279,3004,1580,2175,2571,3363,5420,8205,7604,6105,6232,4661,6358,8703,9439,10197,10783,12413,11370,8732,6166,4929,4860,4527,3939,
+    2851,4979,6823,5534,3077,916,468,-592,-1179,-1845,-2766,-2146,-2867,-4953,-6870,-8022,-8190,-8233,-8206,-8817,-7404,-4610,-4905,-5683,-6639,-6863,-5867,-5097,-5122,-6208,-4254,-4459,
+    -5021,-3868,-3757,-221,-319,76,1043,-770,1090,297,238,559,-773,-821,-1252,1756,2870,971,8,-88,656,388,1689,1831,1109,3291,2261,110,1051,1378,1357,-44,
+    -307,1305,743,1468,783,-501,1449,1441,502,773,427,68,1180,1432,1703,2365,1322,298,-1612,-1810,-1364,-1200,352,116,519,495,-1,268,-78,305,239,-448,
+    -927,236,1145,579,186,241,615,670,1569,971,-27,1142,2626,2854,1204,946,1525,895,-49,107,1062,2033,2385,1082,951,492,-108,484,-240,127,1070,606,
+    249,-79,-943,-934,-1346,-3010,-3532,-2533,-1297,-977,-640,-1158,-1980,-1729,-1405,-1468,-1690,-1743,-3200,-3626,-3098,-2624,-1765,-1448,-496,-527,-111,-421,-859,-505,-951,293,
+    -345,0,1331,899,1286,265,495,769,-167,763,2246,2601,2059,1835,1034,815,1368,1021,635,345,-29,86,116,468,971,-163,-193,841,184,4,1380,652,
+    -940,-170,-904,-1244,-1020,-1804,-1206,-894,89,-318,-1018,-23,552,1575,746,-338,-735,-1332,-1010,-523,548,700,-238,-858,-467,581,1148,1723,1768,1474,1295,732,
+    824,1091,590,99,-963,-240,1480,710,1757,2336,125,95,376,-67,110,589,1136,743,498,400,-816,-751,-159,-1024,-31,1271,373,178,309,-600,-1203,-1875,
+    -1788,-127,-343,-1355,-1459,-1541,-1559,-1773,-603,-239,-1152,-1642,-2009,-1754,-1751,-1289,-1336,-659,782,-46,-297,-267,-845,-548,-253,-798,-1200,-108,534,622,976,-23,
+    -494,261,184,606,1361,1201,1210,1572,1196,830,1199,480,184,657,374,282,568,610,128,1046,1306,823,889,-532,-244,58,-786,-209,154,195,101,-148,
+    -809,-1032,-1193,-1268,-29,161,-11,-255,-1266,-661,-345,-1578,-1397,-619,-163,398,-286,14,1301,249,-498,326,303,98,-73,122,763,633,645,206,163,1204,
+    1079,870,1169,813,39,219,448,215,692,393,312,581,58,125,392,317,-195,36,720,-100,-527,-336,-847,-476,-428,-912,-422,-772,-333,122,-887,-567,
+    -496,-238,138,-310,-325,-589,-239,-572,-744,-345,-737,-234,-296,36,142,-48,1145,435,-300,-324,-535,313,-52,-696,-142,-522,-643,427,22,124,1223,559,
+    340,511,-133,-95,-133,-421,-156,-290,-158,-67,-521,365,972,458,50,-444,-737,-115,671,-61,-190,279,-390,-640,-578,-54,64,-516,-477,-268,196,61,
+    287,504,-370,171,366,-186,183,476,332,-202,-254,-97,137,422,875,1323,765,398,441,552,893,974,84,-93,307,-266,522,506,-210,637,808,736,
+    728,680,335,-236,-330,-561,-565,-176,-161,249,480,-173,228,-331,-937,-85,-560,-533,33,-321,-556,-59,-234,-402,-263,-1038,-464,-507,-485,203,-457,-135,
+    51,-211,-366,-235,-449,-721,-335,-934,-340,420,200,417,138,-487,-566,-111,-141,118,-49,-447,55,122,375,452,-331,-663,11,241,188,407,75,272,
+    284,-432,-322,219,161,-114,-155,105,324,201,539,362,-401,82,332,-502,-473,-327,61,304,-715,245,352,-422,-126,-1039,106,17,-575,683,18,67,
+    14,-272,-179,-163,-249,-541,45,-187,378,256,-332,143,-330,374,377,106,157,-148,312,173,851,667,134,515,89,487,362,-97,549,734,293,326,
+    618,403,357,-57,-554,-323,-100,-16,160,678,521,50,-135,-389,-178,-595,-398,473,-234,-671,-422,-575,-737,-405,-163,-232,-157,-350,-30,76,-454,-529,
+    -840,-1076,-373,241,271,-139,-1041,-361,55,-548,20,-275,214,787,109,-25,-292,71,141,11,158,291,436,144,370,477,297,-617,-644,518,447,920,
+    1026,320,113,91,467,142,-424,-259,283,207,-167,228,304,379,431,3,-45,-374,-386,-15,-466,-418,257,355,31,-224,-235,-233,-320,-769,-855,-90,
+    -129,-231,462,349,164,45,-457,-370,-237,42,168,-325,-124,273,143,35,-75,-264,105,552,-56,-204,174,101,140,-133,-50,-80,-288,-116,-237,310,
+    310,198,624,422,576,388,124,-115,-247,76,-173,-283,-331,-207,152,410,477,484,551,-126,-322,22,238,201,-510,-503,-271,-252,117,-131,-164,128,
+    -80,171,299,437,360,-280,-48,-223,-448,-157,-214,-186,110,584,165,-70,-43,-115,155,-336,-422,43,494,398,3,106,-83,-7,62,160,142,-132,
+    60,13,192,390,133,-41,151,238,-122,178,348,-47,-195,-309,-228,-206,40,357,245,345,163,-26,107,-306,-348,44,-187,-154,125,-205,-58,312,
+    1,-226,-158,110,77,-251,-325,-38,468,282,-257,-294,-66,25,-112,-162,62,145,-27,-5,-181,-90,160,109,313,23,40,338,108,80,-74,-46,
+    13,-78,24,79,68,178,177,-114,67,-182,-350,182,160,284,-48,-240,138,-240,-247,66,-148,-213,103,21,-8,-117,-345,37,-40,166,254,-342,
+    -276,-256,-261,-185,-181,71,360,235,19,-70,-357,49,-23,-375,247,-23,-305,104,187,272,155,-82,-44,287,234,-75,46,179,252,-105,-272,190,
+    163,177,267,16,172,373,-152,-372,282,459,265,141,-8,329,474,-96,-367,-248,-248,-139,-133,-52,-42,28,236,-7,156,76,-169,-71,-471,-461,
+    -110,28,-171,-329,-150,-252,-357,-396,-237,13,-67,-83,-56,-96,140,118,-168,-59,-241,-421,-25,192,-8,-187,-340,-212,263,216,194,404,392,69,
+    -245,6,-70,-214,-87,19,-161,-78,723,323,-48,121,-345,53,253,82,245,-203,57,278,-75,210,-203,-190,40,-406,196,308,18,298,170,-104,
+    -39,-36,-120,71,-71,134,100,-215,66,-9,297,287,-71,-112,-181,123,333,355,-63,-127,73,33,304,324,27,-292,-48,-11,-27,33,-273,63,
+    -112,-286,72,252,273,-28,118,112,54,-62,-308,-90,-160,-114,54,-102,-64,188,0,-18,240,-38,28,-49,-201,-76,-353,-180,69,23,-61,-94,
+    0,-169,-70,67,11,43,-160,-96,28,-65,91,39,-187,-115,-106,-140,199,-16,-230,276,59,38,189,-20,126,-7,-29,-63,48,227,-2,-27,
+    -187,-67,158,130,161,-49,-82,114,75,-24,-52,-267,-191,-18,-99,20,37,78,78,-97,-111,-117,-111,77,161,30,-5,-147,-127,-87,-173,73,
+    36,126,331,53,-53,-131,-13,214,26,38,12,-108,77,129,142,100,-40,-111,-155,-21,162,247,181,108,124,214,162,-123,-109,-23,60,142,
+    -23,94,144,-131,-124,-57,-121,-97,-30,66,38,-67,-34,27,4,-148,-88,-21,-155,-77,-141,-219,-78,-60,74,128,-55,-25,-49,-22,192,-39,
+    -192,-19,6,10,-9,-6,0,-43,-39,12,31,79,167,73,-43,-96,-86,97,244,170,75,151,178,65,-34,28,115,104,146,130,137,169,
+    57,53,60,-67,-31,12,-6,125,68,-50,-28,-98,39,103,-40,19,-82,-41,86,-147,-160,-70,-29,-67,-89,9,-161,-26,115,-37,-1,-192,
+    -210,26,53,109,157,23,-66,-9,-77,4,69,-118,-139,-44,93,114,18,-83,-58,62,-19,-74,-118,-44,116,70,19,-76,-130,-59,4,-67,
+    -113,-60,-101,-29,33,11,14,53,83,-15,2,-2,-70,-49,-26,2,-38,27,69,-40,6,75,7,21,69,7,55,111,-22,-109,-2,102,
+    81,68,45,58,57,26,51,17,79,79,5,47,41,105,110,33,36,-9,-124,-107,12,-15,38,80,41,49,5,24,-9,-89,-65,7,
+    -62,-67,-42,-143,-22,0,53,49,-89,20,-49,-49,-28,-62,13,22,7,-96,-93,-111,42,169,-1,-35,-121,-25,84,38,67,-28,-36,42,
+    79,-2,-31,36,11,-21,-56,57,92,78,174,73,38,7,-80,-7,3,12,7,-42,19,22,-47,-18,10,-18,41,89,40,-15,-97,-112,
+    -20,-17,-99,-92,-57,-40,-7,-23,-16,44,28,-14,4,-19,-37,-35,-38,-49,-75,-23,-8,13,-9,-56,35,10,25,86,9,7,12,-7,
+    10,-27,-47,-13,-23,24,49,31,83,18,-4,63,29,-7,18,91,70,-56,-22,11,-25,116,81,-20,44,-24,-65,-49,40,71,-16,22,
+    24,0,5,-8,-55,-96,-129,-122,6,37,-9,-39,-13,-25,-69,41,71,10,-55,-73,-50,-15,11,-66,-14,11,-28,15,18,19,-32,-26,
+    -3,17,53,33,42,-14,-21,-21,-28,37,23,47,11,-48,6,-8,35,78,-5,-16,-1,17,45,-2,-5,-16,-45,-18,10,26,46,77,
+    44,19,-8,-21,-30,-91,-10,26,-1,-3,-5,69,36,30,-12,-62,38,22,56,55,-31,-14,-64,-41,43,20,-22,-6,19,-23,1,2,
+    -31,2,-13,7,15,-13,-46,-46,-1,-40,-40,-15,12,23,15,35,-17,17,21,-45,-42,-24,5,-16,16,30,11,12,-12,5,-29,4,
+    35,-6,17,-19,-36,21,32,6,9,10,-23,-35,15,22,-6,24,-10,28,65,17,33,-13,-14,-26,-11,-9,-68,37,-3,-11,51,-5,
+    34,-6,4,42,-4,12,13,11,-25,-50,-37,-25,-4,24,18,-20,1,-14,-4,19,13,15,-52,-7,31,-5,9,-30,-10,15,-15,-10,
+    1,-17,-33,7,24,8,-16,-19,19,30,30,21,2,-28,-6,14,-40,-11,11,8,15,-30,-9,1,-14,6,11,21,43,42,-18,-35,
+    -30,-21,9,2,23,3,-3,14,-23,3,3,-27,-30,-21,-7,-13,5,6,12,9,-17,10,28,13,-21,-15,1,-14,-5,-26,-28,-13,
+    0,16,-16,2,18,11,4,-36,-29,0,9,17,37,1,-19,26,6,-15,-30,-20,24,14,19,28,-5,-20,6,12,-8,-15,-2,16,
+    -5,-25,-5,21,1,-8,-8,-13,11,0,13,13,-3,5,-31,-25,-9,-12,-3,3,10,15,30,8,4,1,-27,-19,-1,4,-6,-6,
+    -1,3,-16,-23,12,21,17,7,10,3,-9,13,9,2,-1,1,3,-4,-5,3,11,0,21,27,5,15,17,14,1,1,6,-1,
+    3,0,5,-12,-20,5,8,1,-1,8,8,4,2,-13,-1,-3,-19,-20,-26,-15,-16,-4,2,-11,-10,-24,-8,6,1,8,-12,-12,
+    0,-6,-16,-23,-4,1,-3,3,-1,11,18,-7,-12,3,11,20,21,13,-1,-13,-13,-8,-2,2,12,21,10,2,13,5,-7,5,
+    5,3,-1,-3,9,4,-1,-9,-15,9,10,0,8,8,2,-6,-4,-1,1,1,-12,-3,7,4,-1,-9,-3,3,7,9,8,6,
+    1,1,-12,-13,-4,-3,2,2,2,4,3,-2,2,0,-2,7,0,-3,2,-2,-6,-12,-6,4,5,-2,-5,6,6,3,4,-3,
+    -3,2,1,8,4,-5,-5,-11,-5,2,-2,-2,4,4,-3,2,1,-3,-1,-5,-4,-5,-1,-5,-6,1,-2,-2,-1,1,0,2,
+    3,0,4,4,-2,-4,-6,-7,0,7,3,1,3,1,0,1,2,2,2,-1,0,1,1,2,0,-1,-1,-3,-3,1,0,-1,
+    1,0,1,0,-1,0,0,1,-1,-1,1,0,-1,-1,0,0,1,0,-1,-1,-1,-1,0,0,0,0,1,0,0,1,0,0,
+    -1,-1,-1,-1,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static constexpr float kCalcaniScale = 2.99662424e-05f;
+static constexpr int16_t kCalcani[BodyIR::kSize] = {
+    -409,157,177,5213,5967,-15100,-3293,9170,-5486,2633,142,-1639,2873,-2412,1405,-618,27,476,-921,1041,-989,668,-285,-179,392,-597,511,-444,166,-46,-137,194,
+    -250,165,-168,38,-31,-69,38,-82,31,-56,-3,-44,-23,-41,-36,-21,-24,-23,-32,-5,-46,10,-35,-6,-18,-39,0,-38,5,-30,-12,-29,
+    -20,-9,-59,-17,-37,-26,-34,-16,0,-21,16,-8,6,-5,-18,-9,-14,-5,-32,-1,-9,-7,-12,-8,21,-17,12,-17,7,4,-2,33,
+    -18,-15,-59,7,-5,5,72,63,78,-8,18,95,358,396,342,18,-448,-478,-806,-532,276,812,459,1247,1963,1854,4505,2822,-1644,-6967,-16568,-20961,
+    -18212,-9156,5018,21349,32767,29647,17277,3157,-8153,-15784,-20352,-23668,-22271,-16948,-15548,-4615,8227,12702,19704,20149,16296,9801,2398,2421,1597,4765,5679,-1462,-4567,-7919,-7041,-1886,
+    3101,10371,8244,2873,1267,-2200,-743,5049,9077,11975,13077,9006,4380,2120,-3589,-9562,-10064,-7693,-3320,4398,7194,4825,-223,-10115,-15393,-18208,-16570,-7361,-2875,-385,1190,-1114,
+    -1921,290,2487,3562,2826,-79,-778,-759,-318,641,1063,1817,-4156,-13189,-20101,-24050,-18906,-9841,449,9933,13349,15266,13917,10762,10852,9675,7206,1390,-7506,-14826,-19106,-16729,
+    -9346,1372,11466,17174,18737,14469,10287,7961,6353,5330,2504,69,-3878,-9965,-15433,-17646,-14624,-9266,-3995,952,3990,4697,6075,6511,6963,8088,6378,4610,1317,-1946,-3252,-4117,
+    -1698,1559,5657,8145,6493,3351,-2832,-8314,-10786,-11321,-9073,-5356,-447,4520,9541,13712,15988,18748,18544,14680,8618,-1836,-11585,-17615,-17773,-12056,-4329,4067,6866,7340,5723,1667,
+    2358,862,1433,3510,1701,3443,1716,-1054,-492,-1773,-1727,-1306,-2707,-4837,-5881,-6752,-6747,-5108,-2837,1448,4686,8497,11867,11270,9921,5568,-914,-6312,-11342,-15338,-16618,-16484,
+    -15708,-10993,-6241,-1619,3817,5452,7586,8819,8057,8572,7023,5270,4589,4435,4267,2331,-912,-5644,-9273,-11217,-10845,-7720,-4631,-515,1533,773,-6,-2238,-2600,-919,1264,4909,
+    7335,8672,8037,5014,2287,-692,-3002,-4290,-5258,-5623,-5616,-4981,-4443,-2615,-351,899,2821,3344,3001,3296,3408,4220,5319,5363,3354,60,-3655,-5833,-4711,-1856,1770,3530,
+    2313,-529,-4770,-7473,-7168,-5003,-1480,1637,3054,3157,2554,1941,1587,1501,1077,-65,-1091,-2029,-2005,-671,1492,4897,7299,8635,9475,8244,6035,2587,-2069,-6820,-11176,-13404,
+    -13141,-10050,-4847,624,5299,7776,8726,8522,7486,7196,6854,5955,4698,2585,-385,-3450,-5405,-6286,-6038,-4749,-3280,-1601,49,1573,2891,3654,3934,3279,1841,775,529,867,
+    1707,2022,979,-826,-3117,-5045,-6018,-6200,-5713,-5128,-4474,-3778,-2270,114,2201,4412,6043,6468,6465,5724,4542,2977,543,-2103,-4189,-4613,-2912,-3,2999,4628,3905,993,
+    -2569,-4655,-4571,-2482,557,2758,3738,3672,2587,1690,1125,-111,-1767,-4044,-6676,-8275,-8419,-7148,-4796,-2245,-103,1484,2407,3190,3687,3414,2674,1082,-298,-488,211,1944,
+    3846,5048,4923,3932,2451,340,-1179,-2628,-4100,-4637,-4482,-3072,-703,1643,3483,4181,3803,2582,1037,-133,-1267,-2480,-3792,-5461,-6647,-7031,-6364,-4164,-1372,1480,3807,4925,
+    5203,4682,3559,2197,417,-1516,-2935,-4052,-4748,-4550,-3813,-2231,-272,1481,3171,3870,3681,2724,1006,-746,-2651,-4306,-5430,-5875,-5206,-3758,-1710,464,1968,2731,2961,2784,
+    2534,2251,1605,574,-723,-1867,-2340,-1864,-509,1301,2923,3517,2984,1509,-381,-1626,-2091,-1600,-256,1273,2888,3815,3810,3174,1729,311,-784,-1579,-1658,-1443,-1050,-633,
+    -394,-112,253,1051,2204,3352,4346,4770,4624,4056,3195,2405,1711,950,-86,-1382,-2572,-3386,-3234,-2084,-567,1109,2054,2087,2009,1810,1856,2100,2094,1828,921,-319,
+    -1440,-2299,-2515,-2391,-2388,-2644,-3408,-4447,-5284,-5807,-5636,-4642,-2997,-625,1901,4055,5500,5594,4296,2071,-396,-2437,-3661,-4220,-4495,-4486,-4282,-3683,-2553,-1177,305,1412,
+    1921,2007,1848,1766,1820,1992,2077,1806,1107,4,-1293,-2474,-3313,-3825,-3792,-3268,-2625,-1724,-660,572,2022,3267,4073,4125,3307,2067,777,-419,-1205,-1490,-1642,-1691,
+    -1691,-1864,-2078,-2213,-2256,-2181,-2011,-1823,-1619,-1310,-861,-367,116,574,897,1221,1605,1951,2307,2483,2355,2004,1630,1527,1753,2161,2400,2301,2024,1713,1633,2024,
+    2651,3077,3004,2167,718,-840,-2269,-3330,-3871,-3991,-3658,-2917,-1941,-821,277,1073,1374,1311,1012,532,139,-214,-533,-642,-656,-476,-153,62,45,-377,-1048,-1805,
+    -2447,-2694,-2664,-2390,-1935,-1475,-1062,-749,-344,160,656,1088,1079,630,-147,-1213,-2074,-2438,-2211,-1459,-499,425,1142,1686,2083,2351,2551,2551,2232,1619,878,264,
+    -22,62,386,790,994,844,511,135,20,276,667,1246,1839,2151,2151,1822,1270,630,154,-58,4,425,929,1316,1448,1252,946,563,136,-135,-273,-328,
+    -194,60,360,642,742,651,399,26,-422,-829,-1111,-1257,-1193,-1024,-725,-281,153,573,769,611,183,-547,-1530,-2565,-3428,-3941,-3946,-3543,-2880,-2087,-1444,-975,
+    -637,-442,-315,-278,-437,-816,-1256,-1618,-1779,-1674,-1392,-1026,-750,-693,-699,-537,-192,296,819,1226,1539,1679,1662,1597,1386,1036,606,115,-299,-623,-957,-1306,
+    -1795,-2328,-2574,-2522,-2079,-1309,-461,392,1116,1841,2573,3047,3142,2719,1750,455,-724,-1430,-1503,-862,222,1349,2263,2741,2724,2327,1711,1038,400,-45,-222,-194,
+    67,503,977,1397,1702,1841,1788,1566,1173,674,152,-336,-716,-935,-961,-761,-359,198,942,1647,1967,1782,1014,-185,-1498,-2611,-3266,-3447,-3231,-2722,-2002,-1098,
+    -99,889,1697,2224,2458,2309,1793,971,-65,-1186,-2264,-2979,-3186,-2932,-2343,-1745,-1312,-1040,-925,-943,-921,-793,-645,-485,-388,-238,117,699,1476,2213,2712,2782,
+    2392,1701,925,263,-350,-931,-1543,-2164,-2509,-2452,-1943,-1134,-308,321,615,643,544,444,326,148,-39,-283,-555,-716,-717,-564,-219,247,673,992,1119,1092,
+    1010,866,746,683,568,402,226,-20,-280,-531,-731,-747,-631,-461,-283,-125,-29,-13,60,231,470,701,805,657,224,-367,-1028,-1617,-2001,-2071,-1868,-1592,
+    -1232,-824,-350,239,849,1421,1722,1690,1362,800,248,-271,-755,-1229,-1765,-2319,-2802,-3061,-3037,-2712,-2201,-1687,-1236,-930,-715,-574,-475,-302,-94,146,400,582,
+    682,709,687,661,669,640,505,295,-13,-336,-500,-467,-206,233,744,1244,1560,1627,1436,1009,479,-93,-587,-865,-953,-900,-703,-408,-59,393,862,1234,
+    1517,1624,1521,1274,958,689,535,469,447,467,534,669,876,1051,990,560,-206,-1147,-1885,-2103,-1756,-912,150,1145,1902,2328,2481,2390,2054,1470,731,45,
+    -461,-693,-677,-571,-539,-676,-960,-1321,-1613,-1782,-1886,-1869,-1791,-1758,-1694,-1600,-1457,-1152,-683,-83,554,1068,1332,1234,826,223,-349,-670,-740,-533,-174,165,
+    392,483,558,603,633,619,413,72,-320,-671,-896,-974,-891,-649,-285,118,509,819,974,954,790,581,339,24,-342,-695,-938,-986,-796,-418,-60,99,
+    -35,-424,-817,-1034,-971,-644,-209,280,708,1028,1305,1485,1494,1231,720,91,-517,-894,-927,-670,-278,65,143,-138,-671,-1378,-2090,-2639,-2942,-2916,-2554,-1877,
+    -1060,-235,554,1179,1621,1919,2071,1962,1557,960,223,-448,-827,-877,-679,-345,27,326,511,601,612,536,389,195,-33,-297,-575,-766,-844,-739,-442,-101,
+    241,512,698,845,979,1150,1260,1210,938,486,28,-278,-314,-146,97,273,249,38,-257,-537,-739,-844,-885,-828,-681,-421,21,528,1043,1440,1556,1405,
+    1012,515,-4,-456,-744,-915,-915,-787,-613,-418,-306,-271,-247,-139,122,487,913,1319,1603,1763,1831,1818,1670,1296,735,58,-667,-1298,-1739,-1939,-1928,-1732,
+    -1394,-983,-493,10,513,1024,1427,1660,1679,1423,919,322,-200,-535,-696,-770,-835,-997,-1177,-1246,-1158,-846,-394,54,372,496,426,228,-41,-439,-870,-1320,
+    -1787,-2043,-2034,-1704,-1078,-393,173,523,666,602,430,272,98,23,122,386,815,1274,1634,1738,1533,1178,767,375,68,-181,-411,-613,-721,-646,-396,-114,
+    121,292,339,325,329,322,281,152,-112,-500,-909,-1214,-1323,-1166,-810,-321,175,524,727,787,756,666,524,342,54,-328,-761,-1183,-1437,-1452,-1269,-881,
+    -399,9,363,611,695,676,579,392,100,-205,-369,-264,113,596,969,1055,765,174,-470,-1000,-1295,-1303,-1145,-867,-526,-208,59,224,287,299,357,547,
+    862,1261,1645,1863,1868,1711,1379,891,314,-358,-1015,-1528,-1822,-1745,-1319,-633,152,798,1228,1403,1405,1309,1136,956,748,523,340,288,383,574,823,995,
+    987,785,501,263,157,238,452,737,989,1143,1164,1042,842,559,257,-49,-405,-727,-997,-1107,-990,-735,-366,-52,59,15,-137,-289,-347,-319,-234,-145,
+    -116,-168,-254,-322,-371,-343,-221,-30,269,580,801,890,832,695,495,287,88,-74,-190,-308,-360,-326,-190,-5,151,219,38,-331,-769,-1175,-1400,-1392,
+    -1204,-957,-625,-238,178,650,1070,1344,1367,1088,576,37,-389,-619,-537,-273,59,399,668,830,872,855,734,502,244,-70,-365,-519,-519,-333,6,280,
+    349,221,-83,-423,-667,-761,-670,-466,-217,20,215,379,474,537,568,572,627,721,798,827,807,699,533,381,208,57,-61,-178,-263,-317,-286,-167,
+    -40,68,48,-148,-381,-557,-573,-395,-157,12,18,-117,-291,-390,-339,-160,43,127,142,140,169,373,715,1156,1608,1947,2145,2102,1831,1373,705,-26,
+    -681,-1172,-1369,-1255,-877,-303,335,858,1073,954,541,-81,-656,-1015,-1087,-880,-492,1,478,832,1032,1119,1093,975,852,703,555,433,322,251,210,234,
+    278,334,449,536,577,580,577,549,485,396,150,-240,-714,-1188,-1407,-1316,-969,-418,99,452,654,693,704,739,686,528,263,-57,-300,-357,-200,87,
+    360,519,562,481,356,231,78,-63,-250,-455,-612,-722,-726,-641,-526,-438,-441,-532,-652,-763,-830,-771,-560,-252,85,384,552,515,294,-37,-388,-650,
+    -741,-675,-479,-181,171,569,931,1187,1330,1288,1083,784,446,157,-42,-103,-30,86,194,210,78,-153,-412,-583,-580,-471,-344,-222,-142,-90,60,352,
+    692,1002,1191,1200,1078,926,839,770,698,571,302,28,-228,-427,-451,-395,-302,-189,-80,41,197,439,705,899,954,848,597,243,-118,-452,-735,-922,
+    -1017,-1002,-924,-832,-713,-564,-359,-91,266,678,1035,1304,1448,1449,1383,1271,1118,941,715,480,298,154,66,71,128,207,289,284,207,131,78,154,
+    408,770,1119,1360,1454,1387,1296,1226,1130,1008,764,368,-95,-468,-622,-510,-179,217,608,903,1014,1010,956,840,647,417,158,-98,-233,-235,-153,-43,
+    -36,-194,-476,-814,-1109,-1266,-1249,-1093,-822,-478,-173,46,159,120,3,-90,-104,39,309,616,907,1162,1370,1464,1444,1294,964,560,149,-226,-451,-521,
+    -486,-386,-323,-357,-453,-596,-737,-772,-663,-473,-268,-103,-89,-201,-303,-354,-287,-64,185,335,384,359,322,367,483,600,706,747,677,585,514,483,
+    508,472,338,170,6,-82,-12,153,294,350,259,61,-99,-157,-125,15,214,395,547,639,653,577,413,266,225,335,587,888,1116,1178,1091,910,
+    651,348,78,-120,-278,-342,-267,-68,254,563,736,714,459,48,-412,-761,-903,-858,-682,-455,-229,-50,86,206,354,500,525,452,262,-24,-246,-348,
+    -306,-94,186,421,593,692,715,705,695,650,545,359,102,-108,-232,-228,-133,-82,-58,-99,-177,-234,-275,-268,-240,-204,-176,-126,-61,-7,55,83,
+    118,201,352,568,789,988,1138,1284,1389,1428,1434,1298,1016,639,165,-277,-567,-718,-736,-633,-520,-433,-316,-122,146,467,822,1077,1164,1091,878,626,
+    404,226,43,-143,-329,-508,-553,-479,-307,-39,192,328,330,204,10,-202,-339,-402,-445,-463,-522,-635,-700,-739,-758,-775,-891,-1079,-1284,-1438,-1475,-1368,
+    -1109,-777,-404,-23,282,461,483,347,115,-128,-359,-508,-571,-611,-620,-645,-679,-671,-661,-632,-555,-489,-388,-195,37,311,598,768,733,500,150,-234,
+    -520,-612,-541,-393,-247,-139,-75,40,246,491,767,960,995,927,790,661,611,657,771,936,1102,1220,1308,1322,1253,1112,894,573,149,-237,-517,-619,
+    -480,-223,78,344,527,627,680,769,850,879,833,664,384,34,-376,-754,-979,-1067,-977,-708,-354,34,344,521,574,509,369,217,97,-45,-168,-231,
+    -295,-297,-257,-233,-258,-412,-649,-911,-1068,-1032,-889,-685,-507,-460,-538,-627,-677,-658,-547,-485,-483,-527,-625,-653,-571,-420,-223,-9,157,289,395,430,
+    441,410,313,136,-116,-367,-577,-649,-566,-378,-140,42,132,119,17,-100,-189,-229,-208,-145,-54,40,72,85,120,146,203,262,304,349,356,400,
+    500,605,736,869,970,997,960,869,684,489,329,193,58,-155,-427,-740,-1002,-1085,-962,-631,-252,45,283,428,521,629,692,684,575,255,-150,-482,
+    -736,-839,-822,-751,-649,-576,-510,-424,-303,-162,-58,-43,-131,-262,-398,-494,-515,-494,-462,-469,-539,-666,-796,-898,-968,-960,-907,-834,-732,-669,-651,-664,
+    -672,-604,-505,-380,-216,-84,19,114,199,253,297,354,355,304,231,122,2,-66,-31,63,201,372,434,397,368,334,376,515,622,661,603,436,
+    258,172,186,290,433,495,487,499,583,739,951,1173,1313,1347,1254,1067,857,639,422,166,-104,-346,-534,-595,-527,-348,-107,73,181,256,250,201,
+    178,143,83,29,-37,-150,-299,-503,-682,-751,-767,-692,-560,-462,-378,-346,-332,-290,-212,-109,-20,62,78,33,-35,-156,-299,-433,-577,-788,-1046,-1316,
+    -1578,-1700,-1617,-1321,-889,-472,-133,48,101,119,152,221,241,141,-53,-319,-634,-856,-952,-973,-889,-744,-545,-323,-62,269,541,689,696,543,286,55,
+    -86,-128,-82,-71,-113,-198,-346,-494,-600,-622,-569,-439,-227,20,239,377,430,405,385,390,416,488,556,638,688,734,814,822,773,641,408,137,
+    -132,-346,-473,-452,-327,-177,-20,97,166,234,350,485,608,654,552,338,-4,-376,-584,-622,-540,-394,-257,-165,-115,-52,30,109,178,187,125,11,
+    -107,-167,-174,-136,-123,-180,-256,-339,-351,-288,-224,-171,-196,-320,-469,-611,-720,-760,-762,-715,-602,-517,-435,-376,-383,-386,-407,-379,-282,-189,-72,26,
+    82,153,258,359,419,427,338,170,-18,-199,-284,-222,-67,121,271,298,213,91,-21,-79,-33,68,122,153,139,56,12,16,0,-64,-189,-381,
+    -589,-721,-713,-548,-280,64,387,611,781,864,919,930,816,596,221,-207,-580,-851,-957,-971,-926,-819,-663,-489,-273,-35,144,274,314,273,189,73,
+    -68,-250,-368,-435,-507,-521,-527,-572,-631,-671,-677,-628,-525,-423,-342,-289,-279,-303,-318,-271,-170,-82,-85,-190,-381,-591,-757,-830,-788,-728,-675,-687,
+    -802,-894,-941,-911,-753,-552,-399,-301,-252,-249,-233,-203,-119,-7,56,85,34,-35,-72,-110,-113,-118,-157,-183,-125,22,243,488,654,681,536,306,
+    40,-217,-381,-455,-425,-362,-273,-144,-52,25,60,68,110,162,228,315,392,431,457,481,485,463,384,245,49,-186,-378,-474,-472,-364,-227,-131,
+    -70,-57,-28,75,224,365,436,377,178,-35,-217,-306,-231,-130,-61,-53,-133,-243,-354,-425,-439,-361,-252,-173,-98,-47,-1,23,18,-48,-235,-477,
+    -730,-925,-1036,-1042,-921,-809,-705,-597,-511,-400,-272,-133,-22,38,21,-106,-318,-587,-879,-1155,-1344,-1436,-1435,-1301,-1110,-873,-588,-329,-92,76,163,178,
+    104,-26,-174,-250,-228,-114,45,103,50,-106,-329,-513,-602,-575,-488,-405,-402,-462,-484,-452,-337,-170,-39,28,25,2,18,64,135,233,295,287,
+    242,171,94,42,8,-18,-79,-217,-334,-390,-411,-337,-198,-78,7,38,-1,-98,-223,-346,-438,-480,-473,-434,-394,-340,-258,-193,-133,-97,-126,-193,
+    -295,-431,-571,-652,-694,-712,-650,-581,-531,-523,-556,-551,-536,-485,-389,-336,-364,-467,-604,-759,-826,-761,-644,-508,-466,-505,-541,-570,-507,-387,-281,-229,
+    -296,-391,-471,-531,-508,-440,-333,-225,-179,-147,-112,-69,1,43,18,-39,-107,-177,-190,-151,-81,26,106,153,155,99,58,2,-36,-46,-109,-168,
+    -267,-410,-508,-579,-563,-430,-238,-26,186,377,559,747,860,922,937,842,675,408,66,-248,-499,-635,-652,-570,-431,-315,-227,-140,-58,68,243,361,
+    383,284,112,-42,-149,-156,-116,-129,-234,-409,-584,-752,-869,-906,-896,-851,-817,-794,-751,-666,-541,-444,-420,-469,-568,-665,-713,-703,-665,-617,-597,-645,
+    -747,-862,-981,-1079,-1131,-1122,-1038,-917,-822,-782,-752,-716,-683,-630,-553,-468,-446,-458,-453,-474,-450,-400,-355,-274,-174,-88,-19,91,194,294,411,453,
+    421,260,7,-234,-428,-461,-355,-170,36,155,187,160,139,178,257,344,366,306,209,131,114,144,228,331,406,439,419,428,469,485,461,341,
+    168,4,-116,-121,-48,48,144,206,196,141,73,-13,-85,-138,-168,-178,-174,-153,-178,-209,-197,-145,-65,-33,-33,-83,-194,-298,-383,-425,-430,-385,
+    -362,-434,-507,-608,-706,-730,-718,-625,-501,-406,-323,-300,-280,-204,-110,9,60,-29,-213,-498,-766,-936,-1025,-1041,-1035,-1004,-954,-878,-750,-561,-318,-122,
+    2,52,41,30,44,101,160,203,185,102,46,11,13,28,20,-3,-73,-152,-217,-250,-232,-178,-108,-16,124,243,303,335,365,400,440,466,
+    447,386,287,208,166,182,267,349,441,475,395,251,72,-50,-81,-60,-3,50,30,-56,-157,-227,-219,-170,-82,-19,-64,-126,-186,-222,-195,-159,
+    -148,-213,-363,-558,-746,-877,-931,-915,-868,-792,-709,-604,-430,-255,-113,-19,-38,-162,-335,-482,-566,-617,-655,-670,-697,-758,-800,-792,-733,-660,-567,-435,
+    -344,-315,-320,-358,-421,-470,-465,-416,-351,-304,-264,-246,-267,-279,-243,-169,-81,15,95,145,171,213,320,462,587,633,611,534,395,281,241,281,
+    343,335,237,101,-30,-118,-87,42,224,401,527,632,690,736,784,825,852,802,702,562,400,277,174,59,-67,-172,-251,-259,-163,-12,170,331,
+    428,444,386,298,201,108,35,-10,-39,-71,-104,-143,-174,-188,-217,-252,-305,-411,-530,-648,-749,-781,-753,-638,-467,-288,-146,-131,-162,-223,-278,-261,
+    -257,-226,-236,-344,-442,-515,-497,-389,-231,-78,-40,-90,-188,-283,-334,-346,-320,-308,-324,-373,-433,-474,-492,-445,-357,-277,-194,-81,60,228,420,562,
+    627,592,437,272,132,-15,-106,-109,-103,-98,-57,-16,40,135,249,346,417,458,456,422,343,274,235,198,164,111,78,63,72,130,213,339,
+    464,567,617,558,422,288,196,151,211,317,385,390,307,192,96,56,83,113,110,69,16,4,61,190,356,490,518,458,349,170,-11,-146,
+    -254,-343,-440,-509,-542,-522,-419,-309,-208,-137,-96,-29,36,112,242,383,462,454,379,258,105,-57,-180,-262,-335,-388,-431,-461,-452,-402,-269,-104,
+    43,168,201,182,129,48,16,35,121,262,424,529,557,563,509,467,495,509,483,419,328,207,119,134,234,354,417,408,320,209,170,168,
+    199,244,245,209,132,54,24,57,147,246,322,366,420,460,478,509,473,372,231,67,-44,-115,-138,-89,-14,41,90,124,104,99,107,125,
+    178,192,167,102,15,-76,-187,-243,-277,-316,-348,-407,-421,-410,-356,-223,-93,77,226,257,231,122,-31,-156,-241,-253,-233,-218,-227,-259,-244,-165,
+    -21,144,252,280,206,69,-44,-83,-24,76,148,140,50,-61,-222,-369,-426,-477,-497,-449,-348,-174,72,348,602,786,844,838,796,723,691,646,
+    576,486,392,290,116,-38,-159,-217,-176,-107,9,129,231,331,428,567,686,742,751,716,610,456,325,206,131,117,113,100,68,31,14,38,
+    118,259,436,560,602,567,461,363,313,314,353,362,322,266,222,221,260,320,359,310,181,20,-160,-292,-308,-254,-198,-130,-55,11,109,207,
+    250,256,163,12,-93,-193,-242,-186,-106,-3,122,191,221,230,199,151,102,42,-52,-156,-259,-341,-383,-393,-341,-265,-209,-177,-180,-172,-160,-121,
+    -3,163,325,434,479,441,324,196,109,85,95,126,149,134,122,117,169,288,415,523,550,499,399,292,233,204,204,173,101,38,-34,-46,
+    17,112,225,291,322,356,398,441,470,493,458,353,232,120,54,44,51,39,9,-36,-102,-181,-239,-222,-128,13,168,317,431,471,480,457,
+    393,327,228,60,-161,-379,-549,-659,-697,-609,-437,-260,-68,83,183,248,280,356,443,503,514,437,320,185,88,52,29,7,-58,-159,-248,-312,
+    -282,-161,-28,88,147,113,1,-105,-153,-156,-102,-21,50,152,270,377,482,548,548,460,319,208,133,111,140,186,233,236,203,140,84,48,
+    23,56,69,63,53,-5,-44,-67,-68,-2,107,199,262,328,340,317,338,354,368,393,359,256,128,-8,-100,-109,-50,62,181,254,275,271,
+    253,255,305,359,356,282,179,56,-30,-48,-75,-83,-117,-240,-369,-468,-522,-486,-404,-309,-208,-171,-158,-121,-105,-101,-146,-246,-353,-456,-510,-490,
+    -416,-307,-203,-158,-148,-176,-240,-288,-313,-291,-247,-198,-181,-211,-222,-271,-324,-366,-430,-489,-560,-613,-658,-645,-556,-392,-123,139,358,539,617,594,
+    529,463,406,363,315,216,30,-167,-309,-389,-341,-222,-107,13,101,143,214,324,422,530,575,522,443,327,231,155,94,107,78,14,-2,-7,
+    21,77,127,137,113,103,94,106,149,213,268,281,269,211,139,83,47,81,152,199,197,152,82,-15,-112,-163,-199,-242,-264,-284,-321,-368,
+    -376,-342,-294,-220,-167,-147,-197,-321,-431,-503,-474,-356,-206,-60,28,52,23,1,-7,-18,-48,-137,-263,-396,-472,-489,-453,-347,-285,-262,-258,-318,
+    -363,-358,-322,-246,-167,-109,-67,-25,30,73,87,51,-7,-57,-118,-136,-91,-22,60,130,174,163,125,84,31,21,43,61,59,8,-72,-142,
+    -176,-182,-151,-76,-7,58,103,96,81,101,142,194,248,263,242,169,58,-31,-87,-88,-56,-48,-80,-156,-240,-286,-255,-151,0,153,245,284,
+    296,306,326,312,237,94,-113,-346,-578,-753,-820,-817,-764,-665,-544,-418,-303,-163,-35,12,3,-25,-60,-97,-99,-82,-68,-54,-82,-163,-304,-427,
+    -496,-542,-482,-384,-324,-270,-275,-322,-360,-388,-387,-362,-324,-282,-264,-264,-260,-242,-188,-91,6,75,108,83,18,-30,-70,-59,33,111,152,149,
+};
+
+static constexpr float kGuitarScale = 2.87540097e-05f;
+static constexpr int16_t kGuitar[BodyIR::kSize] = {
+    -13139,28026,-23121,8053,-11798,-12156,20048,-20699,-11125,-10669,-21352,-1498,-11027,-11349,18581,2658,6496,8440,-6007,5978,-6561,4023,12659,-9046,10363,9879,12638,1170,-14638,15762,3937,-7202,
+    -2570,10616,-3971,3875,12730,-3618,6620,14566,5113,-17550,-2322,78,1151,-13628,-15212,11698,14618,8323,7261,24113,-515,-23994,-11399,18346,-2690,-12656,29661,6057,-802,-1453,506,11369,
+    -13346,-8089,8974,-9665,-11337,-2797,-15555,-5714,-11036,18743,-4545,-26981,17187,-5651,-17869,-13542,3322,-1990,-2122,6065,-11161,-16570,5688,-6864,-21657,-10845,-13447,224,-32767,-10552,4971,-3250,
+    19570,12163,7395,-8060,-6864,-4993,-3421,-19497,-21816,4326,-3412,-8782,449,-6054,-25111,-7760,11854,-3172,17262,-7322,-14645,9528,-19608,-1472,2480,6089,1562,-2149,3023,1794,10146,7482,
+    10875,4622,15634,-6439,475,2651,-5559,12793,-349,3490,8054,14312,7941,9753,6676,728,5849,5858,8433,6241,651,2760,7901,3101,14886,9517,4384,6991,-3905,7920,13972,-4841,
+    8271,25980,3910,13802,19901,-5597,5894,1687,4530,15806,7896,4295,6868,10944,-14124,12642,12823,787,13848,11258,17161,5842,10228,3962,3706,-537,12212,12970,3940,9317,10147,4940,
+    -1844,15039,6784,16463,16224,10564,16735,10664,6824,10355,7759,6515,19920,336,762,9645,-944,173,10562,11426,-685,4113,-2505,-653,7990,-4596,-168,3704,-1715,-2283,7774,-1232,
+    -8737,793,-6120,-3730,-6492,385,7753,-2745,4405,-2357,-4634,6574,2362,6547,-6524,1102,13057,2675,3555,-4471,5878,7385,-3084,-7278,-7982,-3918,-8858,-5298,1230,2337,-5123,-12458,
+    -2537,-6306,-958,-2092,-7381,-133,-12822,-3844,-1817,-5854,-5879,-8247,-7936,-7093,-10582,-2982,2526,-11614,-6688,-5582,-4414,-5795,-3226,-6860,-9713,2275,-3399,-15159,-8689,-3145,-3251,1399,
+    -6083,-9180,-2054,-8015,-13546,-2528,-5565,-3214,-2970,-11797,-12819,-4920,-1578,-8855,-5822,-6475,-3965,-7594,-7416,2191,-8598,-10417,62,-4885,-1271,1500,-3580,-7191,-5443,-7238,-5808,-9855,
+    -13425,-42,806,970,-2419,3355,-868,5851,-1116,-9932,1857,-4446,7747,-5447,-349,5676,1492,8487,-11242,-903,8072,529,1517,-2122,-2142,-2558,1558,535,-4876,1432,449,5318,
+    -470,-6008,1323,-1771,724,-8548,640,3794,191,7822,-1100,3793,1165,6773,4943,-1718,4177,1791,1405,-295,3910,4793,4288,2258,2164,2763,3813,-1371,4890,5183,-4427,5927,
+    976,1017,3785,4772,4647,-5260,-2468,4468,4658,-1834,-4405,5417,8017,1433,1003,1892,-330,5021,10064,-3299,1811,5949,-2652,4991,1057,1112,4910,1148,2668,-155,-1292,-627,
+    363,2675,2501,4869,4299,1479,4468,7408,4842,1232,1811,-1148,-2899,4152,615,3118,3861,-5067,3924,2243,2390,10221,2815,1552,3645,633,-605,-1741,-1829,1197,2391,-343,
+    -2548,1904,-1139,1157,5541,-5259,3097,7185,-2907,-704,111,126,3004,-1894,1092,-73,-7367,1140,2361,1450,131,6927,6739,846,3024,-3481,-4557,-248,335,-8759,-3378,-1411,
+    -5799,-1236,-1730,1012,-3088,-2314,-271,-5944,-3976,-3136,4149,423,-4221,4682,-64,3839,2531,1787,542,-6492,907,2188,-2119,-5960,-1594,1774,-2750,902,1500,-5335,3004,9302,
+    -1101,-5226,-3488,-1159,2366,-5117,-3728,-1832,-5659,-298,2723,881,-3752,-5813,-1775,811,-7918,-2852,-3449,-1452,-2269,-4224,1910,-942,1972,-4533,1859,-267,-1636,-1161,932,3295,
+    -2790,-1796,-2717,2525,-496,-3046,-5496,4962,1151,-3064,-521,1786,1392,-8635,5801,-2222,969,-1148,-2612,6843,-3531,2686,-1757,1084,-60,4075,3971,-5485,2428,-2719,-874,3601,
+    -3057,-834,4946,-4706,-2275,3332,1238,2362,872,-439,-3286,1592,3749,-732,4726,1602,-2676,5911,-1076,1610,-882,667,2453,-879,5221,481,5059,920,2694,2410,340,2036,
+    597,-546,2245,-82,-2530,9577,3787,-186,883,1264,892,2059,-1557,878,353,-1350,4043,873,5117,-2359,5143,-978,-2483,9034,-4394,7892,-1510,-3592,12478,-1146,-1231,4291,
+    -1100,-871,2665,418,429,-2325,3479,-3821,321,3820,-3220,8918,-8174,-3787,1155,-910,-761,-2203,866,-3410,807,-2400,3424,-5327,-1631,6,-3784,3738,1842,-71,-2740,4209,
+    -471,-904,1109,-502,-1737,-1824,-1147,-1903,-3181,-5301,-44,-2923,-6479,223,1473,-2605,-4279,-2380,4767,-2423,-6224,-6362,-4349,2775,-1901,-3014,1338,-2157,-6776,-8,-4815,-752,
+    632,-1364,-3480,-2022,6413,-5684,1323,519,-3458,11,-206,-5119,-3662,1603,-3394,2258,-1648,2353,-1826,-4777,-1298,-332,-513,-5253,5057,-1059,-5289,-1016,-1568,-1456,-530,-290,
+    -1335,-1682,-2582,-1349,-1552,-137,-2900,375,1330,1474,1856,-5877,-867,-1852,-3614,-1014,-757,216,-158,449,-6142,-638,3259,-4399,2010,2436,-3239,2435,-873,-1603,5056,-1122,
+    -2331,4378,-1381,-2128,3753,560,-640,793,1322,-1065,2799,-1185,-2324,2360,-702,-66,-2377,-1778,-1059,646,113,751,3327,260,-200,2758,-1641,2457,4783,-3666,-118,1530,
+    2349,2809,1895,981,878,806,-671,-3459,760,433,-1558,1720,-1039,4048,1213,1591,2682,-2196,724,3531,-1365,-1027,7501,-2877,-3186,4089,485,5543,1777,-4786,1584,2220,
+    -2829,3592,3337,873,3545,1030,-366,-3524,3838,-525,-1274,1377,-3903,3391,-48,-3680,2209,3802,-2357,3224,1897,-3179,1186,1719,770,-2169,-1978,2181,2666,-4699,1150,3701,
+    -2237,-476,2109,-77,515,1154,-3805,-64,3331,-1062,-717,334,-863,1234,-3636,-2632,5476,-516,-3273,2858,-2038,-2092,1891,-344,-635,1534,-4126,-1859,5639,-4575,-1025,2328,
+    -577,-1745,-277,1348,-159,1911,-2828,-1032,623,569,-498,-650,-1099,-1434,1004,-3140,-2922,-1453,-285,308,-495,-224,-567,-1595,-1424,1459,-1892,-1011,3100,466,779,328,
+    -1871,-1167,461,631,167,-2105,621,1008,372,785,-2739,841,-1225,286,-563,-1330,1575,-1875,-1213,-2010,394,-2641,1453,467,-2492,1125,-2947,381,767,895,-1734,701,
+    945,1033,163,-1779,1417,162,352,-2836,2217,-3317,-312,3304,-47,2675,-2415,1966,-317,180,1567,-1973,563,-553,-2413,-769,-688,1267,156,718,705,-1259,1957,-627,
+    746,655,1147,2528,89,-110,1381,506,597,719,756,1386,109,626,-1176,1505,878,178,-325,455,864,-545,-109,-350,2381,-763,2954,2253,-246,970,-2119,1540,
+    3482,-6,-1662,2159,-584,611,481,-1033,2860,1075,256,-969,2419,-3166,761,1833,-3259,3677,-1726,617,174,489,54,-1609,2185,-172,-1524,-2140,53,-8,-372,-542,
+    2212,103,-15,-797,-785,889,-2765,1111,1835,1443,-1996,344,405,-2264,263,-1276,756,-1595,-943,-799,-416,806,479,1012,-1363,718,-1206,-2143,-1471,-805,834,1819,
+    1241,-1412,-110,-297,-396,181,-360,-1747,690,939,-576,382,-1322,838,660,-673,-5,120,834,-97,-384,-163,-133,-2024,-1763,-157,-768,648,810,-1013,-1856,1319,
+    238,-1903,1491,-829,-1113,685,-1301,62,529,-1746,609,1604,-1618,245,1099,-385,331,-411,-631,-1390,-316,-1824,-1224,1038,-1531,1003,695,-465,539,-1114,-2031,1464,
+    -1199,-2520,1258,-2761,-631,1297,-349,-444,-866,563,-135,237,598,-979,-167,-1475,-7,1007,-305,533,-950,-274,280,611,-797,-109,341,-1664,1192,1121,-427,1090,
+    851,-1035,-1084,813,-4,-41,677,-221,518,151,109,327,-79,-961,1105,1089,-476,935,355,-1383,852,393,21,1623,-2156,467,568,501,-967,-1426,1276,584,
+    -73,-1176,1968,23,146,698,9,14,516,1423,25,48,35,623,913,-354,-1474,752,408,132,522,698,-322,-1308,794,1815,277,-688,1277,1303,-281,-89,
+    1679,-1112,-73,1258,-1419,475,84,209,406,-880,-871,28,866,656,280,45,1434,344,-213,866,873,282,147,237,-1073,721,190,-33,952,-48,-872,2,
+    1154,-568,341,-189,-37,113,56,1328,32,-468,-1104,760,408,-1367,566,-678,-699,141,258,717,-1218,-710,-215,33,-623,-475,970,-587,-119,204,-133,-111,
+    -728,288,88,-497,276,-223,-564,-954,-334,445,590,492,-933,126,229,-567,261,112,73,-448,-1194,397,666,-1470,-1117,88,-220,-1145,373,888,-816,583,
+    -180,-193,1178,-416,180,-111,-412,-400,-412,858,61,-707,-146,-64,-792,126,11,-4,-223,-27,495,-414,572,391,335,21,248,-240,-50,423,152,65,
+    -444,338,-1287,-446,1005,256,-444,324,-195,-85,1012,286,-120,-3,939,-60,634,133,386,600,-441,-594,1012,1168,-1039,543,-418,-356,-28,473,728,698,
+    821,-687,628,298,349,643,-161,545,307,-283,-3,-274,125,157,-323,71,-198,213,-66,98,817,-523,222,399,150,159,-480,453,380,-45,-754,-160,
+    886,-425,-940,1048,66,339,291,-754,882,-31,748,130,131,-109,61,414,-978,815,62,-256,631,39,-791,-373,539,270,444,290,242,354,-409,35,
+    -308,-438,353,393,-98,-900,412,-277,-806,198,-163,-101,265,-120,-2,-18,8,253,-636,327,-51,-707,308,225,-656,-373,391,-120,-139,-92,-91,-266,
+    115,-169,-119,558,-883,-618,463,-102,-163,111,38,-138,-192,-239,115,247,-129,-343,-772,-205,411,-102,197,496,107,-111,-162,63,98,-310,-190,162,
+    -45,-951,13,437,-910,613,299,-82,-26,-221,136,-359,397,-502,610,546,-509,240,-228,-701,-68,528,-301,312,-378,-474,95,151,-300,299,820,-938,
+    -15,-334,-214,444,-567,-398,230,-77,-307,411,-176,-511,-37,-74,-364,185,178,-267,103,86,187,-28,91,238,-177,-362,145,265,-72,730,-2,-250,
+    174,-256,169,91,108,11,-85,-13,-4,40,-141,-243,220,-45,-436,-10,263,72,-537,235,322,157,-124,-143,429,100,121,123,244,96,98,-115,
+    201,353,-80,51,155,-110,-19,182,-54,157,16,-15,-97,313,-14,-101,271,-189,-30,233,48,-270,175,-151,53,168,-16,2,-4,118,42,429,
+    -43,206,43,-118,74,-90,201,57,72,-224,80,161,-150,130,-204,66,98,-215,281,10,-162,5,-190,-11,45,-80,47,-200,-218,241,-55,-153,
+    231,158,118,-160,-130,105,33,-130,-322,55,-136,-129,172,-20,-183,55,88,-79,-24,-271,152,-24,-215,35,-64,-45,68,-55,8,213,-167,-99,
+    -86,-78,-11,37,29,210,9,-324,144,72,-200,-137,-43,-61,27,-12,-174,-224,-153,-41,65,-71,-62,68,-170,-89,91,53,101,153,-73,-91,
+    55,32,-198,-120,117,-111,57,19,-289,-5,-18,-70,-3,-84,125,139,-76,101,-109,-101,209,-192,46,22,9,59,-105,-135,-82,170,-183,86,
+    71,-58,84,97,-23,-123,92,-55,114,89,-108,30,19,-48,83,-35,-57,56,-125,-130,42,-57,-74,9,-77,-42,-14,-28,-148,61,88,-32,
+    42,-51,-4,-53,-38,40,-79,-29,44,8,-61,-48,52,-63,-64,-45,46,35,-53,-3,-38,-24,-100,31,20,-39,43,-27,-29,23,110,57,
+    34,24,13,11,-46,-16,-13,-29,24,39,-100,23,86,-96,6,67,-48,-16,-39,-69,23,-41,7,23,0,16,30,-12,-14,76,-52,13,
+    29,-28,-2,50,52,-35,2,13,46,-10,-21,26,31,7,-48,57,7,-15,51,-31,51,-6,-37,-8,-11,58,-2,13,-28,11,0,-12,
+    33,-22,27,15,-11,13,38,0,17,8,2,29,-20,-8,7,17,-19,-1,7,-5,0,-26,-5,5,8,26,34,5,15,-5,-5,6,
+    -10,15,-7,12,3,-22,14,1,-7,-6,10,4,-13,9,-19,-1,13,-4,2,7,5,-17,-15,-10,5,-1,-2,-1,3,9,5,8,
+    2,3,-4,2,-4,-4,0,-3,5,-4,-5,5,-1,-3,6,-1,2,7,-3,0,0,-6,-2,-1,-3,-2,-2,-4,1,1,0,1,
+    -2,-1,0,0,1,0,-1,0,0,1,0,-1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static constexpr float kKlotzScale = 3.05147769e-05f;
+static constexpr int16_t kKlotz[BodyIR::kSize] = {
+    -197,162,305,5045,8670,-9882,-5368,7432,-3555,1387,774,-1622,2484,-1577,959,-168,-66,629,-678,925,-607,504,-15,-133,477,-381,480,-190,185,107,-49,267,
+    -92,234,-8,110,91,35,135,25,111,44,80,64,77,72,74,74,78,98,79,109,74,101,67,78,71,59,90,63,108,74,90,82,
+    72,84,59,88,63,88,88,95,108,84,94,77,88,70,72,75,81,96,81,93,74,81,69,78,87,90,105,83,98,72,85,70,
+    51,62,39,72,79,92,113,198,158,100,124,252,536,377,-29,-194,200,584,226,-677,-1112,-575,61,1109,1932,2739,2867,792,-3020,-7662,-9286,-7651,
+    -2836,1726,4948,10798,11615,6707,-1082,-4793,-3889,-9961,-12837,-14555,-15043,-7894,-4043,5444,14315,14701,15839,11312,5942,3304,1677,5280,10461,13623,12256,5028,-5964,-13626,-15720,-15103,
+    -9071,-3014,78,2703,1338,3265,9379,11642,16300,21290,22293,20683,12286,4461,-3814,-16038,-22085,-28039,-32767,-28408,-23036,-15313,-1948,10707,19309,22953,18922,10695,3052,-3821,-3603,793,
+    1765,2086,-32,-4787,-10319,-16237,-18589,-17908,-15141,-10164,-6167,-2162,2898,6273,11502,17843,18913,18463,16094,9171,1515,-7979,-15519,-17564,-16912,-12241,-7007,-3572,-59,2325,5045,7836,
+    11195,14743,13404,7755,-461,-8085,-10790,-10261,-6897,-1674,1014,1222,485,-989,-956,783,2964,5940,9269,11472,10879,8989,6871,3512,28,-4053,-8570,-11883,-13871,-13457,-10450,-6683,
+    -3118,1191,5726,8488,10207,11141,11863,13263,12776,11212,8757,5083,2241,-1798,-4043,-4613,-6329,-5668,-5867,-6037,-4291,-4159,-3298,-2766,-4150,-5046,-4722,-3184,-829,2166,6202,10175,
+    11801,11701,9468,5596,2784,98,-1616,-2604,-4319,-5369,-6667,-7848,-7920,-7091,-5033,-3282,-1732,-58,182,-182,143,1704,4702,7095,7306,6442,4333,839,-1666,-3003,-3158,-1995,
+    -1950,-3383,-5203,-6612,-6631,-4988,-2133,1261,4101,4512,2703,22,-2637,-3985,-3814,-2586,-872,1037,2779,3912,4796,5310,5141,4608,3781,2774,1958,458,-1390,-2452,-3099,-2047,
+    -26,923,1078,-900,-4392,-8043,-11815,-13131,-12375,-10667,-7192,-4095,-1002,3145,6388,9066,10613,10135,8704,6031,3207,1680,1050,1382,1925,1848,1269,-142,-1902,-3520,-5076,-5653,
+    -5258,-4450,-3369,-2679,-2012,-1377,-1268,-770,135,1315,2932,4110,4807,5407,5786,6080,6703,7350,7509,7271,5929,3844,1795,-665,-2892,-4958,-6913,-7963,-8066,-6976,-4883,-2006,
+    1033,3333,4511,4438,3737,2669,1957,1792,1906,2676,3138,3279,3133,2106,665,-1333,-3726,-6207,-8194,-8928,-8201,-6162,-3987,-1668,346,1215,1858,2107,2552,3852,5077,6034,
+    6305,5706,4470,2875,1416,345,-291,-1195,-2441,-3988,-5942,-7449,-8315,-8192,-6635,-3988,-621,2896,6239,9014,10697,10975,9931,7832,4551,494,-3897,-7945,-10534,-11640,-11043,-8788,
+    -5901,-2718,108,2048,3479,4428,5224,6115,6832,7115,6527,5079,2814,163,-2022,-3691,-4584,-4603,-4272,-3632,-2659,-1468,103,2079,3950,5356,5967,5378,3810,1545,-953,-3043,
+    -4559,-5353,-5559,-5461,-5012,-4180,-2712,-680,1411,3311,4321,3987,2612,629,-1183,-2364,-2679,-2246,-1864,-1745,-1981,-2537,-2869,-2761,-2054,-1055,-225,112,-328,-1007,-1599,-1670,
+    -953,115,1453,2447,2839,2698,2031,1293,382,-397,-1094,-1792,-2148,-2596,-2617,-2128,-1547,-560,415,1260,1968,2294,2355,2190,1853,1409,1089,938,1033,1510,1992,2388,
+    2658,2655,2495,2173,1876,1654,1332,1101,864,400,-98,-754,-1623,-2335,-2965,-3338,-3077,-2495,-1558,-274,1076,2616,4024,5134,6021,6497,6538,5953,4927,3584,1925,374,
+    -1143,-2374,-3283,-4270,-5070,-5858,-6421,-6349,-5802,-4582,-2924,-1125,744,2333,3493,4189,4433,4248,3628,2659,1477,270,-806,-1674,-2257,-2476,-2395,-2061,-1506,-739,265,1275,
+    2147,2761,2934,2692,1964,861,-318,-1450,-2419,-3120,-3538,-3709,-3712,-3737,-3631,-3077,-2044,-469,1404,3233,4651,5248,5159,4439,3316,2139,858,-298,-1326,-2259,-2732,-2796,
+    -2567,-2022,-1399,-853,-395,-34,426,1125,1932,2653,3017,2792,2047,996,-175,-1268,-2174,-2905,-3481,-3854,-3977,-3779,-3154,-2080,-585,1201,3056,4842,6296,7039,6915,5881,
+    3993,1656,-804,-3087,-4749,-5715,-5967,-5545,-4793,-3883,-2918,-2028,-1191,-400,334,969,1350,1385,1098,556,-76,-675,-1130,-1318,-1357,-1299,-1080,-833,-481,99,649,1071,
+    1343,1233,843,332,-243,-667,-1005,-1356,-1702,-2020,-2141,-2038,-1566,-676,468,1879,3302,4470,5301,5628,5498,5058,4397,3669,2929,2137,1299,381,-530,-1284,-1872,-2211,
+    -2287,-2202,-1981,-1647,-1230,-686,32,862,1786,2678,3373,3866,4101,4140,4006,3597,2947,2015,859,-366,-1595,-2748,-3775,-4594,-5148,-5386,-5245,-4765,-3936,-2752,-1288,355,
+    2002,3414,4401,4810,4591,3919,2977,1921,863,-263,-1463,-2659,-3746,-4579,-5066,-5169,-4816,-4034,-2979,-1688,-254,1247,2749,3946,4600,4521,3619,2074,149,-1732,-3208,-4178,
+    -4576,-4491,-4048,-3240,-2114,-728,840,2414,3814,4826,5271,5067,4248,2937,1288,-534,-2384,-4076,-5481,-6437,-6694,-6206,-5011,-3267,-1315,608,2294,3656,4708,5405,5711,5534,
+    4826,3665,2220,564,-1131,-2438,-3230,-3545,-3436,-2984,-2236,-1471,-747,67,763,1225,1430,1321,978,404,-229,-673,-1034,-1290,-1355,-1325,-1159,-829,-301,495,1466,2467,
+    3293,3653,3457,2853,1966,857,-335,-1461,-2537,-3614,-4610,-5299,-5532,-5301,-4558,-3418,-2063,-560,946,2301,3385,4172,4649,4667,4192,3333,2238,1069,-32,-928,-1597,-2135,
+    -2578,-2837,-2833,-2523,-1848,-844,356,1574,2627,3374,3718,3645,3260,2690,1968,1154,344,-413,-1089,-1639,-1939,-1951,-1693,-1247,-787,-348,45,458,935,1409,1948,2471,
+    2814,2936,2789,2428,1935,1321,628,-170,-1141,-2245,-3345,-4228,-4688,-4610,-3990,-2921,-1544,-43,1431,2758,3819,4521,4772,4525,3773,2581,1096,-461,-1904,-3181,-4218,-4923,
+    -5288,-5308,-4943,-4128,-2836,-1171,640,2332,3635,4374,4514,4149,3476,2619,1663,686,-345,-1400,-2444,-3414,-4134,-4528,-4557,-4193,-3445,-2375,-1092,291,1630,2807,3601,3817,
+    3397,2369,1008,-411,-1657,-2518,-2986,-3075,-2829,-2364,-1672,-725,414,1659,2832,3679,4007,3727,2917,1811,676,-319,-1098,-1678,-2134,-2504,-2825,-3043,-3057,-2835,-2363,-1713,
+    -935,-83,742,1459,1922,2076,1932,1501,887,214,-360,-704,-773,-624,-416,-280,-313,-495,-727,-878,-823,-555,-114,396,846,1152,1243,1132,925,687,451,243,
+    15,-213,-419,-586,-627,-542,-301,28,293,482,576,586,567,507,426,383,389,480,649,863,1121,1349,1447,1316,919,339,-266,-683,-759,-440,176,922,
+    1615,2044,2155,1962,1528,999,445,-65,-495,-854,-1111,-1276,-1355,-1344,-1236,-1038,-776,-445,-46,439,991,1504,1887,2046,1924,1537,941,209,-589,-1371,-2060,-2607,
+    -2950,-3049,-2888,-2403,-1630,-627,483,1461,2174,2475,2326,1854,1151,401,-313,-997,-1572,-2008,-2255,-2240,-2012,-1635,-1176,-764,-454,-260,-146,-1,222,540,901,1190,
+    1315,1235,982,646,327,36,-206,-386,-513,-573,-587,-533,-399,-234,-64,63,131,127,39,-129,-370,-632,-871,-1041,-1084,-930,-519,134,930,1689,2249,2472,
+    2324,1875,1213,466,-264,-919,-1482,-1929,-2256,-2451,-2478,-2368,-2084,-1675,-1227,-754,-343,8,300,528,742,896,949,890,728,513,302,101,-105,-307,-505,-661,
+    -708,-592,-255,291,952,1586,1992,2018,1654,958,103,-692,-1305,-1638,-1688,-1507,-1143,-698,-222,237,622,893,1024,1024,920,776,634,530,498,538,653,786,
+    899,992,1072,1099,1002,749,310,-246,-780,-1149,-1252,-1053,-607,-30,595,1120,1504,1735,1821,1895,1940,1962,1937,1761,1439,926,262,-427,-1105,-1718,-2215,-2590,
+    -2764,-2666,-2299,-1666,-860,-4,784,1389,1751,1861,1789,1586,1314,987,545,27,-525,-1011,-1304,-1385,-1262,-1047,-854,-759,-821,-1001,-1223,-1406,-1481,-1431,-1296,-1123,
+    -964,-880,-882,-961,-1072,-1181,-1239,-1198,-1032,-654,-76,626,1331,1831,2001,1792,1237,450,-409,-1217,-1861,-2258,-2425,-2336,-2035,-1552,-888,-139,657,1396,1938,2245,
+    2267,2033,1660,1207,734,273,-207,-669,-1057,-1328,-1419,-1331,-1099,-777,-440,-127,155,429,746,1135,1540,1856,1958,1747,1250,571,-134,-717,-1098,-1222,-1118,-851,
+    -482,-86,298,618,825,900,826,610,293,-90,-505,-872,-1131,-1258,-1263,-1153,-917,-572,-182,177,427,489,361,86,-221,-421,-475,-318,8,398,784,1012,
+    1030,854,509,117,-242,-522,-655,-664,-587,-405,-157,114,358,483,460,282,3,-283,-522,-658,-654,-522,-291,-2,302,620,938,1210,1397,1424,1241,877,
+    436,59,-143,-116,111,448,751,875,770,444,-9,-484,-884,-1099,-1093,-875,-494,-31,423,807,1069,1144,1030,770,458,160,-63,-185,-276,-346,-445,-551,
+    -602,-605,-522,-396,-244,-84,16,80,114,124,162,216,241,223,103,-145,-487,-872,-1195,-1407,-1518,-1550,-1538,-1469,-1327,-1111,-838,-518,-198,53,222,265,
+    224,178,160,204,257,253,154,-60,-329,-584,-762,-841,-836,-788,-724,-634,-522,-356,-128,133,384,563,638,567,341,-3,-428,-875,-1283,-1604,-1767,-1710,
+    -1390,-790,-20,785,1491,1928,2080,1982,1705,1355,992,731,609,565,571,557,496,414,269,80,-113,-323,-531,-712,-805,-758,-535,-141,279,587,780,923,
+    909,680,397,72,-300,-704,-1090,-1380,-1595,-1582,-1262,-717,-84,443,859,1112,1167,1161,1134,1096,1081,1035,870,613,270,-154,-585,-952,-1089,-1028,-884,-606,
+    -234,154,472,661,738,667,447,224,86,19,92,234,321,346,318,328,366,408,533,690,800,832,715,436,71,-315,-608,-757,-818,-772,-660,-548,
+    -397,-214,8,269,489,647,732,693,573,431,265,106,-46,-224,-396,-541,-616,-581,-452,-229,-6,77,24,-102,-202,-195,-106,55,257,405,423,275,
+    3,-335,-676,-932,-1049,-1045,-957,-803,-650,-476,-289,-175,-88,-46,-36,-17,-13,17,23,-55,-192,-390,-614,-816,-953,-936,-773,-540,-234,91,373,585,
+    687,696,623,482,279,31,-234,-482,-636,-665,-537,-288,7,339,640,867,997,1024,972,814,541,194,-161,-474,-675,-673,-477,-127,272,612,851,960,
+    980,956,907,829,718,552,305,10,-300,-581,-783,-883,-868,-729,-517,-321,-137,13,96,111,45,-37,-81,-44,114,357,640,893,1039,1066,973,789,
+    610,458,356,336,331,318,268,145,-19,-174,-268,-288,-231,-148,-54,66,189,359,543,684,796,833,814,753,627,471,258,-40,-422,-870,-1298,-1594,
+    -1655,-1435,-980,-407,165,649,985,1165,1270,1341,1348,1313,1232,1040,681,241,-168,-564,-934,-1215,-1341,-1371,-1360,-1229,-1002,-734,-467,-224,-19,93,157,213,
+    228,208,121,-95,-427,-830,-1202,-1419,-1448,-1236,-803,-300,161,535,790,866,774,603,421,230,25,-153,-320,-443,-473,-465,-450,-458,-504,-589,-716,-825,
+    -861,-815,-722,-609,-499,-424,-364,-263,-59,221,515,770,922,944,853,725,634,612,640,671,637,478,230,-67,-341,-553,-685,-648,-493,-262,44,352,
+    671,975,1197,1305,1265,1118,915,664,418,205,-5,-209,-430,-623,-713,-721,-607,-358,-47,275,532,674,704,630,485,329,194,67,-61,-223,-405,-541,
+    -604,-588,-523,-465,-423,-395,-375,-327,-254,-146,5,112,142,83,-32,-114,-129,-34,145,323,423,409,323,189,58,-36,-79,-95,-142,-206,-267,-278,
+    -235,-131,72,313,544,707,739,663,493,237,-59,-368,-622,-730,-665,-386,40,477,856,1071,1096,972,754,544,411,406,527,711,872,952,931,774,
+    521,224,-93,-405,-721,-1006,-1195,-1251,-1155,-933,-625,-283,56,354,554,649,645,524,283,-58,-466,-865,-1163,-1277,-1184,-938,-619,-333,-137,-48,-36,-36,
+    -21,25,78,107,63,-86,-296,-549,-791,-963,-1045,-1008,-869,-669,-437,-211,-14,126,166,131,42,-59,-92,-73,-27,26,33,-2,-61,-130,-166,-128,
+    -24,117,269,365,388,325,172,16,-103,-148,-95,8,131,241,333,414,447,408,295,118,-95,-310,-488,-569,-539,-418,-216,0,187,350,503,682,
+    883,1052,1138,1101,928,664,370,125,-12,-38,26,119,197,258,287,291,299,324,394,487,568,650,690,703,676,537,320,10,-337,-613,-790,-813,
+    -709,-537,-352,-206,-104,-55,-16,50,156,304,439,546,574,498,358,162,-33,-209,-369,-497,-614,-686,-666,-545,-335,-84,176,396,544,621,628,579,
+    486,338,117,-182,-512,-795,-938,-880,-645,-298,48,293,398,346,198,13,-157,-265,-350,-414,-436,-433,-388,-305,-195,-39,105,209,262,210,95,-79,
+    -327,-592,-870,-1113,-1246,-1230,-1033,-691,-280,117,447,666,774,811,809,834,861,857,821,686,450,130,-238,-575,-826,-946,-963,-909,-798,-633,-415,-158,
+    122,378,594,740,788,755,651,498,312,101,-150,-421,-668,-838,-859,-726,-456,-153,105,284,330,306,248,201,240,310,384,438,441,415,347,277,
+    242,232,263,301,314,315,286,224,151,58,-61,-161,-207,-181,-66,98,272,421,504,525,491,437,406,380,364,346,276,147,-38,-257,-449,-552,
+    -531,-385,-178,47,279,484,653,769,801,734,561,298,-18,-334,-613,-817,-932,-974,-965,-936,-853,-688,-410,-5,439,842,1124,1243,1212,1024,748,473,
+    208,-29,-226,-391,-506,-584,-600,-543,-447,-292,-92,112,316,513,667,767,765,622,390,117,-109,-232,-301,-299,-224,-149,-133,-166,-182,-165,-116,-11,
+    146,281,335,307,176,-38,-293,-509,-628,-681,-642,-536,-395,-196,19,230,410,518,548,513,425,299,176,41,-136,-354,-601,-832,-1022,-1083,-947,-676,
+    -323,20,254,372,358,250,112,-26,-109,-160,-198,-198,-176,-122,-46,48,186,321,396,406,347,208,0,-269,-565,-836,-1041,-1127,-1049,-805,-447,-56,
+    287,510,596,576,493,397,333,326,366,420,457,433,357,270,188,136,110,94,79,54,32,43,106,210,332,448,545,597,591,555,506,441,
+    323,147,-60,-266,-396,-396,-244,44,381,683,878,918,822,652,468,285,101,-62,-200,-317,-393,-422,-401,-307,-136,54,218,341,418,449,427,360,
+    238,60,-122,-266,-345,-344,-283,-202,-139,-126,-144,-171,-207,-203,-149,-66,35,97,90,8,-135,-278,-369,-385,-329,-219,-78,73,222,353,441,447,
+    357,182,-64,-349,-628,-836,-924,-914,-842,-749,-663,-555,-405,-195,87,388,660,852,908,845,698,533,401,297,228,182,128,57,-41,-157,-253,-302,
+    -299,-240,-135,6,177,340,454,493,420,262,68,-122,-240,-292,-301,-281,-269,-292,-341,-404,-453,-444,-379,-268,-126,13,106,121,90,41,1,-11,
+    -13,-23,-49,-84,-125,-157,-180,-185,-171,-150,-98,-36,52,177,293,395,430,361,233,91,-5,-2,83,218,344,391,334,178,-25,-212,-352,-426,
+    -425,-355,-244,-101,53,212,397,576,726,817,817,734,570,341,79,-209,-490,-703,-808,-765,-577,-293,33,322,529,630,622,554,458,373,325,306,
+    317,327,306,244,166,102,64,40,-8,-72,-158,-235,-266,-268,-217,-134,-53,35,92,130,151,155,165,124,15,-134,-310,-439,-475,-411,-266,-111,
+    2,28,-66,-222,-379,-503,-561,-547,-473,-342,-191,-54,74,189,291,372,409,420,400,355,313,262,191,84,-61,-217,-339,-401,-408,-364,-297,-224,
+    -178,-170,-162,-153,-128,-80,-19,47,88,75,0,-104,-194,-235,-210,-135,-41,39,93,112,79,-10,-144,-310,-486,-657,-788,-834,-785,-633,-430,-238,
+    -103,-63,-72,-92,-85,-18,70,162,212,178,76,-68,-181,-218,-184,-77,79,237,352,409,411,366,297,216,142,78,30,13,17,30,30,-7,
+    -64,-103,-89,-12,124,300,464,576,613,553,426,264,105,-18,-87,-103,-106,-114,-136,-165,-153,-87,24,155,276,357,387,379,334,263,194,127,
+    66,24,8,18,65,126,164,148,39,-124,-279,-367,-347,-237,-52,127,208,178,31,-178,-381,-555,-655,-653,-564,-405,-205,9,222,419,564,622,
+    574,411,171,-123,-443,-738,-1002,-1204,-1303,-1290,-1133,-866,-542,-191,107,313,428,438,379,292,205,162,158,172,195,181,130,67,9,-30,-68,-108,
+    -137,-166,-189,-181,-153,-99,-22,55,129,184,234,300,365,428,461,428,323,175,44,-38,-60,-8,69,117,106,9,-134,-284,-408,-479,-482,-406,
+    -284,-144,-14,83,146,170,152,97,10,-82,-154,-191,-187,-175,-171,-177,-187,-159,-106,-31,68,155,205,197,133,24,-111,-244,-342,-399,-424,-416,
+    -416,-427,-428,-388,-269,-92,125,362,571,726,799,770,649,441,170,-110,-389,-612,-721,-723,-615,-438,-249,-102,-31,0,29,87,190,315,425,471,
+    437,335,200,80,7,-2,48,138,236,306,337,338,311,285,265,235,220,218,229,246,248,225,154,65,-10,-38,0,94,228,351,429,444,
+    388,273,123,-17,-136,-218,-265,-306,-351,-413,-463,-455,-392,-279,-136,-7,110,195,239,255,229,199,174,128,87,53,36,51,76,87,40,-67,
+    -197,-323,-388,-351,-231,-69,74,131,84,-43,-231,-426,-577,-678,-684,-600,-485,-334,-158,13,153,238,280,245,126,-26,-174,-292,-390,-462,-503,-521,
+    -485,-393,-258,-101,42,160,218,195,99,-33,-161,-256,-259,-172,-27,155,305,412,488,517,528,508,434,344,232,114,16,-73,-130,-156,-162,-140,
+    -117,-82,-7,96,213,293,296,233,127,15,-55,-45,24,122,188,175,90,-52,-206,-328,-392,-367,-270,-141,-3,111,187,236,239,224,189,115,
+    49,6,-4,9,28,39,21,-10,-43,-53,-35,1,45,73,86,65,14,-55,-132,-184,-206,-198,-191,-214,-244,-269,-260,-187,-57,110,273,388,
+    442,430,339,187,-2,-207,-411,-593,-714,-765,-733,-592,-394,-209,-74,-8,18,34,74,174,303,416,470,449,360,213,57,-73,-145,-146,-117,-71,
+    -31,-14,-8,-17,-25,-28,-23,3,57,145,250,340,382,369,313,230,150,93,73,62,26,-37,-139,-279,-428,-560,-643,-656,-581,-449,-321,-201,
+    -114,-55,12,60,94,99,51,-23,-131,-259,-356,-407,-399,-329,-220,-85,61,198,346,468,505,442,278,51,-184,-368,-451,-429,-333,-228,-163,-160,
+    -227,-336,-454,-519,-521,-449,-289,-107,87,275,421,517,526,452,302,100,-96,-256,-375,-443,-471,-477,-434,-357,-254,-114,27,160,250,266,215,99,
+    -45,-178,-258,-255,-176,-53,81,196,274,319,323,312,292,230,144,58,-25,-114,-192,-214,-193,-152,-78,15,119,255,423,575,663,660,566,422,
+    254,115,55,45,60,60,6,-89,-229,-386,-511,-573,-540,-423,-269,-115,27,144,215,233,200,153,91,14,-20,-11,31,76,90,78,37,-8,
+    -38,-56,-60,-62,-71,-97,-157,-232,-307,-381,-410,-380,-312,-229,-169,-125,-80,-21,63,168,278,351,379,357,250,69,-131,-315,-480,-612,-683,-694,
+    -631,-491,-321,-169,-78,-73,-151,-296,-444,-518,-510,-426,-297,-165,-51,20,58,92,117,154,217,280,315,313,263,187,105,9,-77,-149,-190,-182,
+    -127,-16,95,194,279,337,390,422,439,460,469,452,389,271,126,-30,-194,-319,-375,-357,-273,-166,-51,49,123,188,233,262,260,221,155,50,
+    -78,-199,-284,-324,-319,-265,-188,-84,55,208,350,444,438,342,177,-26,-191,-291,-312,-271,-229,-213,-257,-358,-477,-588,-640,-602,-467,-263,-29,209,
+    411,558,628,605,487,296,69,-153,-325,-450,-524,-538,-515,-441,-331,-190,-14,155,309,416,448,420,323,189,59,-35,-57,-17,70,180,280,364,
+    413,428,428,400,344,277,187,88,6,-51,-76,-68,-31,17,70,151,263,381,466,481,412,254,46,-154,-301,-355,-324,-236,-133,-57,-34,-53,
+    -105,-165,-188,-183,-157,-124,-109,-102,-127,-177,-244,-323,-380,-421,-414,-338,-229,-95,43,143,196,220,234,237,227,223,203,143,62,-38,-162,-298,
+    -410,-480,-500,-471,-431,-373,-298,-217,-104,28,171,302,391,427,378,258,98,-80,-239,-370,-464,-503,-485,-401,-252,-87,65,178,206,161,62,-47,
+    -105,-118,-85,-12,49,86,91,70,41,21,42,89,140,189,221,224,192,145,72,-14,-97,-171,-195,-171,-111,-25,62,141,198,236,262,279,
+    301,299,255,176,54,-99,-280,-465,-608,-691,-695,-632,-527,-395,-254,-107,42,180,289,355,374,338,251,132,18,-77,-145,-176,-173,-143,-87,7,
+    111,205,257,238,159,20,-128,-224,-240,-170,-58,58,147,166,110,-2,-140,-261,-316,-307,-234,-114,3,123,219,245,215,121,4,-103,-200,-243,
+    -260,-278,-287,-307,-316,-310,-293,-239,-165,-101,-54,-35,-57,-108,-175,-231,-243,-201,-114,-11,96,178,218,223,188,133,70,-11,-105,-191,-273,-348,
+    -382,-381,-339,-259,-167,-48,93,250,399,498,526,459,306,99,-105,-243,-298,-279,-213,-129,-64,-46,-80,-150,-212,-249,-252,-214,-165,-125,-94,-85,
+    -103,-149,-222,-294,-349,-367,-319,-231,-117,-1,84,146,178,181,178,169,159,144,113,64,-3,-88,-185,-280,-336,-348,-327,-273,-203,-108,12,144,
+    291,427,540,601,589,507,358,175,-21,-206,-368,-500,-581,-591,-512,-376,-213,-47,72,116,78,-5,-85,-128,-103,-30,73,183,265,309,304,263,
+    214,158,113,76,41,13,-22,-46,-68,-95,-110,-126,-105,-36,70,205,325,421,482,488,454,399,340,287,231,171,122,73,7,-73,-157,-221,
+    -251,-246,-212,-170,-131,-93,-69,-62,-62,-59,-72,-101,-142,-200,-254,-293,-291,-244,-188,-112,-23,73,179,272,340,353,289,158,-18,-197,-326,-366,
+    -328,-232,-114,-13,43,29,-31,-107,-181,-210,-179,-107,-4,107,213,287,310,295,222,123,39,-31,-61,-62,-50,-23,-6,4,7,15,28,28,
+    25,6,-29,-82,-153,-222,-273,-265,-196,-77,74,211,327,403,420,393,331,246,142,24,-100,-222,-323,-380,-382,-336,-246,-130,4,171,350,509,
+    622,657,606,464,253,42,-126,-224,-249,-224,-167,-122,-117,-139,-169,-193,-197,-162,-101,-35,26,63,75,59,15,-52,-119,-162,-169,-125,-44,50,
+    144,210,241,242,225,212,196,179,174,168,161,140,93,33,-33,-89,-126,-151,-161,-157,-145,-125,-81,-11,68,149,223,269,271,224,140,59,
+    -20,-96,-160,-204,-197,-158,-91,-5,61,90,44,-59,-180,-290,-336,-308,-209,-60,104,250,359,421,429,416,380,330,278,209,144,73,1,-69,
+    -145,-201,-244,-245,-186,-94,30,155,260,327,339,322,288,242,187,127,71,18,-39,-115,-202,-280,-328,-333,-296,-223,-125,-27,57,118,154,161,
+};
+
+static constexpr float kLanghofScale = 2.96460457e-05f;
+static constexpr int16_t kLanghof[BodyIR::kSize] = {
+    -141,178,243,3703,5133,-9806,-3920,6279,-3055,1429,554,-1164,2064,-1343,877,-180,17,494,-524,779,-501,462,-27,-55,392,-292,412,-159,184,80,-23,214,
+    -77,196,-4,111,80,51,122,31,110,52,85,68,78,73,75,70,70,79,59,84,56,85,62,76,71,58,82,52,81,57,73,70,
+    65,82,62,77,60,76,67,70,69,53,70,56,71,61,66,68,66,74,61,77,65,69,56,62,70,60,70,51,77,61,75,61,
+    46,93,49,57,38,66,84,73,108,28,115,204,158,257,291,242,195,13,-61,-229,-151,262,430,1021,1400,1924,2260,1364,-244,-3933,-8412,-12301,
+    -13773,-11324,-6443,2773,15396,23507,24173,22566,13802,-858,-14695,-29984,-32767,-26450,-18793,-2548,7779,13681,18350,15787,13105,7588,4536,4284,850,2738,3228,224,2236,1488,-1063,-2545,
+    -7118,-7448,-4901,-1217,5476,6169,5634,7107,4858,4506,5671,6029,8029,10370,10833,6532,-189,-6819,-12837,-14006,-11060,-7682,-3575,882,1474,-1688,-4595,-6402,-7322,-7826,-6539,-4265,
+    -1627,3274,7793,8966,5915,814,-4244,-6932,-5308,-3022,-1589,-1683,-3769,-7315,-10869,-11713,-11203,-7646,-1639,2803,7594,11592,12803,12513,10704,7268,3696,902,-2126,-4713,-6880,-8287,
+    -6951,-3969,-1168,542,1492,1772,3017,5923,7582,9205,10167,8757,5860,1956,-831,-2142,-783,1762,2765,2270,-1043,-4787,-7431,-9595,-10614,-9748,-7002,-3168,1140,3158,4183,5497,
+    5465,5894,6451,5872,4734,3112,-235,-4591,-8128,-10943,-11576,-9670,-6750,-4210,-1689,1492,4327,7478,10448,12082,12056,10110,7455,5217,4054,3507,2938,1256,-1870,-4487,-5954,-5680,
+    -4145,-2386,-726,-550,461,2814,4484,6363,6323,4239,1708,-1233,-2251,-1095,1561,3897,4046,2519,-897,-4930,-8332,-10796,-11934,-11490,-9367,-6048,-1859,2036,5396,7431,7691,7415,
+    6260,5243,4397,2853,1363,-630,-2719,-4234,-5401,-5748,-5157,-3774,-1274,1768,4057,5375,5121,3530,2087,987,762,1916,3834,5797,6827,6195,3696,-339,-4942,-8988,-11388,-11950,
+    -11001,-8749,-6244,-3989,-1848,-426,187,462,750,1252,2115,3241,3664,2923,1530,-752,-3548,-5805,-7509,-8270,-7899,-6297,-3437,-634,1221,1781,1283,532,164,426,1193,2164,
+    2276,1345,-181,-1825,-2691,-2478,-1342,-92,1026,1814,2155,2987,4604,6868,8867,9709,9332,8131,6980,6306,6139,5469,3534,879,-1899,-3949,-4596,-4021,-2828,-1623,-1056,-1046,
+    -1132,-1119,-126,1833,3593,4822,5005,3841,2156,263,-1237,-1844,-2263,-2470,-2410,-2139,-1638,-1610,-1915,-2330,-2906,-3068,-2696,-1858,-610,629,1635,2291,2557,2632,2538,2168,
+    1659,1196,912,570,-255,-1362,-2759,-4107,-4433,-3833,-2406,-322,1692,3211,3896,3940,3441,2468,1313,-116,-1599,-2889,-3767,-3909,-3534,-3226,-2984,-2476,-1627,-448,590,1176,
+    1142,510,-321,-1305,-2131,-2733,-2927,-2434,-1457,149,1871,3151,3756,3529,2765,1676,849,342,66,129,-50,-330,-430,-469,-313,-35,417,963,1288,1609,1919,1966,
+    2037,2089,1914,1699,1543,1226,638,-1,-786,-1509,-1753,-1582,-871,261,1396,2374,3051,3184,2834,2106,979,-198,-1461,-2898,-4127,-5019,-5402,-5197,-4733,-4341,-4012,-3702,
+    -3214,-2281,-1050,502,1929,2735,3158,3017,2545,2275,1957,1528,939,-3,-1037,-2000,-2674,-2846,-2825,-2479,-1619,-590,399,982,915,329,-509,-1114,-1318,-1184,-704,-374,
+    -476,-606,-742,-805,-754,-905,-1082,-1218,-1041,-220,1047,2742,4418,5603,6168,6059,5438,4254,2760,1210,-420,-1850,-2917,-3535,-3624,-3180,-2286,-1189,2,1132,1833,1943,
+    1564,872,151,-321,-336,64,619,1154,1527,1724,1861,1884,1669,1238,680,-42,-841,-1416,-1648,-1533,-1044,-381,188,611,722,334,-379,-1149,-1805,-2262,-2525,-2530,
+    -2196,-1524,-498,747,1808,2429,2552,2180,1656,1315,1228,1350,1480,1505,1318,845,218,-529,-1257,-1662,-1626,-1194,-552,92,495,489,246,-50,-327,-412,-248,45,
+    291,319,51,-416,-897,-1248,-1349,-1136,-661,-104,358,620,611,367,-4,-338,-585,-845,-1080,-1296,-1484,-1530,-1459,-1253,-858,-261,381,920,1381,1571,1404,1003,
+    426,-157,-585,-726,-580,-340,-215,-320,-645,-1027,-1277,-1424,-1478,-1452,-1452,-1445,-1418,-1372,-1277,-1107,-808,-399,73,640,1223,1566,1526,1126,425,-448,-1219,-1696,
+    -1829,-1549,-1009,-445,36,308,227,-175,-667,-1091,-1291,-1132,-615,138,793,1107,1085,839,588,568,835,1243,1618,1780,1636,1295,888,545,439,627,1031,1492,
+    1893,2144,2118,1881,1562,1233,1086,1226,1495,1734,1897,1889,1657,1239,643,-89,-769,-1071,-838,-153,769,1511,1716,1228,175,-1072,-2192,-2867,-2998,-2719,-2159,-1503,
+    -929,-603,-449,-298,-128,203,656,1041,1194,1024,598,17,-490,-842,-1051,-1069,-1019,-983,-1073,-1312,-1662,-2124,-2521,-2706,-2581,-2126,-1391,-518,213,674,810,635,
+    271,-124,-358,-374,-99,463,1058,1566,1933,2050,2020,2027,2074,2132,2172,2016,1529,761,-103,-888,-1492,-1864,-2124,-2399,-2625,-2703,-2520,-2029,-1353,-642,-75,352,
+    792,1178,1555,1933,2138,2101,1765,1270,714,114,-338,-637,-777,-754,-714,-727,-808,-915,-941,-759,-285,394,1092,1660,1961,1943,1694,1343,1031,772,481,121,
+    -378,-1010,-1613,-2093,-2392,-2467,-2442,-2466,-2563,-2634,-2589,-2283,-1571,-613,341,1115,1517,1459,1035,392,-381,-1122,-1672,-1997,-2106,-2018,-1788,-1502,-1176,-847,-598,-429,
+    -287,-2,550,1343,2327,3215,3701,3705,3163,2194,1064,-27,-943,-1634,-2003,-2062,-1934,-1620,-1130,-478,379,1425,2511,3428,4019,4142,3776,3059,2181,1309,580,128,
+    -65,-130,-176,-306,-555,-907,-1280,-1564,-1691,-1536,-1044,-283,623,1494,2093,2205,1847,1108,118,-796,-1411,-1739,-1816,-1715,-1578,-1432,-1225,-918,-490,62,713,1282,
+    1601,1601,1236,660,62,-458,-835,-1131,-1339,-1396,-1307,-1005,-543,-95,247,404,388,241,77,-17,-126,-230,-303,-402,-511,-610,-691,-719,-619,-369,-70,187,
+    332,325,246,222,305,502,749,912,896,650,218,-252,-694,-1033,-1210,-1306,-1364,-1388,-1364,-1267,-1056,-683,-242,176,498,569,367,54,-240,-432,-422,-272,
+    -114,-10,-36,-208,-481,-728,-841,-801,-568,-221,178,595,919,1100,971,470,-285,-1188,-1938,-2296,-2216,-1769,-1131,-467,15,251,321,241,58,-96,-148,-112,
+    -12,80,80,-11,-106,-150,-134,-53,16,-10,-113,-242,-359,-398,-304,-70,272,650,1017,1313,1492,1556,1485,1281,1004,774,641,638,825,1091,1284,1367,
+    1266,924,498,165,-13,26,225,432,514,419,168,-204,-564,-785,-844,-735,-568,-449,-423,-485,-491,-439,-377,-288,-231,-132,102,510,1048,1543,1884,1929,
+    1634,1164,640,106,-373,-751,-1051,-1275,-1419,-1509,-1555,-1526,-1389,-1159,-880,-628,-499,-502,-554,-539,-374,-72,336,732,941,899,608,130,-399,-823,-1077,-1164,
+    -1053,-798,-503,-189,113,301,355,305,76,-320,-756,-1132,-1337,-1289,-997,-571,-108,339,674,890,1014,1063,1103,1112,1105,1100,1072,1140,1321,1511,1595,1408,
+    905,175,-561,-1070,-1273,-1154,-795,-408,-118,82,190,200,177,150,129,140,148,71,-124,-394,-680,-892,-970,-957,-926,-947,-1027,-1122,-1227,-1279,-1231,-1111,
+    -947,-767,-576,-408,-246,-91,-34,-84,-205,-385,-539,-526,-358,-121,145,291,206,-96,-515,-880,-1034,-857,-420,100,572,825,807,574,224,-32,-112,7,
+    280,518,655,691,641,531,333,38,-375,-813,-1082,-1087,-800,-265,335,784,1003,1001,834,605,390,226,130,126,182,228,272,332,431,609,840,1039,
+    1086,930,636,313,101,121,413,883,1373,1756,1903,1803,1551,1214,844,522,271,36,-118,-152,-121,-5,179,348,424,382,238,12,-176,-271,-324,-347,
+    -416,-556,-754,-1013,-1228,-1357,-1359,-1212,-1027,-878,-787,-705,-564,-362,-142,-48,-194,-518,-892,-1198,-1269,-1060,-707,-353,-94,16,-33,-196,-406,-606,-717,-692,
+    -581,-465,-438,-552,-750,-941,-1007,-925,-748,-478,-165,160,487,824,1152,1387,1502,1457,1209,836,433,25,-338,-617,-880,-1116,-1245,-1247,-1110,-819,-401,13,
+    322,478,418,244,92,37,126,257,341,270,-70,-617,-1280,-1891,-2225,-2169,-1731,-1040,-217,645,1440,2118,2620,2812,2656,2235,1634,1002,493,144,-96,-310,
+    -529,-759,-950,-1019,-952,-729,-344,132,623,1029,1257,1288,1145,906,641,330,-73,-567,-1128,-1701,-2137,-2306,-2167,-1713,-1016,-269,377,886,1210,1348,1387,1329,
+    1150,894,607,304,-2,-245,-440,-620,-761,-919,-1078,-1169,-1138,-912,-551,-110,355,716,949,1025,951,823,708,670,668,615,517,374,250,230,267,270,
+    184,23,-167,-256,-108,256,727,1152,1390,1376,1142,741,240,-247,-639,-864,-929,-900,-853,-882,-995,-1132,-1231,-1288,-1304,-1251,-1156,-1012,-768,-428,-35,408,
+    825,1095,1245,1287,1212,1102,982,812,554,259,-26,-295,-441,-429,-309,-87,111,187,114,-94,-284,-386,-356,-174,50,227,272,135,-154,-523,-815,-929,
+    -877,-684,-410,-126,177,497,738,811,693,408,37,-246,-305,-144,158,457,625,637,510,301,88,-76,-157,-172,-152,-152,-236,-421,-639,-759,-741,-635,
+    -480,-328,-250,-245,-251,-249,-187,-29,131,210,186,22,-264,-582,-863,-1111,-1301,-1392,-1423,-1364,-1193,-954,-634,-269,67,298,387,420,463,542,675,805,
+    839,714,432,13,-508,-1001,-1308,-1381,-1237,-915,-525,-103,414,1005,1599,2097,2370,2331,1996,1515,1037,679,495,427,410,381,312,208,102,45,75,240,
+    526,881,1214,1417,1489,1461,1341,1149,907,588,187,-217,-584,-853,-924,-818,-604,-349,-114,39,111,201,315,402,476,482,390,239,57,-79,-141,-129,
+    -81,-124,-287,-545,-828,-1015,-1032,-846,-536,-194,107,241,183,22,-156,-282,-313,-300,-339,-428,-516,-578,-612,-624,-690,-866,-1083,-1266,-1310,-1153,-861,-525,
+    -265,-141,-158,-293,-474,-621,-667,-584,-397,-177,-34,-61,-221,-429,-634,-748,-772,-793,-807,-816,-823,-726,-446,9,565,1162,1700,2026,2162,2134,1925,1620,
+    1238,822,434,87,-153,-282,-293,-172,-12,111,155,119,77,94,222,440,669,855,908,742,390,-48,-459,-741,-860,-869,-851,-819,-720,-544,-272,63,
+    333,468,433,280,122,33,41,92,136,144,87,-53,-261,-490,-688,-790,-749,-558,-289,-17,258,515,759,1015,1209,1309,1310,1164,900,598,348,173,
+    84,101,122,134,168,210,293,396,490,538,508,420,253,62,-68,-124,-128,-158,-272,-471,-727,-938,-1031,-989,-800,-500,-188,6,37,-69,-267,-431,
+    -486,-473,-407,-271,-84,172,486,778,958,947,761,486,258,187,263,440,626,732,715,572,338,67,-179,-355,-397,-336,-274,-229,-228,-242,-178,-27,
+    183,397,555,585,456,253,19,-202,-316,-357,-376,-375,-377,-370,-349,-312,-252,-190,-108,6,141,311,516,748,946,1015,927,670,299,-54,-318,-463,
+    -451,-313,-127,41,156,231,323,506,753,964,1072,1036,890,720,580,479,369,187,-79,-382,-631,-744,-710,-565,-368,-171,-10,90,131,127,85,53,
+    65,69,25,-103,-349,-640,-906,-1120,-1265,-1335,-1368,-1420,-1420,-1323,-1137,-796,-343,118,510,760,872,850,734,588,400,189,-26,-243,-428,-547,-542,-388,
+    -138,135,356,460,469,450,432,472,600,791,958,1031,975,754,467,215,6,-143,-262,-357,-379,-280,-35,303,637,845,858,731,574,497,554,714,
+    907,1057,1099,1009,822,563,294,120,68,115,213,286,297,283,312,374,493,661,744,698,519,206,-137,-430,-604,-639,-584,-456,-296,-127,62,227,
+    340,386,354,258,106,-42,-115,-123,-85,-48,-112,-287,-522,-773,-965,-1046,-978,-811,-631,-482,-460,-562,-678,-735,-684,-552,-415,-327,-302,-310,-299,-253,
+    -203,-211,-325,-502,-649,-683,-565,-327,-31,249,437,520,474,280,21,-227,-415,-505,-522,-537,-580,-604,-604,-559,-419,-244,-97,-10,-20,-95,-174,-188,
+    -108,27,171,260,263,203,115,38,-7,-2,47,111,169,240,353,514,729,933,1031,987,807,532,218,-16,-105,-58,128,352,501,556,543,515,
+    507,510,481,406,304,229,244,358,513,598,537,318,19,-243,-416,-457,-371,-243,-109,-14,-7,-91,-222,-331,-379,-332,-235,-201,-234,-325,-472,-586,
+    -624,-589,-493,-385,-298,-245,-197,-102,42,222,397,506,530,479,374,245,100,-26,-116,-207,-271,-279,-224,-70,149,361,472,448,311,79,-155,-312,
+    -351,-251,-65,113,178,98,-76,-265,-394,-447,-461,-458,-457,-454,-383,-251,-115,-27,-67,-218,-381,-494,-488,-327,-69,230,527,776,918,928,837,659,
+    474,348,223,112,50,12,31,133,310,515,672,751,696,511,298,122,40,74,170,272,321,302,226,82,-95,-258,-406,-529,-619,-653,-596,-432,
+    -158,137,370,496,464,296,48,-239,-509,-692,-772,-805,-835,-881,-901,-827,-635,-352,-46,232,427,553,667,774,856,845,662,344,-34,-387,-598,-632,
+    -519,-305,-41,229,430,547,579,547,551,585,596,584,492,301,59,-196,-421,-589,-708,-796,-882,-954,-979,-919,-743,-475,-167,102,285,386,382,285,
+    136,-51,-248,-442,-623,-755,-794,-692,-460,-180,87,278,339,308,245,196,223,366,587,777,846,738,492,211,-37,-202,-257,-225,-139,24,283,633,
+    1025,1326,1450,1369,1114,788,496,300,191,167,208,244,264,235,130,36,1,13,63,105,100,32,-59,-122,-133,-79,7,68,58,-35,-177,-302,
+    -345,-279,-133,19,149,237,259,235,191,148,106,67,19,-52,-92,-60,34,161,255,254,143,-56,-306,-556,-728,-772,-707,-601,-535,-564,-651,-730,
+    -754,-689,-559,-441,-358,-317,-278,-172,-46,41,26,-135,-395,-680,-861,-903,-809,-563,-271,15,233,299,230,82,-51,-134,-141,-75,-13,22,35,39,
+    51,84,128,145,123,54,-16,-30,63,279,547,808,1007,1097,1058,911,702,458,214,10,-164,-293,-312,-209,12,329,631,833,886,777,531,197,
+    -121,-339,-432,-433,-429,-474,-534,-580,-559,-428,-228,-4,189,320,447,580,701,756,675,443,72,-319,-635,-847,-880,-771,-561,-263,27,247,378,450,
+    505,558,626,671,634,504,293,32,-215,-408,-530,-590,-648,-704,-746,-746,-629,-395,-87,237,530,730,786,716,542,305,65,-152,-349,-509,-593,-587,
+    -469,-257,-17,200,365,461,491,487,506,576,709,840,854,714,426,51,-297,-565,-708,-748,-751,-698,-574,-359,-83,176,354,349,192,-46,-320,-508,
+    -583,-555,-408,-181,51,203,259,226,134,47,-12,-54,-99,-158,-232,-296,-324,-289,-190,-85,-3,25,-16,-59,-58,4,123,264,394,460,455,399,
+    280,152,57,-26,-100,-147,-153,-84,94,355,625,855,986,985,849,601,323,101,-31,-108,-175,-290,-468,-643,-774,-805,-724,-591,-448,-314,-152,41,
+    257,467,556,483,270,-36,-334,-553,-672,-681,-582,-420,-258,-147,-92,-70,-46,42,183,346,494,557,529,412,250,92,-57,-182,-310,-453,-594,-690,
+    -670,-536,-307,-19,252,454,568,568,461,305,129,-58,-246,-425,-564,-616,-545,-380,-177,15,144,178,120,-18,-163,-226,-196,-86,39,107,107,58,
+    26,47,134,254,331,385,431,505,654,815,918,913,781,563,329,147,42,20,95,235,364,446,455,388,302,238,213,216,218,195,126,27,
+    -64,-124,-145,-148,-161,-228,-359,-486,-564,-571,-484,-351,-215,-99,-39,-54,-120,-190,-254,-310,-374,-468,-568,-638,-643,-576,-447,-293,-159,-56,-19,-47,
+    -78,-73,8,143,253,286,213,71,-83,-181,-179,-138,-91,-53,-37,17,118,224,288,251,92,-139,-370,-530,-585,-519,-321,-54,213,410,465,393,
+    222,21,-154,-314,-445,-568,-699,-810,-869,-831,-687,-462,-213,-19,97,153,174,202,260,332,383,393,343,214,48,-112,-237,-306,-330,-322,-280,-169,
+    17,276,581,856,1074,1181,1124,933,657,391,186,48,-54,-187,-350,-551,-722,-761,-687,-522,-322,-157,-23,111,262,406,505,501,368,141,-127,-381,
+    -582,-682,-671,-566,-405,-254,-137,-65,-4,98,238,417,597,708,717,625,462,270,88,-49,-161,-295,-434,-552,-622,-604,-483,-294,-80,124,267,317,
+    297,235,163,107,45,-29,-92,-133,-123,-55,42,146,210,206,111,-77,-283,-442,-487,-412,-285,-145,-77,-98,-145,-187,-193,-173,-163,-195,-247,-269,
+    -238,-144,-28,41,20,-66,-172,-271,-312,-279,-153,55,284,489,604,615,554,455,369,303,258,210,126,22,-97,-199,-237,-218,-178,-159,-186,-261,
+    -350,-411,-437,-424,-358,-272,-206,-161,-142,-144,-128,-101,-96,-117,-166,-215,-221,-183,-102,8,127,211,209,127,-12,-136,-183,-167,-92,-18,-20,-80,
+    -155,-200,-174,-94,-15,23,21,12,24,71,125,116,33,-94,-235,-345,-389,-330,-165,70,339,568,684,669,551,367,167,-3,-134,-236,-315,-378,
+    -416,-400,-299,-133,44,203,292,300,278,244,216,215,239,261,250,200,94,-28,-128,-205,-249,-296,-345,-361,-324,-220,-72,116,301,416,438,334,
+    132,-76,-225,-294,-286,-256,-265,-313,-381,-417,-378,-287,-191,-137,-110,-93,-49,63,186,273,293,227,107,-52,-203,-305,-341,-287,-178,-61,25,64,
+    77,78,104,166,242,308,333,300,222,148,121,144,207,268,269,215,136,50,-21,-59,-63,-61,-76,-125,-216,-299,-343,-337,-289,-237,-195,-153,
+    -99,-48,7,66,87,58,-51,-259,-497,-696,-798,-749,-579,-370,-186,-68,-9,28,88,160,191,170,85,-32,-107,-125,-98,-80,-111,-175,-275,-381,
+    -457,-469,-375,-174,100,374,580,685,680,589,466,343,216,90,-42,-206,-366,-483,-521,-461,-344,-214,-129,-109,-122,-164,-196,-186,-150,-75,2,31,
+    25,-9,-55,-97,-133,-186,-256,-301,-312,-257,-121,72,312,536,670,687,585,410,240,125,68,45,3,-84,-195,-269,-263,-201,-107,-32,-14,-23,
+    -20,22,78,112,105,43,-60,-183,-283,-332,-307,-186,-9,173,299,328,257,123,-15,-126,-188,-200,-196,-204,-230,-245,-222,-148,-32,65,107,98,
+    35,-53,-113,-125,-69,41,160,259,315,334,334,339,348,330,303,270,246,256,287,346,436,509,511,422,248,36,-135,-215,-194,-120,-53,-52,
+    -121,-200,-280,-340,-383,-453,-552,-656,-696,-642,-520,-366,-230,-153,-148,-208,-315,-436,-527,-540,-478,-373,-255,-179,-168,-198,-234,-264,-278,-260,-244,-252,
+    -273,-288,-262,-156,-2,148,259,288,249,158,27,-88,-166,-195,-198,-202,-204,-211,-189,-115,-19,80,161,216,259,285,289,306,332,334,285,159,
+    -30,-239,-394,-442,-376,-219,-55,55,118,152,190,248,309,329,289,216,155,138,165,202,209,164,70,-52,-181,-283,-309,-231,-66,146,354,495,
+    547,523,437,328,227,144,67,-25,-120,-211,-252,-209,-119,-14,65,85,52,-20,-94,-144,-137,-80,-7,64,78,39,-22,-112,-214,-326,-454,-564,
+    -616,-606,-524,-354,-126,107,297,383,342,221,84,-20,-36,20,70,83,53,6,-14,0,35,54,21,-42,-94,-103,-56,25,95,134,138,94,
+    6,-94,-159,-182,-157,-82,-13,12,-5,-56,-114,-149,-134,-80,-17,41,58,34,26,44,81,113,106,49,-60,-196,-328,-414,-429,-381,-279,-174,
+    -107,-63,-38,-22,-3,-6,-31,-65,-98,-119,-116,-68,22,131,219,233,162,41,-77,-135,-90,32,163,242,244,190,114,52,14,-38,-118,-207,
+    -256,-238,-149,-21,85,149,154,80,-55,-207,-320,-357,-288,-129,59,231,349,396,376,326,280,231,193,126,17,-87,-169,-188,-143,-59,11,29,
+    -1,-99,-228,-341,-412,-419,-384,-323,-266,-221,-177,-120,-62,-31,-22,-39,-77,-132,-175,-170,-121,-23,76,118,94,9,-87,-133,-98,6,117,177,
+    169,99,22,-18,-27,-23,-39,-72,-79,-32,71,206,335,430,472,439,345,219,96,27,30,104,203,283,333,319,268,225,194,202,237,261,
+    243,188,131,87,80,83,64,25,-60,-173,-270,-326,-314,-212,-53,104,221,271,267,222,142,43,-70,-167,-245,-295,-298,-255,-137,26,174,272,
+    288,219,108,23,22,86,167,232,232,164,82,18,-33,-87,-167,-276,-364,-396,-357,-254,-133,0,102,137,107,12,-107,-216,-277,-284,-266,-241,
+    -251,-296,-353,-407,-414,-359,-260,-152,-66,-10,22,68,132,193,242,253,207,116,-2,-115,-179,-173,-107,-18,60,110,139,164,171,155,138,107,
+    67,36,3,-5,43,126,217,278,277,205,98,33,41,118,231,314,326,263,180,116,79,60,36,2,-20,9,84,167,253,307,299,226,
+    88,-79,-233,-325,-312,-200,-15,190,365,491,554,568,568,577,592,584,541,460,370,306,265,259,267,258,220,146,52,-37,-82,-60,24,144,
+    244,303,332,320,262,171,46,-102,-253,-394,-510,-564,-533,-421,-266,-107,1,28,12,-12,-1,53,106,119,50,-94,-255,-389,-476,-524,-550,-573,
+    -567,-503,-381,-214,-29,141,254,309,290,184,52,-70,-141,-135,-81,0,72,116,135,136,159,224,320,419,476,478,447,395,333,276,211,130,
+    31,-84,-201,-295,-328,-279,-160,-14,97,173,218,219,196,155,103,57,14,-23,-53,-49,12,114,245,361,412,377,285,202,166,198,282,350,
+    355,289,184,71,-24,-97,-186,-279,-346,-360,-301,-178,1,188,346,456,470,396,263,112,-8,-74,-89,-76,-53,-50,-66,-81,-69,-12,78,176,
+    229,227,193,133,85,54,23,-6,-59,-144,-243,-341,-400,-390,-307,-190,-85,1,59,88,99,88,65,38,9,-26,-64,-78,-52,20,133,244,
+    302,284,210,119,65,72,116,155,136,61,-46,-141,-179,-177,-153,-129,-101,-52,12,100,182,240,267,240,146,-3,-160,-302,-375,-348,-252,-112,
+    35,159,227,253,267,287,338,382,393,364,302,243,191,164,149,130,103,41,-41,-122,-169,-133,-19,138,302,442,533,576,560,482,369,228,
+    70,-103,-267,-383,-434,-393,-259,-80,83,187,230,244,259,309,389,443,433,341,197,57,-55,-135,-206,-270,-314,-334,-306,-233,-137,-32,62,114,
+    96,14,-120,-273,-393,-458,-472,-436,-378,-341,-323,-317,-303,-243,-141,-28,59,100,91,44,-4,-43,-61,-63,-64,-69,-90,-127,-147,-121,-54,34,
+    119,165,171,154,114,50,-3,-32,-56,-65,-60,-37,23,127,272,426,537,568,531,446,378,377,422,487,514,477,393,292,214,154,97,48,
+};
+
+static constexpr float kBanjo2Scale = 1.48987356e-05f;
+static constexpr int16_t kBanjo2[BodyIR::kSize] = {
+    4,-217,-544,-903,-1272,-1761,-2482,-3317,-4489,-6158,-8340,-11224,-14773,-18321,-21324,-24039,-26356,-27864,-28782,-29787,-30958,-31406,-31133,-30443,-28523,-25302,-21700,-18018,-14143,-10439,-6967,-3087,
+    1152,5141,8786,11989,14108,14892,15032,15007,14735,14460,14519,14643,14498,14252,13961,13504,13125,12982,12796,12466,12193,11811,11037,10294,9947,9693,9500,9687,10168,10616,11026,11419,
+    11648,11800,12070,12669,13585,14649,16079,17784,19267,20546,21764,22734,23564,24563,25862,27465,29021,30340,31578,32521,32767,32417,31651,30112,27742,24668,20836,16359,11329,6339,1921,-2092,
+    -5545,-8259,-10622,-12816,-14759,-16729,-18679,-20012,-20749,-21294,-21395,-20936,-20571,-20357,-19770,-18910,-18081,-17161,-16085,-15330,-15110,-14982,-14818,-14685,-14164,-13018,-11565,-10044,-8495,-7132,-6167,-5478,
+    -4931,-4523,-4152,-3898,-3952,-4246,-4761,-5556,-6395,-7031,-7481,-7900,-8345,-8660,-8930,-9347,-9616,-9317,-8560,-7671,-6627,-5640,-5258,-5660,-6605,-7753,-8829,-9427,-9334,-8754,-7904,-6853,
+    -5691,-4496,-2943,-764,1852,4700,7497,9795,11382,12436,13173,13938,15013,16191,17233,17898,17867,17064,15789,14546,13692,13284,13223,13401,13447,13117,12706,12550,12800,13450,14489,15795,
+    16866,17333,17418,17414,17327,17382,17745,18192,18438,18363,18132,17475,16310,15358,14532,13301,11970,10752,9177,7141,5125,3177,991,-1296,-3519,-5869,-8338,-10772,-12998,-14848,-16329,-17251,
+    -17647,-17796,-17673,-17424,-17190,-16914,-16633,-16467,-16351,-15999,-15712,-15646,-15217,-14697,-14545,-14318,-13851,-13424,-13009,-12317,-11395,-10532,-9769,-9198,-8965,-8916,-8911,-9000,-9148,-9207,-9174,-9299,
+    -9682,-10106,-10479,-10905,-11258,-11298,-11280,-11568,-11985,-12328,-12601,-12602,-12047,-10917,-9375,-7646,-6013,-4648,-3435,-2145,-753,814,2746,4854,6751,8380,9830,11050,12233,13666,15269,16847,
+    18137,19001,19453,19506,19254,18752,18178,17623,16975,16119,14929,13599,12346,11133,10107,9423,8805,7907,6828,5701,4461,3174,2009,1054,189,-754,-1818,-2954,-3996,-4692,-4875,-4470,
+    -3501,-2249,-1053,12,979,1804,2578,3493,4547,5620,6563,7210,7486,7453,7180,6716,6178,5583,4847,3923,2824,1646,484,-638,-1772,-2999,-4448,-6240,-8322,-10569,-12787,-14761,
+    -16368,-17523,-18145,-18310,-18226,-17784,-16851,-15627,-14192,-12576,-10937,-9445,-8122,-6837,-5582,-4335,-3065,-1908,-994,-373,-127,-278,-679,-1169,-1703,-2283,-2801,-3262,-3804,-4340,-4672,-4673,
+    -4353,-3802,-3079,-2308,-1638,-1131,-672,-116,587,1471,2501,3506,4249,4629,4725,4692,4684,4784,5051,5472,5909,6220,6423,6679,7138,7863,8831,9911,10903,11556,11821,11881,
+    11714,11464,11437,11483,11456,11404,11206,10731,10114,9507,8844,8077,7208,6195,5017,3758,2633,1782,1199,920,942,1011,964,835,555,187,-58,-199,-331,-481,-778,-1354,
+    -2174,-3132,-4111,-4999,-5735,-6291,-6656,-6876,-6993,-6940,-6605,-5985,-5130,-4126,-3146,-2320,-1669,-1157,-716,-283,145,432,441,119,-597,-1691,-3011,-4381,-5733,-7089,-8477,-9929,
+    -11485,-13119,-14705,-16078,-17066,-17636,-17824,-17688,-17346,-16767,-15938,-14886,-13616,-12203,-10711,-9259,-7871,-6497,-5172,-3836,-2432,-990,422,1767,3021,4108,5039,5927,6795,7588,8316,8952,
+    9464,9861,10164,10419,10601,10717,10797,10818,10750,10560,10292,10010,9750,9534,9320,9008,8535,7942,7227,6426,5710,5130,4607,4087,3521,2834,1970,1007,56,-718,-1183,-1575,
+    -1932,-2067,-2254,-2618,-2813,-2727,-2493,-2126,-1676,-1378,-1359,-1547,-1857,-2163,-2282,-2190,-1981,-1783,-1776,-2077,-2699,-3530,-4479,-5458,-6325,-7057,-7716,-8265,-8683,-9049,-9321,-9499,
+    -9688,-9876,-10081,-10351,-10621,-10734,-10573,-10097,-9232,-7995,-6546,-5050,-3647,-2434,-1429,-576,273,1261,2394,3630,4912,6125,7110,7798,8200,8297,8126,7806,7368,6836,6333,5890,
+    5486,5173,4959,4717,4317,3756,2839,1502,72,-1417,-2986,-4293,-5069,-5386,-5304,-4782,-3975,-3097,-2239,-1456,-775,-182,334,815,1332,1907,2533,3180,3849,4518,5112,5556,
+    5823,5859,5533,4892,4076,3180,2316,1643,1306,1270,1444,1749,2079,2280,2363,2339,2027,1644,1328,896,495,319,327,497,880,1310,1560,1643,1500,1013,334,-240,
+    -612,-675,-225,712,1878,3072,4241,5244,5896,6234,6391,6367,6148,5807,5376,4825,4199,3638,3189,2820,2460,1984,1285,356,-753,-2004,-3154,-4121,-5031,-5659,-6071,-6580,
+    -7026,-7282,-7466,-7627,-7770,-8049,-8644,-9471,-10396,-11311,-11984,-12274,-12197,-11813,-11273,-10718,-10245,-9905,-9612,-9272,-8841,-8207,-7298,-6165,-4812,-3221,-1476,328,2095,3724,5062,5993,
+    6527,6687,6523,6106,5581,5018,4425,3913,3348,2670,2062,1431,750,262,65,66,238,630,1162,1709,2283,2913,3569,4255,4966,5616,6122,6492,6718,6720,6485,6085,
+    5562,4884,4146,3534,3037,2594,2289,2163,2059,1891,1737,1557,1233,785,267,-369,-1112,-1842,-2531,-3174,-3718,-4160,-4592,-5054,-5488,-5871,-6181,-6335,-6304,-6159,-5943,-5668,
+    -5424,-5215,-4945,-4590,-4185,-3758,-3337,-3018,-2893,-2886,-2892,-2935,-2980,-2919,-2782,-2673,-2593,-2501,-2430,-2356,-2186,-1960,-1767,-1614,-1506,-1472,-1446,-1261,-860,-278,456,1278,
+    2047,2628,2991,3148,3100,2882,2571,2200,1757,1273,820,463,249,206,298,450,626,785,866,874,866,903,1031,1276,1633,2026,2415,2789,3115,3363,3490,3475,
+    3280,2968,2582,2080,1684,1509,1422,1499,1800,2142,2398,2580,2625,2452,2145,1785,1342,882,533,313,212,261,468,741,978,1170,1322,1393,1386,1391,1441,1515,
+    1653,1888,2166,2453,2790,3108,3303,3350,3212,2849,2321,1774,1266,826,539,399,300,153,-28,-241,-490,-664,-679,-567,-358,-28,353,690,1018,1331,1539,1599,
+    1488,1125,469,-396,-1350,-2339,-3283,-4060,-4693,-5295,-5916,-6544,-7176,-7765,-8148,-8239,-8054,-7614,-7007,-6353,-5733,-5179,-4680,-4203,-3709,-3181,-2657,-2178,-1725,-1275,-801,-257,
+    402,1127,1845,2530,3150,3654,4064,4495,4964,5471,5996,6495,6900,7001,6885,6664,6159,5443,4692,3884,2978,2028,1039,-2,-968,-1752,-2360,-2753,-2867,-2793,-2615,-2320,
+    -1924,-1506,-1118,-703,-279,55,312,548,748,918,1161,1472,1730,1878,1905,1745,1360,831,230,-401,-1029,-1564,-2002,-2478,-2977,-3463,-4038,-4688,-5259,-5683,-5942,-5934,
+    -5633,-5138,-4514,-3807,-3145,-2627,-2213,-1888,-1668,-1506,-1332,-1143,-951,-706,-398,-63,291,678,1031,1277,1434,1509,1499,1472,1514,1622,1739,1819,1821,1675,1356,947,
+    525,142,-132,-249,-251,-195,-106,28,238,405,570,858,1063,1126,1194,1257,1284,1378,1576,1761,1882,1923,1792,1454,1028,600,221,16,44,247,485,693,
+    862,892,768,609,463,261,39,-117,-254,-374,-374,-235,-42,138,258,216,-63,-516,-1031,-1539,-1952,-2156,-2150,-2045,-1898,-1724,-1598,-1528,-1440,-1343,-1255,-1120,
+    -934,-743,-495,-85,470,1130,1925,2798,3590,4211,4659,4903,4905,4759,4578,4370,4147,3995,3914,3841,3774,3711,3564,3261,2847,2319,1669,987,362,-157,-544,-739,
+    -750,-674,-591,-534,-558,-729,-1023,-1381,-1749,-2037,-2152,-2087,-1870,-1526,-1133,-775,-504,-355,-336,-436,-600,-768,-907,-1011,-1042,-968,-813,-594,-353,-136,-27,-133,
+    -407,-774,-1240,-1708,-2030,-2186,-2205,-2096,-1934,-1784,-1639,-1476,-1303,-1095,-807,-488,-198,86,377,656,930,1223,1509,1709,1777,1710,1491,1153,802,514,308,192,
+    168,176,157,145,146,101,25,-39,-136,-314,-542,-797,-1073,-1313,-1463,-1504,-1445,-1323,-1191,-1087,-1023,-989,-980,-977,-919,-793,-635,-454,-243,-34,139,300,
+    452,551,576,541,472,386,322,319,391,530,701,843,898,851,652,316,-58,-463,-889,-1248,-1506,-1689,-1816,-1890,-1952,-2029,-2107,-2201,-2296,-2342,-2350,-2339,
+    -2293,-2204,-2104,-2019,-1921,-1784,-1627,-1448,-1223,-956,-663,-333,42,420,754,1017,1157,1180,1143,1039,890,774,702,643,587,519,422,293,157,36,-48,-88,
+    -104,-108,-96,-71,-46,-43,-66,-129,-265,-492,-794,-1152,-1536,-1869,-2083,-2153,-2074,-1876,-1597,-1246,-863,-483,-83,333,745,1136,1475,1724,1870,1940,1960,1978,
+    2039,2141,2255,2359,2421,2407,2318,2174,1996,1821,1659,1506,1368,1242,1131,1066,1064,1127,1253,1419,1587,1725,1822,1885,1934,1986,2058,2166,2293,2399,2441,2402,
+    2275,2056,1768,1432,1054,641,201,-248,-680,-1069,-1373,-1563,-1628,-1597,-1528,-1473,-1475,-1535,-1634,-1740,-1808,-1812,-1741,-1611,-1445,-1269,-1113,-997,-929,-909,-956,-1073,
+    -1219,-1347,-1410,-1358,-1158,-823,-400,48,446,741,903,922,825,664,487,319,174,79,40,31,48,89,119,114,82,34,-25,-69,-71,-19,94,264,
+    446,594,690,721,679,595,530,517,569,696,890,1108,1286,1402,1452,1426,1346,1241,1133,1026,910,781,637,484,332,177,32,-85,-176,-245,-294,-327,
+    -355,-386,-416,-471,-569,-714,-901,-1105,-1302,-1462,-1570,-1611,-1580,-1506,-1424,-1369,-1350,-1382,-1456,-1542,-1624,-1694,-1754,-1803,-1847,-1892,-1954,-2025,-2070,-2098,-2122,-2135,
+    -2143,-2157,-2175,-2180,-2163,-2112,-2023,-1906,-1771,-1609,-1424,-1229,-1006,-744,-453,-143,180,512,832,1128,1400,1650,1859,2012,2110,2143,2104,1998,1840,1646,1437,1243,
+    1086,979,927,923,946,974,984,950,852,681,452,175,-143,-489,-843,-1183,-1486,-1725,-1885,-1964,-1971,-1916,-1813,-1680,-1518,-1330,-1115,-867,-601,-354,-153,-14,
+    49,44,2,-46,-80,-87,-58,1,83,178,282,392,504,610,696,757,788,795,784,765,738,693,610,472,296,91,-119,-276,-336,-278,-103,168,
+    489,809,1104,1366,1594,1792,1965,2104,2202,2251,2238,2187,2116,2025,1939,1860,1761,1620,1428,1188,925,682,486,349,279,268,289,327,375,435,501,567,
+    620,635,597,489,330,155,-14,-137,-202,-204,-163,-108,-58,-45,-70,-131,-216,-292,-333,-331,-291,-203,-77,57,179,259,276,221,102,-64,-245,-395,
+    -478,-478,-398,-267,-137,-65,-87,-214,-435,-719,-1010,-1240,-1366,-1365,-1225,-963,-625,-255,111,432,683,851,930,934,887,812,726,642,564,485,388,254,
+    89,-96,-288,-445,-525,-514,-418,-257,-69,99,221,279,262,183,63,-95,-287,-499,-730,-972,-1204,-1402,-1558,-1663,-1706,-1691,-1632,-1533,-1401,-1248,-1081,-910,
+    -743,-585,-448,-341,-262,-207,-162,-115,-63,9,90,189,316,448,579,717,847,956,1039,1083,1072,1013,917,790,651,514,379,247,121,12,-81,-159,
+    -211,-238,-243,-236,-228,-236,-277,-343,-428,-524,-620,-708,-769,-805,-820,-809,-790,-768,-752,-751,-769,-822,-903,-1003,-1121,-1234,-1329,-1402,-1449,-1473,-1476,-1461,
+    -1425,-1359,-1269,-1151,-998,-831,-673,-535,-424,-342,-279,-216,-140,-59,24,109,185,247,294,332,380,450,554,697,868,1059,1256,1453,1641,1805,1936,2015,
+    2038,2008,1916,1762,1565,1338,1094,851,624,420,238,87,-26,-103,-150,-176,-187,-182,-166,-145,-117,-79,-22,59,161,280,402,504,569,592,574,523,
+    463,420,423,485,598,747,901,1027,1107,1128,1093,1006,878,735,602,491,410,371,369,391,420,422,376,276,128,-46,-204,-312,-361,-353,-296,-218,
+    -151,-108,-92,-85,-70,-34,47,178,355,566,800,1041,1257,1410,1470,1423,1264,1009,687,350,47,-196,-361,-444,-462,-437,-382,-301,-197,-75,44,141,
+    205,215,166,70,-51,-180,-301,-401,-481,-546,-607,-666,-701,-707,-681,-625,-549,-459,-380,-320,-275,-246,-225,-212,-202,-195,-204,-239,-297,-366,-436,-502,
+    -542,-551,-533,-492,-438,-379,-331,-301,-292,-301,-323,-366,-418,-470,-509,-526,-523,-486,-416,-317,-197,-65,67,184,274,339,393,433,452,443,412,351,
+    255,142,25,-86,-179,-253,-312,-372,-448,-544,-650,-745,-821,-876,-906,-926,-951,-991,-1049,-1114,-1177,-1229,-1258,-1255,-1230,-1197,-1145,-1073,-980,-857,-713,-552,
+    -386,-231,-91,35,149,254,353,448,530,587,621,644,669,716,790,889,1000,1099,1160,1168,1125,1031,898,757,622,507,416,340,284,242,206,168,
+    115,43,-54,-175,-298,-403,-471,-489,-450,-363,-254,-155,-91,-83,-138,-250,-403,-567,-725,-862,-961,-1016,-1032,-1024,-997,-958,-910,-858,-804,-740,-666,-575,
+    -467,-342,-197,-45,109,255,389,506,593,655,701,744,783,830,892,954,1015,1073,1127,1172,1207,1231,1247,1251,1236,1207,1167,1132,1112,1109,1129,1159,
+    1181,1181,1148,1086,1000,902,814,747,703,677,666,656,644,631,617,606,595,581,567,550,527,501,478,457,435,403,352,269,152,7,-153,-307,
+    -435,-534,-609,-666,-718,-780,-858,-950,-1038,-1113,-1173,-1205,-1213,-1200,-1164,-1103,-1010,-886,-739,-584,-436,-315,-233,-188,-175,-174,-176,-173,-166,-164,-175,-210,
+    -259,-312,-360,-387,-382,-339,-256,-142,0,162,337,511,666,788,852,847,772,645,495,343,223,148,126,153,208,280,356,424,483,538,586,621,
+    637,639,627,601,562,507,434,334,197,25,-174,-378,-572,-724,-814,-845,-822,-771,-713,-663,-638,-642,-677,-731,-800,-877,-943,-993,-1012,-1000,-956,-877,
+    -786,-699,-636,-608,-616,-654,-704,-748,-767,-753,-713,-647,-576,-519,-478,-450,-423,-382,-317,-219,-86,67,228,381,505,582,605,569,470,319,124,-95,
+    -308,-494,-637,-734,-788,-811,-823,-827,-825,-805,-762,-689,-580,-450,-320,-208,-132,-92,-89,-111,-140,-168,-182,-182,-166,-131,-82,-16,65,165,284,406,
+    526,637,743,845,944,1045,1143,1231,1297,1333,1332,1296,1227,1136,1044,958,882,814,753,694,637,577,518,464,411,358,311,267,227,196,179,174,
+    182,189,188,175,144,104,62,25,2,-8,-7,0,1,-14,-50,-107,-178,-261,-351,-440,-520,-587,-631,-648,-634,-594,-537,-469,-410,-364,-344,-349,
+    -359,-363,-338,-277,-177,-48,86,215,321,400,457,498,536,580,629,679,728,767,804,831,849,861,849,818,766,698,626,565,531,532,568,631,
+    701,758,794,799,774,726,659,576,482,386,290,199,123,64,27,4,-12,-35,-73,-123,-183,-244,-296,-337,-370,-395,-415,-438,-460,-482,-492,-486,
+    -463,-423,-377,-336,-308,-299,-311,-339,-385,-452,-531,-625,-733,-848,-959,-1059,-1135,-1178,-1189,-1162,-1107,-1025,-917,-787,-639,-485,-337,-212,-118,-64,-53,-74,
+    -112,-150,-177,-184,-171,-142,-106,-59,0,67,146,236,336,439,527,593,625,619,577,507,418,314,204,92,-16,-111,-195,-258,-301,-328,-340,-351,
+    -361,-375,-392,-399,-395,-372,-334,-294,-258,-238,-238,-263,-307,-364,-421,-480,-537,-589,-647,-701,-756,-810,-852,-893,-926,-947,-952,-930,-873,-773,-632,-456,
+    -252,-42,150,317,439,518,562,570,552,515,468,417,364,315,269,229,195,171,159,160,176,211,264,334,421,509,591,657,693,695,656,580,
+    473,344,202,60,-72,-195,-299,-373,-420,-434,-413,-363,-285,-184,-70,57,190,323,458,587,703,793,846,854,819,742,639,523,403,296,208,140,
+    99,76,76,97,139,202,272,344,407,456,485,492,489,474,452,423,380,329,261,181,98,22,-40,-87,-119,-141,-152,-157,-154,-132,-94,-36,
+    36,106,169,209,217,195,150,84,2,-91,-195,-302,-410,-507,-584,-636,-656,-645,-605,-546,-475,-395,-306,-207,-98,19,137,242,331,391,420,421,
+    393,340,274,200,127,56,-5,-48,-69,-62,-27,33,116,210,312,418,518,607,679,730,758,753,714,646,553,444,327,214,112,22,-54,-113,
+    -152,-169,-166,-137,-84,-12,72,152,224,279,308,316,307,284,248,192,121,35,-68,-181,-296,-399,-486,-558,-613,-659,-697,-727,-743,-741,-720,-685,
+    -639,-590,-556,-546,-560,-598,-648,-706,-767,-830,-898,-974,-1057,-1142,-1215,-1270,-1298,-1284,-1229,-1139,-1019,-880,-730,-571,-414,-261,-120,-3,89,152,192,215,
+    224,229,236,245,252,254,243,225,203,180,168,171,187,211,244,285,326,369,415,460,496,512,499,453,376,275,167,64,-26,-97,-154,-192,
+    -220,-241,-252,-248,-226,-190,-139,-78,-11,58,126,199,271,341,397,430,436,406,347,267,181,105,49,21,16,30,56,80,109,139,165,190,
+    213,232,246,262,283,314,351,388,426,450,450,425,382,332,284,244,218,195,174,148,104,50,-9,-67,-110,-131,-130,-110,-77,-33,18,66,
+    110,145,164,162,134,81,6,-85,-183,-270,-336,-378,-392,-385,-355,-305,-242,-162,-64,48,165,283,392,479,540,572,583,578,560,529,488,440,
+    381,319,263,221,200,197,217,253,291,324,348,366,375,375,370,355,333,301,263,230,200,179,168,163,155,134,94,39,-23,-86,-133,-162,
+    -172,-164,-146,-123,-101,-78,-56,-30,4,39,73,98,112,116,104,75,29,-37,-128,-241,-368,-495,-617,-712,-770,-788,-760,-707,-632,-540,-445,-346,
+    -250,-158,-75,-11,30,44,32,-5,-58,-113,-163,-207,-241,-264,-284,-294,-293,-278,-246,-199,-142,-80,-17,33,69,93,103,108,105,95,77,47,
+    4,-47,-92,-127,-152,-159,-147,-129,-116,-105,-98,-95,-88,-76,-58,-41,-35,-43,-71,-114,-169,-235,-302,-368,-434,-505,-576,-641,-699,-737,-755,-750,
+    -728,-703,-673,-645,-615,-578,-532,-465,-382,-288,-199,-122,-65,-33,-21,-25,-34,-46,-57,-62,-62,-49,-27,10,66,140,228,325,427,525,618,706,
+    790,865,922,957,958,919,848,744,620,494,374,274,191,126,82,50,39,51,83,134,192,252,300,326,325,306,277,241,206,175,146,111,
+    65,12,-43,-97,-149,-190,-222,-251,-273,-293,-305,-301,-278,-233,-172,-103,-39,13,51,75,91,105,122,143,163,177,179,164,139,102,65,33,
+    2,-21,-37,-35,-13,30,104,196,295,385,454,493,500,479,440,397,353,309,259,203,138,59,-20,-91,-148,-185,-197,-183,-153,-108,-53,7,
+    72,135,186,222,236,225,193,148,100,55,18,-11,-33,-52,-73,-94,-113,-118,-109,-88,-54,-17,15,38,52,63,72,82,97,114,128,136,
+    136,129,122,117,115,120,121,117,105,83,58,29,5,-11,-20,-24,-31,-39,-46,-47,-35,-12,23,64,101,122,129,113,80,36,-18,-70,
+    -131,-195,-260,-329,-389,-436,-462,-467,-458,-438,-418,-400,-391,-387,-382,-375,-363,-351,-346,-349,-368,-401,-439,-484,-529,-566,-599,-623,-639,-650,-650,-634,
+    -600,-551,-486,-416,-349,-285,-234,-190,-153,-127,-104,-83,-67,-57,-56,-61,-68,-74,-74,-66,-50,-26,6,42,91,148,212,288,365,444,510,558,
+    587,594,589,572,554,533,507,480,439,392,335,264,190,118,48,-21,-80,-132,-173,-198,-207,-197,-176,-148,-122,-105,-101,-109,-129,-152,-172,-189,
+    -207,-228,-251,-283,-316,-342,-365,-371,-363,-341,-306,-263,-209,-150,-83,-12,58,122,172,200,208,202,188,176,168,169,177,188,200,209,220,233,
+    249,272,302,334,363,388,405,420,436,447,456,458,449,422,378,321,255,193,138,103,84,76,78,87,99,115,132,149,170,188,198,207,
+    209,211,215,219,228,228,213,181,127,58,-21,-99,-165,-211,-232,-232,-213,-176,-129,-72,-4,72,149,221,283,329,354,362,350,324,288,244,
+    191,129,63,-3,-64,-104,-119,-106,-67,-10,58,123,182,228,257,272,271,256,226,177,112,37,-38,-112,-178,-235,-285,-327,-365,-395,-413,-413,
+    -395,-358,-300,-234,-166,-107,-59,-26,-8,5,4,-3,-18,-47,-86,-134,-188,-246,-299,-346,-383,-413,-434,-444,-446,-430,-402,-359,-303,-248,-190,-139,
+    -98,-66,-44,-29,-21,-19,-32,-59,-94,-138,-181,-212,-230,-228,-207,-175,-132,-86,-43,0,43,88,132,171,202,224,234,231,220,203,175,137,
+    88,29,-45,-129,-210,-286,-344,-380,-397,-395,-383,-362,-336,-302,-263,-218,-168,-117,-70,-39,-25,-27,-46,-77,-117,-163,-213,-265,-317,-364,-396,-410,
+    -401,-367,-309,-236,-156,-74,3,74,139,197,250,293,326,347,354,351,336,318,302,289,282,278,279,281,290,307,327,357,389,415,437,448,
+    442,425,401,380,359,338,321,300,271,235,188,137,83,26,-31,-90,-147,-204,-260,-309,-344,-362,-365,-355,-338,-320,-303,-292,-279,-263,-247,-226,
+    -202,-178,-161,-149,-138,-130,-119,-105,-86,-66,-47,-25,-1,35,81,132,195,257,312,354,381,397,401,399,403,407,411,412,405,398,386,373,
+    365,360,358,358,357,352,345,335,322,314,309,302,292,284,274,263,253,246,247,249,245,231,208,174,129,81,37,-3,-40,-71,-98,-124,
+    -150,-169,-182,-190,-184,-174,-163,-153,-152,-156,-170,-187,-206,-229,-250,-271,-291,-309,-326,-334,-332,-323,-306,-282,-256,-232,-212,-187,-160,-128,-91,-54,
+    -20,4,18,17,0,-25,-58,-95,-130,-166,-200,-233,-259,-274,-281,-275,-259,-235,-207,-182,-155,-126,-95,-60,-23,13,42,58,59,47,23,-10,
+    -42,-75,-105,-129,-151,-168,-177,-179,-171,-148,-118,-86,-53,-28,-10,-1,2,0,-6,-17,-26,-39,-57,-71,-85,-95,-97,-98,-96,-94,-96,-102,
+    -106,-107,-101,-81,-52,-13,31,71,108,135,153,167,174,175,172,164,147,123,92,58,22,-16,-49,-78,-101,-121,-131,-126,-104,-65,-17,41,
+    95,138,160,156,136,92,37,-25,-90,-155,-223,-288,-351,-402,-443,-471,-479,-474,-453,-420,-377,-323,-263,-197,-131,-69,-18,18,36,41,37,28,
+    20,20,26,35,49,65,84,103,127,158,190,226,262,297,330,361,391,418,444,464,473,476,463,441,415,386,363,340,322,307,290,273,
+    256,243,234,234,240,252,270,285,294,301,302,296,284,264,236,199,155,105,58,21,-9,-27,-39,-44,-45,-49,-54,-58,-56,-50,-37,-22,
+    -5,8,15,17,6,-5,-20,-37,-55,-74,-94,-112,-128,-142,-145,-148,-144,-139,-138,-134,-137,-130,-124,-103,-76,-41,-4,26,59,69,82,75,
+    64,45,13,-14,-65,-85,-155,-128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static constexpr float kDobroScale = 2.18744717e-05f;
+static constexpr int16_t kDobro[BodyIR::kSize] = {
+    -449,-175,226,540,1022,1510,2036,2383,2747,2817,2529,2738,2387,1081,1270,1635,-157,-1603,-1283,-1270,-2988,-4817,-6877,-10515,-13275,-16407,-22053,-24874,-25866,-30030,-30986,-29980,
+    -32557,-29715,-24751,-24873,-19934,-13340,-12905,-9338,-2753,-815,454,3512,3284,844,385,-1273,-4515,-5264,-6477,-10004,-10682,-9418,-10920,-9944,-4756,-2381,716,6640,9106,13299,20599,22060,
+    22439,26473,26793,23772,22906,21684,17631,14918,12917,8240,6305,6784,4054,3098,5722,7015,8182,10838,13142,15950,19820,22249,24355,27282,28893,30219,31856,32767,32660,31501,31425,31327,
+    29061,27789,27042,24461,22904,22163,20131,19171,20515,21203,20542,21877,23828,24157,25377,27001,27984,29018,29257,28623,28211,28038,26615,24628,23075,20871,19405,18692,16168,13765,12880,11136,
+    9048,7995,7226,5698,3817,2827,1452,-464,-1831,-3888,-6134,-7317,-8235,-9519,-10682,-11226,-11954,-12913,-13082,-13144,-13068,-12323,-11556,-10113,-9029,-9204,-8354,-6929,-6586,-6668,-6788,-7344,
+    -8265,-8850,-9418,-11244,-12974,-13179,-13825,-14354,-13533,-13113,-12816,-11967,-11199,-10384,-9270,-8580,-8461,-8297,-9143,-10536,-11641,-14277,-17371,-18771,-20376,-23199,-25427,-26879,-27766,-27299,-25952,-24508,
+    -22712,-19843,-16227,-12564,-8901,-5787,-3313,-1465,-303,626,573,-544,-1567,-3063,-5494,-7727,-9776,-11577,-12165,-12189,-11628,-9989,-8287,-5847,-1821,2039,5259,8781,11282,12723,14673,15253,
+    13413,11445,9258,5486,1610,-1558,-5009,-8161,-10146,-11111,-11393,-11123,-10324,-8656,-5735,-2557,372,3185,5166,6641,8452,9542,9081,8386,7284,4904,2643,882,-1360,-3364,-4208,-4583,
+    -4593,-4108,-3424,-2057,-336,1579,3805,5297,6297,7708,8867,8991,8657,8009,6482,4840,3480,1983,778,43,-256,317,1446,2647,4323,6227,8081,10439,12450,13076,13198,13168,
+    12031,10288,8354,5365,2266,-91,-2037,-3481,-4795,-5496,-4969,-3944,-2442,48,2711,5029,7939,10802,12512,14012,15510,16057,15948,15462,13971,11792,9434,7398,6182,5122,4120,3583,
+    3348,3225,3797,5178,5948,6609,8174,9417,9966,10693,11470,11558,11483,11421,10544,9407,8797,8243,7521,7172,6948,6834,7269,7824,8530,9151,9343,9459,9498,9366,8726,7467,
+    5664,3588,1886,566,-595,-1575,-2023,-1955,-1667,-853,532,2160,3904,5836,7359,8018,8503,8688,8161,7458,6479,4562,2181,-266,-3278,-6137,-8345,-10575,-12421,-13476,-14200,-14347,
+    -13796,-13369,-12621,-10794,-8767,-7057,-5395,-3797,-2687,-2144,-2064,-2652,-3556,-4751,-6481,-8550,-10820,-12951,-14786,-16169,-16939,-17381,-17524,-17152,-16504,-15677,-14368,-12931,-11756,-10846,-10308,-9960,
+    -9585,-9418,-9665,-9749,-9643,-10070,-10546,-10640,-10852,-11133,-11142,-11174,-11424,-11499,-11656,-12168,-12429,-12603,-13170,-13583,-13614,-13781,-14022,-14064,-14002,-13594,-12763,-11788,-10467,-8998,-8074,-7303,
+    -6150,-5169,-4451,-3619,-2935,-2752,-3020,-3533,-4305,-5048,-5475,-6050,-6881,-7681,-8403,-8940,-9050,-8593,-7696,-6584,-5342,-3928,-2356,-592,1258,2912,4222,5130,5749,6134,6278,6172,
+    6000,5771,5087,4518,4383,4144,4115,4379,4398,4400,4722,4881,4787,4763,4612,4248,3821,3546,3294,2840,2342,1926,1730,1775,2277,3271,4297,5213,6053,6941,7801,8614,
+    9567,10320,10595,10473,9912,8960,7955,6969,5868,4691,3552,2588,1627,794,532,738,1321,2391,3832,5378,6979,8670,10229,11626,12830,13654,14037,13881,13290,12418,11229,9840,
+    8393,6893,5391,3964,2640,1563,849,476,280,82,41,157,263,450,839,1349,1659,1825,2030,2192,2406,2838,3429,3869,4160,4371,4188,3686,3220,2696,1981,1198,
+    257,-813,-1854,-2928,-3834,-4468,-4881,-4970,-4756,-4421,-4027,-3387,-2570,-1643,-463,764,1853,2894,3829,4367,4518,4394,3844,2863,1492,-156,-1989,-3968,-5859,-7455,-8675,-9607,
+    -10200,-10334,-10028,-9182,-7912,-6458,-4908,-3424,-2114,-1085,-489,-216,-205,-681,-1584,-2770,-4327,-6068,-7611,-8896,-9989,-10689,-11084,-11483,-11637,-11382,-10972,-10464,-9829,-9170,-8529,-7897,
+    -7430,-7195,-7078,-7078,-7083,-7012,-7074,-7205,-7193,-7240,-7347,-7226,-6955,-6597,-6067,-5521,-5139,-4831,-4534,-4389,-4407,-4540,-4916,-5611,-6415,-7141,-7768,-8242,-8679,-9046,-9132,-8958,
+    -8535,-7876,-7059,-6193,-5265,-4278,-3561,-3157,-2876,-2818,-3057,-3496,-4177,-5134,-6127,-7050,-7945,-8600,-8820,-8732,-8387,-7721,-6910,-6006,-5020,-4100,-3122,-2030,-1122,-551,-148,33,
+    -32,-20,-24,-181,-179,-17,4,13,272,675,1292,2191,3080,3866,4618,5276,5748,6041,6063,5730,5147,4325,3360,2433,1536,639,-67,-409,-527,-431,9,696,
+    1565,2689,3932,4994,5916,6731,7170,7237,7056,6528,5722,4910,4007,2901,1892,1092,482,247,423,871,1575,2482,3414,4484,5709,6766,7629,8379,8808,8886,8800,8357,
+    7582,6919,6255,5435,4719,4168,3775,3683,3860,4155,4638,5370,6169,6851,7366,7618,7533,7216,6672,5883,4930,3767,2431,1147,38,-875,-1561,-2105,-2511,-2704,-2730,-2612,
+    -2394,-2073,-1665,-1338,-1162,-1149,-1299,-1523,-1732,-1938,-2167,-2362,-2506,-2577,-2513,-2287,-1935,-1490,-910,-310,126,448,635,602,480,293,-87,-660,-1446,-2431,-3378,-4188,
+    -4949,-5578,-5980,-6181,-6142,-5813,-5261,-4547,-3626,-2607,-1714,-979,-453,-291,-478,-952,-1803,-3012,-4434,-6033,-7632,-9053,-10300,-11250,-11845,-12109,-11985,-11468,-10663,-9744,-8639,-7364,
+    -6205,-5188,-4344,-3844,-3631,-3587,-3801,-4245,-4669,-5118,-5656,-6070,-6370,-6626,-6651,-6377,-5921,-5323,-4692,-4147,-3586,-2990,-2472,-2039,-1765,-1755,-1920,-2171,-2547,-2961,-3326,-3723,
+    -4052,-4134,-4087,-3950,-3580,-3034,-2399,-1714,-1072,-534,-160,13,-51,-366,-928,-1752,-2696,-3609,-4498,-5321,-5986,-6415,-6500,-6265,-5839,-5195,-4320,-3306,-2148,-898,250,1220,
+    2038,2645,2989,3089,2933,2575,2154,1701,1231,836,551,365,331,530,902,1303,1725,2254,2850,3410,3858,4101,4215,4285,4192,3932,3596,3169,2693,2292,1988,1779,
+    1726,1822,2063,2471,2920,3304,3719,4130,4370,4440,4303,3856,3187,2476,1722,927,207,-369,-705,-686,-312,293,1070,2113,3399,4771,6110,7307,8224,8826,9153,9098,
+    8612,7820,6775,5530,4214,2867,1555,422,-487,-1136,-1416,-1390,-1162,-641,162,1150,2272,3373,4349,5235,6034,6594,6829,6829,6606,6110,5402,4559,3578,2603,1800,1122,
+    561,100,-315,-595,-688,-687,-676,-658,-688,-792,-862,-928,-1078,-1221,-1306,-1320,-1152,-835,-513,-146,332,840,1315,1750,2056,2179,2110,1794,1214,408,-552,-1577,
+    -2615,-3685,-4744,-5637,-6284,-6637,-6646,-6388,-5913,-5218,-4352,-3331,-2208,-1127,-218,487,1016,1333,1362,1090,530,-273,-1240,-2354,-3548,-4679,-5709,-6592,-7233,-7680,-7931,-7863,
+    -7505,-6993,-6374,-5710,-5089,-4474,-3866,-3343,-2954,-2787,-2868,-3091,-3345,-3622,-3922,-4181,-4405,-4589,-4644,-4607,-4555,-4401,-4162,-3973,-3803,-3644,-3608,-3674,-3777,-3972,-4261,-4564,
+    -4816,-4944,-4912,-4803,-4653,-4350,-3913,-3393,-2725,-2001,-1387,-892,-484,-198,-43,-32,-254,-676,-1213,-1891,-2670,-3418,-4056,-4561,-4865,-4918,-4777,-4396,-3717,-2844,-1845,-763,
+    268,1179,2013,2707,3131,3324,3296,2991,2534,2015,1374,659,-10,-598,-1048,-1301,-1418,-1429,-1267,-977,-608,-140,392,933,1470,1961,2326,2605,2821,2957,3120,3339,
+    3508,3601,3737,3919,4065,4264,4488,4599,4647,4676,4623,4479,4265,3921,3451,2943,2387,1778,1200,711,346,152,153,355,781,1408,2147,2946,3773,4531,5198,5806,
+    6220,6344,6232,5873,5274,4563,3782,2913,2022,1186,489,22,-202,-240,-104,239,712,1245,1831,2420,2979,3469,3820,4001,4030,3922,3680,3352,2972,2560,2133,1735,
+    1423,1156,904,692,493,323,238,199,146,61,-78,-242,-407,-621,-880,-1155,-1435,-1690,-1874,-1963,-1955,-1809,-1527,-1184,-804,-383,34,383,652,807,761,531,
+    181,-291,-878,-1524,-2189,-2845,-3409,-3818,-4052,-4120,-4035,-3782,-3357,-2808,-2234,-1700,-1239,-864,-575,-403,-382,-515,-780,-1168,-1666,-2207,-2712,-3151,-3503,-3717,-3811,-3825,
+    -3735,-3542,-3269,-2930,-2555,-2197,-1867,-1556,-1303,-1126,-1051,-1121,-1285,-1504,-1803,-2131,-2429,-2696,-2906,-3015,-3046,-3033,-2948,-2807,-2652,-2489,-2362,-2309,-2294,-2301,-2336,-2412,
+    -2536,-2672,-2777,-2819,-2765,-2593,-2302,-1919,-1445,-870,-257,324,841,1254,1513,1614,1545,1274,860,340,-299,-1012,-1743,-2426,-2982,-3366,-3561,-3540,-3291,-2862,-2275,-1544,
+    -724,129,980,1804,2536,3165,3650,3911,3961,3801,3440,2924,2303,1639,979,362,-180,-602,-867,-971,-910,-702,-399,-63,312,721,1108,1457,1760,1973,2085,2152,
+    2186,2214,2281,2366,2485,2653,2856,3081,3288,3440,3497,3452,3332,3132,2871,2550,2137,1681,1235,833,535,383,379,510,787,1213,1757,2394,3082,3760,4378,4892,
+    5260,5487,5574,5498,5259,4845,4267,3586,2850,2108,1418,832,365,45,-91,-52,143,450,846,1311,1802,2293,2724,3065,3297,3393,3350,3162,2851,2461,2028,1577,
+    1136,735,409,194,90,88,160,273,410,566,735,883,982,1011,969,884,752,572,376,202,65,-24,-48,-22,24,88,177,255,300,298,226,96,
+    -122,-454,-856,-1302,-1779,-2254,-2705,-3121,-3467,-3686,-3742,-3617,-3318,-2891,-2383,-1835,-1270,-734,-275,66,269,317,179,-152,-661,-1319,-2057,-2809,-3549,-4243,-4831,-5264,
+    -5516,-5581,-5471,-5198,-4783,-4261,-3664,-3039,-2444,-1910,-1448,-1050,-734,-518,-411,-421,-520,-669,-845,-1035,-1215,-1375,-1518,-1639,-1762,-1888,-1981,-2036,-2084,-2144,-2244,-2397,
+    -2544,-2670,-2783,-2848,-2867,-2838,-2719,-2489,-2153,-1725,-1228,-680,-110,430,898,1252,1458,1518,1435,1224,899,460,-58,-605,-1153,-1664,-2070,-2333,-2420,-2302,-2012,-1586,
+    -1007,-301,466,1240,1969,2590,3072,3423,3618,3650,3522,3224,2794,2279,1717,1139,584,97,-282,-506,-580,-540,-390,-142,175,540,931,1323,1680,1979,2207,2343,
+    2392,2362,2262,2140,2009,1861,1718,1608,1542,1535,1563,1595,1627,1640,1610,1552,1460,1324,1165,998,831,676,529,405,346,381,510,720,991,1296,1610,1910,
+    2164,2335,2400,2359,2211,1967,1638,1234,782,336,-66,-420,-700,-886,-962,-905,-692,-345,87,595,1141,1689,2209,2640,2955,3149,3207,3123,2916,2573,2087,1526,
+    945,384,-116,-534,-848,-1046,-1112,-1058,-927,-727,-466,-192,66,280,427,538,623,675,696,677,616,545,516,523,555,635,748,887,1054,1208,1297,1321,
+    1286,1181,1019,790,480,109,-280,-661,-1024,-1358,-1646,-1856,-1955,-1932,-1804,-1572,-1232,-815,-338,147,564,900,1150,1293,1310,1198,954,578,105,-419,-952,-1469,
+    -1924,-2275,-2500,-2583,-2545,-2394,-2143,-1814,-1430,-1054,-738,-501,-334,-242,-250,-351,-533,-770,-1030,-1274,-1494,-1697,-1842,-1895,-1854,-1742,-1580,-1419,-1311,-1220,-1158,-1149,
+    -1186,-1276,-1396,-1535,-1677,-1807,-1927,-2002,-2014,-1959,-1834,-1664,-1450,-1158,-811,-464,-136,142,332,449,491,410,209,-79,-442,-842,-1248,-1636,-1990,-2271,-2435,-2460,
+    -2337,-2077,-1705,-1233,-691,-138,387,849,1200,1448,1598,1600,1462,1225,919,569,207,-149,-491,-760,-907,-933,-836,-624,-320,55,494,954,1393,1803,2146,2437,
+    2684,2840,2889,2850,2737,2550,2319,2064,1801,1562,1373,1236,1128,1050,1008,1003,1022,1047,1069,1068,1062,1067,1084,1115,1148,1196,1283,1404,1567,1775,2003,2257,
+    2550,2856,3133,3348,3481,3506,3418,3232,2952,2584,2151,1679,1172,649,150,-278,-600,-785,-830,-752,-547,-238,159,624,1097,1528,1896,2187,2384,2482,2481,2361,
+    2136,1844,1479,1048,585,112,-336,-715,-1001,-1199,-1316,-1346,-1307,-1219,-1097,-949,-791,-648,-522,-426,-369,-355,-376,-408,-444,-484,-524,-541,-540,-516,-450,-379,
+    -323,-278,-265,-303,-398,-546,-752,-995,-1241,-1476,-1701,-1916,-2095,-2208,-2241,-2186,-2036,-1804,-1507,-1163,-800,-444,-117,159,365,493,529,458,283,15,-314,-676,
+    -1078,-1503,-1908,-2263,-2530,-2691,-2741,-2671,-2496,-2224,-1887,-1526,-1158,-805,-483,-204,22,170,223,194,90,-59,-247,-470,-689,-889,-1072,-1211,-1292,-1337,-1333,-1271,
+    -1179,-1071,-955,-848,-751,-650,-560,-492,-440,-413,-399,-393,-404,-414,-414,-390,-340,-280,-227,-204,-214,-241,-292,-379,-503,-656,-828,-998,-1143,-1269,-1365,-1400,
+    -1370,-1265,-1088,-853,-559,-204,191,599,991,1319,1571,1736,1801,1770,1635,1410,1105,730,308,-134,-568,-966,-1294,-1529,-1674,-1726,-1674,-1525,-1287,-971,-615,-247,
+    113,467,792,1063,1287,1451,1565,1628,1630,1568,1444,1277,1095,914,730,560,418,300,213,166,160,189,258,366,494,628,760,880,986,1092,1196,1289,
+    1368,1435,1513,1601,1685,1756,1804,1821,1799,1737,1626,1474,1300,1114,925,733,550,386,249,162,137,164,241,377,554,762,995,1231,1452,1649,1808,1916,
+    1958,1934,1860,1739,1578,1378,1141,882,615,368,161,-2,-105,-144,-111,-17,120,293,480,662,853,1036,1184,1295,1360,1365,1322,1230,1099,945,774,600,
+    433,270,117,-17,-130,-241,-344,-437,-534,-622,-691,-745,-797,-843,-874,-903,-935,-949,-951,-944,-916,-869,-812,-744,-686,-652,-636,-647,-689,-749,-834,-947,
+    -1063,-1178,-1299,-1409,-1493,-1554,-1587,-1581,-1538,-1455,-1329,-1158,-951,-724,-494,-270,-60,127,280,381,425,408,325,181,-30,-302,-612,-943,-1278,-1578,-1831,-2042,
+    -2202,-2301,-2332,-2294,-2198,-2047,-1851,-1619,-1361,-1088,-807,-532,-272,-38,160,314,419,479,505,488,444,370,258,138,10,-127,-257,-374,-467,-535,-561,-559,
+    -550,-529,-493,-443,-379,-293,-190,-72,62,219,396,572,744,904,1038,1130,1176,1172,1119,1020,890,732,529,306,88,-126,-313,-460,-565,-623,-612,-537,
+    -420,-269,-93,105,318,538,748,932,1078,1179,1236,1243,1194,1095,969,816,642,474,314,175,70,8,-17,-14,25,104,221,381,569,762,959,1142,
+    1296,1411,1467,1475,1454,1391,1292,1173,1031,868,709,566,434,316,218,146,100,79,75,81,92,103,125,145,154,172,198,249,326,419,519,615,
+    713,810,900,973,1029,1069,1080,1063,1011,923,811,688,560,432,322,238,187,173,209,293,410,558,734,927,1122,1306,1473,1607,1701,1733,1686,1554,
+    1350,1090,797,490,176,-123,-399,-638,-825,-967,-1061,-1097,-1075,-1000,-873,-710,-519,-308,-84,143,354,538,684,799,885,925,926,891,822,715,585,440,
+    267,90,-79,-233,-377,-517,-647,-780,-906,-1016,-1110,-1188,-1241,-1259,-1248,-1200,-1122,-1012,-875,-725,-557,-384,-228,-98,9,85,110,82,-4,-152,-357,-602,
+    -869,-1156,-1434,-1682,-1889,-2055,-2168,-2221,-2223,-2153,-2006,-1797,-1549,-1283,-1001,-736,-499,-295,-153,-80,-69,-115,-215,-368,-546,-732,-920,-1093,-1241,-1359,-1443,-1476,
+    -1451,-1383,-1273,-1126,-959,-775,-589,-415,-260,-127,-10,88,170,224,250,265,269,270,274,271,252,229,198,153,96,25,-64,-168,-280,-394,-497,-580,
+    -617,-601,-543,-437,-293,-105,119,363,630,893,1138,1370,1576,1729,1816,1845,1803,1709,1579,1411,1211,985,771,586,437,339,298,316,388,520,702,922,
+    1171,1427,1677,1892,2050,2148,2182,2154,2068,1934,1755,1551,1337,1136,953,787,654,560,518,526,579,670,784,923,1075,1236,1381,1511,1620,1699,1758,1789,
+    1795,1771,1736,1684,1613,1529,1429,1338,1251,1174,1098,1011,906,792,670,530,387,234,94,-27,-112,-155,-159,-113,-28,114,275,469,676,882,1087,1269,
+    1420,1496,1527,1472,1369,1192,958,711,416,161,-113,-320,-532,-689,-770,-840,-755,-800,-436,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+static constexpr float kViolaScale = 3.05834292e-05f;
+static constexpr int16_t kViola[BodyIR::kSize] = {
+    69,40,59,165,-125,-128,389,163,75,236,19,96,20,-4,75,-12,23,-35,-14,-39,-72,-4,17,120,164,191,185,160,167,121,101,89,
+    108,131,135,128,94,69,21,-23,-14,25,43,60,76,60,38,37,40,35,31,18,29,29,-5,24,81,55,36,91,88,69,123,149,
+    118,114,109,66,46,34,4,-33,-55,-91,-111,-83,-89,-93,-85,-64,-36,-21,6,63,93,47,87,131,98,102,125,76,32,94,80,62,
+    89,127,167,200,168,31,80,100,81,83,31,-85,-280,-275,-381,-1253,-2717,48,6039,6093,4635,5410,1324,-1552,-750,-4272,-4726,1606,6616,7817,7554,10421,
+    11291,9138,6521,170,-1696,-2961,-5961,-6161,-11089,-12863,-10906,-10105,-7447,-8476,-10516,-11460,-11683,-10117,-7857,-3627,596,4219,6248,7213,7184,5026,4443,4665,4771,3558,648,-2896,
+    -8768,-12133,-11518,-8987,-4756,-1502,660,639,-723,-1695,-2374,-981,2441,7203,9625,7018,410,-8784,-16297,-20883,-22720,-21381,-16819,-7822,2345,10749,17253,21452,25478,29676,32189,32767,
+    30850,27138,22612,17021,11881,7008,2155,-1343,-4557,-8164,-11890,-14418,-15397,-14304,-9711,-5166,-2285,-591,-735,-1505,-2134,-961,691,2175,6065,10472,14022,16363,16345,14083,10634,6909,
+    2458,-1868,-5797,-8570,-9713,-11110,-12090,-12760,-12673,-10382,-7450,-4425,-2217,-1217,407,3063,5305,5646,4746,3758,3186,2863,2015,1114,798,1355,1740,732,-413,-1883,-4417,-6340,
+    -7110,-7193,-6628,-5286,-3185,-1049,1180,3023,3302,2578,1726,1251,984,345,-1061,-3454,-5658,-7322,-9448,-11947,-14187,-15608,-15743,-14269,-11381,-7918,-4472,-1020,2024,3590,3368,1828,
+    91,-369,593,2120,4015,5745,6577,6537,4742,1300,-2638,-6432,-8735,-9948,-10926,-11318,-11554,-11604,-11066,-9867,-8302,-6278,-3452,-591,2311,5513,8388,10747,12239,12483,11688,10352,
+    9033,8004,7484,7857,9058,10349,11534,12844,13683,13294,11859,10019,7991,5753,2824,-893,-4545,-7837,-10546,-12678,-14124,-13948,-12068,-8616,-3992,674,4832,8591,11848,14135,15521,15896,
+    15248,13850,11446,8214,4569,1223,-1048,-1989,-1827,-1022,2,411,451,357,-382,-1359,-2629,-3978,-5099,-6044,-6367,-6194,-5322,-3563,-1196,1609,4350,6605,8245,9543,10163,9683,
+    8365,6250,3650,558,-2986,-6211,-8997,-11322,-12474,-12071,-10268,-7236,-3486,236,3263,5060,5503,4850,3423,1411,-773,-2862,-4774,-6387,-7710,-8387,-8344,-7639,-6105,-3957,-1509,918,
+    3135,4800,5535,5362,4491,3275,1933,568,-751,-1671,-2225,-2843,-3386,-3994,-4406,-4256,-3736,-2736,-1740,-1055,-825,-1365,-2384,-3817,-5385,-6746,-7467,-7256,-6598,-5508,-4139,-2513,
+    -459,1373,2835,4069,5191,6311,7138,7621,7538,6694,5368,3674,1916,501,-619,-1336,-1566,-1483,-1071,-476,214,915,1266,1331,1166,510,-630,-1979,-3286,-4278,-4752,-4871,
+    -4662,-4090,-3063,-1353,524,2274,4049,5514,6583,7427,7976,7995,7414,6192,4127,1416,-1429,-4013,-6159,-7757,-8711,-8937,-8274,-6850,-4886,-2572,-187,2105,4160,5875,7233,8208,
+    8774,8967,8737,8110,7277,6417,5765,5322,5006,4639,4036,3256,2034,293,-1829,-4015,-5652,-6597,-6684,-5986,-4774,-3169,-1566,-128,972,1732,2103,1763,1030,103,-894,-1694,
+    -2427,-3118,-3608,-3836,-3761,-3276,-2547,-1693,-725,-28,335,440,354,351,280,-3,-326,-606,-867,-1039,-1082,-1131,-1320,-1830,-2638,-3475,-4297,-5107,-5811,-6238,-6152,-5494,
+    -4330,-2819,-1128,735,2681,4580,6334,7719,8709,9386,9661,9541,9077,8256,7194,5972,4600,3155,1570,-199,-2057,-3884,-5437,-6621,-7375,-7557,-7176,-6180,-4569,-2548,-415,1606,
+    3322,4504,5038,4919,4355,3532,2566,1598,669,-1,-259,-132,364,1048,1748,2425,3055,3436,3419,3114,2577,1930,1272,644,192,-167,-504,-742,-931,-962,-758,-458,
+    -139,108,282,534,942,1563,2427,3311,3954,4236,4061,3579,2916,2042,1094,62,-1018,-1996,-2847,-3442,-3759,-3851,-3730,-3458,-3088,-2737,-2478,-2429,-2670,-3083,-3540,-3887,
+    -4178,-4506,-4780,-4932,-4790,-4231,-3339,-2334,-1394,-533,243,899,1334,1544,1591,1504,1354,1126,841,544,191,-175,-395,-381,-238,-130,-214,-625,-1450,-2658,-4007,-5167,
+    -5932,-6219,-6011,-5368,-4321,-3039,-1788,-644,256,894,1419,1890,2402,2971,3593,4225,4789,5268,5559,5593,5288,4547,3413,1978,374,-1316,-2955,-4364,-5405,-5947,-5978,-5524,
+    -4613,-3270,-1570,341,2290,3961,5178,5907,6116,5930,5390,4565,3644,2745,2028,1536,1226,1127,1219,1432,1669,1860,1936,1870,1787,1740,1762,1856,1864,1760,1573,1252,
+    838,425,88,-113,-125,13,220,463,736,1024,1283,1537,1817,2074,2294,2468,2542,2512,2410,2224,2009,1830,1717,1777,2043,2433,2797,2965,2890,2572,2028,1253,
+    249,-895,-2096,-3223,-4141,-4774,-5029,-4887,-4426,-3734,-2896,-2041,-1323,-824,-567,-540,-682,-900,-1132,-1423,-1785,-2181,-2554,-2801,-2841,-2587,-2123,-1593,-1005,-405,120,486,
+    648,610,455,282,155,164,253,326,366,366,399,459,529,644,777,894,987,1086,1185,1291,1368,1310,1076,640,42,-607,-1254,-1839,-2310,-2636,-2777,-2733,
+    -2513,-2131,-1657,-1110,-526,-4,410,614,566,341,-4,-339,-580,-735,-764,-633,-376,-57,209,327,299,136,-116,-372,-575,-704,-740,-684,-573,-379,-127,84,
+    218,237,162,53,-91,-219,-238,-116,169,603,1133,1719,2257,2634,2754,2543,2038,1316,483,-349,-1095,-1636,-1924,-1994,-1916,-1739,-1501,-1229,-870,-415,133,786,
+    1490,2231,2980,3643,4164,4537,4763,4829,4711,4349,3764,3039,2253,1525,920,469,182,1,-132,-283,-480,-738,-1084,-1504,-2011,-2617,-3283,-3955,-4538,-4929,-5039,-4824,
+    -4305,-3536,-2606,-1611,-646,200,852,1264,1460,1468,1320,1075,772,468,235,119,190,480,928,1475,2050,2569,2951,3139,3140,2980,2707,2393,2082,1763,1434,1116,
+    804,503,197,-120,-431,-722,-958,-1118,-1236,-1349,-1424,-1441,-1424,-1381,-1368,-1400,-1430,-1411,-1289,-1057,-708,-251,279,852,1370,1721,1825,1645,1211,576,-219,-1102,
+    -1957,-2682,-3149,-3245,-2932,-2195,-1075,320,1871,3459,4937,6143,6981,7382,7305,6781,5885,4750,3502,2267,1172,282,-351,-707,-785,-649,-410,-152,16,39,-120,-486,
+    -1008,-1621,-2220,-2741,-3160,-3433,-3517,-3399,-3098,-2602,-1945,-1155,-249,681,1562,2268,2676,2742,2438,1797,876,-225,-1359,-2408,-3283,-3917,-4259,-4274,-3992,-3462,-2737,-1928,
+    -1174,-594,-270,-236,-469,-875,-1357,-1774,-1994,-1956,-1599,-973,-187,680,1512,2210,2659,2782,2584,2062,1284,399,-457,-1165,-1630,-1823,-1790,-1580,-1262,-914,-558,-195,
+    154,438,646,786,811,684,386,-84,-729,-1512,-2342,-3157,-3869,-4380,-4640,-4601,-4241,-3601,-2713,-1599,-349,947,2198,3265,4021,4373,4280,3809,3068,2186,1326,601,
+    104,-55,157,705,1491,2405,3318,4040,4455,4510,4164,3462,2486,1346,183,-881,-1725,-2281,-2531,-2449,-2064,-1410,-552,411,1408,2349,3129,3680,3981,4040,3893,3575,
+    3103,2546,1947,1337,778,291,-142,-557,-942,-1268,-1541,-1773,-1967,-2131,-2272,-2390,-2464,-2488,-2474,-2377,-2140,-1723,-1148,-488,210,902,1576,2203,2719,3064,3181,3054,
+    2684,2124,1438,666,-141,-953,-1694,-2320,-2790,-3045,-3095,-2936,-2567,-2029,-1352,-580,217,963,1615,2125,2471,2642,2603,2383,2048,1663,1269,869,471,106,-195,-419,
+    -549,-592,-562,-467,-361,-298,-304,-393,-551,-727,-862,-896,-804,-612,-348,-11,393,822,1218,1499,1605,1520,1241,770,160,-512,-1189,-1787,-2232,-2498,-2583,-2517,
+    -2324,-2031,-1685,-1281,-812,-326,152,592,950,1215,1353,1361,1245,980,580,49,-573,-1232,-1871,-2392,-2724,-2796,-2573,-2088,-1390,-552,349,1221,1960,2473,2729,2731,
+    2496,2068,1513,948,481,159,-9,-57,-18,50,96,83,-74,-407,-894,-1507,-2186,-2885,-3551,-4108,-4510,-4686,-4591,-4273,-3762,-3082,-2298,-1460,-629,126,741,1173,
+    1434,1530,1487,1376,1235,1130,1112,1156,1257,1393,1535,1689,1847,2009,2158,2272,2356,2380,2325,2184,1951,1670,1339,959,579,228,-47,-225,-267,-135,112,433,
+    784,1105,1373,1555,1626,1588,1479,1334,1138,898,641,362,85,-152,-340,-460,-509,-505,-472,-440,-427,-462,-552,-681,-828,-955,-1059,-1128,-1124,-1025,-858,-645,
+    -367,-48,260,535,752,858,839,679,386,22,-397,-838,-1253,-1612,-1840,-1870,-1666,-1240,-622,157,1008,1865,2684,3389,3900,4159,4178,3974,3555,2976,2304,1625,
+    994,451,35,-253,-386,-358,-182,119,462,786,1032,1140,1109,956,700,353,-47,-445,-830,-1197,-1531,-1845,-2158,-2459,-2720,-2935,-3115,-3259,-3346,-3339,-3235,-3060,
+    -2817,-2511,-2119,-1629,-1088,-512,103,747,1396,1993,2500,2893,3109,3102,2869,2440,1852,1135,335,-485,-1267,-1955,-2488,-2827,-2974,-2919,-2660,-2220,-1633,-972,-327,231,
+    658,891,897,746,497,189,-123,-389,-553,-598,-508,-278,52,448,855,1204,1414,1434,1220,731,19,-879,-1911,-2930,-3814,-4475,-4852,-4940,-4742,-4255,-3511,-2587,
+    -1564,-536,406,1199,1802,2203,2384,2369,2202,1949,1708,1523,1409,1372,1408,1506,1623,1715,1773,1787,1728,1575,1313,932,434,-135,-710,-1243,-1646,-1838,-1817,-1607,
+    -1228,-714,-132,471,1067,1626,2126,2507,2754,2858,2793,2608,2344,2007,1635,1246,859,483,139,-153,-422,-662,-871,-1082,-1305,-1539,-1760,-1974,-2158,-2247,-2221,-2048,
+    -1711,-1242,-663,-13,637,1253,1803,2209,2454,2541,2463,2211,1754,1128,402,-356,-1054,-1610,-1975,-2115,-2005,-1637,-1068,-374,396,1174,1887,2467,2862,3036,2954,2641,
+    2135,1472,707,-96,-865,-1523,-2007,-2297,-2372,-2226,-1912,-1467,-932,-383,112,515,818,1010,1091,1053,878,588,234,-148,-544,-932,-1284,-1558,-1718,-1771,-1731,-1586,
+    -1326,-993,-628,-266,48,325,532,636,659,626,585,560,588,693,850,1046,1271,1550,1868,2151,2361,2469,2464,2337,2089,1759,1395,1021,658,332,71,-112,
+    -256,-390,-500,-595,-714,-875,-1057,-1226,-1370,-1489,-1560,-1571,-1507,-1367,-1174,-932,-659,-392,-139,90,287,417,452,424,359,243,49,-190,-437,-721,-1040,-1372,
+    -1723,-2088,-2452,-2768,-2991,-3089,-3064,-2947,-2714,-2361,-1929,-1457,-1004,-617,-320,-131,-40,-23,-39,-63,-76,-24,105,292,540,813,1066,1261,1355,1338,1208,957,
+    603,166,-307,-726,-1053,-1285,-1391,-1365,-1199,-913,-543,-97,382,855,1258,1541,1703,1735,1660,1515,1338,1154,974,835,767,760,806,911,1042,1200,1379,1520,
+    1631,1686,1639,1499,1265,975,656,349,115,-30,-78,-44,85,314,581,861,1104,1282,1405,1438,1396,1332,1243,1166,1137,1134,1152,1177,1207,1247,1270,1265,
+    1236,1201,1154,1083,976,827,653,437,186,-88,-386,-702,-1046,-1358,-1609,-1802,-1898,-1886,-1736,-1440,-1037,-589,-154,233,515,660,638,440,97,-377,-921,-1443,
+    -1872,-2149,-2233,-2121,-1836,-1427,-967,-535,-203,-25,-12,-137,-360,-635,-916,-1142,-1273,-1292,-1180,-941,-615,-234,180,575,950,1286,1498,1612,1647,1544,1357,1157,
+    979,836,707,569,432,342,254,116,-27,-173,-321,-454,-590,-738,-904,-1058,-1205,-1344,-1444,-1526,-1574,-1580,-1537,-1408,-1182,-863,-458,29,553,1067,1562,1986,
+    2292,2430,2362,2115,1720,1201,589,-46,-623,-1117,-1489,-1696,-1724,-1567,-1291,-946,-583,-272,-4,211,338,407,429,418,394,336,265,190,100,50,71,188,
+    406,683,995,1291,1517,1662,1685,1551,1307,998,619,209,-172,-468,-658,-747,-713,-573,-376,-181,-60,-48,-164,-416,-783,-1216,-1653,-2053,-2346,-2473,-2420,-2188,
+    -1820,-1350,-805,-245,304,789,1131,1323,1375,1306,1146,913,656,407,197,63,-8,-28,-24,-9,33,104,173,212,222,207,186,161,118,75,45,37,
+    43,31,25,67,165,316,520,772,1024,1250,1444,1573,1595,1478,1222,843,380,-120,-607,-1016,-1325,-1519,-1591,-1544,-1373,-1110,-804,-518,-284,-100,28,104,
+    135,129,112,130,207,365,582,791,985,1143,1250,1303,1277,1166,983,758,519,286,80,-99,-245,-335,-344,-280,-136,85,328,549,734,873,953,970,
+    948,899,815,710,613,562,580,662,779,912,1041,1134,1171,1146,1059,908,702,457,192,-63,-325,-616,-898,-1129,-1312,-1442,-1485,-1439,-1305,-1099,-864,-598,
+    -334,-110,62,166,208,174,75,-60,-235,-411,-547,-646,-708,-727,-699,-607,-452,-255,-47,148,335,482,555,546,439,243,-29,-352,-689,-1018,-1308,-1539,
+    -1708,-1793,-1780,-1672,-1481,-1253,-1029,-823,-657,-550,-514,-542,-626,-741,-844,-919,-970,-990,-952,-875,-798,-709,-620,-539,-464,-413,-377,-341,-292,-229,-165,-95,
+    -38,1,17,-9,-60,-147,-257,-333,-346,-274,-157,-9,207,467,754,1038,1300,1525,1704,1839,1872,1794,1631,1411,1207,1061,983,1002,1132,1330,1547,1760,
+    1937,2052,2074,1974,1783,1545,1307,1108,945,824,783,831,950,1136,1365,1582,1732,1771,1694,1501,1200,840,438,19,-362,-663,-847,-927,-885,-729,-495,-180,
+    159,494,793,996,1098,1106,1037,892,693,477,259,55,-114,-239,-315,-322,-291,-251,-194,-157,-167,-228,-333,-479,-676,-920,-1189,-1432,-1625,-1760,-1847,-1902,
+    -1881,-1769,-1592,-1351,-1064,-746,-411,-99,164,359,452,436,304,62,-233,-541,-841,-1101,-1290,-1358,-1308,-1151,-878,-537,-161,209,498,678,730,653,478,237,
+    -36,-316,-565,-770,-915,-978,-960,-842,-635,-362,-52,236,474,640,722,715,600,416,230,66,-50,-101,-92,-26,109,292,466,610,717,794,828,801,
+    736,659,601,583,593,621,680,777,900,1034,1159,1283,1386,1428,1415,1336,1210,1079,948,836,752,708,725,784,858,937,987,978,926,840,704,544,
+    377,173,-43,-231,-406,-576,-730,-854,-965,-1094,-1214,-1306,-1355,-1327,-1235,-1091,-887,-609,-272,70,397,658,837,939,892,709,446,81,-320,-676,-1022,-1330,
+    -1523,-1596,-1582,-1512,-1405,-1258,-1084,-939,-852,-776,-719,-688,-653,-620,-558,-445,-305,-161,-30,106,259,424,590,736,851,906,874,768,616,440,258,84,
+    -75,-220,-358,-469,-534,-568,-567,-533,-498,-457,-395,-313,-231,-165,-101,-18,83,202,343,511,694,889,1132,1424,1720,2003,2243,2397,2458,2435,2319,2117,
+    1850,1586,1366,1154,968,828,747,736,754,795,859,915,936,918,855,729,574,402,222,66,-61,-117,-69,80,298,548,812,1058,1273,1446,1571,1660,
+    1672,1587,1418,1176,902,598,262,-94,-446,-756,-1018,-1192,-1273,-1284,-1194,-1024,-807,-581,-370,-187,-68,-22,-69,-177,-276,-373,-456,-509,-527,-501,-441,-350,
+    -262,-199,-154,-121,-109,-120,-146,-214,-308,-417,-546,-658,-764,-882,-1003,-1130,-1274,-1437,-1606,-1766,-1892,-1967,-1971,-1892,-1738,-1502,-1206,-880,-562,-284,-19,202,
+    326,364,313,194,37,-166,-389,-597,-800,-998,-1175,-1330,-1462,-1545,-1555,-1482,-1335,-1123,-859,-568,-268,22,295,538,745,908,1022,1081,1081,1064,1038,1013,
+    1011,1035,1125,1260,1399,1538,1650,1733,1778,1774,1727,1661,1596,1537,1497,1490,1515,1564,1600,1586,1520,1402,1234,1041,825,594,388,252,216,284,459,719,
+    1048,1436,1834,2195,2476,2653,2713,2644,2467,2201,1883,1536,1130,694,292,-49,-350,-623,-834,-989,-1119,-1226,-1310,-1374,-1418,-1433,-1411,-1336,-1203,-1032,-838,-650,
+    -473,-312,-176,-58,42,132,216,278,278,205,58,-153,-400,-676,-946,-1199,-1427,-1594,-1698,-1726,-1658,-1509,-1328,-1150,-974,-779,-587,-450,-392,-424,-524,-660,
+    -822,-986,-1105,-1130,-1080,-990,-855,-700,-553,-414,-269,-152,-95,-74,-82,-122,-201,-311,-418,-503,-556,-596,-645,-678,-666,-592,-436,-224,3,251,517,764,
+    980,1159,1297,1375,1386,1376,1389,1446,1557,1705,1859,1995,2094,2138,2137,2093,1972,1788,1579,1342,1088,848,631,459,359,332,372,480,620,743,839,906,
+    946,963,939,883,805,721,652,586,542,539,550,556,561,558,534,473,366,230,72,-98,-266,-442,-620,-787,-911,-985,-1040,-1084,-1113,-1120,-1106,-1097,
+    -1107,-1134,-1163,-1192,-1247,-1318,-1363,-1386,-1382,-1328,-1262,-1193,-1062,-883,-683,-449,-201,44,300,529,681,713,608,404,115,-237,-642,-1094,-1533,-1917,-2226,-2436,
+    -2536,-2525,-2397,-2153,-1805,-1390,-945,-487,-35,380,732,1005,1184,1232,1152,970,698,382,47,-285,-573,-793,-932,-1004,-1011,-930,-775,-561,-294,23,368,712,
+    1033,1307,1521,1663,1721,1726,1718,1705,1675,1638,1609,1598,1631,1690,1749,1814,1871,1912,1955,1998,2037,2075,2098,2114,2111,2067,2002,1939,1847,1710,1560,1376,
+    1147,889,602,305,-4,-299,-539,-697,-753,-726,-634,-496,-305,-66,150,330,480,591,638,596,474,269,6,-281,-572,-835,-1038,-1152,-1186,-1173,-1105,-991,
+    -873,-755,-664,-612,-576,-571,-592,-640,-712,-769,-794,-783,-744,-696,-644,-575,-487,-405,-328,-259,-194,-132,-99,-97,-110,-143,-182,-238,-327,-431,-543,-625,
+    -684,-749,-788,-804,-814,-812,-783,-734,-687,-617,-550,-503,-468,-480,-516,-535,-539,-524,-486,-429,-338,-201,-13,205,434,654,835,999,1126,1169,1131,1013,
+    846,671,514,385,290,250,247,279,337,397,456,507,547,570,577,571,578,610,626,659,738,867,1045,1210,1348,1455,1522,1537,1498,1396,1229,1028,
+    776,491,217,-38,-236,-376,-465,-509,-503,-445,-358,-257,-161,-79,-20,11,6,-48,-128,-216,-311,-405,-469,-505,-537,-562,-541,-479,-417,-314,-166,1,
+    210,430,636,817,971,1068,1049,921,695,386,24,-353,-681,-947,-1138,-1237,-1262,-1211,-1057,-810,-526,-227,61,320,551,724,816,821,741,605,433,242,
+    63,-87,-208,-316,-408,-485,-557,-607,-648,-704,-767,-844,-918,-965,-982,-924,-795,-616,-360,-56,246,530,775,975,1106,1151,1129,1039,888,692,462,237,
+    32,-138,-214,-188,-95,67,283,519,756,972,1157,1288,1340,1319,1230,1080,894,712,550,416,338,315,343,434,552,693,848,977,1064,1100,1088,1026,
+    908,740,523,281,54,-148,-325,-457,-542,-598,-613,-569,-474,-331,-134,64,217,298,310,269,154,7,-138,-277,-349,-344,-281,-154,14,213,420,590,
+    709,744,674,508,242,-100,-471,-811,-1098,-1323,-1441,-1443,-1328,-1116,-846,-543,-248,4,196,309,338,283,151,-24,-195,-353,-494,-571,-568,-519,-430,-301,
+    -159,-39,54,119,143,131,71,-49,-218,-430,-654,-854,-1012,-1142,-1247,-1288,-1270,-1204,-1076,-909,-724,-550,-396,-252,-129,-40,12,30,33,41,78,159,
+    250,337,449,573,695,821,927,976,970,933,866,777,678,571,475,397,351,348,375,441,533,629,744,857,948,1023,1095,1184,1276,1356,1402,1396,
+    1345,1256,1149,1043,951,852,753,662,555,452,356,258,153,53,-8,-47,-67,-60,-27,20,69,135,201,261,312,353,401,435,439,414,370,300,
+    197,72,-73,-205,-310,-386,-417,-395,-320,-222,-112,27,176,297,376,418,419,383,281,116,-65,-274,-508,-742,-964,-1159,-1306,-1394,-1419,-1360,-1230,-1045,
+    -810,-544,-256,25,254,415,523,575,559,494,364,167,-42,-239,-404,-530,-639,-722,-772,-806,-828,-834,-837,-851,-854,-832,-784,-708,-623,-512,-365,-204,
+    -12,204,415,607,777,910,1000,1085,1197,1313,1383,1403,1390,1352,1297,1221,1130,1006,835,654,474,284,108,-36,-158,-264,-332,-345,-321,-274,-212,-129,
+    -36,48,131,205,282,361,415,465,506,536,552,513,437,338,194,28,-136,-281,-406,-503,-559,-578,-559,-511,-468,-432,-396,-350,-307,-285,-250,-208,
+    -196,-207,-226,-242,-266,-291,-287,-249,-170,-64,43,147,237,296,300,261,219,156,65,-33,-114,-160,-195,-216,-213,-185,-122,-39,60,147,211,231,
+    184,112,-3,-140,-260,-376,-450,-500,-524,-508,-498,-496,-497,-468,-404,-342,-285,-228,-169,-96,13,144,254,339,402,449,476,476,446,385,297,185,
+    81,22,14,65,160,282,426,573,727,890,1041,1155,1225,1257,1252,1239,1213,1151,1074,980,876,778,704,647,561,447,312,177,74,-31,-150,-252,
+    -322,-354,-364,-358,-305,-226,-147,-61,16,90,188,305,407,478,523,530,510,468,416,366,301,231,150,56,-24,-94,-165,-234,-293,-356,-426,-500,
+    -589,-667,-721,-765,-792,-798,-778,-738,-671,-568,-442,-302,-185,-85,1,56,92,71,-2,-90,-188,-280,-367,-435,-457,-440,-415,-392,-348,-282,-214,-154,
+    -95,-55,-33,-16,-18,-44,-99,-162,-237,-310,-347,-356,-332,-278,-223,-154,-61,35,131,235,313,334,317,299,271,248,262,306,367,441,528,610,
+    662,704,746,769,755,699,604,458,253,22,-176,-329,-438,-483,-470,-408,-291,-149,-1,148,280,382,441,480,506,496,455,375,264,156,63,-14,
+    -73,-114,-148,-159,-143,-137,-147,-157,-173,-197,-229,-262,-298,-350,-391,-400,-372,-278,-129,47,241,437,613,766,885,930,908,811,637,427,182,-89,
+    -345,-558,-703,-777,-795,-773,-717,-649,-575,-481,-393,-325,-271,-231,-194,-161,-121,-68,-26,11,81,203,371,542,680,784,851,880,875,822,735,640,
+    549,450,331,207,87,-14,-93,-173,-265,-372,-497,-616,-698,-748,-768,-744,-682,-565,-392,-195,-9,161,339,503,652,776,849,893,894,856,781,661,
+    530,398,289,195,109,32,-53,-125,-189,-230,-242,-243,-216,-189,-158,-114,-78,-24,44,118,215,323,416,480,511,515,495,449,394,350,305,257,
+    226,212,204,214,236,262,281,287,274,213,129,42,-78,-220,-356,-452,-513,-573,-612,-627,-634,-619,-586,-540,-486,-431,-361,-273,-172,-68,32,108,
+    160,185,158,107,31,-75,-185,-292,-387,-459,-510,-545,-554,-513,-436,-347,-250,-160,-102,-68,-57,-68,-95,-126,-141,-126,-66,18,89,171,252,298,
+    326,333,293,207,72,-85,-231,-360,-459,-526,-556,-535,-462,-346,-215,-76,66,180,251,280,274,233,162,71,-21,-108,-176,-222,-248,-246,-216,-139,
+    -28,100,233,345,457,557,618,636,620,600,568,513,438,366,303,242,194,145,105,71,41,29,12,-5,-4,22,58,105,172,240,298,316,
+    296,273,253,241,236,239,266,318,390,489,570,602,635,658,650,608,527,419,277,115,-43,-161,-226,-253,-240,-204,-132,-52,2,69,153,222,
+    255,249,221,167,99,21,-54,-83,-86,-76,-46,-25,-22,-4,30,54,64,61,32,-20,-70,-120,-176,-233,-305,-388,-437,-430,-404,-398,-398,-417,
+    -446,-466,-486,-482,-467,-445,-400,-346,-265,-166,-48,78,197,288,329,347,341,312,263,176,68,-51,-167,-280,-384,-455,-495,-500,-461,-373,-255,-105,
+    73,246,402,517,597,664,682,642,560,440,304,146,-44,-214,-352,-468,-540,-560,-500,-365,-186,-2,152,293,412,465,458,407,316,210,97,-9,
+    -91,-178,-250,-260,-242,-211,-156,-95,-9,99,216,323,404,472,513,521,505,469,410,335,244,129,7,-117,-253,-410,-560,-672,-759,-808,-810,-781,
+    -719,-613,-463,-288,-116,47,210,354,453,508,528,499,417,309,170,10,-151,-292,-399,-476,-516,-535,-520,-458,-370,-254,-140,-63,-9,43,97,139,
+};
+
+static constexpr float kGuzhengScale = 3.05063822e-05f;
+static constexpr int16_t kGuzheng[BodyIR::kSize] = {
+    13356,18717,22736,25138,26408,27377,28664,30321,31893,32767,32552,31222,29003,26151,22824,19118,15185,11275,7653,4442,1550,-1237,-4066,-6879,-9432,-11475,-12929,-13940,-14755,-15539,-16264,-16758,
+    -16866,-16574,-16024,-15412,-14872,-14434,-14074,-13780,-13566,-13431,-13309,-13106,-12800,-12536,-12607,-13298,-14677,-16491,-18251,-19492,-20022,-20018,-19876,-19941,-20265,-20573,-20432,-19525,-17843,-15702,-13580,-11882,
+    -10769,-10118,-9621,-8942,-7869,-6391,-4684,-3026,-1675,-753,-186,268,920,2007,3586,5504,7473,9192,10476,11302,11787,12104,12388,12701,13027,13312,13494,13518,13341,12941,12343,11622,
+    10895,10257,9724,9210,8578,7747,6784,5909,5394,5402,5881,6581,7197,7550,7674,7758,7984,8378,8784,8988,8884,8578,8330,8381,8787,9369,9819,9880,9486,8773,7965,7235,
+    6620,6030,5331,4428,3297,1980,562,-856,-2160,-3240,-4025,-4508,-4756,-4874,-4952,-5017,-5032,-4925,-4638,-4161,-3528,-2804,-2071,-1422,-954,-746,-834,-1186,-1715,-2316,-2915,-3497,
+    -4081,-4678,-5254,-5736,-6061,-6227,-6307,-6421,-6665,-7052,-7506,-7905,-8156,-8248,-8257,-8291,-8412,-8574,-8628,-8378,-7687,-6564,-5188,-3842,-2785,-2132,-1798,-1558,-1183,-581,145,744,
+    961,672,-38,-923,-1684,-2108,-2132,-1849,-1433,-1059,-838,-790,-859,-949,-968,-871,-671,-438,-266,-229,-353,-601,-890,-1121,-1216,-1147,-943,-682,-462,-355,-363,-403,
+    -341,-57,476,1159,1803,2233,2379,2323,2246,2310,2553,2863,3052,2976,2642,2211,1910,1906,2209,2670,3068,3227,3102,2793,2481,2328,2405,2663,2973,3193,3249,3163,
+    3050,3057,3298,3797,4476,5189,5780,6139,6240,6144,5964,5823,5809,5943,6169,6374,6432,6253,5820,5201,4515,3877,3348,2910,2483,1981,1358,653,-28,-553,-822,-820,
+    -626,-381,-222,-223,-367,-566,-721,-790,-815,-898,-1128,-1517,-1986,-2399,-2649,-2723,-2705,-2725,-2875,-3155,-3479,-3735,-3859,-3880,-3898,-4035,-4359,-4855,-5433,-5970,-6364,-6568,
+    -6598,-6514,-6392,-6288,-6219,-6158,-6054,-5856,-5543,-5132,-4674,-4233,-3866,-3610,-3473,-3436,-3454,-3472,-3434,-3314,-3128,-2930,-2787,-2728,-2722,-2681,-2504,-2140,-1624,-1065,-591,-280,
+    -126,-52,31,169,334,452,458,353,211,154,283,629,1134,1680,2150,2485,2708,2899,3144,3477,3855,4179,4351,4328,4156,3950,3842,3913,4165,4518,4853,5067,
+    5110,4998,4798,4593,4447,4389,4399,4422,4393,4259,4009,3678,3334,3056,2893,2845,2862,2865,2782,2584,2303,2018,1827,1797,1929,2152,2348,2413,2301,2051,1762,1536,
+    1415,1357,1265,1041,656,166,-311,-668,-858,-926,-970,-1087,-1314,-1614,-1899,-2083,-2134,-2083,-2013,-2011,-2121,-2327,-2558,-2730,-2784,-2714,-2575,-2445,-2396,-2453,-2591,-2750,
+    -2861,-2881,-2800,-2649,-2477,-2342,-2285,-2323,-2440,-2590,-2712,-2759,-2722,-2640,-2590,-2640,-2815,-3070,-3307,-3414,-3326,-3051,-2674,-2308,-2043,-1906,-1858,-1819,-1724,-1561,-1373,-1236,
+    -1213,-1311,-1474,-1606,-1623,-1489,-1233,-931,-657,-449,-290,-136,53,279,502,663,720,672,564,464,428,479,601,751,885,974,1020,1046,1088,1178,1329,1532,
+    1756,1961,2112,2192,2211,2199,2194,2226,2308,2423,2533,2596,2581,2495,2380,2303,2323,2461,2682,2908,3052,3064,2952,2777,2615,2517,2477,2444,2351,2166,1908,1643,
+    1448,1370,1403,1492,1568,1580,1519,1421,1336,1297,1301,1307,1263,1137,936,704,503,376,328,325,310,238,92,-109,-326,-518,-659,-751,-812,-871,-957,-1085,
+    -1252,-1436,-1603,-1718,-1761,-1743,-1703,-1694,-1763,-1924,-2145,-2363,-2509,-2538,-2455,-2311,-2180,-2121,-2149,-2231,-2302,-2302,-2216,-2078,-1962,-1936,-2029,-2209,-2401,-2523,-2530,-2430,
+    -2277,-2138,-2055,-2023,-2005,-1952,-1836,-1668,-1489,-1345,-1267,-1249,-1259,-1252,-1194,-1079,-929,-778,-661,-590,-554,-521,-459,-345,-177,25,232,416,557,656,728,795,
+    882,999,1134,1259,1336,1337,1262,1148,1055,1044,1144,1340,1573,1773,1889,1916,1892,1876,1913,2006,2117,2187,2167,2051,1877,1713,1623,1634,1731,1861,1966,2012,
+    2000,1963,1938,1943,1968,1980,1944,1844,1692,1522,1370,1258,1186,1135,1083,1011,919,816,721,645,595,565,542,508,451,363,253,136,34,-37,-74,-91,
+    -117,-180,-295,-454,-626,-768,-846,-853,-813,-771,-775,-845,-966,-1097,-1188,-1214,-1188,-1153,-1163,-1250,-1405,-1583,-1724,-1785,-1762,-1685,-1602,-1557,-1560,-1597,-1631,-1632,
+    -1591,-1525,-1464,-1436,-1449,-1489,-1527,-1535,-1499,-1428,-1345,-1277,-1239,-1229,-1234,-1232,-1209,-1159,-1089,-1013,-942,-883,-836,-793,-739,-664,-562,-441,-321,-230,-191,-206,
+    -256,-304,-309,-248,-126,28,171,271,322,349,390,479,619,784,924,996,982,904,809,754,771,856,975,1081,1140,1151,1138,1138,1177,1256,1352,1431,
+    1464,1447,1393,1332,1289,1276,1287,1306,1313,1298,1261,1216,1177,1159,1164,1187,1213,1228,1220,1188,1140,1089,1048,1023,1009,989,942,855,728,582,448,356,
+    322,334,361,367,328,247,151,75,42,50,69,57,-16,-153,-327,-491,-603,-645,-629,-591,-570,-590,-648,-720,-778,-803,-796,-781,-784,-824,-902,-1000,
+    -1089,-1149,-1173,-1167,-1149,-1137,-1141,-1160,-1186,-1207,-1215,-1208,-1190,-1168,-1150,-1141,-1140,-1140,-1130,-1102,-1052,-989,-928,-889,-880,-899,-929,-943,-924,-864,-777,-689,
+    -623,-589,-578,-564,-520,-435,-320,-205,-125,-99,-122,-165,-190,-168,-94,11,114,186,219,225,232,264,332,425,521,594,633,641,635,637,662,711,
+    773,831,869,884,879,867,861,869,891,922,953,977,988,991,990,995,1012,1038,1064,1075,1058,1009,935,855,793,763,764,782,795,785,750,705,
+    670,665,690,728,749,725,648,531,405,304,248,234,241,240,210,150,76,14,-18,-18,-1,8,-13,-70,-155,-247,-324,-375,-400,-411,-422,-446,
+    -486,-536,-587,-628,-651,-658,-655,-653,-661,-682,-711,-741,-761,-764,-755,-741,-736,-752,-790,-840,-887,-912,-906,-874,-831,-796,-782,-788,-798,-793,-760,-701,
+    -634,-585,-571,-596,-642,-681,-688,-654,-586,-510,-448,-415,-407,-406,-391,-350,-283,-208,-144,-106,-97,-105,-112,-101,-64,-6,60,119,160,183,193,201,
+    217,245,283,326,366,396,415,428,444,469,509,558,607,643,657,648,625,603,596,609,636,665,682,680,665,652,656,683,727,770,790,776,
+    728,665,610,579,577,592,604,596,563,514,467,440,438,455,474,477,453,405,346,291,253,235,230,226,209,176,127,72,20,-19,-44,-58,
+    -68,-84,-108,-141,-177,-208,-228,-235,-236,-241,-260,-298,-353,-413,-465,-498,-509,-507,-504,-510,-529,-553,-569,-567,-545,-513,-487,-484,-510,-557,-609,-645,
+    -653,-636,-606,-580,-571,-580,-595,-601,-587,-549,-500,-454,-427,-424,-440,-459,-468,-457,-426,-384,-343,-313,-297,-292,-288,-278,-255,-220,-178,-138,-106,-86,
+    -74,-64,-47,-17,25,72,115,143,154,152,147,150,169,202,241,275,295,302,305,314,340,381,428,466,482,474,450,426,417,429,457,487,
+    506,506,491,472,461,468,490,517,536,537,517,484,451,430,425,434,447,454,447,424,391,357,329,312,304,299,290,273,246,215,186,166,
+    159,161,166,162,143,108,62,15,-22,-46,-58,-66,-80,-104,-135,-165,-184,-187,-177,-164,-162,-178,-214,-259,-301,-329,-339,-337,-335,-343,-363,-391,
+    -417,-428,-422,-403,-381,-369,-372,-390,-415,-435,-442,-435,-418,-399,-387,-386,-395,-408,-417,-415,-402,-381,-357,-339,-328,-325,-324,-319,-303,-277,-244,-212,
+    -189,-179,-181,-189,-193,-186,-166,-137,-107,-85,-71,-64,-54,-33,0,41,80,107,117,112,102,98,107,130,160,187,203,207,206,209,223,250,
+    283,313,331,333,323,309,300,303,318,339,358,368,367,358,346,338,338,345,354,361,359,349,333,315,303,301,308,319,328,326,311,286,
+    257,232,217,212,210,205,191,168,142,120,109,110,118,122,115,93,60,25,-2,-17,-22,-24,-31,-48,-74,-102,-124,-135,-135,-130,-128,-136,
+    -156,-182,-208,-226,-233,-231,-225,-223,-228,-242,-261,-280,-293,-298,-296,-291,-288,-291,-300,-312,-321,-322,-313,-295,-275,-260,-255,-261,-273,-285,-291,-286,
+    -274,-259,-248,-243,-244,-245,-239,-222,-195,-164,-138,-124,-122,-128,-133,-131,-119,-99,-78,-63,-56,-54,-52,-42,-23,4,33,56,69,72,70,70,
+    76,91,112,133,149,158,159,158,159,165,177,194,210,221,225,223,218,216,221,233,250,266,276,276,267,253,241,236,238,245,251,251,
+    243,230,218,212,215,225,235,239,232,214,192,171,158,154,154,153,146,132,113,96,85,82,84,85,80,67,46,23,4,-8,-13,-13,
+    -14,-20,-32,-49,-67,-82,-92,-96,-98,-102,-111,-125,-142,-159,-170,-174,-170,-163,-157,-157,-165,-179,-195,-207,-212,-211,-206,-204,-208,-217,-228,-236,
+    -235,-225,-209,-193,-184,-184,-191,-200,-206,-203,-194,-182,-171,-167,-169,-172,-173,-167,-153,-134,-117,-105,-100,-101,-102,-99,-90,-74,-57,-42,-31,-26,
+    -24,-23,-18,-9,5,19,31,39,42,42,44,51,64,83,102,118,127,128,125,121,121,127,137,147,154,155,152,148,148,154,167,183,
+    196,202,199,189,178,172,171,175,181,182,178,169,159,153,152,157,163,167,164,155,141,128,118,114,113,113,111,105,94,82,70,62,
+    58,56,54,48,38,25,10,-2,-10,-12,-11,-10,-12,-19,-31,-46,-60,-69,-73,-74,-75,-81,-91,-105,-117,-125,-126,-120,-113,-109,-112,-122,
+    -135,-146,-152,-152,-147,-143,-143,-147,-155,-162,-164,-161,-153,-144,-138,-137,-140,-146,-150,-150,-144,-135,-125,-118,-115,-114,-115,-114,-109,-101,-92,-83,
+    -78,-76,-77,-77,-74,-66,-54,-39,-25,-15,-10,-9,-10,-9,-3,6,17,25,30,30,29,29,34,46,61,76,87,91,90,87,85,88,
+    95,104,111,114,113,109,107,108,114,123,131,136,136,132,126,122,121,124,128,132,133,130,124,118,113,111,112,113,113,109,102,93,
+    85,79,78,80,83,83,80,72,61,50,42,38,36,35,31,23,12,1,-7,-11,-10,-7,-5,-7,-14,-25,-37,-46,-51,-52,-52,-54,
+    -59,-68,-77,-84,-87,-85,-82,-80,-81,-86,-94,-102,-107,-109,-107,-104,-102,-102,-104,-108,-111,-112,-110,-106,-102,-100,-101,-104,-108,-110,-108,-103,
+    -95,-87,-81,-78,-78,-79,-80,-77,-71,-64,-57,-53,-52,-54,-55,-54,-47,-37,-25,-15,-9,-8,-9,-9,-6,0,8,16,21,23,22,22,
+    24,30,38,47,55,59,60,58,57,58,63,69,76,81,83,83,82,81,82,86,90,93,95,93,89,85,83,83,86,91,95,97,
+    95,91,86,82,80,80,81,80,77,70,62,55,52,53,56,59,60,56,49,41,33,29,28,27,26,22,15,7,0,-5,-6,-5,
+    -4,-5,-9,-16,-24,-31,-35,-37,-37,-37,-38,-42,-47,-53,-58,-60,-60,-59,-59,-61,-65,-71,-76,-79,-79,-77,-74,-71,-70,-72,-75,-78,
+    -80,-79,-76,-73,-71,-72,-75,-78,-79,-77,-72,-65,-59,-55,-54,-56,-58,-58,-55,-50,-44,-39,-37,-37,-38,-38,-35,-29,-21,-14,-9,-8,
+    -8,-9,-8,-5,0,6,12,16,18,19,20,21,25,30,36,40,42,42,40,39,40,44,49,55,59,61,61,60,59,60,62,65,
+    68,68,66,63,59,58,59,62,66,69,69,66,62,58,56,56,57,59,58,55,50,44,40,39,39,41,42,40,36,31,25,21,
+    19,18,18,17,15,11,6,2,-1,-3,-3,-4,-6,-10,-15,-20,-25,-27,-27,-27,-26,-27,-29,-33,-37,-40,-42,-42,-42,-42,-44,-48,
+    -52,-56,-58,-57,-54,-51,-49,-49,-52,-55,-58,-58,-56,-53,-51,-50,-52,-54,-56,-56,-53,-49,-45,-41,-40,-40,-41,-42,-41,-39,-35,-31,
+    -28,-26,-25,-25,-24,-21,-18,-13,-9,-7,-6,-6,-7,-6,-4,0,5,9,12,14,14,15,16,19,22,26,29,30,29,28,28,29,
+    32,37,41,44,44,43,41,41,42,45,47,49,49,47,44,42,42,44,46,49,49,48,45,42,40,39,39,40,41,40,38,35,
+    32,30,29,29,29,29,27,23,19,15,12,11,11,11,11,10,7,4,1,-1,-2,-2,-2,-4,-7,-11,-16,-19,-20,-20,-19,-18,
+    -19,-22,-25,-28,-30,-30,-29,-29,-30,-32,-35,-38,-40,-40,-39,-37,-35,-35,-36,-38,-40,-41,-41,-40,-38,-36,-35,-36,-37,-38,-38,-36,
+    -34,-31,-29,-28,-29,-30,-31,-30,-28,-25,-22,-19,-17,-16,-16,-15,-14,-11,-8,-5,-4,-4,-4,-5,-5,-2,1,5,8,10,10,10,
+    10,11,14,17,20,21,21,20,20,20,22,25,28,30,31,31,30,28,28,29,31,33,34,34,33,32,31,31,32,34,35,35,
+    33,31,28,27,26,26,27,28,28,27,25,23,22,21,21,21,20,18,16,13,10,9,8,8,9,8,6,4,1,-1,-1,-1,
+    -1,-1,-3,-6,-9,-12,-13,-14,-13,-12,-13,-14,-16,-19,-21,-22,-22,-22,-22,-22,-23,-25,-26,-27,-27,-26,-25,-24,-25,-26,-28,-29,
+    -30,-30,-29,-27,-26,-25,-25,-26,-26,-26,-25,-23,-21,-20,-20,-21,-22,-22,-21,-19,-16,-14,-12,-12,-12,-12,-12,-10,-7,-5,-3,-2,
+    -2,-3,-3,-2,0,2,5,6,7,7,7,7,8,10,12,14,15,15,15,15,16,17,19,21,22,22,22,21,20,20,21,22,
+    23,24,24,23,22,22,22,23,24,24,24,23,22,20,19,19,19,20,21,20,19,17,15,14,14,15,15,14,13,10,8,6,
+    6,7,7,7,6,4,2,0,-1,-1,-1,-1,-2,-3,-5,-7,-8,-9,-9,-9,-9,-9,-10,-12,-14,-15,-16,-16,-16,-16,-16,-17,
+    -18,-19,-20,-20,-19,-18,-18,-18,-19,-20,-21,-21,-21,-20,-19,-18,-18,-18,-19,-19,-19,-17,-16,-15,-14,-14,-15,-15,-15,-14,-12,-10,
+    -9,-8,-8,-8,-9,-8,-7,-5,-4,-3,-2,-2,-2,-1,0,1,3,4,5,5,5,5,4,5,6,8,10,11,11,11,11,11,
+    12,14,15,16,16,15,14,14,14,15,16,17,17,17,16,16,16,16,16,17,17,17,16,15,14,13,13,14,15,15,14,13,
+    11,10,10,10,10,10,9,8,7,6,5,5,5,5,4,3,2,1,0,-1,-1,-1,-1,-1,-2,-3,-4,-5,-6,-6,-6,-6,
+    -7,-8,-9,-10,-12,-12,-12,-11,-11,-11,-12,-13,-14,-14,-14,-13,-12,-12,-13,-14,-15,-15,-15,-14,-13,-12,-12,-12,-13,-13,-13,-13,
+    -12,-11,-10,-10,-10,-11,-11,-11,-9,-8,-7,-6,-6,-6,-6,-6,-5,-4,-3,-2,-1,-1,-1,0,0,1,1,2,3,3,3,3,
+    3,3,4,5,6,7,8,8,8,8,8,9,10,11,11,11,10,9,9,10,11,12,12,12,12,11,11,11,11,12,12,12,
+    11,11,10,10,10,10,10,10,10,9,9,8,7,7,7,7,6,6,5,5,4,4,3,3,3,2,2,1,1,0,-1,-1,
+    -1,-1,-1,-2,-3,-4,-4,-4,-4,-4,-4,-5,-6,-7,-8,-8,-8,-7,-7,-7,-7,-8,-9,-10,-10,-10,-9,-9,-9,-9,-10,-10,
+    -10,-10,-10,-9,-9,-9,-9,-9,-9,-9,-9,-8,-8,-7,-7,-7,-7,-7,-7,-6,-5,-4,-4,-4,-4,-4,-4,-4,-3,-2,-2,-1,
+    -1,0,0,0,1,1,1,2,2,2,2,2,2,3,4,5,5,5,5,5,5,6,6,7,7,7,7,7,7,7,8,8,
+    9,9,9,8,7,7,7,7,8,8,8,8,8,8,7,7,7,7,7,7,7,6,5,4,4,4,5,5,5,4,3,2,
+    2,2,2,2,2,1,1,0,0,0,0,0,0,-1,-2,-3,-3,-3,-3,-3,-3,-4,-4,-4,-5,-5,-5,-5,-5,-5,-5,-5,
+    -6,-6,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-7,-6,-6,-6,-6,-6,-7,-7,-7,-7,-6,-5,-5,-5,-5,-5,-5,-5,-4,-4,
+    -3,-3,-3,-3,-3,-3,-2,-1,-1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,2,3,3,4,4,4,4,4,
+    4,4,4,5,5,5,5,5,5,6,6,6,6,6,6,5,5,5,6,6,6,6,6,6,5,5,5,5,5,5,4,4,
+    4,3,3,3,3,3,3,2,2,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,-1,-1,-1,-2,-2,-2,-2,
+    -2,-2,-2,-3,-4,-4,-4,-4,-3,-3,-3,-4,-5,-6,-6,-5,-4,-4,-4,-4,-5,-5,-5,-4,-4,-4,-4,-4,-4,-5,-5,-5,
+    -5,-4,-4,-3,-3,-3,-3,-3,-3,-2,-2,-2,-2,-2,-2,-2,-2,-1,-1,0,0,0,0,0,0,0,0,0,0,0,1,1,
+    1,1,1,1,2,2,2,2,2,2,2,3,4,4,4,4,3,3,3,4,4,4,4,4,4,4,4,4,4,4,4,4,
+    4,4,3,3,3,3,3,3,3,3,3,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,0,0,0,0,0,0,
+    0,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-3,-3,-3,-3,-2,-2,-2,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,
+    -3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-3,-2,-2,-2,-2,-2,-2,-2,-2,-2,-1,-1,-1,-1,-1,-1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+    3,3,3,2,2,2,2,2,3,3,3,3,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-2,-2,-2,-2,
+    -2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-2,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1,1,
+    1,1,1,1,2,2,2,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-2,-2,-2,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,
+    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,0,0,0,-1,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,-1,-1,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+const BodyIR kBodyIRs[] {
+    { kBanjo, kBanjoScale },
+    { kCalcani, kCalcaniScale },
+    { kGuitar, kGuitarScale },
+    { kKlotz, kKlotzScale },
+    { kLanghof, kLanghofScale },
+    { kBanjo2, kBanjo2Scale },
+    { kDobro, kDobroScale },
+    { kViola, kViolaScale },
+    { kGuzheng, kGuzhengScale },
+};
+const uint32_t kNumBodyIRs = std::size(kBodyIRs);
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <cstdint>
+
+namespace dsp {
+
+/**
+ * @brief 压缩存放的琴体IR, int16 + 每个IR一个缩放
+ * 只在选择琴体时解码, 见 Body::DoBodyFFT
+ */
+struct BodyIR {
+    static constexpr uint32_t kSize = 4096;
+
+    const int16_t* data;
+    float scale;
+
+    float operator[](uint32_t i) const { return data[i] * scale; }
+};
+
+// BodyEnum 的顺序, 由 pctest/src/tools/BodyPack 生成
+extern const BodyIR kBodyIRs[];
+extern const uint32_t kNumBodyIRs;
+
+}
@@ -4,6 +4,7 @@
 #include "DelayAllocator.hpp"
 #include "params.hpp"
 #include "MidiManager.hpp"
+#include "Tuning.hpp"
 
 static constexpr float FastPowN4(float x) {
     float x2 = x * x;
@@ -12,6 +13,29 @@ static constexpr float FastPowN4(float x) {
 
 namespace dsp {
 
+void Bowed::BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate) {
+    Lowpass lossLP;
+    lossLP.Init(sampleRate);
+    lossLP.SetLoopFilterType(SynthParams.bow.lossFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1);
+    const float bendRatio = std::exp2(SynthParams.pitchBend.Get() / 12.0f);
+    const float d = SynthParams.bow.decay.Get();
+    const auto mul = 1.0f / (sampleRate * d / 1000.0f);
+    for (uint32_t note = 0; note < table.size(); ++note) {
+        auto& p = table[note];
+        const float freq = freqs[note];
+        p.lossCutoff = Note::Midi2Frequency(GetLossLP(note));
+        lossLP.SetCutOffFreq(p.lossCutoff);
+        float filterLen = lossLP.GetPhaseDelay(freq);
+        p.totalLoopLen = sampleRate / freq;
+        p.loopLen = p.totalLoopLen - filterLen;
+        p.bendDelta = p.totalLoopLen - p.totalLoopLen / bendRatio;
+        auto t = std::pow(10.0f, -(p.totalLoopLen * mul));
+        p.decayGain = std::min(0.9999f, t);
+    }
+}
+
 void Bowed::Init(float sampleRate) {
     nutBowDelay_->Init(sampleRate);
     bowBridgeDelay_->Init(sampleRate);
@@ -21,16 +45,15 @@ void Bowed::Init(float sampleRate) {
     speedEnv_.Init(sampleRate);
     noiseLP_.Init(sampleRate);
 
-    tremoloDelay_.Init(sampleRate / 480);
-    vibrateDelay_.Init(sampleRate / 480);
+    tremoloDelay_.Init(sampleRate);
+    vibrateDelay_.Init(sampleRate);
     tremoloOscPhase_ = 0.0f;
     vibrateOscPhase_ = 0.0f;
 }
 
-float Bowed::ProcessSingle() {
+float Bowed::ProcessSingle(float noise) {
     float env = speedEnv_.Process(sustain_);
     currBowSpeed_ = env;
-    float noise = noise_.Next();
     noise = noiseLP_.Process(noise) * noiseAmount_;
     auto bowSpeed = (bowSpeed_ + tremoloAmount_ + noise) * env;
 
@@ -63,32 +86,38 @@ float Bowed::ProcessSingleNoBow() {
     return out;
 }
 
+void Bowed::PlanNote(Plan& plan, uint8_t note, float velocity, float sampleRate) {
+    plan.note = note;
+    plan.sustain = velocity;
+    plan.pitch = Tuning.GetBowPitch(note);
+    plan.lossLP.Init(sampleRate);
+    plan.lossLP.SetLoopFilterType(SynthParams.bow.lossFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1);
+    plan.lossLP.SetCutOffFreq(plan.pitch.lossCutoff);
+}
+
 void Bowed::NoteOn(uint8_t channel, uint32_t note, float velocity) {
+    Plan plan;
+    PlanNote(plan, note, velocity, sampleRate_);
+    NoteOn(channel, plan);
+}
+
+void Bowed::NoteOn(uint8_t channel, const Plan& plan) {
     channel_ = channel;
-    note_ = note;
-    sustain_ = velocity;
+    note_ = plan.note;
+    sustain_ = plan.sustain;
     noteOned_ = true;
     bowUp_ = true;
 
-    auto lossLPSt = GetLossLP(note);
-    auto lossFreq = Note::Midi2Frequency(lossLPSt);
-    lossLP_.SetCutOffFreq(lossFreq);
-
-    float freq = Note::Midi2Frequency(note);
-    float vibrateFreq = Note::Midi2Frequency(note + SynthParams.pitchBend.Get());
-    float filterLen = lossLP_.GetPhaseDelay(freq);
-    totalLoopLen_ = sampleRate_ / freq;
-    waveguideLoopLen_ = totalLoopLen_ - filterLen;
-    float vibrateLen = sampleRate_ / vibrateFreq - filterLen;
-    pitchBendLenDelta_ = totalLoopLen_ - filterLen - vibrateLen;
+    lossLP_.CopyCoeff(plan.lossLP);
+    totalLoopLen_ = plan.pitch.totalLoopLen;
+    waveguideLoopLen_ = plan.pitch.loopLen;
+    pitchBendLenDelta_ = plan.pitch.bendDelta;
+    decayGain_ = plan.pitch.decayGain;
 
     vibrateDelay_.Set(0);
     tremoloDelay_.Set(0);
-
-    float d = SynthParams.bow.decay.Get();
-    auto mul = 1.0f / (static_cast<float>(sampleRate_) * d / 1000.0f);
-    auto t = std::pow(10.0f, -(static_cast<float>(totalLoopLen_ * mul)));
-    decayGain_ = std::min(0.9999f, t);
 }
 
 void Bowed::NoteOff() {
@@ -100,13 +129,11 @@ void Bowed::Panic() {
 }
 
 bool Bowed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
-    UpdateParam();
+    UpdateParam(buffer.size());
     maxSample_ = 0.0f;
 
     if (bowUp_) {
-        for (auto& s : buffer) {
-            s = ProcessSingle();
-        }
+        ProcessBow<false>(buffer);
     }
     else {
         for (auto& s : buffer) {
@@ -122,13 +149,11 @@ bool Bowed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
 }
 
 bool Bowed::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
-    UpdateParam();
+    UpdateParam(buffer.size());
     maxSample_ = 0.0f;
 
     if (bowUp_) {
-        for (auto& s : buffer) {
-            s += ProcessSingle();
-        }
+        ProcessBow<true>(buffer);
     }
     else {
         for (auto& s : buffer) {
@@ -143,25 +168,43 @@ bool Bowed::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
     return maxSample_ < 1e-3f && !bowUp_ && !noteOned_;
 }
 
-void Bowed::UpdateParam() {
+template<bool kAdd>
+void Bowed::ProcessBow(std::span<float> buffer) {
+    // 噪声按tile整块生成
+    float noise[BlockNoise::kTileSize];
+    for (uint32_t pos = 0; pos < buffer.size(); pos += BlockNoise::kTileSize) {
+        uint32_t n = std::min<uint32_t>(BlockNoise::kTileSize, buffer.size() - pos);
+        noise_.Fill(std::span{ noise, n });
+        for (uint32_t i = 0; i < n; ++i) {
+            if constexpr (kAdd) {
+                buffer[pos + i] += ProcessSingle(noise[i]);
+            }
+            else {
+                buffer[pos + i] = ProcessSingle(noise[i]);
+            }
+        }
+    }
+}
+
+void Bowed::UpdateParam(uint32_t numSamples) {
     noiseAmount_ = SynthParams.bow.noise.Get();
 
     float pitchBendAmount = 0.0f;
     auto virbrateMode = SynthParams.bow.vibrateControl.Get();
     if (virbrateMode == 0) {
         // use auto vibrate
-        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
         }
         float triangle = 4.0f * std::abs(vibrateOscPhase_ - 0.5f) - 1.0f;
         pitchBendAmount = triangle * SynthParams.bow.vibrateDepth.Get();
-        pitchBendAmount *= vibrateDelay_.Process(1);
+        pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     }
     else if (virbrateMode == 1) {
         // pitchbend as vibrate depth
-        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
@@ -169,13 +212,13 @@ void Bowed::UpdateParam() {
         float triangle = 4.0f * std::abs(vibrateOscPhase_ - 0.5f) - 1.0f;
         float depth = MidiManager.GetTouchSliderValue(channel_);
         pitchBendAmount = triangle * SynthParams.bow.vibrateDepth.Get() * std::abs(depth);
-        pitchBendAmount *= vibrateDelay_.Process(1);
+        pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     }
     else {
         // pitchbend as manual vibrate
         pitchBendAmount = MidiManager.GetTouchSliderValue(channel_) * SynthParams.bow.vibrateDepth.Get();
     }
-    pitchBendAmount *= vibrateDelay_.Process(1);
+    pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     float vibrateLen = waveguideLoopLen_ + pitchBendAmount * pitchBendLenDelta_;
     float nutLen = vibrateLen * bowPosition_;
     float bowLen = vibrateLen - nutLen;
@@ -190,18 +233,18 @@ void Bowed::UpdateParam() {
     auto tremoloMode = SynthParams.bow.tremoloControl.Get();
     if (tremoloMode == 0) {
         // use auto tremolo
-        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
         }
         float sin = std::sin(tremoloOscPhase_ * std::numbers::pi_v<float> * 2.0f);
         tremoloAmount_ = sin;
-        tremoloAmount_ *= tremoloDelay_.Process(1);
+        tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
         tremoloAmount_ *= SynthParams.bow.tremoloDepth.Get();
     }
     else if (tremoloMode == 1) {
-        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
@@ -209,7 +252,7 @@ void Bowed::UpdateParam() {
         float sin = std::sin(tremoloOscPhase_ * std::numbers::pi_v<float> * 2.0f);
         tremoloAmount_ = sin;
         tremoloAmount_ *= SynthParams.bow.tremoloDepth.Get() * MidiManager.GetPressure(channel_);
-        tremoloAmount_ *= tremoloDelay_.Process(1);
+        tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
     }
     else {
         // use pressure
@@ -7,17 +7,40 @@
 #include "Lowpass.hpp"
 #include "TuningFilter.hpp"
 #include "ExpSmoother2.hpp"
-#include "Noise.hpp"
+#include "BlockNoise.hpp"
 #include "ExpSmoother.hpp"
 
 namespace dsp {
 
 class Bowed {
 public:
+    // 每个音符预先算好的环路数据, 见 CTuning
+    struct Pitch {
+        // 一个周期的采样数
+        float totalLoopLen;
+        float loopLen;
+        // 弯音到最大时环路长度的减少量
+        float bendDelta;
+        float lossCutoff;
+        float decayGain;
+    };
+
+    // NoteOn需要的所有计算, 在产生事件的任务中完成, 见 NotePlan
+    struct Plan {
+        Pitch pitch;
+        Lowpass lossLP;
+        float sustain;
+        uint8_t note;
+    };
+
+    static void BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate);
+    static void PlanNote(Plan& plan, uint8_t note, float velocity, float sampleRate);
+
     void  Init(float sampleRate);
-    float ProcessSingle();
+    float ProcessSingle(float noise);
     float ProcessSingleNoBow();
     void  NoteOn(uint8_t channel, uint32_t note, float velocity);
+    void  NoteOn(uint8_t channel, const Plan& plan);
     void  NoteOff();
     void  SetDelayLineRef(DelayLine* nut, DelayLine* bridge) { nutBowDelay_ = nut; bowBridgeDelay_ = bridge; }
     void  Panic();
@@ -37,6 +60,7 @@ public:
     void SetTremoloAttack(float ms) { tremoloDelay_.SetTime(ms); }
     void SetVibrateAttack(float ms) { vibrateDelay_.SetTime(ms); }
     void SetNoiseLP(float st);
+    void SetNoiseStream(uint32_t stream) { noise_.SetSeed(0, stream); }
     void SetAttack(float ms) { speedEnv_.SetAttackTime(ms); }
     void SetRelease(float ms) { speedEnv_.SetReleaseTime(ms); }
     // delay allocate
@@ -47,15 +71,17 @@ public:
     float deltaDebugValue_{};
     float waveOutputDebugValue_{};
 private:
-    void UpdateParam();
-    int32_t GetLossLP(int32_t note);
+    void UpdateParam(uint32_t numSamples);
+    template<bool kAdd>
+    void ProcessBow(std::span<float> buffer);
+    static int32_t GetLossLP(int32_t note);
 
     uint8_t channel_{};
     DelayLine* nutBowDelay_;
     DelayLine* bowBridgeDelay_;
     Lowpass lossLP_;
     TunningFilter tunningFilter_;
-    Noise noise_;
+    BlockNoise noise_;
     OnePoleFilter noiseLP_;
     ExpSmoother speedEnv_;
     float sampleRate_{};
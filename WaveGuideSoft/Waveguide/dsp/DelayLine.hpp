@@ -15,6 +15,8 @@ public:
     void Push(float in);
     void ClearInternal();
     float GetLast();
+    // 按指定的延迟读, 不改变 SetDelay 设置的延迟
+    float Read(int32_t delay) const { return buffer_[(writePos_ - delay) & kMask]; }
     void SetDelay(int32_t delay);
     void SetDelayUncheck(int32_t delay);
     float GetDelay() const { return delay_; }
@@ -0,0 +1,58 @@
+#include "ExciterBank.hpp"
+#include "BlockNoise.hpp"
+#include "MemAttributes.hpp"
+#include <cmath>
+#include <algorithm>
+
+MEM_BSS_SRAMD1 static dsp::ExciterBank::Table tables[dsp::ExciterBank::kNumTypes][dsp::ExciterBank::kNumCutoffs];
+
+namespace dsp {
+
+static int16_t Quantize(float x) {
+    float v = std::round(x / ExciterBank::kScale);
+    return static_cast<int16_t>(std::clamp(v, -32768.0f, 32767.0f));
+}
+
+// in(t)给出激励, 只经过 Lowpass, 直流阻断在 ExciterPlayer 中
+template<class Input>
+static void Render(int16_t* out, Lowpass::LoopFilterType type, float sampleRate, float cutoff, Input in) {
+    Lowpass filter;
+    filter.Init(sampleRate);
+    filter.SetLoopFilterType(type);
+    filter.SetCutOffFreq(cutoff);
+    for (uint32_t t = 0; t < ExciterBank::kTableLen; ++t) {
+        out[t] = Quantize(filter.Process(in(t)));
+    }
+}
+
+void ExciterBank::Init(float sampleRate) {
+    const float refFreq = sampleRate / kRefPeriod;
+    for (uint32_t type = 0; type < kNumTypes; ++type) {
+        auto filterType = static_cast<Lowpass::LoopFilterType>(type);
+        for (uint32_t k = 0; k < kNumCutoffs; ++k) {
+            auto& table = tables[type][k];
+            float cutoff = refFreq * std::exp2(k * 0.5f);
+            Render(table.step, filterType, sampleRate, cutoff, [](uint32_t) { return 1.0f; });
+            for (uint32_t v = 0; v < kNumVariants; ++v) {
+                BlockNoise noise;
+                noise.SetSeed(v);
+                float buffer[kRefPeriod];
+                noise.Fill(buffer);
+                Render(table.noise[v], filterType, sampleRate, cutoff, [&buffer](uint32_t t) {
+                    return t < kRefPeriod ? buffer[t] : 0.0f;
+                });
+            }
+        }
+    }
+}
+
+const ExciterBank::Table& ExciterBank::GetTable(Lowpass::LoopFilterType type, float cutoffRatio, float maxRatio) {
+    float k = std::round(2.0f * std::log2(std::max(cutoffRatio, 1.0f)));
+    // 表按比例抽取时没有抗混叠, 截止频率高于奈奎斯特频率的部分会混叠
+    // 加一点余量, 避免 log2(sqrt(2)) 这类刚好在边界上的比例被舍到下一档
+    float maxK = std::floor(2.0f * std::log2(std::max(maxRatio, 1.0f)) + 1e-3f);
+    auto idx = static_cast<uint32_t>(std::min({ k, maxK, kNumCutoffs - 1.0f }));
+    return tables[static_cast<uint32_t>(type)][idx];
+}
+
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include <cstdint>
+#include <algorithm>
+#include <cmath>
+#include "Lowpass.hpp"
+#include "DCBlocker.hpp"
+
+namespace dsp {
+
+/**
+ * @brief 预先渲染的拨弦激励
+ * 激励 = DCBlocker(Lowpass(Lerp(dc脉冲, 噪声, color))), 全部是线性的, 可以拆成叠加:
+ *   dc    = 0.5 * S(t) - S(t - P) + 0.5 * S(t - L)   S是阶跃响应
+ *   noise = G(t) - G(t - P)                          G是长度为L的噪声的响应
+ * 表在一个参考周期上渲染, 按音高拉伸播放, 截止频率以谐波次数(fc / f0)分组
+ * 表只和滤波器类型有关, 两种类型在Init时全部渲染, 拨弦位置和color在播放时叠加
+ * 直流阻断的截止频率是绝对的, 不能随音高拉伸, 在 ExciterPlayer 读表之后处理
+ */
+struct ExciterBank {
+    static constexpr uint32_t kRefPeriod = 192;
+    // 激励最长2个周期, 再留一个周期给滤波器的尾巴
+    static constexpr uint32_t kTableLen = kRefPeriod * 3;
+    // 谐波次数 2^(k/2), 1 ~ 64
+    static constexpr uint32_t kNumCutoffs = 13;
+    // 两个独立的噪声, 每个音符按随机的角度混合, 频谱和能量不变
+    static constexpr uint32_t kNumVariants = 2;
+    static constexpr uint32_t kNumTypes = 2;
+    static constexpr float kScale = 4.0f / 32768.0f;
+
+    struct Table {
+        int16_t step[kTableLen];
+        int16_t noise[kNumVariants][kTableLen];
+    };
+
+    static void Init(float sampleRate);
+    /**
+     * @param cutoffRatio 激励截止频率 / 基频
+     * @param maxRatio 一个周期能容纳的谐波次数, 约为周期的一半, 拉伸播放时截止频率不超过奈奎斯特频率
+     */
+    static const Table& GetTable(Lowpass::LoopFilterType type, float cutoffRatio, float maxRatio);
+
+    // x < 0 时为0, x必须小于 kTableLen - 1
+    static float Read(const int16_t* table, float x) {
+        if (x < 0.0f) return 0.0f;
+        auto i = static_cast<uint32_t>(x);
+        float frac = x - i;
+        float a = table[i];
+        float b = table[i + 1];
+        return (a + frac * (b - a)) * kScale;
+    }
+};
+
+/**
+ * @brief 按环路长度拉伸播放 ExciterBank 的表, 时间以参考周期为单位
+ */
+class ExciterPlayer {
+public:
+    // 表读完后直流阻断的尾巴低于这个值时停止
+    static constexpr float kSilence = 1e-6f;
+
+    /**
+     * @param period 环路长度, 采样
+     * @param noiseMix 两个噪声的混合比例, 平方和为1
+     */
+    void Start(const ExciterBank::Table& table, float period, float pluckPosition,
+               float dcGain, float noiseGain, const float (&noiseMix)[ExciterBank::kNumVariants]) {
+        table_ = &table;
+        phase_ = 0.0f;
+        step_ = ExciterBank::kRefPeriod / period;
+        pos_ = ExciterBank::kRefPeriod * pluckPosition;
+        dcGain_ = dcGain;
+        for (uint32_t v = 0; v < ExciterBank::kNumVariants; ++v) {
+            noiseGain_[v] = noiseGain * noiseMix[v];
+        }
+        dcBlocker_.ClearInternal();
+        active_ = true;
+    }
+    bool IsActive() const { return active_; }
+
+    float Process() {
+        float in = 0.0f;
+        if (phase_ < kEnd) {
+            const float t = phase_;
+            const int16_t* step = table_->step;
+            float dc = 0.5f * ExciterBank::Read(step, t)
+                     - ExciterBank::Read(step, t - pos_)
+                     + 0.5f * ExciterBank::Read(step, t - ExciterBank::kRefPeriod);
+            in = dc * dcGain_;
+            for (uint32_t v = 0; v < ExciterBank::kNumVariants; ++v) {
+                const int16_t* noise = table_->noise[v];
+                in += (ExciterBank::Read(noise, t) - ExciterBank::Read(noise, t - pos_)) * noiseGain_[v];
+            }
+            phase_ += step_;
+        }
+        float out = dcBlocker_.Process(in);
+        if (phase_ >= kEnd && std::abs(out) < kSilence) {
+            active_ = false;
+        }
+        return out;
+    }
+private:
+    static constexpr float kEnd = ExciterBank::kTableLen - 1;
+
+    const ExciterBank::Table* table_{};
+    float phase_{};
+    float step_{};
+    float pos_{};
+    float dcGain_{};
+    float noiseGain_[ExciterBank::kNumVariants]{};
+    DCBlocker995 dcBlocker_;
+    bool active_{};
+};
+
+/**
+ * @brief commuted synthesis用的激励, 琴体IR已经卷积在里面, 由Body在换琴体/拉伸时生成
+ * 琴体的时间不能随音高拉伸, 所以这里是绝对时间, 不经过激励滤波器, 频谱由琴体决定
+ */
+struct CommutedExciter {
+    static constexpr uint32_t kMaxLen = 4096;
+    // 噪声激励的长度, 固定的拨弦接触噪声, 不像激励表那样是一个周期
+    static constexpr uint32_t kBurstLen = 64;
+
+    // 琴体IR的累加, 即琴体的阶跃响应, 超出len后保持最后的值
+    float step[kMaxLen];
+    // 噪声burst经过琴体
+    float noise[kMaxLen + kBurstLen];
+    uint32_t len;
+
+    float ReadStep(int32_t t) const {
+        if (t < 0) return 0.0f;
+        return step[std::min<uint32_t>(t, len - 1)];
+    }
+    float ReadNoise(int32_t t) const {
+        if (t < 0 || static_cast<uint32_t>(t) >= len + kBurstLen) return 0.0f;
+        return noise[t];
+    }
+};
+
+}
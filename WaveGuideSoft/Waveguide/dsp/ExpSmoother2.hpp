@@ -1,5 +1,6 @@
 #pragma once
 #include <cmath>
+#include <cstdint>
 
 namespace dsp{
 
@@ -19,6 +20,12 @@ public:
         return latch_;
     }
 
+    // 一次前进numSamples个采样, 结果与调用numSamples次Process相同
+    float Process(float in, uint32_t numSamples) {
+        latch_ = in + (latch_ - in) * std::pow(a_, static_cast<float>(numSamples));
+        return latch_;
+    }
+
     void SetTime(float ms) {
         ms_ = ms;
         a_ = std::exp(-1.0f / (sampleRate_ * ms / 1000.0f));
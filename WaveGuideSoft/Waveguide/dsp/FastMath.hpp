@@ -0,0 +1,73 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <numbers>
+
+namespace dsp::fastmath {
+
+// 计算滤波器/衰减系数用的近似函数, 代替音频任务里的 std::pow(10, x)/tan
+// 只有乘加和select, 没有分支和查表, 可以在编译期使用
+// 误差是 pctest/src/tools/FastMathBench 在各个调用处的输入范围上和libm对比得到的最大值
+// 只在比libm快的调用处使用; exp2/exp/sin 和很小角度的tan在 FastMathBench 上没有更快, 仍然用libm
+
+namespace detail {
+
+// 四舍五入到整数, |x| < 2^22
+constexpr float Round(float x) {
+    return static_cast<float>(static_cast<int32_t>(x + (x < 0.0f ? -0.5f : 0.5f)));
+}
+
+// [-pi/4, pi/4] 上的 sin/cos, 相对误差 < 4e-9 / 4e-8
+constexpr float SinQuarter(float x) {
+    const float x2 = x * x;
+    return x * (0.999999998f + x2 * (-0.16666653f + x2 * (0.00833211459f + x2 * -0.000195113949f)));
+}
+
+constexpr float CosQuarter(float x) {
+    const float x2 = x * x;
+    return 0.999999984f + x2 * (-0.499998685f + x2 * (0.0416553221f + x2 * -0.00135880443f));
+}
+
+}
+
+/**
+ * @brief 2^x, 相对误差 < 2e-7
+ * x 超出 [-126, 127] 时饱和, 结果总是正规数
+ */
+constexpr float Exp2(float x) {
+    x = x < -126.0f ? -126.0f : x;
+    x = x > 127.0f ? 127.0f : x;
+    // 加上偏移后为正数, 截断就是四舍五入
+    const int32_t i = static_cast<int32_t>(x + 126.5f) - 126;
+    const float f = x - static_cast<float>(i);
+    // [-1/2, 1/2] 上的 2^f - 1, 常数项固定为1, x接近0时 1 - 2^x 也是准确的
+    const float p = f * (0.693147207f + f * (0.240226511f + f * (0.0555032721f
+                  + f * (0.00961803596f + f * (0.00134004322f + f * 0.00015467365f)))));
+    return (1.0f + p) * std::bit_cast<float>(static_cast<uint32_t>(i + 127) << 23);
+}
+
+// 10^x, 相对误差 < 2e-7 + |x| * 2e-7
+constexpr float Pow10(float x) {
+    return Exp2(x * 3.32192809f);
+}
+
+/**
+ * @brief tan(x), |x| < 2^21
+ * 先按pi归到 [-pi/2, pi/2], 再用 tan(x) = 1 / tan(pi/2 - x) 归到 [0, pi/4]
+ * [0, 1.45] 上相对误差 < 5e-7, 离极点0.1以外 < 2e-6
+ */
+constexpr float Tan(float x) {
+    constexpr float kPi = std::numbers::pi_v<float>;
+    // pi 拆成两部分, 第一部分和n的乘积是精确的
+    const float n = detail::Round(x * std::numbers::inv_pi_v<float>);
+    x = (x - n * 3.140625f) - n * 9.67653589793e-4f;
+    const float a = x < 0.0f ? -x : x;
+    const bool big = a > 0.25f * kPi;
+    const float r = big ? 0.5f * kPi - a : a;
+    const float s = detail::SinQuarter(r);
+    const float c = detail::CosQuarter(r);
+    const float t = big ? c / s : s / c;
+    return x < 0.0f ? -t : t;
+}
+
+}
@@ -2,6 +2,7 @@
 #include <cmath>
 #include <numbers>
 #include <complex>
+#include "FastMath.hpp"
 
 namespace dsp {
 
@@ -11,6 +12,14 @@ void Lowpass::Init(float sampleRate) {
 }
 
 float Lowpass::Process(float x) {
+    if (loopFilterType_ == LoopFilterType::IIR_LPF1) {
+        // b1 == b0, a2 == b2 == 0
+        auto t = x - a1_ * latch1_;
+        auto y = (t + latch1_) * b0_;
+        latch1_ = t;
+        return y;
+    }
+
     auto t = x - a1_ * latch1_ - a2_ * latch2_;
     auto y = t * b0_ + b1_ * latch1_ + b2_ * latch2_;
     latch2_ = latch1_;
@@ -50,7 +59,7 @@ float Lowpass::GetMaxFreq() const {
 
 void Lowpass::SetLPF1(float freq) {
     float omega = 2 * std::numbers::pi_v<float> * freq / sampleRate_;
-    auto k = std::tan(omega / 2);
+    auto k = fastmath::Tan(omega / 2);
     b0_ = k / (1 + k);
     b1_ = b0_;
     b2_ = 0;
@@ -66,7 +75,7 @@ void Lowpass::SetLPF1(float freq) {
 
 void Lowpass::SetLPF2(float freq) {
     auto omega = 2.0f * std::numbers::pi_v<float> * freq / sampleRate_;
-    auto k = std::tan(omega / 2);
+    auto k = fastmath::Tan(omega / 2);
     constexpr auto Q = 1.0f / std::numbers::sqrt2_v<float>;
     auto down = k * k * Q + k + Q;
     b0_ = k * k * Q / down;
@@ -139,6 +148,8 @@ void Lowpass::Panic() {
 void Lowpass::SetLoopFilterType(LoopFilterType type) {
     if (loopFilterType_ != type) {
         loopFilterType_ = type;
+        // 一阶不更新latch2
+        latch2_ = latch1_;
         SetCutOffFreq(freq_);
     }
 }
@@ -152,6 +163,10 @@ float Lowpass::GetMagPowerResponce(float omega) const {
 }
 
 void Lowpass::CopyCoeff(const Lowpass& other) {
+    if (loopFilterType_ != other.loopFilterType_) {
+        // 同 SetLoopFilterType
+        latch2_ = latch1_;
+    }
     loopFilterType_ = other.loopFilterType_;
     freq_ = other.freq_;
     a1_ = other.a1_;
@@ -0,0 +1,127 @@
+#include "ModalBody.hpp"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numbers>
+
+namespace dsp {
+
+// 拉伸后超过这个频率的模态直接丢掉
+static constexpr float kMaxOmega = 0.95f * std::numbers::pi_v<float>;
+static constexpr uint32_t kChunkSize = 64;
+
+void ModalBody::Reset() {
+    std::fill(std::begin(s1_), std::end(s1_), 0.0f);
+    std::fill(std::begin(s2_), std::end(s2_), 0.0f);
+}
+
+void ModalBody::SetModes(const ModalBodyData& data, float stretch) {
+    numFitted_ = data.numModes;
+    // 第k个模态的冲激响应 Re(amp[k] * pole[k]^n), amp = a - jb, pole = r * e^(jw)
+    std::complex<double> amp[kMaxModes];
+    std::complex<double> pole[kMaxModes];
+    uint32_t numUsed = 0;
+    for (uint32_t k = 0; k < kMaxModes; ++k) {
+        float omega = data.omega[k] / stretch;
+        if (k >= data.numModes || omega > kMaxOmega) {
+            c1_[k] = 0.0f;
+            c2_[k] = 0.0f;
+            b0_[k] = 0.0f;
+            b1_[k] = 0.0f;
+            continue;
+        }
+        float r = std::pow(data.radius[k], 1.0f / stretch);
+        float a = data.a[k];
+        float b = data.b[k];
+        float cosw = std::cos(omega);
+        float sinw = std::sin(omega);
+        c1_[k] = 2.0f * r * cosw;
+        c2_[k] = r * r;
+        // 1 / (1 - c1 z^-1 + c2 z^-2) 的冲激响应是 r^n sin((n+1)w) / sin(w), 用分子凑出 a*cos + b*sin
+        b0_[k] = a;
+        b1_[k] = r * (b * sinw - a * cosw);
+        amp[numUsed] = { a, -b };
+        pole[numUsed] = { r * cosw, r * sinw };
+        ++numUsed;
+    }
+
+    // 和 Body::DoBodyFFT 一样把拉伸后的IR能量归一化到1
+    // 拟合有残差, 模态之间也不正交, 按解析式算所有模态之和的能量:
+    // sum_n Re(x^n A) Re(y^n B) = Re(A * B / (1 - x * y) + A * conj(B) / (1 - x * conj(y))) / 2, 对k和l对称
+    // 极点很靠近单位圆, float算 1 - x * y 误差太大
+    double energy = 0.0;
+    for (uint32_t k = 0; k < numUsed; ++k) {
+        for (uint32_t l = k; l < numUsed; ++l) {
+            auto same = amp[k] * amp[l] / (1.0 - pole[k] * pole[l]);
+            auto cross = amp[k] * std::conj(amp[l]) / (1.0 - pole[k] * std::conj(pole[l]));
+            energy += (l == k ? 0.5 : 1.0) * (same + cross).real();
+        }
+    }
+    if (energy > 0.0) {
+        const float gain = static_cast<float>(1.0 / std::sqrt(energy));
+        for (uint32_t k = 0; k < kMaxModes; ++k) {
+            b0_[k] *= gain;
+            b1_[k] *= gain;
+        }
+    }
+    UpdateNumModes();
+}
+
+void ModalBody::SetMaxModes(uint32_t num) {
+    maxModes_ = std::clamp(num, kLanes, kMaxModes);
+    UpdateNumModes();
+}
+
+void ModalBody::UpdateNumModes() {
+    uint32_t num = std::min(numFitted_, maxModes_);
+    numModes_ = (num + kLanes - 1) / kLanes * kLanes;
+    // 停用的模态清掉状态, 重新启用时不会带着旧的能量
+    for (uint32_t k = numModes_; k < kMaxModes; ++k) {
+        s1_[k] = 0.0f;
+        s2_[k] = 0.0f;
+    }
+}
+
+void ModalBody::Process(std::span<float> buffer, float gain) {
+    for (uint32_t pos = 0; pos < buffer.size(); pos += kChunkSize) {
+        const uint32_t n = std::min<uint32_t>(kChunkSize, buffer.size() - pos);
+        float* out = buffer.data() + pos;
+        float in[kChunkSize];
+        std::copy_n(out, n, in);
+        std::fill_n(out, n, 0.0f);
+
+        // 4个模态的状态和系数放在寄存器里, 整个chunk算完再换下一组
+        for (uint32_t k = 0; k < numModes_; k += kLanes) {
+            float c1[kLanes], c2[kLanes], b0[kLanes], b1[kLanes], s1[kLanes], s2[kLanes];
+            for (uint32_t l = 0; l < kLanes; ++l) {
+                c1[l] = c1_[k + l];
+                c2[l] = c2_[k + l];
+                b0[l] = b0_[k + l];
+                b1[l] = b1_[k + l];
+                s1[l] = s1_[k + l];
+                s2[l] = s2_[k + l];
+            }
+            for (uint32_t i = 0; i < n; ++i) {
+                float x = in[i];
+                float y = 0.0f;
+                for (uint32_t l = 0; l < kLanes; ++l) {
+                    float s = x + c1[l] * s1[l] - c2[l] * s2[l];
+                    y += b0[l] * s + b1[l] * s1[l];
+                    s2[l] = s1[l];
+                    s1[l] = s;
+                }
+                out[i] += y;
+            }
+            for (uint32_t l = 0; l < kLanes; ++l) {
+                s1_[k + l] = s1[l];
+                s2_[k + l] = s2[l];
+            }
+        }
+
+        for (uint32_t i = 0; i < n; ++i) {
+            out[i] *= gain;
+        }
+    }
+}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <span>
+
+namespace dsp {
+
+// 一个琴体的模态, 由 pctest/src/tools/BodyFit 拟合, 按能量从大到小排列
+// 第k个模态的冲激响应: radius^n * (a * cos(omega * n) + b * sin(omega * n))
+struct ModalBodyData {
+    static constexpr uint32_t kMaxModes = 64;
+    uint32_t numModes;
+    float omega[kMaxModes];
+    float radius[kMaxModes];
+    float a[kMaxModes];
+    float b[kMaxModes];
+};
+
+/**
+ * @brief 并联二阶谐振器组成的琴体, 没有FFT分块带来的延迟
+ * 每个模态: s[n] = x[n] + c1 * s[n-1] - c2 * s[n-2], y += b0 * s[n] + b1 * s[n-1]
+ * 系数按SoA存放, 4个模态一组在一次遍历中处理
+ */
+class ModalBody {
+public:
+    static constexpr uint32_t kMaxModes = ModalBodyData::kMaxModes;
+    static constexpr uint32_t kLanes = 4;
+
+    void Reset();
+    /**
+     * @param stretch 与 Body::SetStretch 相同, 大于1时频率降低, 衰减变慢
+     */
+    void SetModes(const ModalBodyData& data, float stretch);
+    // 只计算能量最大的num个模态, governor降级用
+    void SetMaxModes(uint32_t num);
+    void Process(std::span<float> buffer, float gain);
+private:
+    void UpdateNumModes();
+
+    alignas(16) float c1_[kMaxModes]{};
+    alignas(16) float c2_[kMaxModes]{};
+    alignas(16) float b0_[kMaxModes]{};
+    alignas(16) float b1_[kMaxModes]{};
+    alignas(16) float s1_[kMaxModes]{};
+    alignas(16) float s2_[kMaxModes]{};
+    uint32_t numFitted_{};
+    uint32_t maxModes_{ kMaxModes };
+    // kLanes的整数倍, 多出来的模态系数为0
+    uint32_t numModes_{};
+};
+
+}
@@ -0,0 +1,406 @@
+#pragma once
+// 由 pctest/src/tools/BodyFit 从 BodyIR.cpp 的IR生成, 不要手动修改
+#include "ModalBody.hpp"
+
+namespace dsp {
+
+inline constexpr ModalBodyData kModalBodies[] {
+    // kBanjo, residual -12 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.0803922638f, 0.0745959133f, 0.0925649479f, 0.120410539f, 0.0652881712f, 0.122415125f, 0.126690999f, 0.0547468774f,
+            0.0864380524f, 0.0900758728f, 0.138805702f, 0.101485848f, 0.711247504f, 0.696518481f, 0.71521759f, 0.0444217958f,
+            0.20397906f, 0.635821402f, 1.12371051f, 1.11560118f, 0.733065307f, 0.388422102f, 0.412142456f, 2.10625911f,
+            0.503100574f, 0.7736606f, 0.555356324f, 0.352327138f, 0.578680813f, 1.92616832f, 0.607773244f, 2.17068005f,
+            0.286118656f, 0.369300961f, 2.17590642f, 0.84982425f, 0.671362638f, 1.26652873f, 0.989632607f, 2.73549676f,
+            0.688198149f, 2.63016415f, 0.480504125f, 0.932255805f, 1.03463089f, 0.58810544f, 2.32754135f, 1.31389117f,
+            2.58490062f, 0.955743849f, 0.520408094f, 1.84732437f, 0.652859032f, 1.79438961f, 2.31642532f, 1.50337529f,
+            1.13186765f, 2.03917456f, 0.512914717f, 2.24117732f, 1.38047194f, 2.41293383f, 0.377044022f, 1.37252486f,
+        },
+        .radius {
+            0.975755036f, 0.975942194f, 0.97781533f, 0.984777272f, 0.980631769f, 0.98553288f, 0.985343874f, 0.985343874f,
+            0.991978943f, 0.992169142f, 0.983833551f, 0.994454741f, 0.988371551f, 0.988182008f, 0.993882835f, 0.994454741f,
+            0.983267784f, 0.985721827f, 0.986667335f, 0.984777272f, 0.9952178f, 0.996172369f, 0.994836211f, 0.985154986f,
+            0.993882835f, 0.991218388f, 0.993311286f, 0.993501782f, 0.996936738f, 0.990648389f, 0.996363401f, 0.996363401f,
+            0.985343874f, 0.996172369f, 0.996745586f, 0.996936738f, 0.996172369f, 0.994836211f, 0.994645476f, 0.992359459f,
+            0.997319162f, 0.9952178f, 0.996172369f, 0.996936738f, 0.995790422f, 0.995981395f, 0.994645476f, 0.995599508f,
+            0.996745586f, 0.997701645f, 0.997319162f, 0.996554494f, 0.997127891f, 0.996363401f, 0.997892976f, 0.996554494f,
+            0.994454741f, 0.995408654f, 0.998084366f, 0.997319162f, 0.9952178f, 0.997701645f, 0.996745586f, 0.997127891f,
+        },
+        .a {
+            4.68651342f, 14.8563986f, -12.0744581f, -6.98939943f, -6.68411827f, 5.30791473f, 1.53178549f, 0.0321299024f,
+            -0.669012189f, -0.275330961f, 0.55441308f, 0.00909310114f, -0.107544892f, 0.0455092303f, 0.00912423432f, 0.0402170233f,
+            0.00904903933f, 0.0264292546f, -0.0352287032f, 0.0336969495f, -0.00605033198f, -0.0143144317f, -0.0103837606f, 0.0281010717f,
+            0.0122554069f, -0.0199710242f, 0.00646087062f, -0.000685887528f, 0.0115343397f, 0.0187723115f, 0.00489693414f, 0.0111979041f,
+            -0.00234019337f, 0.00547741354f, -0.00101436337f, -0.00279278844f, 0.00364589342f, 0.00717909401f, -0.00206191838f, 0.00725774234f,
+            0.00625008065f, 0.0087951161f, 0.00723656081f, -0.00281622121f, 0.00387020269f, 0.00556229986f, 0.0054953387f, -0.00327434833f,
+            0.00563689927f, 0.00133100199f, -0.00360243837f, 0.00519239996f, 0.00463850982f, 0.00491012959f, 0.00348271662f, 0.00119560573f,
+            0.00185743091f, 0.0041215173f, -0.00140281429f, 0.0036711311f, -0.00184946868f, 0.00312450831f, -1.22509582e-05f, -0.00220363215f,
+        },
+        .b {
+            -61.6510849f, 50.7670784f, 11.9147224f, 0.14210771f, -4.06365061f, 3.92624521f, -1.25289583f, -0.990328014f,
+            -0.294478357f, 0.351495028f, -0.248370945f, 0.0957449526f, -0.0828960165f, -0.0807385445f, 0.0549317226f, -0.00178161007f,
+            0.0598594733f, -0.0470440313f, -0.0312227085f, -0.00823815074f, 0.0174629707f, -0.00648079813f, -0.0142905293f, -0.00697702402f,
+            -0.0131572904f, -0.00760431215f, -0.0166918021f, -0.017327847f, -0.000845884206f, -0.00398416771f, -0.0106723281f, 0.00215270743f,
+            -0.0218143445f, -0.00933358353f, -0.00916710123f, -0.0077105402f, -0.00830417685f, -0.00760366162f, -0.00984372571f, 0.00947567541f,
+            0.00243344228f, 0.00143115292f, -0.000189629864f, -0.00564092165f, -0.00607921928f, -0.00411511166f, -0.00566215999f, -0.00634378009f,
+            0.0021581871f, -0.00482884888f, -0.00339836814f, -0.00156936457f, -0.00163100509f, -0.00171390106f, 0.0017955954f, -0.00486350944f,
+            0.00577897066f, -0.00345978001f, -0.00308043766f, 0.000227046097f, -0.0041999165f, 0.000127825042f, -0.00342553388f, -0.00134425005f,
+        },
+    },
+    // kCalcani, residual -10 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.547110558f, 0.545935273f, 0.312559247f, 0.55137068f, 0.314491689f, 0.324956447f, 0.458019465f, 0.453304976f,
+            0.32579869f, 0.44586131f, 0.391675264f, 0.444500566f, 0.778209984f, 0.297494024f, 0.308936059f, 0.763792694f,
+            0.41770193f, 0.495560706f, 0.0581871867f, 0.45255658f, 0.334364325f, 0.657855451f, 0.379511029f, 0.621653318f,
+            0.0591797307f, 0.39035061f, 0.526660264f, 0.275257856f, 0.801484406f, 0.426114291f, 0.363936245f, 0.284842998f,
+            0.171590239f, 0.17267026f, 0.680134714f, 0.625416219f, 0.0568711124f, 0.311928719f, 0.433918506f, 0.46835357f,
+            0.246059105f, 0.175625101f, 0.746802628f, 0.257499009f, 0.0966290012f, 0.237488225f, 0.869123697f, 0.122314088f,
+            0.291461885f, 0.0650784671f, 0.520680368f, 0.288368672f, 0.466860205f, 0.0359615162f, 0.271380067f, 0.210574463f,
+            0.230605692f, 0.107520193f, 0.781913221f, 0.345497757f, 0.347471029f, 0.47505039f, 0.190313697f, 0.00294226292f,
+        },
+        .radius {
+            0.991598606f, 0.991598606f, 0.991408467f, 0.992740095f, 0.991218388f, 0.996172369f, 0.994454741f, 0.994264066f,
+            0.993120849f, 0.996363401f, 0.996172369f, 0.996363401f, 0.988940239f, 0.995981395f, 0.997892976f, 0.994454741f,
+            0.996172369f, 0.992740095f, 0.998658657f, 0.998084366f, 0.992740095f, 0.993120849f, 0.9952178f, 0.994073451f,
+            0.999041736f, 0.998850167f, 0.997319162f, 0.996172369f, 0.992359459f, 0.997319162f, 0.994264066f, 0.996363401f,
+            0.998850167f, 0.998658657f, 0.994454741f, 0.993120849f, 0.999233305f, 0.999041736f, 0.996936738f, 0.997510374f,
+            0.995599508f, 0.998850167f, 0.995408654f, 0.998275757f, 0.998275757f, 0.998275757f, 0.996172369f, 0.998467207f,
+            0.998658657f, 0.998850167f, 0.998850167f, 0.998658657f, 0.997701645f, 0.999041736f, 0.999041736f, 0.997127891f,
+            0.999041736f, 0.998467207f, 0.998850167f, 0.999041736f, 0.998850167f, 0.998467207f, 0.998467207f, 0.998275757f,
+        },
+        .a {
+            0.706657887f, -0.732266068f, 0.140781224f, 0.0253050197f, -0.182976305f, 0.121346764f, 0.0359585993f, 0.0849689618f,
+            -0.119536497f, -0.0443283208f, -0.0284744427f, -0.0117303291f, -0.0171633381f, 0.0499532968f, -0.00193341065f, -0.0324701034f,
+            0.028695548f, -0.0447805114f, 0.0183008369f, -0.0202019848f, 0.0171861555f, 0.0248571802f, 0.00183488568f, 0.0279973634f,
+            -0.0111798663f, -0.00161140284f, 0.0198407117f, -0.0200762991f, 0.032982111f, 0.00806398038f, -0.0261696521f, 0.0157360956f,
+            0.0120237069f, -0.0125211375f, -0.0247408226f, -0.0129508236f, -0.00743529992f, 0.00598326558f, -0.00713322731f, -0.0131486524f,
+            0.0057771625f, -0.00340123707f, 0.000396662101f, -0.00625664368f, -0.0062009939f, -0.00369265978f, 0.00607042946f, 0.00179337582f,
+            -0.000496499357f, -0.0062315478f, -0.00510223536f, 0.000359043712f, -0.00400821306f, -0.0038153925f, -0.00288584735f, -0.00471089361f,
+            0.00191812369f, -3.13109485e-05f, 0.0013571349f, 0.00274451124f, 0.00247735018f, -0.00160544133f, 0.00236306759f, -0.000379608449f,
+        },
+        .b {
+            0.622379899f, -0.406872839f, -0.1604601f, -0.174552307f, 0.0441611633f, -0.0260339733f, -0.144829139f, 0.102846012f,
+            0.0739075765f, 0.0799884945f, 0.0722979307f, -0.0468191169f, 0.0814538822f, 0.00363331381f, 0.0331345089f, -0.0289919488f,
+            0.0165255293f, -0.00217059744f, 0.00168379152f, 0.00728021609f, -0.034970846f, -0.0281994902f, -0.0308942515f, -0.0177308097f,
+            -0.00693441555f, -0.0142120719f, 0.00810834114f, 0.0147704622f, -0.0106721912f, -0.017998809f, -0.0117492275f, 0.0163677465f,
+            -0.0033045786f, -0.00340861687f, -0.00570657849f, 0.0248568598f, 0.00459646108f, 0.00764719071f, -0.0141405445f, 0.00346026197f,
+            -0.0162222032f, 0.0077056908f, -0.0147152916f, 0.00650685793f, 0.00598923862f, 0.00742690871f, 0.0102019701f, 0.00707324874f,
+            0.00676287105f, 0.000298181898f, -0.00148550677f, 0.0056323614f, -0.00496704737f, 0.000190163744f, 0.00229891832f, 0.00410067244f,
+            0.00297034904f, -0.00419118814f, 0.00312128011f, 0.00142896071f, -0.0016413331f, -0.00223094318f, 0.000404819293f, -0.000269195647f,
+        },
+    },
+    // kGuitar, residual -6 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.0298678298f, 0.0403831452f, 2.03331947f, 2.03478694f, 2.13886333f, 0.0162196737f, 2.13621092f, 0.775209129f,
+            1.71842206f, 2.45383334f, 1.96686625f, 2.44372582f, 1.37137449f, 0.549617469f, 2.50468135f, 1.77426052f,
+            0.38821736f, 0.47441873f, 1.62223136f, 0.757177949f, 2.27063847f, 2.1831665f, 2.31415319f, 2.70604038f,
+            2.65119553f, 2.15677691f, 1.75826681f, 2.52257085f, 2.46371818f, 2.16534686f, 1.31344938f, 2.57918668f,
+            2.51403093f, 1.35636556f, 1.82459879f, 1.66358662f, 1.49349582f, 1.38161314f, 0.689292967f, 2.48263359f,
+            1.53125119f, 1.25738657f, 0.307278991f, 0.826176405f, 2.77369356f, 2.04495239f, 2.23503542f, 0.348947704f,
+            0.187505513f, 1.96084917f, 0.524890721f, 0.992969632f, 1.5814755f, 2.63198519f, 1.74320054f, 0.424468279f,
+            0.442913204f, 1.04786098f, 0.608314037f, 2.79491305f, 2.78662753f, 1.21356499f, 0.144832224f, 0.543537378f,
+        },
+        .radius {
+            0.996172369f, 0.984777272f, 0.992169142f, 0.996554494f, 0.996936738f, 0.995599508f, 0.996554494f, 0.988182008f,
+            0.996745586f, 0.996745586f, 0.994836211f, 0.996172369f, 0.996363401f, 0.993311286f, 0.996172369f, 0.995981395f,
+            0.993311286f, 0.996554494f, 0.997127891f, 0.995790422f, 0.993692279f, 0.996554494f, 0.9952178f, 0.996363401f,
+            0.995981395f, 0.998084366f, 0.995408654f, 0.997127891f, 0.996172369f, 0.995981395f, 0.996745586f, 0.995599508f,
+            0.997892976f, 0.995790422f, 0.996554494f, 0.996745586f, 0.997319162f, 0.996745586f, 0.996936738f, 0.997127891f,
+            0.996936738f, 0.996745586f, 0.997510374f, 0.997892976f, 0.997319162f, 0.997510374f, 0.997319162f, 0.996936738f,
+            0.994645476f, 0.997701645f, 0.996172369f, 0.996554494f, 0.997127891f, 0.996936738f, 0.997510374f, 0.997127891f,
+            0.994454741f, 0.996554494f, 0.995790422f, 0.996936738f, 0.997510374f, 0.997510374f, 0.992359459f, 0.997510374f,
+        },
+        .a {
+            0.0405033529f, -0.0594013184f, -0.0320667513f, 0.01905917f, 0.0148766227f, -0.0157785974f, -0.0136651173f, 0.0373150259f,
+            0.0170460884f, -0.0183416717f, 0.0210104417f, -0.0175143369f, -0.0103223938f, -0.00242958101f, -0.0145983621f, -0.0162236597f,
+            0.0190745089f, -0.0133403875f, 0.0026432774f, -0.0134576764f, 0.0168397613f, 0.0104961051f, 0.0105505353f, 0.00157598953f,
+            0.00666022673f, -0.000274733175f, 0.00468952768f, -0.00239622267f, -0.00998650864f, -0.00237147929f, 0.00775796361f, 0.00269291992f,
+            -0.00434622774f, -0.0107265366f, 0.00549602509f, -0.00809997506f, 0.00661653047f, 0.00972583424f, -0.00950598344f, -0.00375455432f,
+            -0.00927058142f, 0.000866493327f, 0.0026346338f, 0.000711809844f, -0.00696426677f, -0.00175658218f, -0.00514674885f, 0.00183922646f,
+            0.0046844366f, -0.00195205142f, 0.00192046433f, 0.00806074962f, -0.00712870387f, -0.00439870311f, 0.00104916294f, -0.00685080746f,
+            0.0018817028f, 0.00489016902f, -0.00714744907f, 0.00214065076f, -0.00199953583f, -0.00326979998f, -0.00546737574f, -0.00117186271f,
+        },
+        .b {
+            -0.0569966473f, 0.0783840492f, -0.0571776293f, 0.0275579281f, -0.0228733309f, 0.0236666016f, 0.0207842942f, 0.0172662027f,
+            -0.0120794345f, -0.00663839094f, -0.00205807574f, -0.00264398172f, 0.0135034546f, 0.0226983614f, 0.00841930602f, -0.00427647401f,
+            -0.00220198836f, 0.00209807558f, 0.011989533f, -0.0051922719f, 0.00339753157f, -0.00687842723f, 0.00980629679f, 0.0123326946f,
+            0.0112393042f, 0.00891860481f, 0.0129186381f, 0.0103282612f, 0.00688248314f, 0.0119859371f, 0.00766365835f, 0.012165823f,
+            0.0073919422f, -0.00514867762f, 0.00917699002f, -0.00643721689f, 0.00625157729f, -0.00218199915f, 0.00168709736f, 0.00854558405f,
+            0.00159538549f, 0.00948981103f, -0.00775280921f, -0.00746911066f, 0.00469707511f, 0.00765485968f, 0.00602969807f, 0.00821013749f,
+            -0.00999496132f, 0.00693123275f, 0.00892153569f, -0.00186215783f, -0.00235528965f, 0.00594787532f, 0.0063182041f, 0.00023019973f,
+            -0.00907433499f, 0.00488477247f, 0.00259837345f, -0.00607440108f, -0.00542198913f, -0.00337470067f, 0.00225045555f, 0.00313776894f,
+        },
+    },
+    // kKlotz, residual -12 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.280331343f, 0.786628187f, 0.367620766f, 0.281416684f, 0.36619091f, 0.788144886f, 0.790053487f, 0.278063953f,
+            0.272107035f, 0.334005475f, 0.346808642f, 0.794067085f, 0.463332504f, 0.244048655f, 0.316799223f, 0.352064461f,
+            0.485424668f, 0.217577443f, 0.376924962f, 0.342997581f, 0.307624996f, 0.465069979f, 0.21964106f, 0.23035717f,
+            0.480350643f, 0.319373846f, 0.614473045f, 0.61598736f, 0.354282916f, 0.462011069f, 0.29288432f, 0.38739863f,
+            0.514509201f, 0.591428816f, 0.273867428f, 0.314907581f, 0.261079043f, 0.259835571f, 0.312883794f, 0.34903419f,
+            0.172931224f, 0.235310137f, 0.193941996f, 0.187178969f, 0.645238578f, 0.291306376f, 0.103007883f, 0.302596807f,
+            0.174004227f, 0.507221162f, 0.232957378f, 0.613353193f, 0.0708720312f, 0.746243834f, 0.130949825f, 0.452195585f,
+            0.0370378308f, 0.410195619f, 0.0616492108f, 0.438450247f, 0.469123244f, 0.128677458f, 0.393046945f, 0.115920477f,
+        },
+        .radius {
+            0.993882835f, 0.994645476f, 0.993501782f, 0.993882835f, 0.993311286f, 0.9952178f, 0.988940239f, 0.996554494f,
+            0.996363401f, 0.9952178f, 0.996172369f, 0.988371551f, 0.995599508f, 0.996363401f, 0.997892976f, 0.996363401f,
+            0.994073451f, 0.997127891f, 0.995790422f, 0.996554494f, 0.997701645f, 0.9952178f, 0.995790422f, 0.997510374f,
+            0.994264066f, 0.997319162f, 0.996745586f, 0.996172369f, 0.998658657f, 0.995599508f, 0.998658657f, 0.994454741f,
+            0.994264066f, 0.994073451f, 0.998467207f, 0.998658657f, 0.998275757f, 0.997319162f, 0.998658657f, 0.998850167f,
+            0.998467207f, 0.998467207f, 0.997510374f, 0.997892976f, 0.995026946f, 0.998850167f, 0.996936738f, 0.997319162f,
+            0.998658657f, 0.997319162f, 0.998850167f, 0.999041736f, 0.998850167f, 0.992169142f, 0.997892976f, 0.997510374f,
+            0.998850167f, 0.999041736f, 0.998850167f, 0.999041736f, 0.999041736f, 0.998467207f, 0.998658657f, 0.999233305f,
+        },
+        .a {
+            0.412283063f, 0.0436836965f, -0.205280975f, -0.213332832f, 0.14043957f, 0.0890536457f, -0.239155218f, -0.10690359f,
+            -0.0464523844f, 0.0847029164f, -0.0368972197f, 0.114127323f, -0.0476232618f, -0.0312756412f, -0.0418990143f, -0.055312112f,
+            -0.0302648675f, 0.032278873f, -0.000121389981f, 0.0454535112f, 0.0310057793f, 0.0507442467f, -0.0462656133f, -0.0291179884f,
+            0.0345090516f, 0.020318402f, 0.0187581889f, 0.021109838f, -0.0164284594f, -0.0181793515f, -0.00670712395f, 0.0264844932f,
+            0.0251484476f, -0.00633491902f, 0.0128352791f, 0.012639665f, 0.00629345374f, -0.0171946995f, 0.011925187f, -0.00705346279f,
+            -0.000714501482f, -0.00950361695f, -0.0114372429f, 0.00660286145f, 0.00659619085f, 0.00772133749f, -0.0120383594f, 0.00246605137f,
+            0.00220911414f, -0.00586562045f, -0.00424643466f, -0.00507234829f, -0.0045795464f, 0.0102445362f, -0.000629604794f, -0.00594465621f,
+            -0.00433544442f, 0.00375238573f, -0.00383911794f, -0.000942270504f, -0.00264045713f, -0.00284551061f, -0.00114330987f, 0.000839751912f,
+        },
+        .b {
+            -0.124483287f, 0.229550555f, 0.143242002f, 0.109936602f, -0.164640054f, -0.14978157f, -0.0418937542f, 0.0406325012f,
+            0.065344438f, -0.0307980794f, -0.0648547336f, -0.0567949824f, 0.057288304f, 0.0500327498f, 0.0122268954f, 0.0112372423f,
+            0.0633245558f, -0.0355949663f, 0.0544174314f, -0.0144859524f, 0.0200063027f, -0.0108743943f, 0.0129968002f, -0.0220743623f,
+            -0.0430504978f, -0.0217922237f, 0.0250171553f, -0.0211823657f, 0.000971120491f, -0.0231256746f, -0.0143997464f, 0.0102349101f,
+            0.013857563f, 0.0282964204f, -0.00638434337f, 0.00211530644f, 0.0124070616f, -0.00195680209f, -0.000632435782f, -0.00730951317f,
+            0.0106433714f, 0.00196273834f, -0.00389317237f, -0.00844728667f, -0.0149884196f, 2.89347608e-05f, -9.69941611e-05f, 0.010817566f,
+            -0.00712732133f, -0.00796884671f, 0.00416405778f, -0.00029492905f, -0.00312133832f, 0.00895266514f, 0.00641135359f, -0.00281731156f,
+            -0.00100743445f, -0.00154779968f, -0.00171036914f, -0.00280626025f, -0.00104404625f, 0.000659030455f, 0.0023547716f, 0.000846421754f,
+        },
+    },
+    // kLanghof, residual -11 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.199323937f, 0.298101336f, 0.197817042f, 0.305411398f, 0.63198632f, 0.202970013f, 0.621077895f, 0.313041776f,
+            0.522656798f, 0.809108257f, 0.811020911f, 0.314356118f, 0.652526379f, 0.4014346f, 0.439064026f, 0.523396075f,
+            0.521172643f, 0.544998884f, 0.349010766f, 0.476776719f, 0.288751572f, 0.426627815f, 0.507317305f, 0.291806549f,
+            0.362870663f, 0.649450421f, 0.11495965f, 0.315541565f, 0.327803195f, 0.590577185f, 0.468708843f, 0.350760818f,
+            0.102464303f, 0.380236119f, 0.24164252f, 0.279223979f, 0.569072843f, 0.342912734f, 0.34767589f, 0.0702116638f,
+            0.255579025f, 0.0543360859f, 0.104096398f, 0.225208044f, 0.239707589f, 0.467284769f, 0.0787226632f, 0.0506949313f,
+            0.0520771742f, 0.172352701f, 0.116777398f, 0.527369738f, 0.0361350849f, 0.07721553f, 0.60905987f, 0.326340497f,
+            0.452236742f, 0.409606606f, 0.168365046f, 0.193770468f, 0.271492422f, 0.159517467f, 0.783067882f, 0.353454798f,
+        },
+        .radius {
+            0.9952178f, 0.992359459f, 0.9952178f, 0.991408467f, 0.990458429f, 0.994836211f, 0.986667335f, 0.997892976f,
+            0.998658657f, 0.992359459f, 0.992549717f, 0.998850167f, 0.994645476f, 0.994836211f, 0.995599508f, 0.998658657f,
+            0.998850167f, 0.990648389f, 0.997701645f, 0.996363401f, 0.998084366f, 0.992930472f, 0.995599508f, 0.998850167f,
+            0.995408654f, 0.997892976f, 0.998658657f, 0.998658657f, 0.998658657f, 0.995790422f, 0.998275757f, 0.997892976f,
+            0.998850167f, 0.994454741f, 0.997127891f, 0.997701645f, 0.994836211f, 0.999041736f, 0.999041736f, 0.998658657f,
+            0.996936738f, 0.999041736f, 0.998850167f, 0.997510374f, 0.997319162f, 0.998850167f, 0.999041736f, 0.999233305f,
+            0.998850167f, 0.999041736f, 0.999041736f, 0.998658657f, 0.999041736f, 0.999041736f, 0.999041736f, 0.998850167f,
+            0.996745586f, 0.999041736f, 0.997510374f, 0.998850167f, 0.997892976f, 0.998658657f, 0.998850167f, 0.999041736f,
+        },
+        .a {
+            -0.195499584f, 0.21945262f, 0.147770911f, -0.163551614f, -0.113589831f, 0.0380229726f, 0.127063304f, 0.0414697118f,
+            0.0150897428f, 0.0601534806f, -0.0546487346f, 0.00331112905f, 0.0295034796f, -0.0438642204f, 0.00254477235f, 0.0129168499f,
+            -0.0181924272f, -0.026922496f, -0.0120656397f, 0.022403108f, -0.0113664437f, -0.0392721631f, 0.00918048806f, -0.0148130646f,
+            -0.00941735227f, -0.0156264361f, 0.00429595076f, -0.0114062866f, 0.00792161375f, -0.0234973934f, 0.0146842645f, 0.00044948631f,
+            -0.00972980447f, 0.0237098038f, -0.00515032373f, -0.0106999166f, -0.00245309598f, 0.00760715269f, 0.00734929368f, -0.00829276722f,
+            0.0101615209f, -0.00623580394f, -0.00576782972f, 0.00619182922f, 0.00209261919f, -0.00288358959f, 0.00555706071f, 0.0011586597f,
+            0.00383170461f, 0.00194698689f, 0.00416262355f, 0.00493095908f, -0.00447055604f, -0.00104074506f, -0.00417198101f, -0.000391183567f,
+            -0.00754576316f, -0.00295634614f, -0.00567522505f, 2.03105465e-05f, -0.0011043722f, 0.00105110952f, -0.0018724812f, 0.000368959183f,
+        },
+        .b {
+            -0.123666823f, 0.128227323f, 0.0495099053f, -0.123259872f, -0.0784800202f, 0.0802612603f, 0.0591953322f, 0.0317812525f,
+            0.0369514525f, 0.0609501414f, -0.0593836904f, -0.0304071289f, 0.0498330109f, -0.0315140709f, 0.043830663f, -0.0194625221f,
+            0.00300593977f, -0.0449617691f, -0.0216325819f, 0.0197552815f, -0.0182279609f, 0.00636894675f, -0.0294226389f, 0.00233878545f,
+            -0.0260428973f, -0.0100499727f, 0.0141396038f, -0.0092701111f, -0.0123580433f, -0.00158382999f, -0.000865636568f, 0.0160952751f,
+            -0.00657334831f, -0.009739195f, 0.0147987064f, 0.0067844633f, 0.0187294614f, 0.00267319917f, 0.00273841619f, -0.00349047175f,
+            0.0064710197f, 0.00156752672f, 0.0040372354f, 0.00765434001f, -0.00975139998f, 0.00578628434f, -0.00123138202f, 0.00485057803f,
+            -0.0045761615f, 0.00480146008f, -0.00225651939f, -0.00229001022f, -0.000342652667f, 0.0042599868f, -0.000572902441f, 0.0045532505f,
+            0.00050240627f, -0.00259228563f, -0.00199176744f, 0.00383683108f, 0.00345202792f, 0.00263266428f, -2.48223623e-05f, -0.000912205549f,
+        },
+    },
+    // kBanjo2, residual -23 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.0672617853f, 0.0648918301f, 0.0832153708f, 0.0788852945f, 0.0703354329f, 0.144906849f, 0.0885278881f, 0.144127578f,
+            0.0866379067f, 0.0875159726f, 0.148153692f, 0.135225415f, 0.0739074349f, 0.0549933575f, 0.0913104862f, 0.136210024f,
+            0.0816720724f, 0.185778528f, 0.188941315f, 0.138127014f, 0.06581375f, 0.155709162f, 0.154704809f, 0.112159781f,
+            0.0252446253f, 0.231514543f, 0.0978583246f, 0.113135368f, 0.182822168f, 0.0259654149f, 0.117094517f, 0.238026783f,
+            0.258801877f, 0.0529160462f, 0.32340768f, 0.223501101f, 0.225203529f, 0.179135755f, 0.255307764f, 0.256942004f,
+            0.0446714088f, 0.167669147f, 0.475071758f, 0.210949183f, 0.261784792f, 0.00658607297f, 0.477054894f, 0.324682981f,
+            0.29762578f, 0.26578638f, 0.206970558f, 0.293901145f, 0.253326535f, 0.273489445f, 0.487802893f, 0.304514378f,
+            0.0478294566f, 0.386697143f, 0.31139043f, 0.463234693f, 0.33090806f, 0.498919547f, 0.38000375f, 0.451457292f,
+        },
+        .radius {
+            0.990458429f, 0.987992585f, 0.990458429f, 0.992549717f, 0.993120849f, 0.991978943f, 0.996363401f, 0.995408654f,
+            0.997892976f, 0.998275757f, 0.995026946f, 0.992169142f, 0.996172369f, 0.996745586f, 0.996363401f, 0.997319162f,
+            0.997892976f, 0.995981395f, 0.997127891f, 0.998084366f, 0.998658657f, 0.998275757f, 0.998084366f, 0.998658657f,
+            0.998850167f, 0.993882835f, 0.996363401f, 0.995408654f, 0.996936738f, 0.998275757f, 0.997319162f, 0.998275757f,
+            0.998658657f, 0.998850167f, 0.996554494f, 0.997127891f, 0.994454741f, 0.996554494f, 0.999041736f, 0.998850167f,
+            0.997701645f, 0.998467207f, 0.997510374f, 0.997127891f, 0.997892976f, 0.995790422f, 0.997701645f, 0.998658657f,
+            0.998084366f, 0.998467207f, 0.998467207f, 0.998084366f, 0.997319162f, 0.999041736f, 0.998084366f, 0.998467207f,
+            0.998850167f, 0.996936738f, 0.998275757f, 0.998084366f, 0.998850167f, 0.998084366f, 0.998084366f, 0.997510374f,
+        },
+        .a {
+            -3.22513008f, 1.34551716f, 0.76862067f, 0.600066185f, 0.656402946f, -0.748854935f, -0.146152288f, 0.333756804f,
+            0.00979724992f, -0.140756533f, 0.187532231f, 0.208916932f, 0.0897857994f, -0.0780616626f, 0.0787508935f, 0.0529006459f,
+            0.0171756558f, -0.0300195366f, 0.00711346464f, 0.00217396044f, 0.0129517158f, 0.00852126814f, -0.000419174437f, -0.00454939902f,
+            -0.01119613f, -0.00989311095f, -0.00163173093f, 0.00319211977f, 0.0132238576f, 0.00940986443f, -0.00983971078f, 0.00819250289f,
+            -0.00508591859f, -0.00578412088f, 0.000227013996f, 0.00851396937f, -0.0109095825f, -0.00764498441f, 0.00122210255f, -0.00338297244f,
+            -0.00321885129f, 0.00185359805f, 0.000351990602f, 0.00564766116f, -0.00455265073f, 0.00661124056f, 0.00133146613f, -0.0010473266f,
+            0.00350098754f, 0.000692492235f, -0.00153710251f, 0.000218450674f, 0.0021216108f, -0.000819079694f, 0.00106564269f, 0.00178737123f,
+            0.000128094005f, 0.000570773613f, -0.0015011793f, -0.000849880453f, -0.000512831088f, 0.000379239937f, 0.000486935227f, 2.3775885e-05f,
+        },
+        .b {
+            0.705443442f, -1.5649085f, -1.5542196f, 1.17987859f, 1.05083752f, 0.0511934385f, 0.39898029f, -0.0911784098f,
+            -0.195272341f, 0.0149134034f, -0.0939507931f, 0.106052667f, 0.0643124357f, -0.0578583963f, 0.0175769944f, -0.0215004459f,
+            -0.036709629f, -0.0416453853f, 0.0384034663f, -0.0193738528f, 0.00883768778f, 0.0147974528f, -0.0177800916f, 0.0130115813f,
+            0.00551806623f, 0.0246160105f, 0.0200166628f, -0.0213869698f, 0.0102241253f, -0.00536790118f, 0.00683394819f, -0.00214761891f,
+            0.00525882188f, -0.000347049645f, -0.00949892402f, -9.83887367e-05f, -0.00251148432f, 0.00143823901f, -0.00389125361f, -0.00253235083f,
+            0.00482570659f, -0.00424373476f, 0.00535143539f, -0.000744213816f, 0.00134228508f, -0.000946091488f, -0.00466137379f, 0.00336833601f,
+            0.00168605312f, 0.00317054568f, 0.00226403819f, 0.00284365239f, -0.00238155853f, 0.00142037089f, -0.00203457242f, -0.000269774784f,
+            0.00149028038f, 0.00220096391f, 0.000585689442f, 0.00141623779f, 0.00105370057f, -0.00134589453f, 5.31482983e-05f, -9.79326142e-05f,
+        },
+    },
+    // kDobro, residual -23 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.0410005562f, 0.0430233218f, 0.038251102f, 0.132706001f, 0.224158898f, 0.137054965f, 0.130187869f, 0.0279545132f,
+            0.0269183572f, 0.225512639f, 0.140331432f, 0.0460137315f, 0.286917329f, 0.291508108f, 0.221783876f, 0.0491169021f,
+            0.304332972f, 0.223153844f, 0.252022833f, 0.163555712f, 0.165648311f, 0.0249561314f, 0.213393778f, 0.00465856865f,
+            0.24944663f, 0.158474773f, 0.113195844f, 0.307148486f, 0.161136463f, 0.209799558f, 0.104778372f, 0.00192161021f,
+            0.0226124357f, 0.219115153f, 0.151548654f, 0.0373717323f, 0.228208601f, 0.308560222f, 0.397453219f, 0.393945396f,
+            0.0347677618f, 0.299421221f, 0.0323472247f, 0.12210419f, 0.0396407917f, 0.153186932f, 0.187833577f, 0.301805913f,
+            0.0206206348f, 0.108561568f, 0.236606494f, 0.185896024f, 0.216413781f, 0.0154857393f, 0.235484943f, 0.00669618789f,
+            0.276234806f, 0.0926630646f, 0.199577183f, 0.310654402f, 0.360573888f, 0.118376598f, 0.240148738f, 0.243366212f,
+        },
+        .radius {
+            0.982325554f, 0.983079255f, 0.982513905f, 0.992359459f, 0.996936738f, 0.993692279f, 0.992169142f, 0.998275757f,
+            0.997892976f, 0.997510374f, 0.993311286f, 0.995981395f, 0.992169142f, 0.990268528f, 0.998275757f, 0.994836211f,
+            0.998275757f, 0.998467207f, 0.996745586f, 0.996363401f, 0.995026946f, 0.998658657f, 0.997127891f, 0.997127891f,
+            0.996745586f, 0.995026946f, 0.997319162f, 0.998275757f, 0.996363401f, 0.997892976f, 0.998084366f, 0.997319162f,
+            0.998658657f, 0.998658657f, 0.997319162f, 0.998658657f, 0.996936738f, 0.998467207f, 0.992549717f, 0.992549717f,
+            0.998275757f, 0.998658657f, 0.998467207f, 0.998084366f, 0.998467207f, 0.998658657f, 0.998658657f, 0.998658657f,
+            0.998467207f, 0.998275757f, 0.998275757f, 0.998658657f, 0.998658657f, 0.998658657f, 0.997701645f, 0.998467207f,
+            0.997510374f, 0.997319162f, 0.998275757f, 0.998658657f, 0.996745586f, 0.998275757f, 0.998850167f, 0.998850167f,
+        },
+        .a {
+            -3.07440925f, 2.86807418f, 0.401861817f, -0.107159272f, -0.102951445f, -0.15982233f, 0.148846731f, -0.0688637719f,
+            0.0681662187f, 0.0742128864f, 0.0377301462f, -0.0624280013f, 0.123595648f, -0.114136726f, -0.0138083184f, -0.0682561547f,
+            0.0297821593f, 0.0080728773f, 0.0291614234f, -0.00396228628f, 0.0354508162f, -0.010811937f, -0.023539653f, 0.0205497909f,
+            -0.0172127485f, -0.0237260945f, 0.016091276f, -0.0132538155f, -0.0136837931f, 0.00852934644f, 0.00703746919f, 5.51141966e-05f,
+            -0.00685040979f, -0.00323049957f, -0.0108679617f, -0.0012690163f, 0.0103884377f, 0.00743800635f, -0.00562159112f, 0.00276395213f,
+            0.00199821591f, -0.00280551682f, 0.0001815859f, 0.00416743197f, 0.00123585865f, 0.00383210578f, -0.00505490508f, 0.00336757069f,
+            -0.00483741425f, -0.00306333741f, -0.00442951685f, 0.00306777074f, -0.00165906432f, -0.00164627656f, 0.00371946371f, 5.8604277e-05f,
+            0.00149566995f, 0.00379259884f, 0.00145316264f, -0.00013875858f, -0.00154405402f, 0.00137913832f, 0.000368697161f, -0.0003448473f,
+        },
+        .b {
+            -13.1958218f, 7.68269348f, 5.28671694f, -0.241294354f, 0.0748461336f, 0.0139304344f, 0.058869686f, 0.0167421456f,
+            0.0314265452f, 0.00191210548f, 0.109978192f, -0.0640091598f, -0.0143389599f, 0.0220365673f, -0.038286563f, 0.00344601437f,
+            -0.0140187507f, 0.0262945071f, -0.013037282f, 0.0304019153f, 0.000471448642f, 0.0124661801f, -0.0027251353f, 0.00796888489f,
+            0.0158414636f, 0.00646463782f, -0.00531505421f, 0.000311356591f, 0.0119496332f, -0.00725448318f, -0.00757737225f, -0.0121607725f,
+            0.00507709896f, -0.00734296581f, 0.000561486813f, 0.00729952194f, -0.00384427025f, -0.00141359447f, 0.0135076717f, -0.0141732935f,
+            0.00655426178f, 0.00533112604f, 0.00625076145f, 0.00534968916f, 0.00586961908f, 0.00401337026f, 0.00197161362f, 0.00398596935f,
+            -0.000502581184f, 0.00380867557f, 0.000969114888f, -0.00246363715f, -0.00351729407f, 0.00297515094f, 0.00230871909f, -0.00325234514f,
+            -0.00381247583f, 0.000692082511f, -0.00187391823f, -0.00200755964f, -0.0017249058f, -0.000362976396f, 0.000518108893f, 0.000220575879f,
+        },
+    },
+    // kViola, residual -11 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.275457472f, 0.273762971f, 0.235807076f, 0.0488463454f, 0.239967674f, 0.194799617f, 0.0497981384f, 0.35448283f,
+            0.189615831f, 0.0473954044f, 0.380412132f, 0.185232997f, 0.186902344f, 0.394293427f, 0.361999571f, 0.253178656f,
+            0.365214199f, 0.14485763f, 0.261417598f, 0.262234926f, 0.22561115f, 0.36311841f, 0.314871162f, 0.146676496f,
+            0.347648323f, 0.0441831425f, 0.0964439958f, 0.0303311795f, 0.224105909f, 0.330259502f, 0.34641856f, 0.177603677f,
+            0.350939602f, 0.119690433f, 0.051786501f, 0.221204415f, 0.257054597f, 0.297852635f, 0.0595800504f, 0.197703451f,
+            0.0294173807f, 0.301409811f, 0.15609698f, 0.295941561f, 0.133606195f, 0.229599193f, 0.124796525f, 0.419729203f,
+            0.338115692f, 0.15253976f, 0.0751728788f, 0.172726557f, 0.100231156f, 0.11042162f, 0.209474087f, 0.0553418696f,
+            0.206108734f, 0.283346057f, 0.527846515f, 0.431850553f, 0.288168669f, 0.0576293543f, 0.374992549f, 0.574576437f,
+        },
+        .radius {
+            0.9952178f, 0.9952178f, 0.9952178f, 0.998850167f, 0.994454741f, 0.993882835f, 0.998850167f, 0.995981395f,
+            0.996554494f, 0.999041736f, 0.993120849f, 0.998850167f, 0.998850167f, 0.993501782f, 0.996554494f, 0.997701645f,
+            0.996363401f, 0.996554494f, 0.998850167f, 0.998658657f, 0.997892976f, 0.998275757f, 0.994645476f, 0.996745586f,
+            0.998850167f, 0.998850167f, 0.998850167f, 0.998850167f, 0.998658657f, 0.997701645f, 0.999041736f, 0.998467207f,
+            0.998658657f, 0.998084366f, 0.998850167f, 0.998850167f, 0.999041736f, 0.999041736f, 0.999041736f, 0.998658657f,
+            0.998850167f, 0.996745586f, 0.997892976f, 0.998850167f, 0.998275757f, 0.999041736f, 0.997510374f, 0.998850167f,
+            0.998850167f, 0.998850167f, 0.998850167f, 0.999041736f, 0.999041736f, 0.998850167f, 0.998850167f, 0.998850167f,
+            0.999041736f, 0.999041736f, 0.991028368f, 0.997701645f, 0.999041736f, 0.999041736f, 0.998850167f, 0.988750637f,
+        },
+        .a {
+            0.00828733202f, -0.0205301922f, 0.123564266f, 0.00892047212f, -0.079202652f, 0.0907000303f, 0.0294813309f, -0.0457318239f,
+            -0.0320163108f, -0.0273646303f, -0.00916898996f, -0.0259405635f, 0.00232343678f, 0.0541227646f, -0.0380560867f, 0.00552776456f,
+            -0.0187873151f, -0.0295788236f, -0.0147612141f, 0.00659908867f, -0.0164890811f, 0.0196708366f, -0.0289895292f, 0.022724105f,
+            -0.0071470961f, -0.0131452931f, 0.0136574358f, 0.00436647283f, 0.00751245581f, 0.0152286766f, 0.00539514842f, -0.0109980712f,
+            0.0107115135f, 0.0115249632f, -0.000234218445f, -0.0090512028f, -0.00482915808f, 0.000610991847f, 0.00727346726f, -0.00776118599f,
+            -0.00380369509f, 0.0123988912f, -0.00392147666f, -0.00611393806f, 0.00297119864f, 0.000915849581f, -0.00296558742f, -0.00101927726f,
+            -0.00230582245f, 0.00318694115f, 0.00300204498f, -0.00050580164f, 0.00177316356f, 0.00103064848f, -0.00418220973f, 0.00319243199f,
+            -0.00148995186f, -0.00297617307f, -0.0018410238f, 0.00447311439f, -0.000555888109f, 0.00048763142f, 0.000289786287f, -0.00159887632f,
+        },
+        .b {
+            -0.17871134f, 0.171110004f, 0.0461805351f, 0.0551369004f, -0.0747590587f, 0.0506312065f, -0.0276696235f, -0.0573281683f,
+            -0.0429053269f, -0.00498013292f, 0.0720213205f, -0.00298615568f, 0.0242579617f, -0.0120622758f, 0.00922335219f, -0.0277715065f,
+            0.0296756662f, 0.0122924363f, -0.0104854237f, 0.0170325022f, -0.0156016275f, 0.0037484488f, -0.0159980319f, -0.0114557026f,
+            0.0132719399f, 0.00607306371f, -0.00386051182f, -0.0115070492f, 0.00975548942f, -0.000646869186f, -0.00797626004f, 0.0051501994f,
+            0.000765520846f, -0.00514786504f, -0.00976579916f, 0.00156535464f, -0.00656137662f, 0.00808994193f, -0.00321339094f, -0.00515101058f,
+            0.00741988327f, 0.00581546361f, -0.00885439757f, -0.00267159147f, -0.00755037321f, 0.00591153884f, -0.00886837579f, -0.00601534313f,
+            -0.00551647227f, -0.00472346228f, 0.00477731647f, -0.00396231515f, -0.00349507853f, 0.00411141338f, 0.000380510755f, -0.00267291931f,
+            -0.00325908186f, -0.00140800769f, -0.00985925645f, -0.00208217651f, -0.00180938933f, 0.00110756455f, -0.000825675903f, 5.92496963e-06f,
+        },
+    },
+    // kGuzheng, residual -32 dB
+    ModalBodyData{
+        .numModes = 64,
+        .omega {
+            0.0991167501f, 0.100797527f, 0.134772465f, 0.132963941f, 0.158834368f, 0.164227158f, 0.0950247571f, 0.137201399f,
+            0.320175618f, 0.166121945f, 0.156241253f, 0.328405619f, 0.102016561f, 0.324016094f, 0.325891882f, 0.318426371f,
+            0.217709184f, 0.221237808f, 0.163381472f, 0.0781382471f, 0.333725721f, 0.0672888979f, 0.213754669f, 0.215866536f,
+            0.169562504f, 0.249567121f, 0.247277081f, 0.0456268713f, 0.219383284f, 0.00118766865f, 0.0684323534f, 0.168685317f,
+            0.251882434f, 0.308686793f, 0.52868396f, 0.526913404f, 0.3477754f, 0.309583873f, 0.412458867f, 0.524594903f,
+            0.724622309f, 0.583328247f, 0.627327263f, 0.692233503f, 0.532370329f, 0.348927945f, 0.462788016f, 0.581501544f,
+            0.8283149f, 0.924424529f, 0.413693428f, 0.933740497f, 0.691089392f, 0.916888177f, 0.407436311f, 0.884800971f,
+            0.461654335f, 0.404625058f, 0.793329477f, 0.955092669f, 0.995677948f, 0.634586036f, 0.643918991f, 0.227279186f,
+        },
+        .radius {
+            0.979128659f, 0.979879916f, 0.976316512f, 0.975755036f, 0.981760621f, 0.984588444f, 0.981948912f, 0.977440417f,
+            0.979128659f, 0.98685658f, 0.983079255f, 0.975755036f, 0.983833551f, 0.977065623f, 0.976129353f, 0.980067849f,
+            0.982325554f, 0.984777272f, 0.988940239f, 0.983644903f, 0.975942194f, 0.983456314f, 0.988561094f, 0.990838349f,
+            0.991978943f, 0.983267784f, 0.983456314f, 0.997319162f, 0.990838349f, 0.987424374f, 0.991788745f, 0.992930472f,
+            0.987235069f, 0.996172369f, 0.990648389f, 0.990648389f, 0.995790422f, 0.994454741f, 0.996936738f, 0.988940239f,
+            0.997510374f, 0.982513905f, 0.995981395f, 0.993882835f, 0.988561094f, 0.995599508f, 0.993882835f, 0.982890785f,
+            0.996745586f, 0.985721827f, 0.995981395f, 0.983833551f, 0.993501782f, 0.983267784f, 0.991788745f, 0.990268528f,
+            0.993692279f, 0.989129901f, 0.986289024f, 0.991408467f, 0.994645476f, 0.990078688f, 0.981948912f, 0.998850167f,
+        },
+        .a {
+            -29.0103931f, 21.9474106f, 11.4464045f, -5.37479496f, -2.65490007f, 1.10428584f, 5.44293261f, -4.18139458f,
+            3.5749433f, -0.818084121f, 1.39235401f, 2.89695883f, 0.253961921f, -2.46290326f, -1.9789263f, -1.64478624f,
+            -0.204462752f, 0.332965791f, 0.323496491f, 0.0348854661f, -0.41760999f, 0.301628917f, -0.244065687f, -0.0288254246f,
+            -0.0112209143f, 0.138280049f, -0.141084284f, 0.0295378342f, 0.0370356478f, -0.0185786616f, 0.0547513925f, -0.0167041514f,
+            -0.0277162157f, -0.00502614956f, -0.00577227166f, -0.00178113428f, -0.00292159733f, 0.00244720024f, 0.00100290286f, 0.00656097103f,
+            -0.000908341375f, 0.0010542731f, 0.000227750148f, 0.00167018105f, 0.00314956298f, -0.000606438087f, -0.000583868357f, -0.00138483115f,
+            0.000187112732f, 0.000393602968f, -0.000816975487f, -0.000679871533f, 0.000328992843f, 0.00121419504f, 0.000550137542f, 0.000412665104f,
+            0.000641330204f, -0.000941689301f, 0.000577657425f, -9.76743104e-05f, -0.000199019443f, 0.000317575003f, -0.000286746916f, -1.55240105e-05f,
+        },
+        .b {
+            20.9161606f, -19.9143066f, -6.68667364f, 7.51498222f, -6.11797619f, 5.99202633f, -1.99953985f, -0.582448542f,
+            -0.272962421f, -2.679914f, 2.34635091f, 1.08109736f, 2.37628436f, -1.28542948f, 0.290613383f, 0.534787536f,
+            -0.834991455f, 0.478972644f, -0.374677241f, -0.470349073f, -0.337803483f, -0.105729334f, 0.0149302976f, 0.1917952f,
+            0.17329067f, 0.102896877f, -0.053898003f, -0.0525481999f, 0.0782310441f, 0.0921871737f, 0.0391471796f, -0.0364405029f,
+            -0.00949895196f, 0.00921108946f, 0.00974222366f, -0.0108816018f, 0.00405762764f, -0.00455426192f, 0.00336379581f, 0.000743206416f,
+            0.00300444965f, 0.00633929437f, 0.00299176574f, 0.00308446889f, 0.00190315256f, -0.00218249252f, 0.00234563299f, -0.00369403628f,
+            0.00164853758f, -0.00332820485f, -0.00140828826f, 0.00315142539f, -0.00141131284f, 0.001099488f, 0.000917032827f, 0.000912747812f,
+            -0.00040901333f, -4.48008213e-05f, 0.000713260262f, 0.000419027347f, 0.000218574496f, -0.000108348155f, 8.77752027e-05f, -5.47857871e-06f,
+        },
+    },
+};
+
+}
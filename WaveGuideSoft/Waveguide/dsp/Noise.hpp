@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <limits>
 
 namespace dsp {
 
@@ -7,13 +8,22 @@ class Noise {
 public:
     void Init(float /*sampleRate*/) {}
 
-    void     SetSeed(uint32_t seed);
-    float    Next01();
-    float    Next();
+    // constexpr, 编译期生成默认状态时也能用
+    constexpr void SetSeed(uint32_t seed) { reg_ = seed; }
+    constexpr float Next01() {
+        reg_ *= 1103515245;
+        reg_ += 12345;
+        return reg_ / static_cast<float>(std::numeric_limits<uint32_t>::max());
+    }
+    constexpr float Next() { return Next01() * 2 - 1; }
     float    Lowpassed();
     float    Lowpassed01();
-    uint32_t NextUInt();
-    uint32_t GetReg() const;
+    constexpr uint32_t NextUInt() {
+        reg_ *= 1103515245;
+        reg_ += 12345;
+        return reg_;
+    }
+    constexpr uint32_t GetReg() const { return reg_; }
 private:
     uint32_t reg_{};
 };
@@ -0,0 +1,20 @@
+#pragma once
+#include <cstdint>
+#include "NotePlan.hpp"
+
+namespace dsp {
+
+/**
+ * @brief 带时间戳的音符事件
+ * time 是采样时钟(单位: 采样点), velocity == 0 表示 NoteOff
+ * NoteOn 在入队时由 CSynth::PlanNote 填写 plan
+ */
+struct NoteEvent {
+    uint32_t time;
+    uint8_t channel;
+    uint8_t note;
+    uint8_t velocity;
+    NotePlan plan;
+};
+
+}
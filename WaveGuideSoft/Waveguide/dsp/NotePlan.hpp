@@ -0,0 +1,25 @@
+#pragma once
+#include "PluckString.hpp"
+#include "Reed.hpp"
+#include "Bowed.hpp"
+#include "params.hpp"
+
+namespace dsp {
+
+/**
+ * @brief 在产生事件的任务中为当时的乐器算好的NoteOn, 随事件一起排队
+ * DAC任务只需要复制到voice, 排队期间乐器被切换时退回到 NoteOn(note, velocity)
+ */
+struct NotePlan {
+    NotePlan() : string{} {}
+
+    // kNumInstruments 表示没有计划
+    Instrument instrument{ Instrument::kNumInstruments };
+    union {
+        PluckString::Plan string;
+        Reed::Plan reed;
+        Bowed::Plan bow;
+    };
+};
+
+}
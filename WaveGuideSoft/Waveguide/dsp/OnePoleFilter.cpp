@@ -1,6 +1,7 @@
 #include "OnePoleFilter.hpp"
 #include <cmath>
 #include <complex>
+#include "FastMath.hpp"
 
 namespace dsp {
 
@@ -13,7 +14,7 @@ void OnePoleFilter::SetCutoffLPF(float freq) {
 
     freq = std::min(freq, GetMaxLowpassFreq());
     float omega = 2 * std::numbers::pi_v<float> * freq / sampleRate_;
-    auto k = std::tan(omega / 2);
+    auto k = fastmath::Tan(omega / 2);
     b0_ = k / (1 + k);
     b1_ = b0_;
     a1_ = (k - 1) / (k + 1);
@@ -23,7 +24,7 @@ void OnePoleFilter::SetCutoffLPF(float freq) {
 void OnePoleFilter::SetCutoffHPF(float freq) {
     freq_ = freq;
     float omega = 2 * std::numbers::pi_v<float> * freq / sampleRate_;
-    auto k = std::tan(omega / 2);
+    auto k = fastmath::Tan(omega / 2);
     b0_ = 1 / (1 + k);
     b1_ = -b0_;
     a1_ = (k - 1) / (k + 1);
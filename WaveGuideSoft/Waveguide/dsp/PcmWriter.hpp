@@ -0,0 +1,41 @@
+#pragma once
+#include <span>
+#include <cstdint>
+#include "Types.hpp"
+
+namespace dsp {
+
+/**
+ * @brief post chain的最后一级, 音量/限幅/转换格式后直接写入DMA缓冲
+ */
+class PcmWriter {
+public:
+    static constexpr float kMax = AUDIO_OUTPUT_BITS == 32
+        ? 2147483520.0f // 小于2^31的最大float
+        : static_cast<float>((1u << (AUDIO_OUTPUT_BITS - 1)) - 1);
+    static constexpr float kMin = -static_cast<float>(1u << (AUDIO_OUTPUT_BITS - 1));
+
+    PcmWriter(std::span<StereoSample> out, float gain)
+        : out_(out), gain_(gain * kPcmUnity) {}
+
+    void Write(uint32_t i, float left, float right) {
+        out_[i].left = Convert(left * gain_);
+        out_[i].right = Convert(right * gain_);
+    }
+
+    uint32_t Size() const { return out_.size(); }
+
+    static PcmSample Convert(float x) {
+        x = x < kMin ? kMin : x > kMax ? kMax : x;
+#if AUDIO_OUTPUT_BITS == 24
+        return static_cast<PcmSample>(static_cast<int32_t>(x) << 8);
+#else
+        return static_cast<PcmSample>(x);
+#endif
+    }
+private:
+    std::span<StereoSample> out_;
+    float gain_;
+};
+
+}
@@ -3,73 +3,166 @@
 #include "DelayAllocator.hpp"
 #include <cassert>
 #include <algorithm>
+#include <numbers>
+#include <atomic>
 #include "utli/Map.hpp"
 #include "utli/Clamp.hpp"
 #include "utli/Lerp.hpp"
 #include "params.hpp"
 #include "MidiManager.hpp"
+#include "Tuning.hpp"
+#include "Body.hpp"
+#include "FastMath.hpp"
 
 namespace dsp {
 
-static Noise globalNoise_;
+// PlanNote 在键盘、USBMidiRx和DAC任务中都会调用, 和 Noise 相同的LCG, 状态用CAS原子地更新
+static std::atomic<uint32_t> planNoiseReg_;
+
+static uint32_t NextPlanNoise() {
+    uint32_t reg = planNoiseReg_.load(std::memory_order_relaxed);
+    uint32_t next;
+    do {
+        next = reg * 1103515245 + 12345;
+    } while (!planNoiseReg_.compare_exchange_weak(reg, next, std::memory_order_relaxed));
+    return next;
+}
+// 尾音低于 -40dB 后切换到简化的环路
+static constexpr float kTailLevel = 0.01f;
+// governor降级时提前到 -26dB
+static constexpr float kCheapLoopLevel = 0.05f;
+// 切换环路时的交叉淡化长度, 48k下4ms
+static constexpr uint32_t kQualityFadeLen = 192;
+// 色散比例低于此值时直接旁路
+static constexpr float kLowDispersionRatio = 0.02f;
+// 环路增益的上限, 衰减时间为0时按这个最长的延音
+static constexpr float kMaxLoopGain = 0.9999f;
+
+void PluckString::BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate) {
+    Lowpass lossLP;
+    lossLP.Init(sampleRate);
+    ThrianDispersion dispersion;
+    dispersion.Init(sampleRate);
+    const float dispersionRatio = SynthParams.string.dispersion.Get();
+    const float bendRatio = std::exp2(SynthParams.pitchBend.Get() / 12.0f);
+    for (uint32_t note = 0; note < table.size(); ++note) {
+        auto& p = table[note];
+        const float freq = freqs[note];
+        p.period = sampleRate / freq;
+        p.lossCutoff = Note::Midi2Frequency(GetLossLP(note));
+        dispersion.SetGroupDelay(dispersionRatio * p.period);
+        p.dispersionDelay = dispersion.GetPhaseDelay(freq);
+        for (uint32_t type = 0; type < kNumLossTypes; ++type) {
+            lossLP.SetLoopFilterType(static_cast<Lowpass::LoopFilterType>(type));
+            lossLP.SetCutOffFreq(p.lossCutoff);
+            p.lossDelay[type] = lossLP.GetPhaseDelay(freq);
+            p.tuning[type] = TunningFilter::Design(p.period - p.lossDelay[type] - p.dispersionDelay);
+        }
+        // 滤波器的延迟两边相同, 相减后抵消
+        p.bendDelta = std::max(p.period - p.period / bendRatio, 0.0f);
+        p.exciterRatio = Note::Midi2Frequency(GetExciLP(note)) / freq;
+    }
+}
 
 void PluckString::Init(float sampleRate) {
     dispersion_.Init(sampleRate);
     delay_->Init(sampleRate);
     lossLP_.Init(sampleRate);
-    exciterFilter_.Init(sampleRate);
     tunningFilter_.Init(sampleRate);
     lossLP_.SetLoopFilterType(Lowpass::LoopFilterType::IIR_LPF2);
     sampleRate_ = sampleRate;
 }
 
 
-void PluckString::NoteOn(uint8_t channel, uint8_t noteNumber, float velocity) {
-    channel_ = channel;
-    note_ = noteNumber;
-    auto freq = Note::Midi2Frequency(noteNumber);
-    auto secs = 1.0f / freq;
-
-    float lossLPSt = GetLossLP(noteNumber);
-    lossLP_.SetCutOffFreq(Note::Midi2Frequency(lossLPSt));
-    auto len = secs * sampleRate_;
-    auto dispLen = dispersionLenRatio_ * len;
-    dispersion_.SetGroupDelay(dispLen);
-    float dispRealLen = dispersion_.GetPhaseDelay(freq);
-    len -= dispRealLen;
-    float filterLen = dispRealLen;
-    float lpLen = lossLP_.GetPhaseDelay(freq);
-    len -= lpLen;
-    filterLen += lpLen;
-    waveguideLoopLen_ = len;
-    float delayLen = tunningFilter_.SetDelay(len);
-    delay_->SetDelay(delayLen);
-
-    float pitchBendMaxFreq = Note::Midi2Frequency(noteNumber + SynthParams.pitchBend.Get());
-    float pitchBendSecs = 1.0f / pitchBendMaxFreq;
-    float pitchBendLen = pitchBendSecs * sampleRate_ - filterLen;
-    pitchBendLenDelta_ = len - pitchBendLen;
-    pitchBendLenDelta_ = std::max(pitchBendLenDelta_, 0.0f);
+void PluckString::PlanNote(Plan& plan, uint8_t noteNumber, float velocity, float sampleRate) {
+    auto& p = SynthParams.string;
+    plan.note = noteNumber;
+    plan.pitch = Tuning.GetStringPitch(noteNumber);
+
+    // 新音符总是完整音质
+    const auto lossType = p.lossFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1;
+    plan.lossLP.Init(sampleRate);
+    plan.lossLP.SetLoopFilterType(lossType);
+    plan.lossLP.SetCutOffFreq(plan.pitch.lossCutoff);
+    plan.dispersion.Init(sampleRate);
+    plan.dispersion.SetGroupDelay(p.dispersion.Get() * plan.pitch.period);
+    const float loopLen = plan.pitch.period
+        - plan.pitch.lossDelay[static_cast<uint32_t>(lossType)]
+        - plan.pitch.dispersionDelay;
 
     // map touchx to pluckPostionx
     float touchXPN1 = 2.0f * MidiManager.GetTouchPadX() - 1.0f;
-    float posAdd = touchXPN1 * SynthParams.string.posAdd.Get();
-    float finalPos = pluckPosition_ + posAdd;
-    finalPos = utli::Clamp(finalPos, SynthParams.string.pos.GetMin(), SynthParams.string.pos.GetMax());
+    float posAdd = touchXPN1 * p.posAdd.Get();
+    float finalPos = p.pos.Get() + posAdd;
+    plan.pluckPosition = utli::Clamp(finalPos, p.pos.GetMin(), p.pos.GetMax());
+
+    // 激励表按环路长度拉伸, 截止频率不超过一个周期能容纳的谐波
+    const auto exciterType = p.exciFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1;
+    plan.exciterTable = &ExciterBank::GetTable(exciterType, plan.pitch.exciterRatio, loopLen * 0.5f);
+    // 每个音符按随机的角度混合两个噪声, 每次拨弦的噪声都不同
+    const float angle = NextPlanNoise() * (2.0f * std::numbers::pi_v<float> / 4294967296.0f);
+    plan.exciterNoiseMix[0] = std::cos(angle);
+    plan.exciterNoiseMix[1] = std::sin(angle);
+    // Lerp(dc, noise, color) / 2
+    const float color = p.color.Get();
+    plan.exciterDcGain = (1.0f - color) * 0.5f;
+    plan.exciterNoiseGain = color * 0.5f;
+
+    // 新音符没有上一次的增益可以保持
+    plan.decay = GetDecayGain(p.decay.Get(), loopLen, sampleRate, kMaxLoopGain);
+}
+
+void PluckString::NoteOn(uint8_t channel, uint8_t noteNumber, float velocity) {
+    Plan plan;
+    PlanNote(plan, noteNumber, velocity, sampleRate_);
+    NoteOn(channel, plan);
+}
+
+void PluckString::NoteOn(uint8_t channel, const Plan& plan) {
+    channel_ = channel;
+    note_ = plan.note;
+    pitch_ = plan.pitch;
+
+    cheapLoop_ = false;
+    bypassDispersion_ = false;
+    fadeLeft_ = 0;
+    exciterActive_ = true;
+    lossLP_.CopyCoeff(plan.lossLP);
+    dispersion_.CopyCoeff(plan.dispersion);
+    UpdateLoopLen();
+    auto len = waveguideLoopLen_;
+    int32_t delayLen = tunningFilter_.SetCoeff(pitch_.tuning[static_cast<uint32_t>(lossLP_.GetLoopFilterType())]);
+    delay_->SetDelay(delayLen);
+    tunedLen_ = len;
+    pitchBendLenDelta_ = pitch_.bendDelta;
 
-    generateClick_ = true;
     delayLen_ = len;
-    pluseLen_ = delayLen_ * finalPos;
-    noisePhase2_ = 0;
-    noisePhase_ = 0;
-    noiseSeed_ = globalNoise_.NextUInt();
-    noise_.SetSeed(noiseSeed_);
-    noise2_.SetSeed(noiseSeed_);
 
-    // set filter and calc decay
-    // float lpPitch = utli::Lerp(SynthParams.string.exciLow.Get(), SynthParams.string.exciHigh.Get(), note_ / 127.0f);
-    exciterFilter_.SetCutOffFreq(Note::Midi2Frequency(GetExciLP(noteNumber)));
-    SetDecay(decayTime_);
+    exciter_.Start(*plan.exciterTable, delayLen_, plan.pluckPosition,
+                   plan.exciterDcGain, plan.exciterNoiseGain, plan.exciterNoiseMix);
+
+    // commuted: 同样的叠加, 但激励按绝对时间播放, 长度包含整个琴体响应
+    commutedExciter_ = commutedEnabled_ ? &Body::GetCommutedExciter() : nullptr;
+    commuted_ = commutedExciter_ != nullptr && commutedExciter_->len > 0;
+    if (commuted_) {
+        commutedTime_ = 0;
+        commutedLen_ = static_cast<int32_t>(delayLen_ + 0.5f);
+        commutedPos_ = static_cast<int32_t>(delayLen_ * plan.pluckPosition + 0.5f);
+        commutedEnd_ = commutedExciter_->len
+            + std::max<int32_t>(commutedLen_, commutedPos_ + CommutedExciter::kBurstLen);
+        const float gain = Body::GetCommutedGain();
+        commutedDcGain_ = plan.exciterDcGain * gain;
+        // 激励表的噪声是一个周期, 能量正比于周期, burst是固定长度, 按周期补偿, 两种模式的噪声比例相同
+        // 只有一个burst, 随机的只是极性
+        const float polarity = plan.exciterNoiseMix[0] < 0.0f ? -1.0f : 1.0f;
+        commutedNoiseGain_ = polarity * plan.exciterNoiseGain * gain * std::sqrt(delayLen_ / CommutedExciter::kBurstLen);
+    }
+
+    decay_ = plan.decay;
 }
 
 void PluckString::NoteOff() {
@@ -77,41 +170,52 @@ void PluckString::NoteOff() {
 }
 
 bool PluckString::Process(std::span<float> buffer, std::span<float> auxBuffer) {
-    maxSample_ = 0.0f;
     UpdateParam();
-
-    for (auto& s : buffer) {
-        s = ProcessSingle();
-    }
+    maxSample_ = 0.0f;
+    ProcessBlock<false>(buffer);
     return maxSample_ < 1e-4f;
 }
 
-float PluckString::ProcessSingle() {
-    float in = 0.0f;
-    if (generateClick_) {
-        float dc = 0.0f;
-        float noise = 0.0f;
-        if (noisePhase_ < pluseLen_) {
-            dc = 0.5f;
+template<bool kAdd>
+void PluckString::ProcessBlock(std::span<float> buffer) {
+    uint32_t numFade = std::min<uint32_t>(fadeLeft_, buffer.size());
+    for (uint32_t i = 0; i < numFade; ++i) {
+        if constexpr (kAdd) {
+            buffer[i] += ProcessFade();
         }
-        else if (noisePhase_ < delayLen_) {
-            dc = -0.5f;
+        else {
+            buffer[i] = ProcessFade();
         }
-        if (noisePhase_ < delayLen_) {
-            noise += noise_.Next();
+    }
+    buffer = buffer.subspan(numFade);
+
+    if (cheapLoop_) {
+        for (auto& s : buffer) {
+            if constexpr (kAdd) {
+                s += ProcessTail();
+            }
+            else {
+                s = ProcessTail();
+            }
         }
-        if (noisePhase2_ - pluseLen_ > 0.0f) {
-            noise -= noise2_.Next();
+        return;
+    }
+
+    for (auto& s : buffer) {
+        if constexpr (kAdd) {
+            s += ProcessSingle();
         }
-        if (noisePhase2_ - pluseLen_ > delayLen_) {
-            generateClick_ = false;
+        else {
+            s = ProcessSingle();
         }
-        noisePhase_ += 1.0f;
-        noisePhase2_ += 1.0f;
-        in = utli::Lerp(dc, noise, color_);
     }
-    in = dcBlocker_.Process(in);
-    in = exciterFilter_.Process(in) / 2;
+}
+
+float PluckString::ProcessSingle() {
+    float in = 0.0f;
+    if (exciterActive_) {
+        in = ProcessExciter();
+    }
 
     auto a = delay_->GetLast() + in;
     a = lossLP_.Process(a);
@@ -125,25 +229,123 @@ float PluckString::ProcessSingle() {
     return a;
 }
 
-bool PluckString::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
-    maxSample_ = 0.0f;
-    UpdateParam();
+float PluckString::ProcessTail() {
+    // 激励已停, 一阶损耗滤波, 电平很小不需要限幅
+    auto a = lossLP_.Process(delay_->GetLast());
+    if (!bypassDispersion_) {
+        a = dispersion_.Process(a);
+    }
+    a = tunningFilter_.Process(a);
+    a *= decay_;
+    delay_->Push(a);
 
-    for (auto& s : buffer) {
-        s += ProcessSingle();
+    maxSample_ = std::max(maxSample_, std::abs(a));
+    return a;
+}
+
+float PluckString::ProcessFade() {
+    // 只在激励结束后切换, 没有输入, 电平很小不需要限幅
+    auto a = lossLP_.Process(delay_->GetLast());
+    if (!bypassDispersion_) {
+        a = dispersion_.Process(a);
+    }
+    a = tunningFilter_.Process(a);
+
+    auto b = fade_.lossLP.Process(delay_->Read(fade_.delay));
+    if (!fade_.bypassDispersion) {
+        b = fade_.dispersion.Process(b);
+    }
+    b = fade_.tuning.Process(b);
+
+    --fadeLeft_;
+    const float oldGain = fadeLeft_ * (1.0f / kQualityFadeLen);
+    a = (a + (b - a) * oldGain) * decay_;
+    delay_->Push(a);
+
+    maxSample_ = std::max(maxSample_, std::abs(a));
+    return a;
+}
+
+float PluckString::ProcessExciter() {
+    if (commuted_) {
+        return ProcessCommutedExciter();
     }
+
+    float in = exciter_.Process();
+    exciterActive_ = exciter_.IsActive();
+    return in;
+}
+
+float PluckString::ProcessCommutedExciter() {
+    const int32_t t = commutedTime_;
+    const auto& e = *commutedExciter_;
+    float dc = 0.5f * e.ReadStep(t) - e.ReadStep(t - commutedPos_) + 0.5f * e.ReadStep(t - commutedLen_);
+    float noise = e.ReadNoise(t) - e.ReadNoise(t - commutedPos_);
+
+    if (++commutedTime_ >= commutedEnd_) {
+        exciterActive_ = false;
+    }
+    return dc * commutedDcGain_ + noise * commutedNoiseGain_;
+}
+
+bool PluckString::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
+    UpdateParam();
+    maxSample_ = 0.0f;
+    ProcessBlock<true>(buffer);
     return maxSample_ < 1e-4f;
 }
 
 void PluckString::UpdateParam() {
+    UpdateQuality();
+
     float pitchBendAmount = 0.0f;
     // use pitchbend
     pitchBendAmount = MidiManager.GetTouchSliderValue(channel_) * SynthParams.string.vibrateDepth.Get();
     float vibrateLen = waveguideLoopLen_ + pitchBendAmount * pitchBendLenDelta_;
-    int32_t idelay = tunningFilter_.SetDelay(vibrateLen);
+    // 环路长度没变时保留现在的系数
+    if (vibrateLen == tunedLen_) return;
+    tunedLen_ = vibrateLen;
+    int32_t idelay;
+    if (pitchBendAmount == 0.0f && !bypassDispersion_) {
+        // 和表里算系数时的环路相同
+        idelay = tunningFilter_.SetCoeff(pitch_.tuning[static_cast<uint32_t>(lossLP_.GetLoopFilterType())]);
+    }
+    else {
+        idelay = tunningFilter_.SetDelay(vibrateLen);
+    }
     delay_->SetDelay(idelay);
 }
 
+void PluckString::UpdateQuality() {
+    // maxSample_ 是上一个block的峰值, 只在足够安静时切换
+    float level = reducedQuality_ ? kCheapLoopLevel : kTailLevel;
+    bool cheap = !exciterActive_ && maxSample_ < level;
+    if (cheap == cheapLoop_) return;
+
+    // 滤波器类型和整数延迟同时改变, 直接切换会有咔嗒声
+    // 旧环路复制一份继续运行, 按旧的延迟读同一条延迟线, 输出在 kQualityFadeLen 内淡化到新环路
+    fade_.lossLP = lossLP_;
+    fade_.dispersion = dispersion_;
+    fade_.tuning = tunningFilter_;
+    fade_.delay = static_cast<int32_t>(delay_->GetDelay());
+    fade_.bypassDispersion = bypassDispersion_;
+    fadeLeft_ = kQualityFadeLen;
+
+    cheapLoop_ = cheap;
+    bypassDispersion_ = cheap && dispersionLenRatio_ < kLowDispersionRatio;
+    lossLP_.SetLoopFilterType(cheap ? Lowpass::LoopFilterType::IIR_LPF1 : lossType_);
+    UpdateLoopLen();
+}
+
+void PluckString::UpdateLoopLen() {
+    // 环路滤波器的相位延迟从延迟线中扣除, 保持音高
+    float filterLen = pitch_.lossDelay[static_cast<uint32_t>(lossLP_.GetLoopFilterType())];
+    if (!bypassDispersion_) {
+        filterLen += pitch_.dispersionDelay;
+    }
+    waveguideLoopLen_ = pitch_.period - filterLen;
+}
+
 bool PluckString::CanPlay(uint8_t note) {
     return maxSample_ < 1e-4f;
 }
@@ -159,16 +361,22 @@ void PluckString::Panic() {
 
 void PluckString::SetDecay(float d) {
     decayTime_ = d;
+    decay_ = GetDecayGain(d, delayLen_, sampleRate_, decay_);
+}
+
+// 负的衰减时间为反相, 0 时保持 last
+float PluckString::GetDecayGain(float d, float loopLen, float sampleRate, float last) {
     if (d > 0.0f) {
-        auto mul = 1.0f / (static_cast<float>(sampleRate_) * d / 1000.0f);
-        auto t = std::pow(10.0f, -(static_cast<float>(delayLen_ * mul)));
-        decay_ = std::min(0.9999f, t);
+        auto mul = 1.0f / (sampleRate * d / 1000.0f);
+        auto t = fastmath::Pow10(-(loopLen * mul));
+        return std::min(kMaxLoopGain, t);
     }
     else if (d < 0.0f) {
-        auto mul = 1.0f / (static_cast<float>(sampleRate_) * -d / 1000.0f);
-        auto t = -std::pow(10.0f, -(static_cast<float>(delayLen_ * mul)));
-        decay_ = std::max(-0.9999f, t);
+        auto mul = 1.0f / (sampleRate * -d / 1000.0f);
+        auto t = -fastmath::Pow10(-(loopLen * mul));
+        return std::max(-kMaxLoopGain, t);
     }
+    return last;
 }
 
 void PluckString::SetLossLPLow(float pitch) {
@@ -179,29 +387,15 @@ void PluckString::SetDispersion(float ratio) {
     dispersionLenRatio_ = ratio;
 }
 
-void PluckString::SetPluckPosition(float pos) {
-    pluckPosition_ = pos;
-}
-
-void PluckString::SetColor(float color) {
-    color_ = color;
-}
-
 void PluckString::SetLossFaster(bool faster) {
     if (faster) {
-        lossLP_.SetLoopFilterType(Lowpass::LoopFilterType::IIR_LPF2);
+        lossType_ = Lowpass::LoopFilterType::IIR_LPF2;
     }
     else {
-        lossLP_.SetLoopFilterType(Lowpass::LoopFilterType::IIR_LPF1);
+        lossType_ = Lowpass::LoopFilterType::IIR_LPF1;
     }
-}
-
-void PluckString::SetExciterFaster(bool faster) {
-    if (faster) {
-        exciterFilter_.SetLoopFilterType(Lowpass::LoopFilterType::IIR_LPF2);
-    }
-    else {
-        exciterFilter_.SetLoopFilterType(Lowpass::LoopFilterType::IIR_LPF1);
+    if (!cheapLoop_) {
+        lossLP_.SetLoopFilterType(lossType_);
     }
 }
 
@@ -4,19 +4,59 @@
 #include "OnePoleFilter.hpp"
 #include "ThrianDispersion.hpp"
 #include "Noise.hpp"
+#include "ExciterBank.hpp"
 #include "TuningFilter.hpp"
-#include "DCBlocker.hpp"
 #include "Lowpass.hpp"
 
 namespace dsp {
 
 class PluckString {
 public:
+    static constexpr uint32_t kNumLossTypes = 2;
+
+    // 每个音符预先算好的环路数据, 见 CTuning
+    struct Pitch {
+        // 一个周期的采样数
+        float period;
+        float lossCutoff;
+        // 按 Lowpass::LoopFilterType 索引, 尾音切换滤波器类型时也不用重新计算
+        float lossDelay[kNumLossTypes];
+        float dispersionDelay;
+        // 弯音到最大时环路长度的减少量
+        float bendDelta;
+        // 激励截止频率 / 基频
+        float exciterRatio;
+        TunningFilter::Coeff tuning[kNumLossTypes];
+    };
+
+    // NoteOn需要的所有计算, 在产生事件的任务中完成, 见 NotePlan
+    struct Plan {
+        Pitch pitch;
+        Lowpass lossLP;
+        ThrianDispersion dispersion;
+        const ExciterBank::Table* exciterTable;
+        float pluckPosition;
+        float exciterDcGain;
+        float exciterNoiseGain;
+        // 两个噪声表的混合比例, 随机角度的cos和sin
+        float exciterNoiseMix[ExciterBank::kNumVariants];
+        float decay;
+        uint8_t note;
+    };
+
+    static void BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate);
+    static void PlanNote(Plan& plan, uint8_t noteNumber, float velocity, float sampleRate);
+
     void Init(float sampleRate);
     void NoteOn(uint8_t channel, uint8_t noteNumber, float velocity);
+    void NoteOn(uint8_t channel, const Plan& plan);
     void NoteOff();
     bool Process(std::span<float> buffer, std::span<float> auxBuffer);
     float ProcessSingle();
+    // 尾音用的简化环路
+    float ProcessTail();
+    // 切换环路后的交叉淡化
+    float ProcessFade();
     bool AddTo(std::span<float> buffer, std::span<float> auxBuffer);
     bool CanPlay(uint8_t note);
     bool IsPlaying(uint8_t note);
@@ -27,46 +67,71 @@ public:
     void SetDecay(float decay);
     void SetLossLPLow(float pitch);
     void SetDispersion(float disp);
-    void SetPluckPosition(float pos);
-    void SetColor(float color);
     void SetLossFaster(bool faster);
-    void SetExciterFaster(bool faster);
     void SetDetune(float pitch) { detunePitch_ = pitch; }
+    // governor降级, 提高切换到尾音模式的电平
+    void SetReducedQuality(bool reduced) { reducedQuality_ = reduced; }
+    // 开启时用已经卷积了琴体的激励, 琴体级被旁路
+    void SetCommuted(bool commuted) { commutedEnabled_ = commuted; }
 
     // delay allocate
     static void AllocDelay(PluckString& string);
     static void FreeDelay(PluckString& string);
 private:
     void UpdateParam();
-    float GetLossLP(int32_t note);
-    float GetExciLP(int32_t note);
+    template<bool kAdd>
+    void ProcessBlock(std::span<float> buffer);
+    float ProcessExciter();
+    float ProcessCommutedExciter();
+    void UpdateQuality();
+    void UpdateLoopLen();
+    static float GetLossLP(int32_t note);
+    static float GetExciLP(int32_t note);
+    static float GetDecayGain(float decayMs, float loopLen, float sampleRate, float last);
 
     uint8_t channel_{};
     ThrianDispersion dispersion_;
     DelayLine* delay_;
     Lowpass lossLP_;
     TunningFilter tunningFilter_;
-    DCBlocker995 dcBlocker_;
-    Noise noise_;
-    Noise noise2_;
-    uint32_t noiseSeed_{};
     uint8_t note_{};
     float decay_{};
-    float pluckPosition_{};
     float sampleRate_{};
     float dispersionLenRatio_{};
     float delayLen_{};
     float waveguideLoopLen_{};
+    // 全通滤波器和延迟线现在对应的环路长度
+    float tunedLen_{};
     float pitchBendLenDelta_{};
-    float pluseLen_{};
-    float noisePhase_{};
-    float noisePhase2_{};
-    bool  generateClick_{ false };
-    float color_{};
     float maxSample_{};
     float detunePitch_{};
-    Lowpass exciterFilter_;
     float decayTime_{};
+    Pitch pitch_{};
+    Lowpass::LoopFilterType lossType_{ Lowpass::LoopFilterType::IIR_LPF2 };
+    bool reducedQuality_{};
+    bool cheapLoop_{};
+    bool bypassDispersion_{};
+    bool exciterActive_{};
+    // 切换完整/简化环路时, 旧环路的滤波器和延迟继续运行一段, 和新环路交叉淡化
+    struct Fade {
+        Lowpass lossLP;
+        ThrianDispersion dispersion;
+        TunningFilter tuning;
+        int32_t delay;
+        bool bypassDispersion;
+    } fade_{};
+    uint32_t fadeLeft_{};
+    ExciterPlayer exciter_;
+    // commuted synthesis, 时间以采样为单位, 激励在NoteOn时从 Body 取
+    bool commutedEnabled_{};
+    const CommutedExciter* commutedExciter_{};
+    bool commuted_{};
+    int32_t commutedTime_{};
+    int32_t commutedPos_{};
+    int32_t commutedLen_{};
+    int32_t commutedEnd_{};
+    float commutedDcGain_{};
+    float commutedNoiseGain_{};
 };
 
 } // namespace dsp
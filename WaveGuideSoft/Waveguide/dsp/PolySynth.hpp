@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <span>
+#include <algorithm>
 #include "DelayAllocator.hpp"
 
 namespace dsp {
@@ -18,57 +19,62 @@ public:
         numUnusedNotes_ = kNumPolyonic;
         for (uint32_t i = 0; i < kNumPolyonic; ++i) {
             unusedNotes_[i] = &notes_[i];
+            fading_[i] = false;
         }
+        numFading_ = 0;
     }
 
     void Process(std::span<float> buffer, std::span<float> auxBuffer) {
-        if (numUsedNotes_ > 0) {
-            bool shouldRemove = usedNotes_[0]->Process(buffer, auxBuffer);
+        // 第一个voice覆盖写入, 之后的叠加
+        bool first = true;
+        for (uint32_t i = 0; i < numUsedNotes_;) {
+            T* note = usedNotes_[i];
+            bool shouldRemove;
+            if (fading_[note - notes_]) {
+                shouldRemove = FadeTo(note, buffer, first);
+            }
+            else if (first) {
+                shouldRemove = note->Process(buffer, auxBuffer);
+            }
+            else {
+                shouldRemove = note->AddTo(buffer, auxBuffer);
+            }
+            first = false;
             if (shouldRemove) {
-                unusedNotes_[numUnusedNotes_++] = usedNotes_[0];
-                std::swap(usedNotes_[0], usedNotes_[numUsedNotes_ - 1]);
-                --numUsedNotes_;
-                for (uint32_t i = 0; i < numUsedNotes_;) {
-                    shouldRemove = usedNotes_[i]->AddTo(buffer, auxBuffer);
-                    if (shouldRemove) {
-                        unusedNotes_[numUnusedNotes_++] = usedNotes_[i];
-                        std::swap(usedNotes_[i], usedNotes_[numUsedNotes_ - 1]);
-                        --numUsedNotes_;
-                    }
-                    else {
-                        ++i;
-                    }
-                }
+                Free(i);
             }
             else {
-                for (uint32_t i = 1; i < numUsedNotes_;) {
-                    bool shouldRemove = usedNotes_[i]->AddTo(buffer, auxBuffer);
-                    if (shouldRemove) {
-                        unusedNotes_[numUnusedNotes_++] = usedNotes_[i];
-                        std::swap(usedNotes_[i], usedNotes_[numUsedNotes_ - 1]);
-                        --numUsedNotes_;
-                    }
-                    else {
-                        ++i;
-                    }
-                }
+                ++i;
             }
         }
-        else {
+        if (first) {
             std::fill_n(buffer.begin(), buffer.size(), 0);
         }
     }
 
     void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
-        if (numUnusedNotes_ > 0) {
-            auto* used = unusedNotes_[--numUnusedNotes_];
-            used->NoteOn(channel, note, velocity / 127.0f);
-            usedNotes_[numUsedNotes_++] = used;
-        }
-        else {
-            notes_[roundrobinPos_].NoteOn(channel, note, velocity / 127.0f);
-            ++roundrobinPos_;
-            roundrobinPos_ &= (kNumPolyonic - 1);
+        Allocate()->NoteOn(channel, note, velocity / 127.0f);
+    }
+
+    void NoteOn(uint8_t channel, const typename T::Plan& plan) {
+        Allocate()->NoteOn(channel, plan);
+    }
+
+    // 超出的voice从最早开始的起快速淡出, 之后新音符会抢占
+    void SetMaxVoices(uint32_t num) {
+        maxVoices_ = std::clamp(num, 1u, kNumPolyonic);
+        while (numUsedNotes_ - numFading_ > maxVoices_) {
+            T* oldest = nullptr;
+            for (uint32_t i = 0; i < numUsedNotes_; ++i) {
+                T* note = usedNotes_[i];
+                if (fading_[note - notes_]) continue;
+                if (oldest == nullptr || static_cast<int32_t>(noteOnOrder_[note - notes_] - noteOnOrder_[oldest - notes_]) < 0) {
+                    oldest = note;
+                }
+            }
+            fading_[oldest - notes_] = true;
+            fadeGain_[oldest - notes_] = 1.0f;
+            ++numFading_;
         }
     }
 
@@ -88,18 +94,90 @@ public:
         numUnusedNotes_ = kNumPolyonic;
         for (uint32_t i = 0; i < kNumPolyonic; ++i) {
             unusedNotes_[i] = &notes_[i];
+            fading_[i] = false;
         }
+        numFading_ = 0;
     }
 
     std::span<T*> GetUsedNotes() { return std::span<T*>(usedNotes_, numUsedNotes_); }
     std::span<T> GetNotes() { return std::span<T>(notes_, kNumPolyonic); }
 private:
+    T* Allocate() {
+        T* note;
+        if (numUnusedNotes_ > 0 && numUsedNotes_ - numFading_ < maxVoices_) {
+            note = unusedNotes_[--numUnusedNotes_];
+            usedNotes_[numUsedNotes_++] = note;
+        }
+        else {
+            if (numUnusedNotes_ > 0) {
+                // 复音被限制, 从正在发声的voice里抢
+                note = usedNotes_[roundrobinPos_ % numUsedNotes_];
+            }
+            else {
+                note = &notes_[roundrobinPos_];
+            }
+            ++roundrobinPos_;
+            roundrobinPos_ &= (kNumPolyonic - 1);
+        }
+        const uint32_t idx = note - notes_;
+        if (fading_[idx]) {
+            fading_[idx] = false;
+            --numFading_;
+        }
+        noteOnOrder_[idx] = ++noteOnCount_;
+        return note;
+    }
+
+    void Free(uint32_t usedIdx) {
+        T* note = usedNotes_[usedIdx];
+        if (fading_[note - notes_]) {
+            fading_[note - notes_] = false;
+            --numFading_;
+        }
+        unusedNotes_[numUnusedNotes_++] = note;
+        std::swap(usedNotes_[usedIdx], usedNotes_[numUsedNotes_ - 1]);
+        --numUsedNotes_;
+    }
+
+    // 分段算到临时缓冲, 乘上线性下降的增益后叠加, 增益到0时返回true
+    bool FadeTo(T* note, std::span<float> buffer, bool overwrite) {
+        if (overwrite) {
+            std::fill_n(buffer.begin(), buffer.size(), 0);
+        }
+        float& gain = fadeGain_[note - notes_];
+        float tmp[kFadeChunkSize];
+        for (uint32_t pos = 0; pos < buffer.size() && gain > 0.0f; pos += kFadeChunkSize) {
+            const uint32_t num = std::min<uint32_t>(kFadeChunkSize, buffer.size() - pos);
+            std::span<float> chunk{ tmp, num };
+            // voice不写aux
+            const bool silent = note->Process(chunk, chunk);
+            for (uint32_t i = 0; i < num; ++i) {
+                buffer[pos + i] += chunk[i] * gain;
+                gain = std::max(0.0f, gain - kFadeStep);
+            }
+            if (silent) return true;
+        }
+        return gain <= 0.0f;
+    }
+
+    // 复音数减少时超出的voice在这么多采样内淡出
+    static constexpr uint32_t kFadeSamples = 256;
+    static constexpr float kFadeStep = 1.0f / kFadeSamples;
+    static constexpr uint32_t kFadeChunkSize = 32;
+
     T notes_[kNumPolyonic];
     T* usedNotes_[kNumPolyonic]{};
     T* unusedNotes_[kNumPolyonic]{};
     uint32_t numUsedNotes_{};
     uint32_t numUnusedNotes_{};
     uint32_t roundrobinPos_{};
+    uint32_t maxVoices_{ kNumPolyonic };
+    // 按 notes_ 的下标
+    uint32_t noteOnOrder_[kNumPolyonic]{};
+    float fadeGain_[kNumPolyonic]{};
+    bool fading_[kNumPolyonic]{};
+    uint32_t noteOnCount_{};
+    uint32_t numFading_{};
 };
 
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "utli/Lerp.hpp"
 #include "params.hpp"
 #include "MidiManager.hpp"
+#include "Tuning.hpp"
 
 static constexpr float FastTanh(float x) {
     float x2 = x * x;
@@ -15,11 +16,36 @@ static constexpr float FastTanh(float x) {
 
 namespace dsp {
 
+void Reed::BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate) {
+    Lowpass lossLP;
+    lossLP.Init(sampleRate);
+    lossLP.SetLoopFilterType(SynthParams.reed.lossFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1);
+    OnePoleFilter lossHP;
+    lossHP.Init(sampleRate);
+    const float lpOffset = SynthParams.reed.lossLP.Get();
+    const float hpOffset = SynthParams.reed.lossHP.Get();
+    const float bendRatio = std::exp2(SynthParams.pitchBend.Get() / 12.0f);
+    for (uint32_t note = 0; note < table.size(); ++note) {
+        auto& p = table[note];
+        const float freq = freqs[note];
+        p.hpCutoff = Note::Midi2Frequency(note + hpOffset);
+        p.lpCutoff = Note::Midi2Frequency(note + lpOffset);
+        lossHP.SetCutoffHPF(p.hpCutoff);
+        lossLP.SetCutOffFreq(p.lpCutoff);
+        float filterLen = lossLP.GetPhaseDelay(freq) + lossHP.GetPhaseDelay(freq);
+        float period = sampleRate / freq;
+        p.loopLen = period - filterLen;
+        // 滤波器的延迟两边相同, 相减后抵消
+        p.bendDelta = std::max(period - period / bendRatio, 0.0f);
+    }
+}
+
 void Reed::Init(float sampleRate) {
     pipe_->Init(sampleRate);
     lossLP_.Init(sampleRate);
     envelop_.Init(sampleRate);
-    noise_.Init(sampleRate);
     lossHP_.Init(sampleRate);
     sampleRate_ = sampleRate;
     tunningFilter_.Init(sampleRate);
@@ -28,25 +54,21 @@ void Reed::Init(float sampleRate) {
 
     vibrateOscPhase_ = 0.0f;
     tremoloOscPhase_ = 0.0f;
-    vibrateDelay_.Init(sampleRate / 480);
-    tremoloDelay_.Init(sampleRate / 480);
+    vibrateDelay_.Init(sampleRate);
+    tremoloDelay_.Init(sampleRate);
 }
 
 bool Reed::Process(std::span<float> buffer, std::span<float> /*auxBuffer*/) {
     maxSample_ = 0.0f;
-    UpdateDelayLen();
-    for (auto& s : buffer) {
-        s = ProcessSingle();
-    }
+    UpdateDelayLen(buffer.size());
+    ProcessBlock<false>(buffer);
     return maxSample_ < 1e-4f && !noteOn_;
 }
 
 bool Reed::AddTo(std::span<float> buffer, std::span<float> /*auxBuffer*/) {
     maxSample_ = 0.0f;
-    UpdateDelayLen();
-    for (auto& s : buffer) {
-        s += ProcessSingle();
-    }
+    UpdateDelayLen(buffer.size());
+    ProcessBlock<true>(buffer);
     return maxSample_ < 1e-4f && !noteOn_;
 }
 
@@ -58,9 +80,27 @@ bool Reed::CanPlay(uint8_t note) {
     return maxSample_ < 1e-4f || note_ == note;
 }
 
-float Reed::ProcessSingle() {
+template<bool kAdd>
+void Reed::ProcessBlock(std::span<float> buffer) {
+    // 噪声按tile整块生成
+    float noise[BlockNoise::kTileSize];
+    for (uint32_t pos = 0; pos < buffer.size(); pos += BlockNoise::kTileSize) {
+        uint32_t n = std::min<uint32_t>(BlockNoise::kTileSize, buffer.size() - pos);
+        noise_.Fill01(std::span{ noise, n });
+        for (uint32_t i = 0; i < n; ++i) {
+            if constexpr (kAdd) {
+                buffer[pos + i] += ProcessSingle(noise[i]);
+            }
+            else {
+                buffer[pos + i] = ProcessSingle(noise[i]);
+            }
+        }
+    }
+}
+
+float Reed::ProcessSingle(float noise) {
     auto env = envelop_.Process(sustain_);
-    auto noise = noise_.Next01() * noiseGain_;
+    noise *= noiseGain_;
     auto air = (airGain_ + tremoloAmount_ + noise) * env;
     air /= 2;
     auto pipe = pipe_->GetLast() * realDecay_;
@@ -76,29 +116,39 @@ float Reed::ProcessSingle() {
     return out;
 }
 
+void Reed::PlanNote(Plan& plan, uint8_t note, float velocity, float sampleRate) {
+    plan.note = note;
+    plan.sustain = std::lerp(0.8f, 1.0f, velocity);
+    plan.pitch = Tuning.GetReedPitch(note);
+
+    plan.lossLP.Init(sampleRate);
+    plan.lossLP.SetLoopFilterType(SynthParams.reed.lossFaster.Get()
+        ? Lowpass::LoopFilterType::IIR_LPF2
+        : Lowpass::LoopFilterType::IIR_LPF1);
+    plan.lossLP.SetCutOffFreq(plan.pitch.lpCutoff);
+    plan.lossHP.Init(sampleRate);
+    plan.lossHP.SetCutoffHPF(plan.pitch.hpCutoff);
+    plan.filterLossGain = GetFilterLossGain(plan.lossLP, plan.lossHP, sampleRate);
+}
+
 void Reed::NoteOn(uint8_t channel, uint32_t note, float velocity) {
+    Plan plan;
+    PlanNote(plan, note, velocity, sampleRate_);
+    NoteOn(channel, plan);
+}
+
+void Reed::NoteOn(uint8_t channel, const Plan& plan) {
     channel_ = channel;
-    note_ = note;
-    sustain_ = std::lerp(0.8f, 1.0f, velocity);
+    note_ = plan.note;
+    sustain_ = plan.sustain;
 
-    auto freq = Note::Midi2Frequency(note + hpFilterOffset_);
-    lossHP_.SetCutoffHPF(freq);
-    freq = Note::Midi2Frequency(note + lpFilterOffset_);
-    lossLP_.SetCutOffFreq(freq);
-    CalcRealDecay();
+    lossHP_.CopyCoeff(plan.lossHP);
+    lossLP_.CopyCoeff(plan.lossLP);
+    filterLossGain_ = plan.filterLossGain;
+    realDecay_ = lossGain_ / filterLossGain_;
 
-    freq = Note::Midi2Frequency(note);
-    float filterLen = 0.0f;
-    filterLen += lossLP_.GetPhaseDelay(freq);
-    filterLen += lossHP_.GetPhaseDelay(freq);
-    auto secs = 1.0f / freq;
-    auto len = secs * sampleRate_ - filterLen;
-    waveguideLoopLen_ = len;
-    float pitchBendMaxFreq = Note::Midi2Frequency(note + SynthParams.pitchBend.Get());
-    float pitchBendSecs = 1.0f / pitchBendMaxFreq;
-    float pitchBendLen = pitchBendSecs * sampleRate_ - filterLen;
-    pitchBendLenDelta_ = len - pitchBendLen;
-    pitchBendLenDelta_ = std::max(pitchBendLenDelta_, 0.0f);
+    waveguideLoopLen_ = plan.pitch.loopLen;
+    pitchBendLenDelta_ = plan.pitch.bendDelta;
     noteOn_ = true;
 
     vibrateDelay_.Set(0);
@@ -165,32 +215,36 @@ float Reed::ReedReflection2(float delta) {
 }
 
 void Reed::CalcRealDecay() {
-    auto lpFreq = lossLP_.GetFreq();
-    auto hpFreq = lossHP_.GetFreq();
-    auto maxFreq = std::sqrt(lpFreq * hpFreq);
-    auto omega = maxFreq / sampleRate_ * Note::twopi;
-    filterLossGain_ = lossLP_.GetMagPowerResponce(omega) * lossHP_.GetMagPowerResponce(omega);
-    filterLossGain_ = std::sqrt(filterLossGain_);
+    filterLossGain_ = GetFilterLossGain(lossLP_, lossHP_, sampleRate_);
     realDecay_ = lossGain_ / filterLossGain_;
 }
 
-void Reed::UpdateDelayLen() {
+// 两个滤波器通带中心的增益
+float Reed::GetFilterLossGain(const Lowpass& lossLP, OnePoleFilter& lossHP, float sampleRate) {
+    auto lpFreq = lossLP.GetFreq();
+    auto hpFreq = lossHP.GetFreq();
+    auto maxFreq = std::sqrt(lpFreq * hpFreq);
+    auto omega = maxFreq / sampleRate * Note::twopi;
+    return std::sqrt(lossLP.GetMagPowerResponce(omega) * lossHP.GetMagPowerResponce(omega));
+}
+
+void Reed::UpdateDelayLen(uint32_t numSamples) {
     float pitchBendAmount = 0.0f;
     auto virbrateMode = SynthParams.reed.vibrateControl.Get();
     if (virbrateMode == 0) {
         // use auto vibrate
-        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
         }
         float triangle = 4.0f * std::abs(vibrateOscPhase_ - 0.5f) - 1.0f;
         pitchBendAmount = triangle * SynthParams.reed.vibrateDepth.Get();
-        pitchBendAmount *= vibrateDelay_.Process(1);
+        pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     }
     else if (virbrateMode == 1) {
         // pitchbend as vibrate depth
-        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
@@ -198,7 +252,7 @@ void Reed::UpdateDelayLen() {
         float triangle = 4.0f * std::abs(vibrateOscPhase_ - 0.5f) - 1.0f;
         float depth = MidiManager.GetTouchSliderValue(channel_);
         pitchBendAmount = triangle * SynthParams.reed.vibrateDepth.Get() * std::abs(depth);
-        pitchBendAmount *= vibrateDelay_.Process(1);
+        pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     }
     else {
         // pitchbend as manual vibrate
@@ -212,18 +266,18 @@ void Reed::UpdateDelayLen() {
     auto tremoloMode = SynthParams.reed.tremoloControl.Get();
     if (tremoloMode == 0) {
         // use auto tremolo
-        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
         }
         float sin = std::sin(tremoloOscPhase_ * std::numbers::pi_v<float> * 2.0f);
         tremoloAmount_ = sin;
-        tremoloAmount_ *= tremoloDelay_.Process(1);
+        tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
         tremoloAmount_ *= SynthParams.reed.tremoloDepth.Get();
     }
     else if (tremoloMode == 1) {
-        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
@@ -231,7 +285,7 @@ void Reed::UpdateDelayLen() {
         float sin = std::sin(tremoloOscPhase_ * std::numbers::pi_v<float> * 2.0f);
         tremoloAmount_ = sin;
         tremoloAmount_ *= SynthParams.reed.tremoloDepth.Get() * MidiManager.GetPressure(channel_);
-        tremoloAmount_ *= tremoloDelay_.Process(1);
+        tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
     }
     else {
         // use pressure
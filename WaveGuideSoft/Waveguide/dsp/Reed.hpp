@@ -4,7 +4,7 @@
 #include "DelayLine.hpp"
 #include "OnePoleFilter.hpp"
 #include "ExpSmoother.hpp"
-#include "Noise.hpp"
+#include "BlockNoise.hpp"
 #include "TuningFilter.hpp"
 #include "Lowpass.hpp"
 #include "ExpSmoother2.hpp"
@@ -13,18 +13,42 @@ namespace dsp {
 
 class Reed {
 public:
+    // 每个音符预先算好的环路数据, 见 CTuning
+    struct Pitch {
+        float loopLen;
+        // 弯音到最大时环路长度的减少量
+        float bendDelta;
+        float lpCutoff;
+        float hpCutoff;
+    };
+
+    // NoteOn需要的所有计算, 在产生事件的任务中完成, 见 NotePlan
+    struct Plan {
+        Pitch pitch;
+        Lowpass lossLP;
+        OnePoleFilter lossHP;
+        float filterLossGain;
+        float sustain;
+        uint8_t note;
+    };
+
+    static void BuildPitchTable(std::span<Pitch> table, std::span<const float> freqs, float sampleRate);
+    static void PlanNote(Plan& plan, uint8_t note, float velocity, float sampleRate);
+
     void Init(float sampleRate);
     bool Process(std::span<float> buffer, std::span<float> auxBuffer);
     bool AddTo(std::span<float> buffer, std::span<float> auxBuffer);
     bool IsPlaying(uint8_t note);
     bool CanPlay(uint8_t note);
     void NoteOn(uint8_t channel, uint32_t note, float velocity);
+    void NoteOn(uint8_t channel, const Plan& plan);
     void NoteOff();
     void SetDelayLineRef(DelayLine* pipe) { pipe_ = pipe; }
     void Panic();
-    float ProcessSingle();
+    float ProcessSingle(float noise);
     // setter
     void SetNoiseGain(float gain);
+    void SetNoiseStream(uint32_t stream) { noise_.SetSeed(0, stream); }
     void SetLossGain(float gain);
     void SetLossLP(float pitch);
     void SetLossHP(float pitch);
@@ -47,7 +71,10 @@ public:
     float debugValueOutputWave_{};
 private:
     void CalcRealDecay();
-    void UpdateDelayLen();
+    static float GetFilterLossGain(const Lowpass& lossLP, OnePoleFilter& lossHP, float sampleRate);
+    void UpdateDelayLen(uint32_t numSamples);
+    template<bool kAdd>
+    void ProcessBlock(std::span<float> buffer);
 
     uint8_t channel_{};
     DelayLine* pipe_;
@@ -55,7 +82,7 @@ private:
     Lowpass lossLP_;
     OnePoleFilter lossHP_;
     ExpSmoother envelop_;
-    Noise noise_;
+    BlockNoise noise_;
     TunningFilter tunningFilter_;
     float sustain_{};
     float inhalingOffset_{};
@@ -2,17 +2,111 @@
 #include <numbers>
 #include <cmath>
 #include <cassert>
+#include <algorithm>
 #include "MemAttributes.hpp"
+#include "PcmWriter.hpp"
+#include "utli/ConstMath.hpp"
+#include "FastMath.hpp"
 
 namespace dsp {
 
-static constexpr std::array kPrimeTable {
-    521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599, 601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661, 673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751, 757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829, 839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919, 929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171, 1177, 1181, 1187, 1193, 1201, 1213, 1217, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697, 1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787, 1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879, 1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993, 1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039
-};
+// FDN的延迟长度, kFIRSize/4 ~ kFIRSize 之间的质数
+static constexpr bool IsPrime(uint32_t n) {
+    for (uint32_t d = 2; d * d <= n; ++d) {
+        if (n % d == 0) return false;
+    }
+    return n > 1;
+}
+
+static constexpr uint32_t CountPrimes(uint32_t begin, uint32_t end) {
+    uint32_t count = 0;
+    for (uint32_t n = begin; n < end; ++n) {
+        if (IsPrime(n)) ++count;
+    }
+    return count;
+}
+
+template<uint32_t kBegin, uint32_t kEnd>
+static constexpr auto MakePrimeTable() {
+    std::array<uint32_t, CountPrimes(kBegin, kEnd)> table{};
+    uint32_t count = 0;
+    for (uint32_t n = kBegin; n < kEnd; ++n) {
+        if (IsPrime(n)) table[count++] = n;
+    }
+    return table;
+}
+
+static constexpr auto kPrimeTable = MakePrimeTable<Reverb::kFIRSize / 4, Reverb::kFIRSize>();
+static_assert(kPrimeTable.front() == 521 && kPrimeTable.back() == 2039);
 
 MEM_BSS_SRAMD1 static std::array<float, Reverb::kFIRSize> delay2_{};
 MEM_BSS_SRAMD1 static std::array<float, Reverb::kFIRSize> delay3_{};
 
+static constexpr Reverb::VelvetTaps MakeVelvetTaps(Noise& noise, uint32_t interval, bool flip) {
+    constexpr uint32_t kFIRSize = Reverb::kFIRSize;
+    Reverb::VelvetTaps taps;
+    uint32_t i = 0;
+    float count = 0.0f;
+    while (i < kFIRSize) {
+        float delta = noise.Next01() * interval;
+        int32_t ddelta = static_cast<int32_t>(delta);
+        uint32_t pos = i + ddelta;
+        if (pos < kFIRSize) {
+            if ((noise.Next() < 0.0f) != flip) {
+                taps.neg[taps.numNeg++] = pos;
+            }
+            else {
+                taps.pos[taps.numPos++] = pos;
+            }
+        }
+        count += 1.0f;
+        i += interval;
+    }
+    if (taps.numNeg + taps.numPos == 0) {
+        taps.numPos = 1;
+        taps.pos[0] = 1;
+        count = 1.0f;
+    }
+    taps.gain = static_cast<float>(1.0 / utli::ConstSqrt(count));
+    return taps;
+}
+
+static constexpr void MakeDelayLens(Noise& noise, float size, float* lens) {
+    auto iMinIdx = static_cast<uint32_t>(size * (kPrimeTable.size() - 7));
+    auto iMaxIdx = kPrimeTable.size() - 7;
+    for (uint32_t k = 0; k < Reverb::kNumLines; ++k) {
+        auto idx = static_cast<uint32_t>(iMinIdx + noise.Next01() * static_cast<double>(iMaxIdx - iMinIdx));
+        lens[k] = kPrimeTable[idx + k];
+    }
+}
+
+namespace {
+struct DefaultState {
+    Reverb::VelvetTaps velvet[4];
+    float delayLen[Reverb::kNumLines];
+    float decay[Reverb::kNumLines];
+    uint32_t noiseReg;
+};
+}
+
+// 默认参数下的velvet抽头, FDN长度和衰减, 和运行时调用 NewVelvetNoise/SetSize/SetDecayTime 的结果相同
+static constexpr DefaultState kDefaultState = [] {
+    DefaultState state{};
+    Noise noise;
+    noise.SetSeed(0);
+    state.velvet[0] = MakeVelvetTaps(noise, Reverb::kDefaultInterval, false);
+    state.velvet[1] = MakeVelvetTaps(noise, Reverb::kDefaultInterval, true);
+    state.velvet[2] = MakeVelvetTaps(noise, Reverb::kDefaultInterval, false);
+    state.velvet[3] = MakeVelvetTaps(noise, Reverb::kDefaultInterval, true);
+    MakeDelayLens(noise, Reverb::kDefaultSize, state.delayLen);
+    const double mul = 1.0 / (Reverb::kDefaultSampleRate * Reverb::kDefaultDecayMs / 1000.0);
+    for (uint32_t k = 0; k < Reverb::kNumLines; ++k) {
+        state.decay[k] = static_cast<float>(utli::ConstPow10(-state.delayLen[k] * mul));
+    }
+    state.noiseReg = noise.GetReg();
+    return state;
+}();
+
 void Reverb::Init(uint32_t sampleRate) {
     sampleRate_ = sampleRate;
     noise_.Init(sampleRate);
@@ -24,7 +118,6 @@ void Reverb::Init(uint32_t sampleRate) {
     combAllpass6_.SetAlpha(0.4f);
     combAllpass7_.SetAlpha(0.4f);
     combAllpass8_.SetAlpha(0.4f);
-    velvetInterval_ = 128;
     lowpass1_.Init(sampleRate);
     lowpass2_.Init(sampleRate);
     lowpass3_.Init(sampleRate);
@@ -33,124 +126,57 @@ void Reverb::Init(uint32_t sampleRate) {
     lowpass6_.Init(sampleRate);
     lowpass7_.Init(sampleRate);
     lowpass8_.Init(sampleRate);
+
+    // 直接使用编译期生成的默认状态, 启动时参数回调的值相同时不再计算
+    velvetInterval_ = kDefaultInterval;
+    earlyReflectionSize_ = kFIRSize;
+    velvet1L_ = kDefaultState.velvet[0];
+    velvet1R_ = kDefaultState.velvet[1];
+    velvet2L_ = kDefaultState.velvet[2];
+    velvet2R_ = kDefaultState.velvet[3];
+    size_ = kDefaultSize;
+    delay1Len_ = kDefaultState.delayLen[0];
+    delay2Len_ = kDefaultState.delayLen[1];
+    delay3Len_ = kDefaultState.delayLen[2];
+    delay4Len_ = kDefaultState.delayLen[3];
+    delay5Len_ = kDefaultState.delayLen[4];
+    delay6Len_ = kDefaultState.delayLen[5];
+    delay7Len_ = kDefaultState.delayLen[6];
+    delay8Len_ = kDefaultState.delayLen[7];
+    noise_.SetSeed(kDefaultState.noiseReg);
+    decayMs_ = kDefaultDecayMs;
+    if (sampleRate == kDefaultSampleRate) {
+        decay1_ = kDefaultState.decay[0];
+        decay2_ = kDefaultState.decay[1];
+        decay3_ = kDefaultState.decay[2];
+        decay4_ = kDefaultState.decay[3];
+        decay5_ = kDefaultState.decay[4];
+        decay6_ = kDefaultState.decay[5];
+        decay7_ = kDefaultState.decay[6];
+        decay8_ = kDefaultState.decay[7];
+    }
+    else {
+        UpdateDecay();
+    }
+}
+
+void Reverb::SetTapDecimation(uint32_t stride) {
+    tapStride_ = std::max(stride, 1u);
+    // 抽头减少后能量按抽头数补偿
+    tapGain_ = std::sqrt(static_cast<float>(tapStride_));
 }
 
 void Reverb::NewVelvetNoise(uint32_t interval) {
+    if (interval == velvetInterval_) return;
     velvetInterval_ = interval;
+    GenerateVelvet();
+}
 
-    // velvet 1
-    {
-        numDelay1NegTaps_ = 0;
-        numDelay1PosTaps_ = 0;
-        numDelay2NegTaps_ = 0;
-        numDelay2PosTaps_ = 0;
-    
-        uint32_t i = 0;
-        gain1_ = 0;
-        while (i < kFIRSize) {
-            float delta = noise_.Next01() * interval;
-            int32_t ddelta = static_cast<int32_t>(delta);
-            int32_t pos = i + ddelta;
-            if (pos < kFIRSize) {
-                if (noise_.Next() < 0.0f) {
-                    delay1NegTaps_[numDelay1NegTaps_++] = pos;
-                }
-                else {
-                    delay1PosTaps_[numDelay1PosTaps_++] = pos;
-                }
-            }
-            gain1_ += 1.0f;
-            i += interval;
-        }
-        
-        i = 0;
-        gain2_ = 0;
-        while (i < kFIRSize) {
-            float delta = noise_.Next01() * interval;
-            int32_t ddelta = static_cast<int32_t>(delta);
-            int32_t pos = i + ddelta;
-            if (pos < kFIRSize) {
-                if (noise_.Next() < 0.0f) {
-                    delay2PosTaps_[numDelay2PosTaps_++] = pos;
-                }
-                else {
-                    delay2NegTaps_[numDelay2NegTaps_++] = pos;
-                }
-            }
-            gain2_ += 1.0f;
-            i += interval;
-        }
-    
-        if (numDelay1NegTaps_ + numDelay1PosTaps_ == 0) {
-            numDelay1PosTaps_ = 1;
-            delay1PosTaps_[0] = 1;
-            gain1_ = 1.0f;
-        }
-        if (numDelay2NegTaps_ + numDelay2PosTaps_ == 0) {
-            numDelay2PosTaps_ = 1;
-            delay2PosTaps_[0] = 1;
-            gain2_ = 1.0f;
-        }
-        gain1_ = 1.0f / std::sqrt(static_cast<float>(gain1_));
-        gain2_ = 1.0f / std::sqrt(static_cast<float>(gain2_));
-    }
-    
-    // velvet 2
-    {
-        numDelay1NegTaps2_ = 0;
-        numDelay1PosTaps2_ = 0;
-        numDelay2NegTaps2_ = 0;
-        numDelay2PosTaps2_ = 0;
-    
-        uint32_t i = 0;
-        gain12_ = 0;
-        while (i < kFIRSize) {
-            float delta = noise_.Next01() * interval;
-            int32_t ddelta = static_cast<int32_t>(delta);
-            int32_t pos = i + ddelta;
-            if (pos < kFIRSize) {
-                if (noise_.Next() < 0.0f) {
-                    delay1NegTaps2_[numDelay1NegTaps2_++] = pos;
-                }
-                else {
-                    delay1PosTaps2_[numDelay1PosTaps2_++] = pos;
-                }
-            }
-            gain12_ += 1.0f;
-            i += interval;
-        }
-        
-        i = 0;
-        gain22_ = 0;
-        while (i < kFIRSize) {
-            float delta = noise_.Next01() * interval;
-            int32_t ddelta = static_cast<int32_t>(delta);
-            int32_t pos = i + ddelta;
-            if (pos < kFIRSize) {
-                if (noise_.Next() < 0.0f) {
-                    delay2PosTaps2_[numDelay2PosTaps2_++] = pos;
-                }
-                else {
-                    delay2NegTaps2_[numDelay2NegTaps2_++] = pos;
-                }
-            }
-            gain22_ += 1.0f;
-            i += interval;
-        }
-    
-        if (numDelay1NegTaps2_ + numDelay1PosTaps2_ == 0) {
-            numDelay1PosTaps2_ = 1;
-            delay1PosTaps2_[0] = 1;
-            gain12_ = 1.0f;
-        }
-        if (numDelay2NegTaps2_ + numDelay2PosTaps2_ == 0) {
-            numDelay2PosTaps2_ = 1;
-            delay2PosTaps2_[0] = 1;
-            gain22_ = 1.0f;
-        }
-        gain12_ = 1.0f / std::sqrt(static_cast<float>(gain12_));
-        gain22_ = 1.0f / std::sqrt(static_cast<float>(gain22_));
-    }
+void Reverb::GenerateVelvet() {
+    velvet1L_ = MakeVelvetTaps(noise_, velvetInterval_, false);
+    velvet1R_ = MakeVelvetTaps(noise_, velvetInterval_, true);
+    velvet2L_ = MakeVelvetTaps(noise_, velvetInterval_, false);
+    velvet2R_ = MakeVelvetTaps(noise_, velvetInterval_, true);
 }
 
 void Reverb::SetEarlyReflectionSize(float size) {
@@ -158,23 +184,24 @@ void Reverb::SetEarlyReflectionSize(float size) {
     if (iSize > kFIRSize) iSize = kFIRSize;
     if (earlyReflectionSize_ != iSize) {
         earlyReflectionSize_ = iSize;
-        NewVelvetNoise(velvetInterval_);
+        GenerateVelvet();
     }
 }
 
 void Reverb::SetSize(float size) {
-    auto fminIdx = size * (kPrimeTable.size() - 7);
-    auto iMinIdx = static_cast<uint32_t>(fminIdx);
-    auto iMaxIdx = kPrimeTable.size() - 7;
-    delay1Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01()))];
-    delay2Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 1];
-    delay3Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 2];
-    delay4Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 3];
-    delay5Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 4];
-    delay6Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 5];
-    delay7Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 6];
-    delay8Len_ = kPrimeTable[static_cast<uint32_t>(std::lerp(iMinIdx, iMaxIdx, noise_.Next01())) + 7];
-    SetDecayTime(decayMs_);
+    if (size == size_) return;
+    size_ = size;
+    float lens[kNumLines];
+    MakeDelayLens(noise_, size, lens);
+    delay1Len_ = lens[0];
+    delay2Len_ = lens[1];
+    delay3Len_ = lens[2];
+    delay4Len_ = lens[3];
+    delay5Len_ = lens[4];
+    delay6Len_ = lens[5];
+    delay7Len_ = lens[6];
+    delay8Len_ = lens[7];
+    UpdateDecay();
 }
 
 void Reverb::SetModulationDepth(float depth) {
@@ -190,15 +217,34 @@ void Reverb::SetChrousRate(float rate) {
     latchAlpha_ = rate;
 }
 
+namespace {
+struct FloatWriter {
+    std::span<float> left;
+    std::span<float> right;
+    void Write(uint32_t i, float l, float r) {
+        left[i] = l;
+        right[i] = r;
+    }
+};
+}
+
 void Reverb::Process(std::span<float> buffer, std::span<float> auxBuffer) {
-    float noise1 = noise_.Lowpassed01();
-    float noise2 = noise_.Lowpassed01();
-    float noise3 = noise_.Lowpassed01();
-    float noise4 = noise_.Lowpassed01();
-    float noise5 = noise_.Lowpassed01();
-    float noise6 = noise_.Lowpassed01();
-    float noise7 = noise_.Lowpassed01();
-    float noise8 = noise_.Lowpassed01();
+    FloatWriter writer{ buffer, auxBuffer };
+    Process(std::span<const float>{ buffer }, writer);
+}
+
+template<class Output>
+void Reverb::Process(std::span<const float> buffer, Output& output) {
+    float noise[8];
+    modNoise_.FillLowpassed01(noise);
+    float noise1 = noise[0];
+    float noise2 = noise[1];
+    float noise3 = noise[2];
+    float noise4 = noise[3];
+    float noise5 = noise[4];
+    float noise6 = noise[5];
+    float noise7 = noise[6];
+    float noise8 = noise[7];
     for (uint32_t i = 0; i < buffer.size(); ++i) {
         // velvet fir, generate lost of impluse 
         float earlyReflectionsOut1 = 0.0f;
@@ -206,27 +252,27 @@ void Reverb::Process(std::span<float> buffer, std::span<float> auxBuffer) {
         {
             auto delay1In = buffer[i];
             delay1_[delay1WritePos_] = delay1In;
-            for (uint32_t i = 0; i < numDelay1NegTaps_; ++i) {
-                uint32_t idx = (delay1WritePos_ - delay1NegTaps_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet1L_.numNeg; i += tapStride_) {
+                uint32_t idx = (delay1WritePos_ - velvet1L_.neg[i]) & kDelayMask;
                 earlyReflectionsOut1 -= delay1_[idx];
             }
-            for (uint32_t i = 0; i < numDelay1PosTaps_; ++i) {
-                uint32_t idx = (delay1WritePos_ - delay1PosTaps_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet1L_.numPos; i += tapStride_) {
+                uint32_t idx = (delay1WritePos_ - velvet1L_.pos[i]) & kDelayMask;
                 earlyReflectionsOut1 += delay1_[idx];
             }
-            for (uint32_t i = 0; i < numDelay2NegTaps_; ++i) {
-                uint32_t idx = (delay1WritePos_ - delay2NegTaps_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet1R_.numNeg; i += tapStride_) {
+                uint32_t idx = (delay1WritePos_ - velvet1R_.neg[i]) & kDelayMask;
                 earlyReflectionsOut2 -= delay1_[idx];
             }
-            for (uint32_t i = 0; i < numDelay2PosTaps_; ++i) {
-                uint32_t idx = (delay1WritePos_ - delay2PosTaps_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet1R_.numPos; i += tapStride_) {
+                uint32_t idx = (delay1WritePos_ - velvet1R_.pos[i]) & kDelayMask;
                 earlyReflectionsOut2 += delay1_[idx];
             }
             ++delay1WritePos_;
             delay1WritePos_ &= kDelayMask;
 
-            earlyReflectionsOut1 *= gain1_;
-            earlyReflectionsOut2 *= gain2_;
+            earlyReflectionsOut1 *= velvet1L_.gain * tapGain_;
+            earlyReflectionsOut2 *= velvet1R_.gain * tapGain_;
         }
         {
             auto w = quadOscU_ - k1_ * quadOscV_;
@@ -240,31 +286,31 @@ void Reverb::Process(std::span<float> buffer, std::span<float> auxBuffer) {
         {
             delay2_[delay1WritePos2_] = earlyReflectionsOut1;
             earlyReflectionsOut1 = 0;
-            for (uint32_t i = 0; i < numDelay1NegTaps2_; ++i) {
-                uint32_t idx = (delay1WritePos2_ - delay1NegTaps2_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet2L_.numNeg; i += tapStride_) {
+                uint32_t idx = (delay1WritePos2_ - velvet2L_.neg[i]) & kDelayMask;
                 earlyReflectionsOut1 -= delay2_[idx];
             }
-            for (uint32_t i = 0; i < numDelay1PosTaps2_; ++i) {
-                uint32_t idx = (delay1WritePos2_ - delay1PosTaps2_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet2L_.numPos; i += tapStride_) {
+                uint32_t idx = (delay1WritePos2_ - velvet2L_.pos[i]) & kDelayMask;
                 earlyReflectionsOut1 += delay2_[idx];
             }
             ++delay1WritePos2_;
             delay1WritePos2_ &= kDelayMask;
-            earlyReflectionsOut1 *= gain12_;
+            earlyReflectionsOut1 *= velvet2L_.gain * tapGain_;
 
             delay3_[delay1WritePos3_] = earlyReflectionsOut2;
             earlyReflectionsOut2 = 0;
-            for (uint32_t i = 0; i < numDelay2NegTaps2_; ++i) {
-                uint32_t idx = (delay1WritePos3_ - delay2NegTaps2_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet2R_.numNeg; i += tapStride_) {
+                uint32_t idx = (delay1WritePos3_ - velvet2R_.neg[i]) & kDelayMask;
                 earlyReflectionsOut2 -= delay3_[idx];
             }
-            for (uint32_t i = 0; i < numDelay2PosTaps2_; ++i) {
-                uint32_t idx = (delay1WritePos3_ - delay2PosTaps2_[i]) & kDelayMask;
+            for (uint32_t i = 0; i < velvet2R_.numPos; i += tapStride_) {
+                uint32_t idx = (delay1WritePos3_ - velvet2R_.pos[i]) & kDelayMask;
                 earlyReflectionsOut2 += delay3_[idx];
             }
             ++delay1WritePos3_;
             delay1WritePos3_ &= kDelayMask;
-            earlyReflectionsOut2 *= gain22_;
+            earlyReflectionsOut2 *= velvet2R_.gain * tapGain_;
         }
         // input
         auto in1 = earlyReflectionsOut1;
@@ -332,11 +378,13 @@ void Reverb::Process(std::span<float> buffer, std::span<float> auxBuffer) {
         auto leftOut = line1;
         auto rightOut = line3;
         auto s = buffer[i];
-        buffer[i] = std::lerp(s, leftOut, dryWet_);
-        auxBuffer[i] = std::lerp(s, rightOut, dryWet_);
+        // std::lerp 每个采样都要做端点检查, 这里不需要
+        output.Write(i, s + dryWet_ * (leftOut - s), s + dryWet_ * (rightOut - s));
     }
 }
 
+template void Reverb::Process<PcmWriter>(std::span<const float>, PcmWriter&);
+
 void Reverb::SetQuadOscRate(float freq) {
     auto theta = freq / sampleRate_ * std::numbers::pi_v<float> * 2.0f;
     k1_ = std::tan(theta / 2.0f);
@@ -355,16 +403,21 @@ void Reverb::SetLowpassFreq(float freq) {
 }
 
 void Reverb::SetDecayTime(float ms) {
+    if (ms == decayMs_) return;
     decayMs_ = ms;
-    auto mul = 1.0f / (static_cast<float>(sampleRate_) * ms / 1000.0f);
-    decay1_ = std::pow(10.0f, -(static_cast<float>(delay1Len_ * mul)));
-    decay2_ = std::pow(10.0f, -(static_cast<float>(delay2Len_ * mul)));
-    decay3_ = std::pow(10.0f, -(static_cast<float>(delay3Len_ * mul)));
-    decay4_ = std::pow(10.0f, -(static_cast<float>(delay4Len_ * mul)));
-    decay5_ = std::pow(10.0f, -(static_cast<float>(delay5Len_ * mul)));
-    decay6_ = std::pow(10.0f, -(static_cast<float>(delay6Len_ * mul)));
-    decay7_ = std::pow(10.0f, -(static_cast<float>(delay7Len_ * mul)));
-    decay8_ = std::pow(10.0f, -(static_cast<float>(delay8Len_ * mul)));
+    UpdateDecay();
 }
 
-}
\ No newline at end of file
+void Reverb::UpdateDecay() {
+    auto mul = 1.0f / (static_cast<float>(sampleRate_) * decayMs_ / 1000.0f);
+    decay1_ = fastmath::Pow10(-(static_cast<float>(delay1Len_ * mul)));
+    decay2_ = fastmath::Pow10(-(static_cast<float>(delay2Len_ * mul)));
+    decay3_ = fastmath::Pow10(-(static_cast<float>(delay3Len_ * mul)));
+    decay4_ = fastmath::Pow10(-(static_cast<float>(delay4Len_ * mul)));
+    decay5_ = fastmath::Pow10(-(static_cast<float>(delay5Len_ * mul)));
+    decay6_ = fastmath::Pow10(-(static_cast<float>(delay6Len_ * mul)));
+    decay7_ = fastmath::Pow10(-(static_cast<float>(delay7Len_ * mul)));
+    decay8_ = fastmath::Pow10(-(static_cast<float>(delay8Len_ * mul)));
+}
+
+}
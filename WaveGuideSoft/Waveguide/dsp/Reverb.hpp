@@ -3,6 +3,7 @@
 #include <span>
 #include <cstdint>
 #include "Noise.hpp"
+#include "BlockNoise.hpp"
 #include "DelayLine.hpp"
 #include "OnePoleFilter.hpp"
 #include "CombAllpass.hpp"
@@ -14,55 +15,71 @@ public:
     static constexpr uint32_t kFIRSize = 2048;
     static constexpr uint32_t kDelayMask = kFIRSize - 1;
     static constexpr uint32_t kTapSize = kFIRSize / 64;
+    static constexpr uint32_t kNumLines = 8;
+    // 启动时的状态在编译期按这些值生成, 与 params.hpp 的默认值一致
+    // 不一致时只是启动时多算一次
+    static constexpr uint32_t kDefaultSampleRate = 48000;
+    static constexpr uint32_t kDefaultInterval = 128;
+    static constexpr float kDefaultSize = 0.7f;
+    static constexpr float kDefaultDecayMs = 1500.0f;
+
+    struct VelvetTaps {
+        std::array<uint32_t, kTapSize> pos{};
+        uint32_t numPos{};
+        std::array<uint32_t, kTapSize> neg{};
+        uint32_t numNeg{};
+        float gain{};
+    };
 
     void Init(uint32_t sampleRate);
     void Process(std::span<float> buffer, std::span<float> auxBuffer);
+    /**
+     * @brief 混响的输出直接交给下一级, 不写回中间缓冲
+     * Output 提供 Write(uint32_t i, float left, float right), 在Reverb.cpp中显式实例化
+     */
+    template<class Output>
+    void Process(std::span<const float> buffer, Output& output);
     
     void SetQuadOscRate(float freq);
     void SetLowpassFreq(float freq);
     void SetDecayTime(float ms);
     void NewVelvetNoise(uint32_t interval);
+    // 调制噪声和voice的噪声用不同的stream
+    void SetNoiseStream(uint32_t stream) { modNoise_.SetSeed(0, stream); }
     void SetEarlyReflectionSize(float size);
     void SetSize(float size);
     void SetModulationDepth(float depth);
     void SetDryWet(float drywet);
     void SetChrousRate(float rate);
     void SetChrousDepth(float depth) { chrousDepth_ = depth; }
+    // 每隔stride个抽头取一个, governor降级用
+    void SetTapDecimation(uint32_t stride);
 private:
+    void GenerateVelvet();
+    void UpdateDecay();
+
     uint32_t sampleRate_ = 0;
     
     // velvet 1
     std::array<float, kFIRSize> delay1_{};
     uint32_t delay1WritePos_ = 0;
-    std::array<uint32_t, kTapSize> delay1PosTaps_{};
-    uint32_t numDelay1PosTaps_ = 0;
-    std::array<uint32_t, kTapSize> delay1NegTaps_{};
-    uint32_t numDelay1NegTaps_ = 0;
-    std::array<uint32_t, kTapSize> delay2PosTaps_{};
-    uint32_t numDelay2PosTaps_ = 0;
-    std::array<uint32_t, kTapSize> delay2NegTaps_{};
-    uint32_t numDelay2NegTaps_ = 0;
-    float gain1_{};
-    float gain2_{};
+    VelvetTaps velvet1L_;
+    VelvetTaps velvet1R_;
 
     // velvet 2
     uint32_t delay1WritePos2_ = 0;
     uint32_t delay1WritePos3_ = 0;
-    std::array<uint32_t, kTapSize> delay1PosTaps2_{};
-    uint32_t numDelay1PosTaps2_ = 0;
-    std::array<uint32_t, kTapSize> delay1NegTaps2_{};
-    uint32_t numDelay1NegTaps2_ = 0;
-    std::array<uint32_t, kTapSize> delay2PosTaps2_{};
-    uint32_t numDelay2PosTaps2_ = 0;
-    std::array<uint32_t, kTapSize> delay2NegTaps2_{};
-    uint32_t numDelay2NegTaps2_ = 0;
-    float gain12_{};
-    float gain22_{};
+    VelvetTaps velvet2L_;
+    VelvetTaps velvet2R_;
     
+    uint32_t tapStride_ = 1;
+    float tapGain_ = 1.0f;
+
     uint32_t earlyReflectionSize_ = 0;
     uint32_t velvetInterval_ = 0;
 
     Noise noise_;
+    BlockNoise modNoise_;
     CombAllpass combAllpass1_;
     CombAllpass combAllpass2_;
     CombAllpass combAllpass3_;
@@ -90,6 +107,7 @@ private:
     float latchAlpha_{};
     float dryWet_{};
     float decayMs_{};
+    float size_{};
 
     float quadOscV_{};
     float quadOscU_{ 1.0f };
@@ -15,17 +15,19 @@ ThreadSafeCallback::Proxy ThreadSafeCallback::NewProxy() {
     return ThreadSafeCallback::Proxy{ *this, proxyCounter_++ };
 }
 
-void ThreadSafeCallback::HandleDirtyCallbacks() {
+uint32_t ThreadSafeCallback::HandleDirtyCallbacks() {
     lock();
-    lastDown_ = down_;
-    lastUp_ = up_;
-    down_ = 0;
-    up_ = 0;
-    lastDown2_ = down2_;
-    lastUp2_ = up2_;
-    down2_ = 0;
-    up2_ = 0;
+    lastDown_ = down_ & ~deferDown_;
+    lastUp_ = up_ & ~deferUp_;
+    down_ &= deferDown_;
+    up_ &= deferUp_;
+    lastDown2_ = down2_ & ~deferDown2_;
+    lastUp2_ = up2_ & ~deferUp2_;
+    down2_ &= deferDown2_;
+    up2_ &= deferUp2_;
     unlock();
+    uint32_t numDirty = __builtin_popcountl(lastDown_) + __builtin_popcountl(lastUp_)
+                      + __builtin_popcountl(lastDown2_) + __builtin_popcountl(lastUp2_);
     while (lastDown_) {
         auto index = __builtin_ctzl(lastDown_);
         if (callbacks_[index] != nullptr) {
@@ -57,6 +59,7 @@ void ThreadSafeCallback::HandleDirtyCallbacks() {
         }
         lastUp2_ &= ~(kOne << index);
     }
+    return numDirty;
 }
 
 void ThreadSafeCallback::MarkDirty(uint32_t index) {
@@ -77,6 +80,20 @@ void ThreadSafeCallback::MarkAll() {
     unlock();
 }
 
+void ThreadSafeCallback::SetDeferred(uint32_t begin, uint32_t end, bool deferred) {
+    lock();
+    for (uint32_t index = begin; index < end; ++index) {
+        MarkType* mask = index < kNumBits ? &deferDown_
+                       : index < kNumBits * 2 ? &deferUp_
+                       : index < kNumBits * 3 ? &deferDown2_
+                       : &deferUp2_;
+        MarkType bit = kOne << (index % kNumBits);
+        if (deferred) *mask |= bit;
+        else *mask &= ~bit;
+    }
+    unlock();
+}
+
 uint32_t ThreadSafeCallback::GetProxyCounter() {
     return proxyCounter_;
 }
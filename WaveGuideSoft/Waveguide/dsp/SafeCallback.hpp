@@ -18,6 +18,11 @@ struct ThreadSafeCallback {
     MarkType up2_{};
     MarkType lastDown2_{};
     MarkType lastUp2_{};
+    // 被推迟的回调保持dirty, 不触发, 恢复后在下一次 HandleDirtyCallbacks 触发
+    MarkType deferDown_{};
+    MarkType deferUp_{};
+    MarkType deferDown2_{};
+    MarkType deferUp2_{};
 
     void lock();
     void unlock();
@@ -41,9 +46,12 @@ struct ThreadSafeCallback {
         }
     };
     [[nodiscard]] Proxy NewProxy();
-    void HandleDirtyCallbacks();
+    // 返回本次触发的回调数
+    uint32_t HandleDirtyCallbacks();
     void MarkDirty(uint32_t index);
     void MarkAll();
+    // [begin, end) 的回调, 用于还没有初始化的乐器
+    void SetDeferred(uint32_t begin, uint32_t end, bool deferred);
     uint32_t GetProxyCounter();
 };
 
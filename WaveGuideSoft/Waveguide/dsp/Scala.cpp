@@ -0,0 +1,174 @@
+#include "Scala.hpp"
+#include "Note.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+
+namespace dsp::scala {
+
+static constexpr auto npos = std::string_view::npos;
+
+// 取下一个非注释行, 去掉首尾空白
+static bool NextLine(std::string_view& text, std::string_view& line) {
+    while (!text.empty()) {
+        auto end = text.find('\n');
+        line = text.substr(0, end);
+        text = end == npos ? std::string_view{} : text.substr(end + 1);
+        if (!line.empty() && line.front() == '!') continue;
+        auto begin = line.find_first_not_of(" \t\r");
+        if (begin == npos) {
+            line = {};
+        }
+        else {
+            line = line.substr(begin, line.find_last_not_of(" \t\r") - begin + 1);
+        }
+        return true;
+    }
+    return false;
+}
+
+// 同上, 跳过空行
+static bool NextValue(std::string_view& text, std::string_view& line) {
+    while (NextLine(text, line)) {
+        if (!line.empty()) return true;
+    }
+    return false;
+}
+
+// 数值后面可以跟注释
+static std::string_view FirstToken(std::string_view line) {
+    return line.substr(0, line.find_first_of(" \t"));
+}
+
+template<class T>
+static bool ParseInt(std::string_view token, T& value) {
+    auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value);
+    return ec == std::errc{} && ptr == token.data() + token.size();
+}
+
+static bool ParseFloat(std::string_view token, float& value) {
+    char buffer[32];
+    if (token.empty() || token.size() >= sizeof(buffer)) return false;
+    std::copy(token.begin(), token.end(), buffer);
+    buffer[token.size()] = '\0';
+    char* end;
+    value = std::strtof(buffer, &end);
+    return end == buffer + token.size();
+}
+
+// 带小数点的是音分, 否则是 "3/2" 或 "2" 这样的比例
+static bool ParsePitch(std::string_view token, float& cents) {
+    if (token.find('.') != npos) {
+        return ParseFloat(token, cents);
+    }
+    auto slash = token.find('/');
+    int64_t num = 0;
+    int64_t den = 1;
+    if (!ParseInt(token.substr(0, slash), num)) return false;
+    if (slash != npos && !ParseInt(token.substr(slash + 1), den)) return false;
+    if (num <= 0 || den <= 0) return false;
+    cents = static_cast<float>(1200.0 * std::log2(static_cast<double>(num) / static_cast<double>(den)));
+    return true;
+}
+
+static int32_t FloorDiv(int32_t a, int32_t b) {
+    int32_t q = a / b;
+    return (a % b != 0 && a < 0) ? q - 1 : q;
+}
+
+// 音级相对第0级的音分, 可以超出一个周期或者为负
+static double DegreeCents(const Scale& scale, int32_t degree) {
+    const int32_t n = scale.numDegrees;
+    int32_t period = FloorDiv(degree, n);
+    int32_t index = degree - period * n;
+    double cents = period * static_cast<double>(scale.cents[n - 1]);
+    if (index > 0) {
+        cents += scale.cents[index - 1];
+    }
+    return cents;
+}
+
+// 范围外或者没有映射的键返回false
+static bool KeyCents(const Scale& scale, const KeyboardMap& map, int32_t key, double& cents) {
+    if (key < map.firstNote || key > map.lastNote) return false;
+    const int32_t offset = key - map.middleNote;
+    if (map.size == 0) {
+        cents = DegreeCents(scale, offset);
+        return true;
+    }
+    const int32_t size = map.size;
+    const int32_t repeat = FloorDiv(offset, size);
+    const int32_t degree = map.degrees[offset - repeat * size];
+    if (degree < 0) return false;
+    const int32_t octave = map.octaveDegree == 0 ? scale.numDegrees : map.octaveDegree;
+    cents = repeat * DegreeCents(scale, octave) + DegreeCents(scale, degree);
+    return true;
+}
+
+bool ParseScale(std::string_view text, Scale& scale) {
+    std::string_view line;
+    // 第一行是描述, 可以为空
+    if (!NextLine(text, line)) return false;
+    uint32_t count = 0;
+    if (!NextValue(text, line) || !ParseInt(FirstToken(line), count)) return false;
+    if (count == 0 || count > kMaxDegrees) return false;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!NextValue(text, line) || !ParsePitch(FirstToken(line), scale.cents[i])) return false;
+    }
+    scale.numDegrees = count;
+    return scale.cents[count - 1] > 0.0f;
+}
+
+bool ParseKeyboardMap(std::string_view text, KeyboardMap& map) {
+    std::string_view line;
+    auto next = [&](auto& value) {
+        return NextValue(text, line) && ParseInt(FirstToken(line), value);
+    };
+    if (!next(map.size) || !next(map.firstNote) || !next(map.lastNote)
+        || !next(map.middleNote) || !next(map.referenceNote)) {
+        return false;
+    }
+    if (!NextValue(text, line) || !ParseFloat(FirstToken(line), map.referenceFreq)) return false;
+    if (!next(map.octaveDegree)) return false;
+    if (map.size > kNumNotes || map.referenceFreq <= 0.0f) return false;
+
+    // 映射可以比size短, 剩下的不映射
+    std::fill(std::begin(map.degrees), std::end(map.degrees), -1);
+    for (uint32_t i = 0; i < map.size && NextValue(text, line); ++i) {
+        auto token = FirstToken(line);
+        if (token == "x") continue;
+        if (!ParseInt(token, map.degrees[i]) || map.degrees[i] < 0) return false;
+    }
+    return true;
+}
+
+KeyboardMap DefaultKeyboardMap() {
+    KeyboardMap map{};
+    map.size = 0;
+    map.firstNote = 0;
+    map.lastNote = kNumNotes - 1;
+    map.middleNote = 60;
+    map.referenceNote = Note::kA4Midi;
+    map.referenceFreq = Note::kA4;
+    map.octaveDegree = 0;
+    return map;
+}
+
+bool GetFrequencies(const Scale& scale, const KeyboardMap& map, std::span<float, kNumNotes> freqs) {
+    double refCents = 0.0;
+    if (!KeyCents(scale, map, map.referenceNote, refCents)) return false;
+    // 延迟线长度不会超出voice能处理的范围
+    const float minFreq = Note::Midi2Frequency(0);
+    const float maxFreq = Note::Midi2Frequency(kNumNotes - 1);
+    for (uint32_t note = 0; note < kNumNotes; ++note) {
+        double cents = 0.0;
+        float freq = KeyCents(scale, map, note, cents)
+            ? static_cast<float>(map.referenceFreq * std::exp2((cents - refCents) / 1200.0))
+            : Note::Midi2Frequency(note);
+        freqs[note] = std::clamp(freq, minFreq, maxFreq);
+    }
+    return true;
+}
+
+}
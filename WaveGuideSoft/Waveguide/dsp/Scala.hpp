@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace dsp::scala {
+
+/**
+ * Scala的 .scl 音阶和 .kbm 键盘映射, 不依赖硬件
+ * CTuning 用它生成频率表, pctest/src/tools/TuningCheck 用它检查解析结果
+ */
+static constexpr uint32_t kNumNotes = 128;
+static constexpr uint32_t kMaxDegrees = 128;
+
+// .scl, 不含第0级(0音分), 最后一级是音阶的周期, 通常是八度
+struct Scale {
+    uint32_t numDegrees;
+    float cents[kMaxDegrees];
+};
+
+// .kbm
+struct KeyboardMap {
+    // 0 为线性映射, 每个键对应一个音级
+    uint32_t size;
+    int32_t firstNote;
+    int32_t lastNote;
+    // 映射的第一项对应的键
+    int32_t middleNote;
+    int32_t referenceNote;
+    float referenceFreq;
+    // 映射每重复一次升高的音级, 0为音阶的最后一级
+    uint32_t octaveDegree;
+    // -1 为不映射, 这些键和范围外的键按十二平均律
+    int32_t degrees[kNumNotes];
+};
+
+bool ParseScale(std::string_view text, Scale& scale);
+bool ParseKeyboardMap(std::string_view text, KeyboardMap& map);
+// Scala的默认映射, 60映射到第0级, 69为440Hz
+KeyboardMap DefaultKeyboardMap();
+/**
+ * @brief 算出每个音符的频率, 限制在十二平均律0~127的范围内
+ * @return 参考键没有映射时返回false, freqs 不变
+ */
+bool GetFrequencies(const Scale& scale, const KeyboardMap& map, std::span<float, kNumNotes> freqs);
+
+}
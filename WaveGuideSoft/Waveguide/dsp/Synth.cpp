@@ -1,6 +1,11 @@
 #include "Synth.hpp"
+#include <algorithm>
 #include "Note.hpp"
 #include "MemAttributes.hpp"
+#include "utli/Profiler.hpp"
+#include "PcmWriter.hpp"
+#include "ExciterBank.hpp"
+#include "Tuning.hpp"
 
 namespace dsp {
 
@@ -9,17 +14,17 @@ CSynthParams SynthParams;
 MEM_BSS_ITCM Reverb reverb_;
 
 void CSynth::Init(uint32_t sampleRate) {
+    sampleRate_ = sampleRate;
     DelayAllocator::Init();
-    string_.Init(sampleRate);
     BindParamsString(GetSynthParams());
-    reed_.Init(sampleRate);
     BindParamsFlute(GetSynthParams());
-    bowed_.Init(sampleRate);
     BindParamsBow(GetSynthParams());
     reverb_.Init(sampleRate);
     BindParamReverb(GetSynthParams());
     body_.Init(sampleRate);
     BindParamsBody(GetSynthParams());
+    BindParamsTuning(GetSynthParams());
+    Tuning.Init(sampleRate);
 
     for (uint32_t i = 0; i < string_.kNumPolyonic; ++i) {
         auto* delay1 = DelayAllocator::GetDelayLine();
@@ -27,9 +32,48 @@ void CSynth::Init(uint32_t sampleRate) {
         string_.GetNotes()[i].SetDelayLineRef(delay1, delay2);
         reed_.GetNotes()[i].SetDelayLineRef(delay1);
         bowed_.GetNotes()[i].SetDelayLineRef(delay1, delay2);
+        // 每个voice独立的噪声序列, 避免复音之间相关
+        reed_.GetNotes()[i].SetNoiseStream(i);
+        bowed_.GetNotes()[i].SetNoiseStream(i);
+    }
+    reverb_.SetNoiseStream(string_.kNumPolyonic);
+
+    // 每个乐器的参数在 CSynthParams 里是连续声明的, 回调的序号也是连续的
+    auto& p = GetSynthParams();
+    instrumentCallbacks_[static_cast<uint32_t>(Instrument::String)] = {
+        p.string.decay.callback_.index_, p.string.posAdd.callback_.index_ + 1
+    };
+    instrumentCallbacks_[static_cast<uint32_t>(Instrument::Reed)] = {
+        p.reed.inhalling.callback_.index_, p.reed.blendAdd.callback_.index_ + 1
+    };
+    instrumentCallbacks_[static_cast<uint32_t>(Instrument::Bow)] = {
+        p.bow.bowPos.callback_.index_, p.bow.lossOutHigh.callback_.index_ + 1
+    };
+    for (auto& range : instrumentCallbacks_) {
+        gSafeCallback.SetDeferred(range.begin, range.end, true);
     }
 }
 
+void CSynth::PrepareInstrument() {
+    const auto id = static_cast<uint32_t>(instrument_);
+    if (instrumentReady_[id]) return;
+    instrumentReady_[id] = true;
+    switch (instrument_) {
+    case Instrument::Bow:
+        bowed_.Init(sampleRate_);
+        break;
+    case Instrument::Reed:
+        reed_.Init(sampleRate_);
+        break;
+    case Instrument::String:
+        ExciterBank::Init(sampleRate_);
+        string_.Init(sampleRate_);
+        break;
+    }
+    // 推迟的参数回调在接下来的 HandleDirtyCallbacks 中触发
+    gSafeCallback.SetDeferred(instrumentCallbacks_[id].begin, instrumentCallbacks_[id].end, false);
+}
+
 void CSynth::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
     switch (instrument_) {
     case Instrument::Bow:
@@ -44,6 +88,43 @@ void CSynth::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
     }
 }
 
+void CSynth::NoteOn(uint8_t channel, const NotePlan& plan) {
+    switch (plan.instrument) {
+    case Instrument::Bow:
+        bowed_.NoteOn(channel, plan.bow);
+        break;
+    case Instrument::Reed:
+        reed_.NoteOn(channel, plan.reed);
+        break;
+    case Instrument::String:
+        string_.NoteOn(channel, plan.string);
+        break;
+    }
+}
+
+void CSynth::PlanNote(NoteEvent& e) {
+    auto& plan = e.plan;
+    // 只读一次, 乐器可能同时被切换
+    const auto instrument = instrument_;
+    plan.instrument = Instrument::kNumInstruments;
+    if (!instrumentReady_[static_cast<uint32_t>(instrument)]) return;
+
+    const float velocity = e.velocity / 127.0f;
+    const auto sampleRate = static_cast<float>(sampleRate_);
+    switch (instrument) {
+    case Instrument::Bow:
+        Bowed::PlanNote(plan.bow, e.note, velocity, sampleRate);
+        break;
+    case Instrument::Reed:
+        Reed::PlanNote(plan.reed, e.note, velocity, sampleRate);
+        break;
+    case Instrument::String:
+        PluckString::PlanNote(plan.string, e.note, velocity, sampleRate);
+        break;
+    }
+    plan.instrument = instrument;
+}
+
 void CSynth::NoteOff(uint8_t note) {
     switch (instrument_) {
     case Instrument::Bow:
@@ -59,19 +140,118 @@ void CSynth::NoteOff(uint8_t note) {
 }
 
 void CSynth::Process(std::span<float> buffer, std::span<float> auxBuffer) {
+    PrepareInstrument();
+    ProcessVoices(buffer, auxBuffer);
+    ProcessEffects(buffer, auxBuffer);
+}
+
+void CSynth::Process(std::span<float> buffer, std::span<float> auxBuffer,
+                     std::span<const NoteEvent> events, uint32_t blockTime) {
+    PrepareInstrument();
+    RenderVoices(buffer, auxBuffer, events, blockTime);
+    ProcessEffects(buffer, auxBuffer);
+}
+
+void CSynth::Process(std::span<float> buffer, std::span<const NoteEvent> events,
+                     uint32_t blockTime, PcmWriter& output) {
+    // 乐器可能在回调处理之后被GUI切换, 这里再检查一次, 参数在下一个block生效
+    PrepareInstrument();
+    // voice都是单声道, 不会写aux
+    RenderVoices(buffer, buffer, events, blockTime);
+    if (!IsBodyCommuted()) {
+        PROFILE_SCOPE(utli::ProfileStage::kBody);
+        body_.Process(buffer, buffer);
+    }
+    {
+        // 混响、音量和PCM转换在同一个循环里, 都计入 kReverb
+        PROFILE_SCOPE(utli::ProfileStage::kReverb);
+        reverb_.Process(std::span<const float>{ buffer }, output);
+    }
+}
+
+void CSynth::RenderVoices(std::span<float> buffer, std::span<float> auxBuffer,
+                          std::span<const NoteEvent> events, uint32_t blockTime) {
+    const auto size = static_cast<int32_t>(buffer.size());
+    int32_t pos = 0;
+    for (const auto& e : events) {
+        auto offset = static_cast<int32_t>(e.time - blockTime);
+        offset = std::clamp(offset, pos, size);
+        if (offset > pos) {
+            ProcessVoices(buffer.subspan(pos, offset - pos), auxBuffer.subspan(pos, offset - pos));
+            pos = offset;
+        }
+        PROFILE_SCOPE(utli::ProfileStage::kNoteEvents);
+        if (e.velocity > 0 && e.plan.instrument == instrument_) {
+            NoteOn(e.channel, e.plan);
+        }
+        else if (e.velocity > 0) {
+            NoteOn(e.channel, e.note, e.velocity);
+        }
+        else {
+            NoteOff(e.note);
+        }
+    }
+    if (pos < size) {
+        ProcessVoices(buffer.subspan(pos), auxBuffer.subspan(pos));
+    }
+}
+
+void CSynth::SetQualityLevel(uint32_t level) {
+    if (level == qualityLevel_) return;
+    qualityLevel_ = level;
+
+    for (auto& note : string_.GetNotes()) {
+        note.SetReducedQuality(level >= 1);
+    }
+    reverb_.SetTapDecimation(level >= 2 ? 2 : 1);
+    body_.SetNumPartitions(level >= 3 ? 2 : Body::kNumPartitions);
+    uint32_t maxVoices = level >= 4 ? kMaxVoicesReduced : PolySynth<PluckString>::kNumPolyonic;
+    string_.SetMaxVoices(maxVoices);
+    bowed_.SetMaxVoices(maxVoices);
+    reed_.SetMaxVoices(maxVoices);
+}
+
+void CSynth::ProcessEffects(std::span<float> buffer, std::span<float> auxBuffer) {
+    if (!IsBodyCommuted()) {
+        PROFILE_SCOPE(utli::ProfileStage::kBody);
+        body_.Process(buffer, auxBuffer);
+    }
+    {
+        PROFILE_SCOPE(utli::ProfileStage::kReverb);
+        reverb_.Process(buffer, auxBuffer);
+    }
+}
+
+void CSynth::ProcessVoices(std::span<float> buffer, std::span<float> auxBuffer) {
     switch (instrument_) {
-    case Instrument::Bow:
+    case Instrument::Bow: {
+        PROFILE_SCOPE(utli::ProfileStage::kBowed);
         bowed_.Process(buffer, auxBuffer);
         break;
-    case Instrument::Reed:
+    }
+    case Instrument::Reed: {
+        PROFILE_SCOPE(utli::ProfileStage::kReed);
         reed_.Process(buffer, auxBuffer);
         break;
-    case Instrument::String:
+    }
+    case Instrument::String: {
+        PROFILE_SCOPE(utli::ProfileStage::kString);
         string_.Process(buffer, auxBuffer);
         break;
     }
-    body_.Process(buffer, auxBuffer);
-    reverb_.Process(buffer, auxBuffer);
+    }
+}
+
+uint32_t CSynth::GetNumActiveVoices() {
+    switch (instrument_) {
+    case Instrument::Bow:
+        return bowed_.GetUsedNotes().size();
+    case Instrument::Reed:
+        return reed_.GetUsedNotes().size();
+    case Instrument::String:
+        return string_.GetUsedNotes().size();
+    }
+    return 0;
 }
 
 void CSynth::SetInstrument(Instrument instr) {
@@ -271,6 +451,7 @@ void CSynth::BindParamsFlute(CSynthParams& param)
         for (auto& note : Synth.reed_.GetNotes()) {
             note.SetLossHP(v);
         }
+        Tuning.MarkDirty();
     });
     param.reed.lossGain.SetCallback([]{
         
@@ -285,6 +466,7 @@ void CSynth::BindParamsFlute(CSynthParams& param)
         for (auto& note : Synth.reed_.GetNotes()) {
             note.SetLossLP(v);
         }
+        Tuning.MarkDirty();
     });
     param.reed.noiseGain.SetCallback([]{
         
@@ -336,6 +518,7 @@ void CSynth::BindParamsFlute(CSynthParams& param)
         for (auto& note : Synth.reed_.GetNotes()) {
             note.SetLossFaster(v);
         }
+        Tuning.MarkDirty();
     });
     param.reed.tremoloAttack.SetCallback([]{
         auto v = Synth.GetSynthParams().reed.tremoloAttack.Get();
@@ -367,22 +550,7 @@ void CSynth::BindParamsString(CSynthParams& param) {
         for (auto& note : notes) {
             note.SetDispersion(v);
         }
-    });
-    param.string.pos.SetCallback([] {
-        auto& p = Synth.GetSynthParams().string;
-        auto notes = Synth.string_.GetNotes();
-        auto v = p.pos.Get();
-        for (auto& note : notes) {
-            note.SetPluckPosition(v);
-        }
-    });
-    param.string.color.SetCallback([] {
-        auto& p = Synth.GetSynthParams().string;
-        auto v = p.color.Get();
-        auto notes = Synth.string_.GetNotes();
-        for (auto& note : notes) {
-            note.SetColor(v);
-        }
+        Tuning.MarkDirty();
     });
     param.string.lossFaster.SetCallback([] {
         auto& p = Synth.GetSynthParams().string;
@@ -391,14 +559,7 @@ void CSynth::BindParamsString(CSynthParams& param) {
         for (auto& note : notes) {
             note.SetLossFaster(v);
         }
-    });
-    param.string.exciFaster.SetCallback([] {
-        auto& p = Synth.GetSynthParams().string;
-        auto v = p.exciFaster.Get();
-        auto notes = Synth.string_.GetNotes();
-        for (auto& note : notes) {
-            note.SetExciterFaster(v);
-        }
+        Tuning.MarkDirty();
     });
 }
 
@@ -444,6 +605,7 @@ void CSynth::BindParamsBow(CSynthParams& param) {
         for (auto& note : Synth.bowed_.GetNotes()) {
             note.SetLossFaster(p.lossFaster.Get());
         }
+        Tuning.MarkDirty();
     });
     param.bow.tremoloAttack.SetCallback([]{
         auto v = Synth.GetSynthParams().bow.tremoloAttack.Get();
@@ -515,6 +677,7 @@ void CSynth::BindParamReverb(CSynthParams& param) {
 void CSynth::BindParamsBody(CSynthParams& param) {
     param.body.SetCallback([] {
         Synth.body_.SetEnabled(SynthParams.body.Get());
+        Synth.UpdateCommuted();
     });
     param.bodyType.SetCallback([] {
         Synth.body_.SetBodyType(static_cast<BodyEnum>(SynthParams.bodyType.Get()));
@@ -525,6 +688,39 @@ void CSynth::BindParamsBody(CSynthParams& param) {
     param.stretch.SetCallback([] {
         Synth.body_.SetStretch(SynthParams.stretch.Get());
     });
+    param.commuted.SetCallback([] {
+        Synth.UpdateCommuted();
+    });
+    param.modalBody.SetCallback([] {
+        Synth.body_.SetModal(SynthParams.modalBody.Get());
+    });
+}
+
+void CSynth::BindParamsTuning(CSynthParams& param) {
+    // 只影响按音符预先计算的环路数据, 有其他回调的参数在各自的回调里标记
+    auto markDirty = [] { Tuning.MarkDirty(); };
+    param.pitchBend.SetCallback(markDirty);
+    param.string.lossTructionlow.SetCallback(markDirty);
+    param.string.lossTructionHigh.SetCallback(markDirty);
+    param.string.lossOutLow.SetCallback(markDirty);
+    param.string.lossOutHigh.SetCallback(markDirty);
+    param.string.exciTructionlow.SetCallback(markDirty);
+    param.string.exciTructionHigh.SetCallback(markDirty);
+    param.string.exciOutLow.SetCallback(markDirty);
+    param.string.exciOutHigh.SetCallback(markDirty);
+    param.bow.decay.SetCallback(markDirty);
+    param.bow.lossTructionlow.SetCallback(markDirty);
+    param.bow.lossTructionHigh.SetCallback(markDirty);
+    param.bow.lossOutLow.SetCallback(markDirty);
+    param.bow.lossOutHigh.SetCallback(markDirty);
+}
+
+void CSynth::UpdateCommuted() {
+    // 琴体关闭时两种模式都没有琴体
+    commuted_ = SynthParams.commuted.Get() && body_.IsEnabled();
+    for (auto& note : string_.GetNotes()) {
+        note.SetCommuted(commuted_);
+    }
 }
 
 } // namespace dsp
@@ -8,18 +8,52 @@
 #include "PolySynth.hpp"
 #include "Reverb.hpp"
 #include "Body.hpp"
+#include "NoteEvent.hpp"
 
 namespace dsp {
 
+class PcmWriter;
+
 class CSynth {
 public:
+    // 每个block最多处理的事件数, 多出来的留到下一个block
+    static constexpr uint32_t kMaxEventsPerBlock = 16;
+    // 最低音质等级下的复音数
+    static constexpr uint32_t kMaxVoicesReduced = 4;
+
     void Init(uint32_t sampleRate);
+    // 在处理参数回调之前调用, 乐器第一次使用时才初始化, 在那之前它的参数回调被推迟
+    void PrepareInstrument();
     void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
+    // plan 必须是当前乐器的
+    void NoteOn(uint8_t channel, const NotePlan& plan);
     void NoteOff(uint8_t note);
+    /**
+     * @brief 为当前乐器填写 e.plan, 在事件入队时由产生事件的任务/中断调用
+     * 乐器还没有初始化时不填写, DAC任务中退回到 NoteOn(note, velocity)
+     */
+    void PlanNote(NoteEvent& e);
     void Process(std::span<float> buffer, std::span<float> auxBuffer);
+    /**
+     * @brief 在事件的采样位置切分block, 实现采样精确的音符触发
+     * @param events 按时间排序, 最多 kMaxEventsPerBlock 个
+     * @param blockTime buffer[0] 对应的采样时钟, 早于它的事件在0处触发
+     */
+    void Process(std::span<float> buffer, std::span<float> auxBuffer,
+                 std::span<const NoteEvent> events, uint32_t blockTime);
+    /**
+     * @brief 同上, 混响/音量/格式转换合并为一次遍历, 直接写入输出
+     * @param buffer 渲染voice和琴体用的临时缓冲, 大小与output相同
+     */
+    void Process(std::span<float> buffer, std::span<const NoteEvent> events,
+                 uint32_t blockTime, PcmWriter& output);
 
     void SetInstrument(Instrument instr);
     Instrument GetInstrument() const { return instrument_; }
+    uint32_t GetNumActiveVoices();
+    // 由governor在DAC任务中调用, 0为完整音质, 见 utli::CGovernor
+    void SetQualityLevel(uint32_t level);
+    uint32_t GetQualityLevel() const { return qualityLevel_; }
 
     CSynthParams& GetSynthParams() { return SynthParams; }
 
@@ -45,17 +79,36 @@ public:
     void SaveParam(SavedParams& s);
     void LoadParam(const SavedParams& param);
 private:
+    static constexpr uint32_t kNumInstruments = static_cast<uint32_t>(Instrument::kNumInstruments);
+    struct CallbackRange {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    void RenderVoices(std::span<float> buffer, std::span<float> auxBuffer,
+                      std::span<const NoteEvent> events, uint32_t blockTime);
+    void ProcessVoices(std::span<float> buffer, std::span<float> auxBuffer);
+    void ProcessEffects(std::span<float> buffer, std::span<float> auxBuffer);
     void BindParamsFlute(CSynthParams& param);
     void BindParamsString(CSynthParams& param);
     void BindParamsBow(CSynthParams& param);
     void BindParamReverb(CSynthParams& param);
     void BindParamsBody(CSynthParams& param);
+    void BindParamsTuning(CSynthParams& param);
+    void UpdateCommuted();
+    // 弦乐且commuted开启时, 琴体已经在激励里
+    bool IsBodyCommuted() const { return commuted_ && instrument_ == Instrument::String; }
 
     PolySynth<PluckString> string_{};
     PolySynth<Bowed> bowed_{};
     PolySynth<Reed> reed_{};
     Instrument instrument_{ Instrument::String };
     Body body_;
+    bool commuted_{};
+    uint32_t qualityLevel_{};
+    uint32_t sampleRate_{};
+    bool instrumentReady_[kNumInstruments]{};
+    CallbackRange instrumentCallbacks_[kNumInstruments]{};
 };
 
 struct InternalSynth {
@@ -13,6 +13,8 @@ void ThrianDispersion::Init(float sampleRate) {
 }
 
 float ThrianDispersion::Process(float in) {
+    // 单位系数时4个APF都是直通
+    if (identity_) return in;
     for (uint32_t i = 0; i < kMaxNumAPF; ++i) {
         in = ProcessFilter(in, i);
     }
@@ -45,8 +47,14 @@ void ThrianDispersion::SetGroupDelay(float delay) {
         a2_ = 0.0f;
         b0_ = 1.0f;
         b2_ = 0.0f;
+        identity_ = true;
     }
     else {
+        // 旁路期间状态没有更新
+        if (identity_) {
+            Panic();
+        }
+        identity_ = false;
         a1_ = -2 * Something(delay, 1);
         a2_ = Something(delay, 2);
         b0_ = a2_;
@@ -54,6 +62,17 @@ void ThrianDispersion::SetGroupDelay(float delay) {
     }
 }
 
+void ThrianDispersion::CopyCoeff(const ThrianDispersion& other) {
+    if (identity_ && !other.identity_) {
+        Panic();
+    }
+    identity_ = other.identity_;
+    a1_ = other.a1_;
+    a2_ = other.a2_;
+    b0_ = other.b0_;
+    b2_ = other.b2_;
+}
+
 void ThrianDispersion::Panic() {
     for (auto& s : latchs_) {
         s.latch1_ = 0;
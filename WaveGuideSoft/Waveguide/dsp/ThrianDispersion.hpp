@@ -12,7 +12,10 @@ public:
     float Process(float in);
     float GetPhaseDelay(float freq) const;
     void  SetGroupDelay(float delay);
+    // 只复制系数, 状态不变
+    void  CopyCoeff(const ThrianDispersion& other);
     void  Panic();
+    bool  IsIdentity() const { return identity_; }
     std::complex<float> GetResponce(float omega) const;
 private:
     float ProcessFilter(float in, uint32_t i);
@@ -22,6 +25,7 @@ private:
     float a1_{};
     float b0_{};
     float b2_{};
+    bool identity_{};
     struct APFData {
         float latch1_{};
         float latch2_{};
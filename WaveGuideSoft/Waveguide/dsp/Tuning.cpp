@@ -0,0 +1,73 @@
+#include "Tuning.hpp"
+#include "Note.hpp"
+#include "MemAttributes.hpp"
+#include <algorithm>
+#include <cmath>
+
+MEM_BSS_SRAMD1 static dsp::CTuning::Tables tables[2];
+// RequestScale 解析用, 放在栈上太大
+MEM_BSS_SRAMD1 static dsp::scala::Scale requestedScale;
+MEM_BSS_SRAMD1 static dsp::scala::KeyboardMap requestedMap;
+// RequestScale 算好的频率, 生效前只有 RebuildIfDirty 读
+MEM_BSS_SRAMD1 static float requestedFreq[dsp::CTuning::kNumNotes];
+
+namespace dsp {
+
+void CTuning::Init(float sampleRate) {
+    sampleRate_ = sampleRate;
+    SetEqualTemperament();
+    dirty_.store(false, std::memory_order_relaxed);
+    Rebuild();
+}
+
+void CTuning::SetEqualTemperament() {
+    for (uint32_t note = 0; note < kNumNotes; ++note) {
+        freq_[note] = Note::Midi2Frequency(note);
+    }
+    MarkDirty();
+}
+
+bool CTuning::RequestScale(std::string_view scl, std::string_view kbm) {
+    if (requested_.load(std::memory_order_acquire)) return false;
+    if (scl.empty()) {
+        for (uint32_t note = 0; note < kNumNotes; ++note) {
+            requestedFreq[note] = Note::Midi2Frequency(note);
+        }
+    }
+    else {
+        requestedMap = scala::DefaultKeyboardMap();
+        if (!scala::ParseScale(scl, requestedScale)) return false;
+        if (!kbm.empty() && !scala::ParseKeyboardMap(kbm, requestedMap)) return false;
+        if (!scala::GetFrequencies(requestedScale, requestedMap, requestedFreq)) return false;
+    }
+    requested_.store(true, std::memory_order_release);
+    return true;
+}
+
+void CTuning::RebuildIfDirty() {
+    if (requested_.load(std::memory_order_acquire)) {
+        std::copy(std::begin(requestedFreq), std::end(requestedFreq), freq_);
+        requested_.store(false, std::memory_order_release);
+        MarkDirty();
+    }
+    if (dirty_.exchange(false, std::memory_order_acquire)) {
+        Rebuild();
+    }
+}
+
+const CTuning::Tables& CTuning::GetTables() const {
+    return tables[front_.load(std::memory_order_acquire)];
+}
+
+void CTuning::Rebuild() {
+    const uint32_t back = 1 - front_.load(std::memory_order_relaxed);
+    auto& t = tables[back];
+    PluckString::BuildPitchTable(t.string, freq_, sampleRate_);
+    Reed::BuildPitchTable(t.reed, freq_, sampleRate_);
+    Bowed::BuildPitchTable(t.bow, freq_, sampleRate_);
+    // 读表的是 PlanNote: 键盘和USBMidiRx任务(优先级2), 以及没有plan时的DAC任务, 都高于重建表的LCD任务(优先级1)
+    // 读者取front并把需要的一项复制进plan的过程中LCD任务不会运行, 所以下一次重建改写的总是没有人在读的那一份
+    front_.store(back, std::memory_order_release);
+}
+
+}
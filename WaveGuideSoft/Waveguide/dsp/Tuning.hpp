@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <string_view>
+#include "PluckString.hpp"
+#include "Reed.hpp"
+#include "Bowed.hpp"
+#include "Scala.hpp"
+
+namespace dsp {
+
+/**
+ * @brief 音律表和按音符预先计算的环路数据
+ * 频率表来自十二平均律或者Scala的.scl/.kbm(由 PresetTransfer 的音律region写入), 每个乐器的环路长度、弯音长度、滤波器截止频率等
+ * 由各自的 BuildPitchTable 按音符算好, PlanNote 时复制需要的一项, voice不再读表
+ * 表在LCD任务中重建, 双缓冲, 写完后再切换
+ */
+class CTuning {
+public:
+    static constexpr uint32_t kNumNotes = scala::kNumNotes;
+
+    struct Tables {
+        std::array<PluckString::Pitch, kNumNotes> string;
+        std::array<Reed::Pitch, kNumNotes> reed;
+        std::array<Bowed::Pitch, kNumNotes> bow;
+    };
+
+    // 启动时调用, 十二平均律, 直接生成所有表
+    void Init(float sampleRate);
+    // 以下在LCD任务中调用
+    void SetEqualTemperament();
+    void RebuildIfDirty();
+
+    /**
+     * @brief 可以在其他任务中调用, 下一次 RebuildIfDirty 时生效
+     * scl 为空时回到十二平均律, kbm 为空时用默认映射
+     * @return 解析失败或者上一次请求还没生效时返回false
+     */
+    bool RequestScale(std::string_view scl, std::string_view kbm);
+
+    // 影响环路的参数回调(DAC任务)调用
+    void MarkDirty() { dirty_.store(true, std::memory_order_release); }
+
+    float GetFrequency(uint32_t note) const { return freq_[note]; }
+    const PluckString::Pitch& GetStringPitch(uint32_t note) const { return GetTables().string[note]; }
+    const Reed::Pitch& GetReedPitch(uint32_t note) const { return GetTables().reed[note]; }
+    const Bowed::Pitch& GetBowPitch(uint32_t note) const { return GetTables().bow[note]; }
+private:
+    const Tables& GetTables() const;
+    void Rebuild();
+
+    float freq_[kNumNotes]{};
+    float sampleRate_{};
+    std::atomic<uint32_t> front_{};
+    std::atomic<bool> dirty_{};
+    // RequestScale 算好的频率还没复制到 freq_
+    std::atomic<bool> requested_{};
+};
+
+struct InternalTuning {
+    inline static CTuning instance;
+};
+
+static CTuning& Tuning = InternalTuning::instance;
+
+}
@@ -10,11 +10,10 @@ float TunningFilter::Process(float in) {
     return v + alpha_ * t;
 }
 
-int32_t TunningFilter::SetDelay(float delay) {
+TunningFilter::Coeff TunningFilter::Design(float delay) {
     // thiran delay limit to 0.5 ~ 1.5
     if (delay < 0.5f) {
-        alpha_ = 0.0f; // equal to one delay
-        return 0;
+        return { 0.0f, 0 }; // equal to one delay
     }
     else {
         float intergalPart = std::floor(delay);
@@ -23,8 +22,8 @@ int32_t TunningFilter::SetDelay(float delay) {
             fractionalPart += 1.0f;
             intergalPart -= 1.0f;
         }
-        alpha_ = (1.0f - fractionalPart) / (1.0f + fractionalPart);
-        return static_cast<int32_t>(intergalPart);
+        float alpha = (1.0f - fractionalPart) / (1.0f + fractionalPart);
+        return { alpha, static_cast<int32_t>(intergalPart) };
     }
 }
 
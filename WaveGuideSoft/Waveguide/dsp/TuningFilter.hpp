@@ -6,6 +6,11 @@ namespace dsp {
 // one pole all pass filter
 class TunningFilter {
 public:
+    struct Coeff {
+        float alpha;
+        int32_t delay;
+    };
+
     void Init(float /*sampleRate*/) {}
     float Process(float in);
     /**
@@ -13,7 +18,13 @@ public:
      * @param delay 环路延迟
      * @return 还剩下多少延迟
      */
-    int32_t SetDelay(float delay);
+    int32_t SetDelay(float delay) { return SetCoeff(Design(delay)); }
+    int32_t SetCoeff(const Coeff& coeff) {
+        alpha_ = coeff.alpha;
+        return coeff.delay;
+    }
+    // 不改变滤波器状态, 用于预先计算
+    static Coeff Design(float delay);
 private:
     float latch_{};
     float alpha_{};
@@ -128,6 +128,10 @@ struct CSynthParams {
     IntParamDesc  bodyType       { gSafeCallback, "body type",         0,       8,                      0,          1 };
     FloatParamDesc wetGain       { gSafeCallback, "wet gain",     -60.0f,   60.0f,      0.1f,        0.0f,        1 };
     FloatParamDesc stretch       { gSafeCallback, "stretch",       0.25f,    3.0f,     0.01f,        1.0f,        1 };
+    // 拨弦时把琴体卷积进激励, 不保存到预设
+    BoolParamDesc commuted       { gSafeCallback, "commuted",                                        false };
+    // 模态琴体, 不保存到预设
+    BoolParamDesc modalBody      { gSafeCallback, "modal",                                           false };
     
     //                                       {              | name            |  min  |  max  |   step      |   default   | altMul
     FloatParamDesc                volume     { gSafeCallback, "volume",         -60.0f,   24.0f,       0.5f,      -12.0f,           1 };
@@ -1,4 +1,5 @@
 #include "GuiDispatch.hpp"
+#include <bit>
 #include "bsp/UC1638.hpp"
 #include "bsp/ControlIO.hpp"
 #include "obj/Main.hpp"
@@ -22,14 +23,51 @@ bool CGuiDispatch::Update(uint32_t msEscape)
     if (!IsNeedUpdate()) {
         return false;
     }
-    needUpdate_ = false;
+    DrawTiles(invalidTiles_.exchange(0, std::memory_order_relaxed));
+    return !UC1638.display.GetDirtyRects().empty();
+}
 
+// 列范围相同的连续几行块合成一个区域, 每个区域裁剪后画一次
+void CGuiDispatch::DrawTiles(uint32_t tiles) {
+    if (obj_ == nullptr) {
+        return;
+    }
+    constexpr uint32_t kRowMask = (1u << kTileCols) - 1;
     auto& display = UC1638.display;
     StyleDrawer drawer{ display };
-    if (obj_ != nullptr) {
+    int16_t row = 0;
+    while (row < kTileRows) {
+        const uint32_t cols = tiles >> (row * kTileCols) & kRowMask;
+        if (cols == 0) {
+            ++row;
+            continue;
+        }
+        const int16_t firstRow = row;
+        while (++row < kTileRows && (tiles >> (row * kTileCols) & kRowMask) == cols) {}
+        const int16_t firstCol = std::countr_zero(cols);
+        const int16_t endCol = 32 - std::countl_zero(cols);
+        display.SetClipRect(Rectange(firstCol * kTileWidth, firstRow * kTileHeight,
+                                     (endCol - firstCol) * kTileWidth, (row - firstRow) * kTileHeight));
         obj_->Draw(drawer);
     }
-    return true;
+    display.ResetClipRect();
+}
+
+void CGuiDispatch::Invalidate(Rectange aera) {
+    aera = aera.Intersect(Rectange(0, 0, OLEDDisplay::kWidth, OLEDDisplay::kHeight));
+    if (aera.IsEmpty()) {
+        return;
+    }
+    const int32_t firstCol = aera.x / kTileWidth;
+    const int32_t lastCol = (aera.x + aera.w - 1) / kTileWidth;
+    const int32_t firstRow = aera.y / kTileHeight;
+    const int32_t lastRow = (aera.y + aera.h - 1) / kTileHeight;
+    const uint32_t cols = ((2u << lastCol) - 1) & ~((1u << firstCol) - 1);
+    uint32_t tiles = 0;
+    for (int32_t row = firstRow; row <= lastRow; ++row) {
+        tiles |= cols << (row * kTileCols);
+    }
+    invalidTiles_.fetch_or(tiles, std::memory_order_relaxed);
 }
 
 void CGuiDispatch::SetObj(CGuiObj& obj) {
@@ -63,7 +101,7 @@ bool CGuiDispatch::IsNeedUpdate()
         return false;
     }
     frameMsCount_ = 0;
-    return needUpdate_;
+    return invalidTiles_.load(std::memory_order_relaxed) != 0;
 }
 
 void CGuiDispatch::TimeTick(uint32_t msEscape) {
@@ -81,4 +119,10 @@ void CGuiObj::Redraw() {
     }
 }
 
+void CGuiObj::Redraw(Rectange aera) {
+    if (GuiDispatch.IsObjShowing(*this)) {
+        GuiDispatch.Invalidate(aera);
+    }
+}
+
 }
\ No newline at end of file
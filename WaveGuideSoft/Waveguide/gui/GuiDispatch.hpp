@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <cstdint>
 #include "usf/usf.hpp"
 #include "obj/Styles.hpp"
@@ -13,11 +14,14 @@ struct CGuiObj {
     virtual void OnSelect() = 0;
     virtual void OnTimeTick(uint32_t msEscape) {}
     void Redraw();
+    // 只重画这一块, Draw 时裁剪到重画的区域
+    void Redraw(Rectange aera);
 };
 
 class CGuiDispatch {
 public:
-    static constexpr uint32_t kFps = 10;
+    // LCD任务每 kScanMs 醒一次
+    static constexpr uint32_t kFps = 1000 / bsp::CControlIO::kScanMs;
     static constexpr uint32_t kMsPerFrame = 1000 / kFps;
 
     void Init();
@@ -25,15 +29,26 @@ public:
     void SetObj(CGuiObj& obj);
     CGuiObj* GetObj() { return obj_; }
     bool IsObjShowing(CGuiObj& obj) { return obj_ == &obj; }
-    void SetNeedUpdate() { needUpdate_ = true; }
+    void SetNeedUpdate() { invalidTiles_.store(kAllTiles, std::memory_order_relaxed); }
+    // 其他任务也会调用, 只做一次原子或
+    void Invalidate(Rectange aera);
 
     // time tick
     void TimeTick(uint32_t msEscape);
     uint32_t GetMsEscape() { return msEscape_; }
 private:
+    // 屏幕分成 kTileCols x kTileRows 块, 每块一位
+    static constexpr int16_t kTileCols = 2;
+    static constexpr int16_t kTileRows = 16;
+    static constexpr int16_t kTileWidth = OLEDDisplay::kWidth / kTileCols;
+    static constexpr int16_t kTileHeight = OLEDDisplay::kHeight / kTileRows;
+    static constexpr uint32_t kAllTiles = 0xffffffff;
+    static_assert(kTileCols * kTileRows == 32);
+
     bool IsNeedUpdate();
+    void DrawTiles(uint32_t tiles);
 
-    bool needUpdate_ = true;
+    std::atomic<uint32_t> invalidTiles_{ kAllTiles };
     CGuiObj* obj_ = nullptr;
     uint32_t msEscape_ = 0;
     uint32_t frameMsCount_ = kMsPerFrame;
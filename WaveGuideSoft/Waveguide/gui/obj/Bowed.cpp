@@ -55,14 +55,15 @@ void CBowed::OnSelect() {
 
     auto& io = bsp::ControlIO;
     io.SetEncoderCallback(bsp::EncoderId::kParam, [](int32_t dvalue){
+        Bowed.Redraw(StyleDrawer::GetKnobRect(Bowed.selectIdx_));
         Bowed.selectIdx_ += dvalue;
         if (Bowed.selectIdx_ < 0) Bowed.selectIdx_ = 0;
         if (Bowed.selectIdx_ >= Bowed.totalKnobs_) Bowed.selectIdx_ = Bowed.totalKnobs_ - 1;
-        Bowed.Redraw();
+        Bowed.Redraw(StyleDrawer::GetKnobRect(Bowed.selectIdx_));
     });
     io.SetEncoderCallback(bsp::EncoderId::kValue, [](int32_t dvalue){
         Bowed.knobs_[Bowed.selectIdx_].Add(dvalue, false);
-        Bowed.Redraw();
+        Bowed.Redraw(StyleDrawer::GetKnobRect(Bowed.selectIdx_));
     });
     io.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
         if (args.IsAttack()) {
@@ -87,9 +88,9 @@ void CBowed::OnSelect() {
 }
 
 void CBowed::OnTimeTick(uint32_t msEscape) {
-    for (auto& k : knobs_) {
-        if (k.Tick(msEscape)) {
-            Redraw();
+    for (uint32_t i = 0; i < std::size(knobs_); ++i) {
+        if (knobs_[i].Tick(msEscape)) {
+            Redraw(StyleDrawer::GetKnobRect(i));
         }
     }
 }
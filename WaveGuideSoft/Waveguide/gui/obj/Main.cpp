@@ -23,6 +23,11 @@ static constexpr int32_t kBlackKeyIdxTable[5] = {1, 3, 6, 8, 10};
 static constexpr std::string_view kInstrumentNames[] {
     "拨弦", "木管", "弓弦"
 };
+// 标题栏、选项行和底部菜单都是12高, 键盘在选项行下面
+static constexpr int16_t kLineHeight = 12;
+static constexpr Rectange kKeyboardAera{ 0, kLineHeight * 2, OLEDDisplay::kWidth, 60 };
+static constexpr Rectange kInfoAera{ 0, kKeyboardAera.y + kKeyboardAera.h, OLEDDisplay::kWidth,
+                                     OLEDDisplay::kHeight - kLineHeight - kKeyboardAera.y - kKeyboardAera.h };
 
 void gui::CMain::Draw(StyleDrawer& drawer) {
     drawer.display.Fill(OledColorEnum::kOledBLACK);
@@ -41,10 +46,10 @@ void gui::CMain::Draw(StyleDrawer& drawer) {
         }
     }
 
-    rect.RemovedFromTop(12);
-    rect.RemovedFromBottom(12);
+    rect.RemovedFromTop(kLineHeight);
+    rect.RemovedFromBottom(kLineHeight);
     {
-        auto line = rect.RemoveFromTop(12);
+        auto line = rect.RemoveFromTop(kLineHeight);
         auto t = line.w / 3;
         auto octaveText = line.RemoveFromLeft(t);
         drawer.display.setColor(OledColorEnum::kOledWHITE);
@@ -59,9 +64,8 @@ void gui::CMain::Draw(StyleDrawer& drawer) {
         if (selectIdx_ == kVolume) drawer.InverseFrame(line);
     }
 
-    {
+    if (auto keyboard = rect.RemoveFromTop(kKeyboardAera.h); drawer.NeedDraw(keyboard)) {
         // draw keyboard
-        auto keyboard = rect.RemoveFromTop(60);
         auto whiteKeyAera = keyboard.WithWidth(20);
         auto blackKeyAera = Rectange{whiteKeyAera}.RemoveFromTop(whiteKeyAera.h * 2 / 3);
         blackKeyAera.Translated(blackKeyAera.w / 2, 0);
@@ -175,6 +179,10 @@ void gui::CMain::OnSelect() {
 void gui::CMain::SetDacTaskMs(uint32_t ms) {
     if (dacTaskTicks_ != ms) {
         dacTaskTicks_ = ms;
-        Redraw();
+        Redraw(kInfoAera);
     }
 }
+
+void gui::CMain::RedrawKeyboard() {
+    Redraw(kKeyboardAera);
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "../GuiDispatch.hpp"
+#include <atomic>
 
 namespace gui {
 
@@ -7,15 +8,17 @@ struct CMain : public CGuiObj {
     void Draw(StyleDrawer& display) override;
     void OnSelect() override;
 
-    void NoteOn(uint8_t i) { keyPressState |= (1 << (i % 12)); Redraw(); }
-    void NoteOff(uint8_t i) { keyPressState &= ~(1 << (i % 12)); Redraw(); }
+    void NoteOn(uint8_t i) { keyPressState |= (1 << (i % 12)); RedrawKeyboard(); }
+    void NoteOff(uint8_t i) { keyPressState &= ~(1 << (i % 12)); RedrawKeyboard(); }
+    void RedrawKeyboard();
     void SetOctave(int i) {
         octave = std::clamp(i, 2, 9);
         Redraw();
     }
     void SetDacTaskMs(uint32_t ms);
 
-    uint16_t keyPressState = 0;
+    // 键盘任务和USB任务都会改
+    std::atomic<uint16_t> keyPressState{};
     int octave = 4;
     int8_t selectIdx_ = 0;
     uint32_t dacTaskTicks_ = 0;
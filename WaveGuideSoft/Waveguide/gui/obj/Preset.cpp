@@ -2,11 +2,7 @@
 #include "bsp/ControlIO.hpp"
 #include "dsp/params.hpp"
 #include "dsp/Synth.hpp"
-#include "stm32h7xx_hal.h"
-#include "bsp/DebugIO.hpp"
-
-static dsp::SavedParams savedParams[16]{};
-constexpr auto size = sizeof(savedParams);
+#include "PresetBank.hpp"
 
 namespace gui::internal {
 
@@ -26,7 +22,7 @@ void CPreset::Draw(StyleDrawer& drawer) {
         b.h = 12;
         for (int32_t i = 0; i < numShow; ++i) {
             auto idx = i + listTopPos_;
-            drawer.display.FormatString(b.x, b.y, "{}/{}:{}", idx + 1, numTotalListItems_, std::string_view{savedParams[idx].name, 12});
+            drawer.display.FormatString(b.x, b.y, "{}/{}:{}", idx + 1, numTotalListItems_, std::string_view{PresetBank.GetPreset(idx).name, 12});
             if (i == listPos_) {
                 drawer.InverseFrame(b);
             }
@@ -52,19 +48,8 @@ void CPreset::Draw(StyleDrawer& drawer) {
 }
 
 inline void CPreset::OnSelect() {
-    numTotalListItems_ = 16;
-
-    if (!inited_) {
-        inited_ = true;
-        const uint32_t* src = reinterpret_cast<const uint32_t*>(0x080E0000);
-        uint32_t* dst = reinterpret_cast<uint32_t*>(&savedParams[0]);
-        uint32_t* dstEnd = reinterpret_cast<uint32_t*>(&savedParams[16]);
-        while (dst < dstEnd) {
-            *dst = *src;
-            ++dst;
-            ++src;
-        }
-    }
+    numTotalListItems_ = PresetBank.kNumPresets;
+    PresetBank.LoadIfNeeded();
 
     auto& io = bsp::ControlIO;
     io.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
@@ -80,15 +65,15 @@ inline void CPreset::OnSelect() {
             Preset.editBuffer_[11] = 0;
 
             int32_t idx = Preset.listTopPos_ + Preset.listPos_;
-            std::copy_n(Preset.editBuffer_, 12, savedParams[idx].name);
+            std::copy_n(Preset.editBuffer_, 12, PresetBank.GetPreset(idx).name);
             Preset.Redraw();
             return;
         }
 
         // 保存
         int32_t idx = Preset.listTopPos_ + Preset.listPos_;
-        Preset.EditText(savedParams[idx].name, 12);
-        dsp::Synth.SaveParam(savedParams[idx]);
+        Preset.EditText(PresetBank.GetPreset(idx).name, 12);
+        dsp::Synth.SaveParam(PresetBank.GetPreset(idx));
     });
     io.SetButtonCallback(bsp::ButtonId::kBtn1, [](bsp::ButtonEventArgs args) {
         if (!args.IsAttack()) return;
@@ -101,49 +86,12 @@ inline void CPreset::OnSelect() {
 
         // 加载
         int32_t idx = Preset.listTopPos_ + Preset.listPos_;
-        dsp::Synth.LoadParam(savedParams[idx]);
+        dsp::Synth.LoadParam(PresetBank.GetPreset(idx));
     });
     io.SetButtonCallback(bsp::ButtonId::kBtn2, [](bsp::ButtonEventArgs args) {
         if ((!args.IsAttack())) return;
 
-        auto state = HAL_FLASH_Unlock();
-        if (state != HAL_OK) {
-            bsp::Debug.XWriteLine("[error] failed to unlock flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
-            return;
-        }
-        FLASH_EraseInitTypeDef erase;
-        erase.Banks = FLASH_BANK_1;
-        erase.NbSectors = 1;
-        erase.Sector = FLASH_SECTOR_7;
-        erase.TypeErase = FLASH_TYPEERASE_SECTORS;
-        erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-        uint32_t tmp{};
-
-        state = HAL_FLASHEx_Erase(&erase, &tmp);
-        if (state == HAL_OK) {
-            uint32_t address = 0x080E0000;
-            constexpr uint32_t len = sizeof(savedParams);
-            const uint32_t data = reinterpret_cast<uint32_t>(&savedParams[0]);
-            for (uint32_t i = 0; i < len; i += 32) {
-                state = HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, address, (uint32_t)(data + i));
-                if (state == HAL_OK) {
-                    address = address + 32;
-                }
-                else {
-                    bsp::Debug.XWriteLine("[error] failed to program flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
-                    break;
-                }
-            }
-        }
-        else {
-            bsp::Debug.XWriteLine("[error] failed to erase flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
-            return;
-        }
-        
-        state = HAL_FLASH_Lock();
-        if (state != HAL_OK) {
-            bsp::Debug.XWriteLine("[error] failed to lock flash with code:{}", static_cast<uint32_t>(HAL_FLASH_GetError()));
-        }
+        PresetBank.SaveToFlash();
     });
     io.SetEncoderCallback(bsp::EncoderId::kParam, [](int32_t dvalue) {
         if (Preset.isSaving_) {
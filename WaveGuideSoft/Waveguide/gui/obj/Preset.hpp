@@ -20,7 +20,6 @@ private:
     char editBuffer_[12]{};
     int32_t editPos_{};
     int32_t editBufferLength_{};
-    bool inited_{false};
 };
 
 struct InternalPreset {
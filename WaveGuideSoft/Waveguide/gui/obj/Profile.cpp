@@ -0,0 +1,60 @@
+#include "Profile.hpp"
+#include "Scope.hpp"
+#include "bsp/ControlIO.hpp"
+#include "utli/Profiler.hpp"
+
+namespace gui::internal {
+
+void CProfile::Draw(StyleDrawer& drawer) {
+    drawer.display.Fill(OledColorEnum::kOledBLACK);
+    drawer.DrawBottomOptions(0, "返回");
+    drawer.DrawBottomOptions(1, "清零");
+    drawer.DrawBottomOptions(2, "输出");
+
+    auto rect = drawer.display.GetDrawAera();
+    rect.RemovedFromBottom(12);
+    drawer.display.setColor(OledColorEnum::kOledWHITE);
+#if PROFILER_ENABLE
+    // min/avg/p99/max, 单位us
+    for (uint32_t i = 0; i < utli::CProfiler::kNumStages; ++i) {
+        auto stage = static_cast<utli::ProfileStage>(i);
+        auto s = utli::Profiler.GetStats(stage);
+        auto t = rect.RemoveFromTop(12);
+        drawer.display.FormatString(t.x, t.y, "{} {}/{}/{}/{}", utli::CProfiler::GetStageName(stage),
+            utli::CProfiler::TicksToUs(s.min), utli::CProfiler::TicksToUs(s.avg),
+            utli::CProfiler::TicksToUs(s.p99), utli::CProfiler::TicksToUs(s.max));
+    }
+#else
+    drawer.display.drawString(rect.x, rect.y, "PROFILER_ENABLE=0");
+#endif
+}
+
+void CProfile::OnSelect() {
+    using bsp::ControlIO;
+    ControlIO.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
+        if (args.IsAttack()) {
+            GuiDispatch.SetObj(Scope);
+        }
+    });
+    ControlIO.SetButtonCallback(bsp::ButtonId::kBtn1, [](bsp::ButtonEventArgs args) {
+        if (args.IsAttack()) {
+            utli::Profiler.RequestReset();
+            Profile.Redraw();
+        }
+    });
+    ControlIO.SetButtonCallback(bsp::ButtonId::kBtn2, [](bsp::ButtonEventArgs args) {
+        if (args.IsAttack()) {
+            utli::Profiler.Dump();
+        }
+    });
+}
+
+void CProfile::OnTimeTick(uint32_t msEscape) {
+    msCount_ += msEscape;
+    if (msCount_ >= kRefreshMs) {
+        msCount_ = 0;
+        Redraw();
+    }
+}
+
+}
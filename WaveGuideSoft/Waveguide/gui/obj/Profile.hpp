@@ -0,0 +1,26 @@
+#pragma once
+#include "../GuiDispatch.hpp"
+
+namespace gui::internal {
+
+class CProfile : public CGuiObj {
+public:
+    void Draw(StyleDrawer& drawer) override;
+    void OnSelect() override;
+    void OnTimeTick(uint32_t msEscape) override;
+private:
+    static constexpr uint32_t kRefreshMs = 500;
+    uint32_t msCount_{};
+};
+
+struct InternalProfile {
+    inline static CProfile instance;
+};
+
+}
+
+namespace gui {
+
+static auto& Profile = internal::InternalProfile::instance;
+
+}
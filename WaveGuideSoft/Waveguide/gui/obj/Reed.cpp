@@ -52,14 +52,15 @@ void CReed::OnSelect() {
 
     auto& io = bsp::ControlIO;
     io.SetEncoderCallback(bsp::EncoderId::kParam, [](int32_t dvalue){
+        Reed.Redraw(StyleDrawer::GetKnobRect(Reed.selectIdx_));
         Reed.selectIdx_ += dvalue;
         if (Reed.selectIdx_ < 0) Reed.selectIdx_ = 0;
         if (Reed.selectIdx_ >= Reed.totalKnobs_) Reed.selectIdx_ = Reed.totalKnobs_ - 1;
-        Reed.Redraw();
+        Reed.Redraw(StyleDrawer::GetKnobRect(Reed.selectIdx_));
     });
     io.SetEncoderCallback(bsp::EncoderId::kValue, [](int32_t dvalue){
         Reed.knobs_[Reed.selectIdx_].Add(dvalue, false);
-        Reed.Redraw();
+        Reed.Redraw(StyleDrawer::GetKnobRect(Reed.selectIdx_));
     });
     io.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
         if (args.IsAttack()) {
@@ -79,9 +80,9 @@ void CReed::OnSelect() {
 }
 
 void CReed::OnTimeTick(uint32_t msEscape) {
-    for (auto& k : knobs_) {
-        if (k.Tick(msEscape)) {
-            Reed.Redraw();
+    for (uint32_t i = 0; i < std::size(knobs_); ++i) {
+        if (knobs_[i].Tick(msEscape)) {
+            Redraw(StyleDrawer::GetKnobRect(i));
         }
     }
 }
@@ -35,7 +35,7 @@ void CReverb::Draw(StyleDrawer& drawer) {
         rect.RemovedFromBottom(12);
         rect.h = rect.h / 3;
         rect.w = rect.w / 4;
-        for (int8_t i = 0; i < 4; ++i) {
+        for (int8_t i = 0; i < 6; ++i) {
             if (i == selectIdx_) {
                 drawer.display.setColor(OledColorEnum::kOledWHITE);
                 drawer.display.drawRect(rect.x, rect.y, rect.w, rect.h);
@@ -104,13 +104,14 @@ void CReverb::OnSelect() {
     SetPageIdx(pageIdx_);
 
     ControlIO.SetEncoderCallback(bsp::EncoderId::kParam, [](int32_t dvalue) {
+        Reverb.Redraw(StyleDrawer::GetKnobRect(Reverb.selectIdx_));
         Reverb.selectIdx_ = std::clamp<int32_t>(Reverb.selectIdx_ + dvalue, 0, std::size(Reverb.knobs_) - 1);
-        Reverb.Redraw();
+        Reverb.Redraw(StyleDrawer::GetKnobRect(Reverb.selectIdx_));
     });
     ControlIO.SetEncoderCallback(bsp::EncoderId::kValue, [](int32_t dvalue) {
         Reverb.knobs_[Reverb.selectIdx_].Add(dvalue, false);
         Reverb.knobs_[Reverb.selectIdx_].Begin();
-        Reverb.Redraw();
+        Reverb.Redraw(StyleDrawer::GetKnobRect(Reverb.selectIdx_));
     });
     ControlIO.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
         if (args.IsAttack()) {
@@ -125,9 +126,9 @@ void CReverb::OnSelect() {
 }
 
 void CReverb::OnTimeTick(uint32_t msEscape) {
-    for (auto& k : knobs_) {
-        if (k.Tick(msEscape)) {
-            Reverb.Redraw();
+    for (uint32_t i = 0; i < std::size(knobs_); ++i) {
+        if (knobs_[i].Tick(msEscape)) {
+            Redraw(StyleDrawer::GetKnobRect(i));
         }
     }
 }
@@ -142,7 +143,9 @@ void CReverb::SetPageIdx(int8_t idx) {
         knobs_[1].BindParamDesc(SynthParams.bodyType);
         knobs_[2].BindParamDesc(SynthParams.wetGain);
         knobs_[3].BindParamDesc(SynthParams.stretch);
-        selectIdx_ = std::clamp<int8_t>(selectIdx_, 0, 3);
+        knobs_[4].BindParamDesc(SynthParams.commuted);
+        knobs_[5].BindParamDesc(SynthParams.modalBody);
+        selectIdx_ = std::clamp<int8_t>(selectIdx_, 0, 5);
     }
     else if (pageIdx_ == ePage_Reverb) {
         knobs_[0].BindParamDesc(SynthParams.reverb.decay);
@@ -1,6 +1,7 @@
 #include "Scope.hpp"
 #include "utli/Clamp.hpp"
 #include "bsp/ControlIO.hpp"
+#include "Profile.hpp"
 
 enum ScopeSelectOptions {
     eScopeSelect_SampleInterval = 0,
@@ -71,6 +72,11 @@ void CScope::OnSelect() {
         Scope.selectIdx_ = utli::Clamp(Scope.selectIdx_ + dvalue, 0, ScopeSelectOptions::eScopeSelect_NumOptions - 1);
         Scope.Redraw();
     });
+    ControlIO.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
+        if (args.IsAttack()) {
+            GuiDispatch.SetObj(Profile);
+        }
+    });
 }
 
 void CScope::Push(std::span<float> block) {
@@ -89,4 +95,22 @@ void CScope::Push(std::span<float> block) {
         last = block[i];
     }
 }
+
+void CScope::Push(std::span<const StereoSample> block) {
+    float last = 0.0f;
+    for (uint32_t i = 0; i < block.size(); ++i) {
+        float s = block[i].left / kPcmUnity;
+        if (last * s < 0.0f) {
+            for (;i < block.size(); i += sampleInterval_) {
+                if (writePos_ == scopeBuffer_.size()) {
+                    Redraw();
+                    return;
+                }
+                scopeBuffer_[writePos_++] = block[i].left / kPcmUnity * sclae_;
+            }
+            return;
+        }
+        last = s;
+    }
+}
 }
\ No newline at end of file
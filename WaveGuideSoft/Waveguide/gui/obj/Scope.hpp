@@ -2,6 +2,7 @@
 #include "../GuiDispatch.hpp"
 #include <span>
 #include <array>
+#include "Types.hpp"
 
 namespace gui::internal {
 
@@ -10,6 +11,8 @@ public:
     void Draw(StyleDrawer& display) override;
     void OnSelect() override;
     void Push(std::span<float> block);
+    // 从输出的PCM中取左声道
+    void Push(std::span<const StereoSample> block);
 private:
     std::array<float, OLEDDisplay::kWidth - 2 - 8> scopeBuffer_{};
     int32_t sampleInterval_{ 16 };
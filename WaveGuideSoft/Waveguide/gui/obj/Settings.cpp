@@ -6,11 +6,15 @@
 #include "MidiManager.hpp"
 #include "bsp/UC1638.hpp"
 #include "dsp/params.hpp"
+#include "bsp/PCM5102.hpp"
 
 enum AdcSelectOptions {
     eAdcSelect_ADCUpValue = 0,
     eAdcSelect_ADCDownValue,
     eAdcSelect_MinADCValue,
+    eAdcSelect_VelocityStart,
+    eAdcSelect_VelocityFast,
+    eAdcSelect_VelocitySlow,
     eAdcSelect_NumOptions
 };
 
@@ -37,6 +41,7 @@ enum MPESelectOptions {
     eMPE_MPE = 0,
     eMPE_Play,
     eMPE_PitchBendRange,
+    eMPE_BlockSize,
     eMPE_NumOptions
 };
 
@@ -50,6 +55,10 @@ enum Page {
 
 static constexpr int32_t kWhiteKeyIdxTable[7] = {0, 2, 4, 5, 7, 9, 11};
 static constexpr int32_t kBlackKeyIdxTable[5] = {1, 3, 6, 8, 10};
+// 音频block大小, 越小延迟越低但每个block的固定开销占比越大
+static constexpr uint32_t kBlockSizeOptions[] = {32, 48, 96, 192, 480, 1024};
+// 标题栏和底部选项之间, 实时刷新的页面只重画这里
+static constexpr Rectange kBodyAera{ 0, 12, OLEDDisplay::kWidth, OLEDDisplay::kHeight - 24 };
 
 using bsp::ControlIO;
 using bsp::Keyboard;
@@ -90,6 +99,11 @@ void CSettings::Draw(StyleDrawer& drawer) {
             adcUpPos = (Keyboard.GetADCDownValue() - minAdc) / (135.0f - minAdc);
             y = sliderRect.y + sliderRect.h * (1.0f - adcUpPos);
             drawer.display.drawHorizontalLine(sliderRect.x, y, sliderRect.w);
+            adcUpPos = (Keyboard.GetVelocityStartValue() - minAdc) / (135.0f - minAdc);
+            y = sliderRect.y + sliderRect.h * (1.0f - adcUpPos);
+            for (int16_t x = sliderRect.x; x < sliderRect.x + sliderRect.w; x += 4) {
+                drawer.display.drawHorizontalLine(x, y, 2);
+            }
             // draw extra adc line
             sliderRect.w = 7;
             for (uint32_t i = 0; i < 12; ++i) {
@@ -110,10 +124,16 @@ void CSettings::Draw(StyleDrawer& drawer) {
             drawer.display.FormatString(t.x, t.y, "按下值:{}", Keyboard.GetADCDownValue());
             t = rect.RemoveFromTop(12);
             drawer.display.FormatString(t.x, t.y, "最小值:{}", Keyboard.GetMinAdcValue());
+            t = rect.RemoveFromTop(12);
+            drawer.display.FormatString(t.x, t.y, "力度起点:{}", Keyboard.GetVelocityStartValue());
+            t = rect.RemoveFromTop(12);
+            drawer.display.FormatString(t.x, t.y, "最快:{:.1f}ms", Keyboard.GetVelocityFastTime() / 10.0f);
+            t = rect.RemoveFromTop(12);
+            drawer.display.FormatString(t.x, t.y, "最慢:{:.1f}ms", Keyboard.GetVelocitySlowTime() / 10.0f);
             frameRect.Translated(0, 12 * selectIdx);
             drawer.InverseFrame(frameRect);
         }
-        Redraw(); // keep update
+        Redraw(kBodyAera); // keep update
     }
     else if (pageIdx_ == ePage_TouchPad) {
         {
@@ -165,7 +185,7 @@ void CSettings::Draw(StyleDrawer& drawer) {
             frameRect.Translated(0, 12 * selectIdx);
             drawer.InverseFrame(frameRect);
         }
-        Redraw(); // keep update
+        Redraw(kBodyAera); // keep update
     }
     else if (pageIdx_ == ePage_TouchSlider) {
         {
@@ -191,7 +211,7 @@ void CSettings::Draw(StyleDrawer& drawer) {
             frameRect.Translated(0, 12 * selectIdx);
             drawer.InverseFrame(frameRect);
         }
-        Redraw(); // keep update
+        Redraw(kBodyAera); // keep update
     }
     else if (pageIdx_ == ePage_Screen) {
         {
@@ -236,6 +256,10 @@ void CSettings::Draw(StyleDrawer& drawer) {
         t.Translated(0, 12);
         drawer.display.FormatString(t.x, t.y, "弯音范围: {}半音", dsp::SynthParams.pitchBend.Get());
         if (selectIdx == eMPE_PitchBendRange) drawer.InverseFrame(t);
+        t.Translated(0, 12);
+        auto blockSize = bsp::PCM5102.GetBlockSize();
+        drawer.display.FormatString(t.x, t.y, "缓冲: {}({:.1f}ms)", blockSize, blockSize * 1000.0f / bsp::PCM5102.kSampleRate);
+        if (selectIdx == eMPE_BlockSize) drawer.InverseFrame(t);
     }
 }
 
@@ -278,6 +302,15 @@ void CSettings::OnSelect() {
             case eAdcSelect_MinADCValue:
                 Keyboard.SetMinAdcValue(utli::Clamp(Keyboard.GetMinAdcValue() + dvalue, 0, 127));
                 break;
+            case eAdcSelect_VelocityStart:
+                Keyboard.SetVelocityStartValue(utli::Clamp(Keyboard.GetVelocityStartValue() + dvalue, 0, 255));
+                break;
+            case eAdcSelect_VelocityFast:
+                Keyboard.SetVelocityCurve(utli::Clamp(Keyboard.GetVelocityFastTime() + dvalue, 1, 2000), Keyboard.GetVelocitySlowTime());
+                break;
+            case eAdcSelect_VelocitySlow:
+                Keyboard.SetVelocityCurve(Keyboard.GetVelocityFastTime(), utli::Clamp(Keyboard.GetVelocitySlowTime() + dvalue * 10, 2, 2000));
+                break;
             }
             break;
         case ePage_TouchPad:
@@ -323,6 +356,16 @@ void CSettings::OnSelect() {
             case eMPE_PitchBendRange:
                 dsp::SynthParams.pitchBend.Add(dvalue, false);
                 break;
+            case eMPE_BlockSize: {
+                int32_t idx = 0;
+                auto blockSize = bsp::PCM5102.GetBlockSize();
+                while (idx < static_cast<int32_t>(std::size(kBlockSizeOptions)) - 1 && kBlockSizeOptions[idx] < blockSize) {
+                    ++idx;
+                }
+                idx = utli::Clamp(idx + dvalue, 0, static_cast<int32_t>(std::size(kBlockSizeOptions)) - 1);
+                bsp::PCM5102.RequestBlockSize(kBlockSizeOptions[idx]);
+                break;
+            }
             }
             break;
         }
@@ -42,14 +42,15 @@ void CString::OnSelect() {
 
     auto& io = bsp::ControlIO;
     io.SetEncoderCallback(bsp::EncoderId::kParam, [](int32_t dvalue){
+        String.Redraw(StyleDrawer::GetKnobRect(String.selectIdx_));
         String.selectIdx_ += dvalue;
         if (String.selectIdx_ < 0) String.selectIdx_ = 0;
         if (String.selectIdx_ >= String.totalKnobs_) String.selectIdx_ = String.totalKnobs_ - 1;
-        String.Redraw();
+        String.Redraw(StyleDrawer::GetKnobRect(String.selectIdx_));
     });
     io.SetEncoderCallback(bsp::EncoderId::kValue, [](int32_t dvalue){
         String.knobs_[String.selectIdx_].Add(dvalue, false);
-        String.Redraw();
+        String.Redraw(StyleDrawer::GetKnobRect(String.selectIdx_));
     });
     io.SetButtonCallback(bsp::ButtonId::kBtn0, [](bsp::ButtonEventArgs args) {
         if (args.IsAttack()) {
@@ -64,9 +65,9 @@ void CString::OnSelect() {
 }
 
 void CString::OnTimeTick(uint32_t msEscape) {
-    for (auto& k : knobs_) {
-        if (k.Tick(msEscape)) {
-            String.Redraw();
+    for (uint32_t i = 0; i < std::size(knobs_); ++i) {
+        if (knobs_[i].Tick(msEscape)) {
+            Redraw(StyleDrawer::GetKnobRect(i));
         }
     }
 }
@@ -28,6 +28,10 @@ void StyleDrawer::DrawButton(Rectange aera, bool on, std::string_view text) {
 }
 
 void StyleDrawer::DrawSlider(Rectange aera, int16_t width, std::string_view text) {
+    if (!NeedDraw(aera)) {
+        display.setColor(kOledWHITE);
+        return;
+    }
     auto box = aera;
     box.Reduced(1, 1);
     display.setColor(kOledWHITE);
@@ -43,6 +47,10 @@ void StyleDrawer::DrawSlider(Rectange aera, int16_t width, std::string_view text
 
 void StyleDrawer::DrawTitleBar(std::string_view text) {
     auto aera = display.GetDrawAera().WithHeight(12);
+    if (!NeedDraw(aera)) {
+        display.setColor(kOledBLACK);
+        return;
+    }
     display.setColor(kOledWHITE);
     display.fillRect(aera.x, aera.y, aera.w, aera.h);
     display.setColor(kOledBLACK);
@@ -51,6 +59,7 @@ void StyleDrawer::DrawTitleBar(std::string_view text) {
 
 void StyleDrawer::DrawBottomOptions(uint32_t idx, std::string_view text) {
     display.setColor(kOledWHITE);
+    if (!NeedDraw(GetBottomRect(idx))) return;
     auto x = idx * display.getWidth() / 5;
     display.drawString(x, display.getHeight() - 12, text);
 }
@@ -63,6 +72,12 @@ Rectange StyleDrawer::GetBottomRect(uint32_t idx) {
     return Rectange(x, y, w, 12);
 }
 
+Rectange StyleDrawer::GetKnobRect(uint32_t idx) {
+    constexpr int16_t w = OLEDDisplay::kWidth / 4;
+    constexpr int16_t h = (OLEDDisplay::kHeight - 24) / 3;
+    return Rectange(idx % 4 * w, 12 + idx / 4 * h, w, h);
+}
+
 void StyleDrawer::Inverse(Rectange rect) {
     auto c = display.getColor();
     display.setColor(kOledINVERSE);
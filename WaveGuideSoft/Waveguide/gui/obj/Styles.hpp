@@ -15,9 +15,13 @@ struct StyleDrawer {
     void DrawTitleBar(std::string_view text);
     void DrawBottomOptions(uint32_t idx, std::string_view text);
     Rectange GetBottomRect(uint32_t idx);
+    // 标题栏和底部选项之间 3行4列的旋钮格子
+    static Rectange GetKnobRect(uint32_t idx);
 
     void Inverse(Rectange rect);
     void InverseFrame(Rectange rect);
+    // 和这次重画的区域不相交时可以不画
+    bool NeedDraw(Rectange aera) const { return display.GetClipRect().Intersects(aera); }
 
     explicit StyleDrawer(OLEDDisplay& display) : display(display) {}
     OLEDDisplay& display;
@@ -14,6 +14,10 @@ static constexpr float kEndAngle = -std::numbers::pi_v<float> / 4.0f;
 static constexpr float kBeginAngle = 5.0f * std::numbers::pi_v<float> / 4.0f;
 
 void gui::TimeKnob::Draw(OLEDDisplay& display, Rectange aera) {
+    if (!display.GetClipRect().Intersects(aera)) {
+        display.setColor(OledColorEnum::kOledWHITE);
+        return;
+    }
     if (obj_ == nullptr) {
         display.setColor(OledColorEnum::kOledWHITE);
         display.drawRect(aera.x, aera.y, aera.w, aera.h);
@@ -83,6 +87,7 @@ void gui::TimeKnob::Draw(OLEDDisplay& display, dsp::IntParamDesc& desc, Rectange
 
 void gui::TimeKnob::DrawWTF(OLEDDisplay &display, dsp::IntParamDesc &desc, Rectange aera, std::span<const std::string_view> str) {
     display.setColor(OledColorEnum::kOledWHITE);
+    if (!display.GetClipRect().Intersects(aera)) return;
     auto oldAlign = display.GetTextAlignment();
     display.setTextAlignment(OledDisplayTextAlignEnum::kXCenter);
 
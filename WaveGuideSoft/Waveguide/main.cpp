@@ -12,8 +12,13 @@
 #include "gui/obj/Scope.hpp"
 
 #include "dsp/Synth.hpp"
+#include "dsp/PcmWriter.hpp"
+#include "dsp/Tuning.hpp"
 #include "utli/Clamp.hpp"
 #include "utli/Map.hpp"
+#include "utli/Profiler.hpp"
+#include "utli/FlightRecorder.hpp"
+#include "utli/Governor.hpp"
 
 #include "FreeRTOS.h"
 #include "task.h"
@@ -22,6 +27,8 @@
 #include "MemAttributes.hpp"
 #include "SystemHook.hpp"
 #include "MidiManager.hpp"
+#include "PresetTransfer.hpp"
+#include "PresetBank.hpp"
 #include <cmath>
 
 using bsp::Debug;
@@ -31,9 +38,48 @@ using bsp::Debug;
 // --------------------------------------------------------------------------------
 static StaticTask_t dacTaskBuffer;
 MEM_NOINIT_SRAMD1 static StackType_t dacTaskStack[8192];
-static float synthBuffer[bsp::CPCM5102::kBlockSize];
-static float auxSynthBuffer[bsp::CPCM5102::kBlockSize];
+static float synthBuffer[bsp::CPCM5102::kMaxBlockSize];
 static float volume_ = 1.0f;
+
+static void RenderBlock(std::span<StereoSample> block, utli::CFlightRecorder::BlockRecord& record) {
+    using bsp::PCM5102;
+    PROFILE_SCOPE(utli::ProfileStage::kBlock);
+    const uint32_t blockSize = block.size();
+    std::span synth{ synthBuffer, blockSize };
+
+    // 上一个block周期内到达的事件, 按到达时间延迟一个block播放
+    static dsp::NoteEvent events[dsp::CSynth::kMaxEventsPerBlock];
+    uint32_t blockTime = PCM5102.GetBlockTime();
+    MidiManager.Lock();
+    uint32_t numEvents = MidiManager.PopEvents(blockTime, events);
+    MidiManager.Unlock();
+    record.numEvents = numEvents;
+
+    // handle parameter changes
+    {
+        PROFILE_SCOPE(utli::ProfileStage::kParamCallbacks);
+        dsp::Synth.PrepareInstrument();
+        record.numParamChanges = dsp::gSafeCallback.HandleDirtyCallbacks();
+    }
+
+    // process audio, 混响之后直接写入DMA缓冲
+    dsp::PcmWriter output{ block, volume_ };
+    dsp::Synth.Process(synth, std::span{events, numEvents}, blockTime - blockSize, output);
+    record.numVoices = dsp::Synth.GetNumActiveVoices();
+
+    {
+        PROFILE_SCOPE(utli::ProfileStage::kScope);
+        gui::Scope.Push(std::span<const StereoSample>{ block });
+    }
+}
+
+// block大小改变后更新与block周期相关的部分
+static void OnBlockSizeChanged() {
+    using bsp::PCM5102;
+    uint32_t blockSize = PCM5102.GetBlockSize();
+    utli::Governor.Init(utli::CProfiler::UsToTicks(blockSize * 1000000 / PCM5102.kSampleRate));
+}
+
 static void DACTaskInit() {
     APP_LOG("main", "start dac");
     dsp::SynthParams.volume.SetCallback([] {
@@ -43,93 +89,46 @@ static void DACTaskInit() {
     xTaskCreateStatic(
         [](void*) {
             using bsp::PCM5102;
+            using utli::FlightRecorder;
             PCM5102.Init();
             dsp::Synth.Init(PCM5102.kSampleRate);
-            MidiManager.Init(PCM5102.kSampleRate / PCM5102.kBlockSize);
+            // 只初始化开机时的乐器, 其他乐器切换过去时再初始化
+            dsp::Synth.PrepareInstrument();
+            utli::Profiler.Init();
+            MidiManager.Init(PCM5102.kSampleRate / PCM5102.GetBlockSize());
+            OnBlockSizeChanged();
             dsp::gSafeCallback.MarkAll();
             PCM5102.Start();
             for (;;) {
                 auto block = PCM5102.GetNextBlock();
                 TickType_t tickBegin = xTaskGetTickCount();
 
-                // handle datas
-                MidiManager.Lock();
-                MidiManager.BackupState();
-                MidiManager.Unlock();
-                
-                { // handle notes
-                    auto diff = MidiManager.GetDiff0();
-                    while (diff) {
-                        auto idx = __builtin_ctzl(diff);
-                        if (MidiManager.GetVelocity(idx) > 0) {
-                            dsp::Synth.NoteOn(MidiManager.GetChannelOfNote(idx), idx, MidiManager.GetVelocity(idx));
-                        }
-                        else {
-                            dsp::Synth.NoteOff(idx);
-                        }
-                        diff &= ~(MidiManager.kOne << idx);
-                    }
-                    diff = MidiManager.GetDiff1();
-                    while (diff) {
-                        auto idx = __builtin_ctzl(diff);
-                        auto note = idx + 32;
-                        if (MidiManager.GetVelocity(note) > 0) {
-                            dsp::Synth.NoteOn(MidiManager.GetChannelOfNote(note), note, MidiManager.GetVelocity(note));
-                        }
-                        else {
-                            dsp::Synth.NoteOff(note);
-                        }
-                        diff &= ~(MidiManager.kOne << idx);
-                    }
-                    diff = MidiManager.GetDiff2();
-                    while (diff) {
-                        auto idx = __builtin_ctzl(diff);
-                        auto note = idx + 64;
-                        if (MidiManager.GetVelocity(note) > 0) {
-                            dsp::Synth.NoteOn(MidiManager.GetChannelOfNote(note), note, MidiManager.GetVelocity(note));
-                        }
-                        else {
-                            dsp::Synth.NoteOff(note);
-                        }
-                        diff &= ~(MidiManager.kOne << idx);
-                    }
-                    diff = MidiManager.GetDiff3();
-                    while (diff) {
-                        auto idx = __builtin_ctzl(diff);
-                        auto note = idx + 96;
-                        if (MidiManager.GetVelocity(note) > 0) {
-                            dsp::Synth.NoteOn(MidiManager.GetChannelOfNote(note), note, MidiManager.GetVelocity(note));
-                        }
-                        else {
-                            dsp::Synth.NoteOff(note);
-                        }
-                        diff &= ~(MidiManager.kOne << idx);
-                    }
+                utli::CFlightRecorder::BlockRecord record{};
+                record.seq = PCM5102.GetBlockSeq();
+                record.quality = dsp::Synth.GetQualityLevel();
+                uint32_t renderBegin = utli::CProfiler::Now();
+                RenderBlock(block, record);
+                uint32_t renderTicks = utli::CProfiler::Now() - renderBegin;
+                PROFILE_END_BLOCK();
+
+                // 检查欠载, 发生时冻结最近的记录
+                record.late = !PCM5102.FinishBlock();
+                for (uint32_t i = 0; i < utli::CProfiler::kNumStages; ++i) {
+                    record.stageTicks[i] = utli::Profiler.GetLastBlockTicks(static_cast<utli::ProfileStage>(i));
                 }
-
-                // handle parameter changes
-                dsp::gSafeCallback.HandleDirtyCallbacks();
-
-                // process audio
-                dsp::Synth.Process(synthBuffer, auxSynthBuffer);
-
-                // mix in
-                for (uint32_t i = 0; i < bsp::CPCM5102::kBlockSize; i++) {
-                    synthBuffer[i] *= volume_;
-                    auto left = synthBuffer[i] * 16384;
-                    left = dsp::ClampUncheck(left, -32768, 32767);
-                    auto iLeft = static_cast<int16_t>(left);
-                    block[i].left = iLeft;
-                    auxSynthBuffer[i] *= volume_;
-                    auto right = auxSynthBuffer[i] * 16384;
-                    right = dsp::ClampUncheck(right, -32768, 32767);
-                    auto iRight = static_cast<int16_t>(right);
-                    block[i].right = iRight;
+                FlightRecorder.Push(record);
+                if (record.late) {
+                    FlightRecorder.Trigger();
                 }
-                gui::Scope.Push(std::span{synthBuffer, bsp::CPCM5102::kBlockSize});
+                // 根据本block耗时决定下一个block的音质
+                dsp::Synth.SetQualityLevel(utli::Governor.Update(renderTicks, record.late));
 
                 TickType_t tickEnd = xTaskGetTickCount();
                 gui::Main.SetDacTaskMs(pdTICKS_TO_MS(tickEnd - tickBegin));
+
+                if (PCM5102.ApplyBlockSizeRequest()) {
+                    OnBlockSizeChanged();
+                }
             }
         },
         "DAC",
@@ -146,6 +145,39 @@ static void DACTaskInit() {
 // --------------------------------------------------------------------------------
 static StaticTask_t usbMidiTaskBuffer;
 MEM_NOINIT_SRAMD1 static StackType_t usbMidiTaskStack[1024];
+static StaticTask_t usbMidiRxTaskBuffer;
+MEM_NOINIT_SRAMD1 static StackType_t usbMidiRxTaskStack[1024];
+
+static void OnUSBMidiReceived(std::span<const bsp::MidiEvent> events) {
+    for (const auto& e : events) {
+        switch (e.GetType()) {
+        case bsp::MidiEvent::Type::kNoteOn:
+            // 键盘任务也会写事件队列, NoteOn 自己加锁
+            MidiManager.NoteOn(e.GetChannel(), e.GetNote(), e.GetVelocity());
+            gui::Main.NoteOn(e.GetNote());
+            break;
+        case bsp::MidiEvent::Type::kNoteOff:
+            MidiManager.NoteOff(e.GetChannel(), e.GetNote());
+            gui::Main.NoteOff(e.GetNote());
+            break;
+        case bsp::MidiEvent::Type::kPitchBend:
+            MidiManager.SetTouchSliderPos(e.GetChannel(), (e.GetPitchBend() - 8192) / 8192.0f);
+            break;
+        case bsp::MidiEvent::Type::kPressure:
+            MidiManager.SetPressure(e.GetChannel(), e.data2);
+            break;
+        case bsp::MidiEvent::Type::kCC:
+            MidiManager.SetCC(e.GetChannel(), e.data2, e.data3);
+            break;
+        default:
+            if (e.IsSysEx()) {
+                PresetTransfer.Receive(e);
+            }
+            break;
+        }
+    }
+}
+
 static void USBMidiTaskInit() {
     APP_LOG("main", "start usb");
     xTaskCreateStatic(
@@ -153,31 +185,24 @@ static void USBMidiTaskInit() {
             using bsp::USBMidi;
 
             USBMidi.Init();
-            USBMidi.SetMidiReciveIRQ([](std::span<const bsp::MidiEvent> events) {
-                for (const auto& e : events) {
-                    switch (e.GetType()) {
-                    case bsp::MidiEvent::Type::kNoteOn:
-                        MidiManager.NoteOn(e.GetChannel(), e.GetNote(), e.GetVelocity());
-                        gui::Main.NoteOn(e.GetNote());
-                        break;
-                    case bsp::MidiEvent::Type::kNoteOff:
-                        MidiManager.NoteOff(e.GetChannel(), e.GetNote());
-                        gui::Main.NoteOff(e.GetNote());
-                        break;
-                    case bsp::MidiEvent::Type::kPitchBend:
-                        MidiManager.SetTouchSliderPos(e.GetChannel(), (e.GetPitchBend() - 8192) / 8192.0f);
-                        break;
-                    case bsp::MidiEvent::Type::kPressure:
-                        MidiManager.SetPressure(e.GetChannel(), e.data2);
-                        break;
-                    case bsp::MidiEvent::Type::kCC:
-                        MidiManager.SetCC(e.GetChannel(), e.data2, e.data3);
-                        break;
-                    default:
-                        break;
+            USBMidi.SetMidiReceiveCallback(OnUSBMidiReceived);
+            PresetTransfer.Init();
+            // 接收在单独的任务中解析, 发送会阻塞等待上一包完成
+            xTaskCreateStatic(
+                [](void*) {
+                    for (;;) {
+                        // 预设传输还有数据没放进发送队列时, 定期回来继续
+                        bsp::USBMidi.ProcessReceived(PresetTransfer.IsBusy() ? 1 : bsp::USBMidi.kWaitForever);
+                        PresetTransfer.Poll();
                     }
-                }
-            });
+                },
+                "USBMidiRx",
+                std::size(usbMidiRxTaskStack),
+                nullptr,
+                2,
+                usbMidiRxTaskStack,
+                &usbMidiRxTaskBuffer
+            );
             for (;;) {
                 USBMidi.SendData();
             }
@@ -225,6 +250,12 @@ static void LCDTaskInit() {
                 if (shouldSendBuffer) {
                     UC1638.UpdateScreen();
                 }
+                // 音律或者环路参数改变后重建音符表, 琴体改变后重建commuted激励
+                dsp::Tuning.RebuildIfDirty();
+                dsp::Body::RebuildCommutedIfDirty();
+                // SysEx传输请求的保存, 擦除扇区时只有界面停住
+                PresetBank.SaveIfRequested();
+                utli::FlightRecorder.DumpIfTriggered();
             }
         },
         "LCD",
@@ -247,7 +278,8 @@ static void MPR121TaskInit() {
         [](void*) {
             using bsp::MPR121;
 
-            constexpr auto kInterval = 20;
+            // 每个芯片一次DMA读取, 可以跑到200Hz
+            constexpr auto kInterval = 5;
             constexpr auto kFreq = 1000 / kInterval;
             MPR121.Init(kFreq);
             TickType_t lastTick = xTaskGetTickCount();
@@ -276,7 +308,7 @@ static void MPR121TaskInit() {
                 }
 
                 MidiManager.Unlock();
-                vTaskDelayUntil(&lastTick, pdMS_TO_TICKS(20));
+                vTaskDelayUntil(&lastTick, pdMS_TO_TICKS(kInterval));
             }
         },
         "MPR121",
@@ -301,7 +333,8 @@ static void KeyboardTaskInit() {
             using gui::Main;
             using bsp::USBMidi;
 
-            static constexpr uint32_t timeInterval = 10;
+            // 扫描在中断里进行, 这里只取结果和处理, 1kHz
+            static constexpr uint32_t timeInterval = 1;
             static constexpr uint32_t dataRate = 1000 / timeInterval;
 
             Keyboard.Init(dataRate);
@@ -316,27 +349,34 @@ static void KeyboardTaskInit() {
                 USBMidi.WriteNoteOff(channel, note, 0);
                 gui::Main.NoteOff(keyIdx);
             });
-            Keyboard.SetKeyDownCallback([](uint8_t keyIdx) {
+            Keyboard.SetKeyDownCallback([](uint8_t keyIdx, uint8_t velocity) {
                 Main.NoteOn(keyIdx);
                 auto note = keyIdx + 12 * Main.octave;
-                auto channel = MidiManager.NoteOn(note, 120);
+                auto channel = MidiManager.NoteOn(note, velocity);
                 if (!Keyboard.IsMPEEnabled()) {
                     channel = 0;
                 }
-                USBMidi.WriteNoteOn(channel, note, 120);
+                else {
+                    // MPE的弯音和压力要在note on之前
+                    USBMidi.WritePitchBendScaled(channel, Keyboard.GetFingerPosition(keyIdx));
+                    USBMidi.WriteChannelPressure(channel, Keyboard.GetPressure(keyIdx));
+                }
+                USBMidi.WriteNoteOn(channel, note, velocity);
                 gui::Main.NoteOn(keyIdx);
             });
 
             TickType_t tmp = xTaskGetTickCount();
             for (;;) {
+                // 按键数据只在这个任务中读写, 不需要关中断
+                // NoteOn/NoteOff 和 USBMidi 自己加锁, 这里只锁 MidiManager 的短更新
                 Keyboard.UpdateData();
-                taskENTER_CRITICAL();
                 Keyboard.ProcessData();
 
                 for (uint32_t i = 0; i < Keyboard.kNumKeys; ++i) {
                     if (!Keyboard.IsKeyPressed(i)) continue;
 
                     if (MidiManager.IsPlay()) {
+                        MidiManager.Lock();
                         if (Keyboard.IsMPEEnabled()) {
                             MidiManager.SetPressure(i, Keyboard.GetPressure(i));
                             MidiManager.SetTouchSliderPos(i, Keyboard.GetFingerPosition(i));
@@ -348,13 +388,15 @@ static void KeyboardTaskInit() {
                                 MidiManager.SetPressure(0, Keyboard.GetPressure(i));
                             }
                         }
+                        MidiManager.Unlock();
                     }
 
                     if (Keyboard.IsMPEEnabled()) {
                         auto note = i + 12 * Main.octave;
-                        if (MidiManager.kInvalidChannel != MidiManager.GetChannelOfNote(note)) {
-                            USBMidi.WritePitchBendScaled(MidiManager.GetChannelOfNote(note), Keyboard.GetFingerPosition(i));
-                            USBMidi.WriteChannelPressure(MidiManager.GetChannelOfNote(note), Keyboard.GetPressure(i));
+                        const auto channel = MidiManager.GetChannelOfNote(note);
+                        if (MidiManager.kInvalidChannel != channel) {
+                            USBMidi.WritePitchBendScaled(channel, Keyboard.GetFingerPosition(i));
+                            USBMidi.WriteChannelPressure(channel, Keyboard.GetPressure(i));
                         }
                     }
                     else {
@@ -363,7 +405,6 @@ static void KeyboardTaskInit() {
                         USBMidi.WritePolyAfterTouch(0, note, Keyboard.GetPressure(i));
                     }
                 }
-                taskEXIT_CRITICAL();
                 USBMidi.NotifySend(false);
                 vTaskDelayUntil(&tmp, pdMS_TO_TICKS(timeInterval));
             }
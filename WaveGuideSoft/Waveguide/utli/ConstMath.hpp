@@ -0,0 +1,60 @@
+#pragma once
+#include <cstdint>
+#include <numbers>
+
+namespace utli {
+
+// 编译期生成表用的数学函数, double精度, 运行时也能调用但比标准库慢
+
+static constexpr double ConstSqrt(double x) {
+    if (x <= 0.0) return 0.0;
+    double y = x > 1.0 ? x : 1.0;
+    for (uint32_t i = 0; i < 64; ++i) {
+        double next = 0.5 * (y + x / y);
+        if (next == y) break;
+        y = next;
+    }
+    return y;
+}
+
+static constexpr double ConstExp(double x) {
+    // x = k * ln2 + r, |r| <= ln2 / 2
+    constexpr double kLn2 = std::numbers::ln2;
+    int32_t k = static_cast<int32_t>(x / kLn2 + (x >= 0.0 ? 0.5 : -0.5));
+    double r = x - k * kLn2;
+    double term = 1.0;
+    double sum = 1.0;
+    for (uint32_t n = 1; n < 24; ++n) {
+        term *= r / n;
+        sum += term;
+    }
+    for (; k > 0; --k) sum *= 2.0;
+    for (; k < 0; ++k) sum *= 0.5;
+    return sum;
+}
+
+static constexpr double ConstPow10(double x) {
+    return ConstExp(x * std::numbers::ln10);
+}
+
+static constexpr double ConstSin(double x) {
+    constexpr double kPi = std::numbers::pi;
+    // 先归到 [-pi, pi]
+    int64_t turns = static_cast<int64_t>(x / (2.0 * kPi));
+    x -= turns * 2.0 * kPi;
+    if (x > kPi) x -= 2.0 * kPi;
+    if (x < -kPi) x += 2.0 * kPi;
+    double term = x;
+    double sum = x;
+    for (uint32_t n = 1; n < 24; ++n) {
+        term *= -x * x / ((2 * n) * (2 * n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+static constexpr double ConstCos(double x) {
+    return ConstSin(x + std::numbers::pi / 2.0);
+}
+
+}
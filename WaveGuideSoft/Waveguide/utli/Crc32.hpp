@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+#include <array>
+#include <span>
+
+namespace utli {
+
+// CRC-32 (IEEE 802.3, 和zlib相同), 表在编译期生成
+namespace internal {
+static constexpr std::array<uint32_t, 256> kCrc32Table = [] {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (uint32_t k = 0; k < 8; ++k) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        table[i] = c;
+    }
+    return table;
+}();
+}
+
+/**
+ * @brief 分段计算时把上一段的返回值作为 crc 传入
+ */
+static constexpr uint32_t Crc32(std::span<const uint8_t> data, uint32_t crc = 0) {
+    crc = ~crc;
+    for (auto b : data) {
+        crc = internal::kCrc32Table[(crc ^ b) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+}
@@ -0,0 +1,44 @@
+#include "FlightRecorder.hpp"
+#include <algorithm>
+#include "bsp/DebugIO.hpp"
+
+namespace utli {
+
+void CFlightRecorder::Trigger() {
+    ++numTriggers_;
+    if (snapshotReady_.load(std::memory_order_acquire)) {
+        ++numDropped_;
+        return;
+    }
+
+    // 按时间顺序复制, 最旧的在前
+    snapshotSize_ = std::min(writePos_, kNumRecords);
+    uint32_t begin = writePos_ - snapshotSize_;
+    for (uint32_t i = 0; i < snapshotSize_; ++i) {
+        snapshot_[i] = records_[(begin + i) % kNumRecords];
+    }
+    snapshotReady_.store(true, std::memory_order_release);
+}
+
+void CFlightRecorder::DumpIfTriggered() {
+    if (!snapshotReady_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    bsp::Debug.XWriteLine("[underrun] #{} dropped:{}", numTriggers_, numDropped_);
+    bsp::Debug.XWriteLine("[underrun] seq late quality voices events params block/note/param/voice/body/reverb/scope us");
+    for (uint32_t i = 0; i < snapshotSize_; ++i) {
+        const auto& r = snapshot_[i];
+        auto us = [&r](ProfileStage stage) {
+            return CProfiler::TicksToUs(r.stageTicks[static_cast<uint32_t>(stage)]);
+        };
+        auto voiceUs = us(ProfileStage::kString) + us(ProfileStage::kBowed) + us(ProfileStage::kReed);
+        bsp::Debug.XWriteLine("[underrun] {} {} {} {} {} {} {}/{}/{}/{}/{}/{}/{}",
+            r.seq, r.late ? 1 : 0, r.quality, r.numVoices, r.numEvents, r.numParamChanges,
+            us(ProfileStage::kBlock), us(ProfileStage::kNoteEvents), us(ProfileStage::kParamCallbacks),
+            voiceUs, us(ProfileStage::kBody), us(ProfileStage::kReverb), us(ProfileStage::kScope));
+    }
+    snapshotReady_.store(false, std::memory_order_release);
+}
+
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "Profiler.hpp"
+
+namespace utli {
+
+/**
+ * @brief 记录最近 kNumRecords 个音频block的状态, 发生欠载时冻结一份快照
+ * Push/Trigger 只在DAC任务调用, DumpIfTriggered 在低优先级任务调用
+ */
+class CFlightRecorder {
+public:
+    static constexpr uint32_t kNumRecords = 32;
+
+    struct BlockRecord {
+        uint32_t seq;
+        uint32_t stageTicks[CProfiler::kNumStages];
+        uint16_t numParamChanges;
+        uint8_t numVoices;
+        uint8_t numEvents;
+        uint8_t quality;
+        bool late;
+    };
+
+    void Push(const BlockRecord& record) {
+        records_[writePos_ % kNumRecords] = record;
+        ++writePos_;
+    }
+
+    /**
+     * @brief 冻结当前记录, 上一份快照还没输出时丢弃
+     */
+    void Trigger();
+    void DumpIfTriggered();
+    uint32_t GetNumTriggers() const { return numTriggers_; }
+    uint32_t GetNumDropped() const { return numDropped_; }
+private:
+    BlockRecord records_[kNumRecords]{};
+    uint32_t writePos_{};
+
+    BlockRecord snapshot_[kNumRecords]{};
+    uint32_t snapshotSize_{};
+    std::atomic<bool> snapshotReady_{};
+    uint32_t numTriggers_{};
+    uint32_t numDropped_{};
+};
+
+namespace internal {
+struct InternalFlightRecorder {
+    inline static CFlightRecorder instance;
+};
+}
+
+static auto& FlightRecorder = internal::InternalFlightRecorder::instance;
+
+}
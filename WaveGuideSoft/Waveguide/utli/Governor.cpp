@@ -0,0 +1,41 @@
+#include "Governor.hpp"
+#include <algorithm>
+
+namespace utli {
+
+void CGovernor::Init(uint32_t budgetTicks) {
+    budgetTicks_ = std::max(budgetTicks, 1u);
+    level_ = 0;
+    loadPercent_ = 0;
+    overCount_ = 0;
+    underCount_ = 0;
+}
+
+uint32_t CGovernor::Update(uint32_t renderTicks, bool late) {
+    loadPercent_ = static_cast<uint32_t>(static_cast<uint64_t>(renderTicks) * 100 / budgetTicks_);
+
+    if (late || loadPercent_ > kDegradePercent) {
+        underCount_ = 0;
+        ++overCount_;
+        if ((late || overCount_ >= kDegradeBlocks) && level_ < kMaxLevel) {
+            ++level_;
+            overCount_ = 0;
+        }
+    }
+    else if (loadPercent_ < kRecoverPercent) {
+        overCount_ = 0;
+        ++underCount_;
+        if (underCount_ >= kRecoverBlocks && level_ > 0) {
+            --level_;
+            underCount_ = 0;
+        }
+    }
+    else {
+        // 在两个阈值之间保持不变
+        overCount_ = 0;
+        underCount_ = 0;
+    }
+    return level_;
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+namespace utli {
+
+/**
+ * @brief 根据每个block的渲染耗时调整音质等级, 防止欠载
+ * 连续超过上限时降一级, 连续低于下限较长时间才升一级
+ * 0: 完整音质
+ * 1: 安静的弦改用一阶损耗滤波, 旁路很弱的色散
+ * 2: 混响velvet抽头减半
+ * 3: 琴体卷积分段减半
+ * 4: 限制复音数
+ */
+class CGovernor {
+public:
+    static constexpr uint32_t kMaxLevel = 4;
+    // 占截止时间的百分比
+    static constexpr uint32_t kDegradePercent = 85;
+    static constexpr uint32_t kRecoverPercent = 60;
+    static constexpr uint32_t kDegradeBlocks = 2;
+    static constexpr uint32_t kRecoverBlocks = 64;
+
+    void Init(uint32_t budgetTicks);
+    /**
+     * @brief 每个block调用一次
+     * @param renderTicks 本block渲染耗时
+     * @param late 本block已经欠载, 直接降级
+     * @return 新的等级
+     */
+    uint32_t Update(uint32_t renderTicks, bool late);
+    uint32_t GetLevel() const { return level_; }
+    uint32_t GetLoadPercent() const { return loadPercent_; }
+private:
+    uint32_t budgetTicks_{ 1 };
+    uint32_t level_{};
+    uint32_t loadPercent_{};
+    uint32_t overCount_{};
+    uint32_t underCount_{};
+};
+
+namespace internal {
+struct InternalGovernor {
+    inline static CGovernor instance;
+};
+}
+
+static auto& Governor = internal::InternalGovernor::instance;
+
+}
@@ -0,0 +1,103 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include "bsp/DebugIO.hpp"
+
+static_assert(utli::CProfiler::BucketOf(0xffffffff) < utli::CProfiler::kNumBuckets);
+static_assert(utli::CProfiler::BucketLowerBound(utli::CProfiler::BucketOf(1000)) <= 1000);
+
+namespace utli {
+
+static constexpr const char* kStageNames[] {
+    "note", "param", "string", "bowed", "reed", "body", "reverb", "scope", "block"
+};
+static_assert(std::size(kStageNames) == CProfiler::kNumStages);
+
+void CProfiler::Init() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    Clear();
+}
+
+void CProfiler::Clear() {
+    for (auto& h : histograms_) {
+        h = Histogram{};
+        h.min = UINT32_MAX;
+    }
+    std::fill_n(pending_, kNumStages, 0);
+    std::fill_n(last_, kNumStages, 0);
+    touched_ = 0;
+}
+
+void CProfiler::EndBlock() {
+    // 这个block的计时也一起丢掉
+    if (resetRequested_.exchange(false, std::memory_order_acquire)) {
+        Clear();
+        return;
+    }
+    std::fill_n(last_, kNumStages, 0);
+    while (touched_) {
+        auto idx = __builtin_ctz(touched_);
+        touched_ &= ~(1u << idx);
+        auto v = pending_[idx];
+        pending_[idx] = 0;
+        last_[idx] = v;
+
+        auto& h = histograms_[idx];
+        h.min = std::min(h.min, v);
+        h.max = std::max(h.max, v);
+        h.sum += v;
+        ++h.count;
+        ++h.buckets[BucketOf(v)];
+    }
+}
+
+CProfiler::Stats CProfiler::GetStats(ProfileStage stage) const {
+    const auto& h = histograms_[static_cast<uint32_t>(stage)];
+    if (h.count == 0) {
+        return Stats{};
+    }
+
+    Stats s{};
+    s.min = h.min;
+    s.max = h.max;
+    s.count = h.count;
+    s.avg = static_cast<uint32_t>(h.sum / h.count);
+    // 取第一个累计超过99%的桶的上界
+    uint32_t target = h.count - h.count / 100;
+    uint32_t accum = 0;
+    for (uint32_t i = 0; i < kNumBuckets; ++i) {
+        accum += h.buckets[i];
+        if (accum >= target) {
+            uint32_t upper = i + 1 < kNumBuckets ? BucketLowerBound(i + 1) - 1 : UINT32_MAX;
+            s.p99 = std::min(upper, h.max);
+            break;
+        }
+    }
+    return s;
+}
+
+void CProfiler::Dump() const {
+    bsp::Debug.XWriteLine("[profile] stage min/avg/p99/max us, blocks");
+    for (uint32_t i = 0; i < kNumStages; ++i) {
+        auto stage = static_cast<ProfileStage>(i);
+        auto s = GetStats(stage);
+        bsp::Debug.XWriteLine("[profile] {} {}/{}/{}/{} {}", GetStageName(stage),
+            TicksToUs(s.min), TicksToUs(s.avg), TicksToUs(s.p99), TicksToUs(s.max), s.count);
+    }
+}
+
+const char* CProfiler::GetStageName(ProfileStage stage) {
+    return kStageNames[static_cast<uint32_t>(stage)];
+}
+
+uint32_t CProfiler::TicksToUs(uint32_t ticks) {
+    return ticks / (SystemCoreClock / 1000000);
+}
+
+uint32_t CProfiler::UsToTicks(uint32_t us) {
+    return us * (SystemCoreClock / 1000000);
+}
+
+}
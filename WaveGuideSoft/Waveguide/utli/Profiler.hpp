@@ -0,0 +1,136 @@
+#pragma once
+#include <cstdint>
+#include <atomic>
+#include "stm32h7xx.h"
+
+// 编译时关闭后 PROFILE_SCOPE 为空, 不产生任何代码
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE 0
+#endif
+
+namespace utli {
+
+enum class ProfileStage : uint8_t {
+    kNoteEvents = 0,
+    kParamCallbacks,
+    kString,
+    kBowed,
+    kReed,
+    kBody,
+    // 混响; DAC任务中和音量、写入PCM缓冲是同一个循环, 一起计时
+    kReverb,
+    // 示波器界面的数据复制
+    kScope,
+    kBlock,
+    kNumStages
+};
+
+/**
+ * @brief 每个block的分阶段耗时统计
+ * 用DWT周期计数器计时, 同一个block内多次进入的阶段会累加, EndBlock时写入直方图
+ * 统计只在DAC任务中写, 其他任务通过 RequestReset 清空
+ */
+class CProfiler {
+public:
+    static constexpr uint32_t kNumStages = static_cast<uint32_t>(ProfileStage::kNumStages);
+    // 对数-线性分桶, 每个2的幂分4个桶
+    static constexpr uint32_t kSubBits = 2;
+    static constexpr uint32_t kNumSub = 1 << kSubBits;
+    static constexpr uint32_t kNumBuckets = (32 - kSubBits + 1) * kNumSub;
+
+    struct Stats {
+        uint32_t min;
+        uint32_t avg;
+        uint32_t p99;
+        uint32_t max;
+        uint32_t count;
+    };
+
+    void Init();
+    // 可以在其他任务中调用, 下一次 EndBlock 时在DAC任务中清空
+    void RequestReset() { resetRequested_.store(true, std::memory_order_release); }
+    void EndBlock();
+    Stats GetStats(ProfileStage stage) const;
+    // 最近一个block的耗时, 没有进入的阶段为0
+    uint32_t GetLastBlockTicks(ProfileStage stage) const { return last_[static_cast<uint32_t>(stage)]; }
+    // 打印到DebugIO, 单位us
+    void Dump() const;
+
+    static const char* GetStageName(ProfileStage stage);
+    static uint32_t TicksToUs(uint32_t ticks);
+    static uint32_t UsToTicks(uint32_t us);
+
+    // 计数器总是打开, 关闭统计时governor也要用它计时
+    static uint32_t Now() {
+        return DWT->CYCCNT;
+    }
+
+    void Add(ProfileStage stage, uint32_t ticks) {
+        auto idx = static_cast<uint32_t>(stage);
+        pending_[idx] += ticks;
+        touched_ |= 1u << idx;
+    }
+
+    static constexpr uint32_t BucketOf(uint32_t v) {
+        if (v < kNumSub) return v;
+        uint32_t msb = 31 - __builtin_clz(v);
+        return (msb - kSubBits + 1) * kNumSub + ((v >> (msb - kSubBits)) & (kNumSub - 1));
+    }
+    static constexpr uint32_t BucketLowerBound(uint32_t bucket) {
+        if (bucket < kNumSub) return bucket;
+        uint32_t msb = bucket / kNumSub + kSubBits - 1;
+        return (kNumSub + bucket % kNumSub) << (msb - kSubBits);
+    }
+private:
+    void Clear();
+
+    struct Histogram {
+        uint32_t min;
+        uint32_t max;
+        uint64_t sum;
+        uint32_t count;
+        uint32_t buckets[kNumBuckets];
+    };
+
+    Histogram histograms_[kNumStages]{};
+    uint32_t pending_[kNumStages]{};
+    uint32_t last_[kNumStages]{};
+    uint32_t touched_{};
+    std::atomic<bool> resetRequested_{};
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(ProfileStage stage);
+    ~ProfileScope();
+private:
+    ProfileStage stage_;
+    uint32_t begin_;
+};
+
+namespace internal {
+struct InternalProfiler {
+    inline static CProfiler instance;
+};
+}
+
+static auto& Profiler = internal::InternalProfiler::instance;
+
+inline ProfileScope::ProfileScope(ProfileStage stage)
+    : stage_(stage), begin_(CProfiler::Now()) {}
+
+inline ProfileScope::~ProfileScope() {
+    Profiler.Add(stage_, CProfiler::Now() - begin_);
+}
+
+}
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#if PROFILER_ENABLE
+#define PROFILE_SCOPE(stage) utli::ProfileScope PROFILE_CONCAT(profileScope_, __LINE__){ stage }
+#define PROFILE_END_BLOCK() utli::Profiler.EndBlock()
+#else
+#define PROFILE_SCOPE(stage) do {} while (0)
+#define PROFILE_END_BLOCK() do {} while (0)
+#endif
@@ -0,0 +1,321 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <array>
+#include <algorithm>
+#include "Crc32.hpp"
+
+namespace utli::sysex {
+
+/**
+ * 预设批量传输的SysEx协议, 设备和 pctest/src/tools/PresetTool 共用
+ * 消息: F0 7D 57 <cmd> <body, 8-to-7编码> F7
+ * body 最后4字节是 cmd 和其余body的CRC-32, 多字节字段都是小端
+ *
+ * 数据按region组织, 每个region是设备上一块固定大小的缓冲:
+ * - 读: kRead 之后设备连续发送 kData, 最后一个 kAck 带整个region的CRC
+ * - 写: 主机连续发送 kWrite, 每个都回复 kAck, 全部写完后用 kCommit 应用
+ * 出错或者中断后用 kQuery 取得已写入的长度, 从那里继续
+ */
+static constexpr uint8_t kStart = 0xf0;
+static constexpr uint8_t kEnd = 0xf7;
+// 非商业用途的制造商ID
+static constexpr uint8_t kManufacturerId = 0x7d;
+static constexpr uint8_t kDeviceId = 0x57;
+static constexpr uint8_t kProtocolVersion = 1;
+// F0 7D 57 cmd
+static constexpr uint32_t kHeaderSize = 4;
+
+enum class Command : uint8_t {
+    // host -> device
+    // 无参数, 回复 kInfo
+    kQuery = 0x01,
+    // region, offset u32, length u32
+    kRead = 0x02,
+    // region, offset u32, length u16, data
+    kWrite = 0x03,
+    // region, flags, crc u32
+    kCommit = 0x04,
+    // device -> host
+    // version, numRegions, maxChunk u16, 每个region: size u32, written u32
+    kInfo = 0x41,
+    // region, offset u32, length u16, data
+    kData = 0x42,
+    // region, status, next u32, crc u32
+    kAck = 0x43,
+};
+
+enum class Status : uint8_t {
+    kOk = 0,
+    kCrcError,
+    kRangeError,
+    kBadRequest,
+    kCommitFailed,
+};
+
+// kCommit 的 flags, 同时写入flash, 设备可以在回复之后再写
+static constexpr uint8_t kCommitPersist = 0x01;
+// CRC错误时 kAck 的region
+static constexpr uint8_t kNoRegion = 0x7f;
+
+static constexpr uint32_t kMaxChunk = 128;
+static constexpr uint32_t kMaxRegions = 4;
+// cmd + 最长的body(kData)
+static constexpr uint32_t kMaxRaw = 1 + 1 + 4 + 2 + kMaxChunk + 4;
+
+static constexpr uint32_t PackedSize(uint32_t n) {
+    return n + (n + 6) / 7;
+}
+
+static constexpr uint32_t kMaxMessage = kHeaderSize + PackedSize(kMaxRaw - 1) + 1;
+
+/**
+ * @brief 每7字节前面加一个字节, 放它们的最高位
+ * @return 写入 out 的字节数
+ */
+static constexpr uint32_t Pack(std::span<const uint8_t> in, uint8_t* out) {
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < in.size(); i += 7) {
+        const uint32_t group = std::min<uint32_t>(7, in.size() - i);
+        uint8_t msb = 0;
+        for (uint32_t k = 0; k < group; ++k) {
+            msb |= (in[i + k] >> 7) << k;
+        }
+        out[n++] = msb;
+        for (uint32_t k = 0; k < group; ++k) {
+            out[n++] = in[i + k] & 0x7f;
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief Pack 的逆过程
+ * @return 写入 out 的字节数, 输入不合法时返回 -1
+ */
+static constexpr int32_t Unpack(std::span<const uint8_t> in, uint8_t* out) {
+    int32_t n = 0;
+    for (uint32_t i = 0; i < in.size(); i += 8) {
+        const uint32_t group = std::min<uint32_t>(8, in.size() - i);
+        if (group < 2) return -1;
+        const uint8_t msb = in[i];
+        if (msb & 0x80) return -1;
+        for (uint32_t k = 1; k < group; ++k) {
+            if (in[i + k] & 0x80) return -1;
+            out[n++] = in[i + k] | (((msb >> (k - 1)) & 1) << 7);
+        }
+    }
+    return n;
+}
+
+/**
+ * @brief 组装一条消息
+ */
+class MessageBuilder {
+public:
+    explicit constexpr MessageBuilder(Command cmd) {
+        raw_[0] = static_cast<uint8_t>(cmd);
+    }
+
+    constexpr void Put8(uint8_t v) {
+        raw_[size_++] = v;
+    }
+    constexpr void Put16(uint16_t v) {
+        Put8(v & 0xff);
+        Put8(v >> 8);
+    }
+    constexpr void Put32(uint32_t v) {
+        Put16(v & 0xffff);
+        Put16(v >> 16);
+    }
+    constexpr void Put(std::span<const uint8_t> data) {
+        std::copy(data.begin(), data.end(), raw_.begin() + size_);
+        size_ += data.size();
+    }
+
+    /**
+     * @brief 加上CRC并编码
+     * @param out 至少 kMaxMessage 字节
+     * @return 消息长度
+     */
+    constexpr uint32_t Finish(uint8_t* out) {
+        Put32(Crc32(std::span{ raw_.data(), size_ }));
+        uint32_t n = 0;
+        out[n++] = kStart;
+        out[n++] = kManufacturerId;
+        out[n++] = kDeviceId;
+        out[n++] = raw_[0];
+        n += Pack(std::span{ raw_.data() + 1, size_ - 1 }, out + n);
+        out[n++] = kEnd;
+        return n;
+    }
+private:
+    std::array<uint8_t, kMaxRaw> raw_{};
+    uint32_t size_{ 1 };
+};
+
+/**
+ * @brief 解析一条消息, 读越界后 IsValid 返回false
+ */
+class Message {
+public:
+    enum class Result {
+        kOk,
+        // 不是这个协议的SysEx
+        kIgnored,
+        // 编码或者CRC错误
+        kCorrupt,
+    };
+
+    constexpr Result Parse(std::span<const uint8_t> msg) {
+        if (msg.size() < kHeaderSize + 1
+            || msg[0] != kStart || msg[1] != kManufacturerId || msg[2] != kDeviceId
+            || msg.back() != kEnd) {
+            return Result::kIgnored;
+        }
+        const auto packed = msg.subspan(kHeaderSize, msg.size() - kHeaderSize - 1);
+        if (packed.size() > PackedSize(kMaxRaw - 1)) return Result::kCorrupt;
+        raw_[0] = msg[3];
+        const int32_t n = Unpack(packed, raw_.data() + 1);
+        if (n < 4) return Result::kCorrupt;
+        size_ = n + 1 - 4;
+        uint32_t crc = 0;
+        for (uint32_t i = 0; i < 4; ++i) {
+            crc |= static_cast<uint32_t>(raw_[size_ + i]) << (8 * i);
+        }
+        if (crc != Crc32(std::span{ raw_.data(), size_ })) return Result::kCorrupt;
+        pos_ = 1;
+        valid_ = true;
+        return Result::kOk;
+    }
+
+    constexpr Command GetCommand() const { return static_cast<Command>(raw_[0]); }
+    constexpr bool IsValid() const { return valid_; }
+    // 所有字段都已经读完
+    constexpr bool IsEnd() const { return pos_ == size_; }
+
+    constexpr uint8_t Get8() {
+        if (pos_ >= size_) {
+            valid_ = false;
+            return 0;
+        }
+        return raw_[pos_++];
+    }
+    constexpr uint16_t Get16() {
+        uint16_t lo = Get8();
+        return lo | (Get8() << 8);
+    }
+    constexpr uint32_t Get32() {
+        uint32_t lo = Get16();
+        return lo | (static_cast<uint32_t>(Get16()) << 16);
+    }
+    constexpr std::span<const uint8_t> Get(uint32_t len) {
+        if (size_ - pos_ < len) {
+            valid_ = false;
+            return {};
+        }
+        std::span<const uint8_t> data{ raw_.data() + pos_, len };
+        pos_ += len;
+        return data;
+    }
+private:
+    std::array<uint8_t, kMaxRaw> raw_{};
+    uint32_t size_{};
+    uint32_t pos_{};
+    bool valid_{};
+};
+
+// USB MIDI 事件包, byte0 低4位是CIN
+using Packet = std::array<uint8_t, 4>;
+
+/**
+ * @brief 把一条SysEx拆成USB MIDI事件包
+ * @param emit 对每个包调用
+ */
+template<class F>
+static constexpr void ToPackets(std::span<const uint8_t> msg, F&& emit) {
+    uint32_t pos = 0;
+    while (pos < msg.size()) {
+        const uint32_t left = msg.size() - pos;
+        Packet p{};
+        uint32_t n = 3;
+        if (left > 3) {
+            // start/continue
+            p[0] = 0x4;
+        }
+        else {
+            // 以1/2/3字节结束
+            n = left;
+            p[0] = static_cast<uint8_t>(0x4 + n);
+        }
+        for (uint32_t i = 0; i < n; ++i) {
+            p[1 + i] = msg[pos + i];
+        }
+        pos += n;
+        emit(p);
+    }
+}
+
+static constexpr uint32_t NumPackets(uint32_t msgSize) {
+    return (msgSize + 2) / 3;
+}
+
+/**
+ * @brief 从USB MIDI事件包重新组装SysEx, 太长的消息被丢弃
+ */
+class Assembler {
+public:
+    /**
+     * @return true 时 GetMessage 是一条完整的消息, 直到下一次 Push
+     */
+    constexpr bool Push(const Packet& p) {
+        uint32_t n = 0;
+        switch (p[0] & 0xf) {
+        case 0x4:
+        case 0x7:
+            n = 3;
+            break;
+        case 0x5:
+            n = 1;
+            break;
+        case 0x6:
+            n = 2;
+            break;
+        default:
+            return false;
+        }
+        if (p[1] == kStart) {
+            size_ = 0;
+            overflow_ = false;
+        }
+        for (uint32_t i = 0; i < n; ++i) {
+            if (size_ < buffer_.size()) {
+                buffer_[size_++] = p[1 + i];
+            }
+            else {
+                overflow_ = true;
+            }
+        }
+        if ((p[0] & 0xf) == 0x4) return false;
+
+        const bool complete = !overflow_ && size_ > 1 && buffer_[0] == kStart && buffer_[size_ - 1] == kEnd;
+        if (overflow_) {
+            ++numOverflows_;
+        }
+        message_ = complete ? size_ : 0;
+        size_ = 0;
+        overflow_ = false;
+        return complete;
+    }
+
+    constexpr std::span<const uint8_t> GetMessage() const { return { buffer_.data(), message_ }; }
+    constexpr uint32_t GetNumOverflows() const { return numOverflows_; }
+private:
+    std::array<uint8_t, kMaxMessage> buffer_{};
+    uint32_t size_{};
+    uint32_t message_{};
+    uint32_t numOverflows_{};
+    bool overflow_{};
+};
+
+}
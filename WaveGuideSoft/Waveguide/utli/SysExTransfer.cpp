@@ -0,0 +1,189 @@
+#include "SysExTransfer.hpp"
+
+namespace utli {
+
+using sysex::Command;
+using sysex::Status;
+
+void CSysExTransfer::Init(std::span<const Region> regions, WriteFn write) {
+    numRegions_ = std::min<uint32_t>(regions.size(), sysex::kMaxRegions);
+    std::copy_n(regions.begin(), numRegions_, regions_);
+    write_ = write;
+}
+
+void CSysExTransfer::OnMessage(std::span<const uint8_t> msg) {
+    sysex::Message m;
+    switch (m.Parse(msg)) {
+    case sysex::Message::Result::kIgnored:
+        return;
+    case sysex::Message::Result::kCorrupt:
+        SendAck(sysex::kNoRegion, Status::kCrcError, 0);
+        return;
+    case sysex::Message::Result::kOk:
+        break;
+    }
+
+    switch (m.GetCommand()) {
+    case Command::kQuery:
+        SendInfo();
+        break;
+    case Command::kRead:
+        HandleRead(m);
+        break;
+    case Command::kWrite:
+        HandleWrite(m);
+        break;
+    case Command::kCommit:
+        HandleCommit(m);
+        break;
+    default:
+        SendAck(sysex::kNoRegion, Status::kBadRequest, 0);
+        break;
+    }
+    Poll();
+}
+
+void CSysExTransfer::Poll() {
+    while (numReplies_ != 0) {
+        const auto& r = replies_[replyRead_];
+        if (!write_(std::span{ r.data, r.size })) return;
+        replyRead_ = (replyRead_ + 1) % kMaxReplies;
+        --numReplies_;
+    }
+    while (stream_.active && SendChunk()) {
+    }
+}
+
+void CSysExTransfer::HandleRead(sysex::Message& m) {
+    const uint8_t region = m.Get8();
+    const uint32_t offset = m.Get32();
+    const uint32_t length = m.Get32();
+    if (!m.IsValid() || !m.IsEnd() || region >= numRegions_) {
+        SendAck(region, Status::kBadRequest, 0);
+        return;
+    }
+    auto& r = regions_[region];
+    const uint32_t size = r.buffer.size();
+    if (offset > size) {
+        SendAck(region, Status::kRangeError, 0);
+        return;
+    }
+    // 从头读时取新的快照, 续读沿用原来的, 保证拼起来是同一份数据
+    if (offset == 0 || !snapshotValid_[region]) {
+        r.snapshot(r.buffer);
+        snapshotValid_[region] = true;
+        written_[region] = 0;
+    }
+    stream_.region = region;
+    stream_.offset = offset;
+    stream_.end = offset + std::min(length, size - offset);
+    stream_.active = true;
+}
+
+void CSysExTransfer::HandleWrite(sysex::Message& m) {
+    const uint8_t region = m.Get8();
+    const uint32_t offset = m.Get32();
+    const uint32_t length = m.Get16();
+    const auto data = m.Get(length);
+    if (!m.IsValid() || !m.IsEnd() || region >= numRegions_) {
+        SendAck(region, Status::kBadRequest, 0);
+        return;
+    }
+    auto& r = regions_[region];
+    // 不能留下空洞, 主机收到 kRangeError 后从 next 继续
+    if (offset > written_[region] || offset + length > r.buffer.size()) {
+        SendAck(region, Status::kRangeError, written_[region]);
+        return;
+    }
+    std::copy(data.begin(), data.end(), r.buffer.begin() + offset);
+    written_[region] = std::max(written_[region], offset + length);
+    snapshotValid_[region] = false;
+    SendAck(region, Status::kOk, written_[region]);
+}
+
+void CSysExTransfer::HandleCommit(sysex::Message& m) {
+    const uint8_t region = m.Get8();
+    const uint8_t flags = m.Get8();
+    const uint32_t crc = m.Get32();
+    if (!m.IsValid() || !m.IsEnd() || region >= numRegions_) {
+        SendAck(region, Status::kBadRequest, 0);
+        return;
+    }
+    auto& r = regions_[region];
+    const uint32_t size = r.buffer.size();
+    if (written_[region] != size) {
+        SendAck(region, Status::kRangeError, written_[region]);
+        return;
+    }
+    const uint32_t actual = Crc32(r.buffer);
+    if (actual != crc) {
+        // 数据有错, 只能从头再写
+        written_[region] = 0;
+        SendAck(region, Status::kCrcError, 0, actual);
+        return;
+    }
+    const bool ok = r.commit(r.buffer, flags);
+    written_[region] = 0;
+    SendAck(region, ok ? Status::kOk : Status::kCommitFailed, size, actual);
+}
+
+void CSysExTransfer::SendInfo() {
+    sysex::MessageBuilder b{ Command::kInfo };
+    b.Put8(sysex::kProtocolVersion);
+    b.Put8(numRegions_);
+    b.Put16(sysex::kMaxChunk);
+    for (uint32_t i = 0; i < numRegions_; ++i) {
+        b.Put32(regions_[i].buffer.size());
+        b.Put32(written_[i]);
+    }
+    PushReply(b);
+}
+
+void CSysExTransfer::SendAck(uint8_t region, Status status, uint32_t next, uint32_t crc) {
+    sysex::MessageBuilder b{ Command::kAck };
+    b.Put8(region & 0x7f);
+    b.Put8(static_cast<uint8_t>(status));
+    b.Put32(next);
+    b.Put32(crc);
+    PushReply(b);
+}
+
+void CSysExTransfer::PushReply(sysex::MessageBuilder& builder) {
+    uint8_t msg[sysex::kMaxMessage];
+    const uint32_t size = builder.Finish(msg);
+    // 主机不等回复连续发送太多请求时丢弃, 它会超时后用 kQuery 恢复
+    if (numReplies_ == kMaxReplies || size > kMaxReplySize) return;
+    auto& r = replies_[(replyRead_ + numReplies_) % kMaxReplies];
+    std::copy_n(msg, size, r.data);
+    r.size = size;
+    ++numReplies_;
+}
+
+// 数据发完后再发一个带CRC的 kAck
+bool CSysExTransfer::SendChunk() {
+    auto& r = regions_[stream_.region];
+    if (stream_.offset == stream_.end) {
+        sysex::MessageBuilder b{ Command::kAck };
+        b.Put8(stream_.region);
+        b.Put8(static_cast<uint8_t>(Status::kOk));
+        b.Put32(stream_.end);
+        b.Put32(Crc32(r.buffer));
+        uint8_t msg[sysex::kMaxMessage];
+        if (!write_(std::span{ msg, b.Finish(msg) })) return false;
+        stream_.active = false;
+        return false;
+    }
+
+    const uint32_t len = std::min(stream_.end - stream_.offset, sysex::kMaxChunk);
+    sysex::MessageBuilder b{ Command::kData };
+    b.Put8(stream_.region);
+    b.Put32(stream_.offset);
+    b.Put16(len);
+    b.Put(r.buffer.subspan(stream_.offset, len));
+    uint8_t msg[sysex::kMaxMessage];
+    if (!write_(std::span{ msg, b.Finish(msg) })) return false;
+    stream_.offset += len;
+    return true;
+}
+
+}
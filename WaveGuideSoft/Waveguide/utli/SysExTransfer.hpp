@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include "SysEx.hpp"
+
+namespace utli {
+
+/**
+ * @brief 设备端的 utli::sysex 协议, 不依赖硬件, pctest 的 PresetTool 用它模拟设备
+ * OnMessage 和 Poll 必须在同一个任务中调用
+ */
+class CSysExTransfer {
+public:
+    struct Region {
+        // 读写都经过这块缓冲, 大小就是region的大小
+        std::span<uint8_t> buffer;
+        // 从0开始读时调用, 把当前数据复制到buffer
+        void (*snapshot)(std::span<uint8_t> buffer);
+        // 全部写入且CRC正确后调用, 返回false为失败
+        bool (*commit)(std::span<const uint8_t> buffer, uint8_t flags);
+    };
+
+    // 一次写入整条消息, 空间不够时返回false且什么都不写
+    using WriteFn = bool (*)(std::span<const uint8_t> msg);
+
+    void Init(std::span<const Region> regions, WriteFn write);
+    // 一条完整的SysEx, 不是这个协议的直接忽略
+    void OnMessage(std::span<const uint8_t> msg);
+    // 发送等待中的回复和读取的数据, 发送队列满时留到下一次
+    void Poll();
+    // 还有没发送的数据
+    bool IsBusy() const { return numReplies_ != 0 || stream_.active; }
+private:
+    static constexpr uint32_t kMaxReplies = 8;
+    // kAck/kInfo 的最大长度
+    static constexpr uint32_t kMaxReplySize = 64;
+
+    struct Reply {
+        uint8_t data[kMaxReplySize];
+        uint32_t size;
+    };
+
+    void HandleRead(sysex::Message& m);
+    void HandleWrite(sysex::Message& m);
+    void HandleCommit(sysex::Message& m);
+    void SendInfo();
+    void SendAck(uint8_t region, sysex::Status status, uint32_t next, uint32_t crc = 0);
+    void PushReply(sysex::MessageBuilder& builder);
+    bool SendChunk();
+
+    Region regions_[sysex::kMaxRegions]{};
+    uint32_t numRegions_{};
+    WriteFn write_{};
+    // 连续写入的长度, 续传从这里开始
+    uint32_t written_[sysex::kMaxRegions]{};
+    // buffer 里是 snapshot 的数据, 续读时不再重新复制
+    bool snapshotValid_[sysex::kMaxRegions]{};
+
+    Reply replies_[kMaxReplies]{};
+    uint32_t replyRead_{};
+    uint32_t numReplies_{};
+
+    struct Stream {
+        uint8_t region;
+        uint32_t offset;
+        uint32_t end;
+        bool active;
+    } stream_{};
+};
+
+}
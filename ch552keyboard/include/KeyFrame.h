@@ -0,0 +1,65 @@
+#pragma once
+/*
+ * 按键模块(CH552)发给主控(STM32)的数据帧, 两边共用这个文件
+ * 需要同时能被 SDCC 和 arm-none-eabi-g++ 编译, 只用C99
+ *
+ * 5字节:
+ *   [0] adc 低8位
+ *   [1] bit0-1 adc 高2位, bit2-7 seq
+ *   [2] pos, 触摸条位置, 有符号
+ *   [3] tick, 这次adc采样的时间, 单位100us, 回绕
+ *   [4] CRC-8/SAE-J1850 (poly 0x1d, init 0xff, xorout 0xff), 覆盖前4字节
+ * adc 是4次8位采样的和, 10位
+ * seq 每次新的adc结果加1, 主控用它区分新数据和重复读到的旧数据
+ */
+#include <stdint.h>
+
+#define KEYFRAME_SIZE 5
+#define KEYFRAME_ADC_MAX 0x3ff
+#define KEYFRAME_SEQ_MASK 0x3f
+
+typedef struct {
+    uint16_t adc;
+    int8_t pos;
+    uint8_t seq;
+    uint8_t tick;
+} KeyFrame;
+
+// 高4位查表
+static const uint8_t keyFrameCrcTable[16] = {
+    0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53,
+    0xe8, 0xf5, 0xd2, 0xcf, 0x9c, 0x81, 0xa6, 0xbb
+};
+
+static inline uint8_t KeyFrame_Crc8(const uint8_t* data, uint8_t len) {
+    uint8_t crc = 0xff;
+    uint8_t i;
+    for (i = 0; i < len; ++i) {
+        crc ^= data[i];
+        crc = (uint8_t)(crc << 4) ^ keyFrameCrcTable[crc >> 4];
+        crc = (uint8_t)(crc << 4) ^ keyFrameCrcTable[crc >> 4];
+    }
+    return crc ^ 0xff;
+}
+
+static inline void KeyFrame_Encode(const KeyFrame* frame, uint8_t* out) {
+    out[0] = (uint8_t)frame->adc;
+    out[1] = (uint8_t)((frame->adc >> 8) & 0x03) | (uint8_t)((frame->seq & KEYFRAME_SEQ_MASK) << 2);
+    out[2] = (uint8_t)frame->pos;
+    out[3] = frame->tick;
+    out[4] = KeyFrame_Crc8(out, KEYFRAME_SIZE - 1);
+}
+
+/*
+ * @return CRC正确时返回1
+ */
+static inline uint8_t KeyFrame_Decode(const uint8_t* in, KeyFrame* frame) {
+    if (KeyFrame_Crc8(in, KEYFRAME_SIZE - 1) != in[KEYFRAME_SIZE - 1]) {
+        return 0;
+    }
+    frame->adc = (uint16_t)in[0] | ((uint16_t)(in[1] & 0x03) << 8);
+    frame->seq = in[1] >> 2;
+    frame->pos = (int8_t)in[2];
+    frame->tick = in[3];
+    return 1;
+}
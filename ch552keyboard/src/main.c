@@ -10,6 +10,7 @@
 #include <string.h>
 #include "ch554.h"
 #include "ch554_usb.h"
+#include "KeyFrame.h"
 
 // --------------------------------------------------------------------------------
 // timer
@@ -17,7 +18,7 @@
 static void Timer_Init(void);
 static void Timer_Interrupt(void) __interrupt(INT_NO_TMR2);
 static uint16_t Timer_GetTime(void);
-static volatile uint16_t timerTick_ = 0;
+static volatile uint16_t timerTick_ = 0; // 100us
 #define SPI_TIMEOUT_MS 5
 
 // --------------------------------------------------------------------------------
@@ -45,8 +46,11 @@ uint8_t pressFlag = 0;
 // OH49E HALL ADC
 // --------------------------------------------------------------------------------
 #define ADC_PIN P32
+#define HALL_OVERSAMPLE 4 // 4个8位采样加起来是10位
 static void HallADC_Init(void);
-static volatile uint8_t hallAdcValue = 0;
+static uint16_t hallAdcSum = 0;
+static uint8_t hallAdcCount = 0;
+static uint8_t hallAdcSeq = 0;
 static uint8_t lowAdcThreadhold = 0;
 static uint8_t highAdcThreadhold = 0;
 
@@ -61,7 +65,9 @@ static uint8_t highAdcThreadhold = 0;
 #define SPI_IRQ_ENABLE_PIN P34 // 下降沿产生IRQ
 // TODO: 焊接所有的MCS和CS_PREV
 
+static uint8_t txFrame[KEYFRAME_SIZE]; // 只在主循环里读写, 发送时不会变化
 static void KeyCommunication_Init(void);
+static void KeyCommunication_Update(void);
 static void KeyCommunication_Send(void);
 static void KeyCommunication_Receive(void);
 
@@ -95,8 +101,13 @@ void main(void) {
         }
 
         if (ADC_START == 0) {
-            hallAdcValue = ADC_DATA;
+            hallAdcSum += ADC_DATA;
             ADC_START = 1;
+            if (++hallAdcCount == HALL_OVERSAMPLE) {
+                KeyCommunication_Update();
+                hallAdcSum = 0;
+                hallAdcCount = 0;
+            }
         }
 
         if (TouchKey_Ready() == 1) {
@@ -145,8 +156,8 @@ void main(void) {
 }
 
 #define TIMER2_FREQ (F_CPU / 12)
-#define TIMER2_MS 1
-#define TIMER2_RELOAD (0xffff - TIMER2_FREQ * TIMER2_MS / 1000 + 1)
+#define TIMER2_US 100
+#define TIMER2_RELOAD (0xffff - TIMER2_FREQ * TIMER2_US / 1000000 + 1)
 void Timer_Init(void) {
     T2MOD &= ~(bTMR_CLK | bT2_CLK); // Fsys/12
     RCAP2 = TIMER2_RELOAD;
@@ -193,6 +204,16 @@ void KeyCommunication_Init(void) {
     PIN_low(SPI_IRQ_ENABLE_PIN);
     IT1 = 1;
     IE1 = 0;
+    KeyCommunication_Update();
+}
+
+void KeyCommunication_Update(void) {
+    KeyFrame frame;
+    frame.adc = hallAdcSum;
+    frame.pos = tkeyFingerPosition;
+    frame.seq = hallAdcSeq++;
+    frame.tick = (uint8_t)timerTick_;
+    KeyFrame_Encode(&frame, txFrame);
 }
 
 void KeyCommunication_Send(void) {
@@ -207,18 +228,14 @@ void KeyCommunication_Send(void) {
     PIN_output(SPI_MISO_PIN);
     PIN_input(SPI_SCK_PIN);
 
-    SPI0_S_PRE = 0b11011000;
+    SPI0_S_PRE = txFrame[0];
     SCS = 0;
     PIN_low(SPI_IRQ_ENABLE_PIN);// 请求以及CH442E转发送
-    while (S0_IF_BYTE == 0 && PIN_read(SPI_CS_PIN) == 0) {}
-    S0_IF_BYTE  = 0;
-    SPI0_DATA = 0b10101010;
-    while (S0_IF_BYTE  == 0 && PIN_read(SPI_CS_PIN) == 0) {}
-    S0_IF_BYTE  = 0;
-    SPI0_DATA = hallAdcValue;
-    while (S0_IF_BYTE  == 0 && PIN_read(SPI_CS_PIN) == 0) {}
-    S0_IF_BYTE  = 0;
-    SPI0_DATA = tkeyFingerPosition;
+    for (uint8_t i = 1; i < KEYFRAME_SIZE; ++i) {
+        while (S0_IF_BYTE == 0 && PIN_read(SPI_CS_PIN) == 0) {}
+        S0_IF_BYTE  = 0;
+        SPI0_DATA = txFrame[i];
+    }
     while (S0_IF_BYTE  == 0 && PIN_read(SPI_CS_PIN) == 0) {}
     S0_IF_BYTE  = 0;
 
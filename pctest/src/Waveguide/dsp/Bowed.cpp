@@ -16,8 +16,8 @@ void Bowed::Init(float sampleRate) {
     speedEnv_.Init(sampleRate);
     noiseLP_.Init(sampleRate);
 
-    tremoloDelay_.Init(sampleRate / 480);
-    vibrateDelay_.Init(sampleRate / 480);
+    tremoloDelay_.Init(sampleRate);
+    vibrateDelay_.Init(sampleRate);
     tremoloOscPhase_ = 0.0f;
     vibrateOscPhase_ = 0.0f;
 }
@@ -95,7 +95,7 @@ void Bowed::Panic() {
 }
 
 bool Bowed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
-    UpdateParam();
+    UpdateParam(buffer.size());
     maxSample_ = 0.0f;
 
     if (bowUp_) {
@@ -117,7 +117,7 @@ bool Bowed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
 }
 
 bool Bowed::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
-    UpdateParam();
+    UpdateParam(buffer.size());
     maxSample_ = 0.0f;
 
     if (bowUp_) {
@@ -138,13 +138,13 @@ bool Bowed::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
     return maxSample_ < 1e-3f && !bowUp_ && !noteOned_;
 }
 
-void Bowed::UpdateParam() {
+void Bowed::UpdateParam(uint32_t numSamples) {
     noiseAmount_ = SynthParams.bow.noise.Get();
 
     float pitchBendAmount = 0.0f;
     if (SynthParams.bow.autoVibrate.Get()) {
         // use auto vibrate
-        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.bow.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
@@ -156,7 +156,7 @@ void Bowed::UpdateParam() {
         // TODO: use mpe pitchbend
         pitchBendAmount = 0.0f;
     }
-    pitchBendAmount *= vibrateDelay_.Process(1);
+    pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     float vibrateLen = waveguideLoopLen_ + pitchBendAmount * pitchBendLenDelta_;
     float nutLen = vibrateLen * bowPosition_;
     float bowLen = vibrateLen - nutLen;
@@ -170,7 +170,7 @@ void Bowed::UpdateParam() {
     // tremolo process
     if (SynthParams.bow.autoTremolo.Get()) {
         // use auto tremolo
-        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.bow.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
@@ -181,7 +181,7 @@ void Bowed::UpdateParam() {
     else {
         tremoloAmount_ = 0.0f;
     }
-    tremoloAmount_ *= tremoloDelay_.Process(1);
+    tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
     tremoloAmount_ *= SynthParams.bow.tremoloDepth.Get();
 }
 
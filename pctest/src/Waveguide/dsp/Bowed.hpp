@@ -48,7 +48,7 @@ public:
     float deltaDebugValue_{};
     float waveOutputDebugValue_{};
 private:
-    void UpdateParam();
+    void UpdateParam(uint32_t numSamples);
     int32_t GetLossLP(int32_t note);
 
     uint8_t channel_{};
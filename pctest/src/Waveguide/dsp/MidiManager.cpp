@@ -3,7 +3,6 @@
 
 void CMidiManager::Init(uint32_t dataUpdateRate) {
     std::fill_n(channelTable, 128, kInvalidChannel);
-    std::fill_n(lastChannelTable, 128, kInvalidChannel);
 }
 
 void CMidiManager::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity)
@@ -22,6 +21,7 @@ void CMidiManager::NoteOn(uint8_t channel, uint8_t note, uint8_t velocity)
     }
     velocityTable[note] = velocity;
     channelTable[note] = channel;
+    PushEvent(channel, note, velocity);
 }
 
 uint8_t CMidiManager::NoteOn(uint8_t note, uint8_t velocity) {
@@ -45,6 +45,7 @@ void CMidiManager::NoteOff(uint8_t channel, uint8_t note) {
     }
     velocityTable[note] = 0;
     channelTable[note] = kInvalidChannel;
+    PushEvent(channel, note, 0);
 }
 
 uint8_t CMidiManager::NoteOff(uint8_t note) {
@@ -53,37 +54,42 @@ uint8_t CMidiManager::NoteOff(uint8_t note) {
     return channel;
 }
 
-void CMidiManager::BackupState() {
-    diff0 = reg0 ^ lastReg0;
-    diff1 = reg1 ^ lastReg1;
-    diff2 = reg2 ^ lastReg2;
-    diff3 = reg3 ^ lastReg3;
-    lastReg0 = reg0;
-    lastReg1 = reg1;
-    lastReg2 = reg2;
-    lastReg3 = reg3;
-    std::copy_n(velocityTable, 128, lastVelocityTable);
-    std::copy_n(channelTable, 128, lastChannelTable);
+uint32_t CMidiManager::PopEvents(uint32_t timeEnd, std::span<dsp::NoteEvent> out) {
+    uint32_t num = 0;
+    while (eventRead_ != eventWrite_ && num < out.size()) {
+        const auto& e = events_[eventRead_ % kEventQueueSize];
+        if (static_cast<int32_t>(e.time - timeEnd) >= 0) {
+            break;
+        }
+        out[num++] = e;
+        ++eventRead_;
+    }
+    return num;
 }
 
-void CMidiManager::Lock() {
+void CMidiManager::PushEvent(uint8_t channel, uint8_t note, uint8_t velocity) {
+    std::lock_guard lock{ lock_ };
+    if (eventWrite_ - eventRead_ >= kEventQueueSize) {
+        ++numDroppedEvents_;
+        return;
+    }
+    uint32_t time = clock_ != nullptr ? clock_() : 0;
+    events_[eventWrite_ % kEventQueueSize] = dsp::NoteEvent{ time, channel, note, velocity };
+    ++eventWrite_;
 }
 
-void CMidiManager::Unlock() {
+void CMidiManager::Lock() {
+    lock_.lock();
 }
 
-uint8_t CMidiManager::GetLastChannelOfNote(uint8_t note) const {
-    return lastChannelTable[note];
+void CMidiManager::Unlock() {
+    lock_.unlock();
 }
 
 uint8_t CMidiManager::GetChannelOfNote(uint8_t note) const {
     return channelTable[note];
 }
 
-uint8_t CMidiManager::GetLastVelocity(uint8_t note) const {
-    return lastVelocityTable[note];
-}
-
 uint8_t CMidiManager::GetVelocity(uint8_t note) const {
     return velocityTable[note];
 }
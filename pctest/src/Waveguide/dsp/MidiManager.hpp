@@ -1,28 +1,35 @@
 #pragma once
 #include <cstdint>
+#include <span>
+#include <mutex>
+#include "NoteEvent.hpp"
 
 class CMidiManager {
 public:
     static constexpr uint32_t kOne = 1;
     static constexpr uint8_t kInvalidChannel = 16;
+    static constexpr uint32_t kEventQueueSize = 64;
 
     void Init(uint32_t dataUpdateRate);
     void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
     [[nodiscard]] uint8_t NoteOn(uint8_t note, uint8_t velocity);
     void NoteOff(uint8_t channel, uint8_t note);
     [[nodiscard]] uint8_t NoteOff(uint8_t note);
-    void BackupState();
     void Lock();
     void Unlock();
-    uint8_t GetLastChannelOfNote(uint8_t note) const;
     uint8_t GetChannelOfNote(uint8_t note) const;
-    uint8_t GetLastVelocity(uint8_t note) const;
     uint8_t GetVelocity(uint8_t note) const;
 
-    uint32_t GetDiff0() const { return diff0; };
-    uint32_t GetDiff1() const { return diff1; };
-    uint32_t GetDiff2() const { return diff2; };
-    uint32_t GetDiff3() const { return diff3; };
+    /**
+     * @brief 事件时间戳的来源, 返回采样时钟
+     */
+    void SetClock(uint32_t(*clock)()) { clock_ = clock; }
+    /**
+     * @brief 取出时间早于 timeEnd 的音符事件, 需要在Lock中调用
+     * @return 取出的事件数
+     */
+    uint32_t PopEvents(uint32_t timeEnd, std::span<dsp::NoteEvent> out);
+    uint32_t GetNumDroppedEvents() const { return numDroppedEvents_; }
 
     void SetPressure(uint8_t channel, uint8_t pressure) { pressure_[channel] = pressure / 127.0f; }
     float GetPressure(uint8_t channel) const { return pressure_[channel] / 127.0f; }
@@ -62,20 +69,19 @@ private:
     uint32_t reg1{};
     uint32_t reg2{};
     uint32_t reg3{};
-    uint32_t diff0{};
-    uint32_t diff1{};
-    uint32_t diff2{};
-    uint32_t diff3{};
-    uint32_t lastReg0{};
-    uint32_t lastReg1{};
-    uint32_t lastReg2{};
-    uint32_t lastReg3{};
     uint8_t velocityTable[128]{};
-    uint8_t lastVelocityTable[128]{};
+
+    // note events
+    void PushEvent(uint8_t channel, uint8_t note, uint8_t velocity);
+    std::mutex lock_;
+    uint32_t(*clock_)() { nullptr };
+    dsp::NoteEvent events_[kEventQueueSize]{};
+    uint32_t eventRead_{};
+    uint32_t eventWrite_{};
+    uint32_t numDroppedEvents_{};
     
     // mpe
     uint8_t channelTable[128]{};
-    uint8_t lastChannelTable[128]{};
     struct CCList {
         uint8_t cc[128]{};
     };
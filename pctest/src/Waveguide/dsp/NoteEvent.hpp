@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+namespace dsp {
+
+/**
+ * @brief 带时间戳的音符事件
+ * time 是采样时钟(单位: 采样点), velocity == 0 表示 NoteOff
+ */
+struct NoteEvent {
+    uint32_t time;
+    uint8_t channel;
+    uint8_t note;
+    uint8_t velocity;
+};
+
+}
@@ -20,13 +20,13 @@ void Reed::Init(float sampleRate) {
 
     vibrateOscPhase_ = 0.0f;
     tremoloOscPhase_ = 0.0f;
-    vibrateDelay_.Init(sampleRate / 480);
-    tremoloDelay_.Init(sampleRate / 480);
+    vibrateDelay_.Init(sampleRate);
+    tremoloDelay_.Init(sampleRate);
 }
 
 bool Reed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
     maxSample_ = 0.0f;
-    UpdateDelayLen();
+    UpdateDelayLen(buffer.size());
     for (auto& s : buffer) {
         s = ProcessSingle();
     }
@@ -35,7 +35,7 @@ bool Reed::Process(std::span<float> buffer, std::span<float> auxBuffer) {
 
 bool Reed::AddTo(std::span<float> buffer, std::span<float> auxBuffer) {
     maxSample_ = 0.0f;
-    UpdateDelayLen();
+    UpdateDelayLen(buffer.size());
     for (auto& s : buffer) {
         s += ProcessSingle();
     }
@@ -167,11 +167,11 @@ void Reed::CalcRealDecay() {
     realDecay_ = lossGain_ / filterLossGain_;
 }
 
-void Reed::UpdateDelayLen() {
+void Reed::UpdateDelayLen(uint32_t numSamples) {
     float pitchBendAmount = 0.0f;
     if (SynthParams.reed.autoVibrate.Get()) {
         // use auto vibrate
-        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() / (sampleRate_ / 480);
+        vibrateOscPhaseInc_ = SynthParams.reed.vibrateRate.Get() * numSamples / sampleRate_;
         vibrateOscPhase_ += vibrateOscPhaseInc_;
         if (vibrateOscPhase_ > 1.0f) {
             vibrateOscPhase_ -= 1.0f;
@@ -183,7 +183,7 @@ void Reed::UpdateDelayLen() {
         // TODO: use mpe pitchbend
         pitchBendAmount = 0.0f;
     }
-    pitchBendAmount *= vibrateDelay_.Process(1);
+    pitchBendAmount *= vibrateDelay_.Process(1, numSamples);
     float vibrateLen = waveguideLoopLen_ + pitchBendAmount * pitchBendLenDelta_;
     int32_t idelay = tunningFilter_.SetDelay(vibrateLen);
     pipe_->SetDelay(idelay);
@@ -191,7 +191,7 @@ void Reed::UpdateDelayLen() {
     // tremolo process
     if (SynthParams.reed.autoTremolo.Get()) {
         // use auto tremolo
-        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() / (sampleRate_ / 480);
+        tremoloOscPhaseInc_ = SynthParams.reed.tremoloRate.Get() * numSamples / sampleRate_;
         tremoloOscPhase_ += tremoloOscPhaseInc_;
         if (tremoloOscPhase_ > 1.0f) {
             tremoloOscPhase_ -= 1.0f;
@@ -202,7 +202,7 @@ void Reed::UpdateDelayLen() {
     else {
         tremoloAmount_ = 0.0f;
     }
-    tremoloAmount_ *= tremoloDelay_.Process(1);
+    tremoloAmount_ *= tremoloDelay_.Process(1, numSamples);
     tremoloAmount_ *= SynthParams.reed.tremoloDepth.Get();
 }
 
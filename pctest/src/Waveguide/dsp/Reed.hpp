@@ -48,7 +48,7 @@ public:
     float debugValueOutputWave_{};
 private:
     void CalcRealDecay();
-    void UpdateDelayLen();
+    void UpdateDelayLen(uint32_t numSamples);
 
     uint8_t channel_{};
     DelayLine* pipe_;
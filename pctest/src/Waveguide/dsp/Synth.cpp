@@ -1,4 +1,5 @@
 #include "Synth.hpp"
+#include <algorithm>
 #include "Note.hpp"
 
 namespace dsp {
@@ -58,6 +59,37 @@ void CSynth::NoteOff(uint8_t note) {
 }
 
 void CSynth::Process(std::span<float> buffer, std::span<float> auxBuffer) {
+    ProcessVoices(buffer, auxBuffer);
+    body_.Process(buffer, auxBuffer);
+    reverb_.Process(buffer, auxBuffer);
+}
+
+void CSynth::Process(std::span<float> buffer, std::span<float> auxBuffer,
+                     std::span<const NoteEvent> events, uint32_t blockTime) {
+    const auto size = static_cast<int32_t>(buffer.size());
+    int32_t pos = 0;
+    for (const auto& e : events) {
+        auto offset = static_cast<int32_t>(e.time - blockTime);
+        offset = std::clamp(offset, pos, size);
+        if (offset > pos) {
+            ProcessVoices(buffer.subspan(pos, offset - pos), auxBuffer.subspan(pos, offset - pos));
+            pos = offset;
+        }
+        if (e.velocity > 0) {
+            NoteOn(e.channel, e.note, e.velocity);
+        }
+        else {
+            NoteOff(e.note);
+        }
+    }
+    if (pos < size) {
+        ProcessVoices(buffer.subspan(pos), auxBuffer.subspan(pos));
+    }
+    body_.Process(buffer, auxBuffer);
+    reverb_.Process(buffer, auxBuffer);
+}
+
+void CSynth::ProcessVoices(std::span<float> buffer, std::span<float> auxBuffer) {
     switch (instrument_) {
     case Instrument::Bow:
         bowed_.Process(buffer, auxBuffer);
@@ -69,8 +101,6 @@ void CSynth::Process(std::span<float> buffer, std::span<float> auxBuffer) {
         string_.Process(buffer, auxBuffer);
         break;
     }
-    body_.Process(buffer, auxBuffer);
-    reverb_.Process(buffer, auxBuffer);
 }
 
 void CSynth::SetInstrument(Instrument instr) {
@@ -8,6 +8,7 @@
 #include "PolySynth.hpp"
 #include "Reverb.hpp"
 #include "Body.hpp"
+#include "NoteEvent.hpp"
 
 namespace dsp {
 
@@ -15,10 +16,20 @@ class CSynth {
 public:
     enum class Instrument : uint8_t { String = 0, Reed, Bow, kNumInstruments };
 
+    // 每个block最多处理的事件数, 多出来的留到下一个block
+    static constexpr uint32_t kMaxEventsPerBlock = 16;
+
     void Init(uint32_t sampleRate);
     void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity);
     void NoteOff(uint8_t note);
     void Process(std::span<float> buffer, std::span<float> auxBuffer);
+    /**
+     * @brief 在事件的采样位置切分block, 实现采样精确的音符触发
+     * @param events 按时间排序, 最多 kMaxEventsPerBlock 个
+     * @param blockTime buffer[0] 对应的采样时钟, 早于它的事件在0处触发
+     */
+    void Process(std::span<float> buffer, std::span<float> auxBuffer,
+                 std::span<const NoteEvent> events, uint32_t blockTime);
 
     void SetInstrument(Instrument instr);
     Instrument GetInstrument() const { return instrument_; }
@@ -44,6 +55,7 @@ public:
         }
     }
 private:
+    void ProcessVoices(std::span<float> buffer, std::span<float> auxBuffer);
     void BindParamsFlute(CSynthParams& param);
     void BindParamsString(CSynthParams& param);
     void BindParamsBow(CSynthParams& param);
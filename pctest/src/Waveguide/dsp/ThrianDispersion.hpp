@@ -13,6 +13,7 @@ public:
     float GetPhaseDelay(float freq) const;
     void  SetGroupDelay(float delay);
     void  Panic();
+    bool  IsIdentity() const { return identity_; }
     std::complex<float> GetResponce(float omega) const;
 private:
     float ProcessFilter(float in, uint32_t i);
@@ -22,6 +23,7 @@ private:
     float a1_{};
     float b0_{};
     float b2_{};
+    bool identity_{};
     struct APFData {
         float latch1_{};
         float latch2_{};
@@ -7,78 +7,70 @@
 #include "gui/obj/Main.hpp"
 #include <semaphore>
 #include <format>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
 #include "dsp/MidiManager.hpp"
 
 // static NoteQueue noteQueue;
-static float auxBuffer[512]{};
-static float dacBuffer[512]{};
-static void DAC_Callback(void* buffer, uint32_t size) {
+static constexpr uint32_t kSampleRate = 48000;
+static constexpr uint32_t kMinBlockSize = 32;
+static constexpr uint32_t kMaxBlockSize = 1024;
+// 与固件相同的默认值, 可以用第一个命令行参数修改
+static uint32_t blockSize_ = 480;
+static float auxBuffer[kMaxBlockSize]{};
+static float dacBuffer[kMaxBlockSize]{};
+// dacBuffer中已经输出的位置, 等于blockSize_时渲染下一个block
+static uint32_t readPos_ = kMaxBlockSize;
+
+// 采样时钟: 上一次回调时的采样数 + 之后经过的时间
+static std::atomic<uint32_t> blockTime_{};
+static std::atomic<int64_t> blockTimeNs_{};
+static uint32_t HostSampleClock() {
+    using namespace std::chrono;
+    auto ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count() - blockTimeNs_.load();
+    return blockTime_.load() + static_cast<uint32_t>(ns * kSampleRate / 1000000000);
+}
+
+static void RenderBlock() {
+    using namespace std::chrono;
     auto& synth = dsp::Synth;
-    {
-        MidiManager.BackupState();
-        auto diff = MidiManager.GetDiff0();
-        while (diff) {
-            auto note = __builtin_ctzl(diff);
-            auto velocity = MidiManager.GetLastVelocity(note);
-            auto channel = MidiManager.GetLastChannelOfNote(note);
-            if (velocity) {
-                synth.NoteOn(channel, note, velocity);
-            } else {
-                synth.NoteOff(note);
-            }
-            diff &= ~(1ULL << note);
-        }
-        diff = MidiManager.GetDiff1();
-        while (diff) {
-            auto note = __builtin_ctzl(diff);
-            auto velocity = MidiManager.GetLastVelocity(note + 32);
-            auto channel = MidiManager.GetLastChannelOfNote(note + 32);
-            if (velocity) {
-                synth.NoteOn(channel, note + 32, velocity);
-            } else {
-                synth.NoteOff(note + 32);
-            }
-            diff &= ~(1ULL << note);
-        }
-        diff = MidiManager.GetDiff2();
-        while (diff) {
-            auto note = __builtin_ctzl(diff);
-            auto velocity = MidiManager.GetLastVelocity(note + 64);
-            auto channel = MidiManager.GetLastChannelOfNote(note + 64);
-            if (velocity) {
-                synth.NoteOn(channel, note + 64, velocity);
-            } else {
-                synth.NoteOff(note + 64);
-            }
-            diff &= ~(1ULL << note);
-        }
-        diff = MidiManager.GetDiff3();
-        while (diff) {
-            auto note = __builtin_ctzl(diff);
-            auto velocity = MidiManager.GetLastVelocity(note + 96);
-            auto channel = MidiManager.GetLastChannelOfNote(note + 96);
-            if (velocity) {
-                synth.NoteOn(channel, note + 96, velocity);
-            } else {
-                synth.NoteOff(note + 96);
-            }
-            diff &= ~(1ULL << note);
-        }
-    }
+    const uint32_t size = blockSize_;
+
+    // 上一个block之后到达的事件, 延迟一个block播放
+    uint32_t lastBlockTime = blockTime_.load();
+    uint32_t blockTime = lastBlockTime + size;
+    blockTime_ = blockTime;
+    blockTimeNs_ = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    dsp::NoteEvent events[dsp::CSynth::kMaxEventsPerBlock];
+    MidiManager.Lock();
+    uint32_t numEvents = MidiManager.PopEvents(blockTime, events);
+    MidiManager.Unlock();
     {
         std::lock_guard lock { dsp::gSafeCallback };
         dsp::gSafeCallback.HandleDirtyCallbacks();
     }
 
-    synth.Process(std::span{dacBuffer, size}, std::span{auxBuffer, size});
+    synth.Process(std::span{dacBuffer, size}, std::span{auxBuffer, size},
+                  std::span{events, numEvents}, lastBlockTime);
+    readPos_ = 0;
+}
+
+static void DAC_Callback(void* buffer, uint32_t size) {
     struct Wtf {
         float left;
         float rigth;
     };
+    // 回调的长度不固定, 按内部block大小切分
     Wtf* buf = static_cast<Wtf*>(buffer);
-    for (int i = 0; i < size; i++) {
-        buf[i].left = dacBuffer[i];
-        buf[i].rigth = auxBuffer[i];
+    for (uint32_t i = 0; i < size; i++) {
+        if (readPos_ >= blockSize_) {
+            RenderBlock();
+        }
+        buf[i].left = dacBuffer[readPos_];
+        buf[i].rigth = auxBuffer[readPos_];
+        ++readPos_;
     }
 }
 
@@ -147,13 +139,22 @@ static void MidiCallback(double timeStamp, std::vector<unsigned char>* message,
 OLEDDisplay display;
 OLEDRGBColor buffer[OLEDDisplay::kBufferSize];
 
-int main(void) {
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        blockSize_ = std::clamp<uint32_t>(std::atoi(argv[1]), kMinBlockSize, kMaxBlockSize);
+    }
+    readPos_ = blockSize_;
+
     InitWindow(OLEDDisplay::kWidth, OLEDDisplay::kHeight, "test");
     SetTargetFPS(60);
     InitAudioDevice();
-    auto stream = LoadAudioStream(48000, 512, 2);
+    // 让设备缓冲接近block大小, 低延迟模式才有意义
+    SetAudioStreamBufferSizeDefault(blockSize_);
+    auto stream = LoadAudioStream(kSampleRate, 512, 2);
     SetAudioStreamCallback(stream, DAC_Callback);
-    dsp::Synth.Init(48000);
+    dsp::Synth.Init(kSampleRate);
+    blockTimeNs_ = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    MidiManager.SetClock(HostSampleClock);
     dsp::gSafeCallback.MarkAll();
     PlayAudioStream(stream);
     
@@ -0,0 +1,236 @@
+// 从固件 BodyIR.cpp 里的琴体IR拟合模态数据, 生成 ModalBodyData.hpp
+// 用法: BodyFit <WaveGuideSoft/Waveguide/dsp/BodyIR.cpp> <输出的 ModalBodyData.hpp>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <fstream>
+#include <numbers>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "IRSource.hpp"
+
+using namespace tools;
+
+static constexpr uint32_t kMaxModes = 64;
+static constexpr uint32_t kFFTSize = 16384;
+static constexpr uint32_t kModesPerPass = 8;
+static constexpr float kSampleRate = 48000.0f;
+
+static std::string FloatLiteral(double v) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.9g", static_cast<float>(v));
+    std::string str(text);
+    if (str.find_first_of(".e") == std::string::npos) str += ".0";
+    return str + "f";
+}
+
+struct Mode {
+    double omega;
+    double radius;
+    double a;
+    double b;
+    double energy;
+};
+
+static void FFT(std::vector<std::complex<double>>& x) {
+    const size_t n = x.size();
+    for (size_t i = 1, j = 0; i < n; ++i) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(x[i], x[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1) {
+        auto w = std::polar(1.0, -2.0 * std::numbers::pi / len);
+        for (size_t i = 0; i < n; i += len) {
+            std::complex<double> wn = 1.0;
+            for (size_t k = 0; k < len / 2; ++k) {
+                auto u = x[i + k];
+                auto v = x[i + k + len / 2] * wn;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                wn *= w;
+            }
+        }
+    }
+}
+
+// 频谱峰值给出频率, -3dB带宽给出衰减, 跳过离已有模态太近的峰
+static void PickModes(const std::vector<double>& ir, std::vector<Mode>& modes, uint32_t count) {
+    std::vector<std::complex<double>> spec(kFFTSize);
+    for (size_t i = 0; i < ir.size(); ++i) spec[i] = ir[i];
+    FFT(spec);
+    std::vector<double> mag(kFFTSize / 2);
+    for (size_t i = 0; i < mag.size(); ++i) mag[i] = std::abs(spec[i]);
+
+    std::vector<uint32_t> peaks;
+    const uint32_t maxBin = static_cast<uint32_t>(mag.size() * 0.9);
+    for (uint32_t i = 3; i < maxBin; ++i) {
+        bool isPeak = true;
+        for (uint32_t j = i - 2; j <= i + 2; ++j) {
+            if (j != i && mag[j] >= mag[i]) isPeak = false;
+        }
+        if (isPeak) peaks.push_back(i);
+    }
+    std::sort(peaks.begin(), peaks.end(), [&](auto l, auto r) { return mag[l] > mag[r]; });
+
+    const size_t target = std::min<size_t>(modes.size() + count, kMaxModes);
+    for (auto p : peaks) {
+        if (modes.size() >= target) break;
+        double peakOmega = 2.0 * std::numbers::pi * p / kFFTSize;
+        bool used = std::any_of(modes.begin(), modes.end(), [&](const Mode& m) {
+            return std::abs(m.omega - peakOmega) < 4.0 * std::numbers::pi / kFFTSize;
+        });
+        if (used) continue;
+        // 抛物线插值
+        double l = std::log(mag[p - 1]);
+        double c = std::log(mag[p]);
+        double r = std::log(mag[p + 1]);
+        double delta = 0.5 * (l - r) / (l - 2.0 * c + r);
+        double bin = p + delta;
+
+        double half = mag[p] / std::numbers::sqrt2;
+        uint32_t lo = p;
+        uint32_t hi = p;
+        while (lo > 1 && mag[lo] > half && p - lo < 64) --lo;
+        while (hi < mag.size() - 1 && mag[hi] > half && hi - p < 64) ++hi;
+        double bandwidth = std::max(1.0, static_cast<double>(hi - lo)) * kSampleRate / kFFTSize;
+
+        Mode mode{};
+        mode.omega = 2.0 * std::numbers::pi * bin / kFFTSize;
+        mode.radius = std::clamp(std::exp(-std::numbers::pi * bandwidth / kSampleRate), 0.9, 0.99995);
+        modes.push_back(mode);
+    }
+}
+
+// 固定频率和衰减, 最小二乘求每个模态的 a*cos + b*sin
+static double FitGains(const std::vector<double>& ir, std::vector<Mode>& modes, std::vector<double>& residual) {
+    const size_t n = modes.size() * 2;
+    std::vector<std::vector<double>> basis(n, std::vector<double>(ir.size()));
+    for (size_t k = 0; k < modes.size(); ++k) {
+        double env = 1.0;
+        for (size_t i = 0; i < ir.size(); ++i) {
+            basis[2 * k][i] = env * std::cos(modes[k].omega * i);
+            basis[2 * k + 1][i] = env * std::sin(modes[k].omega * i);
+            env *= modes[k].radius;
+        }
+    }
+    std::vector<double> gram(n * n);
+    std::vector<double> rhs(n);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j <= i; ++j) {
+            double s = 0.0;
+            for (size_t t = 0; t < ir.size(); ++t) s += basis[i][t] * basis[j][t];
+            gram[i * n + j] = s;
+            gram[j * n + i] = s;
+        }
+        gram[i * n + i] += 1e-9;
+        double s = 0.0;
+        for (size_t t = 0; t < ir.size(); ++t) s += basis[i][t] * ir[t];
+        rhs[i] = s;
+    }
+    // cholesky
+    for (size_t j = 0; j < n; ++j) {
+        double d = gram[j * n + j];
+        for (size_t k = 0; k < j; ++k) d -= gram[j * n + k] * gram[j * n + k];
+        d = std::sqrt(std::max(d, 1e-12));
+        gram[j * n + j] = d;
+        for (size_t i = j + 1; i < n; ++i) {
+            double s = gram[i * n + j];
+            for (size_t k = 0; k < j; ++k) s -= gram[i * n + k] * gram[j * n + k];
+            gram[i * n + j] = s / d;
+        }
+    }
+    std::vector<double> x(rhs);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < i; ++k) x[i] -= gram[i * n + k] * x[k];
+        x[i] /= gram[i * n + i];
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t k = i + 1; k < n; ++k) x[i] -= gram[k * n + i] * x[k];
+        x[i] /= gram[i * n + i];
+    }
+
+    for (size_t k = 0; k < modes.size(); ++k) {
+        auto& m = modes[k];
+        m.a = x[2 * k];
+        m.b = x[2 * k + 1];
+        m.energy = (m.a * m.a + m.b * m.b) / (1.0 - m.radius * m.radius);
+    }
+
+    double err = 0.0;
+    double total = 0.0;
+    residual.resize(ir.size());
+    for (size_t t = 0; t < ir.size(); ++t) {
+        double y = 0.0;
+        for (size_t i = 0; i < n; ++i) y += x[i] * basis[i][t];
+        residual[t] = ir[t] - y;
+        err += residual[t] * residual[t];
+        total += ir[t] * ir[t];
+    }
+    return 10.0 * std::log10(err / total);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::printf("usage: BodyFit <BodyIR.cpp> <ModalBodyData.hpp>\n");
+        return 1;
+    }
+    std::ifstream in(argv[1]);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string source = buffer.str();
+
+    std::ofstream out(argv[2]);
+    out << "#pragma once\n";
+    out << "// 由 pctest/src/tools/BodyFit 从 BodyIR.cpp 的IR生成, 不要手动修改\n";
+    out << "#include \"ModalBody.hpp\"\n\n";
+    out << "namespace dsp {\n\n";
+    out << "inline constexpr ModalBodyData kModalBodies[] {\n";
+    for (auto* name : kIRNames) {
+        auto irf = ParsePackedIR(source, name);
+        if (irf.size() != kIRSize) {
+            std::printf("%s: not found\n", name);
+            return 1;
+        }
+        // 和 Body::DoBodyFFT 一样按能量归一化
+        double energy = 0.0;
+        for (auto s : irf) energy += s * s;
+        std::vector<double> ir(irf.size());
+        for (size_t i = 0; i < ir.size(); ++i) ir[i] = irf[i] / std::sqrt(energy);
+
+        // 每次从残差的频谱里补充模态, 再整体重新拟合增益
+        std::vector<Mode> modes;
+        std::vector<double> residual = ir;
+        double errDb = 0.0;
+        while (modes.size() < kMaxModes) {
+            size_t before = modes.size();
+            PickModes(residual, modes, kModesPerPass);
+            if (modes.size() == before) break;
+            errDb = FitGains(ir, modes, residual);
+        }
+        std::sort(modes.begin(), modes.end(), [](auto& l, auto& r) { return l.energy > r.energy; });
+        std::printf("%-10s %2zu modes, residual %.1f dB\n", name, modes.size(), errDb);
+
+        auto emit = [&](const char* field, auto get) {
+            out << "        ." << field << " {";
+            for (size_t k = 0; k < modes.size(); ++k) {
+                out << (k % 8 == 0 ? "\n            " : " ") << FloatLiteral(get(modes[k])) << ",";
+            }
+            out << "\n        },\n";
+        };
+        out << "    // " << name << ", residual " << std::lround(errDb) << " dB\n";
+        out << "    ModalBodyData{\n";
+        out << "        .numModes = " << modes.size() << ",\n";
+        emit("omega", [](const Mode& m) { return m.omega; });
+        emit("radius", [](const Mode& m) { return m.radius; });
+        emit("a", [](const Mode& m) { return m.a; });
+        emit("b", [](const Mode& m) { return m.b; });
+        out << "    },\n";
+    }
+    out << "};\n\n";
+    out << "}\n";
+    return 0;
+}
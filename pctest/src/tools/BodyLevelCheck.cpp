@@ -0,0 +1,93 @@
+// 检查 dsp/Body 各种模式下的电平: 模态琴体、commuted激励和卷积琴体的冲激响应能量应该相同
+// 用法: BodyLevelCheck
+// 全部通过时返回0
+#include "dsp/Body.hpp"
+#include <cmath>
+#include <cstdio>
+
+using namespace dsp;
+
+static constexpr float kSampleRate = 48000.0f;
+// 卷积的重叠相加缓冲是静态的, 每次都跑到完全衰减, 不影响下一次
+static constexpr uint32_t kNumBlocks = 1024;
+static constexpr uint32_t kBlockSize = 256;
+static constexpr float kStretches[] = { 0.5f, 1.0f, 2.0f, 3.0f };
+static constexpr double kToleranceDb = 0.25;
+
+static uint32_t numFailed;
+
+static void Check(bool ok, const char* what) {
+    std::printf("%-56s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) ++numFailed;
+}
+
+// wet gain 0dB时冲激响应的总能量
+static double ImpulseEnergy(uint32_t type, float stretch, bool modal) {
+    Body body;
+    body.Init(kSampleRate);
+    body.SetWetGain(0.0f);
+    body.SetEnabled(true);
+    body.SetModal(modal);
+    body.SetStretch(stretch);
+    body.SetBodyType(static_cast<BodyEnum>(type));
+    double energy = 0.0;
+    float buffer[kBlockSize];
+    for (uint32_t block = 0; block < kNumBlocks; ++block) {
+        std::fill(std::begin(buffer), std::end(buffer), 0.0f);
+        buffer[0] = block == 0 ? 1.0f : 0.0f;
+        body.Process(buffer, buffer);
+        for (float s : buffer) energy += s * s;
+    }
+    return energy;
+}
+
+// commuted激励里琴体的冲激响应是阶跃表的差分, 乘上输出增益
+static double CommutedEnergy(uint32_t type, float stretch) {
+    Body body;
+    body.Init(kSampleRate);
+    body.SetWetGain(0.0f);
+    body.SetEnabled(true);
+    body.SetStretch(stretch);
+    body.SetBodyType(static_cast<BodyEnum>(type));
+    Body::RebuildCommutedIfDirty();
+    const auto& e = Body::GetCommutedExciter();
+    const double gain = Body::GetCommutedGain();
+    double energy = 0.0;
+    double last = 0.0;
+    for (uint32_t t = 0; t < e.len; ++t) {
+        const double s = (e.step[t] - last) * gain;
+        last = e.step[t];
+        energy += s * s;
+    }
+    return energy;
+}
+
+int main() {
+    double maxDiff = 0.0;
+    for (uint32_t type = 0; type < Body::kNumBodys; ++type) {
+        for (float stretch : kStretches) {
+            const double fft = ImpulseEnergy(type, stretch, false);
+            const double modal = ImpulseEnergy(type, stretch, true);
+            const double diff = 10.0 * std::log10(modal / fft);
+            std::printf("%-8s stretch %.2f  fft %.4f  modal %.4f  %+6.2fdB\n", Body::GetName(type), stretch, fft, modal, diff);
+            maxDiff = std::max(maxDiff, std::abs(diff));
+        }
+    }
+    char what[64];
+    std::snprintf(what, sizeof(what), "modal level matches convolution within %.2fdB", kToleranceDb);
+    Check(maxDiff < kToleranceDb, what);
+
+    maxDiff = 0.0;
+    for (uint32_t type = 0; type < Body::kNumBodys; ++type) {
+        for (float stretch : kStretches) {
+            const double fft = ImpulseEnergy(type, stretch, false);
+            const double commuted = CommutedEnergy(type, stretch);
+            maxDiff = std::max(maxDiff, std::abs(10.0 * std::log10(commuted / fft)));
+        }
+    }
+    std::snprintf(what, sizeof(what), "commuted level matches convolution within %.2fdB", kToleranceDb);
+    Check(maxDiff < kToleranceDb, what);
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+// 把 float 的琴体IR压缩成 int16 + 缩放, 生成固件的 dsp/BodyIR.cpp
+// 用法: BodyPack <含有 constexpr float kName[4096] 的源文件> <输出的 BodyIR.cpp>
+#include "IRSource.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+using namespace tools;
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::printf("usage: BodyPack <source> <BodyIR.cpp>\n");
+        return 1;
+    }
+    std::ifstream in(argv[1]);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string source = buffer.str();
+
+    std::ofstream out(argv[2]);
+    out << "// 由 pctest/src/tools/BodyPack 生成, 不要手动修改\n";
+    out << "#include \"BodyIR.hpp\"\n";
+    out << "#include <iterator>\n\n";
+    out << "namespace dsp {\n\n";
+    for (auto* name : kIRNames) {
+        auto ir = ParseFloatIR(source, name);
+        if (ir.size() != kIRSize) {
+            std::printf("%s: not found\n", name);
+            return 1;
+        }
+        double peak = 0.0;
+        for (auto s : ir) peak = std::max(peak, std::abs(s));
+        const float scale = static_cast<float>(peak / 32767.0);
+
+        double err = 0.0;
+        double total = 0.0;
+        out << "static constexpr float " << name << "Scale = ";
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.9gf", scale);
+        out << text << ";\n";
+        out << "static constexpr int16_t " << name << "[BodyIR::kSize] = {";
+        for (size_t i = 0; i < ir.size(); ++i) {
+            auto q = static_cast<int16_t>(std::lround(ir[i] / scale));
+            double d = ir[i] - q * static_cast<double>(scale);
+            err += d * d;
+            total += ir[i] * ir[i];
+            out << (i % 32 == 0 ? "\n    " : "") << q << ",";
+        }
+        out << "\n};\n\n";
+        std::printf("%-10s scale %g, snr %.1f dB\n", name, scale, 10.0 * std::log10(total / err));
+    }
+    out << "const BodyIR kBodyIRs[] {\n";
+    for (auto* name : kIRNames) {
+        out << "    { " << name << ", " << name << "Scale },\n";
+    }
+    out << "};\n";
+    out << "const uint32_t kNumBodyIRs = std::size(kBodyIRs);\n\n";
+    out << "}\n";
+    return 0;
+}
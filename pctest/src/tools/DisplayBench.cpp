@@ -0,0 +1,267 @@
+// 测量 bsp/oled 的RGB OLEDDisplay 画一页文字界面的时间
+// 用法: DisplayBench
+// 对比三种: 改用32位字之前的逐像素画法(这里重新实现), 不带 TextCache, 带 TextCache
+// 字库是随机生成的, 宽度和真实字库一样: ASCII 6像素, 汉字 12像素, 高12
+// 三种画出的图像必须完全一样, 否则返回1
+#include "bsp/oled/OLEDDisplay.h"
+#include "bsp/oled/FontRGB.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+static constexpr uint16_t kFontHeight = 12;
+static constexpr uint16_t kAsciiFirst = 0x20;
+static constexpr uint16_t kAsciiLast = 0x7e;
+static constexpr uint16_t kCjkFirst = 0x4e00;
+static constexpr uint16_t kCjkLast = 0x9fa5;
+static constexpr uint32_t kNumAscii = kAsciiLast - kAsciiFirst + 1;
+static constexpr uint32_t kNumCjk = kCjkLast - kCjkFirst + 1;
+static constexpr uint32_t kNumGlyphs = kNumAscii + kNumCjk;
+static constexpr uint32_t kDataSize = kNumAscii * kFontHeight + kNumCjk * kFontHeight * 2;
+static constexpr uint32_t kNumPages = 3000;
+
+static const font_header_t header{ { 'F', 'N', 'T', 1 }, 0, kFontHeight, 1200, {}, 2, kNumGlyphs, kDataSize };
+static font_section_t sections[64];
+static font_index_t indexs[kNumGlyphs];
+static uint8_t data[kDataSize];
+// FONT_RGB_EXTERN 时 FontRGB.hpp 引用这些
+const font_header_t& font_header_rgb = header;
+const font_section_t (&font_sections_rgb)[64] = sections;
+const font_index_t* const font_indexs_rgb = indexs;
+extern const uint8_t* const font_data_rgb = data;
+
+// 每个字形由几条随机的横竖笔画组成, 最右一列留空, 密度和真实字库差不多
+static void MakeFont() {
+    std::mt19937 rng{ 1 };
+    sections[0] = { kAsciiFirst, kAsciiLast, 0 };
+    sections[1] = { kCjkFirst, kCjkLast, kNumAscii };
+    for (uint32_t i = 2; i < 64; ++i) {
+        sections[i] = { 0xffff, 0xffff, 0 };
+    }
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < kNumGlyphs; ++i) {
+        const bool ascii = i < kNumAscii;
+        const uint16_t width = ascii ? 6 : 12;
+        const uint16_t rasterWidth = (width + 7) / 8;
+        indexs[i] = { width, static_cast<uint16_t>(rasterWidth * kFontHeight), offset };
+        bool pixels[kFontHeight][12]{};
+        const uint32_t numStrokes = ascii ? 3 : 7;
+        for (uint32_t s = 0; s < numStrokes; ++s) {
+            const uint32_t a = rng() % (width - 1);
+            const uint32_t b = rng() % (width - 1);
+            const uint32_t row = 1 + rng() % (kFontHeight - 2);
+            const uint32_t col = rng() % (width - 1);
+            const uint32_t top = 1 + rng() % (kFontHeight - 2);
+            const uint32_t bottom = 1 + rng() % (kFontHeight - 2);
+            if (s % 2 == 0) {
+                for (uint32_t x = std::min(a, b); x <= std::max(a, b); ++x) pixels[row][x] = true;
+            }
+            else {
+                for (uint32_t y = std::min(top, bottom); y <= std::max(top, bottom); ++y) pixels[y][col] = true;
+            }
+        }
+        for (uint32_t row = 0; row < kFontHeight; ++row) {
+            for (uint32_t k = 0; k < rasterWidth; ++k) {
+                uint8_t byte = 0;
+                for (uint32_t bit = 0; bit < 8 && k * 8 + bit < width; ++bit) {
+                    if (pixels[row][k * 8 + bit]) byte |= 0x80 >> bit;
+                }
+                data[offset++] = byte;
+            }
+        }
+    }
+}
+
+// 改之前的画法: 逐字解码、查字库, 逐位 setPixel, fillRect 按列画
+struct Reference {
+    OLEDRGBColor buffer[OLEDDisplay::kBufferSize];
+    OledColorEnum color = OledColorEnum::kOledWHITE;
+
+    void SetPixel(int16_t x, int16_t y) {
+        if (x < 0 || x >= OLEDDisplay::kWidth || y < 0 || y >= OLEDDisplay::kHeight) return;
+        auto& p = buffer[x + y * OLEDDisplay::kWidth];
+        switch (color) {
+        case OledColorEnum::kOledWHITE:
+            p = colors::white;
+            break;
+        case OledColorEnum::kOledBLACK:
+            p = colors::black;
+            break;
+        case OledColorEnum::kOledINVERSE:
+            p.Inverse();
+            break;
+        }
+    }
+
+    void Fill() {
+        std::fill_n(buffer, OLEDDisplay::kBufferSize, colors::black);
+    }
+
+    void FillRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+        for (int16_t i = x; i < x + w; ++i) {
+            for (int16_t j = y; j < y + h; ++j) {
+                SetPixel(i, j);
+            }
+        }
+    }
+
+    static uint32_t Decode(std::string_view text, size_t& pos) {
+        const auto c = static_cast<uint8_t>(text[pos]);
+        if (c >= 0xe0) {
+            pos += 3;
+            return (c & 0x0f) << 12 | (text[pos - 2] & 0x3f) << 6 | (text[pos - 1] & 0x3f);
+        }
+        if (c >= 0xc0) {
+            pos += 2;
+            return (c & 0x1f) << 6 | (text[pos - 1] & 0x3f);
+        }
+        pos += 1;
+        return c;
+    }
+
+    // drawString 先量宽度再画, 解码两遍
+    static uint16_t Width(std::string_view text) {
+        uint16_t width = 0;
+        for (size_t pos = 0; pos < text.size();) {
+            const uint32_t idx = GetFontIndexIndex(static_cast<uint16_t>(Decode(text, pos)));
+            if (idx != kInvalidFontIndexIndex) width += font_indexs_rgb[idx].width;
+        }
+        return width;
+    }
+
+    void DrawString(int16_t x, int16_t y, std::string_view text) {
+        volatile uint16_t width = Width(text);
+        (void)width;
+        for (size_t pos = 0; pos < text.size();) {
+            const uint32_t idx = GetFontIndexIndex(static_cast<uint16_t>(Decode(text, pos)));
+            if (idx == kInvalidFontIndexIndex) continue;
+            const auto& glyph = font_indexs_rgb[idx];
+            const uint32_t rasterWidth = 1 + ((glyph.width - 1) >> 3);
+            int16_t px = x;
+            int16_t py = y;
+            for (uint32_t i = 0; i < glyph.size; ++i) {
+                if (i % rasterWidth == 0) {
+                    px = x;
+                    ++py;
+                }
+                uint8_t byte = font_data_rgb[glyph.offset + i];
+                for (uint32_t j = 0; j < 8; ++j) {
+                    if (byte & 0x80) SetPixel(px, py);
+                    byte <<= 1;
+                    ++px;
+                }
+            }
+            x += glyph.width;
+        }
+    }
+};
+
+static constexpr std::string_view kKnobNames[] {
+    "衰减", "激励", "色散", "位置", "音色", "损耗", "低切", "高切", "输出低", "输出高", "颤音", "Q"
+};
+static constexpr std::string_view kOptions[] { "设置", "波形", "模型", "混响", "预设" };
+static constexpr const char* kLines[] {
+    "八度:%d", "力度起点:%d", "最快:%d.5ms", "最慢:%dms", "dac:%dms", "adc %d/1023", "block:%d", "音量:%ddB"
+};
+
+// 和设置页差不多: 标题栏、8行格式化的数值、反色的选中行、12个旋钮名、底部选项
+// 数值每16页变化一次, 在4个值之间循环
+template<class Drawer>
+static void DrawPage(Drawer& d, uint32_t frame) {
+    char text[64];
+    d.Fill();
+    d.SetColor(OledColorEnum::kOledWHITE);
+    d.FillRect(0, 0, OLEDDisplay::kWidth, 12);
+    d.SetColor(OledColorEnum::kOledBLACK);
+    d.DrawString(0, 0, "keyboard settings");
+    d.SetColor(OledColorEnum::kOledWHITE);
+    for (int16_t i = 0; i < 8; ++i) {
+        std::snprintf(text, sizeof(text), kLines[i], static_cast<int>((frame / 16 + i) % 4 * 17));
+        d.DrawString(0, 12 + i * 12, text);
+    }
+    d.SetColor(OledColorEnum::kOledINVERSE);
+    d.FillRect(0, 12 + frame % 8 * 12, OLEDDisplay::kWidth / 2, 12);
+    d.SetColor(OledColorEnum::kOledWHITE);
+    for (int16_t i = 0; i < 12; ++i) {
+        d.DrawString(84 + i % 2 * 38, 12 + i / 2 * 12, kKnobNames[i]);
+    }
+    for (int16_t i = 0; i < 5; ++i) {
+        d.DrawString(i * OLEDDisplay::kWidth / 5, OLEDDisplay::kHeight - 12, kOptions[i]);
+    }
+}
+
+struct ReferenceDrawer {
+    Reference& r;
+    void Fill() { r.Fill(); }
+    void SetColor(OledColorEnum c) { r.color = c; }
+    void FillRect(int16_t x, int16_t y, int16_t w, int16_t h) { r.FillRect(x, y, w, h); }
+    void DrawString(int16_t x, int16_t y, std::string_view text) { r.DrawString(x, y, text); }
+};
+
+struct DisplayDrawer {
+    OLEDDisplay& d;
+    void Fill() { d.Fill(OledColorEnum::kOledBLACK); }
+    void SetColor(OledColorEnum c) { d.setColor(c); }
+    void FillRect(int16_t x, int16_t y, int16_t w, int16_t h) { d.fillRect(x, y, w, h); }
+    void DrawString(int16_t x, int16_t y, std::string_view text) { d.drawString(x, y, text); }
+};
+
+// 重复几次取最快的一次, 减少主机上调度的干扰
+template<class Drawer>
+static double UsPerPage(Drawer& d) {
+    double best = 1e9;
+    for (uint32_t repeat = 0; repeat < 10; ++repeat) {
+        auto begin = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < kNumPages; ++i) {
+            DrawPage(d, i);
+        }
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(end - begin).count() / kNumPages);
+    }
+    return best;
+}
+
+static Reference reference;
+static OLEDRGBColor plainBuffer[OLEDDisplay::kBufferSize];
+static OLEDRGBColor cachedBuffer[OLEDDisplay::kBufferSize];
+static TextCache cache;
+
+int main() {
+    MakeFont();
+
+    OLEDDisplay plain;
+    plain.SetDisplayBuffer(plainBuffer);
+    OLEDDisplay cached;
+    cached.SetDisplayBuffer(cachedBuffer);
+    cached.SetTextCache(&cache);
+
+    ReferenceDrawer refDrawer{ reference };
+    DisplayDrawer plainDrawer{ plain };
+    DisplayDrawer cachedDrawer{ cached };
+
+    // 每一帧都比较, 覆盖缓存未命中和命中
+    bool same = true;
+    for (uint32_t i = 0; i < 16; ++i) {
+        DrawPage(refDrawer, i);
+        DrawPage(plainDrawer, i);
+        DrawPage(cachedDrawer, i);
+        same = same && std::memcmp(reference.buffer, plainBuffer, sizeof(plainBuffer)) == 0
+            && std::memcmp(reference.buffer, cachedBuffer, sizeof(cachedBuffer)) == 0;
+    }
+
+    const double refUs = UsPerPage(refDrawer);
+    const double plainUs = UsPerPage(plainDrawer);
+    const double cachedUs = UsPerPage(cachedDrawer);
+    std::printf("%-28s %10s %8s\n", "renderer", "us/page", "speedup");
+    std::printf("%-28s %10.2f %8.2f\n", "per-pixel (before)", refUs, 1.0);
+    std::printf("%-28s %10.2f %8.2f\n", "word blit, no cache", plainUs, refUs / plainUs);
+    std::printf("%-28s %10.2f %8.2f\n", "word blit, TextCache", cachedUs, refUs / cachedUs);
+    const double total = cache.GetHits() + cache.GetMisses();
+    std::printf("cache hit rate %.1f%% (%u entries)\n", 100.0 * cache.GetHits() / total, TextCache::kNumEntries);
+    std::printf("images %s\n", same ? "identical" : "DIFFER");
+    std::printf("%s\n", same ? "ok" : "FAILED");
+    return same ? 0 : 1;
+}
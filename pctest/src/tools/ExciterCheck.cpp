@@ -0,0 +1,134 @@
+// 检查 dsp/ExciterBank 的表和 ExciterPlayer 的播放, 和逐个采样计算的激励比较
+// 激励 = Lowpass(DCBlocker(Lerp(dc脉冲, 噪声, color))) / 2, 和改成查表之前的 PluckString 相同
+// 用法: ExciterCheck
+// 全部通过时返回0
+#include "dsp/ExciterBank.hpp"
+#include "dsp/BlockNoise.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace dsp;
+
+static constexpr float kSampleRate = 48000.0f;
+static constexpr float kPluckPosition = 0.25f;
+static constexpr Lowpass::LoopFilterType kTypes[] {
+    Lowpass::LoopFilterType::IIR_LPF1, Lowpass::LoopFilterType::IIR_LPF2
+};
+
+static uint32_t numFailed;
+
+static void Check(bool ok, const char* what) {
+    std::printf("%-64s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) ++numFailed;
+}
+
+// 表的截止频率, 谐波次数
+static float TableRatio(const ExciterBank::Table& table, Lowpass::LoopFilterType type) {
+    for (uint32_t k = 0; k < ExciterBank::kNumCutoffs; ++k) {
+        const float ratio = std::exp2(k * 0.5f);
+        if (&ExciterBank::GetTable(type, ratio, ratio) == &table) return ratio;
+    }
+    return 0.0f;
+}
+
+// 逐个采样计算, noise 为长度是一个周期的噪声
+static std::vector<float> Reference(Lowpass::LoopFilterType type, float cutoff, uint32_t period, float color,
+                                    const std::vector<float>& noise, uint32_t len) {
+    DCBlocker995 dcBlocker;
+    Lowpass filter;
+    filter.Init(kSampleRate);
+    filter.SetLoopFilterType(type);
+    filter.SetCutOffFreq(cutoff);
+    const auto pos = static_cast<uint32_t>(period * kPluckPosition);
+    std::vector<float> out(len);
+    for (uint32_t t = 0; t < len; ++t) {
+        float dc = t < pos ? 0.5f : t < period ? -0.5f : 0.0f;
+        float n = 0.0f;
+        if (t < period) n += noise[t];
+        if (t >= pos && t - pos < period) n -= noise[t - pos];
+        const float in = dc + color * (n - dc);
+        out[t] = filter.Process(dcBlocker.Process(in)) * 0.5f;
+    }
+    return out;
+}
+
+static std::vector<float> Play(const ExciterBank::Table& table, uint32_t period, float color) {
+    ExciterPlayer player;
+    const float mix[ExciterBank::kNumVariants] { 1.0f, 0.0f };
+    player.Start(table, static_cast<float>(period), kPluckPosition, (1.0f - color) * 0.5f, color * 0.5f, mix);
+    std::vector<float> out;
+    while (player.IsActive()) {
+        out.push_back(player.Process());
+    }
+    return out;
+}
+
+// 参考信号和误差的能量比, dB
+static double Snr(const std::vector<float>& ref, const std::vector<float>& out) {
+    double signal = 0.0;
+    double error = 0.0;
+    for (size_t t = 0; t < ref.size(); ++t) {
+        const double y = t < out.size() ? out[t] : 0.0;
+        signal += ref[t] * ref[t];
+        error += (ref[t] - y) * (ref[t] - y);
+    }
+    return 10.0 * std::log10(signal / std::max(error, 1e-30));
+}
+
+int main() {
+    ExciterBank::Init(kSampleRate);
+
+    // 表里的噪声是 seed 0 的前 kRefPeriod 个
+    std::vector<float> noise(ExciterBank::kRefPeriod);
+    BlockNoise gen;
+    gen.SetSeed(0);
+    gen.Fill(noise);
+
+    // 参考周期上没有拉伸, 只有int16的量化误差
+    double maxError = 0.0;
+    for (auto type : kTypes) {
+        for (uint32_t k = 0; k < ExciterBank::kNumCutoffs; ++k) {
+            const float ratio = std::exp2(k * 0.5f);
+            const auto& table = ExciterBank::GetTable(type, ratio, ratio);
+            const auto out = Play(table, ExciterBank::kRefPeriod, 0.5f);
+            const float cutoff = ratio * kSampleRate / ExciterBank::kRefPeriod;
+            const auto ref = Reference(type, cutoff, ExciterBank::kRefPeriod, 0.5f, noise, out.size());
+            for (size_t t = 0; t < out.size(); ++t) {
+                maxError = std::max(maxError, static_cast<double>(std::abs(out[t] - ref[t])));
+            }
+        }
+    }
+    std::printf("reference period, max error %.2e\n", maxError);
+    Check(maxError < 1e-3, "reference period matches the per-sample chain within 1e-3");
+
+    // 其他周期只比较dc脉冲, 噪声的序列不同; 截止频率要求64次谐波, 按周期限制
+    // 逐个采样的滤波器截止频率越接近奈奎斯特频率, 双线性变换的频率弯曲越大, 拉伸后的表不会有这部分弯曲,
+    // 所以能量都要相同, 波形只在截止频率不超过 fs/4 的周期上比较
+    double maxEnergyDiff = 0.0;
+    double minSnr = 1e9;
+    for (auto type : kTypes) {
+        for (uint32_t period : { 12u, 24u, 48u, 96u, 384u, 768u, 1536u }) {
+            const auto& table = ExciterBank::GetTable(type, 64.0f, period * 0.5f);
+            const float ratio = TableRatio(table, type);
+            const auto out = Play(table, period, 0.0f);
+            const float cutoff = ratio * kSampleRate / period;
+            const auto ref = Reference(type, cutoff, period, 0.0f, noise, out.size() + period * 8);
+            double refEnergy = 0.0;
+            double outEnergy = 0.0;
+            for (float s : ref) refEnergy += s * s;
+            for (float s : out) outEnergy += s * s;
+            const double energyDiff = 10.0 * std::log10(outEnergy / refEnergy);
+            const double snr = Snr(ref, out);
+            std::printf("type %u period %4u harmonics %5.1f  level %+5.2fdB  snr %5.1fdB\n",
+                        static_cast<uint32_t>(type), period, ratio, energyDiff, snr);
+            maxEnergyDiff = std::max(maxEnergyDiff, std::abs(energyDiff));
+            if (cutoff <= kSampleRate / 4) minSnr = std::min(minSnr, snr);
+        }
+    }
+    Check(maxEnergyDiff < 0.5, "stretched pulse level matches the per-sample chain within 0.5dB");
+    Check(minSnr > 12.0, "stretched pulse waveform matches below fs/4, snr > 12dB");
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// 在每个调用处的输入范围上, 对比 dsp/FastMath.hpp 和 libm(float) 相对 double 参考值的误差和速度
+// 误差超过 FastMath.hpp 注释里的上限时失败; 速度只打印, 比libm慢的调用处应改回libm
+// 用法: FastMathBench
+// 全部通过时返回0
+#include "dsp/FastMath.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <numbers>
+#include <vector>
+
+using namespace dsp;
+
+static constexpr uint32_t kNumPoints = 1 << 20;
+static constexpr float kSampleRate = 48000.0f;
+
+// 误差都是相对误差 |y / ref - 1|
+struct CallSite {
+    const char* name;
+    float lo;
+    float hi;
+    float (*fast)(float);
+    float (*libm)(float);
+    double (*ref)(double);
+    // FastMath.hpp 中写的误差上限
+    double (*bound)(double);
+};
+
+static uint32_t numFailed;
+
+static double Error(double y, double ref) {
+    return std::abs(y / ref - 1.0);
+}
+
+static double MaxError(const CallSite& site, const std::vector<float>& xs, float (*f)(float)) {
+    double err = 0.0;
+    for (auto x : xs) {
+        err = std::max(err, Error(f(x), site.ref(x)));
+    }
+    return err;
+}
+
+// 超出上限的点数
+static uint32_t NumOverBound(const CallSite& site, const std::vector<float>& xs) {
+    uint32_t num = 0;
+    for (auto x : xs) {
+        if (Error(site.fast(x), site.ref(x)) > site.bound(x)) ++num;
+    }
+    return num;
+}
+
+static double NsPerCall(const std::vector<float>& xs, float (*f)(float)) {
+    volatile float sink = 0.0f;
+    auto begin = std::chrono::steady_clock::now();
+    float sum = 0.0f;
+    for (auto x : xs) {
+        sum += f(x);
+    }
+    sink = sum;
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - begin).count() / xs.size();
+}
+
+int main() {
+    constexpr double kPi = std::numbers::pi;
+    const CallSite sites[] {
+        // 8Hz ~ Lowpass::GetMaxFreq()
+        { "Lowpass/OnePole tan(w/2)", kPi * 8.0f / kSampleRate, kPi * 20000.0f / kSampleRate,
+          [](float x) { return fastmath::Tan(x); },
+          [](float x) { return std::tan(x); },
+          [](double x) { return std::tan(x); },
+          [](double) { return 5e-7; } },
+        // -(delayLen / (sampleRate * decayMs / 1000))
+        { "SetDecay/UpdateDecay pow10", -6.0f, 0.0f,
+          [](float x) { return fastmath::Pow10(x); },
+          [](float x) { return std::pow(10.0f, x); },
+          [](double x) { return std::pow(10.0, x); },
+          [](double x) { return 2e-7 + std::abs(x) * 2e-7; } },
+        { "Body::SetWetGain pow10", -3.0f, 3.0f,
+          [](float x) { return fastmath::Pow10(x); },
+          [](float x) { return std::pow(10.0f, x); },
+          [](double x) { return std::pow(10.0, x); },
+          [](double x) { return 2e-7 + std::abs(x) * 2e-7; } },
+    };
+
+    std::printf("%-28s %12s %12s %10s %10s\n", "call site", "fast err", "libm err", "fast ns", "libm ns");
+    for (const auto& site : sites) {
+        std::vector<float> xs(kNumPoints);
+        for (uint32_t i = 0; i < kNumPoints; ++i) {
+            xs[i] = site.lo + (site.hi - site.lo) * i / (kNumPoints - 1);
+        }
+        const double fastNs = NsPerCall(xs, site.fast);
+        const double libmNs = NsPerCall(xs, site.libm);
+        std::printf("%-28s %12.3g %12.3g %10.2f %10.2f%s\n", site.name,
+                    MaxError(site, xs, site.fast), MaxError(site, xs, site.libm),
+                    fastNs, libmNs, fastNs < libmNs ? "" : "  slower than libm");
+        const uint32_t numOver = NumOverBound(site, xs);
+        if (numOver > 0) {
+            std::printf("  %u points over the documented bound  FAILED\n", numOver);
+            ++numFailed;
+        }
+    }
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}
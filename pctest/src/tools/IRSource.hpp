@@ -0,0 +1,48 @@
+#pragma once
+// 琴体工具共用: 从源文件中读取IR数组
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace tools {
+
+static constexpr uint32_t kIRSize = 4096;
+// BodyEnum 的顺序
+static constexpr const char* kIRNames[] {
+    "kBanjo", "kCalcani", "kGuitar", "kKlotz", "kLanghof", "kBanjo2", "kDobro", "kViola", "kGuzheng"
+};
+
+inline std::vector<double> ParseList(const std::string& source, const std::string& decl) {
+    std::vector<double> values;
+    // 只匹配行首的声明, 跳过被注释掉的同名数组
+    size_t pos = source.find("\n" + decl);
+    if (pos == std::string::npos) return values;
+    pos = source.find('{', pos) + 1;
+    size_t end = source.find('}', pos);
+    std::stringstream ss(source.substr(pos, end - pos));
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.find_first_not_of(" \r\n\t") == std::string::npos) continue;
+        values.push_back(std::stod(item));
+    }
+    return values;
+}
+
+// 原始格式: constexpr float kName[4096] = {...};
+inline std::vector<double> ParseFloatIR(const std::string& source, const char* name) {
+    return ParseList(source, std::string("constexpr float ") + name + "[");
+}
+
+// BodyPack 生成的格式: static constexpr int16_t kName[BodyIR::kSize] = {...}; 和 kNameScale
+inline std::vector<double> ParsePackedIR(const std::string& source, const char* name) {
+    auto values = ParseList(source, std::string("static constexpr int16_t ") + name + "[");
+    std::string scaleDecl = std::string("static constexpr float ") + name + "Scale = ";
+    size_t pos = source.find(scaleDecl);
+    if (pos == std::string::npos) return {};
+    double scale = std::stod(source.substr(pos + scaleDecl.size()));
+    for (auto& v : values) v *= scale;
+    return values;
+}
+
+}
@@ -0,0 +1,93 @@
+// 检查 ch552keyboard/include/KeyFrame.h 的编解码和CRC
+// 用法: KeyFrameCheck
+// 全部通过时返回0
+#include "KeyFrame.h"
+#include <cstdio>
+#include <cstring>
+
+static uint32_t numFailed;
+
+static void Check(bool ok, const char* what) {
+    std::printf("%-48s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) ++numFailed;
+}
+
+static bool Decodes(const uint8_t* data) {
+    KeyFrame frame;
+    return KeyFrame_Decode(data, &frame) != 0;
+}
+
+int main() {
+    // CRC-8/SAE-J1850 的标准校验值
+    const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    Check(KeyFrame_Crc8(check, sizeof(check)) == 0x4b, "crc8(\"123456789\") == 0x4b");
+
+    // 所有adc和seq组合, pos 和 tick 取一些值
+    bool roundTrip = true;
+    for (uint32_t adc = 0; adc <= KEYFRAME_ADC_MAX; ++adc) {
+        for (uint32_t seq = 0; seq <= KEYFRAME_SEQ_MASK; ++seq) {
+            const KeyFrame in{ static_cast<uint16_t>(adc), static_cast<int8_t>(adc * 7 + seq),
+                               static_cast<uint8_t>(seq), static_cast<uint8_t>(adc ^ seq) };
+            uint8_t data[KEYFRAME_SIZE];
+            KeyFrame_Encode(&in, data);
+            KeyFrame out{};
+            roundTrip = roundTrip && KeyFrame_Decode(data, &out)
+                && out.adc == in.adc && out.pos == in.pos && out.seq == in.seq && out.tick == in.tick;
+        }
+    }
+    Check(roundTrip, "encode/decode round trip");
+
+    // MISO一直是低或者一直是高
+    uint8_t stuck[KEYFRAME_SIZE];
+    std::memset(stuck, 0x00, sizeof(stuck));
+    Check(!Decodes(stuck), "all 0x00 rejected");
+    std::memset(stuck, 0xff, sizeof(stuck));
+    Check(!Decodes(stuck), "all 0xff rejected");
+
+    // 对一些帧检查所有1位、2位错误和不超过8位的突发错误, 位按SPI发送的顺序(MSB先)
+    constexpr uint32_t kBits = KEYFRAME_SIZE * 8;
+    bool single = true;
+    bool dual = true;
+    bool burst = true;
+    for (uint32_t n = 0; n < 256; ++n) {
+        const KeyFrame in{ static_cast<uint16_t>(n * 4), static_cast<int8_t>(n), static_cast<uint8_t>(n & KEYFRAME_SEQ_MASK),
+                           static_cast<uint8_t>(n * 3) };
+        uint8_t data[KEYFRAME_SIZE];
+        KeyFrame_Encode(&in, data);
+        for (uint32_t i = 0; i < kBits; ++i) {
+            uint8_t e[KEYFRAME_SIZE];
+            std::memcpy(e, data, sizeof(e));
+            e[i / 8] ^= 0x80 >> (i % 8);
+            single = single && !Decodes(e);
+            for (uint32_t j = i + 1; j < kBits; ++j) {
+                uint8_t e2[KEYFRAME_SIZE];
+                std::memcpy(e2, e, sizeof(e2));
+                e2[j / 8] ^= 0x80 >> (j % 8);
+                dual = dual && !Decodes(e2);
+            }
+        }
+        // 突发错误: 首尾两位必错, 中间任意
+        for (uint32_t len = 2; len <= 8; ++len) {
+            for (uint32_t start = 0; start + len <= kBits; ++start) {
+                for (uint32_t mid = 0; mid < (1u << (len - 2)); ++mid) {
+                    const uint32_t pattern = 1 | (mid << 1) | (1u << (len - 1));
+                    uint8_t e[KEYFRAME_SIZE];
+                    std::memcpy(e, data, sizeof(e));
+                    for (uint32_t b = 0; b < len; ++b) {
+                        if (pattern >> b & 1) {
+                            const uint32_t bit = start + b;
+                            e[bit / 8] ^= 0x80 >> (bit % 8);
+                        }
+                    }
+                    burst = burst && !Decodes(e);
+                }
+            }
+        }
+    }
+    Check(single, "all 1-bit errors detected");
+    Check(dual, "all 2-bit errors detected");
+    Check(burst, "all burst errors up to 8 bits detected");
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,207 @@
+// 用模拟的按键总线运行固件的 bsp::CKeyScanner, 检查扫描率、地址切换和快照
+// 用法: KeyScanSim [--seconds <s>] [--latency <us>] [--miss <N>] [--corrupt <N>] [--stale <N>] [--dead <address>]
+//   --latency  CH552被选中到拉低IRQ的最长时间, 实际在一半到这个值之间随机
+//   --miss     平均每N次选中有一次不回应
+//   --corrupt  平均每N帧有一帧错一位
+//   --stale    平均每N次读到和上次相同的采样
+//   --dead     这个地址的模块从不回应
+// 时间以微秒推进, 键盘任务每1ms醒来一次, 和固件里的 CKeyboard::UpdateData 一样
+// 取出结果后马上开始下一轮, 每等1ms没有结束就调用 SkipStalled
+#include "bsp/KeyScanner.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using bsp::CKeyScanner;
+
+static constexpr uint64_t kNever = UINT64_MAX;
+// SPI6 120MHz/64, 5字节加上4个3周期的字节间隔
+static constexpr uint64_t kTransferUs = 28;
+static constexpr uint64_t kTaskIntervalUs = 1000;
+static constexpr uint64_t kScanTimeoutUs = 1000;
+
+static constexpr uint8_t kKeyboardMap[] {
+    8, 10, 9, 11, 7, 6, 0, 2, 5, 4, 3, 1
+};
+
+struct Sim {
+    uint64_t now{};
+    uint64_t readyAt{ kNever };
+    uint64_t receivedAt{ kNever };
+    uint8_t address{ 12 };
+    uint8_t* rxBuffer{};
+    CKeyScanner::Frame pending{};
+    bool pendingCorrupt{};
+    KeyFrame pendingFrame{};
+    bool scanDone{};
+    uint64_t doneAt{};
+
+    uint32_t maxLatency{ 60 };
+    uint32_t missEvery{};
+    uint32_t corruptEvery{};
+    uint32_t staleEvery{};
+    uint32_t deadAddress{ UINT32_MAX };
+    std::mt19937 rng{ 1 };
+
+    // 每个按键最后一次发出的有效数据
+    KeyFrame sent[CKeyScanner::kNumKeys]{};
+    // 最后一次收到的数据和前一次的seq不同
+    bool sentFresh[CKeyScanner::kNumKeys]{};
+    KeyFrame latest[CKeyScanner::kNumKeys]{};
+    uint32_t numGlitches{};
+    uint32_t numCorrupted{};
+};
+
+static Sim sim;
+static CKeyScanner scanner;
+
+static bool Chance(uint32_t every) {
+    return every != 0 && sim.rng() % every == 0;
+}
+
+static const CKeyScanner::Bus kSimBus {
+    .select = [](uint8_t address) {
+        if (std::popcount(static_cast<uint32_t>(address ^ sim.address)) != 1) {
+            ++sim.numGlitches;
+        }
+        sim.address = address;
+        sim.readyAt = kNever;
+        if (address < CKeyScanner::kNumKeys && address != sim.deadAddress && !Chance(sim.missEvery)) {
+            const uint32_t latency = sim.maxLatency / 2 + sim.rng() % (sim.maxLatency / 2 + 1);
+            sim.readyAt = sim.now + latency;
+        }
+    },
+    .receive = [](uint8_t* buffer) {
+        const uint32_t key = kKeyboardMap[sim.address];
+        auto& frame = sim.latest[key];
+        // 按键的数据随时间变化, 让旧值和新值能区分开
+        const bool fresh = frame.adc == 0 || !Chance(sim.staleEvery);
+        if (fresh) {
+            frame.adc = 124 + (sim.now / 10 + key * 67) % 900;
+            frame.pos = static_cast<int8_t>((sim.now / 50 + key * 31) % 255 - 127);
+            frame.seq = (frame.seq + 1) & KEYFRAME_SEQ_MASK;
+            frame.tick = static_cast<uint8_t>(sim.now / 100);
+        }
+        KeyFrame_Encode(&frame, sim.pending.data);
+        sim.pendingFrame = frame;
+        sim.pendingCorrupt = Chance(sim.corruptEvery);
+        if (sim.pendingCorrupt) {
+            const uint32_t bit = sim.rng() % (KEYFRAME_SIZE * 8);
+            sim.pending.data[bit / 8] ^= 1 << (bit % 8);
+        }
+        sim.rxBuffer = buffer;
+        sim.receivedAt = sim.now + kTransferUs;
+        sim.readyAt = kNever;
+    },
+    .cancel = [] {
+        sim.receivedAt = kNever;
+    },
+    .scanDone = [] {
+        sim.scanDone = true;
+        sim.doneAt = sim.now;
+    },
+};
+
+// 运行中断直到 until 或者扫描结束
+static void RunUntil(uint64_t until, bool stopOnDone) {
+    while (!(stopOnDone && sim.scanDone)) {
+        const uint64_t next = std::min(sim.readyAt, sim.receivedAt);
+        if (next > until) break;
+        sim.now = next;
+        if (next == sim.receivedAt) {
+            sim.receivedAt = kNever;
+            std::memcpy(sim.rxBuffer, &sim.pending, sizeof(sim.pending));
+            // 被 Skip 取消的接收不算
+            const uint32_t key = kKeyboardMap[sim.address];
+            if (sim.pendingCorrupt) {
+                ++sim.numCorrupted;
+            }
+            else {
+                sim.sentFresh[key] = sim.sent[key].seq != sim.pendingFrame.seq;
+                sim.sent[key] = sim.pendingFrame;
+            }
+            scanner.OnReceived();
+        }
+        else {
+            sim.readyAt = kNever;
+            scanner.OnReady();
+        }
+    }
+    if (!(stopOnDone && sim.scanDone)) sim.now = until;
+}
+
+int main(int argc, char** argv) {
+    double seconds = 10.0;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--seconds")) seconds = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--latency")) sim.maxLatency = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--miss")) sim.missEvery = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--corrupt")) sim.corruptEvery = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--stale")) sim.staleEvery = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--dead")) sim.deadAddress = std::atoi(argv[i + 1]);
+        else {
+            std::printf("unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    static CKeyScanner::Frame frames[CKeyScanner::kNumKeys];
+    scanner.Init(kSimBus, frames);
+    scanner.Start();
+
+    const uint64_t end = static_cast<uint64_t>(seconds * 1e6);
+    uint32_t numScans = 0;
+    uint32_t numSkips = 0;
+    uint32_t numUpdates = 0;
+    uint32_t numErrors = 0;
+    uint32_t numStaleErrors = 0;
+    uint64_t lastScans = 0;
+    uint64_t scanStart = 0;
+    uint64_t totalScanUs = 0;
+    for (uint64_t wake = kTaskIntervalUs; wake < end; wake += kTaskIntervalUs) {
+        RunUntil(wake, false);
+
+        // UpdateData
+        for (;;) {
+            RunUntil(sim.now + kScanTimeoutUs, true);
+            if (sim.scanDone) break;
+            scanner.SkipStalled();
+            ++numSkips;
+        }
+        totalScanUs += sim.doneAt - scanStart;
+        sim.scanDone = false;
+
+        CKeyScanner::Snapshot snapshot;
+        scanner.GetSnapshot(snapshot);
+        scanStart = sim.now;
+        scanner.Start();
+
+        if (snapshot.scans != lastScans + 1) ++numErrors;
+        lastScans = snapshot.scans;
+        ++numScans;
+        for (uint32_t key = 0; key < CKeyScanner::kNumKeys; ++key) {
+            if (!(snapshot.updated & (1 << key))) continue;
+            ++numUpdates;
+            const auto& sent = sim.sent[key];
+            if (snapshot.adc[key] != sent.adc || snapshot.pos[key] != sent.pos || snapshot.tick[key] != sent.tick) ++numErrors;
+            if (static_cast<bool>(snapshot.fresh & (1 << key)) != sim.sentFresh[key]) ++numStaleErrors;
+        }
+        // vTaskDelayUntil: 已经超时的话直接进入下一个周期
+        if (sim.now > wake + kTaskIntervalUs) {
+            wake = sim.now / kTaskIntervalUs * kTaskIntervalUs;
+        }
+    }
+
+    const double expected = static_cast<double>(numScans) * CKeyScanner::kNumKeys;
+    std::printf("scans: %u (%.0f Hz), mean scan %.0f us, stall checks %u\n",
+                numScans, numScans / seconds, static_cast<double>(totalScanUs) / numScans, numSkips);
+    std::printf("key updates: %u / %.0f, missed %u, invalid %u (corrupted %u)\n",
+                numUpdates, expected, scanner.GetNumMissed(), scanner.GetNumInvalid(), sim.numCorrupted);
+    std::printf("address glitches: %u, snapshot errors: %u, fresh flag errors: %u\n", sim.numGlitches, numErrors, numStaleErrors);
+    const bool ok = sim.numGlitches == 0 && numErrors == 0 && numStaleErrors == 0 && scanner.GetNumInvalid() == sim.numCorrupted;
+    std::printf("%s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
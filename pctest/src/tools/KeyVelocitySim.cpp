@@ -0,0 +1,161 @@
+// 用模拟的按键轨迹运行固件的 bsp::CKeyVelocity, 和按真实行程时间算出的力度比较
+// 用法: KeyVelocitySim [--noise <n>] [--stale <N>] [--jitter <us>]
+//   --noise   adc上叠加 ±n 的均匀噪声, 10位
+//   --stale   平均每N轮有一次读到旧采样
+//   --jitter  采样时间比扫描早 0 到这个值之间的随机时间
+// 12个按键各用不同的速度按下、按住、半抬起再按下、抬起, 每1ms扫描一次
+// 按下判断和 CKeyboard::ProcessData 一样用8位的原始adc, 那一刻读取力度
+#include "bsp/KeyVelocity.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+using bsp::CKeyScanner;
+using bsp::CKeyVelocity;
+
+static constexpr uint32_t kNumKeys = CKeyVelocity::kNumKeys;
+static constexpr uint64_t kScanUs = 1000;
+// 和 CKeyboard 的默认值一样, 8位
+static constexpr double kRest = 135 * 4;
+static constexpr double kBottom = 55 * 4;
+static constexpr uint8_t kStartValue = 128;
+static constexpr uint8_t kDownValue = 115;
+static constexpr uint8_t kUpValue = 120;
+static constexpr uint16_t kFastTime = 15;
+static constexpr uint16_t kSlowTime = 200;
+// 半抬起停在这里, 在弹起值之上, 起点之下
+static constexpr double kHalfRelease = 124 * 4;
+
+struct Segment {
+    double from;
+    double to;
+    double durationMs;
+};
+
+// 一个按键的轨迹, 分段线性
+struct Key {
+    Segment segments[8];
+    uint32_t numSegments;
+    double speed;
+
+    double Level(double ms) const {
+        for (uint32_t i = 0; i < numSegments; ++i) {
+            const auto& s = segments[i];
+            if (ms < s.durationMs) return s.from + (s.to - s.from) * ms / s.durationMs;
+            ms -= s.durationMs;
+        }
+        return segments[numSegments - 1].to;
+    }
+};
+
+// 和 CKeyVelocity::SetCurve 的曲线一样, 用浮点算
+static double IdealVelocity(double travelMs) {
+    const double t = travelMs * 10.0;
+    if (t <= kFastTime) return 127.0;
+    if (t >= kSlowTime) return 1.0;
+    return 1.0 + 126.0 * std::log(kSlowTime / t) / std::log(static_cast<double>(kSlowTime) / kFastTime);
+}
+
+int main(int argc, char** argv) {
+    double noise = 0.0;
+    uint32_t staleEvery = 0;
+    uint32_t jitterUs = 300;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--noise")) noise = std::atof(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--stale")) staleEvery = std::atoi(argv[i + 1]);
+        else if (!std::strcmp(argv[i], "--jitter")) jitterUs = std::atoi(argv[i + 1]);
+        else {
+            std::printf("unknown option: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // 按键速度, adc/ms, 覆盖从最快到最慢
+    Key keys[kNumKeys]{};
+    for (uint32_t i = 0; i < kNumKeys; ++i) {
+        auto& k = keys[i];
+        k.speed = 40.0 * std::pow(0.72, i);
+        const double fall = (kRest - kBottom) / k.speed;
+        const double halfRise = (kHalfRelease - kBottom) / k.speed;
+        const double refall = (kHalfRelease - kBottom) / k.speed;
+        k.segments[0] = { kRest, kRest, 20.0 + i * 3.0 };
+        k.segments[1] = { kRest, kBottom, fall };
+        k.segments[2] = { kBottom, kBottom, 50.0 };
+        k.segments[3] = { kBottom, kHalfRelease, halfRise };
+        k.segments[4] = { kHalfRelease, kHalfRelease, 30.0 };
+        k.segments[5] = { kHalfRelease, kBottom, refall };
+        k.segments[6] = { kBottom, kBottom, 50.0 };
+        k.segments[7] = { kBottom, kRest, fall };
+        k.numSegments = 8;
+    }
+
+    CKeyVelocity velocity;
+    velocity.SetThresholds(kStartValue << 2, kDownValue << 2);
+    velocity.SetCurve(kFastTime, kSlowTime);
+
+    std::mt19937 rng{ 1 };
+    std::uniform_real_distribution<double> noiseDist(-noise, noise);
+    CKeyScanner::Snapshot snapshot{};
+    bool pressed[kNumKeys]{};
+    uint32_t numPresses[kNumKeys]{};
+    uint8_t measured[kNumKeys][2]{};
+    uint64_t lastSample[kNumKeys]{};
+
+    for (uint64_t now = kScanUs; now < 10'000'000; now += kScanUs) {
+        snapshot.updated = 0;
+        snapshot.fresh = 0;
+        ++snapshot.scans;
+        for (uint32_t i = 0; i < kNumKeys; ++i) {
+            snapshot.updated |= 1 << i;
+            if (staleEvery != 0 && rng() % staleEvery == 0) continue;
+            const uint64_t sample = std::max(lastSample[i] + 1, now - (jitterUs ? rng() % jitterUs : 0));
+            lastSample[i] = sample;
+            const double level = keys[i].Level(sample / 1000.0) + noiseDist(rng);
+            snapshot.adc[i] = static_cast<uint16_t>(std::clamp(std::lround(level), 0l, 1023l));
+            snapshot.tick[i] = static_cast<uint8_t>(sample / 100);
+            snapshot.fresh |= 1 << i;
+        }
+
+        velocity.Process(snapshot);
+
+        // CKeyboard::ProcessData
+        for (uint32_t i = 0; i < kNumKeys; ++i) {
+            const uint8_t adc = snapshot.adc[i] >> 2;
+            if (adc < 10) continue;
+            if (adc > kUpValue && pressed[i]) {
+                pressed[i] = false;
+            }
+            else if (adc < kDownValue && !pressed[i]) {
+                pressed[i] = true;
+                if (numPresses[i] < 2) measured[i][numPresses[i]] = velocity.GetVelocity(i);
+                ++numPresses[i];
+            }
+        }
+    }
+
+    // 起点到按下值, 或者半抬起的位置到按下值, 折算到同样的距离后时间相同
+    double maxError = 0.0;
+    bool ok = true;
+    std::printf("key  speed(adc/ms)  travel(ms)  ideal  press  restrike\n");
+    for (uint32_t i = 0; i < kNumKeys; ++i) {
+        const double travel = (kStartValue - kDownValue) * 4.0 / keys[i].speed;
+        const double ideal = IdealVelocity(travel);
+        std::printf("%3u  %13.2f  %10.2f  %5.0f  %5u  %8u\n", i, keys[i].speed, travel, ideal, measured[i][0], measured[i][1]);
+        if (numPresses[i] != 2) ok = false;
+        maxError = std::max(maxError, std::abs(measured[i][0] - ideal));
+        // 再次按下只走了很短的距离, 不到两次采样时没法计时
+        const double restrike = (kHalfRelease - kDownValue * 4.0) / keys[i].speed;
+        if (restrike >= 2.0 * kScanUs / 1000.0) {
+            maxError = std::max(maxError, std::abs(measured[i][1] - ideal));
+        }
+    }
+    // 采样时间单位0.1ms, 最快的几档误差最大
+    const double tolerance = noise > 0.0 || staleEvery != 0 ? 16.0 : 8.0;
+    ok = ok && maxError <= tolerance;
+    std::printf("max error %.1f (tolerance %.0f)\n", maxError, tolerance);
+    std::printf("%s\n", ok ? "ok" : "FAILED");
+    return ok ? 0 : 1;
+}
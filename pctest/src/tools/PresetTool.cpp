@@ -0,0 +1,482 @@
+// SysEx预设传输的主机端, 对着模拟的设备运行, 协议见 utli/SysEx.hpp
+// 用法: PresetTool <命令> [选项]
+//   backup <bank.bin>            读出整个预设bank
+//   restore <bank.bin>           写入预设bank, --persist 同时写flash
+//   get-current <patch.bin>      读出当前音色
+//   set-current <patch.bin>      写入当前音色
+//   set-tuning <a.scl> [<a.kbm>] 写入音律, 不带文件名时回到十二平均律
+//   selftest                     随机数据读写往返, 检查结果一致
+// 选项: --device <bank.bin>     模拟设备的初始bank, 默认按字节序号填充
+//       --loss <N>              平均每N条消息随机损坏一条, 测试续传
+// 模拟设备是固件的 utli::CSysExTransfer, 中间按USB MIDI拆包/组装
+// 全速USB每1ms帧每个方向一个64字节包(16个事件), 设备发送队列和固件一样是128个事件
+#include "utli/SysEx.hpp"
+#include "utli/SysExTransfer.hpp"
+#include "dsp/Scala.hpp"
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace utli;
+using sysex::Command;
+using sysex::Status;
+
+// sizeof(dsp::SavedParams) * CPresetBank::kNumPresets
+static constexpr uint32_t kPresetSize = 128;
+static constexpr uint32_t kBankSize = kPresetSize * 16;
+// CPresetTransfer::kTuningSize
+static constexpr uint32_t kTuningSize = 2048;
+static constexpr uint32_t kEventsPerFrame = 16;
+static constexpr uint32_t kDeviceTxEvents = 128;
+// 没有任何回复时视为丢失
+static constexpr uint32_t kTimeoutFrames = 20;
+// 不等回复连续发送的kWrite
+static constexpr uint32_t kWriteWindow = 4;
+
+enum Region : uint8_t {
+    kBank = 0,
+    kCurrent = 1,
+    kTuning = 2,
+};
+
+// --------------------------------------------------------------------------------
+// 模拟设备
+// --------------------------------------------------------------------------------
+static std::vector<uint8_t> deviceBank(kBankSize);
+static std::vector<uint8_t> deviceCurrent(kPresetSize);
+static uint8_t bankBuffer[kBankSize];
+static uint8_t currentBuffer[kPresetSize];
+static uint8_t tuningBuffer[kTuningSize];
+// 和固件一样解析, 只保留结果
+static float deviceFreqs[dsp::scala::kNumNotes];
+static std::deque<sysex::Packet> deviceTx;
+static uint32_t numPersists;
+
+static bool DeviceWrite(std::span<const uint8_t> msg) {
+    if (deviceTx.size() + sysex::NumPackets(msg.size()) > kDeviceTxEvents) return false;
+    sysex::ToPackets(msg, [](const sysex::Packet& p) { deviceTx.push_back(p); });
+    return true;
+}
+
+static CSysExTransfer device;
+
+// 和固件的 PresetTransfer 一样, 取出一段以 '\0' 结束的文本
+static std::string_view NextText(std::span<const uint8_t>& buffer) {
+    const uint32_t len = std::find(buffer.begin(), buffer.end(), 0) - buffer.begin();
+    const std::string_view text{ reinterpret_cast<const char*>(buffer.data()), len };
+    buffer = buffer.subspan(std::min<uint32_t>(len + 1, buffer.size()));
+    return text;
+}
+
+static void InitDevice() {
+    static const CSysExTransfer::Region regions[] {
+        { bankBuffer,
+          [](std::span<uint8_t> b) { std::copy(deviceBank.begin(), deviceBank.end(), b.begin()); },
+          [](std::span<const uint8_t> b, uint8_t flags) {
+              deviceBank.assign(b.begin(), b.end());
+              if (flags & sysex::kCommitPersist) ++numPersists;
+              return true;
+          } },
+        { currentBuffer,
+          [](std::span<uint8_t> b) { std::copy(deviceCurrent.begin(), deviceCurrent.end(), b.begin()); },
+          [](std::span<const uint8_t> b, uint8_t) {
+              deviceCurrent.assign(b.begin(), b.end());
+              return true;
+          } },
+        { tuningBuffer,
+          [](std::span<uint8_t> b) { std::fill(b.begin(), b.end(), 0); },
+          [](std::span<const uint8_t> b, uint8_t flags) {
+              if (flags & sysex::kCommitPersist) return false;
+              const auto scl = NextText(b);
+              const auto kbm = NextText(b);
+              if (scl.empty()) {
+                  for (uint32_t i = 0; i < dsp::scala::kNumNotes; ++i) {
+                      deviceFreqs[i] = 440.0f * std::exp2((i - 69.0f) / 12.0f);
+                  }
+                  return true;
+              }
+              static dsp::scala::Scale scale;
+              auto map = dsp::scala::DefaultKeyboardMap();
+              return dsp::scala::ParseScale(scl, scale)
+                  && (kbm.empty() || dsp::scala::ParseKeyboardMap(kbm, map))
+                  && dsp::scala::GetFrequencies(scale, map, deviceFreqs);
+          } },
+    };
+    device.Init(regions, DeviceWrite);
+}
+
+// --------------------------------------------------------------------------------
+// 连接, 每次 Tick 是一个USB帧
+// --------------------------------------------------------------------------------
+class Link {
+public:
+    explicit Link(uint32_t lossEvery) : lossEvery_(lossEvery) {}
+
+    void Send(sysex::MessageBuilder& builder) {
+        uint8_t msg[sysex::kMaxMessage];
+        const uint32_t size = builder.Finish(msg);
+        Corrupt(std::span{ msg, size });
+        sysex::ToPackets(std::span{ msg, size }, [this](const sysex::Packet& p) { hostTx_.push_back(p); });
+        ++numSent_;
+    }
+
+    /**
+     * @brief 运行一帧
+     * @return 收到的消息, 没有时为空
+     */
+    std::vector<std::vector<uint8_t>> Tick() {
+        ++frames_;
+        for (uint32_t i = 0; i < kEventsPerFrame && !hostTx_.empty(); ++i) {
+            if (deviceRx_.Push(hostTx_.front())) {
+                device.OnMessage(deviceRx_.GetMessage());
+            }
+            hostTx_.pop_front();
+        }
+        device.Poll();
+
+        std::vector<std::vector<uint8_t>> received;
+        for (uint32_t i = 0; i < kEventsPerFrame && !deviceTx.empty(); ++i) {
+            if (hostRx_.Push(deviceTx.front())) {
+                auto msg = hostRx_.GetMessage();
+                received.emplace_back(msg.begin(), msg.end());
+                Corrupt(received.back());
+                ++numReceived_;
+            }
+            deviceTx.pop_front();
+        }
+        return received;
+    }
+
+    uint32_t GetFrames() const { return frames_; }
+    uint32_t GetNumSent() const { return numSent_; }
+    uint32_t GetNumReceived() const { return numReceived_; }
+private:
+    // 改掉CRC覆盖的一个数据字节
+    void Corrupt(std::span<uint8_t> msg) {
+        if (lossEvery_ == 0 || rng_() % lossEvery_ != 0) return;
+        msg[sysex::kHeaderSize + 1] ^= 0x01;
+    }
+
+    uint32_t lossEvery_;
+    std::mt19937 rng_{ 2 };
+    uint32_t frames_{};
+    uint32_t numSent_{};
+    uint32_t numReceived_{};
+    std::deque<sysex::Packet> hostTx_;
+    sysex::Assembler deviceRx_;
+    sysex::Assembler hostRx_;
+};
+
+// --------------------------------------------------------------------------------
+// 主机端
+// --------------------------------------------------------------------------------
+struct Info {
+    uint32_t size;
+    uint32_t written;
+};
+
+static uint32_t numRetries;
+
+// 直到收到 kInfo
+static Info Query(Link& link, uint8_t region) {
+    for (;;) {
+        sysex::MessageBuilder b{ Command::kQuery };
+        link.Send(b);
+        for (uint32_t t = 0; t < kTimeoutFrames; ++t) {
+            for (auto& raw : link.Tick()) {
+                sysex::Message m;
+                if (m.Parse(raw) != sysex::Message::Result::kOk || m.GetCommand() != Command::kInfo) continue;
+                m.Get8();
+                const uint32_t numRegions = m.Get8();
+                m.Get16();
+                Info info{};
+                for (uint32_t i = 0; i < numRegions; ++i) {
+                    const uint32_t size = m.Get32();
+                    const uint32_t written = m.Get32();
+                    if (i == region) info = { size, written };
+                }
+                if (m.IsValid() && region < numRegions) return info;
+            }
+        }
+        ++numRetries;
+    }
+}
+
+static std::vector<uint8_t> Read(Link& link, uint8_t region) {
+    const Info info = Query(link, region);
+    std::vector<uint8_t> data(info.size);
+    uint32_t offset = 0;
+    for (;;) {
+        sysex::MessageBuilder b{ Command::kRead };
+        b.Put8(region);
+        b.Put32(offset);
+        b.Put32(info.size - offset);
+        link.Send(b);
+
+        bool finished = false;
+        for (uint32_t idle = 0; idle < kTimeoutFrames && !finished;) {
+            auto received = link.Tick();
+            idle = received.empty() ? idle + 1 : 0;
+            for (auto& raw : received) {
+                sysex::Message m;
+                if (m.Parse(raw) != sysex::Message::Result::kOk) continue;
+                if (m.GetCommand() == Command::kData) {
+                    const uint8_t r = m.Get8();
+                    const uint32_t at = m.Get32();
+                    const uint32_t len = m.Get16();
+                    auto chunk = m.Get(len);
+                    // 中间丢了一块时后面的都不要, 等结束后从缺口继续
+                    if (!m.IsValid() || r != region || at != offset || at + len > info.size) continue;
+                    std::copy(chunk.begin(), chunk.end(), data.begin() + at);
+                    offset += len;
+                }
+                else if (m.GetCommand() == Command::kAck) {
+                    const uint8_t r = m.Get8();
+                    const auto status = static_cast<Status>(m.Get8());
+                    m.Get32();
+                    const uint32_t crc = m.Get32();
+                    if (r != region) continue;
+                    finished = true;
+                    if (status == Status::kOk && offset == info.size) {
+                        if (crc == Crc32(data)) return data;
+                        // 拼接的数据不对, 从头重读
+                        offset = 0;
+                    }
+                }
+            }
+        }
+        ++numRetries;
+    }
+}
+
+static bool Write(Link& link, uint8_t region, std::span<const uint8_t> data, uint8_t flags) {
+    const Info info = Query(link, region);
+    if (info.size != data.size()) {
+        std::printf("size mismatch: device %u, file %zu\n", info.size, data.size());
+        return false;
+    }
+    uint32_t acked = 0;
+    uint32_t sent = 0;
+    uint32_t idle = 0;
+    for (;;) {
+        while (sent < data.size() && sent - acked < kWriteWindow * sysex::kMaxChunk) {
+            const uint32_t len = std::min<uint32_t>(data.size() - sent, sysex::kMaxChunk);
+            sysex::MessageBuilder b{ Command::kWrite };
+            b.Put8(region);
+            b.Put32(sent);
+            b.Put16(len);
+            b.Put(data.subspan(sent, len));
+            link.Send(b);
+            sent += len;
+        }
+        if (acked == data.size() && sent == data.size()) {
+            sysex::MessageBuilder b{ Command::kCommit };
+            b.Put8(region);
+            b.Put8(flags);
+            b.Put32(Crc32(data));
+            link.Send(b);
+            sent = data.size() + 1;
+        }
+
+        bool resume = false;
+        auto received = link.Tick();
+        idle = received.empty() ? idle + 1 : 0;
+        for (auto& raw : received) {
+            sysex::Message m;
+            if (m.Parse(raw) != sysex::Message::Result::kOk || m.GetCommand() != Command::kAck) {
+                resume = true;
+                continue;
+            }
+            const uint8_t r = m.Get8();
+            const auto status = static_cast<Status>(m.Get8());
+            const uint32_t next = m.Get32();
+            if (r != region) {
+                // 设备收到损坏的消息
+                resume = true;
+                continue;
+            }
+            if (sent > data.size()) {
+                // commit 的回复
+                if (status == Status::kOk) return true;
+                if (status == Status::kCommitFailed) return false;
+                resume = true;
+            }
+            else if (status == Status::kOk) {
+                acked = std::max(acked, next);
+            }
+            else {
+                resume = true;
+            }
+        }
+        if (resume || idle >= kTimeoutFrames) {
+            // 等在途的消息都结束, 再从设备记录的位置继续
+            while (!link.Tick().empty()) {
+            }
+            acked = sent = Query(link, region).written;
+            idle = 0;
+            ++numRetries;
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------
+// main
+// --------------------------------------------------------------------------------
+static bool ReadFile(const char* path, std::vector<uint8_t>& data) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    data.assign(std::istreambuf_iterator<char>(in), {});
+    return true;
+}
+
+static bool WriteFile(const char* path, std::span<const uint8_t> data) {
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return static_cast<bool>(out);
+}
+
+static void PrintStats(const Link& link, uint32_t bytes) {
+    std::printf("%u bytes, %u frames (%.1f ms), %u messages sent, %u received, %u retries\n",
+                bytes, link.GetFrames(), link.GetFrames() * 1.0, link.GetNumSent(), link.GetNumReceived(), numRetries);
+}
+
+static int SelfTest(uint32_t lossEvery) {
+    std::mt19937 rng{ 1 };
+    std::vector<uint8_t> bank(kBankSize);
+    for (auto& b : bank) b = rng();
+    std::vector<uint8_t> patch(kPresetSize);
+    for (auto& b : patch) b = rng();
+
+    Link link{ lossEvery };
+    bool ok = Write(link, kBank, bank, sysex::kCommitPersist) && deviceBank == bank && numPersists == 1;
+    std::printf("restore     %s: ", ok ? "ok" : "FAILED");
+    PrintStats(link, kBankSize);
+
+    Link link2{ lossEvery };
+    numRetries = 0;
+    auto back = Read(link2, kBank);
+    ok = ok && back == bank;
+    std::printf("backup      %s: ", back == bank ? "ok" : "FAILED");
+    PrintStats(link2, kBankSize);
+
+    Link link3{ lossEvery };
+    numRetries = 0;
+    bool patchOk = Write(link3, kCurrent, patch, 0) && Read(link3, kCurrent) == patch;
+    ok = ok && patchOk;
+    std::printf("current     %s: ", patchOk ? "ok" : "FAILED");
+    PrintStats(link3, kPresetSize * 2);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::printf("usage: PresetTool backup|restore|get-current|set-current <file> [--persist] [--device <bank.bin>] [--loss <N>]\n"
+                    "       PresetTool set-tuning [<a.scl> [<a.kbm>]] [--loss <N>]\n"
+                    "       PresetTool selftest [--loss <N>]\n");
+        return 1;
+    }
+    const std::string command = argv[1];
+    const char* file = nullptr;
+    const char* file2 = nullptr;
+    uint32_t lossEvery = 0;
+    uint8_t flags = 0;
+    bool hasImage = false;
+    for (int i = 2; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--persist")) {
+            flags |= sysex::kCommitPersist;
+        }
+        else if (!std::strcmp(argv[i], "--loss") && i + 1 < argc) {
+            lossEvery = std::atoi(argv[++i]);
+        }
+        else if (!std::strcmp(argv[i], "--device") && i + 1 < argc) {
+            std::vector<uint8_t> image;
+            if (!ReadFile(argv[++i], image) || image.size() != kBankSize) {
+                std::printf("bad device image: %s\n", argv[i]);
+                return 1;
+            }
+            deviceBank = image;
+            hasImage = true;
+        }
+        else if (file == nullptr) {
+            file = argv[i];
+        }
+        else {
+            file2 = argv[i];
+        }
+    }
+
+    if (!hasImage) {
+        for (uint32_t i = 0; i < kBankSize; ++i) {
+            deviceBank[i] = static_cast<uint8_t>(i);
+        }
+    }
+    InitDevice();
+
+    if (command == "selftest") {
+        return SelfTest(lossEvery);
+    }
+    if (command == "set-tuning") {
+        // .scl 和 .kbm 各以 '\0' 结束, 剩下的填0
+        std::vector<uint8_t> data;
+        std::vector<uint8_t> kbm;
+        if ((file && !ReadFile(file, data)) || (file2 && !ReadFile(file2, kbm))) {
+            std::printf("failed to read input\n");
+            return 1;
+        }
+        data.push_back(0);
+        data.insert(data.end(), kbm.begin(), kbm.end());
+        data.push_back(0);
+        if (data.size() > kTuningSize) {
+            std::printf("tuning text is longer than %u bytes\n", kTuningSize);
+            return 1;
+        }
+        data.resize(kTuningSize);
+        Link link{ lossEvery };
+        if (!Write(link, kTuning, data, flags & ~sysex::kCommitPersist)) {
+            std::printf("write failed, device rejected the scale\n");
+            return 1;
+        }
+        PrintStats(link, data.size());
+        for (uint32_t note = 24; note <= 108; note += 12) {
+            std::printf("note %3u  %9.3f Hz\n", note, deviceFreqs[note]);
+        }
+        return 0;
+    }
+    if (file == nullptr) {
+        std::printf("missing file\n");
+        return 1;
+    }
+
+    Link link{ lossEvery };
+    if (command == "backup" || command == "get-current") {
+        const uint8_t region = command == "backup" ? kBank : kCurrent;
+        auto data = Read(link, region);
+        if (!WriteFile(file, data)) {
+            std::printf("failed to write %s\n", file);
+            return 1;
+        }
+        PrintStats(link, data.size());
+        return 0;
+    }
+    if (command == "restore" || command == "set-current") {
+        const uint8_t region = command == "restore" ? kBank : kCurrent;
+        std::vector<uint8_t> data;
+        if (!ReadFile(file, data)) {
+            std::printf("failed to read %s\n", file);
+            return 1;
+        }
+        if (!Write(link, region, data, flags)) {
+            std::printf("write failed\n");
+            return 1;
+        }
+        PrintStats(link, data.size());
+        return 0;
+    }
+    std::printf("unknown command: %s\n", command.c_str());
+    return 1;
+}
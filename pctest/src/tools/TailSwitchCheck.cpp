@@ -0,0 +1,120 @@
+// 渲染 dsp/PluckString 的尾音, 检查完整环路和简化环路互相切换时有没有咔嗒声
+// governor降级时切到简化环路, 恢复时切回, 两个方向都在已知的block上触发
+// 咔嗒声按二阶差分衡量: 切换后一段的峰值 / 切换前和切换稳定后的峰值, 没有突变时接近1
+// 两种环路的高频衰减不同, 只和切换前比较时简化环路本身就会大一些
+// 用法: TailSwitchCheck
+// 全部通过时返回0
+#include "dsp/PluckString.hpp"
+#include "dsp/Tuning.hpp"
+#include "dsp/params.hpp"
+#include "MidiManager.hpp"
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace dsp;
+
+// PluckString 链接时需要的全局对象, 固件里在 SafeCallback.cpp 和 MidiManager.cpp 中
+namespace dsp {
+ThreadSafeCallback gSafeCallback;
+CSynthParams SynthParams;
+}
+ThreadSafeCallback::Proxy ThreadSafeCallback::NewProxy() { return { *this, proxyCounter_++ }; }
+void ThreadSafeCallback::MarkDirty(uint32_t) {}
+CMidiManager MidiManager;
+float CMidiManager::GetTouchSliderValue(uint8_t) { return 0.0f; }
+
+static constexpr float kSampleRate = 48000.0f;
+static constexpr uint32_t kBlockSize = 64;
+// 切换前后比较的长度
+static constexpr uint32_t kWindow = 512;
+static constexpr uint32_t kAfter = 128;
+// 淡化期间两个不同延迟的信号叠加, 峰值会有起伏; 直接切换时是4倍以上
+static constexpr double kMaxClickRatio = 2.0;
+// 在这个电平之间切换, 高于 kTailLevel, 低于 kCheapLoopLevel
+static constexpr float kSwitchLevel = 0.03f;
+static constexpr uint8_t kNotes[] { 28, 40, 52, 64, 76, 88, 100 };
+
+static uint32_t numFailed;
+
+static void Check(bool ok, const char* what) {
+    std::printf("%-64s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) ++numFailed;
+}
+
+static double PeakSecondDiff(const std::vector<float>& x, size_t begin, size_t end) {
+    double peak = 0.0;
+    for (size_t t = std::max<size_t>(begin, 2); t < end; ++t) {
+        peak = std::max(peak, static_cast<double>(std::abs(x[t] - 2.0f * x[t - 1] + x[t - 2])));
+    }
+    return peak;
+}
+
+static double ClickRatio(const std::vector<float>& x, size_t at) {
+    const double before = PeakSecondDiff(x, at - kWindow, at);
+    const double after = PeakSecondDiff(x, at + kWindow, at + kWindow * 2);
+    return PeakSecondDiff(x, at, at + kAfter) / std::max(before, after);
+}
+
+struct Result {
+    double toCheap;
+    double toFull;
+};
+
+static Result Render(uint8_t note, float dispersion) {
+    // 每次用新的延迟线, 不带上一次的尾音
+    static DelayLine delay;
+    delay.ClearInternal();
+    PluckString string;
+    string.SetDelayLineRef(&delay, nullptr);
+    string.Init(kSampleRate);
+    string.SetDispersion(dispersion);
+    string.NoteOn(0, note, 1.0f);
+
+    std::vector<float> out;
+    float block[kBlockSize];
+    auto processBlock = [&] {
+        string.Process(block, block);
+        out.insert(out.end(), std::begin(block), std::end(block));
+        float peak = 0.0f;
+        for (float s : block) peak = std::max(peak, std::abs(s));
+        return peak;
+    };
+
+    // 等到尾音电平低于 kSwitchLevel, 之后一直是安静的尾音
+    float peak = 1.0f;
+    while (out.size() < kWindow * 4 || peak > kSwitchLevel) {
+        peak = processBlock();
+    }
+    // 完整 -> 简化, 在下一个block开头切换
+    string.SetReducedQuality(true);
+    const size_t toCheap = out.size();
+    for (uint32_t i = 0; i < kWindow * 2 / kBlockSize; ++i) processBlock();
+    // 简化 -> 完整
+    string.SetReducedQuality(false);
+    const size_t toFull = out.size();
+    for (uint32_t i = 0; i < kWindow * 2 / kBlockSize; ++i) processBlock();
+
+    return { ClickRatio(out, toCheap), ClickRatio(out, toFull) };
+}
+
+int main() {
+    ExciterBank::Init(kSampleRate);
+    double maxRatio = 0.0;
+    // 色散低于阈值时简化环路还会旁路色散滤波器, 两种情况都检查
+    for (float dispersion : { 0.0f, 0.05f }) {
+        SynthParams.string.dispersion.SetValue(static_cast<int32_t>(dispersion * FloatParamDesc::kScale));
+        Tuning.Init(kSampleRate);
+        for (uint8_t note : kNotes) {
+            const auto r = Render(note, dispersion);
+            std::printf("dispersion %.2f note %3u  to cheap %5.2f  to full %5.2f\n", dispersion, note, r.toCheap, r.toFull);
+            maxRatio = std::max({ maxRatio, r.toCheap, r.toFull });
+        }
+    }
+    char what[64];
+    std::snprintf(what, sizeof(what), "second difference around the switch within %.1fx", kMaxClickRatio);
+    Check(maxRatio < kMaxClickRatio, what);
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}
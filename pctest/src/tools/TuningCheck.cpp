@@ -0,0 +1,157 @@
+// 检查 dsp/Scala 对 .scl/.kbm 的解析和算出的频率
+// 用法: TuningCheck [<file.scl> [<file.kbm>]]
+//   不带参数时检查内置的几个音阶, 全部通过时返回0
+//   带文件时打印每个音符的频率和相对十二平均律的音分
+#include "dsp/Scala.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace dsp::scala;
+
+static uint32_t numFailed;
+
+static void Check(bool ok, const char* what) {
+    std::printf("%-56s %s\n", what, ok ? "ok" : "FAILED");
+    if (!ok) ++numFailed;
+}
+
+static double EqualFreq(double note) {
+    return 440.0 * std::exp2((note - 69.0) / 12.0);
+}
+
+// 最大误差, 音分, 期望值和固件一样限制在十二平均律0~127的范围内
+static double MaxError(const float* freqs, double (*expected)(uint32_t)) {
+    double err = 0.0;
+    for (uint32_t note = 0; note < kNumNotes; ++note) {
+        const double freq = std::clamp(expected(note), EqualFreq(0), EqualFreq(kNumNotes - 1));
+        err = std::max(err, std::abs(1200.0 * std::log2(freqs[note] / freq)));
+    }
+    return err;
+}
+
+// 十二平均律写成 .scl, 带注释、空行和行尾说明
+static constexpr const char* kEqualScl =
+    "! 12tet.scl\n"
+    "!\n"
+    "12 tone equal temperament\n"
+    " 12\n"
+    "!\n"
+    " 100.0\n 200.0\n 300.0\n 400.0\n 500.0\n 600.0\n"
+    " 700.0\n 800.0\n 900.0\n 1000.0\n 1100.0\n"
+    " 2/1   octave\n";
+
+// 五度相生律, 比例写法
+static constexpr const char* kPythagoreanScl =
+    "Pythagorean\n"
+    "12\n"
+    "2187/2048\n9/8\n32/27\n81/64\n4/3\n729/512\n3/2\n6561/4096\n27/16\n16/9\n243/128\n2\n";
+static constexpr double kPythagoreanRatios[] = {
+    1.0, 2187.0 / 2048, 9.0 / 8, 32.0 / 27, 81.0 / 64, 4.0 / 3, 729.0 / 512,
+    3.0 / 2, 6561.0 / 4096, 27.0 / 16, 16.0 / 9, 243.0 / 128,
+};
+
+// 中央C为第0级, A4 = 432Hz, 只映射白键, 黑键按十二平均律, 范围 21~108
+static constexpr const char* kWhiteKeysKbm =
+    "! white keys\n"
+    "12\n21\n108\n60\n69\n432.0\n7\n"
+    "! mapping\n"
+    "0\nx\n1\nx\n2\n3\nx\n4\nx\n5\nx\n6\n";
+// C大调的自然音阶, 7级
+static constexpr const char* kJustMajorScl =
+    "Just major\n7\n9/8\n5/4\n4/3\n3/2\n5/3\n15/8\n2/1\n";
+static constexpr double kJustMajorRatios[] = { 1.0, 9.0 / 8, 5.0 / 4, 4.0 / 3, 3.0 / 2, 5.0 / 3, 15.0 / 8 };
+static constexpr int32_t kWhiteDegree[12] = { 0, -1, 1, -1, 2, 3, -1, 4, -1, 5, -1, 6 };
+
+static double PythagoreanFreq(uint32_t note) {
+    // 默认映射: 60 为第0级, 参考键69(第9级)为440Hz
+    const int32_t offset = static_cast<int32_t>(note) - 60;
+    const int32_t octave = offset >= 0 ? offset / 12 : -((11 - offset) / 12);
+    const int32_t degree = offset - octave * 12;
+    const double c4 = 440.0 / kPythagoreanRatios[9];
+    return c4 * std::exp2(octave) * kPythagoreanRatios[degree];
+}
+
+static double WhiteKeysFreq(uint32_t note) {
+    const int32_t offset = static_cast<int32_t>(note) - 60;
+    const int32_t octave = offset >= 0 ? offset / 12 : -((11 - offset) / 12);
+    const int32_t degree = kWhiteDegree[offset - octave * 12];
+    if (note < 21 || note > 108 || degree < 0) return EqualFreq(note);
+    const double c4 = 432.0 / kJustMajorRatios[5];
+    return c4 * std::exp2(octave) * kJustMajorRatios[degree];
+}
+
+static bool ReadFile(const char* path, std::string& text) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    text.assign(std::istreambuf_iterator<char>(in), {});
+    return true;
+}
+
+static int PrintFile(int argc, char** argv) {
+    std::string scl;
+    std::string kbm;
+    if (!ReadFile(argv[1], scl) || (argc > 2 && !ReadFile(argv[2], kbm))) {
+        std::printf("failed to read input\n");
+        return 1;
+    }
+    Scale scale;
+    KeyboardMap map = DefaultKeyboardMap();
+    if (!ParseScale(scl, scale) || (!kbm.empty() && !ParseKeyboardMap(kbm, map))) {
+        std::printf("parse failed\n");
+        return 1;
+    }
+    float freqs[kNumNotes];
+    if (!GetFrequencies(scale, map, freqs)) {
+        std::printf("reference key %d is not mapped\n", map.referenceNote);
+        return 1;
+    }
+    std::printf("note  freq(Hz)    cents\n");
+    for (uint32_t note = 0; note < kNumNotes; ++note) {
+        std::printf("%4u  %10.3f  %+7.2f\n", note, freqs[note], 1200.0 * std::log2(freqs[note] / EqualFreq(note)));
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        return PrintFile(argc, argv);
+    }
+
+    Scale scale;
+    float freqs[kNumNotes];
+    const auto defaultMap = DefaultKeyboardMap();
+    bool ok = ParseScale(kEqualScl, scale) && scale.numDegrees == 12 && GetFrequencies(scale, defaultMap, freqs);
+    Check(ok, "12tet.scl parses, 12 degrees");
+    // 未映射的键和范围限制用 fastmath::Exp2
+    ok = ok && MaxError(freqs, [](uint32_t n) { return EqualFreq(n); }) < 0.01;
+    Check(ok, "12tet.scl matches 440 * 2^((n-69)/12) within 0.01 cent");
+
+    ok = ParseScale(kPythagoreanScl, scale) && GetFrequencies(scale, defaultMap, freqs)
+        && MaxError(freqs, PythagoreanFreq) < 0.01;
+    Check(ok, "pythagorean ratios, default map, within 0.01 cent");
+    Check(std::abs(freqs[69] - 440.0f) < 1e-3f, "reference key 69 is 440Hz");
+
+    KeyboardMap map;
+    ok = ParseScale(kJustMajorScl, scale) && ParseKeyboardMap(kWhiteKeysKbm, map)
+        && map.size == 12 && map.degrees[1] == -1 && map.octaveDegree == 7;
+    Check(ok, "white-key .kbm parses, 'x' is unmapped");
+    ok = ok && GetFrequencies(scale, map, freqs) && MaxError(freqs, WhiteKeysFreq) < 0.01;
+    Check(ok, "just major on white keys, 432Hz, within 0.01 cent");
+    Check(std::abs(freqs[69] - 432.0f) < 1e-3f, "reference key 69 is 432Hz");
+
+    // 参考键没有映射
+    map.referenceNote = 70;
+    Check(!GetFrequencies(scale, map, freqs), "unmapped reference key is rejected");
+
+    Check(!ParseScale("bad\n3\n100.0\n200.0\n", scale), "too few degrees is rejected");
+    Check(!ParseScale("bad\n2\n100.0\n0/1\n", scale), "zero ratio is rejected");
+    Check(!ParseScale("bad\n1\n-1200.0\n", scale), "negative period is rejected");
+    Check(!ParseKeyboardMap("12\n0\n127\n60\n69\n0.0\n12\n", map), "zero reference frequency is rejected");
+
+    std::printf("%s\n", numFailed == 0 ? "ok" : "FAILED");
+    return numFailed == 0 ? 0 : 1;
+}